@@ -101,6 +101,7 @@ static int runQtApplication(int argc, char* argv[], qtwebapp::LoggerWithFile *lo
 #endif
 	MainParser parser;
 	parser.parse(*qApp);
+	logger->setAsyncMode(parser.getAsyncLogging());
 
 #if QT_VERSION >= 0x050400
 	qInfo("%s %s Qt %s %db %s %s DSP Rx:%db Tx:%db PID %lld",
@@ -68,6 +68,7 @@ static int runQtApplication(int argc, char* argv[], qtwebapp::LoggerWithFile *lo
 
     MainParser parser;
     parser.parse(a);
+    logger->setAsyncMode(parser.getAsyncLogging());
 
 #if QT_VERSION >= 0x050400
     qInfo("%s %s Qt %s %db %s %s DSP Rx:%db Tx:%db PID %lld",
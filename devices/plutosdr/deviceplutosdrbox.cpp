@@ -42,6 +42,8 @@ DevicePlutoSDRBox::DevicePlutoSDRBox(const std::string& uri) :
         m_devTx(0),
         m_chnRx0i(0),
         m_chnRx0q(0),
+        m_chnRx1i(0),
+        m_chnRx1q(0),
         m_chnTx0i(0),
         m_chnTx0q(0),
         m_rxBuf(0),
@@ -81,6 +83,7 @@ DevicePlutoSDRBox::~DevicePlutoSDRBox()
 {
     deleteRxBuffer();
     deleteTxBuffer();
+    closeSecondRx();
     closeRx();
     closeTx();
     if (m_ctx) { iio_context_destroy(m_ctx); }
@@ -366,6 +369,41 @@ void DevicePlutoSDRBox::closeTx()
     if (m_chnTx0q) { iio_channel_disable(m_chnTx0q); }
 }
 
+/**
+ * Enable the I/Q channels of the second receiver. They exist only when the AD9361 is
+ * configured in 2R2T mode. Once enabled the Rx buffer interleaves I0 Q0 I1 Q1 for each sample.
+ */
+bool DevicePlutoSDRBox::openSecondRx()
+{
+    if (!m_valid) { return false; }
+
+    if (!m_chnRx1i) {
+        m_chnRx1i = iio_device_find_channel(m_devRx, "voltage2", false);
+    }
+
+    if (!m_chnRx1q) {
+        m_chnRx1q = iio_device_find_channel(m_devRx, "voltage3", false);
+    }
+
+    if (m_chnRx1i && m_chnRx1q)
+    {
+        iio_channel_enable(m_chnRx1i);
+        iio_channel_enable(m_chnRx1q);
+        return true;
+    }
+    else
+    {
+        std::cerr << "DevicePlutoSDRBox::openSecondRx: failed (device not in 2R2T mode?)" << std::endl;
+        return false;
+    }
+}
+
+void DevicePlutoSDRBox::closeSecondRx()
+{
+    if (m_chnRx1i) { iio_channel_disable(m_chnRx1i); }
+    if (m_chnRx1q) { iio_channel_disable(m_chnRx1q); }
+}
+
 struct iio_buffer *DevicePlutoSDRBox::createRxBuffer(unsigned int size, bool cyclic)
 {
     if (m_devRx) {
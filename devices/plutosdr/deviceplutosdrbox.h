@@ -79,6 +79,8 @@ public:
     bool openTx();
     void closeRx();
     void closeTx();
+    bool openSecondRx();
+    void closeSecondRx();
     struct iio_buffer *createRxBuffer(unsigned int size, bool cyclic);
     struct iio_buffer *createTxBuffer(unsigned int size, bool cyclic);
     void deleteRxBuffer();
@@ -121,6 +123,8 @@ private:
     struct iio_device  *m_devTx;
     struct iio_channel *m_chnRx0i;
     struct iio_channel* m_chnRx0q;
+    struct iio_channel *m_chnRx1i;
+    struct iio_channel *m_chnRx1q;
     struct iio_channel *m_chnTx0i;
     struct iio_channel *m_chnTx0q;
     struct iio_buffer  *m_rxBuf;
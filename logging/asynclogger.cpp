@@ -0,0 +1,300 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <QDateTime>
+#include <QElapsedTimer>
+
+#include "asynclogger.h"
+
+using namespace qtwebapp;
+
+std::atomic<AsyncLogger*> AsyncLogger::defaultAsyncLogger(nullptr);
+std::atomic<int> AsyncLogger::activeProducers(0);
+
+AsyncLogger::AsyncLogger(Logger *target, unsigned int capacity, QObject *parent) :
+    QThread(parent),
+    target(target),
+    enqueuePos(0),
+    dequeuePos(0),
+    droppedCount(0),
+    stopRequested(false),
+    writerSleeping(false),
+    lastType(QtDebugMsg),
+    repeatCount(0),
+    repeatStartMsecs(0),
+    reportedDroppedCount(0)
+{
+    quint64 size = 2;
+
+    while (size < capacity) {
+        size <<= 1;
+    }
+
+    records = std::vector<Record>(size);
+    mask = size - 1;
+
+    for (quint64 i = 0; i < size; i++) {
+        records[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+AsyncLogger::~AsyncLogger()
+{
+    AsyncLogger *asyncLogger = this;
+
+    if (defaultAsyncLogger.compare_exchange_strong(asyncLogger, nullptr))
+    {
+        // messages logged from now on are processed synchronously
+        target->installMsgHandler();
+
+        // wait for the threads that may still be pushing to this instance
+        while (activeProducers.load() != 0) {
+            QThread::yieldCurrentThread();
+        }
+    }
+
+    stopRequested.store(true);
+    wakeUp.release();
+    wait();
+    drain();
+    flushRepeated(QDateTime::currentMSecsSinceEpoch());
+    reportDropped();
+}
+
+void AsyncLogger::startLogging()
+{
+    start();
+    defaultAsyncLogger.store(this);
+    qInstallMessageHandler(msgHandler5);
+}
+
+bool AsyncLogger::push(const QtMsgType type, const QString& message, const char *file, const char *function, const int line)
+{
+    quint64 pos = enqueuePos.load(std::memory_order_relaxed);
+    Record *record;
+
+    // claim a slot: its sequence equals the position when it is free for this round
+    for (;;)
+    {
+        record = &records[pos & mask];
+        quint64 sequence = record->sequence.load(std::memory_order_acquire);
+        qint64 diff = (qint64) sequence - (qint64) pos;
+
+        if (diff == 0)
+        {
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        }
+        else if (diff < 0) // buffer full
+        {
+            droppedCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else
+        {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    record->type = type;
+    record->message = message;
+    record->file = file;
+    record->function = function;
+    record->line = line;
+    record->msecs = QDateTime::currentMSecsSinceEpoch();
+    record->threadId = QThread::currentThreadId();
+    record->sequence.store(pos + 1, std::memory_order_release); // publish to the writer thread
+
+    if (writerSleeping.load() && writerSleeping.exchange(false)) {
+        wakeUp.release();
+    }
+
+    return true;
+}
+
+bool AsyncLogger::pop(LogMessage **logMessage)
+{
+    quint64 pos = dequeuePos.load(std::memory_order_relaxed);
+    Record& record = records[pos & mask];
+
+    if (record.sequence.load(std::memory_order_acquire) != pos + 1) {
+        return false; // empty or slot still being written
+    }
+
+    *logMessage = new LogMessage(
+        record.type,
+        record.message,
+        0,
+        record.file ? QString(record.file) : QString(),
+        record.function ? QString(record.function) : QString(),
+        record.line,
+        QDateTime::fromMSecsSinceEpoch(record.msecs),
+        record.threadId
+    );
+
+    record.message.clear();
+    record.sequence.store(pos + mask + 1, std::memory_order_release); // free for next round
+    dequeuePos.store(pos + 1, std::memory_order_release);
+
+    return true;
+}
+
+void AsyncLogger::run()
+{
+    while (!stopRequested.load())
+    {
+        drain();
+        reportDropped();
+
+        if (repeatCount > 0) {
+            flushRepeated(QDateTime::currentMSecsSinceEpoch());
+        }
+
+        // check again for messages after announcing the sleep so that a wake up is never missed
+        writerSleeping.store(true);
+
+        if (dequeuePos.load() == enqueuePos.load()) {
+            wakeUp.tryAcquire(1, 100); // wakes up from time to time to flush repeated messages
+        }
+
+        writerSleeping.store(false);
+        wakeUp.tryAcquire(wakeUp.available()); // wake ups of messages that are already written
+    }
+
+    drain();
+}
+
+void AsyncLogger::drain()
+{
+    LogMessage *logMessage;
+
+    while (pop(&logMessage)) {
+        write(logMessage);
+    }
+}
+
+void AsyncLogger::write(LogMessage *logMessage)
+{
+    if (!lastMessage.isNull() && (logMessage->getType() == lastType) && (logMessage->getMessage() == lastMessage))
+    {
+        if (repeatCount++ == 0) {
+            repeatStartMsecs = logMessage->getTimestamp().toMSecsSinceEpoch();
+        }
+
+        delete logMessage;
+        return;
+    }
+
+    flushRepeated(-1);
+    lastType = logMessage->getType();
+    lastMessage = logMessage->getMessage();
+    target->log(*logMessage);
+    delete logMessage;
+}
+
+void AsyncLogger::flushRepeated(qint64 nowMsecs)
+{
+    // nowMsecs < 0 to flush unconditionally
+    if ((repeatCount == 0) || ((nowMsecs >= 0) && (nowMsecs - repeatStartMsecs < 1000))) {
+        return;
+    }
+
+    target->log(LogMessage(
+        lastType,
+        QString("last message repeated %1 times").arg(repeatCount),
+        0,
+        QString(),
+        QString(),
+        0,
+        QDateTime::currentDateTime(),
+        QThread::currentThreadId()
+    ));
+
+    repeatCount = 0;
+}
+
+void AsyncLogger::reportDropped()
+{
+    quint64 dropped = droppedCount.load(std::memory_order_relaxed);
+
+    if (dropped == reportedDroppedCount) {
+        return;
+    }
+
+    flushRepeated(-1);
+    lastMessage.clear();
+    target->log(LogMessage(
+        QtWarningMsg,
+        QString("AsyncLogger: %1 messages dropped (%2 in total)").arg(dropped - reportedDroppedCount).arg(dropped),
+        0,
+        QString(),
+        QString(),
+        0,
+        QDateTime::currentDateTime(),
+        QThread::currentThreadId()
+    ));
+
+    reportedDroppedCount = dropped;
+}
+
+void AsyncLogger::msgHandler5(const QtMsgType type, const QMessageLogContext &context, const QString &message)
+{
+    activeProducers.fetch_add(1); // before reading the instance so that it is not destroyed meanwhile
+    AsyncLogger *asyncLogger = defaultAsyncLogger.load();
+
+    if (!asyncLogger)
+    {
+        activeProducers.fetch_sub(1);
+        fputs(qPrintable(message), stderr);
+        fflush(stderr);
+    }
+    else if (type != QtFatalMsg)
+    {
+        asyncLogger->push(type, message, context.file, context.function, context.line);
+        activeProducers.fetch_sub(1);
+        return;
+    }
+    else
+    {
+        // let the writer thread write pending messages (with timeout in case it is stuck) then log synchronously
+        QElapsedTimer timer;
+        timer.start();
+
+        while ((asyncLogger->dequeuePos.load() != asyncLogger->enqueuePos.load()) && (timer.elapsed() < 1000)) {
+            QThread::msleep(1);
+        }
+
+        asyncLogger->target->log(LogMessage(
+            type,
+            message,
+            0,
+            context.file,
+            context.function,
+            context.line,
+            QDateTime::currentDateTime(),
+            QThread::currentThreadId()
+        ));
+    }
+
+    if (type == QtFatalMsg) {
+        abort();
+    }
+}
@@ -0,0 +1,137 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef LOGGING_ASYNCLOGGER_H_
+#define LOGGING_ASYNCLOGGER_H_
+
+#include <atomic>
+#include <vector>
+
+#include <QtGlobal>
+#include <QThread>
+#include <QString>
+#include <QSemaphore>
+
+#include "logger.h"
+
+#include "export.h"
+
+namespace qtwebapp {
+
+/**
+  Non blocking front end of a Logger.
+  <p>
+  When started it becomes the handler of the global static logging functions (e.g. qDebug()).
+  The calling thread only stores the message text with its context, time and thread ID in a slot
+  of a lock-free ring buffer. A dedicated writer thread drains the buffer and passes the messages
+  to the target logger that does the decoration and the output (console, file).
+  <p>
+  When the buffer is full messages are dropped and counted. The number of dropped messages
+  is logged as a warning when the buffer has room again.
+  <p>
+  Identical consecutive messages are written once followed by a "last message repeated N times"
+  message when a different message arrives or after one second.
+  <p>
+  The writer thread sleeps while the buffer is empty and is woken up by the next message.
+  <p>
+  Fatal messages are logged synchronously after the pending messages have been written then
+  the program aborts. Thread local variables and backtrace buffers of the target logger are not used.
+*/
+
+class LOGGING_API AsyncLogger : public QThread {
+    Q_OBJECT
+    Q_DISABLE_COPY(AsyncLogger)
+
+public:
+    /**
+      Constructor.
+      @param target Logger that writes the messages. Must live longer than this object.
+      @param capacity Number of slots in the ring buffer. Rounded up to a power of 2.
+    */
+    AsyncLogger(Logger *target, unsigned int capacity=8192, QObject *parent = 0);
+
+    /** Stops the writer thread after the pending messages are written and gives the messages back to the target logger */
+    virtual ~AsyncLogger();
+
+    /** Installs this logger as the handler of the global static logging functions and starts the writer thread */
+    void startLogging();
+
+    /** Number of messages dropped because the buffer was full since creation */
+    quint64 getDroppedCount() const { return droppedCount.load(std::memory_order_relaxed); }
+
+    /**
+      Queue a message for the writer thread. This method never blocks.
+      @return false if the message was dropped
+    */
+    bool push(const QtMsgType type, const QString& message, const char *file, const char *function, const int line);
+
+protected:
+    virtual void run();
+
+private:
+    struct Record
+    {
+        std::atomic<quint64> sequence;
+        QtMsgType type;
+        QString message;
+        const char *file;
+        const char *function;
+        int line;
+        qint64 msecs;
+        Qt::HANDLE threadId;
+    };
+
+    Logger *target;
+    std::vector<Record> records;
+    quint64 mask;
+
+    /** Next slot to be written by the producers (logging threads) */
+    alignas(64) std::atomic<quint64> enqueuePos;
+    /** Next slot to be read by the consumer (writer thread) */
+    alignas(64) std::atomic<quint64> dequeuePos;
+
+    std::atomic<quint64> droppedCount;
+    std::atomic<bool> stopRequested;
+    /** Set by the writer thread before it sleeps. The first producer that clears it wakes the writer up. */
+    std::atomic<bool> writerSleeping;
+    QSemaphore wakeUp;
+
+    /** Repeated message suppression (writer thread only) */
+    QtMsgType lastType;
+    QString lastMessage;
+    int repeatCount;
+    qint64 repeatStartMsecs;
+    quint64 reportedDroppedCount;
+
+    /** Instance receiving the messages of the global static logging functions */
+    static std::atomic<AsyncLogger*> defaultAsyncLogger;
+    /** Number of threads in the message handler. The default instance is not destroyed while it is not zero. */
+    static std::atomic<int> activeProducers;
+
+    /** Take the message from the next slot if available. Writer thread only. */
+    bool pop(LogMessage **logMessage);
+    void drain();
+    void write(LogMessage *logMessage);
+    void flushRepeated(qint64 nowMsecs);
+    void reportDropped();
+
+    static void msgHandler5(const QtMsgType type, const QMessageLogContext& context, const QString &message);
+};
+
+} // end of namespace
+
+#endif /* LOGGING_ASYNCLOGGER_H_ */
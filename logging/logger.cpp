@@ -150,6 +150,18 @@ void Logger::clear(const bool buffer, const bool variables)
 }
 
 
+void Logger::log(const LogMessage& logMessage)
+{
+    mutex.lock();
+
+    if (logMessage.getType()>=minLevel) {
+        write(&logMessage);
+    }
+
+    mutex.unlock();
+}
+
+
 void Logger::log(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line)
 {
     mutex.lock();
@@ -88,6 +88,13 @@ public:
     */
     virtual void log(const QtMsgType type, const QString& message, const QString &file="", const QString &function="", const int line=0);
 
+    /**
+      Log an already built message, if its type>=minLevel. The backtrace buffer is not used.
+      This method is thread safe.
+      @param logMessage Message with its timestamp and thread ID
+    */
+    virtual void log(const LogMessage& logMessage);
+
     /**
       Installs this logger as the default message handler, so it
       can be used through the global static logging functions (e.g. qDebug()).
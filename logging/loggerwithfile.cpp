@@ -10,13 +10,14 @@
 using namespace qtwebapp;
 
 LoggerWithFile::LoggerWithFile(QObject* parent)
-    :Logger(parent), fileLogger(0), useFileFlogger(false)
+    :Logger(parent), fileLogger(0), useFileFlogger(false), asyncLogger(0)
 {
      consoleLogger = new Logger(this);
 }
 
 LoggerWithFile::~LoggerWithFile()
 {
+    setAsyncMode(false);
     destroyFileLogger();
     delete consoleLogger;
 }
@@ -48,6 +49,34 @@ void LoggerWithFile::log(const QtMsgType type, const QString& message, const QSt
     }
 }
 
+void LoggerWithFile::log(const LogMessage& logMessage)
+{
+    consoleLogger->log(logMessage);
+
+    if (fileLogger && useFileFlogger) {
+        fileLogger->log(logMessage);
+    }
+}
+
+void LoggerWithFile::setAsyncMode(bool async)
+{
+    if (async && !asyncLogger)
+    {
+        asyncLogger = new AsyncLogger(this);
+        asyncLogger->startLogging();
+    }
+    else if (!async && asyncLogger)
+    {
+        delete asyncLogger; // writes pending messages and gives back the handler to this logger
+        asyncLogger = 0;
+    }
+}
+
+quint64 LoggerWithFile::getDroppedCount() const
+{
+    return asyncLogger ? asyncLogger->getDroppedCount() : 0;
+}
+
 void LoggerWithFile::logToFile(const QtMsgType type, const QString& message, const QString &file, const QString &function, const int line)
 {
     if (fileLogger && useFileFlogger) {
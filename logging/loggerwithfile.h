@@ -11,6 +11,7 @@
 #include <QtGlobal>
 #include "logger.h"
 #include "filelogger.h"
+#include "asynclogger.h"
 
 #include "export.h"
 
@@ -45,6 +46,13 @@ public:
     */
     virtual void log(const QtMsgType type, const QString& message, const QString &file="", const QString &function="", const int line=0);
 
+    /**
+      Log an already built message to console and file, if type>=minLevel of each.
+      This method is thread safe.
+      @param logMessage Message with its timestamp and thread ID
+    */
+    virtual void log(const LogMessage& logMessage);
+
     /**
       Clear the thread-local data of the current thread.
       This method is thread safe.
@@ -76,6 +84,17 @@ public:
     void getFileMinMessageLevelStr(QString& levelStr);
     void getLogFileName(QString& fileName);
 
+    /**
+      Enable or disable the asynchronous mode. In asynchronous mode the global static logging
+      functions (e.g. qDebug()) only queue the messages that are written by a dedicated thread.
+      @see AsyncLogger
+    */
+    void setAsyncMode(bool async);
+    bool getAsyncMode() const { return asyncLogger != 0; }
+
+    /** Number of messages dropped in asynchronous mode because the queue was full */
+    quint64 getDroppedCount() const;
+
     /** This will log to file only */
     void logToFile(const QtMsgType type, const QString& message, const QString &file="", const QString &function="", const int line=0);
 
@@ -88,6 +107,9 @@ private:
 
     /** Use file logger indicator */
     bool useFileFlogger;
+
+    /** Asynchronous front end when in asynchronous mode */
+    AsyncLogger* asyncLogger;
 };
 
 } // end of namespace
@@ -26,6 +26,23 @@ LogMessage::LogMessage(const QtMsgType type, const QString& message, QHash<QStri
     }
 }
 
+LogMessage::LogMessage(const QtMsgType type, const QString& message, QHash<QString, QString>* logVars, const QString &file, const QString &function, const int line,
+    const QDateTime& timestamp, Qt::HANDLE threadId)
+{
+    this->type=type;
+    this->message=message;
+    this->file=file;
+    this->function=function;
+    this->line=line;
+    this->timestamp=timestamp;
+    this->threadId=threadId;
+
+    if (logVars)
+    {
+        this->logVars=*logVars;
+    }
+}
+
 QString LogMessage::toString(const QString& msgFormat, const QString& timestampFormat) const
 {
     QString decorated=msgFormat+"\n";
@@ -67,9 +84,9 @@ QString LogMessage::toString(const QString& msgFormat, const QString& timestampF
     decorated.replace("{function}",function);
     decorated.replace("{line}",QString::number(line));
 
-    QString threadId;
-    threadId.setNum((std::size_t)QThread::currentThreadId());
-    decorated.replace("{thread}",threadId);
+    QString threadIdStr;
+    threadIdStr.setNum((std::size_t)threadId);
+    decorated.replace("{thread}",threadIdStr);
 
     // Fill in variables
     if (decorated.contains("{") && !logVars.isEmpty())
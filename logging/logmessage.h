@@ -52,6 +52,14 @@ public:
     */
     LogMessage(const QtMsgType type, const QString& message, QHash<QString,QString>* logVars, const QString &file, const QString &function, const int line);
 
+    /**
+      Constructor for messages recorded earlier possibly in another thread.
+      @param timestamp Date and time the message was generated
+      @param threadId ID of the thread where the message was generated
+    */
+    LogMessage(const QtMsgType type, const QString& message, QHash<QString,QString>* logVars, const QString &file, const QString &function, const int line,
+        const QDateTime& timestamp, Qt::HANDLE threadId);
+
     /**
       Returns the log message as decorated string.
       @param msgFormat Format of the decoration. May contain variables and static text,
@@ -66,6 +74,16 @@ public:
     */
     QtMsgType getType() const;
 
+    /**
+      Get the message text (undecorated).
+    */
+    const QString& getMessage() const { return message; }
+
+    /**
+      Get the date and time of creation.
+    */
+    const QDateTime& getTimestamp() const { return timestamp; }
+
 private:
 
     /** Logger variables */
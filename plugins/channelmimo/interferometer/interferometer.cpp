@@ -0,0 +1,698 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+
+#include <QDebug>
+#include <QThread>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QBuffer>
+
+#include "SWGChannelSettings.h"
+#include "SWGChannelReport.h"
+
+#include "dsp/dspcommands.h"
+#include "dsp/dspdevicesourceengine.h"
+#include "dsp/dspengine.h"
+#include "dsp/devicesamplesource.h"
+#include "device/deviceapi.h"
+
+#include "interferometerbaseband.h"
+#include "interferometer.h"
+
+MESSAGE_CLASS_DEFINITION(Interferometer::MsgConfigureInterferometer, Message)
+MESSAGE_CLASS_DEFINITION(Interferometer::MsgBasebandNotification, Message)
+
+const QString Interferometer::m_channelIdURI = "sdrangel.channel.interferometer";
+const QString Interferometer::m_channelId = "Interferometer";
+const float Interferometer::m_alignCoherence = 0.5f;
+
+Interferometer::Interferometer(DeviceAPI *deviceAPI) :
+    ChannelAPI(m_channelIdURI, ChannelAPI::StreamMIMO),
+    m_deviceAPI(deviceAPI),
+    m_guiMessageQueue(nullptr),
+    m_feedSize(0),
+    m_centerFrequency(0),
+    m_basebandSampleRate(48000)
+{
+    setObjectName(m_channelId);
+
+    m_thread = new QThread(this);
+    m_basebandSink = new InterferometerBaseband();
+    m_basebandSink->setMessageQueueToChannel(getInputMessageQueue());
+    m_basebandSink->moveToThread(m_thread);
+    m_vbegin.resize(getNbStreams());
+
+    // the device engine sends the stream notifications synchronously so the baseband must exist
+    m_deviceAPI->addMIMOChannel(this);
+    m_deviceAPI->addMIMOChannelAPI(this);
+
+    m_networkManager = new QNetworkAccessManager();
+    connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
+
+    applySettings(m_settings, true);
+}
+
+Interferometer::~Interferometer()
+{
+    disconnect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
+    delete m_networkManager;
+    m_deviceAPI->removeMIMOChannelAPI(this);
+    m_deviceAPI->removeMIMOChannel(this);
+    delete m_basebandSink;
+    delete m_thread;
+}
+
+unsigned int Interferometer::getNbStreams() const
+{
+    unsigned int nbStreams = m_deviceAPI->getNbSourceStreams();
+    return nbStreams < InterferometerSettings::m_maxStreams ? nbStreams : InterferometerSettings::m_maxStreams;
+}
+
+void Interferometer::startSinks()
+{
+    unsigned int nbStreams = getNbStreams();
+    qDebug("Interferometer::startSinks: %u streams", nbStreams);
+    m_vbegin.resize(nbStreams);
+    m_feedSize = 0;
+    m_basebandSink->reset(nbStreams);
+    m_thread->start();
+}
+
+void Interferometer::stopSinks()
+{
+    qDebug("Interferometer::stopSinks");
+    m_thread->exit();
+    m_thread->wait();
+}
+
+void Interferometer::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, unsigned int sinkIndex)
+{
+    if (sinkIndex >= m_vbegin.size()) {
+        return;
+    }
+
+    unsigned int size = end - begin;
+
+    // the device engine feeds all streams in turn with blocks of the same size
+    if (sinkIndex == 0) {
+        m_feedSize = size;
+    } else if (size != m_feedSize) {
+        qWarning("Interferometer::feed: stream %u: %u samples instead of %u: streams are not synchronous", sinkIndex, size, m_feedSize);
+        m_feedSize = 0;
+        return;
+    }
+
+    m_vbegin[sinkIndex] = begin;
+
+    if ((sinkIndex == m_vbegin.size() - 1) && (m_feedSize > 0)) {
+        m_basebandSink->feed(m_vbegin, m_feedSize);
+    }
+}
+
+void Interferometer::pull(SampleVector::iterator& begin, unsigned int nbSamples, unsigned int sourceIndex)
+{
+    (void) begin;
+    (void) nbSamples;
+    (void) sourceIndex;
+}
+
+bool Interferometer::handleMessage(const Message& cmd)
+{
+    if (DSPMIMOSignalNotification::match(cmd))
+    {
+        DSPMIMOSignalNotification& notif = (DSPMIMOSignalNotification&) cmd;
+
+        // all streams of a coherent device share the sample rate and frequency of the first one
+        if (!notif.getSourceOrSink() || (notif.getIndex() != 0)) {
+            return true;
+        }
+
+        qDebug() << "Interferometer::handleMessage: DSPMIMOSignalNotification:"
+                << " inputSampleRate: " << notif.getSampleRate()
+                << " centerFrequency: " << notif.getCenterFrequency();
+
+        m_basebandSampleRate = notif.getSampleRate();
+        m_centerFrequency = notif.getCenterFrequency();
+        propagateSampleRateAndFrequency(m_settings.m_localDeviceIndex);
+
+        DSPSignalNotification *msg = new DSPSignalNotification(notif.getSampleRate(), notif.getCenterFrequency());
+        m_basebandSink->getInputMessageQueue()->push(msg);
+
+        if (m_guiMessageQueue)
+        {
+            MsgBasebandNotification *msg = MsgBasebandNotification::create(
+                notif.getSampleRate(), notif.getCenterFrequency(), getNbStreams());
+            m_guiMessageQueue->push(msg);
+        }
+
+        return true;
+    }
+    else if (MsgConfigureInterferometer::match(cmd))
+    {
+        MsgConfigureInterferometer& cfg = (MsgConfigureInterferometer&) cmd;
+        qDebug() << "Interferometer::handleMessage: MsgConfigureInterferometer";
+        applySettings(cfg.getSettings(), cfg.getForce());
+
+        return true;
+    }
+    else if (InterferometerBaseband::MsgCorrelationReport::match(cmd))
+    {
+        InterferometerBaseband::MsgCorrelationReport& report = (InterferometerBaseband::MsgCorrelationReport&) cmd;
+        m_measurements = report.getMeasurements();
+
+        if (m_guiMessageQueue)
+        {
+            InterferometerBaseband::MsgCorrelationReport *msg = InterferometerBaseband::MsgCorrelationReport::create(m_measurements);
+            m_guiMessageQueue->push(msg);
+        }
+
+        if (m_settings.m_autoAlign) {
+            alignStreams();
+        }
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void Interferometer::alignStreams()
+{
+    InterferometerSettings settings = m_settings;
+    int maxDelay = 0;
+
+    for (unsigned int i = 1; i < m_measurements.size(); i++)
+    {
+        if (m_measurements[i].m_coherence >= m_alignCoherence) {
+            maxDelay = std::max(maxDelay, m_measurements[i].m_delay);
+        }
+    }
+
+    bool changed = false;
+
+    // the latest stream gets no delay and the others are delayed to match it
+    for (unsigned int i = 0; i < m_measurements.size(); i++)
+    {
+        if ((i != 0) && (m_measurements[i].m_coherence < m_alignCoherence)) {
+            continue;
+        }
+
+        int delay = i == 0 ? maxDelay : maxDelay - m_measurements[i].m_delay;
+        delay = std::min(delay, InterferometerSettings::m_maxDelay);
+        float phase = i == 0 ? 0.0f : -m_measurements[i].m_phase;
+        float phaseDiff = std::fmod(std::fabs(phase - settings.m_streams[i].m_phase), 360.0f);
+
+        if ((delay != settings.m_streams[i].m_delay) || (std::min(phaseDiff, 360.0f - phaseDiff) > 1.0f))
+        {
+            settings.m_streams[i].m_delay = delay;
+            settings.m_streams[i].m_phase = phase;
+            changed = true;
+        }
+    }
+
+    if (!changed) {
+        return;
+    }
+
+    qDebug("Interferometer::alignStreams: apply measured delays and phases");
+    applySettings(settings);
+
+    if (m_guiMessageQueue)
+    {
+        MsgConfigureInterferometer *msg = MsgConfigureInterferometer::create(settings, false);
+        m_guiMessageQueue->push(msg);
+    }
+}
+
+QByteArray Interferometer::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool Interferometer::deserialize(const QByteArray& data)
+{
+    if (m_settings.deserialize(data))
+    {
+        MsgConfigureInterferometer *msg = MsgConfigureInterferometer::create(m_settings, true);
+        m_inputMessageQueue.push(msg);
+        return true;
+    }
+    else
+    {
+        m_settings.resetToDefaults();
+        MsgConfigureInterferometer *msg = MsgConfigureInterferometer::create(m_settings, true);
+        m_inputMessageQueue.push(msg);
+        return false;
+    }
+}
+
+void Interferometer::getLocalDevices(std::vector<uint32_t>& indexes)
+{
+    indexes.clear();
+    DSPEngine *dspEngine = DSPEngine::instance();
+
+    for (uint32_t i = 0; i < dspEngine->getDeviceSourceEnginesNumber(); i++)
+    {
+        DSPDeviceSourceEngine *deviceSourceEngine = dspEngine->getDeviceSourceEngineByIndex(i);
+        DeviceSampleSource *deviceSource = deviceSourceEngine->getSource();
+
+        if (deviceSource->getDeviceDescription() == "LocalInput") {
+            indexes.push_back(i);
+        }
+    }
+}
+
+DeviceSampleSource *Interferometer::getLocalDevice(uint32_t index)
+{
+    DSPEngine *dspEngine = DSPEngine::instance();
+
+    if (index < dspEngine->getDeviceSourceEnginesNumber())
+    {
+        DSPDeviceSourceEngine *deviceSourceEngine = dspEngine->getDeviceSourceEngineByIndex(index);
+        DeviceSampleSource *deviceSource = deviceSourceEngine->getSource();
+
+        if (deviceSource->getDeviceDescription() == "LocalInput") {
+            return deviceSource;
+        } else {
+            qDebug("Interferometer::getLocalDevice: source device at index %u is not a Local Input source", index);
+        }
+    }
+    else
+    {
+        qDebug("Interferometer::getLocalDevice: non existent source device index: %u", index);
+    }
+
+    return nullptr;
+}
+
+void Interferometer::propagateSampleRateAndFrequency(uint32_t index)
+{
+    qDebug() << "Interferometer::propagateSampleRateAndFrequency:"
+        << " index: " << index
+        << " baseband_freq: " << m_basebandSampleRate
+        << " frequency: " << m_centerFrequency;
+
+    DeviceSampleSource *deviceSource = getLocalDevice(index);
+
+    if (deviceSource)
+    {
+        deviceSource->setSampleRate(m_basebandSampleRate);
+        deviceSource->setCenterFrequency(m_centerFrequency);
+    }
+    else
+    {
+        qDebug("Interferometer::propagateSampleRateAndFrequency: no suitable device at index %u", index);
+    }
+}
+
+void Interferometer::applySettings(const InterferometerSettings& settings, bool force)
+{
+    qDebug() << "Interferometer::applySettings:"
+            << "m_localDeviceIndex: " << settings.m_localDeviceIndex
+            << "m_play:" << settings.m_play
+            << "m_outputType:" << settings.m_outputType
+            << "m_productStreamIndex:" << settings.m_productStreamIndex
+            << "m_steeringAngle:" << settings.m_steeringAngle
+            << "m_elementSpacing:" << settings.m_elementSpacing
+            << "m_correlationLog2Size:" << settings.m_correlationLog2Size
+            << "m_autoAlign:" << settings.m_autoAlign
+            << "force: " << force;
+
+    QList<QString> reverseAPIKeys;
+
+    if ((settings.m_localDeviceIndex != m_settings.m_localDeviceIndex) || force)
+    {
+        reverseAPIKeys.append("localDeviceIndex");
+        propagateSampleRateAndFrequency(settings.m_localDeviceIndex);
+        DeviceSampleSource *deviceSource = getLocalDevice(settings.m_localDeviceIndex);
+        InterferometerBaseband::MsgConfigureLocalDeviceSampleSource *msg =
+            InterferometerBaseband::MsgConfigureLocalDeviceSampleSource::create(deviceSource);
+        m_basebandSink->getInputMessageQueue()->push(msg);
+    }
+
+    if ((settings.m_play != m_settings.m_play) || force) {
+        reverseAPIKeys.append("play");
+    }
+    if ((settings.m_outputType != m_settings.m_outputType) || force) {
+        reverseAPIKeys.append("outputType");
+    }
+    if ((settings.m_productStreamIndex != m_settings.m_productStreamIndex) || force) {
+        reverseAPIKeys.append("productStreamIndex");
+    }
+    if ((settings.m_steeringAngle != m_settings.m_steeringAngle) || force) {
+        reverseAPIKeys.append("steeringAngle");
+    }
+    if ((settings.m_elementSpacing != m_settings.m_elementSpacing) || force) {
+        reverseAPIKeys.append("elementSpacing");
+    }
+    if ((settings.m_correlationLog2Size != m_settings.m_correlationLog2Size) || force) {
+        reverseAPIKeys.append("correlationLog2Size");
+    }
+    if ((settings.m_autoAlign != m_settings.m_autoAlign) || force) {
+        reverseAPIKeys.append("autoAlign");
+    }
+
+    for (unsigned int i = 0; i < InterferometerSettings::m_maxStreams; i++)
+    {
+        if ((settings.m_streams[i].m_gain != m_settings.m_streams[i].m_gain)
+         || (settings.m_streams[i].m_phase != m_settings.m_streams[i].m_phase)
+         || (settings.m_streams[i].m_delay != m_settings.m_streams[i].m_delay) || force)
+        {
+            reverseAPIKeys.append("streams");
+            break;
+        }
+    }
+
+    InterferometerBaseband::MsgConfigureInterferometerBaseband *msg = InterferometerBaseband::MsgConfigureInterferometerBaseband::create(settings, force);
+    m_basebandSink->getInputMessageQueue()->push(msg);
+
+    if ((settings.m_useReverseAPI) && (reverseAPIKeys.size() != 0))
+    {
+        bool fullUpdate = ((m_settings.m_useReverseAPI != settings.m_useReverseAPI) && settings.m_useReverseAPI) ||
+                (m_settings.m_reverseAPIAddress != settings.m_reverseAPIAddress) ||
+                (m_settings.m_reverseAPIPort != settings.m_reverseAPIPort) ||
+                (m_settings.m_reverseAPIDeviceIndex != settings.m_reverseAPIDeviceIndex) ||
+                (m_settings.m_reverseAPIChannelIndex != settings.m_reverseAPIChannelIndex);
+        webapiReverseSendSettings(reverseAPIKeys, settings, fullUpdate || force);
+    }
+
+    m_settings = settings;
+}
+
+int Interferometer::webapiSettingsGet(
+        SWGSDRangel::SWGChannelSettings& response,
+        QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setInterferometerSettings(new SWGSDRangel::SWGInterferometerSettings());
+    response.getInterferometerSettings()->init();
+    webapiFormatChannelSettings(response, m_settings);
+    return 200;
+}
+
+int Interferometer::webapiSettingsPutPatch(
+        bool force,
+        const QStringList& channelSettingsKeys,
+        SWGSDRangel::SWGChannelSettings& response,
+        QString& errorMessage)
+{
+    (void) errorMessage;
+    InterferometerSettings settings = m_settings;
+    webapiUpdateChannelSettings(settings, channelSettingsKeys, response);
+
+    MsgConfigureInterferometer *msg = MsgConfigureInterferometer::create(settings, force);
+    m_inputMessageQueue.push(msg);
+
+    qDebug("Interferometer::webapiSettingsPutPatch: forward to GUI: %p", m_guiMessageQueue);
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgConfigureInterferometer *msgToGUI = MsgConfigureInterferometer::create(settings, force);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    webapiFormatChannelSettings(response, settings);
+
+    return 200;
+}
+
+int Interferometer::webapiReportGet(
+        SWGSDRangel::SWGChannelReport& response,
+        QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setInterferometerReport(new SWGSDRangel::SWGInterferometerReport());
+    response.getInterferometerReport()->init();
+    webapiFormatChannelReport(response);
+    return 200;
+}
+
+void Interferometer::webapiUpdateChannelSettings(
+        InterferometerSettings& settings,
+        const QStringList& channelSettingsKeys,
+        SWGSDRangel::SWGChannelSettings& response)
+{
+    SWGSDRangel::SWGInterferometerSettings *swgSettings = response.getInterferometerSettings();
+
+    if (channelSettingsKeys.contains("localDeviceIndex")) {
+        settings.m_localDeviceIndex = swgSettings->getLocalDeviceIndex();
+    }
+    if (channelSettingsKeys.contains("rgbColor")) {
+        settings.m_rgbColor = swgSettings->getRgbColor();
+    }
+    if (channelSettingsKeys.contains("title")) {
+        settings.m_title = *swgSettings->getTitle();
+    }
+    if (channelSettingsKeys.contains("play")) {
+        settings.m_play = swgSettings->getPlay() != 0;
+    }
+    if (channelSettingsKeys.contains("outputType"))
+    {
+        int outputType = swgSettings->getOutputType();
+        settings.m_outputType = outputType < 0 ? InterferometerSettings::OutputSum :
+            outputType >= (int) InterferometerSettings::OutputLast ? InterferometerSettings::OutputProduct :
+            (InterferometerSettings::OutputType) outputType;
+    }
+    if (channelSettingsKeys.contains("productStreamIndex"))
+    {
+        int index = swgSettings->getProductStreamIndex();
+        settings.m_productStreamIndex = index < 1 ? 1 : index >= (int) InterferometerSettings::m_maxStreams ?
+            InterferometerSettings::m_maxStreams - 1 : index;
+    }
+    if (channelSettingsKeys.contains("steeringAngle")) {
+        settings.m_steeringAngle = swgSettings->getSteeringAngle();
+    }
+    if (channelSettingsKeys.contains("elementSpacing")) {
+        settings.m_elementSpacing = swgSettings->getElementSpacing();
+    }
+    if (channelSettingsKeys.contains("correlationLog2Size"))
+    {
+        unsigned int log2Size = swgSettings->getCorrelationLog2Size();
+        settings.m_correlationLog2Size = log2Size < InterferometerSettings::m_minCorrelationLog2Size ? InterferometerSettings::m_minCorrelationLog2Size :
+            log2Size > InterferometerSettings::m_maxCorrelationLog2Size ? InterferometerSettings::m_maxCorrelationLog2Size : log2Size;
+    }
+    if (channelSettingsKeys.contains("autoAlign")) {
+        settings.m_autoAlign = swgSettings->getAutoAlign() != 0;
+    }
+    if (channelSettingsKeys.contains("streams") && swgSettings->getStreams())
+    {
+        // streams are identified by their index so that only some of them can be given
+        for (auto swgStream : *swgSettings->getStreams())
+        {
+            unsigned int index = swgStream->getStreamIndex();
+
+            if (index >= InterferometerSettings::m_maxStreams) {
+                continue;
+            }
+
+            settings.m_streams[index].m_gain = swgStream->getGain();
+            settings.m_streams[index].m_phase = swgStream->getPhase();
+            int delay = swgStream->getDelay();
+            settings.m_streams[index].m_delay = delay < 0 ? 0 : delay > InterferometerSettings::m_maxDelay ? InterferometerSettings::m_maxDelay : delay;
+        }
+    }
+    if (channelSettingsKeys.contains("useReverseAPI")) {
+        settings.m_useReverseAPI = swgSettings->getUseReverseApi() != 0;
+    }
+    if (channelSettingsKeys.contains("reverseAPIAddress")) {
+        settings.m_reverseAPIAddress = *swgSettings->getReverseApiAddress();
+    }
+    if (channelSettingsKeys.contains("reverseAPIPort")) {
+        settings.m_reverseAPIPort = swgSettings->getReverseApiPort();
+    }
+    if (channelSettingsKeys.contains("reverseAPIDeviceIndex")) {
+        settings.m_reverseAPIDeviceIndex = swgSettings->getReverseApiDeviceIndex();
+    }
+    if (channelSettingsKeys.contains("reverseAPIChannelIndex")) {
+        settings.m_reverseAPIChannelIndex = swgSettings->getReverseApiChannelIndex();
+    }
+}
+
+void Interferometer::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& response, const InterferometerSettings& settings)
+{
+    SWGSDRangel::SWGInterferometerSettings *swgSettings = response.getInterferometerSettings();
+    swgSettings->setLocalDeviceIndex(settings.m_localDeviceIndex);
+    swgSettings->setRgbColor(settings.m_rgbColor);
+
+    if (swgSettings->getTitle()) {
+        *swgSettings->getTitle() = settings.m_title;
+    } else {
+        swgSettings->setTitle(new QString(settings.m_title));
+    }
+
+    swgSettings->setPlay(settings.m_play ? 1 : 0);
+    swgSettings->setOutputType((int) settings.m_outputType);
+    swgSettings->setProductStreamIndex(settings.m_productStreamIndex);
+    swgSettings->setSteeringAngle(settings.m_steeringAngle);
+    swgSettings->setElementSpacing(settings.m_elementSpacing);
+    swgSettings->setCorrelationLog2Size(settings.m_correlationLog2Size);
+    swgSettings->setAutoAlign(settings.m_autoAlign ? 1 : 0);
+
+    if (swgSettings->getStreams()) {
+        qDeleteAll(*swgSettings->getStreams());
+        swgSettings->getStreams()->clear();
+    } else {
+        swgSettings->setStreams(new QList<SWGSDRangel::SWGInterferometerStreamSettings*>());
+    }
+
+    for (unsigned int i = 0; i < InterferometerSettings::m_maxStreams; i++)
+    {
+        SWGSDRangel::SWGInterferometerStreamSettings *swgStream = new SWGSDRangel::SWGInterferometerStreamSettings();
+        swgStream->setStreamIndex(i);
+        swgStream->setGain(settings.m_streams[i].m_gain);
+        swgStream->setPhase(settings.m_streams[i].m_phase);
+        swgStream->setDelay(settings.m_streams[i].m_delay);
+        swgSettings->getStreams()->append(swgStream);
+    }
+
+    swgSettings->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
+
+    if (swgSettings->getReverseApiAddress()) {
+        *swgSettings->getReverseApiAddress() = settings.m_reverseAPIAddress;
+    } else {
+        swgSettings->setReverseApiAddress(new QString(settings.m_reverseAPIAddress));
+    }
+
+    swgSettings->setReverseApiPort(settings.m_reverseAPIPort);
+    swgSettings->setReverseApiDeviceIndex(settings.m_reverseAPIDeviceIndex);
+    swgSettings->setReverseApiChannelIndex(settings.m_reverseAPIChannelIndex);
+}
+
+void Interferometer::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response)
+{
+    SWGSDRangel::SWGInterferometerReport *swgReport = response.getInterferometerReport();
+    swgReport->setChannelSampleRate(m_basebandSampleRate);
+
+    if (swgReport->getStreams()) {
+        qDeleteAll(*swgReport->getStreams());
+        swgReport->getStreams()->clear();
+    } else {
+        swgReport->setStreams(new QList<SWGSDRangel::SWGInterferometerStreamReport*>());
+    }
+
+    for (unsigned int i = 0; i < m_measurements.size(); i++)
+    {
+        SWGSDRangel::SWGInterferometerStreamReport *swgStream = new SWGSDRangel::SWGInterferometerStreamReport();
+        swgStream->setStreamIndex(i);
+        swgStream->setDelay(m_measurements[i].m_delay);
+        swgStream->setPhase(m_measurements[i].m_phase);
+        swgStream->setCoherence(m_measurements[i].m_coherence);
+        swgReport->getStreams()->append(swgStream);
+    }
+}
+
+void Interferometer::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const InterferometerSettings& settings, bool force)
+{
+    SWGSDRangel::SWGChannelSettings *swgChannelSettings = new SWGSDRangel::SWGChannelSettings();
+    swgChannelSettings->setDirection(2); // MIMO
+    swgChannelSettings->setOriginatorChannelIndex(getIndexInDeviceSet());
+    swgChannelSettings->setOriginatorDeviceSetIndex(getDeviceSetIndex());
+    swgChannelSettings->setChannelType(new QString("Interferometer"));
+    swgChannelSettings->setInterferometerSettings(new SWGSDRangel::SWGInterferometerSettings());
+    SWGSDRangel::SWGInterferometerSettings *swgSettings = swgChannelSettings->getInterferometerSettings();
+
+    // transfer data that has been modified. When force is on transfer all data except reverse API data
+
+    if (channelSettingsKeys.contains("localDeviceIndex") || force) {
+        swgSettings->setLocalDeviceIndex(settings.m_localDeviceIndex);
+    }
+    if (channelSettingsKeys.contains("rgbColor") || force) {
+        swgSettings->setRgbColor(settings.m_rgbColor);
+    }
+    if (channelSettingsKeys.contains("title") || force) {
+        swgSettings->setTitle(new QString(settings.m_title));
+    }
+    if (channelSettingsKeys.contains("play") || force) {
+        swgSettings->setPlay(settings.m_play ? 1 : 0);
+    }
+    if (channelSettingsKeys.contains("outputType") || force) {
+        swgSettings->setOutputType((int) settings.m_outputType);
+    }
+    if (channelSettingsKeys.contains("productStreamIndex") || force) {
+        swgSettings->setProductStreamIndex(settings.m_productStreamIndex);
+    }
+    if (channelSettingsKeys.contains("steeringAngle") || force) {
+        swgSettings->setSteeringAngle(settings.m_steeringAngle);
+    }
+    if (channelSettingsKeys.contains("elementSpacing") || force) {
+        swgSettings->setElementSpacing(settings.m_elementSpacing);
+    }
+    if (channelSettingsKeys.contains("correlationLog2Size") || force) {
+        swgSettings->setCorrelationLog2Size(settings.m_correlationLog2Size);
+    }
+    if (channelSettingsKeys.contains("autoAlign") || force) {
+        swgSettings->setAutoAlign(settings.m_autoAlign ? 1 : 0);
+    }
+    if (channelSettingsKeys.contains("streams") || force)
+    {
+        swgSettings->setStreams(new QList<SWGSDRangel::SWGInterferometerStreamSettings*>());
+
+        for (unsigned int i = 0; i < InterferometerSettings::m_maxStreams; i++)
+        {
+            SWGSDRangel::SWGInterferometerStreamSettings *swgStream = new SWGSDRangel::SWGInterferometerStreamSettings();
+            swgStream->setStreamIndex(i);
+            swgStream->setGain(settings.m_streams[i].m_gain);
+            swgStream->setPhase(settings.m_streams[i].m_phase);
+            swgStream->setDelay(settings.m_streams[i].m_delay);
+            swgSettings->getStreams()->append(swgStream);
+        }
+    }
+
+    QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/channel/%4/settings")
+            .arg(settings.m_reverseAPIAddress)
+            .arg(settings.m_reverseAPIPort)
+            .arg(settings.m_reverseAPIDeviceIndex)
+            .arg(settings.m_reverseAPIChannelIndex);
+    m_networkRequest.setUrl(QUrl(channelSettingsURL));
+    m_networkRequest.setHeader(QNetworkRequest::ContentTypeHeader, "application/json");
+
+    QBuffer *buffer = new QBuffer();
+    buffer->open((QBuffer::ReadWrite));
+    buffer->write(swgChannelSettings->asJson().toUtf8());
+    buffer->seek(0);
+
+    // Always use PATCH to avoid passing reverse API settings
+    QNetworkReply *reply = m_networkManager->sendCustomRequest(m_networkRequest, "PATCH", buffer);
+    buffer->setParent(reply);
+
+    delete swgChannelSettings;
+}
+
+void Interferometer::networkManagerFinished(QNetworkReply *reply)
+{
+    QNetworkReply::NetworkError replyError = reply->error();
+
+    if (replyError)
+    {
+        qWarning() << "Interferometer::networkManagerFinished:"
+                << " error(" << (int) replyError
+                << "): " << replyError
+                << ": " << reply->errorString();
+    }
+    else
+    {
+        QString answer = reply->readAll();
+        answer.chop(1); // remove last \n
+        qDebug("Interferometer::networkManagerFinished: reply:\n%s", answer.toStdString().c_str());
+    }
+
+    reply->deleteLater();
+}
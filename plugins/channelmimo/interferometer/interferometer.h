@@ -0,0 +1,183 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_INTERFEROMETER_H_
+#define INCLUDE_INTERFEROMETER_H_
+
+#include <vector>
+
+#include <QObject>
+#include <QNetworkRequest>
+
+#include "dsp/mimochannel.h"
+#include "channel/channelapi.h"
+#include "util/message.h"
+
+#include "interferometercorr.h"
+#include "interferometersettings.h"
+
+class QNetworkAccessManager;
+class QNetworkReply;
+class QThread;
+
+class DeviceAPI;
+class DeviceSampleSource;
+class InterferometerBaseband;
+
+class Interferometer : public MIMOChannel, public ChannelAPI {
+    Q_OBJECT
+public:
+    class MsgConfigureInterferometer : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        const InterferometerSettings& getSettings() const { return m_settings; }
+        bool getForce() const { return m_force; }
+
+        static MsgConfigureInterferometer* create(const InterferometerSettings& settings, bool force)
+        {
+            return new MsgConfigureInterferometer(settings, force);
+        }
+
+    private:
+        InterferometerSettings m_settings;
+        bool m_force;
+
+        MsgConfigureInterferometer(const InterferometerSettings& settings, bool force) :
+            Message(),
+            m_settings(settings),
+            m_force(force)
+        { }
+    };
+
+    class MsgBasebandNotification : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        static MsgBasebandNotification* create(int sampleRate, qint64 centerFrequency, unsigned int nbStreams) {
+            return new MsgBasebandNotification(sampleRate, centerFrequency, nbStreams);
+        }
+
+        int getSampleRate() const { return m_sampleRate; }
+        qint64 getCenterFrequency() const { return m_centerFrequency; }
+        unsigned int getNbStreams() const { return m_nbStreams; }
+
+    private:
+
+        MsgBasebandNotification(int sampleRate, qint64 centerFrequency, unsigned int nbStreams) :
+            Message(),
+            m_sampleRate(sampleRate),
+            m_centerFrequency(centerFrequency),
+            m_nbStreams(nbStreams)
+        { }
+
+        int m_sampleRate;
+        qint64 m_centerFrequency;
+        unsigned int m_nbStreams;
+    };
+
+    Interferometer(DeviceAPI *deviceAPI);
+    virtual ~Interferometer();
+    virtual void destroy() { delete this; }
+
+    virtual void startSinks();
+    virtual void stopSinks();
+    virtual void startSources() {}
+    virtual void stopSources() {}
+    virtual void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, unsigned int sinkIndex);
+    virtual void pull(SampleVector::iterator& begin, unsigned int nbSamples, unsigned int sourceIndex);
+    virtual bool handleMessage(const Message& cmd);
+
+    virtual void getIdentifier(QString& id) { id = objectName(); }
+    virtual void getTitle(QString& title) { title = "Interferometer"; }
+    virtual qint64 getCenterFrequency() const { return 0; }
+
+    virtual QByteArray serialize() const;
+    virtual bool deserialize(const QByteArray& data);
+
+    virtual int getNbSinkStreams() const { return getNbStreams(); }
+    virtual int getNbSourceStreams() const { return 0; }
+
+    virtual qint64 getStreamCenterFrequency(int streamIndex, bool sinkElseSource) const
+    {
+        (void) streamIndex;
+        (void) sinkElseSource;
+        return 0;
+    }
+
+    virtual int webapiSettingsGet(
+            SWGSDRangel::SWGChannelSettings& response,
+            QString& errorMessage);
+
+    virtual int webapiSettingsPutPatch(
+            bool force,
+            const QStringList& channelSettingsKeys,
+            SWGSDRangel::SWGChannelSettings& response,
+            QString& errorMessage);
+
+    virtual int webapiReportGet(
+            SWGSDRangel::SWGChannelReport& response,
+            QString& errorMessage);
+
+    static void webapiFormatChannelSettings(
+        SWGSDRangel::SWGChannelSettings& response,
+        const InterferometerSettings& settings);
+
+    static void webapiUpdateChannelSettings(
+            InterferometerSettings& settings,
+            const QStringList& channelSettingsKeys,
+            SWGSDRangel::SWGChannelSettings& response);
+
+    void setMessageQueueToGUI(MessageQueue *queue) { m_guiMessageQueue = queue; }
+    MessageQueue *getMessageQueueToGUI() { return m_guiMessageQueue; }
+    void getLocalDevices(std::vector<uint32_t>& indexes);
+    unsigned int getNbStreams() const; //!< device streams combined by the channel
+
+    static const QString m_channelIdURI;
+    static const QString m_channelId;
+
+private:
+    DeviceAPI *m_deviceAPI;
+    QThread *m_thread;
+    InterferometerBaseband *m_basebandSink;
+    InterferometerSettings m_settings;
+    MessageQueue *m_guiMessageQueue; //!< Input message queue to the GUI
+    std::vector<SampleVector::const_iterator> m_vbegin;
+    unsigned int m_feedSize;
+    std::vector<InterferometerCorrelator::StreamMeasurement> m_measurements;
+
+    uint64_t m_centerFrequency;
+    uint32_t m_basebandSampleRate;
+
+    QNetworkAccessManager *m_networkManager;
+    QNetworkRequest m_networkRequest;
+
+    static const float m_alignCoherence; //!< minimum coherence of a stream to apply its measurements
+
+    void applySettings(const InterferometerSettings& settings, bool force = false);
+    void alignStreams();
+    void propagateSampleRateAndFrequency(uint32_t index);
+    DeviceSampleSource *getLocalDevice(uint32_t index);
+    void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
+
+    void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const InterferometerSettings& settings, bool force);
+
+private slots:
+    void networkManagerFinished(QNetworkReply *reply);
+};
+
+#endif /* INCLUDE_INTERFEROMETER_H_ */
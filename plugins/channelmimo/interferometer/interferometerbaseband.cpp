@@ -0,0 +1,179 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "dsp/dspcommands.h"
+#include "dsp/devicesamplesource.h"
+#include "dsp/samplesinkfifo.h"
+
+#include "interferometerbaseband.h"
+
+MESSAGE_CLASS_DEFINITION(InterferometerBaseband::MsgConfigureInterferometerBaseband, Message)
+MESSAGE_CLASS_DEFINITION(InterferometerBaseband::MsgConfigureLocalDeviceSampleSource, Message)
+MESSAGE_CLASS_DEFINITION(InterferometerBaseband::MsgCorrelationReport, Message)
+
+InterferometerBaseband::InterferometerBaseband() :
+    m_messageQueueToChannel(nullptr),
+    m_localSampleSource(nullptr),
+    m_mutex(QMutex::Recursive)
+{
+    m_sampleMIFifo.init(2, SampleSinkFifo::getSizePolicy(48000));
+    m_vbegin.resize(2);
+    m_correlator.setNbStreams(2);
+
+    qDebug("InterferometerBaseband::InterferometerBaseband");
+    QObject::connect(
+        &m_sampleMIFifo,
+        &SampleMIFifo::dataSyncReady,
+        this,
+        &InterferometerBaseband::handleData,
+        Qt::QueuedConnection
+    );
+
+    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()));
+}
+
+InterferometerBaseband::~InterferometerBaseband()
+{
+}
+
+void InterferometerBaseband::reset(unsigned int nbStreams)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    unsigned int fifoSize = m_sampleMIFifo.getData().size() > 0 ? m_sampleMIFifo.getData()[0].size() : SampleSinkFifo::getSizePolicy(48000);
+    m_sampleMIFifo.init(nbStreams, fifoSize);
+    m_vbegin.resize(nbStreams);
+    m_correlator.setNbStreams(nbStreams);
+    m_correlator.setSettings(m_settings);
+}
+
+void InterferometerBaseband::feed(const std::vector<SampleVector::const_iterator>& vbegin, unsigned int nbSamples)
+{
+    m_sampleMIFifo.writeSync(vbegin, nbSamples);
+}
+
+void InterferometerBaseband::handleData()
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    const std::vector<SampleVector>& data = m_sampleMIFifo.getData();
+    unsigned int ipart1begin;
+    unsigned int ipart1end;
+    unsigned int ipart2begin;
+    unsigned int ipart2end;
+
+    while ((m_sampleMIFifo.fillSync() > 0) && (m_inputMessageQueue.size() == 0))
+    {
+        m_sampleMIFifo.readSync(ipart1begin, ipart1end, ipart2begin, ipart2end);
+
+        // first part of FIFO data
+        if (ipart1begin != ipart1end) {
+            processFifo(data, ipart1begin, ipart1end);
+        }
+
+        // second part of FIFO data (used when block wraps around)
+        if (ipart2begin != ipart2end) {
+            processFifo(data, ipart2begin, ipart2end);
+        }
+    }
+}
+
+void InterferometerBaseband::processFifo(const std::vector<SampleVector>& data, unsigned int ibegin, unsigned int iend)
+{
+    for (unsigned int stream = 0; stream < m_vbegin.size(); stream++) {
+        m_vbegin[stream] = data[stream].begin() + ibegin;
+    }
+
+    unsigned int nbSamples = iend - ibegin;
+    m_correlator.feed(m_vbegin, nbSamples);
+
+    if (m_settings.m_play && m_localSampleSource)
+    {
+        const SampleVector& output = m_correlator.getOutput();
+        m_localSampleSource->getSampleFifo()->write(output.begin(), output.begin() + nbSamples);
+    }
+
+    if (m_correlator.getMeasurements(m_measurements) && m_messageQueueToChannel)
+    {
+        MsgCorrelationReport *msg = MsgCorrelationReport::create(m_measurements);
+        m_messageQueueToChannel->push(msg);
+    }
+}
+
+void InterferometerBaseband::handleInputMessages()
+{
+    Message* message;
+
+    while ((message = m_inputMessageQueue.pop()) != nullptr)
+    {
+        if (handleMessage(*message)) {
+            delete message;
+        }
+    }
+}
+
+bool InterferometerBaseband::handleMessage(const Message& cmd)
+{
+    if (MsgConfigureInterferometerBaseband::match(cmd))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        MsgConfigureInterferometerBaseband& cfg = (MsgConfigureInterferometerBaseband&) cmd;
+        qDebug() << "InterferometerBaseband::handleMessage: MsgConfigureInterferometerBaseband";
+
+        applySettings(cfg.getSettings(), cfg.getForce());
+
+        return true;
+    }
+    else if (DSPSignalNotification::match(cmd))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        DSPSignalNotification& notif = (DSPSignalNotification&) cmd;
+        qDebug() << "InterferometerBaseband::handleMessage: DSPSignalNotification: basebandSampleRate: " << notif.getSampleRate();
+        m_sampleMIFifo.init(m_vbegin.size(), SampleSinkFifo::getSizePolicy(notif.getSampleRate()));
+
+        return true;
+    }
+    else if (MsgConfigureLocalDeviceSampleSource::match(cmd))
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        MsgConfigureLocalDeviceSampleSource& notif = (MsgConfigureLocalDeviceSampleSource&) cmd;
+        qDebug() << "InterferometerBaseband::handleMessage: MsgConfigureLocalDeviceSampleSource: " << notif.getDeviceSampleSource();
+        m_localSampleSource = notif.getDeviceSampleSource();
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void InterferometerBaseband::applySettings(const InterferometerSettings& settings, bool force)
+{
+    qDebug() << "InterferometerBaseband::applySettings:"
+        << "m_outputType:" << settings.m_outputType
+        << "m_productStreamIndex:" << settings.m_productStreamIndex
+        << "m_steeringAngle:" << settings.m_steeringAngle
+        << "m_elementSpacing:" << settings.m_elementSpacing
+        << "m_correlationLog2Size:" << settings.m_correlationLog2Size
+        << "m_play:" << settings.m_play
+        << " force: " << force;
+
+    m_correlator.setSettings(settings);
+    m_settings = settings;
+}
@@ -0,0 +1,128 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_INTERFEROMETERBASEBAND_H
+#define INCLUDE_INTERFEROMETERBASEBAND_H
+
+#include <vector>
+
+#include <QObject>
+#include <QMutex>
+
+#include "dsp/samplemififo.h"
+#include "util/message.h"
+#include "util/messagequeue.h"
+
+#include "interferometercorr.h"
+#include "interferometersettings.h"
+
+class DeviceSampleSource;
+
+class InterferometerBaseband : public QObject
+{
+    Q_OBJECT
+public:
+    class MsgConfigureInterferometerBaseband : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        const InterferometerSettings& getSettings() const { return m_settings; }
+        bool getForce() const { return m_force; }
+
+        static MsgConfigureInterferometerBaseband* create(const InterferometerSettings& settings, bool force)
+        {
+            return new MsgConfigureInterferometerBaseband(settings, force);
+        }
+
+    private:
+        InterferometerSettings m_settings;
+        bool m_force;
+
+        MsgConfigureInterferometerBaseband(const InterferometerSettings& settings, bool force) :
+            Message(),
+            m_settings(settings),
+            m_force(force)
+        { }
+    };
+
+    class MsgConfigureLocalDeviceSampleSource : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        static MsgConfigureLocalDeviceSampleSource* create(DeviceSampleSource *deviceSampleSource) {
+            return new MsgConfigureLocalDeviceSampleSource(deviceSampleSource);
+        }
+
+        DeviceSampleSource *getDeviceSampleSource() const { return m_deviceSampleSource; }
+
+    private:
+
+        MsgConfigureLocalDeviceSampleSource(DeviceSampleSource *deviceSampleSource) :
+            Message(),
+            m_deviceSampleSource(deviceSampleSource)
+        { }
+
+        DeviceSampleSource *m_deviceSampleSource;
+    };
+
+    class MsgCorrelationReport : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        const std::vector<InterferometerCorrelator::StreamMeasurement>& getMeasurements() const { return m_measurements; }
+
+        static MsgCorrelationReport* create(const std::vector<InterferometerCorrelator::StreamMeasurement>& measurements) {
+            return new MsgCorrelationReport(measurements);
+        }
+
+    private:
+        std::vector<InterferometerCorrelator::StreamMeasurement> m_measurements;
+
+        MsgCorrelationReport(const std::vector<InterferometerCorrelator::StreamMeasurement>& measurements) :
+            Message(),
+            m_measurements(measurements)
+        { }
+    };
+
+    InterferometerBaseband();
+    ~InterferometerBaseband();
+    void reset(unsigned int nbStreams);
+    void feed(const std::vector<SampleVector::const_iterator>& vbegin, unsigned int nbSamples);
+    MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; } //!< Get the queue for asynchronous inbound communication
+    void setMessageQueueToChannel(MessageQueue *messageQueue) { m_messageQueueToChannel = messageQueue; }
+
+private:
+    SampleMIFifo m_sampleMIFifo;
+    std::vector<SampleVector::const_iterator> m_vbegin;
+    InterferometerCorrelator m_correlator;
+    std::vector<InterferometerCorrelator::StreamMeasurement> m_measurements;
+    MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
+    MessageQueue *m_messageQueueToChannel;
+    InterferometerSettings m_settings;
+    DeviceSampleSource *m_localSampleSource;
+    QMutex m_mutex;
+
+    void processFifo(const std::vector<SampleVector>& data, unsigned int ibegin, unsigned int iend);
+    bool handleMessage(const Message& cmd);
+    void applySettings(const InterferometerSettings& settings, bool force = false);
+
+private slots:
+    void handleInputMessages();
+    void handleData(); //!< Handle data when samples have to be processed
+};
+
+#endif // INCLUDE_INTERFEROMETERBASEBAND_H
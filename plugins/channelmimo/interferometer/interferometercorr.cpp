@@ -0,0 +1,370 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <algorithm>
+
+#include <QDebug>
+
+#include "dsp/dspengine.h"
+#include "dsp/fftfactory.h"
+#include "dsp/fftengine.h"
+
+#include "interferometercorr.h"
+
+InterferometerCorrelator::InterferometerCorrelator() :
+    m_nbStreams(0),
+    m_outputType(InterferometerSettings::OutputSum),
+    m_productStreamIndex(1),
+    m_fftSize(0),
+    m_fft(nullptr),
+    m_invFFT(nullptr),
+    m_fftSequence(0),
+    m_invFFTSequence(0),
+    m_captureCount(0),
+    m_skipCount(0),
+    m_nbAveraged(0),
+    m_measurementsReady(false)
+{
+    setNbStreams(2);
+    allocateFFT(InterferometerSettings().m_correlationLog2Size);
+}
+
+InterferometerCorrelator::~InterferometerCorrelator()
+{
+    releaseFFT();
+}
+
+void InterferometerCorrelator::setNbStreams(unsigned int nbStreams)
+{
+    m_nbStreams = nbStreams < 1 ? 1 : nbStreams > InterferometerSettings::m_maxStreams ? InterferometerSettings::m_maxStreams : nbStreams;
+    m_weightRe.assign(m_nbStreams, 1.0f / m_nbStreams);
+    m_weightIm.assign(m_nbStreams, 0.0f);
+    m_delays.assign(m_nbStreams, 0);
+    m_re.assign(m_nbStreams, std::vector<float>(InterferometerSettings::m_maxDelay, 0.0f));
+    m_im.assign(m_nbStreams, std::vector<float>(InterferometerSettings::m_maxDelay, 0.0f));
+    m_measurements.assign(m_nbStreams, StreamMeasurement());
+    resetCorrelation();
+}
+
+void InterferometerCorrelator::setSettings(const InterferometerSettings& settings)
+{
+    m_outputType = settings.m_outputType;
+    m_productStreamIndex = settings.m_productStreamIndex < m_nbStreams ? settings.m_productStreamIndex : m_nbStreams - 1;
+
+    // plane wave phase progression of a beam steered off the array broadside
+    double steeringPhase = 2.0 * M_PI * settings.m_elementSpacing * sin(settings.m_steeringAngle * M_PI / 180.0);
+    double norm = m_outputType == InterferometerSettings::OutputSum ? 1.0 / m_nbStreams : 1.0;
+
+    for (unsigned int i = 0; i < m_nbStreams; i++)
+    {
+        const InterferometerStreamSettings& streamSettings = settings.m_streams[i];
+        double gain = norm * pow(10.0, streamSettings.m_gain / 20.0);
+        double phase = streamSettings.m_phase * M_PI / 180.0 + steeringPhase * i;
+        m_weightRe[i] = gain * cos(phase);
+        m_weightIm[i] = gain * sin(phase);
+        int delay = streamSettings.m_delay;
+        m_delays[i] = delay < 0 ? 0 : delay > InterferometerSettings::m_maxDelay ? InterferometerSettings::m_maxDelay : delay;
+    }
+
+    if ((1U << settings.m_correlationLog2Size) != m_fftSize)
+    {
+        releaseFFT();
+        allocateFFT(settings.m_correlationLog2Size);
+    }
+}
+
+void InterferometerCorrelator::allocateFFT(unsigned int log2Size)
+{
+    m_fftSize = 1U << log2Size;
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+    m_fftSequence = fftFactory->getEngine(m_fftSize, false, &m_fft);
+    m_invFFTSequence = fftFactory->getEngine(m_fftSize, true, &m_invFFT);
+    resetCorrelation();
+}
+
+void InterferometerCorrelator::releaseFFT()
+{
+    if (m_fftSize == 0) {
+        return;
+    }
+
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+    fftFactory->releaseEngine(m_fftSize, false, m_fftSequence);
+    fftFactory->releaseEngine(m_fftSize, true, m_invFFTSequence);
+    m_fftSize = 0;
+}
+
+void InterferometerCorrelator::resetCorrelation()
+{
+    m_capture.assign(m_nbStreams, std::vector<Complex>(m_fftSize / 2));
+    m_crossSpectrum.assign(m_nbStreams, std::vector<Complex>(m_fftSize, Complex{0.0f, 0.0f}));
+    m_refSpectrum.assign(m_fftSize, Complex{0.0f, 0.0f});
+    m_energy.assign(m_nbStreams, 0.0);
+    m_captureCount = 0;
+    m_skipCount = 0;
+    m_nbAveraged = 0;
+}
+
+void InterferometerCorrelator::resize(unsigned int nbSamples)
+{
+    unsigned int size = InterferometerSettings::m_maxDelay + nbSamples;
+
+    if (m_re[0].size() < size)
+    {
+        for (unsigned int i = 0; i < m_nbStreams; i++)
+        {
+            m_re[i].resize(size);
+            m_im[i].resize(size);
+        }
+    }
+
+    if (m_accRe.size() < nbSamples)
+    {
+        m_accRe.resize(nbSamples);
+        m_accIm.resize(nbSamples);
+    }
+
+    if (m_output.size() < nbSamples) {
+        m_output.resize(nbSamples);
+    }
+}
+
+void InterferometerCorrelator::feed(const std::vector<SampleVector::const_iterator>& vbegin, unsigned int nbSamples)
+{
+    if ((vbegin.size() < m_nbStreams) || (nbSamples == 0)) {
+        return;
+    }
+
+    resize(nbSamples);
+    const unsigned int history = InterferometerSettings::m_maxDelay;
+
+    for (unsigned int i = 0; i < m_nbStreams; i++)
+    {
+        const Sample *in = &(*vbegin[i]);
+        float *re = &m_re[i][history];
+        float *im = &m_im[i][history];
+
+        for (unsigned int k = 0; k < nbSamples; k++)
+        {
+            re[k] = in[k].m_real;
+            im[k] = in[k].m_imag;
+        }
+    }
+
+    capture(nbSamples);
+
+    if (m_outputType == InterferometerSettings::OutputProduct) {
+        combineProduct(nbSamples);
+    } else {
+        combineSum(nbSamples);
+    }
+
+    // saturate to the sample range
+    const float *accRe = m_accRe.data();
+    const float *accIm = m_accIm.data();
+    Sample *out = m_output.data();
+    const float maxValue = SDR_RX_SCALEF - 1.0f;
+
+    for (unsigned int k = 0; k < nbSamples; k++)
+    {
+        out[k].m_real = (FixReal) std::min(maxValue, std::max(-SDR_RX_SCALEF, accRe[k]));
+        out[k].m_imag = (FixReal) std::min(maxValue, std::max(-SDR_RX_SCALEF, accIm[k]));
+    }
+
+    // keep the last samples as the delay line history of the next block
+    for (unsigned int i = 0; i < m_nbStreams; i++)
+    {
+        std::copy(m_re[i].begin() + nbSamples, m_re[i].begin() + nbSamples + history, m_re[i].begin());
+        std::copy(m_im[i].begin() + nbSamples, m_im[i].begin() + nbSamples + history, m_im[i].begin());
+    }
+}
+
+void InterferometerCorrelator::combineSum(unsigned int nbSamples)
+{
+    float *accRe = m_accRe.data();
+    float *accIm = m_accIm.data();
+    std::fill(accRe, accRe + nbSamples, 0.0f);
+    std::fill(accIm, accIm + nbSamples, 0.0f);
+
+    for (unsigned int i = 0; i < m_nbStreams; i++)
+    {
+        const float *re = &m_re[i][InterferometerSettings::m_maxDelay - m_delays[i]];
+        const float *im = &m_im[i][InterferometerSettings::m_maxDelay - m_delays[i]];
+        const float wRe = m_weightRe[i];
+        const float wIm = m_weightIm[i];
+
+        for (unsigned int k = 0; k < nbSamples; k++)
+        {
+            accRe[k] += wRe * re[k] - wIm * im[k];
+            accIm[k] += wRe * im[k] + wIm * re[k];
+        }
+    }
+}
+
+void InterferometerCorrelator::combineProduct(unsigned int nbSamples)
+{
+    const unsigned int b = m_productStreamIndex;
+    const float *aRe = &m_re[0][InterferometerSettings::m_maxDelay - m_delays[0]];
+    const float *aIm = &m_im[0][InterferometerSettings::m_maxDelay - m_delays[0]];
+    const float *bRe = &m_re[b][InterferometerSettings::m_maxDelay - m_delays[b]];
+    const float *bIm = &m_im[b][InterferometerSettings::m_maxDelay - m_delays[b]];
+    // w0 * conj(wb) and the scale back to the sample range
+    const float wRe = (m_weightRe[0] * m_weightRe[b] + m_weightIm[0] * m_weightIm[b]) / SDR_RX_SCALEF;
+    const float wIm = (m_weightIm[0] * m_weightRe[b] - m_weightRe[0] * m_weightIm[b]) / SDR_RX_SCALEF;
+    float *accRe = m_accRe.data();
+    float *accIm = m_accIm.data();
+
+    for (unsigned int k = 0; k < nbSamples; k++)
+    {
+        float pRe = aRe[k] * bRe[k] + aIm[k] * bIm[k];
+        float pIm = aIm[k] * bRe[k] - aRe[k] * bIm[k];
+        accRe[k] = wRe * pRe - wIm * pIm;
+        accIm[k] = wRe * pIm + wIm * pRe;
+    }
+}
+
+void InterferometerCorrelator::capture(unsigned int nbSamples)
+{
+    const unsigned int captureSize = m_fftSize / 2;
+    unsigned int k = 0;
+
+    while (k < nbSamples)
+    {
+        if (m_skipCount > 0)
+        {
+            unsigned int n = std::min(m_skipCount, nbSamples - k);
+            m_skipCount -= n;
+            k += n;
+            continue;
+        }
+
+        unsigned int n = std::min(captureSize - m_captureCount, nbSamples - k);
+
+        for (unsigned int i = 0; i < m_nbStreams; i++)
+        {
+            const float *re = &m_re[i][InterferometerSettings::m_maxDelay + k];
+            const float *im = &m_im[i][InterferometerSettings::m_maxDelay + k];
+            Complex *dst = &m_capture[i][m_captureCount];
+
+            for (unsigned int j = 0; j < n; j++) {
+                dst[j] = Complex{re[j] / SDR_RX_SCALEF, im[j] / SDR_RX_SCALEF};
+            }
+        }
+
+        m_captureCount += n;
+        k += n;
+
+        if (m_captureCount == captureSize)
+        {
+            accumulate();
+            m_captureCount = 0;
+            m_skipCount = (m_captureRatio - 1) * captureSize;
+        }
+    }
+}
+
+void InterferometerCorrelator::accumulate()
+{
+    const unsigned int captureSize = m_fftSize / 2;
+
+    // zero padding to twice the capture size makes the circular correlation linear for lags below captureSize
+    for (unsigned int i = 0; i < m_nbStreams; i++)
+    {
+        Complex *in = m_fft->in();
+        std::copy(m_capture[i].begin(), m_capture[i].end(), in);
+        std::fill(in + captureSize, in + m_fftSize, Complex{0.0f, 0.0f});
+        double energy = 0.0;
+
+        for (unsigned int j = 0; j < captureSize; j++) {
+            energy += std::norm(m_capture[i][j]);
+        }
+
+        m_energy[i] += energy;
+        m_fft->transform();
+        const Complex *out = m_fft->out();
+
+        if (i == 0)
+        {
+            std::copy(out, out + m_fftSize, m_refSpectrum.begin());
+            continue;
+        }
+
+        Complex *cross = m_crossSpectrum[i].data();
+        const Complex *ref = m_refSpectrum.data();
+
+        for (unsigned int j = 0; j < m_fftSize; j++) {
+            cross[j] += ref[j] * std::conj(out[j]);
+        }
+    }
+
+    if (++m_nbAveraged == m_nbAverages)
+    {
+        correlate();
+        resetCorrelation();
+    }
+}
+
+void InterferometerCorrelator::correlate()
+{
+    m_measurements[0] = StreamMeasurement();
+    m_measurements[0].m_coherence = 1.0f;
+
+    for (unsigned int i = 1; i < m_nbStreams; i++)
+    {
+        std::copy(m_crossSpectrum[i].begin(), m_crossSpectrum[i].end(), m_invFFT->in());
+        m_invFFT->transform();
+        const Complex *out = m_invFFT->out();
+        unsigned int peakIndex = 0;
+        float peakMagsq = 0.0f;
+
+        for (unsigned int j = 0; j < m_fftSize; j++)
+        {
+            float magsq = std::norm(out[j]);
+
+            if (magsq > peakMagsq)
+            {
+                peakMagsq = magsq;
+                peakIndex = j;
+            }
+        }
+
+        // the peak is at the lag of the reference stream on stream i: its opposite is the delay of stream i
+        int lag = peakIndex < m_fftSize / 2 ? (int) peakIndex : (int) peakIndex - (int) m_fftSize;
+        // the inverse FFT is not normalized and the captures overlap on captureSize - |lag| samples only
+        double overlap = (double) (m_fftSize / 2 - std::abs(lag)) / (m_fftSize / 2);
+        double norm = m_fftSize * overlap * sqrt(m_energy[0] * m_energy[i]);
+        StreamMeasurement& measurement = m_measurements[i];
+        measurement.m_delay = -lag;
+        measurement.m_phase = -std::arg(out[peakIndex]) * 180.0 / M_PI;
+        measurement.m_coherence = norm == 0.0 ? 0.0f : std::min(1.0, sqrt(peakMagsq) / norm);
+    }
+
+    m_measurementsReady = true;
+}
+
+bool InterferometerCorrelator::getMeasurements(std::vector<StreamMeasurement>& measurements)
+{
+    if (!m_measurementsReady) {
+        return false;
+    }
+
+    measurements = m_measurements;
+    m_measurementsReady = false;
+    return true;
+}
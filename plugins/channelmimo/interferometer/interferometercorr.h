@@ -0,0 +1,109 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_INTERFEROMETERCORR_H_
+#define INCLUDE_INTERFEROMETERCORR_H_
+
+#include <vector>
+
+#include "dsp/dsptypes.h"
+
+#include "interferometersettings.h"
+
+class FFTEngine;
+
+/**
+ * Combines the streams of a phase coherent device into a single stream.
+ *
+ * Each stream goes through a delay line of InterferometerSettings::m_maxDelay samples and is
+ * multiplied by a complex weight made of its gain and phase corrections and of the steering
+ * phase. Samples are kept as separate real and imaginary float arrays so that the complex
+ * multiply and accumulate loops over a block are vectorized by the compiler.
+ *
+ * The raw streams are also correlated with the reference stream (stream 0) with FFTs: cross
+ * spectra of zero padded captures are averaged and the inverse FFT peak gives the delay and
+ * phase of each stream relative to the reference.
+ */
+class InterferometerCorrelator
+{
+public:
+    struct StreamMeasurement
+    {
+        int m_delay;       //!< samples. Delay of the stream from the reference stream.
+        float m_phase;     //!< degrees. Phase from the reference stream once delays are compensated.
+        float m_coherence; //!< normalized correlation peak (0 to 1)
+
+        StreamMeasurement() : m_delay(0), m_phase(0.0f), m_coherence(0.0f) {}
+    };
+
+    InterferometerCorrelator();
+    ~InterferometerCorrelator();
+
+    void setNbStreams(unsigned int nbStreams);
+    unsigned int getNbStreams() const { return m_nbStreams; }
+    void setSettings(const InterferometerSettings& settings);
+
+    /** Combine nbSamples from each stream starting at vbegin. The result is available with getOutput(). */
+    void feed(const std::vector<SampleVector::const_iterator>& vbegin, unsigned int nbSamples);
+    const SampleVector& getOutput() const { return m_output; }
+
+    /** Returns true with the measurements of all streams when a new correlation is complete */
+    bool getMeasurements(std::vector<StreamMeasurement>& measurements);
+
+private:
+    unsigned int m_nbStreams;
+    InterferometerSettings::OutputType m_outputType;
+    unsigned int m_productStreamIndex;
+    std::vector<float> m_weightRe;
+    std::vector<float> m_weightIm;
+    std::vector<int> m_delays;
+    std::vector<std::vector<float>> m_re; //!< delay line history followed by the current block for each stream
+    std::vector<std::vector<float>> m_im;
+    std::vector<float> m_accRe;
+    std::vector<float> m_accIm;
+    SampleVector m_output;
+
+    unsigned int m_fftSize;
+    FFTEngine *m_fft;
+    FFTEngine *m_invFFT;
+    unsigned int m_fftSequence;
+    unsigned int m_invFFTSequence;
+    std::vector<std::vector<Complex>> m_capture;       //!< fftSize/2 samples of each stream
+    std::vector<std::vector<Complex>> m_crossSpectrum; //!< averaged reference spectrum times conjugate stream spectrum
+    std::vector<Complex> m_refSpectrum;
+    std::vector<double> m_energy;
+    unsigned int m_captureCount;
+    unsigned int m_skipCount;
+    unsigned int m_nbAveraged;
+    std::vector<StreamMeasurement> m_measurements;
+    bool m_measurementsReady;
+
+    static const unsigned int m_nbAverages = 8;  //!< captures averaged in a correlation
+    static const unsigned int m_captureRatio = 4; //!< one capture of fftSize/2 samples every m_captureRatio
+
+    void resize(unsigned int nbSamples);
+    void combineSum(unsigned int nbSamples);
+    void combineProduct(unsigned int nbSamples);
+    void capture(unsigned int nbSamples);
+    void accumulate();
+    void correlate();
+    void allocateFFT(unsigned int log2Size);
+    void releaseFFT();
+    void resetCorrelation();
+};
+
+#endif /* INCLUDE_INTERFEROMETERCORR_H_ */
@@ -0,0 +1,473 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+#include "device/deviceuiset.h"
+#include "gui/basicchannelsettingsdialog.h"
+#include "mainwindow.h"
+
+#include "interferometergui.h"
+#include "interferometerbaseband.h"
+#include "interferometer.h"
+#include "ui_interferometergui.h"
+
+InterferometerGUI* InterferometerGUI::create(PluginAPI* pluginAPI, DeviceUISet *deviceUISet, MIMOChannel *mimoChannel)
+{
+    InterferometerGUI* gui = new InterferometerGUI(pluginAPI, deviceUISet, mimoChannel);
+    return gui;
+}
+
+void InterferometerGUI::destroy()
+{
+    delete this;
+}
+
+void InterferometerGUI::setName(const QString& name)
+{
+    setObjectName(name);
+}
+
+QString InterferometerGUI::getName() const
+{
+    return objectName();
+}
+
+qint64 InterferometerGUI::getCenterFrequency() const {
+    return 0;
+}
+
+void InterferometerGUI::setCenterFrequency(qint64 centerFrequency)
+{
+    (void) centerFrequency;
+}
+
+void InterferometerGUI::resetToDefaults()
+{
+    m_settings.resetToDefaults();
+    displaySettings();
+    applySettings(true);
+}
+
+QByteArray InterferometerGUI::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool InterferometerGUI::deserialize(const QByteArray& data)
+{
+    updateLocalDevices();
+
+    if (m_settings.deserialize(data))
+    {
+        displaySettings();
+        applySettings(true);
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
+
+bool InterferometerGUI::handleMessage(const Message& message)
+{
+    if (Interferometer::MsgBasebandNotification::match(message))
+    {
+        Interferometer::MsgBasebandNotification& notif = (Interferometer::MsgBasebandNotification&) message;
+        m_basebandSampleRate = notif.getSampleRate();
+
+        if (notif.getNbStreams() != m_nbStreams)
+        {
+            m_nbStreams = notif.getNbStreams();
+            displayStreams();
+        }
+
+        displayRate();
+        return true;
+    }
+    else if (Interferometer::MsgConfigureInterferometer::match(message))
+    {
+        const Interferometer::MsgConfigureInterferometer& cfg = (Interferometer::MsgConfigureInterferometer&) message;
+        m_settings = cfg.getSettings();
+        blockApplySettings(true);
+        displaySettings();
+        blockApplySettings(false);
+        return true;
+    }
+    else if (InterferometerBaseband::MsgCorrelationReport::match(message))
+    {
+        const InterferometerBaseband::MsgCorrelationReport& report = (InterferometerBaseband::MsgCorrelationReport&) message;
+        m_measurements = report.getMeasurements();
+        displayMeasurement();
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+InterferometerGUI::InterferometerGUI(PluginAPI* pluginAPI, DeviceUISet *deviceUISet, MIMOChannel *mimoChannel, QWidget* parent) :
+        RollupWidget(parent),
+        ui(new Ui::InterferometerGUI),
+        m_pluginAPI(pluginAPI),
+        m_deviceUISet(deviceUISet),
+        m_basebandSampleRate(0),
+        m_streamIndex(0),
+        m_doApplySettings(true)
+{
+    ui->setupUi(this);
+    setAttribute(Qt::WA_DeleteOnClose, true);
+    connect(this, SIGNAL(widgetRolled(QWidget*,bool)), this, SLOT(onWidgetRolled(QWidget*,bool)));
+    connect(this, SIGNAL(customContextMenuRequested(const QPoint &)), this, SLOT(onMenuDialogCalled(const QPoint &)));
+
+    m_interferometer = (Interferometer*) mimoChannel;
+    m_interferometer->setMessageQueueToGUI(getInputMessageQueue());
+    m_nbStreams = m_interferometer->getNbStreams();
+
+    m_channelMarker.blockSignals(true);
+    m_channelMarker.setColor(m_settings.m_rgbColor);
+    m_channelMarker.setCenterFrequency(0);
+    m_channelMarker.setTitle("Interferometer");
+    m_channelMarker.blockSignals(false);
+    m_channelMarker.setVisible(true); // activate signal on the last setting only
+
+    m_settings.setChannelMarker(&m_channelMarker);
+
+    m_deviceUISet->registerChannelInstance(Interferometer::m_channelIdURI, this);
+    m_deviceUISet->addChannelMarker(&m_channelMarker);
+    m_deviceUISet->addRollupWidget(this);
+
+    connect(getInputMessageQueue(), SIGNAL(messageEnqueued()), this, SLOT(handleSourceMessages()));
+
+    updateLocalDevices();
+    displayStreams();
+    displaySettings();
+    applySettings(true);
+}
+
+InterferometerGUI::~InterferometerGUI()
+{
+    m_deviceUISet->removeChannelInstance(this);
+    delete m_interferometer; // TODO: check this: when the GUI closes it has to delete the channel
+    delete ui;
+}
+
+void InterferometerGUI::blockApplySettings(bool block)
+{
+    m_doApplySettings = !block;
+}
+
+void InterferometerGUI::applySettings(bool force)
+{
+    if (m_doApplySettings)
+    {
+        setTitleColor(m_channelMarker.getColor());
+
+        Interferometer::MsgConfigureInterferometer* message = Interferometer::MsgConfigureInterferometer::create(m_settings, force);
+        m_interferometer->getInputMessageQueue()->push(message);
+    }
+}
+
+void InterferometerGUI::displaySettings()
+{
+    m_channelMarker.blockSignals(true);
+    m_channelMarker.setCenterFrequency(0);
+    m_channelMarker.setTitle(m_settings.m_title);
+    m_channelMarker.setBandwidth(m_basebandSampleRate);
+    m_channelMarker.setMovable(false); // the combined stream covers the whole baseband
+    m_channelMarker.blockSignals(false);
+    m_channelMarker.setColor(m_settings.m_rgbColor); // activate signal on the last setting only
+
+    setTitleColor(m_settings.m_rgbColor);
+    setWindowTitle(m_channelMarker.getTitle());
+
+    blockApplySettings(true);
+    int index = getLocalDeviceIndexInCombo(m_settings.m_localDeviceIndex);
+
+    if (index >= 0) {
+        ui->localDevice->setCurrentIndex(index);
+    }
+
+    ui->localDevicePlay->setChecked(m_settings.m_play);
+    ui->outputType->setCurrentIndex((int) m_settings.m_outputType);
+    ui->productStreamIndex->setCurrentIndex(m_settings.m_productStreamIndex - 1);
+    ui->productStreamIndex->setEnabled(m_settings.m_outputType == InterferometerSettings::OutputProduct);
+    ui->correlationSize->setCurrentIndex(m_settings.m_correlationLog2Size - InterferometerSettings::m_minCorrelationLog2Size);
+    ui->autoAlign->setChecked(m_settings.m_autoAlign);
+    // the dials have a coarser resolution than the settings
+    ui->steeringAngle->blockSignals(true);
+    ui->steeringAngle->setValue(roundf(m_settings.m_steeringAngle * 10.0f));
+    ui->steeringAngle->blockSignals(false);
+    ui->steeringAngleText->setText(tr("%1").arg(m_settings.m_steeringAngle, 0, 'f', 1));
+    ui->elementSpacing->blockSignals(true);
+    ui->elementSpacing->setValue(roundf(m_settings.m_elementSpacing * 100.0f));
+    ui->elementSpacing->blockSignals(false);
+    ui->elementSpacingText->setText(tr("%1").arg(m_settings.m_elementSpacing, 0, 'f', 2));
+    displayStreamSettings();
+
+    blockApplySettings(false);
+}
+
+void InterferometerGUI::displayStreams()
+{
+    ui->streamIndex->blockSignals(true);
+    ui->productStreamIndex->blockSignals(true);
+    ui->streamIndex->clear();
+    ui->productStreamIndex->clear();
+
+    for (unsigned int i = 0; i < InterferometerSettings::m_maxStreams; i++)
+    {
+        if (i < m_nbStreams) {
+            ui->streamIndex->addItem(tr("%1").arg(i));
+        }
+        if (i > 0) { // the reference stream cannot be conjugated with itself
+            ui->productStreamIndex->addItem(tr("%1").arg(i));
+        }
+    }
+
+    if (m_streamIndex >= m_nbStreams) {
+        m_streamIndex = 0;
+    }
+
+    ui->streamIndex->setCurrentIndex(m_streamIndex);
+    ui->productStreamIndex->setCurrentIndex(m_settings.m_productStreamIndex - 1);
+    ui->streamIndex->blockSignals(false);
+    ui->productStreamIndex->blockSignals(false);
+    setStreamIndicator("M"); // MIMO channel indicator
+}
+
+void InterferometerGUI::displayStreamSettings()
+{
+    // measured phases are kept with their full resolution until the controls are moved
+    const InterferometerStreamSettings& stream = m_settings.m_streams[m_streamIndex];
+    ui->gain->blockSignals(true);
+    ui->phase->blockSignals(true);
+    ui->delay->blockSignals(true);
+    ui->gain->setValue(roundf(stream.m_gain * 10.0f));
+    ui->gainText->setText(tr("%1").arg(stream.m_gain, 0, 'f', 1));
+    ui->phase->setValue(roundf(stream.m_phase));
+    ui->phaseText->setText(tr("%1").arg(stream.m_phase, 0, 'f', 1));
+    ui->delay->setValue(stream.m_delay);
+    ui->gain->blockSignals(false);
+    ui->phase->blockSignals(false);
+    ui->delay->blockSignals(false);
+    displayMeasurement();
+}
+
+void InterferometerGUI::displayMeasurement()
+{
+    if (m_streamIndex < m_measurements.size())
+    {
+        const InterferometerCorrelator::StreamMeasurement& measurement = m_measurements[m_streamIndex];
+        ui->measuredDelayText->setText(tr("%1").arg(measurement.m_delay));
+        ui->measuredPhaseText->setText(tr("%1").arg(measurement.m_phase, 0, 'f', 1));
+        ui->coherenceText->setText(tr("%1").arg(measurement.m_coherence, 0, 'f', 2));
+    }
+    else
+    {
+        ui->measuredDelayText->setText("-");
+        ui->measuredPhaseText->setText("-");
+        ui->coherenceText->setText("-");
+    }
+}
+
+void InterferometerGUI::displayRate()
+{
+    ui->channelRateText->setText(tr("%1k").arg(QString::number(m_basebandSampleRate / 1000.0, 'g', 5)));
+    m_channelMarker.setBandwidth(m_basebandSampleRate);
+}
+
+void InterferometerGUI::updateLocalDevices()
+{
+    std::vector<uint32_t> localDevicesIndexes;
+    m_interferometer->getLocalDevices(localDevicesIndexes);
+    ui->localDevice->clear();
+    std::vector<uint32_t>::const_iterator it = localDevicesIndexes.begin();
+
+    for (; it != localDevicesIndexes.end(); ++it) {
+        ui->localDevice->addItem(tr("%1").arg(*it), QVariant(*it));
+    }
+}
+
+int InterferometerGUI::getLocalDeviceIndexInCombo(int localDeviceIndex)
+{
+    int index = 0;
+
+    for (; index < ui->localDevice->count(); index++)
+    {
+        if (localDeviceIndex == ui->localDevice->itemData(index).toInt()) {
+            return index;
+        }
+    }
+
+    return -1;
+}
+
+void InterferometerGUI::leaveEvent(QEvent*)
+{
+    m_channelMarker.setHighlighted(false);
+}
+
+void InterferometerGUI::enterEvent(QEvent*)
+{
+    m_channelMarker.setHighlighted(true);
+}
+
+void InterferometerGUI::handleSourceMessages()
+{
+    Message* message;
+
+    while ((message = getInputMessageQueue()->pop()) != 0)
+    {
+        if (handleMessage(*message))
+        {
+            delete message;
+        }
+    }
+}
+
+void InterferometerGUI::onWidgetRolled(QWidget* widget, bool rollDown)
+{
+    (void) widget;
+    (void) rollDown;
+}
+
+void InterferometerGUI::onMenuDialogCalled(const QPoint &p)
+{
+    if (m_contextMenuType == ContextMenuChannelSettings)
+    {
+        BasicChannelSettingsDialog dialog(&m_channelMarker, this);
+        dialog.setUseReverseAPI(m_settings.m_useReverseAPI);
+        dialog.setReverseAPIAddress(m_settings.m_reverseAPIAddress);
+        dialog.setReverseAPIPort(m_settings.m_reverseAPIPort);
+        dialog.setReverseAPIDeviceIndex(m_settings.m_reverseAPIDeviceIndex);
+        dialog.setReverseAPIChannelIndex(m_settings.m_reverseAPIChannelIndex);
+
+        dialog.move(p);
+        dialog.exec();
+
+        m_settings.m_rgbColor = m_channelMarker.getColor().rgb();
+        m_settings.m_title = m_channelMarker.getTitle();
+        m_settings.m_useReverseAPI = dialog.useReverseAPI();
+        m_settings.m_reverseAPIAddress = dialog.getReverseAPIAddress();
+        m_settings.m_reverseAPIPort = dialog.getReverseAPIPort();
+        m_settings.m_reverseAPIDeviceIndex = dialog.getReverseAPIDeviceIndex();
+        m_settings.m_reverseAPIChannelIndex = dialog.getReverseAPIChannelIndex();
+
+        setWindowTitle(m_settings.m_title);
+        setTitleColor(m_settings.m_rgbColor);
+
+        applySettings();
+    }
+
+    resetContextMenuType();
+}
+
+void InterferometerGUI::on_localDevice_currentIndexChanged(int index)
+{
+    m_settings.m_localDeviceIndex = ui->localDevice->itemData(index).toInt();
+    applySettings();
+}
+
+void InterferometerGUI::on_localDevicesRefresh_clicked(bool checked)
+{
+    (void) checked;
+    updateLocalDevices();
+    int index = getLocalDeviceIndexInCombo(m_settings.m_localDeviceIndex);
+
+    if (index >= 0) {
+        ui->localDevice->setCurrentIndex(index);
+    }
+}
+
+void InterferometerGUI::on_localDevicePlay_toggled(bool checked)
+{
+    m_settings.m_play = checked;
+    applySettings();
+}
+
+void InterferometerGUI::on_outputType_currentIndexChanged(int index)
+{
+    m_settings.m_outputType = (InterferometerSettings::OutputType) index;
+    ui->productStreamIndex->setEnabled(m_settings.m_outputType == InterferometerSettings::OutputProduct);
+    applySettings();
+}
+
+void InterferometerGUI::on_productStreamIndex_currentIndexChanged(int index)
+{
+    m_settings.m_productStreamIndex = index + 1;
+    applySettings();
+}
+
+void InterferometerGUI::on_correlationSize_currentIndexChanged(int index)
+{
+    m_settings.m_correlationLog2Size = index + InterferometerSettings::m_minCorrelationLog2Size;
+    applySettings();
+}
+
+void InterferometerGUI::on_autoAlign_toggled(bool checked)
+{
+    m_settings.m_autoAlign = checked;
+    applySettings();
+}
+
+void InterferometerGUI::on_steeringAngle_valueChanged(int value)
+{
+    m_settings.m_steeringAngle = value / 10.0f;
+    ui->steeringAngleText->setText(tr("%1").arg(m_settings.m_steeringAngle, 0, 'f', 1));
+    applySettings();
+}
+
+void InterferometerGUI::on_elementSpacing_valueChanged(int value)
+{
+    m_settings.m_elementSpacing = value / 100.0f;
+    ui->elementSpacingText->setText(tr("%1").arg(m_settings.m_elementSpacing, 0, 'f', 2));
+    applySettings();
+}
+
+void InterferometerGUI::on_streamIndex_currentIndexChanged(int index)
+{
+    if (index < 0) {
+        return;
+    }
+
+    m_streamIndex = index;
+    displayStreamSettings();
+}
+
+void InterferometerGUI::on_gain_valueChanged(int value)
+{
+    m_settings.m_streams[m_streamIndex].m_gain = value / 10.0f;
+    ui->gainText->setText(tr("%1").arg(m_settings.m_streams[m_streamIndex].m_gain, 0, 'f', 1));
+    applySettings();
+}
+
+void InterferometerGUI::on_phase_valueChanged(int value)
+{
+    m_settings.m_streams[m_streamIndex].m_phase = value;
+    ui->phaseText->setText(tr("%1").arg(value));
+    applySettings();
+}
+
+void InterferometerGUI::on_delay_valueChanged(int value)
+{
+    m_settings.m_streams[m_streamIndex].m_delay = value;
+    applySettings();
+}
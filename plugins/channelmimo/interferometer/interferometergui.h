@@ -0,0 +1,110 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_INTERFEROMETERGUI_H_
+#define INCLUDE_INTERFEROMETERGUI_H_
+
+#include <stdint.h>
+#include <vector>
+
+#include <QObject>
+
+#include "plugin/plugininstancegui.h"
+#include "dsp/channelmarker.h"
+#include "gui/rollupwidget.h"
+#include "util/messagequeue.h"
+
+#include "interferometercorr.h"
+#include "interferometersettings.h"
+
+class PluginAPI;
+class DeviceUISet;
+class Interferometer;
+class MIMOChannel;
+
+namespace Ui {
+    class InterferometerGUI;
+}
+
+class InterferometerGUI : public RollupWidget, public PluginInstanceGUI {
+    Q_OBJECT
+public:
+    static InterferometerGUI* create(PluginAPI* pluginAPI, DeviceUISet *deviceUISet, MIMOChannel *mimoChannel);
+    virtual void destroy();
+
+    void setName(const QString& name);
+    QString getName() const;
+    virtual qint64 getCenterFrequency() const;
+    virtual void setCenterFrequency(qint64 centerFrequency);
+
+    void resetToDefaults();
+    QByteArray serialize() const;
+    bool deserialize(const QByteArray& data);
+    virtual MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; }
+    virtual bool handleMessage(const Message& message);
+
+private:
+    Ui::InterferometerGUI* ui;
+    PluginAPI* m_pluginAPI;
+    DeviceUISet* m_deviceUISet;
+    ChannelMarker m_channelMarker;
+    InterferometerSettings m_settings;
+    int m_basebandSampleRate;
+    unsigned int m_nbStreams;
+    unsigned int m_streamIndex; //!< stream shown in the stream correction controls
+    std::vector<InterferometerCorrelator::StreamMeasurement> m_measurements;
+    bool m_doApplySettings;
+
+    Interferometer* m_interferometer;
+    MessageQueue m_inputMessageQueue;
+
+    explicit InterferometerGUI(PluginAPI* pluginAPI, DeviceUISet *deviceUISet, MIMOChannel *mimoChannel, QWidget* parent = 0);
+    virtual ~InterferometerGUI();
+
+    void blockApplySettings(bool block);
+    void applySettings(bool force = false);
+    void displaySettings();
+    void displayStreams();
+    void displayStreamSettings();
+    void displayMeasurement();
+    void displayRate();
+    void updateLocalDevices();
+    int getLocalDeviceIndexInCombo(int localDeviceIndex);
+
+    void leaveEvent(QEvent*);
+    void enterEvent(QEvent*);
+
+private slots:
+    void handleSourceMessages();
+    void on_localDevice_currentIndexChanged(int index);
+    void on_localDevicesRefresh_clicked(bool checked);
+    void on_localDevicePlay_toggled(bool checked);
+    void on_outputType_currentIndexChanged(int index);
+    void on_productStreamIndex_currentIndexChanged(int index);
+    void on_correlationSize_currentIndexChanged(int index);
+    void on_autoAlign_toggled(bool checked);
+    void on_steeringAngle_valueChanged(int value);
+    void on_elementSpacing_valueChanged(int value);
+    void on_streamIndex_currentIndexChanged(int index);
+    void on_gain_valueChanged(int value);
+    void on_phase_valueChanged(int value);
+    void on_delay_valueChanged(int value);
+    void onWidgetRolled(QWidget* widget, bool rollDown);
+    void onMenuDialogCalled(const QPoint& p);
+};
+
+#endif /* INCLUDE_INTERFEROMETERGUI_H_ */
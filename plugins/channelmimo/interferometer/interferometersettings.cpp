@@ -0,0 +1,192 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QColor>
+
+#include "util/simpleserializer.h"
+#include "settings/serializable.h"
+
+#include "interferometersettings.h"
+
+InterferometerStreamSettings::InterferometerStreamSettings()
+{
+    resetToDefaults();
+}
+
+void InterferometerStreamSettings::resetToDefaults()
+{
+    m_gain = 0.0f;
+    m_phase = 0.0f;
+    m_delay = 0;
+}
+
+QByteArray InterferometerStreamSettings::serialize() const
+{
+    SimpleSerializer s(1);
+
+    s.writeFloat(1, m_gain);
+    s.writeFloat(2, m_phase);
+    s.writeS32(3, m_delay);
+
+    return s.final();
+}
+
+bool InterferometerStreamSettings::deserialize(const QByteArray& data)
+{
+    SimpleDeserializer d(data);
+
+    if (!d.isValid() || (d.getVersion() != 1))
+    {
+        resetToDefaults();
+        return false;
+    }
+
+    d.readFloat(1, &m_gain, 0.0f);
+    d.readFloat(2, &m_phase, 0.0f);
+    d.readS32(3, &m_delay, 0);
+    m_delay = m_delay < 0 ? 0 : m_delay > InterferometerSettings::m_maxDelay ? InterferometerSettings::m_maxDelay : m_delay;
+
+    return true;
+}
+
+InterferometerSettings::InterferometerSettings() :
+    m_channelMarker(nullptr)
+{
+    resetToDefaults();
+}
+
+void InterferometerSettings::resetToDefaults()
+{
+    m_localDeviceIndex = 0;
+    m_rgbColor = QColor(128, 128, 128).rgb();
+    m_title = "Interferometer";
+    m_play = false;
+    m_outputType = OutputSum;
+    m_productStreamIndex = 1;
+    m_steeringAngle = 0.0f;
+    m_elementSpacing = 0.5f;
+    m_correlationLog2Size = 12;
+    m_autoAlign = false;
+    m_streams.assign(m_maxStreams, InterferometerStreamSettings());
+    m_useReverseAPI = false;
+    m_reverseAPIAddress = "127.0.0.1";
+    m_reverseAPIPort = 8888;
+    m_reverseAPIDeviceIndex = 0;
+    m_reverseAPIChannelIndex = 0;
+}
+
+QByteArray InterferometerSettings::serialize() const
+{
+    SimpleSerializer s(1);
+
+    s.writeU32(1, m_localDeviceIndex);
+    s.writeS32(2, (int) m_outputType);
+    s.writeU32(3, m_productStreamIndex);
+    s.writeFloat(4, m_steeringAngle);
+    s.writeFloat(5, m_elementSpacing);
+    s.writeU32(6, m_correlationLog2Size);
+    s.writeBool(7, m_autoAlign);
+    s.writeU32(8, m_rgbColor);
+    s.writeString(9, m_title);
+    s.writeBool(10, m_useReverseAPI);
+    s.writeString(11, m_reverseAPIAddress);
+    s.writeU32(12, m_reverseAPIPort);
+    s.writeU32(13, m_reverseAPIDeviceIndex);
+    s.writeU32(14, m_reverseAPIChannelIndex);
+
+    if (m_channelMarker) {
+        s.writeBlob(15, m_channelMarker->serialize());
+    }
+
+    for (unsigned int i = 0; i < m_streams.size(); i++) {
+        s.writeBlob(100 + i, m_streams[i].serialize());
+    }
+
+    return s.final();
+}
+
+bool InterferometerSettings::deserialize(const QByteArray& data)
+{
+    SimpleDeserializer d(data);
+
+    if (!d.isValid())
+    {
+        resetToDefaults();
+        return false;
+    }
+
+    if (d.getVersion() == 1)
+    {
+        uint32_t tmp;
+        int intval;
+        QByteArray bytetmp;
+
+        d.readU32(1, &m_localDeviceIndex, 0);
+        d.readS32(2, &intval, 0);
+
+        if ((intval < 0) || (intval >= (int) OutputLast)) {
+            m_outputType = OutputSum;
+        } else {
+            m_outputType = (OutputType) intval;
+        }
+
+        d.readU32(3, &m_productStreamIndex, 1);
+        m_productStreamIndex = m_productStreamIndex < m_maxStreams ? m_productStreamIndex : 1;
+        d.readFloat(4, &m_steeringAngle, 0.0f);
+        d.readFloat(5, &m_elementSpacing, 0.5f);
+        d.readU32(6, &tmp, 12);
+        m_correlationLog2Size = tmp < m_minCorrelationLog2Size ? m_minCorrelationLog2Size : tmp > m_maxCorrelationLog2Size ? m_maxCorrelationLog2Size : tmp;
+        d.readBool(7, &m_autoAlign, false);
+        d.readU32(8, &m_rgbColor, QColor(128, 128, 128).rgb());
+        d.readString(9, &m_title, "Interferometer");
+        d.readBool(10, &m_useReverseAPI, false);
+        d.readString(11, &m_reverseAPIAddress, "127.0.0.1");
+        d.readU32(12, &tmp, 0);
+
+        if ((tmp > 1023) && (tmp < 65535)) {
+            m_reverseAPIPort = tmp;
+        } else {
+            m_reverseAPIPort = 8888;
+        }
+
+        d.readU32(13, &tmp, 0);
+        m_reverseAPIDeviceIndex = tmp > 99 ? 99 : tmp;
+        d.readU32(14, &tmp, 0);
+        m_reverseAPIChannelIndex = tmp > 99 ? 99 : tmp;
+
+        if (m_channelMarker)
+        {
+            d.readBlob(15, &bytetmp);
+            m_channelMarker->deserialize(bytetmp);
+        }
+
+        m_streams.assign(m_maxStreams, InterferometerStreamSettings());
+
+        for (unsigned int i = 0; i < m_maxStreams; i++)
+        {
+            d.readBlob(100 + i, &bytetmp);
+            m_streams[i].deserialize(bytetmp);
+        }
+
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
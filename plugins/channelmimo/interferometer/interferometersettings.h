@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_INTERFEROMETERSETTINGS_H_
+#define INCLUDE_INTERFEROMETERSETTINGS_H_
+
+#include <vector>
+
+#include <QByteArray>
+#include <QString>
+
+class Serializable;
+
+struct InterferometerStreamSettings
+{
+    float m_gain;  //!< dB
+    float m_phase; //!< degrees. Phase correction added to the stream.
+    int m_delay;   //!< samples. Delay added to the stream.
+
+    InterferometerStreamSettings();
+    void resetToDefaults();
+    QByteArray serialize() const;
+    bool deserialize(const QByteArray& data);
+};
+
+/**
+ * The streams of a phase coherent MIMO device are delayed, phase shifted and scaled by the
+ * corrections of each stream then either summed with the phase progression of a beam steered
+ * m_steeringAngle off the array broadside (beamforming) or the reference stream (stream 0) is
+ * multiplied by the conjugate of another stream (interferometry). The combined stream is sent
+ * to a Local Input device set where Rx channels process it.
+ */
+struct InterferometerSettings
+{
+    typedef enum {
+        OutputSum,
+        OutputProduct,
+        OutputLast
+    } OutputType;
+
+    uint32_t m_localDeviceIndex;
+    quint32 m_rgbColor;
+    QString m_title;
+    bool m_play;
+    OutputType m_outputType;
+    unsigned int m_productStreamIndex; //!< stream multiplied by the conjugate of the reference stream
+    float m_steeringAngle;             //!< degrees from the array broadside
+    float m_elementSpacing;            //!< distance between two array elements in wavelengths
+    unsigned int m_correlationLog2Size;
+    bool m_autoAlign;                  //!< apply the delays and phases measured by the correlator
+    std::vector<InterferometerStreamSettings> m_streams;
+    bool m_useReverseAPI;
+    QString m_reverseAPIAddress;
+    uint16_t m_reverseAPIPort;
+    uint16_t m_reverseAPIDeviceIndex;
+    uint16_t m_reverseAPIChannelIndex;
+
+    Serializable *m_channelMarker;
+
+    static const unsigned int m_maxStreams = 8;
+    static const int m_maxDelay = 2048;
+    static const unsigned int m_minCorrelationLog2Size = 10;
+    static const unsigned int m_maxCorrelationLog2Size = 16;
+
+    InterferometerSettings();
+    void resetToDefaults();
+    void setChannelMarker(Serializable *channelMarker) { m_channelMarker = channelMarker; }
+    QByteArray serialize() const;
+    bool deserialize(const QByteArray& data);
+};
+
+#endif /* INCLUDE_INTERFEROMETERSETTINGS_H_ */
@@ -0,0 +1,49 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "SWGChannelSettings.h"
+#include "interferometer.h"
+#include "interferometerwebapiadapter.h"
+
+InterferometerWebAPIAdapter::InterferometerWebAPIAdapter()
+{}
+
+InterferometerWebAPIAdapter::~InterferometerWebAPIAdapter()
+{}
+
+int InterferometerWebAPIAdapter::webapiSettingsGet(
+        SWGSDRangel::SWGChannelSettings& response,
+        QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setInterferometerSettings(new SWGSDRangel::SWGInterferometerSettings());
+    response.getInterferometerSettings()->init();
+    Interferometer::webapiFormatChannelSettings(response, m_settings);
+    return 200;
+}
+
+int InterferometerWebAPIAdapter::webapiSettingsPutPatch(
+        bool force,
+        const QStringList& channelSettingsKeys,
+        SWGSDRangel::SWGChannelSettings& response,
+        QString& errorMessage)
+{
+    (void) force;
+    (void) errorMessage;
+    Interferometer::webapiUpdateChannelSettings(m_settings, channelSettingsKeys, response);
+    return 200;
+}
@@ -21,9 +21,13 @@
 
 #include <stdio.h>
 
+#include "SWGChannelReport.h"
+#include "SWGChannelAnalyzerReport.h"
+
 #include "device/deviceapi.h"
 #include "audio/audiooutput.h"
 #include "dsp/dspcommands.h"
+#include "util/db.h"
 #include "chanalyzer.h"
 
 MESSAGE_CLASS_DEFINITION(ChannelAnalyzer::MsgConfigureChannelAnalyzer, Message)
@@ -138,7 +142,8 @@ void ChannelAnalyzer::applySettings(const ChannelAnalyzerSettings& settings, boo
             << " m_pll: " << settings.m_pll
             << " m_fll: " << settings.m_fll
             << " m_pllPskOrder: " << settings.m_pllPskOrder
-            << " m_inputType: " << (int) settings.m_inputType;
+            << " m_inputType: " << (int) settings.m_inputType
+            << " m_corrLog2Decim: " << settings.m_corrLog2Decim;
 
     ChannelAnalyzerBaseband::MsgConfigureChannelAnalyzerBaseband *msg
         = ChannelAnalyzerBaseband::MsgConfigureChannelAnalyzerBaseband::create(settings, force);
@@ -146,3 +151,22 @@ void ChannelAnalyzer::applySettings(const ChannelAnalyzerSettings& settings, boo
 
     m_settings = settings;
 }
+
+int ChannelAnalyzer::webapiReportGet(
+        SWGSDRangel::SWGChannelReport& response,
+        QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setChannelAnalyzerReport(new SWGSDRangel::SWGChannelAnalyzerReport());
+    response.getChannelAnalyzerReport()->init();
+    webapiFormatChannelReport(response);
+    return 200;
+}
+
+void ChannelAnalyzer::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response)
+{
+    response.getChannelAnalyzerReport()->setChannelPowerDb(CalcDb::dbPower(getMagSqAvg()));
+    response.getChannelAnalyzerReport()->setChannelSampleRate(getChannelSampleRate());
+    response.getChannelAnalyzerReport()->setDroppedSamples(m_basebandSink->getDroppedSamples());
+    response.getChannelAnalyzerReport()->setCorrDroppedSamples(m_basebandSink->getCorrDroppedSamples());
+}
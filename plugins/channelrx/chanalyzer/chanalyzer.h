@@ -83,6 +83,10 @@ public:
     virtual QByteArray serialize() const { return QByteArray(); }
     virtual bool deserialize(const QByteArray& data) { (void) data; return false; }
 
+    virtual int webapiReportGet(
+            SWGSDRangel::SWGChannelReport& response,
+            QString& errorMessage);
+
     virtual int getNbSinkStreams() const { return 1; }
     virtual int getNbSourceStreams() const { return 0; }
 
@@ -106,6 +110,7 @@ private:
     qint64 m_centerFrequency; //!< stored from device message used when starting baseband sink
 
 	void applySettings(const ChannelAnalyzerSettings& settings, bool force = false);
+    void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
 };
 
 #endif // INCLUDE_CHANALYZER_H
@@ -72,6 +72,8 @@ public:
     Real getPllFrequency() const { return m_sink.getPllFrequency(); }
     Real getPllDeltaPhase() const { return m_sink.getPllDeltaPhase(); }
     Real getPllPhase() const { return m_sink.getPllPhase(); }
+    quint64 getDroppedSamples() { return m_sampleFifo.getDroppedSamples(); }
+    quint64 getCorrDroppedSamples() const { return m_sink.getCorrDroppedSamples(); }
 
 private:
     SampleSinkFifo m_sampleFifo;
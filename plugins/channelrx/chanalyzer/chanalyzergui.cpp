@@ -116,6 +116,7 @@ void ChannelAnalyzerGUI::displaySettings()
     ui->log2Decim->setCurrentIndex(m_settings.m_log2Decim);
     displayPLLSettings();
     ui->signalSelect->setCurrentIndex((int) m_settings.m_inputType);
+    ui->corrDecim->setCurrentIndex(m_settings.m_corrLog2Decim);
     ui->rrcFilter->setChecked(m_settings.m_rrc);
     QString rolloffStr = QString::number(m_settings.m_rrcRolloff/100.0, 'f', 2);
     ui->rrcRolloffText->setText(rolloffStr);
@@ -277,15 +278,26 @@ void ChannelAnalyzerGUI::on_useRationalDownsampler_toggled(bool checked)
 void ChannelAnalyzerGUI::on_signalSelect_currentIndexChanged(int index)
 {
     m_settings.m_inputType = (ChannelAnalyzerSettings::InputType) index;
+    setTraceChunkSize();
+    applySettings();
+}
+
+void ChannelAnalyzerGUI::on_corrDecim_currentIndexChanged(int index)
+{
+    m_settings.m_corrLog2Decim = index;
+    setTraceChunkSize();
+    applySettings();
+}
 
-    if (m_settings.m_inputType == ChannelAnalyzerSettings::InputAutoCorr) {
-        m_scopeVis->setTraceChunkSize(ChannelAnalyzerSink::m_corrFFTLen);
+void ChannelAnalyzerGUI::setTraceChunkSize()
+{
+    if (m_settings.m_inputType == ChannelAnalyzerSettings::InputAutoCorr) { // one correlation per trace
+        m_scopeVis->setTraceChunkSize(ChannelAnalyzerSink::m_corrFFTLen << m_settings.m_corrLog2Decim);
     } else {
         m_scopeVis->setTraceChunkSize(ScopeVis::m_traceChunkDefaultSize);
     }
 
     ui->scopeGUI->traceLengthChange();
-    applySettings();
 }
 
 void ChannelAnalyzerGUI::on_deltaFrequency_changed(qint64 value)
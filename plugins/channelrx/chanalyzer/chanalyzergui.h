@@ -89,6 +89,7 @@ private:
 	void displaySettings();
 	void displayPLLSettings();
 	void setSpectrumDisplay();
+	void setTraceChunkSize();
 
 	void leaveEvent(QEvent*);
 	void enterEvent(QEvent*);
@@ -100,6 +101,7 @@ private slots:
     void on_pllPskOrder_currentIndexChanged(int index);
     void on_useRationalDownsampler_toggled(bool checked);
     void on_signalSelect_currentIndexChanged(int index);
+    void on_corrDecim_currentIndexChanged(int index);
     void on_rrcFilter_toggled(bool checked);
     void on_rrcRolloff_valueChanged(int value);
 	void on_BW_valueChanged(int value);
@@ -46,6 +46,7 @@ void ChannelAnalyzerSettings::resetToDefaults()
     m_rrcRolloff = 35; // 0.35
     m_pllPskOrder = 1;
     m_inputType = InputSignal;
+    m_corrLog2Decim = 0;
     m_rgbColor = QColor(128, 128, 128).rgb();
     m_title = "Channel Analyzer";
 }
@@ -71,6 +72,7 @@ QByteArray ChannelAnalyzerSettings::serialize() const
     s.writeString(15, m_title);
     s.writeBool(16, m_rrc);
     s.writeU32(17, m_rrcRolloff);
+    s.writeS32(18, m_corrLog2Decim);
 
     return s.final();
 }
@@ -118,6 +120,8 @@ bool ChannelAnalyzerSettings::deserialize(const QByteArray& data)
         d.readString(15, &m_title, "Channel Analyzer");
         d.readBool(16, &m_rrc, false);
         d.readU32(17, &m_rrcRolloff, 35);
+        d.readS32(18, &m_corrLog2Decim, 0);
+        m_corrLog2Decim = m_corrLog2Decim < 0 ? 0 : m_corrLog2Decim > 4 ? 4 : m_corrLog2Decim;
 
         return true;
     }
@@ -44,6 +44,7 @@ struct ChannelAnalyzerSettings
     quint32 m_rrcRolloff; //!< in 100ths
     unsigned int m_pllPskOrder;
     InputType m_inputType;
+    int m_corrLog2Decim; //!< log2 of decimation applied before auto-correlation
     quint32 m_rgbColor;
     QString m_title;
     Serializable *m_channelMarker;
@@ -30,6 +30,9 @@ ChannelAnalyzerSink::ChannelAnalyzerSink() :
     m_channelSampleRate(48000),
     m_channelFrequencyOffset(0),
     m_sinkSampleRate(48000),
+    m_corrDecimSum(0, 0),
+    m_corrDecimCount(0),
+    m_corrDroppedSamples(0),
     m_sampleSink(nullptr)
 {
 	m_usb = true;
@@ -54,8 +57,6 @@ ChannelAnalyzerSink::~ChannelAnalyzerSink()
 
 void ChannelAnalyzerSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
-	fftfilt::cmplx *sideband = 0;
-
 	for (SampleVector::const_iterator it = begin; it < end; ++it)
 	{
     	Complex ci;
@@ -64,7 +65,7 @@ void ChannelAnalyzerSink::feed(const SampleVector::const_iterator& begin, const
 
 		if (m_decimator.getDecim() == 1)
 		{
-	        processOneSample(c, sideband);
+	        m_inputBuffer.push_back(c);
 		}
 		else
 		{
@@ -76,18 +77,20 @@ void ChannelAnalyzerSink::feed(const SampleVector::const_iterator& begin, const
 
                     if (m_interpolator.decimate(&m_interpolatorDistanceRemain, ci, &cj))
                     {
-                        processOneSample(cj, sideband);
+                        m_inputBuffer.push_back(cj);
                         m_interpolatorDistanceRemain += m_interpolatorDistance;
                     }
                 }
                 else
                 {
-                    processOneSample(ci, sideband);
+                    m_inputBuffer.push_back(ci);
                 }
             }
         }
 	}
 
+    processBlock();
+
 	if (m_sampleSink) {
 		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end(), m_settings.m_ssb); // m_ssb = positive only
 	}
@@ -95,49 +98,125 @@ void ChannelAnalyzerSink::feed(const SampleVector::const_iterator& begin, const
 	m_sampleBuffer.clear();
 }
 
-void ChannelAnalyzerSink::processOneSample(Complex& c, fftfilt::cmplx *sideband)
+void ChannelAnalyzerSink::processBlock()
 {
-    int n_out;
+	fftfilt::cmplx *sideband = 0;
+    bool pllOutput = m_settings.m_inputType == ChannelAnalyzerSettings::InputPLL;
+    m_filterBuffer.clear();
+    m_pllBuffer.clear();
 
-    if (m_settings.m_ssb)
-    {
-        n_out = SSBFilter->runSSB(c, &sideband, m_usb);
-    }
-    else
+    // Filter stage
+    for (const auto& c : m_inputBuffer)
     {
-        if (m_settings.m_rrc) {
-            n_out = RRCFilter->runFilt(c, &sideband);
-        } else {
-            n_out = DSBFilter->runDSB(c, &sideband);
+        int n_out;
+
+        if (m_settings.m_ssb)
+        {
+            n_out = SSBFilter->runSSB(c, &sideband, m_usb);
+        }
+        else
+        {
+            if (m_settings.m_rrc) {
+                n_out = RRCFilter->runFilt(c, &sideband);
+            } else {
+                n_out = DSBFilter->runDSB(c, &sideband);
+            }
         }
-    }
 
-    for (int i = 0; i < n_out; i++)
-    {
-        fftfilt::cmplx si = sideband[i];
-        Real re = si.real() / SDR_RX_SCALEF;
-        Real im = si.imag() / SDR_RX_SCALEF;
-        m_magsq = re*re + im*im;
-        m_channelPowerAvg(m_magsq);
-        std::complex<float> mix;
-
-        if (m_settings.m_pll)
+        for (int i = 0; i < n_out; i++)
         {
-            if (m_settings.m_fll)
+            fftfilt::cmplx si = sideband[i];
+            Real re = si.real() / SDR_RX_SCALEF;
+            Real im = si.imag() / SDR_RX_SCALEF;
+            m_magsq = re*re + im*im;
+            m_channelPowerAvg(m_magsq);
+
+            if (m_settings.m_pll)
             {
-                m_fll.feed(re, im);
-                // Use -fPLL to mix (exchange PLL real and image in the complex multiplication)
-                mix = si * std::conj(m_fll.getComplex());
+                if (m_settings.m_fll)
+                {
+                    m_fll.feed(re, im);
+                    // Use -fPLL to mix (exchange PLL real and image in the complex multiplication)
+                    m_filterBuffer.push_back(si * std::conj(m_fll.getComplex()));
+                }
+                else
+                {
+                    m_pll.feed(re, im);
+                    // Use -fPLL to mix (exchange PLL real and image in the complex multiplication)
+                    m_filterBuffer.push_back(si * std::conj(m_pll.getComplex()));
+                }
             }
             else
             {
-                m_pll.feed(re, im);
-                // Use -fPLL to mix (exchange PLL real and image in the complex multiplication)
-                mix = si * std::conj(m_pll.getComplex());
+                m_filterBuffer.push_back(si);
+            }
+
+            if (pllOutput) {
+                m_pllBuffer.push_back(m_settings.m_fll ? m_fll.getComplex() : m_pll.getComplex());
             }
         }
+    }
 
-        feedOneSample(m_settings.m_pll ? mix : si, m_settings.m_fll ? m_fll.getComplex() : m_pll.getComplex());
+    m_inputBuffer.clear();
+
+    // Output stage
+    switch (m_settings.m_inputType)
+    {
+        case ChannelAnalyzerSettings::InputPLL:
+            for (const auto& pll : m_pllBuffer) {
+                pushSample(pll * SDR_RX_SCALEF);
+            }
+            break;
+        case ChannelAnalyzerSettings::InputAutoCorr:
+            processCorrelation();
+            break;
+        case ChannelAnalyzerSettings::InputSignal:
+        default:
+            for (const auto& s : m_filterBuffer) {
+                pushSample(s);
+            }
+            break;
+    }
+}
+
+void ChannelAnalyzerSink::processCorrelation()
+{
+    int decim = 1 << m_settings.m_corrLog2Decim;
+    m_corrInBuffer.clear();
+
+    if (decim == 1)
+    {
+        for (const auto& s : m_filterBuffer) {
+            m_corrInBuffer.push_back(s / SDR_RX_SCALEF);
+        }
+    }
+    else
+    {
+        // average decim samples (boxcar low pass) to run the correlation at the decimated rate
+        for (const auto& s : m_filterBuffer)
+        {
+            m_corrDecimSum += s;
+
+            if (++m_corrDecimCount == decim)
+            {
+                m_corrInBuffer.push_back(m_corrDecimSum / (SDR_RX_SCALEF * decim));
+                m_corrDecimSum = 0;
+                m_corrDecimCount = 0;
+            }
+        }
+
+        m_corrDroppedSamples.fetch_add(m_filterBuffer.size() - m_corrInBuffer.size(), std::memory_order_relaxed);
+    }
+
+    m_corrOutBuffer.resize(m_corrInBuffer.size());
+    m_corr->run(m_corrInBuffer.data(), nullptr, m_corrInBuffer.size(), m_corrOutBuffer.data());
+
+    // hold each correlation output so that the scope time base is unchanged
+    for (const auto& a : m_corrOutBuffer)
+    {
+        for (int i = 0; i < decim; i++) {
+            pushSample(a);
+        }
     }
 }
 
@@ -231,7 +310,8 @@ void ChannelAnalyzerSink::applySettings(const ChannelAnalyzerSettings& settings,
             << " m_pll: " << settings.m_pll
             << " m_fll: " << settings.m_fll
             << " m_pllPskOrder: " << settings.m_pllPskOrder
-            << " m_inputType: " << (int) settings.m_inputType;
+            << " m_inputType: " << (int) settings.m_inputType
+            << " m_corrLog2Decim: " << settings.m_corrLog2Decim;
     bool doApplySampleRate = false;
 
     if ((settings.m_bandwidth != m_settings.m_bandwidth) ||
@@ -264,6 +344,12 @@ void ChannelAnalyzerSink::applySettings(const ChannelAnalyzerSettings& settings,
         }
     }
 
+    if ((settings.m_corrLog2Decim != m_settings.m_corrLog2Decim) || force)
+    {
+        m_corrDecimSum = 0;
+        m_corrDecimCount = 0;
+    }
+
     if ((settings.m_rationalDownSample != m_settings.m_rationalDownSample) ||
         (settings.m_rationalDownSamplerRate != m_settings.m_rationalDownSamplerRate) || force)
     {
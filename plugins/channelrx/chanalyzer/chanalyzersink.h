@@ -18,6 +18,9 @@
 #ifndef INCLUDE_CHANALYZERSINK_H
 #define INCLUDE_CHANALYZERSINK_H
 
+#include <vector>
+#include <atomic>
+
 #include "dsp/channelsamplesink.h"
 #include "dsp/interpolator.h"
 #include "dsp/decimatorc.h"
@@ -50,6 +53,7 @@ public:
     Real getPllFrequency() const;
 	Real getPllDeltaPhase() const { return m_pll.getDeltaPhi(); }
     Real getPllPhase() const { return m_pll.getPhiHat(); }
+    quint64 getCorrDroppedSamples() const { return m_corrDroppedSamples.load(std::memory_order_relaxed); }
     void setSampleSink(BasebandSampleSink* sampleSink) { m_sampleSink = sampleSink; }
 
     static const unsigned int m_corrFFTLen;
@@ -78,50 +82,31 @@ private:
 	fftcorr* m_corr;
 
 	SampleVector m_sampleBuffer;
+	std::vector<Complex> m_inputBuffer;        //!< decimated channel samples of the current block
+	std::vector<fftfilt::cmplx> m_filterBuffer; //!< filtered (and PLL mixed) samples of the current block
+	std::vector<fftfilt::cmplx> m_pllBuffer;    //!< PLL/FLL output of the current block
+	std::vector<fftcorr::cmplx> m_corrInBuffer;
+	std::vector<fftcorr::cmplx> m_corrOutBuffer;
+	fftcorr::cmplx m_corrDecimSum;
+	int m_corrDecimCount;
+	std::atomic<quint64> m_corrDroppedSamples; //!< samples not passed to the correlator because of decimation (read by the web API thread)
 	MovingAverageUtil<double, double, 480> m_channelPowerAvg;
 
     BasebandSampleSink* m_sampleSink;
 
 	void setFilters(int sampleRate, float bandwidth, float lowCutoff);
-	void processOneSample(Complex& c, fftfilt::cmplx *sideband);
+	void processBlock();
+	void processCorrelation();
     int getActualSampleRate();
     void applySampleRate();
 
-	inline void feedOneSample(const fftfilt::cmplx& s, const fftfilt::cmplx& pll)
+	inline void pushSample(const fftfilt::cmplx& s)
 	{
-	    switch (m_settings.m_inputType)
-	    {
-	        case ChannelAnalyzerSettings::InputPLL:
-            {
-                if (m_settings.m_ssb & !m_usb) { // invert spectrum for LSB
-                    m_sampleBuffer.push_back(Sample(pll.imag()*SDR_RX_SCALEF, pll.real()*SDR_RX_SCALEF));
-                } else {
-                    m_sampleBuffer.push_back(Sample(pll.real()*SDR_RX_SCALEF, pll.imag()*SDR_RX_SCALEF));
-                }
-            }
-	            break;
-	        case ChannelAnalyzerSettings::InputAutoCorr:
-	        {
-                std::complex<float> a = m_corr->run(s/SDR_RX_SCALEF, 0);
-
-                if (m_settings.m_ssb & !m_usb) { // invert spectrum for LSB
-                    m_sampleBuffer.push_back(Sample(a.imag(), a.real()));
-                } else {
-                    m_sampleBuffer.push_back(Sample(a.real(), a.imag()));
-                }
-	        }
-	            break;
-            case ChannelAnalyzerSettings::InputSignal:
-            default:
-            {
-                if (m_settings.m_ssb & !m_usb) { // invert spectrum for LSB
-                    m_sampleBuffer.push_back(Sample(s.imag(), s.real()));
-                } else {
-                    m_sampleBuffer.push_back(Sample(s.real(), s.imag()));
-                }
-            }
-                break;
-	    }
+        if (m_settings.m_ssb & !m_usb) { // invert spectrum for LSB
+            m_sampleBuffer.push_back(Sample(s.imag(), s.real()));
+        } else {
+            m_sampleBuffer.push_back(Sample(s.real(), s.imag()));
+        }
 	}
 };
 
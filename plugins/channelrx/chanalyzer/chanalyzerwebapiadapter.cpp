@@ -59,6 +59,7 @@ void ChannelAnalyzerWebAPIAdapter::webapiFormatChannelSettings(
     response.getChannelAnalyzerSettings()->setRrcRolloff(settings.m_rrcRolloff);
     response.getChannelAnalyzerSettings()->setPllPskOrder(settings.m_pllPskOrder);
     response.getChannelAnalyzerSettings()->setInputType((int) settings.m_inputType);
+    response.getChannelAnalyzerSettings()->setCorrLog2Decim(settings.m_corrLog2Decim);
     response.getChannelAnalyzerSettings()->setRgbColor(settings.m_rgbColor);
     response.getChannelAnalyzerSettings()->setTitle(new QString(settings.m_title));
 
@@ -168,6 +169,9 @@ void ChannelAnalyzerWebAPIAdapter::webapiUpdateChannelSettings(
     if (channelSettingsKeys.contains("bandwidth")) {
         settings.m_bandwidth = response.getChannelAnalyzerSettings()->getBandwidth();
     }
+    if (channelSettingsKeys.contains("corrLog2Decim")) {
+        settings.m_corrLog2Decim = response.getChannelAnalyzerSettings()->getCorrLog2Decim();
+    }
     if (channelSettingsKeys.contains("downSample")) {
         settings.m_rationalDownSample = response.getChannelAnalyzerSettings()->getDownSample() != 0;
     }
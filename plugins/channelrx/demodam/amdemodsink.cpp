@@ -20,6 +20,7 @@
 #include <complex.h>
 
 #include "audio/audiooutput.h"
+#include "dsp/dspengine.h"
 #include "dsp/fftfilt.h"
 #include "util/db.h"
 #include "util/stepfunctions.h"
@@ -65,13 +66,58 @@ AMDemodSink::~AMDemodSink()
 }
 
 void AMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+	if (!m_idleGate.feed(begin, end, m_squelchOpen)) // idle: channel power only
+	{
+		m_magsqSum += m_idleGate.getMagsqSum();
+		m_magsqCount += m_idleGate.getMagsqCount();
+		m_magsq = m_idleGate.getMagsqCount() > 0 ? m_idleGate.getMagsqSum() / m_idleGate.getMagsqCount() : 0.0;
+
+		if (m_idleGate.getMagsqPeak() > m_magsqPeak) {
+			m_magsqPeak = m_idleGate.getMagsqPeak();
+		}
+
+		return;
+	}
+
+	const SampleVector& preroll = m_idleGate.getPreroll();
+
+	if (preroll.size() > 0) {
+		processSamples(preroll.begin(), preroll.end());
+	}
+
+	processSamples(begin, end);
+
+	if (m_audioBufferFill > 0)
+	{
+		uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
+
+		if (res != m_audioBufferFill) {
+			qDebug("AMDemodSink::feed: %u/%u tail samples written", res, m_audioBufferFill);
+		}
+
+		m_audioBufferFill = 0;
+	}
+}
+
+void AMDemodSink::processSamples(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
 	Complex ci;
+	int nbSamples = end - begin;
+
+	if (nbSamples == 0) {
+		return;
+	}
 
-	for (SampleVector::const_iterator it = begin; it != end; ++it)
+	if ((int) m_mixBuffer.size() < nbSamples) {
+		m_mixBuffer.resize(nbSamples);
+	}
+
+	m_nco.mixIQBlock(&(*begin), m_mixBuffer.data(), nbSamples); // shift to channel center
+
+	for (int i = 0; i < nbSamples; i++)
 	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+		Complex& c = m_mixBuffer[i];
 
 		if (m_interpolatorDistance < 1.0f) // interpolate
 		{
@@ -90,17 +136,6 @@ void AMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVe
 	        }
 		}
 	}
-
-	if (m_audioBufferFill > 0)
-	{
-		uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
-
-		if (res != m_audioBufferFill) {
-			qDebug("AMDemodSink::feed: %u/%u tail samples written", res, m_audioBufferFill);
-		}
-
-		m_audioBufferFill = 0;
-	}
 }
 
 void AMDemodSink::processOneSample(Complex &ci)
@@ -242,6 +277,7 @@ void AMDemodSink::applyChannelSettings(int channelSampleRate, int channelFrequen
         m_interpolatorDistance = (Real) channelSampleRate / (Real) m_audioSampleRate;
     }
 
+    m_idleGate.setSampleRate(channelSampleRate);
     m_channelSampleRate = channelSampleRate;
     m_channelFrequencyOffset = channelFrequencyOffset;
 }
@@ -271,8 +307,10 @@ void AMDemodSink::applySettings(const AMDemodSettings& settings, bool force)
         DSBFilter->create_dsb_filter((2.0f * settings.m_rfBandwidth) / (float) m_audioSampleRate);
     }
 
-    if ((m_settings.m_squelch != settings.m_squelch) || force) {
+    if ((m_settings.m_squelch != settings.m_squelch) || force)
+    {
         m_squelchLevel = CalcDb::powerFromdB(settings.m_squelch);
+        m_idleGate.setThreshold(DSPEngine::instance()->getChannelIdle() ? m_squelchLevel : 0.0);
     }
 
     if ((m_settings.m_pll != settings.m_pll) || force)
@@ -25,6 +25,7 @@
 #include "dsp/bandpass.h"
 #include "dsp/lowpass.h"
 #include "dsp/phaselockcomplex.h"
+#include "dsp/channelidlegate.h"
 #include "audio/audiofifo.h"
 #include "util/movingaverage.h"
 #include "util/doublebufferfifo.h"
@@ -121,6 +122,10 @@ private:
 	AudioFifo m_audioFifo;
 	uint32_t m_audioBufferFill;
 
+    ChannelIdleGate m_idleGate;
+    std::vector<Complex> m_mixBuffer; //!< channel samples shifted by the NCO
+
+    void processSamples(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
     void processOneSample(Complex &ci);
 };
 
@@ -20,6 +20,7 @@
 
 #include <stdio.h>
 #include <complex.h>
+#include <algorithm>
 
 #include "audio/audiooutput.h"
 
@@ -94,7 +95,13 @@ void ATVDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
             c *= m_nco.nextIQ();
         }
 
-        demod(c);
+        m_lineBuffer.push_back(c);
+
+        if ((int) m_lineBuffer.size() >= m_samplesPerLine) // process by blocks of one line length
+        {
+            demodLine(m_lineBuffer.data(), m_lineBuffer.size());
+            m_lineBuffer.clear();
+        }
     }
 
     if ((m_videoTabIndex == 1) && (m_scopeSink)) // do only if scope tab is selected and scope is available
@@ -104,164 +111,250 @@ void ATVDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
     }
 }
 
-void ATVDemodSink::demod(Complex& c)
+void ATVDemodSink::demodLine(const Complex *in, int nbSamples)
 {
-    float sampleNormI;
-    float sampleNormQ;
-    float sampleNorm;
-    float sample;
-    int sampleVideo;
+    if ((int) m_demodBuffer.size() < nbSamples)
+    {
+        m_filterBuffer.resize(nbSamples);
+        m_magSqBuffer.resize(nbSamples);
+        m_normIBuffer.resize(nbSamples + m_fmHistory);
+        m_normQBuffer.resize(nbSamples + m_fmHistory);
+        m_demodBuffer.resize(nbSamples);
+        m_videoBuffer.resize(nbSamples);
+    }
 
     //********** FFT filtering **********
 
+    const Complex *iq = in;
+
     if (m_settings.m_fftFiltering)
     {
-        int n_out;
-        Complex *filtered;
-
-        n_out = m_DSBFilter->runAsym(c, &filtered, m_settings.m_atvModulation != ATVDemodSettings::ATV_LSB); // all usb except explicitely lsb
+        bool usb = m_settings.m_atvModulation != ATVDemodSettings::ATV_LSB; // all usb except explicitely lsb
 
-        if (n_out > 0)
+        for (int i = 0; i < nbSamples; i++)
         {
-            std::copy(filtered, filtered + n_out, m_DSBFilterBuffer);
-            m_DSBFilterBufferIndex = 0;
+            Complex *filtered;
+            int n_out = m_DSBFilter->runAsym(in[i], &filtered, usb);
+
+            if (n_out > 0)
+            {
+                std::copy(filtered, filtered + n_out, m_DSBFilterBuffer);
+                m_DSBFilterBufferIndex = 0;
+            }
+            else if (m_DSBFilterBufferIndex < m_ssbFftLen - 1) // safe
+            {
+                m_DSBFilterBufferIndex++;
+            }
+
+            m_filterBuffer[i] = m_DSBFilterBuffer[m_DSBFilterBufferIndex];
         }
-        else if (m_DSBFilterBufferIndex < m_ssbFftLen - 1) // safe
-        {
-            m_DSBFilterBufferIndex++;
+
+        if (m_settings.m_atvModulation != ATVDemodSettings::ATV_FM3) { // FM3 works on the unfiltered signal
+            iq = m_filterBuffer.data();
         }
     }
 
     //********** demodulation **********
 
-    float fftScale = 1.0f;
-    const float& fltI = m_settings.m_fftFiltering ? m_DSBFilterBuffer[m_DSBFilterBufferIndex].real() : c.real();
-    const float& fltQ = m_settings.m_fftFiltering ? m_DSBFilterBuffer[m_DSBFilterBufferIndex].imag() : c.imag();
-    double magSq;
+    float *magSq = m_magSqBuffer.data();
+    float *demod = m_demodBuffer.data();
+
+    for (int i = 0; i < nbSamples; i++) {
+        magSq[i] = iq[i].real()*iq[i].real() + iq[i].imag()*iq[i].imag();
+    }
+
+    for (int i = 0; i < nbSamples; i++) {
+        m_magSqAverage(magSq[i]);
+    }
 
     if ((m_settings.m_atvModulation == ATVDemodSettings::ATV_FM1) || (m_settings.m_atvModulation == ATVDemodSettings::ATV_FM2))
     {
-        //Amplitude FM
-        magSq = fltI*fltI + fltQ*fltQ;
-        m_magSqAverage(magSq);
-        sampleNorm = sqrt(magSq);
-        sampleNormI = fltI/sampleNorm;
-        sampleNormQ = fltQ/sampleNorm;
+        demodFMDiff(iq, nbSamples);
+    }
+    else if (m_settings.m_atvModulation == ATVDemodSettings::ATV_AM)
+    {
+        //Amplitude AM
+        for (int i = 0; i < nbSamples; i++) {
+            demod[i] = std::sqrt(magSq[i]) / SDR_RX_SCALEF;
+        }
 
-        //-2 > 2 : 0 -> 1 volt
-        //0->0.3 synchro  0.3->1 image
+        for (int i = 0; i < nbSamples; i++)
+        {
+            m_ampAverage(demod[i]);
+            demod[i] = demod[i] / (2.0f * m_ampAverage.asFloat()); // AGC
+        }
+    }
+    else if ((m_settings.m_atvModulation == ATVDemodSettings::ATV_USB) || (m_settings.m_atvModulation == ATVDemodSettings::ATV_LSB))
+    {
+        bool usb = m_settings.m_atvModulation == ATVDemodSettings::ATV_USB;
 
-        if (m_settings.m_atvModulation == ATVDemodSettings::ATV_FM1)
+        for (int i = 0; i < nbSamples; i++)
         {
-            //YDiff Cd
-            sample = m_fltBufferI[0]*(sampleNormQ - m_fltBufferQ[1]);
-            sample -= m_fltBufferQ[0]*(sampleNormI - m_fltBufferI[1]);
+            Real bfoValues[2];
+            float fltI = iq[i].real();
+            float fltQ = iq[i].imag();
+            float fltFiltered = m_bfoFilter.run(fltI);
+            m_bfoPLL.process(fltFiltered, bfoValues);
 
-            sample += 2.0f;
-            sample /= 4.0f;
+            // do the mix
 
+            float mixI = fltI * bfoValues[0] - fltQ * bfoValues[1];
+            float mixQ = fltI * bfoValues[1] + fltQ * bfoValues[0];
+            demod[i] = usb ? mixI + mixQ : mixI - mixQ;
         }
-        else
-        {
-            //YDiff Folded
-            sample =  m_fltBufferI[2]*((m_fltBufferQ[5]-sampleNormQ)/16.0f + m_fltBufferQ[1] - m_fltBufferQ[3]);
-            sample -= m_fltBufferQ[2]*((m_fltBufferI[5]-sampleNormI)/16.0f + m_fltBufferI[1] - m_fltBufferI[3]);
-
-            sample += 2.125f;
-            sample /= 4.25f;
+    }
+    else if (m_settings.m_atvModulation == ATVDemodSettings::ATV_FM3)
+    {
+        m_objPhaseDiscri.phaseDiscriminatorBlock(iq, demod, nbSamples);
 
-            m_fltBufferI[5] = m_fltBufferI[4];
-            m_fltBufferQ[5] = m_fltBufferQ[4];
+        for (int i = 0; i < nbSamples; i++) {
+            demod[i] += 0.5f;
+        }
+    }
+    else
+    {
+        std::fill(demod, demod + nbSamples, 0.0f);
+    }
 
-            m_fltBufferI[4] = m_fltBufferI[3];
-            m_fltBufferQ[4] = m_fltBufferQ[3];
+    //********** AM sample normalization and coarse scale estimation **********
 
-            m_fltBufferI[3] = m_fltBufferI[2];
-            m_fltBufferQ[3] = m_fltBufferQ[2];
+    if ((m_settings.m_atvModulation == ATVDemodSettings::ATV_AM)
+        || (m_settings.m_atvModulation == ATVDemodSettings::ATV_USB)
+        || (m_settings.m_atvModulation == ATVDemodSettings::ATV_LSB))
+    {
+        normalizeAM(nbSamples);
+    }
 
-            m_fltBufferI[2] = m_fltBufferI[1];
-            m_fltBufferQ[2] = m_fltBufferQ[1];
-        }
+    //********** gray level **********
 
-        m_fltBufferI[1] = m_fltBufferI[0];
-        m_fltBufferQ[1] = m_fltBufferQ[0];
+    const float levelBlack = m_settings.m_levelBlack;
+    const float rangeCorrection = m_sampleRangeCorrection;
+    const bool invert = m_settings.m_invertVideo;
+    int *video = m_videoBuffer.data();
 
-        m_fltBufferI[0] = sampleNormI;
-        m_fltBufferQ[0] = sampleNormQ;
+    for (int i = 0; i < nbSamples; i++)
+    {
+        float sample = invert ? 1.0f - demod[i] : demod[i];
+        // 0.0 -> 1.0
+        sample = (sample < 0.0f) ? 0.0f : (sample > 1.0f) ? 1.0f : sample;
+        demod[i] = sample;
+        // -0.3 -> 0.7 / 0.7
+        int sampleVideo = (int) ((sample - levelBlack) * rangeCorrection);
+        // 0 -> 255
+        video[i] = (sampleVideo < 0) ? 0 : (sampleVideo > 255) ? 255 : sampleVideo;
+    }
 
-        if (m_settings.m_fmDeviation != 1.0f)
-        {
-            sample = ((sample - 0.5f) / m_settings.m_fmDeviation) + 0.5f;
+    if ((m_videoTabIndex == 1) && (m_scopeSink != 0)) // feed scope buffer only if scope is present and visible
+    {
+        for (int i = 0; i < nbSamples; i++) {
+            m_scopeSampleBuffer.push_back(Sample(demod[i] * (SDR_RX_SCALEF - 1.0f), 0.0f));
         }
     }
-    else if (m_settings.m_atvModulation == ATVDemodSettings::ATV_AM)
+
+    //********** process video samples **********
+
+    if (m_registeredTVScreen) // can process only if the screen is available (set via the GUI)
     {
-        //Amplitude AM
-        magSq = fltI*fltI + fltQ*fltQ;
-        m_magSqAverage(magSq);
-        sampleNorm = sqrt(magSq);
-        float sampleRaw = sampleNorm / SDR_RX_SCALEF;
-        m_ampAverage(sampleRaw);
-        sample = sampleRaw / (2.0f * m_ampAverage.asFloat()); // AGC
+        processVideo(nbSamples);
     }
-    else if ((m_settings.m_atvModulation == ATVDemodSettings::ATV_USB) || (m_settings.m_atvModulation == ATVDemodSettings::ATV_LSB))
-    {
-        magSq = fltI*fltI + fltQ*fltQ;
-        m_magSqAverage(magSq);
-        sampleNorm = sqrt(magSq);
+}
 
-        Real bfoValues[2];
-        float fltFiltered = m_bfoFilter.run(fltI);
-        m_bfoPLL.process(fltFiltered, bfoValues);
+void ATVDemodSink::demodFMDiff(const Complex *iq, int nbSamples)
+{
+    // Normalized samples are stored after the history of the last m_fmHistory samples
+    // so that the differentiators can be computed without branches
+    const float *magSq = m_magSqBuffer.data();
+    float *nI = m_normIBuffer.data();
+    float *nQ = m_normQBuffer.data();
+    float *demod = m_demodBuffer.data();
+
+    for (int m = 0; m < m_fmHistory; m++)
+    {
+        nI[m_fmHistory - 1 - m] = m_fltBufferI[m];
+        nQ[m_fmHistory - 1 - m] = m_fltBufferQ[m];
+    }
 
-        // do the mix
+    for (int i = 0; i < nbSamples; i++)
+    {
+        float sampleNorm = std::sqrt(magSq[i]);
+        nI[i + m_fmHistory] = iq[i].real() / sampleNorm;
+        nQ[i + m_fmHistory] = iq[i].imag() / sampleNorm;
+    }
 
-        float mixI = fltI * bfoValues[0] - fltQ * bfoValues[1];
-        float mixQ = fltI * bfoValues[1] + fltQ * bfoValues[0];
+    //-2 > 2 : 0 -> 1 volt
+    //0->0.3 synchro  0.3->1 image
 
-        if (m_settings.m_atvModulation == ATVDemodSettings::ATV_USB) {
-            sample = (mixI + mixQ);
-        } else {
-            sample = (mixI - mixQ);
-        }
-    }
-    else if (m_settings.m_atvModulation == ATVDemodSettings::ATV_FM3)
+    if (m_settings.m_atvModulation == ATVDemodSettings::ATV_FM1)
     {
-        float rawDeviation;
-        sample = m_objPhaseDiscri.phaseDiscriminatorDelta(c, magSq, rawDeviation) + 0.5f;
-        m_magSqAverage(magSq);
-        sampleNorm = sqrt(magSq);
+        //YDiff Cd
+        for (int i = 0, j = m_fmHistory; i < nbSamples; i++, j++)
+        {
+            float sample = nI[j-1]*(nQ[j] - nQ[j-2]) - nQ[j-1]*(nI[j] - nI[j-2]);
+            demod[i] = (sample + 2.0f) / 4.0f;
+        }
     }
     else
     {
-        magSq = fltI*fltI + fltQ*fltQ;
-        m_magSqAverage(magSq);
-        sampleNorm = sqrt(magSq);
-        sample = 0.0f;
+        //YDiff Folded
+        for (int i = 0, j = m_fmHistory; i < nbSamples; i++, j++)
+        {
+            float sample = nI[j-3]*((nQ[j-6] - nQ[j])/16.0f + nQ[j-2] - nQ[j-4]);
+            sample -= nQ[j-3]*((nI[j-6] - nI[j])/16.0f + nI[j-2] - nI[j-4]);
+            demod[i] = (sample + 2.125f) / 4.25f;
+        }
     }
 
-    //********** AM sample normalization and coarse scale estimation **********
+    for (int m = 0; m < m_fmHistory; m++)
+    {
+        m_fltBufferI[m] = nI[nbSamples + m_fmHistory - 1 - m];
+        m_fltBufferQ[m] = nQ[nbSamples + m_fmHistory - 1 - m];
+    }
 
-    if ((m_settings.m_atvModulation == ATVDemodSettings::ATV_AM)
-        || (m_settings.m_atvModulation == ATVDemodSettings::ATV_USB)
-        || (m_settings.m_atvModulation == ATVDemodSettings::ATV_LSB))
+    if (m_settings.m_fmDeviation != 1.0f)
     {
-        // Mini and Maxi Amplitude tracking
+        const float fmDeviation = m_settings.m_fmDeviation;
 
-        if (sample < m_effMin) {
-            m_effMin = sample;
+        for (int i = 0; i < nbSamples; i++) {
+            demod[i] = ((demod[i] - 0.5f) / fmDeviation) + 0.5f;
         }
+    }
+}
 
-        if (sample > m_effMax) {
-            m_effMax = sample;
-        }
+void ATVDemodSink::normalizeAM(int nbSamples)
+{
+    float *samples = m_demodBuffer.data();
+    const int period = m_samplesPerLine * m_settings.m_nbLines * 2; // calculate on two full images
+    int i = 0;
+
+    while (i < nbSamples)
+    {
+        // Mini and Maxi Amplitude tracking up to the end of the estimation period
+        int chunk = std::min(nbSamples - i, std::max(0, period - m_amSampleIndex));
+        float effMin = m_effMin;
+        float effMax = m_effMax;
 
-        if (m_amSampleIndex < m_samplesPerLine * m_settings.m_nbLines * 2) // calculate on two full images
+        for (int k = i; k < i + chunk; k++)
         {
-            m_amSampleIndex++;
+            effMin = samples[k] < effMin ? samples[k] : effMin;
+            effMax = samples[k] > effMax ? samples[k] : effMax;
         }
-        else
+
+        m_effMin = effMin;
+        m_effMax = effMax;
+
+        //Normalisation of current samples
+        for (int k = i; k < i + chunk; k++) {
+            samples[k] = (samples[k] - m_ampMin) / m_ampDelta;
+        }
+
+        m_amSampleIndex += chunk;
+        i += chunk;
+
+        if (i < nbSamples) // sample closing the estimation period
         {
+            m_effMin = samples[i] < m_effMin ? samples[i] : m_effMin;
+            m_effMax = samples[i] > m_effMax ? samples[i] : m_effMax;
+
             // scale signal based on extrema on the estimation period
             m_ampMin = m_effMin;
             m_ampMax = m_effMax;
@@ -275,40 +368,111 @@ void ATVDemodSink::demod(Complex& c)
             m_ampDelta /= m_settings.m_amScalingFactor / 100.0f;
             m_ampMin += m_ampDelta * (m_settings.m_amOffsetFactor / 100.0f);
 
-            // qDebug("ATVDemod::demod: m_ampMin: %f m_ampMax: %f m_ampDelta: %f", m_ampMin, m_ampMax, m_ampDelta);
+            // qDebug("ATVDemod::normalizeAM: m_ampMin: %f m_ampMax: %f m_ampDelta: %f", m_ampMin, m_ampMax, m_ampDelta);
 
             //Reset extrema
             m_effMin = 20.0f;
             m_effMax = -20.0f;
 
             m_amSampleIndex = 0;
-        }
 
-        //Normalisation of current sample
-        sample -= m_ampMin;
-        sample /= m_ampDelta;
+            samples[i] = (samples[i] - m_ampMin) / m_ampDelta;
+            i++;
+        }
     }
+}
 
-    sample = m_settings.m_invertVideo ? 1.0f - sample : sample;
-    // 0.0 -> 1.0
-    sample = (sample < 0.0f) ? 0.0f : (sample > 1.0f) ? 1.0f : sample;
+void ATVDemodSink::processVideo(int nbSamples)
+{
+    const float *samples = m_demodBuffer.data();
+    const int *videos = m_videoBuffer.data();
+    const int hSyncLimit = m_samplesPerLine - m_numberSamplesPerHTop; // minimum distance between two horizontal syncs
+    int i0 = 0;
 
-    if ((m_videoTabIndex == 1) && (m_scopeSink != 0)) { // feed scope buffer only if scope is present and visible
-        m_scopeSampleBuffer.push_back(Sample(sample * (SDR_RX_SCALEF - 1.0f), 0.0f));
-    }
+    // The block is processed by segments ending at most at the end of the current line
+    while (i0 < nbSamples)
+    {
+        const int offset = m_sampleOffset;
+        const int length = std::min(nbSamples - i0, std::max(1, m_samplesPerLine - offset));
+        const float *s = &samples[i0];
 
-    //********** gray level **********
-    // -0.3 -> 0.7 / 0.7
-    sampleVideo = (int) ((sample - m_settings.m_levelBlack) * m_sampleRangeCorrection);
+        // Filling pixels on the current line - reference index 0 at start of sync pulse
+        m_tvScreenBuffer->setSampleValues(offset - m_numberSamplesPerHSync, &videos[i0], length);
 
-    // 0 -> 255
-    sampleVideo = (sampleVideo < 0) ? 0 : (sampleVideo > 255) ? 255 : sampleVideo;
+        if (m_settings.m_hSync)
+        {
+            // Horizontal Synchro detection
+            int lastDetected = -1;
+            int i = std::max(0, hSyncLimit - m_sampleOffsetDetected + 1);
+
+            while ((i = findHSync(s, i, length, prevSample)) < length) // horizontal synchro detected
+            {
+                float sampleBefore = i == 0 ? prevSample : s[i-1];
+                float sampleOffsetDetectedFrac =
+                    (s[i] - m_settings.m_levelSynchroTop) / (sampleBefore - s[i]);
+                float hSyncShift = -(offset + i) - m_sampleOffsetFrac - sampleOffsetDetectedFrac;
+
+                if (hSyncShift > m_samplesPerLine / 2) {
+                    hSyncShift -= m_samplesPerLine;
+                } else if (hSyncShift < -m_samplesPerLine / 2) {
+                    hSyncShift += m_samplesPerLine;
+                }
+
+                if (fabs(hSyncShift) > m_numberSamplesPerHTop)
+                {
+                    m_hSyncErrorCount++;
+
+                    if (m_hSyncErrorCount >= 4)
+                    {
+                        // Fast sync: shift is too large, needs to be fixed ASAP
+                        m_hSyncShift = hSyncShift;
+                        m_hSyncErrorCount = 0;
+                    }
+                }
+                else
+                {
+                    // Slow sync: slight adjustment is needed
+                    m_hSyncShift = hSyncShift * 0.2f;
+                    m_hSyncErrorCount = 0;
+                }
+
+                lastDetected = i;
+                i += hSyncLimit + 2; // next detection cannot occur before
+            }
 
-    //********** process video sample **********
+            m_sampleOffsetDetected = lastDetected < 0 ? m_sampleOffsetDetected + length : length - 1 - lastDetected;
+        }
 
-    if (m_registeredTVScreen) // can process only if the screen is available (set via the GUI)
-    {
-        processSample(sample, sampleVideo);
+        if (m_settings.m_vSync)
+        {
+            m_fieldDetectSampleCount += countSynchroTop(s,
+                std::max(0, m_fieldDetectStartPos - offset),
+                std::min(length, m_fieldDetectEndPos - offset - 1));
+            m_vSyncDetectSampleCount += countSynchroTop(s,
+                std::max(0, m_vSyncDetectStartPos - offset),
+                std::min(length, m_vSyncDetectEndPos - offset - 1));
+        }
+
+        m_sampleOffset += length;
+        prevSample = s[length - 1];
+        i0 += length;
+
+        // end of line
+        if (m_sampleOffset >= m_samplesPerLine)
+        {
+            float sampleOffsetFloat = m_hSyncShift + m_sampleOffsetFrac - m_samplesPerLineFrac;
+            m_sampleOffset = sampleOffsetFloat;
+            m_sampleOffsetFrac = sampleOffsetFloat - m_sampleOffset;
+            m_hSyncShift = 0.0f;
+
+            m_lineIndex++;
+
+            if (m_settings.m_atvStd == ATVDemodSettings::ATVStdHSkip) {
+                processEOLHSkip();
+            } else {
+                processEOLClassic();
+            }
+        }
     }
 }
 
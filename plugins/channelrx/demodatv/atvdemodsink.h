@@ -19,6 +19,7 @@
 #define INCLUDE_ATVDEMODSINK_H
 
 #include <QElapsedTimer>
+#include <algorithm>
 #include <vector>
 #include <memory>
 
@@ -184,77 +185,74 @@ private:
     // Used for FM
     PhaseDiscriminators m_objPhaseDiscri;
 
-    void demod(Complex& c);
+    //*************** LINE BUFFERS  ***************
+
+    std::vector<Complex> m_lineBuffer;   //!< channel samples accumulated up to one line length
+    std::vector<Complex> m_filterBuffer; //!< FFT filtered samples of the line
+    std::vector<float> m_magSqBuffer;
+    std::vector<float> m_normIBuffer;    //!< normalized I with FM differentiators history in front
+    std::vector<float> m_normQBuffer;    //!< normalized Q with FM differentiators history in front
+    std::vector<float> m_demodBuffer;    //!< demodulated samples (0.0 -> 1.0)
+    std::vector<int> m_videoBuffer;      //!< gray levels (0 -> 255)
+    static const int m_fmHistory = 6;
+
+    void demodLine(const Complex *in, int nbSamples);
+    void demodFMDiff(const Complex *iq, int nbSamples);
+    void normalizeAM(int nbSamples);
+    void processVideo(int nbSamples);
     void applyStandard(int sampleRate, ATVDemodSettings::ATVStd atvStd, float lineDuration);
 
-    inline void processSample(float& sample, int& sampleVideo)
+    /**
+     * Search first horizontal synchronization falling edge in [start, end[ of samples.
+     * prev is the sample preceding samples[0]. Returns end if not found.
+     * Done by chunks so that the threshold test can be vectorized.
+     */
+    inline int findHSync(const float *samples, int start, int end, float prev) const
     {
-        // Filling pixel on the current line - reference index 0 at start of sync pulse
-		m_tvScreenBuffer->setSampleValue(m_sampleOffset - m_numberSamplesPerHSync, sampleVideo);
+        const float top = m_settings.m_levelSynchroTop;
+
+        if ((start == 0) && (start < end))
+        {
+            if ((prev >= top) && (samples[0] < top)) {
+                return 0;
+            }
 
-        if (m_settings.m_hSync)
+            start = 1;
+        }
+
+        for (int i0 = start; i0 < end; i0 += 16)
         {
-            // Horizontal Synchro detection
-            if ((prevSample >= m_settings.m_levelSynchroTop &&
-                sample < m_settings.m_levelSynchroTop) // horizontal synchro detected
-                && (m_sampleOffsetDetected > m_samplesPerLine - m_numberSamplesPerHTop))
+            int i1 = std::min(i0 + 16, end);
+            int hit = 0;
+
+            for (int i = i0; i < i1; i++) {
+                hit |= (samples[i-1] >= top) & (samples[i] < top);
+            }
+
+            if (hit)
             {
-                float sampleOffsetDetectedFrac =
-                    (sample - m_settings.m_levelSynchroTop) / (prevSample - sample);
-                float hSyncShift = -m_sampleOffset - m_sampleOffsetFrac - sampleOffsetDetectedFrac;
-                if (hSyncShift > m_samplesPerLine / 2)
-					hSyncShift -= m_samplesPerLine;
-                else if (hSyncShift < -m_samplesPerLine / 2)
-					hSyncShift += m_samplesPerLine;
-
-                if (fabs(hSyncShift) > m_numberSamplesPerHTop)
+                for (int i = i0; i < i1; i++)
                 {
-                    m_hSyncErrorCount++;
-                    if (m_hSyncErrorCount >= 4)
-                    {
-                        // Fast sync: shift is too large, needs to be fixed ASAP
-						m_hSyncShift = hSyncShift;
-                        m_hSyncErrorCount = 0;
+                    if ((samples[i-1] >= top) && (samples[i] < top)) {
+                        return i;
                     }
                 }
-                else
-                {
-					// Slow sync: slight adjustment is needed
-					m_hSyncShift = hSyncShift * 0.2f;
-                    m_hSyncErrorCount = 0;
-                }
-				m_sampleOffsetDetected = 0;
             }
-            else
-				m_sampleOffsetDetected++;
         }
-		m_sampleOffset++;
 
-        if (m_settings.m_vSync)
-        {
-            if (m_sampleOffset > m_fieldDetectStartPos && m_sampleOffset < m_fieldDetectEndPos)
-                m_fieldDetectSampleCount += sample < m_settings.m_levelSynchroTop;
-            if (m_sampleOffset > m_vSyncDetectStartPos && m_sampleOffset < m_vSyncDetectEndPos)
-                m_vSyncDetectSampleCount += sample < m_settings.m_levelSynchroTop;
-        }
+        return end;
+    }
 
-        // end of line
-        if (m_sampleOffset >= m_samplesPerLine)
-        {
-            float sampleOffsetFloat = m_hSyncShift + m_sampleOffsetFrac - m_samplesPerLineFrac;
-            m_sampleOffset = sampleOffsetFloat;
-            m_sampleOffsetFrac = sampleOffsetFloat - m_sampleOffset;
-			m_hSyncShift = 0.0f;
-
-			m_lineIndex++;
-			if (m_settings.m_atvStd == ATVDemodSettings::ATVStdHSkip) {
-                processEOLHSkip();
-            } else {
-                processEOLClassic();
-            }
+    inline int countSynchroTop(const float *samples, int start, int end) const
+    {
+        const float top = m_settings.m_levelSynchroTop;
+        int count = 0;
+
+        for (int i = start; i < end; i++) {
+            count += samples[i] < top;
         }
 
-        prevSample = sample;
+        return count;
     }
 
     // Standard vertical sync
@@ -30,6 +30,7 @@
 #include "SWGChannelReport.h"
 #include "SWGBFMDemodReport.h"
 #include "SWGRDSReport.h"
+#include "SWGRDSScanStation.h"
 
 #include "dsp/dspengine.h"
 #include "dsp/dspcommands.h"
@@ -37,6 +38,7 @@
 #include "device/deviceapi.h"
 #include "util/db.h"
 
+#include "rdstmc.h"
 #include "bfmdemod.h"
 
 MESSAGE_CLASS_DEFINITION(BFMDemod::MsgConfigureBFMDemod, Message)
@@ -148,6 +150,11 @@ void BFMDemod::applySettings(const BFMDemodSettings& settings, bool force)
             << " m_lsbStereo: " << settings.m_lsbStereo
             << " m_showPilot: " << settings.m_showPilot
             << " m_rdsActive: " << settings.m_rdsActive
+            << " m_rdsOnly: " << settings.m_rdsOnly
+            << " m_rdsScanner: " << settings.m_rdsScanner
+            << " m_rdsScanThreshold: " << settings.m_rdsScanThreshold
+            << " m_rdsScanMaxStations: " << settings.m_rdsScanMaxStations
+            << " m_rdsScanThreads: " << settings.m_rdsScanThreads
             << " m_audioDeviceName: " << settings.m_audioDeviceName
             << " m_streamIndex: " << settings.m_streamIndex
             << " m_useReverseAPI: " << settings.m_useReverseAPI
@@ -173,6 +180,21 @@ void BFMDemod::applySettings(const BFMDemodSettings& settings, bool force)
     if ((settings.m_rdsActive != m_settings.m_rdsActive) || force) {
         reverseAPIKeys.append("rdsActive");
     }
+    if ((settings.m_rdsOnly != m_settings.m_rdsOnly) || force) {
+        reverseAPIKeys.append("rdsOnly");
+    }
+    if ((settings.m_rdsScanner != m_settings.m_rdsScanner) || force) {
+        reverseAPIKeys.append("rdsScanner");
+    }
+    if ((settings.m_rdsScanThreshold != m_settings.m_rdsScanThreshold) || force) {
+        reverseAPIKeys.append("rdsScanThreshold");
+    }
+    if ((settings.m_rdsScanMaxStations != m_settings.m_rdsScanMaxStations) || force) {
+        reverseAPIKeys.append("rdsScanMaxStations");
+    }
+    if ((settings.m_rdsScanThreads != m_settings.m_rdsScanThreads) || force) {
+        reverseAPIKeys.append("rdsScanThreads");
+    }
     if ((settings.m_afBandwidth != m_settings.m_afBandwidth) || force) {
         reverseAPIKeys.append("afBandwidth");
     }
@@ -305,6 +327,21 @@ void BFMDemod::webapiUpdateChannelSettings(
     if (channelSettingsKeys.contains("rdsActive")) {
         settings.m_rdsActive = response.getBfmDemodSettings()->getRdsActive() != 0;
     }
+    if (channelSettingsKeys.contains("rdsOnly")) {
+        settings.m_rdsOnly = response.getBfmDemodSettings()->getRdsOnly() != 0;
+    }
+    if (channelSettingsKeys.contains("rdsScanner")) {
+        settings.m_rdsScanner = response.getBfmDemodSettings()->getRdsScanner() != 0;
+    }
+    if (channelSettingsKeys.contains("rdsScanThreshold")) {
+        settings.m_rdsScanThreshold = response.getBfmDemodSettings()->getRdsScanThreshold();
+    }
+    if (channelSettingsKeys.contains("rdsScanMaxStations")) {
+        settings.m_rdsScanMaxStations = response.getBfmDemodSettings()->getRdsScanMaxStations();
+    }
+    if (channelSettingsKeys.contains("rdsScanThreads")) {
+        settings.m_rdsScanThreads = response.getBfmDemodSettings()->getRdsScanThreads();
+    }
     if (channelSettingsKeys.contains("rgbColor")) {
         settings.m_rgbColor = response.getBfmDemodSettings()->getRgbColor();
     }
@@ -356,6 +393,11 @@ void BFMDemod::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& resp
     response.getBfmDemodSettings()->setLsbStereo(settings.m_lsbStereo ? 1 : 0);
     response.getBfmDemodSettings()->setShowPilot(settings.m_showPilot ? 1 : 0);
     response.getBfmDemodSettings()->setRdsActive(settings.m_rdsActive ? 1 : 0);
+    response.getBfmDemodSettings()->setRdsOnly(settings.m_rdsOnly ? 1 : 0);
+    response.getBfmDemodSettings()->setRdsScanner(settings.m_rdsScanner ? 1 : 0);
+    response.getBfmDemodSettings()->setRdsScanThreshold(settings.m_rdsScanThreshold);
+    response.getBfmDemodSettings()->setRdsScanMaxStations(settings.m_rdsScanMaxStations);
+    response.getBfmDemodSettings()->setRdsScanThreads(settings.m_rdsScanThreads);
     response.getBfmDemodSettings()->setRgbColor(settings.m_rgbColor);
 
     if (response.getBfmDemodSettings()->getTitle()) {
@@ -397,7 +439,7 @@ void BFMDemod::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response
     response.getBfmDemodReport()->setPilotLocked(getPilotLock() ? 1 : 0);
     response.getBfmDemodReport()->setPilotPowerDb(CalcDb::dbPower(getPilotLevel()));
 
-    if (m_settings.m_rdsActive)
+    if (m_settings.m_rdsActive || m_settings.m_rdsOnly)
     {
         response.getBfmDemodReport()->setRdsReport(new SWGSDRangel::SWGRDSReport());
         webapiFormatRDSReport(response.getBfmDemodReport()->getRdsReport());
@@ -406,27 +448,67 @@ void BFMDemod::webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response
     {
         response.getBfmDemodReport()->setRdsReport(0);
     }
+
+    if (m_settings.m_rdsScanner)
+    {
+        response.getBfmDemodReport()->setRdsScanStations(new QList<SWGSDRangel::SWGRDSScanStation*>);
+        webapiFormatRDSScanStations(response.getBfmDemodReport()->getRdsScanStations());
+    }
 }
 
 void BFMDemod::webapiFormatRDSReport(SWGSDRangel::SWGRDSReport *report)
 {
-    report->setDemodStatus(round(getDemodQua()));
-    report->setDecodStatus(round(getDecoderQua()));
-    report->setRdsDemodAccumDb(CalcDb::dbPower(std::fabs(getDemodAcc())));
-    report->setRdsDemodFrequency(getDemodFclk());
-    report->setPid(new QString(str(boost::format("%04X") % getRDSParser().m_pi_program_identification).c_str()));
-    report->setPiType(new QString(getRDSParser().pty_table[getRDSParser().m_pi_program_type].c_str()));
-    report->setPiCoverage(new QString(getRDSParser().coverage_area_codes[getRDSParser().m_pi_area_coverage_index].c_str()));
-    report->setProgServiceName(new QString(getRDSParser().m_g0_program_service_name));
-    report->setMusicSpeech(new QString((getRDSParser().m_g0_music_speech ? "Music" : "Speech")));
-    report->setMonoStereo(new QString((getRDSParser().m_g0_mono_stereo ? "Mono" : "Stereo")));
-    report->setRadioText(new QString(getRDSParser().m_g2_radiotext));
+    webapiFormatRDSReport(report, getRDSParser(), getDemodQua(), getDecoderQua(), getDemodAcc(), getDemodFclk());
+}
+
+void BFMDemod::webapiFormatRDSScanStations(QList<SWGSDRangel::SWGRDSScanStation*> *stations)
+{
+    std::vector<RDSScanner::StationReport> stationReports;
+    m_basebandSink->getRDSScanner().getStationReports(stationReports);
+
+    for (const auto& stationReport : stationReports)
+    {
+        stations->append(new SWGSDRangel::SWGRDSScanStation);
+        stations->back()->setFrequency(stationReport.m_frequency);
+        stations->back()->setPowerDb(stationReport.m_powerDb);
+        stations->back()->setSynced(stationReport.m_synced ? 1 : 0);
+        stations->back()->setRdsReport(new SWGSDRangel::SWGRDSReport());
+        webapiFormatRDSReport(
+            stations->back()->getRdsReport(),
+            stationReport.m_rdsParser,
+            stationReport.m_demodQua,
+            stationReport.m_decoderQua,
+            stationReport.m_demodAcc,
+            stationReport.m_demodFclk
+        );
+    }
+}
+
+void BFMDemod::webapiFormatRDSReport(
+    SWGSDRangel::SWGRDSReport *report,
+    const RDSParser& rdsParser,
+    Real demodQua,
+    Real decoderQua,
+    Real demodAcc,
+    Real demodFclk)
+{
+    report->setDemodStatus(round(demodQua));
+    report->setDecodStatus(round(decoderQua));
+    report->setRdsDemodAccumDb(CalcDb::dbPower(std::fabs(demodAcc)));
+    report->setRdsDemodFrequency(demodFclk);
+    report->setPid(new QString(str(boost::format("%04X") % rdsParser.m_pi_program_identification).c_str()));
+    report->setPiType(new QString(rdsParser.pty_table[rdsParser.m_pi_program_type].c_str()));
+    report->setPiCoverage(new QString(rdsParser.coverage_area_codes[rdsParser.m_pi_area_coverage_index].c_str()));
+    report->setProgServiceName(new QString(rdsParser.m_g0_program_service_name));
+    report->setMusicSpeech(new QString((rdsParser.m_g0_music_speech ? "Music" : "Speech")));
+    report->setMonoStereo(new QString((rdsParser.m_g0_mono_stereo ? "Mono" : "Stereo")));
+    report->setRadioText(new QString(rdsParser.m_g2_radiotext));
     std::string time = str(boost::format("%4i-%02i-%02i %02i:%02i (%+.1fh)")\
-        % (1900 + getRDSParser().m_g4_year) % getRDSParser().m_g4_month % getRDSParser().m_g4_day % getRDSParser().m_g4_hours % getRDSParser().m_g4_minutes % getRDSParser().m_g4_local_time_offset);
+        % (1900 + rdsParser.m_g4_year) % rdsParser.m_g4_month % rdsParser.m_g4_day % rdsParser.m_g4_hours % rdsParser.m_g4_minutes % rdsParser.m_g4_local_time_offset);
     report->setTime(new QString(time.c_str()));
     report->setAltFrequencies(new QList<SWGSDRangel::SWGRDSReport_altFrequencies*>);
 
-    for (std::set<double>::iterator it = getRDSParser().m_g0_alt_freq.begin(); it != getRDSParser().m_g0_alt_freq.end(); ++it)
+    for (std::set<double>::const_iterator it = rdsParser.m_g0_alt_freq.begin(); it != rdsParser.m_g0_alt_freq.end(); ++it)
     {
         if (*it > 76.0)
         {
@@ -434,6 +516,14 @@ void BFMDemod::webapiFormatRDSReport(SWGSDRangel::SWGRDSReport *report)
             report->getAltFrequencies()->back()->setFrequency(*it);
         }
     }
+
+    if (rdsParser.m_g8_count > 0)
+    {
+        int eventLine = RDSTMC::get_tmc_event_code_index(rdsParser.m_g8_event, 1);
+        report->setTmcEvent(new QString(RDSTMC::get_tmc_events(eventLine, 1).c_str()));
+        report->setTmcLocation(new QString(str(boost::format("%04X") % rdsParser.m_g8_location).c_str()));
+        report->setTmcExtent(new QString(str(boost::format("%s%u") % (rdsParser.m_g8_sign ? "-" : "+") % (rdsParser.m_g8_extent + 1)).c_str()));
+    }
 }
 
 void BFMDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const BFMDemodSettings& settings, bool force)
@@ -475,6 +565,21 @@ void BFMDemod::webapiReverseSendSettings(QList<QString>& channelSettingsKeys, co
     if (channelSettingsKeys.contains("rdsActive") || force) {
         swgBFMDemodSettings->setRdsActive(settings.m_rdsActive ? 1 : 0);
     }
+    if (channelSettingsKeys.contains("rdsOnly") || force) {
+        swgBFMDemodSettings->setRdsOnly(settings.m_rdsOnly ? 1 : 0);
+    }
+    if (channelSettingsKeys.contains("rdsScanner") || force) {
+        swgBFMDemodSettings->setRdsScanner(settings.m_rdsScanner ? 1 : 0);
+    }
+    if (channelSettingsKeys.contains("rdsScanThreshold") || force) {
+        swgBFMDemodSettings->setRdsScanThreshold(settings.m_rdsScanThreshold);
+    }
+    if (channelSettingsKeys.contains("rdsScanMaxStations") || force) {
+        swgBFMDemodSettings->setRdsScanMaxStations(settings.m_rdsScanMaxStations);
+    }
+    if (channelSettingsKeys.contains("rdsScanThreads") || force) {
+        swgBFMDemodSettings->setRdsScanThreads(settings.m_rdsScanThreads);
+    }
     if (channelSettingsKeys.contains("rgbColor") || force) {
         swgBFMDemodSettings->setRgbColor(settings.m_rgbColor);
     }
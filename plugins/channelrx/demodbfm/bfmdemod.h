@@ -39,6 +39,7 @@ class DeviceAPI;
 
 namespace SWGSDRangel {
     class SWGRDSReport;
+    class SWGRDSScanStation;
 }
 
 class BFMDemod : public BasebandSampleSink, public ChannelAPI {
@@ -156,6 +157,15 @@ private:
 
     void webapiFormatChannelReport(SWGSDRangel::SWGChannelReport& response);
     void webapiFormatRDSReport(SWGSDRangel::SWGRDSReport *report);
+    void webapiFormatRDSScanStations(QList<SWGSDRangel::SWGRDSScanStation*> *stations);
+    static void webapiFormatRDSReport(
+        SWGSDRangel::SWGRDSReport *report,
+        const RDSParser& rdsParser,
+        Real demodQua,
+        Real decoderQua,
+        Real demodAcc,
+        Real demodFclk
+    );
     void webapiReverseSendSettings(QList<QString>& channelSettingsKeys, const BFMDemodSettings& settings, bool force);
 
 private slots:
@@ -81,11 +81,19 @@ void BFMDemodBaseband::handleData()
 		// first part of FIFO data
         if (part1begin != part1end) {
             m_channelizer->feed(part1begin, part1end);
+
+            if (m_settings.m_rdsScanner) {
+                m_rdsScanner.feed(part1begin, part1end);
+            }
         }
 
 		// second part of FIFO data (used when block wraps around)
 		if(part2begin != part2end) {
             m_channelizer->feed(part2begin, part2end);
+
+            if (m_settings.m_rdsScanner) {
+                m_rdsScanner.feed(part2begin, part2end);
+            }
         }
 
 		m_sampleFifo.readCommit((unsigned int) count);
@@ -125,6 +133,7 @@ bool BFMDemodBaseband::handleMessage(const Message& cmd)
         m_channelizer->setBasebandSampleRate(notif.getSampleRate());
         m_sink.applyChannelSettings(m_channelizer->getChannelSampleRate(), m_channelizer->getChannelFrequencyOffset());
         m_sink.applyAudioSampleRate(m_sink.getAudioSampleRate()); // reapply in case of channel sample rate change
+        m_rdsScanner.applyBasebandSampleRate(notif.getSampleRate(), notif.getCenterFrequency());
 
         if (getMessageQueueToGUI())
         {
@@ -170,6 +179,20 @@ void BFMDemodBaseband::applySettings(const BFMDemodSettings& settings, bool forc
         }
     }
 
+    if ((settings.m_rdsScanner != m_settings.m_rdsScanner)
+     || (settings.m_rdsScanThreshold != m_settings.m_rdsScanThreshold)
+     || (settings.m_rdsScanMaxStations != m_settings.m_rdsScanMaxStations)
+     || (settings.m_rdsScanThreads != m_settings.m_rdsScanThreads) || force)
+    {
+        m_rdsScanner.applySettings(
+            settings.m_rdsScanner,
+            settings.m_rdsScanThreshold,
+            settings.m_rdsScanMaxStations,
+            settings.m_rdsScanThreads,
+            force
+        );
+    }
+
     m_sink.applySettings(settings, force);
 
     m_settings = settings;
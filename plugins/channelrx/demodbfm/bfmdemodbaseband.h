@@ -26,6 +26,7 @@
 #include "util/messagequeue.h"
 
 #include "bfmdemodsink.h"
+#include "rdsscanner.h"
 
 class DownChannelizer;
 
@@ -78,11 +79,13 @@ public:
 	Real getDemodFclk() const { return m_sink.getDemodFclk(); }
     void getMagSqLevels(double& avg, double& peak, int& nbSamples) { m_sink.getMagSqLevels(avg, peak, nbSamples); }
     RDSParser& getRDSParser() { return m_sink.getRDSParser(); }
+    RDSScanner& getRDSScanner() { return m_rdsScanner; }
 
 private:
     SampleSinkFifo m_sampleFifo;
     DownChannelizer *m_channelizer;
     BFMDemodSink m_sink;
+    RDSScanner m_rdsScanner;
 	MessageQueue m_inputMessageQueue; //!< Queue for asynchronous inbound communication
     BFMDemodSettings m_settings;
     QMutex m_mutex;
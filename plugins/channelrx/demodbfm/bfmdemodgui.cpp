@@ -225,6 +225,12 @@ void BFMDemodGUI::on_rds_clicked()
 	applySettings();
 }
 
+void BFMDemodGUI::on_rdsOnly_clicked()
+{
+    m_settings.m_rdsOnly = ui->rdsOnly->isChecked();
+	applySettings();
+}
+
 void BFMDemodGUI::on_clearData_clicked(bool checked)
 {
     (void) checked;
@@ -493,6 +499,7 @@ void BFMDemodGUI::displaySettings()
     ui->lsbStereo->setChecked(m_settings.m_lsbStereo);
     ui->showPilot->setChecked(m_settings.m_showPilot);
     ui->rds->setChecked(m_settings.m_rdsActive);
+    ui->rdsOnly->setChecked(m_settings.m_rdsOnly);
 
     displayStreamIndex();
 
@@ -571,7 +578,7 @@ void BFMDemodGUI::tick()
         }
     }
 
-	if (ui->rds->isChecked() && (m_rdsTimerCount == 0))
+	if ((ui->rds->isChecked() || ui->rdsOnly->isChecked()) && (m_rdsTimerCount == 0))
 	{
 		rdsUpdate(false);
 	}
@@ -100,6 +100,7 @@ private slots:
 	void on_lsbStereo_toggled(bool lsb);
 	void on_showPilot_clicked();
 	void on_rds_clicked();
+	void on_rdsOnly_clicked();
 	void on_g14ProgServiceNames_currentIndexChanged(int index);
 	void on_clearData_clicked(bool checked);
 	void on_g00AltFrequenciesBox_activated(int index);
@@ -46,6 +46,11 @@ void BFMDemodSettings::resetToDefaults()
     m_lsbStereo = false;
     m_showPilot = false;
     m_rdsActive = false;
+    m_rdsOnly = false;
+    m_rdsScanner = false;
+    m_rdsScanThreshold = 10.0f;
+    m_rdsScanMaxStations = 32;
+    m_rdsScanThreads = 2;
     m_rgbColor = QColor(80, 120, 228).rgb();
     m_title = "Broadcast FM Demod";
     m_audioDeviceName = AudioDeviceManager::m_defaultDeviceName;
@@ -86,6 +91,11 @@ QByteArray BFMDemodSettings::serialize() const
     s.writeU32(17, m_reverseAPIDeviceIndex);
     s.writeU32(18, m_reverseAPIChannelIndex);
     s.writeS32(19, m_streamIndex);
+    s.writeBool(20, m_rdsOnly);
+    s.writeBool(21, m_rdsScanner);
+    s.writeReal(22, m_rdsScanThreshold);
+    s.writeS32(23, m_rdsScanMaxStations);
+    s.writeS32(24, m_rdsScanThreads);
 
     return s.final();
 }
@@ -151,6 +161,11 @@ bool BFMDemodSettings::deserialize(const QByteArray& data)
         d.readU32(18, &utmp, 0);
         m_reverseAPIChannelIndex = utmp > 99 ? 99 : utmp;
         d.readS32(19, &m_streamIndex, 0);
+        d.readBool(20, &m_rdsOnly, false);
+        d.readBool(21, &m_rdsScanner, false);
+        d.readReal(22, &m_rdsScanThreshold, 10.0f);
+        d.readS32(23, &m_rdsScanMaxStations, 32);
+        d.readS32(24, &m_rdsScanThreads, 2);
 
         return true;
     }
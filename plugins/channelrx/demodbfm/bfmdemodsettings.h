@@ -33,6 +33,11 @@ struct BFMDemodSettings
     bool m_lsbStereo;
     bool m_showPilot;
     bool m_rdsActive;
+    bool m_rdsOnly;   //!< RDS decoding only: skip audio and spectrum generation (band monitoring)
+    bool m_rdsScanner;           //!< Scan the whole baseband for RDS stations
+    Real m_rdsScanThreshold;     //!< Station detection threshold above noise floor (dB)
+    int m_rdsScanMaxStations;    //!< Maximum number of stations decoded simultaneously
+    int m_rdsScanThreads;        //!< Number of threads used to decode the stations (1 to number of cores)
     quint32 m_rgbColor;
     QString m_title;
     QString m_audioDeviceName;
@@ -66,6 +66,10 @@ BFMDemodSink::BFMDemodSink() :
     m_spectrumSink = nullptr;
     m_m1Arg = 0;
 
+    for (int i = 0; i < 4; i++) {
+        m_pilotPLLSamples[i] = 0;
+    }
+
     m_rfFilter = new fftfilt(-50000.0 / 384000.0, 50000.0 / 384000.0, filtFftLen);
 
 	m_deemphasisFilterX.configure(default_deemphasis * m_audioSampleRate * 1.0e-6);
@@ -74,6 +78,8 @@ BFMDemodSink::BFMDemodSink() :
 
 	m_audioBuffer.resize(16384);
 	m_audioBufferFill = 0;
+	m_rfBuffer.reserve(filtFftLen);
+	m_demodBuffer.resize(filtFftLen);
 
 	applySettings(m_settings, true);
     applyChannelSettings(m_channelSampleRate, m_channelFrequencyOffset, true);
@@ -86,13 +92,11 @@ BFMDemodSink::~BFMDemodSink()
 
 void BFMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
-	Complex ci, cs, cr;
 	fftfilt::cmplx *rf;
 	int rf_out;
-	double msq;
-	Real demod;
 
 	m_sampleBuffer.clear();
+	m_rfBuffer.clear();
 
 	for (SampleVector::const_iterator it = begin; it != end; ++it)
 	{
@@ -101,150 +105,204 @@ void BFMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
 
 		rf_out = m_rfFilter->runFilt(c, &rf); // filter RF before demod
 
-		for (int i =0 ; i  <rf_out; i++)
-		{
-			msq = rf[i].real()*rf[i].real() + rf[i].imag()*rf[i].imag();
-            m_magsqSum += msq;
+		if (rf_out > 0) {
+			m_rfBuffer.insert(m_rfBuffer.end(), rf, rf + rf_out);
+		}
+	}
+
+	if (m_rfBuffer.size() > 0) {
+		processBlock();
+	}
 
-            if (msq > m_magsqPeak) {
-                m_magsqPeak = msq;
-            }
+	if (m_audioBufferFill > 0)
+	{
+		uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
 
-            m_magsqCount++;
+		if (res != m_audioBufferFill) {
+			qDebug("BFMDemodSink::feed: %u/%u tail samples written", res, m_audioBufferFill);
+		}
 
-			if (msq >= m_squelchLevel)
-			{
-			    if (m_squelchState < m_settings.m_rfBandwidth / 10) { // twice attack and decay rate
-			        m_squelchState++;
-			    }
+		m_audioBufferFill = 0;
+	}
+
+	if (m_spectrumSink && !m_settings.m_rdsOnly) {
+		m_spectrumSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end(), true);
+	}
+
+	m_sampleBuffer.clear();
+}
+
+void BFMDemodSink::processBlock()
+{
+	int nbSamples = m_rfBuffer.size();
+
+	if ((int) m_demodBuffer.size() < nbSamples) {
+		m_demodBuffer.resize(nbSamples);
+	}
+
+	// discriminate the whole block then gate with squelch
+	m_phaseDiscri.phaseDiscriminatorBlock(m_rfBuffer.data(), m_demodBuffer.data(), nbSamples);
+
+	for (int i = 0; i < nbSamples; i++)
+	{
+		const Complex& rf = m_rfBuffer[i];
+		double msq = rf.real()*rf.real() + rf.imag()*rf.imag();
+		m_magsqSum += msq;
+
+		if (msq > m_magsqPeak) {
+			m_magsqPeak = msq;
+		}
+
+		if (msq >= m_squelchLevel)
+		{
+			if (m_squelchState < m_settings.m_rfBandwidth / 10) { // twice attack and decay rate
+				m_squelchState++;
 			}
-			else
-			{
-			    if (m_squelchState > 0) {
-			        m_squelchState--;
-			    }
+		}
+		else
+		{
+			if (m_squelchState > 0) {
+				m_squelchState--;
 			}
+		}
 
-			if (m_squelchState > m_settings.m_rfBandwidth / 20) { // squelch open
-				demod = m_phaseDiscri.phaseDiscriminator(rf[i]);
-			} else {
-				demod = 0;
-			}
+		if (m_squelchState <= m_settings.m_rfBandwidth / 20) { // squelch closed
+			m_demodBuffer[i] = 0;
+		}
+	}
 
-			if (!m_settings.m_showPilot) {
-				m_sampleBuffer.push_back(Sample(demod * SDR_RX_SCALEF, 0.0));
-			}
+	m_magsqCount += nbSamples;
 
-			if (m_settings.m_rdsActive)
-			{
-				//Complex r(demod * 2.0 * std::cos(3.0 * m_pilotPLLSamples[3]), 0.0);
-				Complex r(demod * 2.0 * std::cos(3.0 * m_pilotPLLSamples[3]), 0.0);
+	if (m_settings.m_rdsOnly) {
+		processRDSOnly(nbSamples);
+	} else {
+		processAudio(nbSamples);
+	}
+}
 
-				if (m_interpolatorRDS.decimate(&m_interpolatorRDSDistanceRemain, r, &cr))
-				{
-					bool bit;
+void BFMDemodSink::processRDS(Real demod)
+{
+	Complex cr;
+	Complex r(demod * 2.0 * std::cos(3.0 * m_pilotPLLSamples[3]), 0.0);
 
-					if (m_rdsDemod.process(cr.real(), bit))
-					{
-						if (m_rdsDecoder.frameSync(bit)) {
-						    m_rdsParser.parseGroup(m_rdsDecoder.getGroup());
-						}
-					}
+	if (m_interpolatorRDS.decimate(&m_interpolatorRDSDistanceRemain, r, &cr))
+	{
+		bool bit;
 
-					m_interpolatorRDSDistanceRemain += m_interpolatorRDSDistance;
-				}
+		if (m_rdsDemod.process(cr.real(), bit))
+		{
+			if (m_rdsDecoder.frameSync(bit)) {
+				m_rdsParser.parseGroup(m_rdsDecoder.getGroup());
 			}
+		}
 
-			Real sampleStereo = 0.0f;
+		m_interpolatorRDSDistanceRemain += m_interpolatorRDSDistance;
+	}
+}
 
-			// Process stereo if stereo mode is selected
+void BFMDemodSink::processRDSOnly(int nbSamples)
+{
+	// Only the pilot PLL for the 57 kHz subcarrier reference and the RDS chain are run
+	for (int i = 0; i < nbSamples; i++)
+	{
+		Real demod = m_demodBuffer[i];
+		processRDS(demod);
+		m_pilotPLL.process(demod, m_pilotPLLSamples);
+	}
+}
 
-			if (m_settings.m_audioStereo)
-			{
-				m_pilotPLL.process(demod, m_pilotPLLSamples);
+void BFMDemodSink::processAudio(int nbSamples)
+{
+	Complex ci, cs;
 
-				if (m_settings.m_showPilot) {
-					m_sampleBuffer.push_back(Sample(m_pilotPLLSamples[1] * SDR_RX_SCALEF, 0.0)); // debug 38 kHz pilot
-				}
+	for (int i = 0; i < nbSamples; i++)
+	{
+		Real demod = m_demodBuffer[i];
 
-				if (m_settings.m_lsbStereo)
-				{
-					// 1.17 * 0.7 = 0.819
-					Complex s(demod * m_pilotPLLSamples[1], demod * m_pilotPLLSamples[2]);
-
-					if (m_interpolatorStereo.decimate(&m_interpolatorStereoDistanceRemain, s, &cs))
-					{
-						sampleStereo = cs.real() + cs.imag();
-						m_interpolatorStereoDistanceRemain += m_interpolatorStereoDistance;
-					}
-				}
-				else
-				{
-					Complex s(demod * 1.17 * m_pilotPLLSamples[1], 0);
+		if (!m_settings.m_showPilot) {
+			m_sampleBuffer.push_back(Sample(demod * SDR_RX_SCALEF, 0.0));
+		}
 
-					if (m_interpolatorStereo.decimate(&m_interpolatorStereoDistanceRemain, s, &cs))
-					{
-						sampleStereo = cs.real();
-						m_interpolatorStereoDistanceRemain += m_interpolatorStereoDistance;
-					}
-				}
-			}
+		if (m_settings.m_rdsActive) {
+			processRDS(demod);
+		}
 
-			Complex e(demod, 0);
+		Real sampleStereo = 0.0f;
 
-			if (m_interpolator.decimate(&m_interpolatorDistanceRemain, e, &ci))
+		// Process stereo if stereo mode is selected
+
+		if (m_settings.m_audioStereo)
+		{
+			m_pilotPLL.process(demod, m_pilotPLLSamples);
+
+			if (m_settings.m_showPilot) {
+				m_sampleBuffer.push_back(Sample(m_pilotPLLSamples[1] * SDR_RX_SCALEF, 0.0)); // debug 38 kHz pilot
+			}
+
+			if (m_settings.m_lsbStereo)
 			{
-				if (m_settings.m_audioStereo)
+				// 1.17 * 0.7 = 0.819
+				Complex s(demod * m_pilotPLLSamples[1], demod * m_pilotPLLSamples[2]);
+
+				if (m_interpolatorStereo.decimate(&m_interpolatorStereoDistanceRemain, s, &cs))
 				{
-					Real deemph_l, deemph_r; // Pre-emphasis is applied on each channel before multiplexing
-					m_deemphasisFilterX.process(ci.real() + sampleStereo, deemph_l);
-					m_deemphasisFilterY.process(ci.real() - sampleStereo, deemph_r);
-                    m_audioBuffer[m_audioBufferFill].l = (qint16)(deemph_l * (1<<12) * m_settings.m_volume);
-                    m_audioBuffer[m_audioBufferFill].r = (qint16)(deemph_r * (1<<12) * m_settings.m_volume);
+					sampleStereo = cs.real() + cs.imag();
+					m_interpolatorStereoDistanceRemain += m_interpolatorStereoDistance;
 				}
-				else
+			}
+			else
+			{
+				Complex s(demod * 1.17 * m_pilotPLLSamples[1], 0);
+
+				if (m_interpolatorStereo.decimate(&m_interpolatorStereoDistanceRemain, s, &cs))
 				{
-					Real deemph;
-					m_deemphasisFilterX.process(ci.real(), deemph);
-					quint16 sample = (qint16)(deemph * (1<<12) * m_settings.m_volume);
-					m_audioBuffer[m_audioBufferFill].l = sample;
-					m_audioBuffer[m_audioBufferFill].r = sample;
+					sampleStereo = cs.real();
+					m_interpolatorStereoDistanceRemain += m_interpolatorStereoDistance;
 				}
+			}
+		}
+		else if (m_settings.m_rdsActive)
+		{
+			m_pilotPLL.process(demod, m_pilotPLLSamples); // 57 kHz RDS reference is derived from the pilot
+		}
 
-				++m_audioBufferFill;
+		Complex e(demod, 0);
 
-				if (m_audioBufferFill >= m_audioBuffer.size())
-				{
-					uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
+		if (m_interpolator.decimate(&m_interpolatorDistanceRemain, e, &ci))
+		{
+			if (m_settings.m_audioStereo)
+			{
+				Real deemph_l, deemph_r; // Pre-emphasis is applied on each channel before multiplexing
+				m_deemphasisFilterX.process(ci.real() + sampleStereo, deemph_l);
+				m_deemphasisFilterY.process(ci.real() - sampleStereo, deemph_r);
+				m_audioBuffer[m_audioBufferFill].l = (qint16)(deemph_l * (1<<12) * m_settings.m_volume);
+				m_audioBuffer[m_audioBufferFill].r = (qint16)(deemph_r * (1<<12) * m_settings.m_volume);
+			}
+			else
+			{
+				Real deemph;
+				m_deemphasisFilterX.process(ci.real(), deemph);
+				quint16 sample = (qint16)(deemph * (1<<12) * m_settings.m_volume);
+				m_audioBuffer[m_audioBufferFill].l = sample;
+				m_audioBuffer[m_audioBufferFill].r = sample;
+			}
 
-					if(res != m_audioBufferFill) {
-						qDebug("BFMDemodSink::feed: %u/%u audio samples written", res, m_audioBufferFill);
-					}
+			++m_audioBufferFill;
+
+			if (m_audioBufferFill >= m_audioBuffer.size())
+			{
+				uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
 
-					m_audioBufferFill = 0;
+				if(res != m_audioBufferFill) {
+					qDebug("BFMDemodSink::processAudio: %u/%u audio samples written", res, m_audioBufferFill);
 				}
 
-				m_interpolatorDistanceRemain += m_interpolatorDistance;
+				m_audioBufferFill = 0;
 			}
-		}
-	}
 
-	if (m_audioBufferFill > 0)
-	{
-		uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
-
-		if (res != m_audioBufferFill) {
-			qDebug("BFMDemodSink::feed: %u/%u tail samples written", res, m_audioBufferFill);
+			m_interpolatorDistanceRemain += m_interpolatorDistance;
 		}
-
-		m_audioBufferFill = 0;
 	}
-
-	if (m_spectrumSink) {
-		m_spectrumSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end(), true);
-	}
-
-	m_sampleBuffer.clear();
 }
 
 void BFMDemodSink::applyAudioSampleRate(int sampleRate)
@@ -321,12 +379,16 @@ void BFMDemodSink::applySettings(const BFMDemodSettings& settings, bool force)
             << " m_lsbStereo: " << settings.m_lsbStereo
             << " m_showPilot: " << settings.m_showPilot
             << " m_rdsActive: " << settings.m_rdsActive
+            << " m_rdsOnly: " << settings.m_rdsOnly
             << " m_audioDeviceName: " << settings.m_audioDeviceName
             << " m_streamIndex: " << settings.m_streamIndex
             << " m_useReverseAPI: " << settings.m_useReverseAPI
             << " force: " << force;
 
-    if ((settings.m_audioStereo && (settings.m_audioStereo != m_settings.m_audioStereo)) || force) {
+    bool pllNeeded = settings.m_audioStereo || settings.m_rdsActive || settings.m_rdsOnly;
+    bool pllWasNeeded = m_settings.m_audioStereo || m_settings.m_rdsActive || m_settings.m_rdsOnly;
+
+    if ((pllNeeded && !pllWasNeeded) || force) {
         m_pilotPLL.configure(19000.0/m_channelSampleRate, 50.0/m_channelSampleRate, 0.01);
     }
 
@@ -111,6 +111,8 @@ private:
     uint m_audioBufferFill;
     AudioFifo m_audioFifo;
 	SampleVector m_sampleBuffer;
+	std::vector<Complex> m_rfBuffer;  //!< RF filtered samples of the current block
+	std::vector<Real> m_demodBuffer;  //!< Discriminator output of the current block
 
 	NCO m_nco;
 	Interpolator m_interpolator; //!< Interpolator between fixed demod bandwidth and audio bandwidth (rational)
@@ -157,6 +159,11 @@ private:
 	PhaseDiscriminators m_phaseDiscri;
 
     BasebandSampleSink *m_spectrumSink;
+
+    void processBlock();
+    void processRDS(Real demod);
+    void processRDSOnly(int nbSamples);
+    void processAudio(int nbSamples);
 };
 
 #endif // INCLUDE_BFMDEMODSINK_H
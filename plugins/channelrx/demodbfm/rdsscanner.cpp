@@ -0,0 +1,577 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+
+#include <QDebug>
+#include <QMutexLocker>
+#include <QThread>
+
+#include "dsp/dspengine.h"
+#include "dsp/fftfactory.h"
+#include "dsp/fftengine.h"
+#include "util/db.h"
+
+#include "rdsscanner.h"
+
+RDSScannerWorker::RDSScannerWorker(RDSScanner *scanner, int index) :
+    m_scanner(scanner),
+    m_index(index),
+    m_running(true),
+    m_batchId(scanner->m_batchId)
+{}
+
+void RDSScannerWorker::stopWork()
+{
+    QMutexLocker mutexLocker(&m_scanner->m_batchMutex);
+    m_running = false;
+    m_scanner->m_batchStart.wakeAll();
+}
+
+void RDSScannerWorker::run()
+{
+    m_scanner->m_batchMutex.lock();
+
+    while (true)
+    {
+        while (m_running && (m_scanner->m_batchId == m_batchId)) {
+            m_scanner->m_batchStart.wait(&m_scanner->m_batchMutex);
+        }
+
+        if (!m_running) {
+            break;
+        }
+
+        m_batchId = m_scanner->m_batchId;
+        int nbParts = m_scanner->m_workers.size() + 1;
+        m_scanner->m_batchMutex.unlock();
+
+        m_scanner->processStations(m_index, nbParts);
+
+        m_scanner->m_batchMutex.lock();
+
+        if (--m_scanner->m_pendingWorkers == 0) {
+            m_scanner->m_batchDone.wakeAll();
+        }
+    }
+
+    m_scanner->m_batchMutex.unlock();
+}
+
+RDSScanner::Station::Station(qint64 frequency, int centerBin, int outputSampleRate) :
+    m_frequency(frequency),
+    m_centerBin(centerBin),
+    m_power(0.0),
+    m_missCount(0),
+    m_pilotPLL(19000.0/outputSampleRate, 50.0/outputSampleRate, 0.01)
+{
+    m_phaseDiscri.reset();
+    m_phaseDiscri.setFMScaling(outputSampleRate / 750000.0f); // same scaling as BFMDemodSink
+
+    for (int i = 0; i < 4; i++) {
+        m_pilotPLLSamples[i] = 0;
+    }
+
+    m_interpolatorRDS.create(4, outputSampleRate, 600.0);
+    m_interpolatorRDSDistance = (Real) outputSampleRate / 250000.0;
+    m_interpolatorRDSDistanceRemain = m_interpolatorRDSDistance;
+}
+
+RDSScanner::RDSScanner() :
+    m_basebandSampleRate(0),
+    m_centerFrequency(0),
+    m_thresholdDb(10.0),
+    m_maxStations(32),
+    m_nbThreads(0),
+    m_fftSize(0),
+    m_stationFFTSize(m_stationFFTSizeDefault),
+    m_outputSampleRate(0),
+    m_fft(nullptr),
+    m_fftSequence(0),
+    m_overlapFill(0),
+    m_batchFill(0),
+    m_oddBlock(false),
+    m_psdCount(0),
+    m_batchId(0),
+    m_pendingWorkers(0)
+{}
+
+RDSScanner::~RDSScanner()
+{
+    stopWorkers();
+    releaseFFTs();
+    clearStations();
+}
+
+void RDSScanner::applyBasebandSampleRate(int sampleRate, qint64 centerFrequency)
+{
+    qDebug() << "RDSScanner::applyBasebandSampleRate:"
+        << " sampleRate: " << sampleRate
+        << " centerFrequency: " << centerFrequency;
+
+    if ((sampleRate != m_basebandSampleRate) || (centerFrequency != m_centerFrequency))
+    {
+        m_basebandSampleRate = sampleRate;
+        m_centerFrequency = centerFrequency;
+
+        if (m_nbThreads > 0) {
+            configure();
+        }
+    }
+}
+
+void RDSScanner::applySettings(bool enabled, Real thresholdDb, int maxStations, int nbThreads, bool force)
+{
+    qDebug() << "RDSScanner::applySettings:"
+        << " enabled: " << enabled
+        << " thresholdDb: " << thresholdDb
+        << " maxStations: " << maxStations
+        << " nbThreads: " << nbThreads
+        << " force: " << force;
+
+    // from 1 to the number of cores whatever the REST API or preset value
+    int maxThreads = std::max(1, QThread::idealThreadCount());
+    int threads = enabled ? std::max(1, std::min(nbThreads, maxThreads)) : 0;
+    m_thresholdDb = thresholdDb;
+    m_maxStations = maxStations < 1 ? 1 : maxStations;
+
+    if ((threads != m_nbThreads) || force)
+    {
+        m_nbThreads = threads;
+
+        if (m_nbThreads > 0) {
+            configure();
+        } else {
+            reset();
+        }
+    }
+}
+
+void RDSScanner::reset()
+{
+    stopWorkers();
+    releaseFFTs();
+    clearStations();
+    m_fftSize = 0;
+    m_overlapFill = 0;
+    m_batchFill = 0;
+    m_psdCount = 0;
+}
+
+void RDSScanner::configure()
+{
+    reset();
+
+    if (m_basebandSampleRate <= 0) {
+        return;
+    }
+
+    // Largest forward FFT size that keeps the station sample rate above 250 kS/s
+    int fftSize = m_stationFFTSize;
+
+    while ((qint64) (fftSize * 2) * 250000 <= (qint64) m_stationFFTSize * m_basebandSampleRate) {
+        fftSize *= 2;
+    }
+
+    if (fftSize < 2*m_stationFFTSize)
+    {
+        qWarning("RDSScanner::configure: baseband sample rate %d is too low for scanning", m_basebandSampleRate);
+        return;
+    }
+
+    m_fftSize = fftSize;
+    m_outputSampleRate = (int) (((qint64) m_basebandSampleRate * m_stationFFTSize) / m_fftSize);
+
+    qDebug("RDSScanner::configure: fftSize: %d stationFFTSize: %d outputSampleRate: %d threads: %d",
+        m_fftSize, m_stationFFTSize, m_outputSampleRate, m_nbThreads);
+
+    m_overlap.assign(m_fftSize, Complex{0.0f, 0.0f});
+    m_overlapFill = m_fftSize / 2;
+    m_spectra.resize(m_batchSize * m_fftSize);
+    m_oddBlocks.assign(m_batchSize, false);
+    m_batchFill = 0;
+    m_oddBlock = false;
+    m_psd.assign(m_fftSize, 0.0);
+    m_psdCount = 0;
+
+    // Flat up to +/- 100 kHz then raised cosine down to the station Nyquist frequency
+    int halfM = m_stationFFTSize / 2;
+    double binWidth = (double) m_basebandSampleRate / m_fftSize;
+    int passBins = std::min((int) (100000.0 / binWidth), (halfM * 4) / 5);
+    m_window.resize(m_stationFFTSize);
+
+    for (int j = 0; j < m_stationFFTSize; j++)
+    {
+        int k = std::abs(j < halfM ? j : j - m_stationFFTSize);
+
+        if (k <= passBins) {
+            m_window[j] = 1.0f;
+        } else {
+            m_window[j] = 0.5f + 0.5f * std::cos(M_PI * (k - passBins) / (double) (halfM - passBins));
+        }
+    }
+
+    allocateFFTs();
+    startWorkers();
+}
+
+void RDSScanner::allocateFFTs()
+{
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+    m_fftSequence = fftFactory->getEngine(m_fftSize, false, &m_fft);
+    m_invFFTs.resize(m_nbThreads);
+    m_invFFTSequences.resize(m_nbThreads);
+
+    for (int i = 0; i < m_nbThreads; i++) {
+        m_invFFTSequences[i] = fftFactory->getEngine(m_stationFFTSize, true, &m_invFFTs[i]);
+    }
+}
+
+void RDSScanner::releaseFFTs()
+{
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+
+    if (m_fft)
+    {
+        fftFactory->releaseEngine(m_fftSize, false, m_fftSequence);
+        m_fft = nullptr;
+    }
+
+    for (unsigned int i = 0; i < m_invFFTs.size(); i++) {
+        fftFactory->releaseEngine(m_stationFFTSize, true, m_invFFTSequences[i]);
+    }
+
+    m_invFFTs.clear();
+    m_invFFTSequences.clear();
+}
+
+void RDSScanner::startWorkers()
+{
+    // part 0 is processed by the calling (baseband) thread
+    for (int i = 1; i < m_nbThreads; i++) {
+        m_workers.push_back(new RDSScannerWorker(this, i));
+    }
+
+    for (auto worker : m_workers) {
+        worker->start();
+    }
+}
+
+void RDSScanner::stopWorkers()
+{
+    for (auto worker : m_workers)
+    {
+        worker->stopWork();
+        worker->wait();
+        delete worker;
+    }
+
+    m_workers.clear();
+}
+
+void RDSScanner::clearStations()
+{
+    QMutexLocker mutexLocker(&m_stationsMutex);
+
+    for (auto station : m_stations) {
+        delete station;
+    }
+
+    m_stations.clear();
+}
+
+void RDSScanner::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    if (!m_fft) {
+        return;
+    }
+
+    int halfN = m_fftSize / 2;
+
+    for (SampleVector::const_iterator it = begin; it != end; ++it)
+    {
+        m_overlap[m_overlapFill++] = Complex(it->real() / SDR_RX_SCALEF, it->imag() / SDR_RX_SCALEF);
+
+        if (m_overlapFill < m_fftSize) {
+            continue;
+        }
+
+        // overlap-save: half of the forward FFT is made of new samples
+        std::copy(m_overlap.begin(), m_overlap.end(), m_fft->in());
+        m_fft->transform();
+        const Complex *out = m_fft->out();
+        std::copy(out, out + m_fftSize, &m_spectra[m_batchFill * m_fftSize]);
+        m_oddBlocks[m_batchFill] = m_oddBlock;
+        m_oddBlock = !m_oddBlock;
+
+        for (int k = 0; k < m_fftSize; k++) {
+            m_psd[k] += out[k].real()*out[k].real() + out[k].imag()*out[k].imag();
+        }
+
+        m_psdCount++;
+        m_batchFill++;
+        std::copy(m_overlap.begin() + halfN, m_overlap.end(), m_overlap.begin());
+        m_overlapFill = halfN;
+
+        if (m_batchFill == m_batchSize)
+        {
+            processBatch();
+            m_batchFill = 0;
+        }
+
+        if ((qint64) m_psdCount * halfN >= m_basebandSampleRate / 2) { // update detection twice per second
+            detectStations();
+        }
+    }
+}
+
+void RDSScanner::processBatch()
+{
+    QMutexLocker mutexLocker(&m_stationsMutex);
+
+    if (m_stations.size() == 0) {
+        return;
+    }
+
+    if (m_workers.size() > 0)
+    {
+        m_batchMutex.lock();
+        m_pendingWorkers = m_workers.size();
+        m_batchId++;
+        m_batchStart.wakeAll();
+        m_batchMutex.unlock();
+    }
+
+    processStations(0, m_workers.size() + 1);
+
+    if (m_workers.size() > 0)
+    {
+        m_batchMutex.lock();
+
+        while (m_pendingWorkers > 0) {
+            m_batchDone.wait(&m_batchMutex);
+        }
+
+        m_batchMutex.unlock();
+    }
+}
+
+void RDSScanner::processStations(int part, int nbParts)
+{
+    for (unsigned int i = part; i < m_stations.size(); i += nbParts) {
+        processStation(m_stations[i], m_invFFTs[part]);
+    }
+}
+
+void RDSScanner::processStation(Station *station, FFTEngine *invFFT)
+{
+    int halfM = m_stationFFTSize / 2;
+    int nbSamples = m_batchFill * halfM;
+    int base = ((station->m_centerBin % m_fftSize) + m_fftSize) % m_fftSize;
+    int mask = m_fftSize - 1;
+    station->m_iq.resize(nbSamples);
+    station->m_demod.resize(nbSamples);
+
+    // Extract the station from the shared spectra
+    for (int b = 0; b < m_batchFill; b++)
+    {
+        const Complex *spectrum = &m_spectra[b * m_fftSize];
+        Complex *in = invFFT->in();
+
+        for (int j = 0; j < halfM; j++) {
+            in[j] = spectrum[(base + j) & mask] * m_window[j];
+        }
+
+        for (int j = halfM; j < m_stationFFTSize; j++) {
+            in[j] = spectrum[(base + j - m_stationFFTSize) & mask] * m_window[j];
+        }
+
+        invFFT->transform();
+        const Complex *out = invFFT->out();
+        // frequency shift by an odd number of bins inverts phase every other half block
+        Real sign = ((station->m_centerBin & 1) && m_oddBlocks[b]) ? -1.0f : 1.0f;
+        Complex *iq = &station->m_iq[b * halfM];
+
+        for (int n = 0; n < halfM; n++) {
+            iq[n] = out[halfM + n] * sign;
+        }
+    }
+
+    station->m_phaseDiscri.phaseDiscriminatorBlock(station->m_iq.data(), station->m_demod.data(), nbSamples);
+
+    for (int i = 0; i < nbSamples; i++)
+    {
+        Real demod = station->m_demod[i];
+        Complex cr;
+        Complex r(demod * 2.0 * std::cos(3.0 * station->m_pilotPLLSamples[3]), 0.0);
+
+        if (station->m_interpolatorRDS.decimate(&station->m_interpolatorRDSDistanceRemain, r, &cr))
+        {
+            bool bit;
+
+            if (station->m_rdsDemod.process(cr.real(), bit))
+            {
+                if (station->m_rdsDecoder.frameSync(bit)) {
+                    station->m_rdsParser.parseGroup(station->m_rdsDecoder.getGroup());
+                }
+            }
+
+            station->m_interpolatorRDSDistanceRemain += station->m_interpolatorRDSDistance;
+        }
+
+        station->m_pilotPLL.process(demod, station->m_pilotPLLSamples);
+    }
+}
+
+int RDSScanner::frequencyToBin(qint64 frequency) const
+{
+    return (int) std::round(((double) (frequency - m_centerFrequency) * m_fftSize) / m_basebandSampleRate);
+}
+
+double RDSScanner::binsPower(int centerBin, int halfWidth) const
+{
+    double power = 0.0;
+    int mask = m_fftSize - 1;
+
+    for (int k = centerBin - halfWidth; k <= centerBin + halfWidth; k++) {
+        power += m_psd[k & mask];
+    }
+
+    // Parseval: average power of the band in the time domain
+    return power / ((double) m_psdCount * m_fftSize * m_fftSize);
+}
+
+void RDSScanner::detectStations()
+{
+    struct Candidate
+    {
+        qint64 m_frequency;
+        double m_power;
+    };
+
+    std::vector<Candidate> candidates;
+    qint64 margin = m_outputSampleRate / 2;
+    qint64 fmin = m_centerFrequency - m_basebandSampleRate / 2 + margin;
+    qint64 fmax = m_centerFrequency + m_basebandSampleRate / 2 - margin;
+    int halfWidth = (int) (((qint64) m_stationHalfBW * m_fftSize) / m_basebandSampleRate);
+
+    for (qint64 f = ((fmin + m_rasterStep - 1) / m_rasterStep) * m_rasterStep; f <= fmax; f += m_rasterStep) {
+        candidates.push_back(Candidate{f, binsPower(frequencyToBin(f), halfWidth)});
+    }
+
+    std::fill(m_psd.begin(), m_psd.end(), 0.0);
+    m_psdCount = 0;
+
+    if (candidates.size() < 3) {
+        return;
+    }
+
+    // Noise floor estimate is the lower quartile of the raster powers
+    std::vector<double> powers;
+
+    for (const auto& candidate : candidates) {
+        powers.push_back(candidate.m_power);
+    }
+
+    std::nth_element(powers.begin(), powers.begin() + powers.size() / 4, powers.end());
+    double threshold = powers[powers.size() / 4] * std::pow(10.0, m_thresholdDb / 10.0);
+    std::vector<Candidate> selected;
+
+    for (unsigned int i = 0; i < candidates.size(); i++)
+    {
+        const Candidate& c = candidates[i];
+
+        if ((c.m_power > threshold)
+         && ((i == 0) || (c.m_power >= candidates[i-1].m_power))
+         && ((i == candidates.size() - 1) || (c.m_power >= candidates[i+1].m_power))) {
+            selected.push_back(c);
+        }
+    }
+
+    std::sort(selected.begin(), selected.end(), [](const Candidate& a, const Candidate& b) {
+        return a.m_power > b.m_power;
+    });
+
+    if ((int) selected.size() > m_maxStations) {
+        selected.resize(m_maxStations);
+    }
+
+    QMutexLocker mutexLocker(&m_stationsMutex);
+
+    for (auto it = m_stations.begin(); it != m_stations.end();)
+    {
+        auto sIt = std::find_if(selected.begin(), selected.end(), [it](const Candidate& c) {
+            return c.m_frequency == (*it)->m_frequency;
+        });
+
+        if (sIt != selected.end())
+        {
+            (*it)->m_missCount = 0;
+            (*it)->m_power = sIt->m_power;
+            selected.erase(sIt);
+            ++it;
+        }
+        else if (++(*it)->m_missCount > m_maxMissCount)
+        {
+            qDebug("RDSScanner::detectStations: remove station at %lld Hz", (*it)->m_frequency);
+            delete *it;
+            it = m_stations.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (const auto& candidate : selected)
+    {
+        if ((int) m_stations.size() >= m_maxStations) {
+            break;
+        }
+
+        qDebug("RDSScanner::detectStations: add station at %lld Hz", candidate.m_frequency);
+        m_stations.push_back(new Station(candidate.m_frequency, frequencyToBin(candidate.m_frequency), m_outputSampleRate));
+        m_stations.back()->m_power = candidate.m_power;
+    }
+}
+
+void RDSScanner::getStationReports(std::vector<StationReport>& reports)
+{
+    QMutexLocker mutexLocker(&m_stationsMutex);
+    reports.clear();
+
+    for (const auto station : m_stations)
+    {
+        reports.push_back(StationReport());
+        StationReport& report = reports.back();
+        report.m_frequency = station->m_frequency;
+        report.m_powerDb = CalcDb::dbPower(station->m_power);
+        report.m_synced = station->m_rdsDecoder.synced();
+        report.m_demodQua = station->m_rdsDemod.m_report.qua;
+        report.m_decoderQua = station->m_rdsDecoder.m_qua;
+        report.m_demodAcc = station->m_rdsDemod.m_report.acc;
+        report.m_demodFclk = station->m_rdsDemod.m_report.fclk;
+        report.m_rdsParser = station->m_rdsParser;
+    }
+}
+
+int RDSScanner::getNbStations()
+{
+    QMutexLocker mutexLocker(&m_stationsMutex);
+    return m_stations.size();
+}
@@ -0,0 +1,170 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLUGINS_CHANNELRX_DEMODBFM_RDSSCANNER_H_
+#define PLUGINS_CHANNELRX_DEMODBFM_RDSSCANNER_H_
+
+#include <vector>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+
+#include "dsp/dsptypes.h"
+#include "dsp/interpolator.h"
+#include "dsp/phaselock.h"
+#include "dsp/phasediscri.h"
+
+#include "rdsdemod.h"
+#include "rdsdecoder.h"
+#include "rdsparser.h"
+
+class FFTEngine;
+class RDSScanner;
+
+/**
+ * Worker thread of the RDS scanner. Processes a subset of the stations on each batch.
+ */
+class RDSScannerWorker : public QThread
+{
+public:
+    RDSScannerWorker(RDSScanner *scanner, int index);
+    void stopWork();
+
+protected:
+    virtual void run();
+
+private:
+    RDSScanner *m_scanner;
+    int m_index;
+    bool m_running;
+    unsigned int m_batchId; //!< last batch processed
+};
+
+/**
+ * Headless RDS scanner of the whole baseband.
+ *
+ * The baseband is channelized once with a fast convolution filter bank: one overlap-save
+ * forward FFT of the baseband is shared by all stations and each station is extracted
+ * with a small inverse FFT on the bins around its carrier. Stations are detected
+ * automatically on the 100 kHz raster from the averaged spectrum. Each station runs a
+ * lightweight chain (discriminator, pilot PLL and RDS demodulator, decoder and parser).
+ * Stations are spread over a pool of worker threads.
+ */
+class RDSScanner
+{
+public:
+    struct StationReport
+    {
+        qint64 m_frequency;
+        double m_powerDb;
+        bool m_synced;
+        Real m_demodQua;
+        Real m_decoderQua;
+        Real m_demodAcc;
+        Real m_demodFclk;
+        RDSParser m_rdsParser;
+    };
+
+    RDSScanner();
+    ~RDSScanner();
+
+    void feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    void applyBasebandSampleRate(int sampleRate, qint64 centerFrequency);
+    void applySettings(bool enabled, Real thresholdDb, int maxStations, int nbThreads, bool force = false);
+    void getStationReports(std::vector<StationReport>& reports);
+    int getNbStations();
+    void reset();
+
+private:
+    struct Station
+    {
+        Station(qint64 frequency, int centerBin, int outputSampleRate);
+
+        qint64 m_frequency;   //!< absolute carrier frequency (Hz)
+        int m_centerBin;      //!< signed index of the carrier bin in the forward FFT
+        double m_power;       //!< averaged power in the station bandwidth (linear)
+        int m_missCount;      //!< number of consecutive detections without this station
+        std::vector<Complex> m_iq;
+        std::vector<Real> m_demod;
+        PhaseDiscriminators m_phaseDiscri;
+        RDSPhaseLock m_pilotPLL;
+        Real m_pilotPLLSamples[4];
+        Interpolator m_interpolatorRDS;
+        Real m_interpolatorRDSDistance;
+        Real m_interpolatorRDSDistanceRemain;
+        RDSDemod m_rdsDemod;
+        RDSDecoder m_rdsDecoder;
+        RDSParser m_rdsParser;
+    };
+
+    friend class RDSScannerWorker;
+
+    int m_basebandSampleRate;
+    qint64 m_centerFrequency;
+    Real m_thresholdDb;
+    int m_maxStations;
+    int m_nbThreads;
+
+    int m_fftSize;          //!< forward FFT size (N)
+    int m_stationFFTSize;   //!< per station inverse FFT size (M)
+    int m_outputSampleRate; //!< per station sample rate (Fs * M / N)
+    FFTEngine *m_fft;
+    unsigned int m_fftSequence;
+    std::vector<FFTEngine*> m_invFFTs;
+    std::vector<unsigned int> m_invFFTSequences;
+    std::vector<Complex> m_overlap;  //!< input samples of the current forward FFT
+    int m_overlapFill;
+    std::vector<Complex> m_spectra;  //!< forward spectra of the current batch
+    std::vector<bool> m_oddBlocks;   //!< parity of the global block index of each spectrum in the batch
+    int m_batchFill;
+    bool m_oddBlock;
+    std::vector<Real> m_window;      //!< frequency domain window of a station
+    std::vector<double> m_psd;       //!< averaged power spectral density for detection
+    int m_psdCount;
+
+    std::vector<Station*> m_stations;
+    QMutex m_stationsMutex;          //!< protects the station list for reporting
+
+    std::vector<RDSScannerWorker*> m_workers;
+    QMutex m_batchMutex;
+    QWaitCondition m_batchStart;
+    QWaitCondition m_batchDone;
+    unsigned int m_batchId;
+    int m_pendingWorkers;
+
+    static const int m_stationFFTSizeDefault = 256;
+    static const int m_batchSize = 16;        //!< forward FFTs per batch
+    static const int m_rasterStep = 100000;   //!< FM broadcast raster (Hz)
+    static const int m_stationHalfBW = 75000; //!< half bandwidth used for power estimation (Hz)
+    static const int m_maxMissCount = 3;      //!< drop a station after this number of missed detections
+
+    void configure();
+    void allocateFFTs();
+    void releaseFFTs();
+    void startWorkers();
+    void stopWorkers();
+    void clearStations();
+    void processBatch();
+    void processStations(int part, int nbParts);
+    void processStation(Station *station, FFTEngine *invFFT);
+    void detectStations();
+    int frequencyToBin(qint64 frequency) const;
+    double binsPower(int centerBin, int halfWidth) const;
+};
+
+#endif /* PLUGINS_CHANNELRX_DEMODBFM_RDSSCANNER_H_ */
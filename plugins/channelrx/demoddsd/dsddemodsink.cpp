@@ -79,13 +79,75 @@ DSDDemodSink::~DSDDemodSink()
 }
 
 void DSDDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
-{	Complex ci;
-	int samplesPerSymbol = m_dsdDecoder.getSamplesPerSymbol();
+{
+	if (!m_idleGate.feed(begin, end, m_squelchOpen)) // idle: channel power only
+	{
+		m_magsqSum += m_idleGate.getMagsqSum();
+		m_magsqCount += m_idleGate.getMagsqCount();
+
+		if (m_idleGate.getMagsqPeak() > m_magsqPeak) {
+			m_magsqPeak = m_idleGate.getMagsqPeak();
+		}
+
+		return;
+	}
 
 	m_scopeSampleBuffer.clear();
 
 	m_dsdDecoder.enableMbelib(!DSPEngine::instance()->hasDVSerialSupport()); // disable mbelib if DV serial support is present and activated else enable it
 
+	const SampleVector& preroll = m_idleGate.getPreroll();
+
+	if (preroll.size() > 0) {
+		processSamples(preroll.begin(), preroll.end());
+	}
+
+	processSamples(begin, end);
+
+	if (!DSPEngine::instance()->hasDVSerialSupport())
+	{
+	    if (m_settings.m_slot1On)
+	    {
+	        int nbAudioSamples;
+	        short *dsdAudio = m_dsdDecoder.getAudio1(nbAudioSamples);
+
+	        if (nbAudioSamples > 0)
+	        {
+	            if (!m_settings.m_audioMute) {
+	                m_audioFifo1.write((const quint8*) dsdAudio, nbAudioSamples);
+	            }
+
+	            m_dsdDecoder.resetAudio1();
+	        }
+	    }
+
+        if (m_settings.m_slot2On)
+        {
+            int nbAudioSamples;
+            short *dsdAudio = m_dsdDecoder.getAudio2(nbAudioSamples);
+
+            if (nbAudioSamples > 0)
+            {
+                if (!m_settings.m_audioMute) {
+                    m_audioFifo2.write((const quint8*) dsdAudio, nbAudioSamples);
+                }
+
+                m_dsdDecoder.resetAudio2();
+            }
+        }
+	}
+
+    if ((m_scopeXY != 0) && (m_scopeEnabled))
+    {
+        m_scopeXY->feed(m_scopeSampleBuffer.begin(), m_scopeSampleBuffer.end(), true); // true = real samples for what it's worth
+    }
+}
+
+void DSDDemodSink::processSamples(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+	Complex ci;
+	int samplesPerSymbol = m_dsdDecoder.getSamplesPerSymbol();
+
 	for (SampleVector::const_iterator it = begin; it != end; ++it)
 	{
 		Complex c(it->real(), it->imag());
@@ -239,44 +301,6 @@ void DSDDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
             m_interpolatorDistanceRemain += m_interpolatorDistance;
         }
 	}
-
-	if (!DSPEngine::instance()->hasDVSerialSupport())
-	{
-	    if (m_settings.m_slot1On)
-	    {
-	        int nbAudioSamples;
-	        short *dsdAudio = m_dsdDecoder.getAudio1(nbAudioSamples);
-
-	        if (nbAudioSamples > 0)
-	        {
-	            if (!m_settings.m_audioMute) {
-	                m_audioFifo1.write((const quint8*) dsdAudio, nbAudioSamples);
-	            }
-
-	            m_dsdDecoder.resetAudio1();
-	        }
-	    }
-
-        if (m_settings.m_slot2On)
-        {
-            int nbAudioSamples;
-            short *dsdAudio = m_dsdDecoder.getAudio2(nbAudioSamples);
-
-            if (nbAudioSamples > 0)
-            {
-                if (!m_settings.m_audioMute) {
-                    m_audioFifo2.write((const quint8*) dsdAudio, nbAudioSamples);
-                }
-
-                m_dsdDecoder.resetAudio2();
-            }
-        }
-	}
-
-    if ((m_scopeXY != 0) && (m_scopeEnabled))
-    {
-        m_scopeXY->feed(m_scopeSampleBuffer.begin(), m_scopeSampleBuffer.end(), true); // true = real samples for what it's worth
-    }
 }
 
 void DSDDemodSink::applyAudioSampleRate(int sampleRate)
@@ -318,6 +342,7 @@ void DSDDemodSink::applyChannelSettings(int channelSampleRate, int channelFreque
         m_interpolatorDistance =  (Real) channelSampleRate / (Real) 48000;
     }
 
+    m_idleGate.setSampleRate(channelSampleRate);
     m_channelSampleRate = channelSampleRate;
     m_channelFrequencyOffset = channelFrequencyOffset;
 }
@@ -372,6 +397,7 @@ void DSDDemodSink::applySettings(const DSDDemodSettings& settings, bool force)
     {
         // input is a value in dB
         m_squelchLevel = std::pow(10.0, settings.m_squelch / 10.0);
+        m_idleGate.setThreshold(DSPEngine::instance()->getChannelIdle() ? m_squelchLevel : 0.0);
     }
 
     if ((settings.m_volume != m_settings.m_volume) || force)
@@ -26,6 +26,7 @@
 #include "dsp/bandpass.h"
 #include "dsp/afsquelch.h"
 #include "dsp/afsquelch.h"
+#include "dsp/channelidlegate.h"
 #include "audio/audiofifo.h"
 #include "util/movingaverage.h"
 #include "util/doublebufferfifo.h"
@@ -143,8 +144,10 @@ private:
 	char m_formatStatusText[82+1]; //!< Fixed signal format dependent status text
     SignalFormat m_signalFormat;   //!< Used to keep formatting during successive calls for the same standard type
     PhaseDiscriminators m_phaseDiscri;
+    ChannelIdleGate m_idleGate;
 
     void formatStatusText();
+    void processSamples(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
 };
 
 #endif // INCLUDE_DSDDEMODSINK_H
\ No newline at end of file
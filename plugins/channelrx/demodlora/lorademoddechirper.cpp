@@ -0,0 +1,197 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+#include "dsp/dspengine.h"
+#include "dsp/fftfactory.h"
+#include "dsp/fftengine.h"
+
+#include "lorademoddechirper.h"
+
+const float LoRaDemodDechirper::m_squelchRatio = 10.0f;
+
+LoRaDemodDechirper::LoRaDemodDechirper(unsigned int spreadFactor) :
+    m_spreadFactor(spreadFactor),
+    m_windowIndex(0),
+    m_skip(0),
+    m_fft(nullptr),
+    m_fftSequence(0)
+{
+    m_nbSymbolBins = 1 << m_spreadFactor;
+    m_downChirp.resize(m_nbSymbolBins);
+    m_window.resize(m_nbSymbolBins);
+
+    // base up chirp from -BW/2 to +BW/2: phase = pi*n^2/N - pi*n
+    for (unsigned int n = 0; n < m_nbSymbolBins; n++)
+    {
+        double phase = M_PI * ((double) n * n / m_nbSymbolBins - n);
+        m_downChirp[n] = Complex(cos(phase), -sin(phase));
+    }
+
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+    m_fftSequence = fftFactory->getEngine(m_nbSymbolBins, false, &m_fft);
+    m_symbols.reserve(m_maxSymbols);
+    reset();
+}
+
+LoRaDemodDechirper::~LoRaDemodDechirper()
+{
+    FFTFactory *fftFactory = DSPEngine::instance()->getFFTFactory();
+    fftFactory->releaseEngine(m_nbSymbolBins, false, m_fftSequence);
+}
+
+void LoRaDemodDechirper::reset()
+{
+    m_state = StateDetect;
+    m_lastBin = -1;
+    m_preambleCount = 0;
+    m_symbolCount = 0;
+    m_badSymbols = 0;
+}
+
+bool LoRaDemodDechirper::feed(const Complex& c)
+{
+    if (m_skip > 0)
+    {
+        m_skip--;
+        m_dechirped = c;
+        return false;
+    }
+
+    m_dechirped = c * m_downChirp[m_windowIndex];
+    m_window[m_windowIndex++] = c;
+
+    if (m_windowIndex < m_nbSymbolBins) {
+        return false;
+    }
+
+    m_windowIndex = 0;
+    return processSymbol();
+}
+
+bool LoRaDemodDechirper::processWindow(bool upChirp, unsigned int& peakBin, float& peakPower)
+{
+    Complex *in = m_fft->in();
+
+    if (upChirp)
+    {
+        for (unsigned int i = 0; i < m_nbSymbolBins; i++) {
+            in[i] = m_window[i] * std::conj(m_downChirp[i]);
+        }
+    }
+    else
+    {
+        for (unsigned int i = 0; i < m_nbSymbolBins; i++) {
+            in[i] = m_window[i] * m_downChirp[i];
+        }
+    }
+
+    m_fft->transform();
+    const Complex *out = m_fft->out();
+    float total = 0.0f;
+    peakPower = 0.0f;
+    peakBin = 0;
+
+    for (unsigned int i = 0; i < m_nbSymbolBins; i++)
+    {
+        float power = std::norm(out[i]);
+        total += power;
+
+        if (power > peakPower)
+        {
+            peakPower = power;
+            peakBin = i;
+        }
+    }
+
+    float average = (total - peakPower) / (m_nbSymbolBins - 1);
+    return peakPower > m_squelchRatio * average;
+}
+
+bool LoRaDemodDechirper::processSymbol()
+{
+    unsigned int bin;
+    float power;
+
+    if (m_state == StateDetect)
+    {
+        bool good = processWindow(false, bin, power);
+
+        if (good && (m_preambleCount > 0) && ((int) bin == m_lastBin)) {
+            m_preambleCount++;
+        } else {
+            m_preambleCount = good ? 1 : 0;
+        }
+
+        m_lastBin = bin;
+
+        if (m_preambleCount >= m_minPreamble)
+        {
+            // chirps start bin samples before the window: move to the next chirp start
+            m_skip = (m_nbSymbolBins - bin) % m_nbSymbolBins;
+            m_state = StatePreamble;
+            m_symbolCount = 0;
+        }
+
+        return false;
+    }
+    else if (m_state == StatePreamble)
+    {
+        unsigned int upBin;
+        float upPower;
+        bool up = processWindow(false, bin, power);
+        bool down = processWindow(true, upBin, upPower); // up chirp dechirp reveals down chirps
+        m_symbolCount++;
+
+        if (down && (upPower > power)) // first down chirp of the delimiter: skip the remaining 1.25 symbol
+        {
+            m_skip = m_nbSymbolBins + m_nbSymbolBins / 4;
+            m_state = StatePayload;
+            m_symbols.clear();
+            m_badSymbols = 0;
+        }
+        else if (up && ((bin == 1) || (bin == m_nbSymbolBins - 1))) // track a one sample drift (sync words have larger values)
+        {
+            m_skip = (m_nbSymbolBins - bin) % m_nbSymbolBins;
+        }
+        else if (m_symbolCount > m_maxPreamble)
+        {
+            reset();
+        }
+
+        return false;
+    }
+    else // StatePayload
+    {
+        if (processWindow(false, bin, power)) {
+            m_badSymbols = 0;
+        } else {
+            m_badSymbols++;
+        }
+
+        m_symbols.push_back(bin);
+
+        if ((m_badSymbols < 2) && (m_symbols.size() < m_maxSymbols)) {
+            return false;
+        }
+
+        m_symbols.resize(m_symbols.size() - m_badSymbols); // trailing noise
+        reset();
+        return m_symbols.size() > 0;
+    }
+}
@@ -0,0 +1,89 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_LORADEMODDECHIRPER_H
+#define INCLUDE_LORADEMODDECHIRPER_H
+
+#include <vector>
+
+#include "dsp/dsptypes.h"
+
+class FFTEngine;
+
+/**
+ * Symbol synchronous LoRa demodulator for one spreading factor. It takes one sample per chip
+ * (sample rate equal to the bandwidth) and works on whole symbols of 2^SF samples: each symbol
+ * is multiplied by a precomputed down chirp and the symbol value is the peak bin of one FFT.
+ *
+ * - Detect: windows are not aligned. A preamble is detected when the same peak bin is found in
+ *   consecutive windows. The peak bin is the offset of the chirps in the window so the next
+ *   window is moved to start on a chirp.
+ * - Preamble: aligned windows until the down chirps of the start frame delimiter that are found
+ *   with an up chirp dechirp. Then 1.25 symbol is skipped.
+ * - Payload: one symbol per window until the peak to average ratio drops.
+ */
+class LoRaDemodDechirper
+{
+public:
+    LoRaDemodDechirper(unsigned int spreadFactor);
+    ~LoRaDemodDechirper();
+
+    /** Process one sample. Returns true when a frame is complete and its symbols are available. */
+    bool feed(const Complex& c);
+    const std::vector<unsigned short>& getSymbols() const { return m_symbols; }
+    const Complex& getDechirped() const { return m_dechirped; } //!< last sample multiplied by the down chirp (for display)
+    unsigned int getSpreadFactor() const { return m_spreadFactor; }
+
+    static const unsigned int m_minSpreadFactor = 7;
+    static const unsigned int m_maxSpreadFactor = 12;
+
+private:
+    enum State
+    {
+        StateDetect,
+        StatePreamble,
+        StatePayload
+    };
+
+    unsigned int m_spreadFactor;
+    unsigned int m_nbSymbolBins;         //!< 2^SF: samples per symbol and FFT size
+    std::vector<Complex> m_downChirp;    //!< one symbol of the base down chirp
+    std::vector<Complex> m_window;       //!< current symbol samples
+    unsigned int m_windowIndex;
+    unsigned int m_skip;                 //!< samples to skip before the next window
+    FFTEngine *m_fft;
+    unsigned int m_fftSequence;
+    State m_state;
+    int m_lastBin;
+    unsigned int m_preambleCount;        //!< consecutive windows with the same peak bin
+    unsigned int m_symbolCount;          //!< windows processed in the current state
+    unsigned int m_badSymbols;           //!< consecutive payload symbols below squelch
+    std::vector<unsigned short> m_symbols;
+    Complex m_dechirped;
+
+    static const float m_squelchRatio;           //!< minimum peak to average power ratio of a symbol
+    static const unsigned int m_minPreamble = 4; //!< windows with the same peak bin to detect a preamble
+    static const unsigned int m_maxPreamble = 24; //!< preamble and sync words without delimiter before giving up
+    static const unsigned int m_maxSymbols = 1024;
+
+    /** Dechirp the window with the down chirp (or the up chirp), FFT and find the peak bin. Returns false if below squelch. */
+    bool processWindow(bool upChirp, unsigned int& peakBin, float& peakPower);
+    bool processSymbol(); //!< Returns true on end of frame
+    void reset();
+};
+
+#endif // INCLUDE_LORADEMODDECHIRPER_H
@@ -98,7 +98,15 @@ void LoRaDemodGUI::on_BW_valueChanged(int value)
 
 void LoRaDemodGUI::on_Spread_valueChanged(int value)
 {
-    (void) value;
+    m_settings.m_spreadFactor = value;
+    ui->SpreadText->setText(QString("SF%1").arg(value));
+    applySettings();
+}
+
+void LoRaDemodGUI::on_allSF_toggled(bool checked)
+{
+    m_settings.m_allSpreadFactors = checked;
+    applySettings();
 }
 
 void LoRaDemodGUI::onWidgetRolled(QWidget* widget, bool rollDown)
@@ -182,5 +190,8 @@ void LoRaDemodGUI::displaySettings()
     blockApplySettings(true);
     ui->BWText->setText(QString("%1 Hz").arg(thisBW));
     ui->BW->setValue(m_settings.m_bandwidthIndex);
+    ui->SpreadText->setText(QString("SF%1").arg(m_settings.m_spreadFactor));
+    ui->Spread->setValue(m_settings.m_spreadFactor);
+    ui->allSF->setChecked(m_settings.m_allSpreadFactors);
     blockApplySettings(false);
 }
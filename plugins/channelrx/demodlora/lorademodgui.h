@@ -40,6 +40,7 @@ private slots:
 	void viewChanged();
 	void on_BW_valueChanged(int value);
 	void on_Spread_valueChanged(int value);
+	void on_allSF_toggled(bool checked);
 	void onWidgetRolled(QWidget* widget, bool rollDown);
 
 private:
@@ -21,7 +21,8 @@ LoRaDemodSettings::LoRaDemodSettings() :
 void LoRaDemodSettings::resetToDefaults()
 {
     m_bandwidthIndex = 0;
-    m_spread = 0;
+    m_spreadFactor = 8;
+    m_allSpreadFactors = false;
     m_rgbColor = QColor(255, 0, 255).rgb();
     m_title = "LoRa Demodulator";
 }
@@ -31,7 +32,6 @@ QByteArray LoRaDemodSettings::serialize() const
     SimpleSerializer s(1);
     s.writeS32(1, m_centerFrequency);
     s.writeS32(2, m_bandwidthIndex);
-    s.writeS32(3, m_spread);
 
     if (m_spectrumGUI) {
         s.writeBlob(4, m_spectrumGUI->serialize());
@@ -42,6 +42,8 @@ QByteArray LoRaDemodSettings::serialize() const
     }
 
     s.writeString(6, m_title);
+    s.writeS32(7, m_spreadFactor);
+    s.writeBool(8, m_allSpreadFactors);
 
     return s.final();
 }
@@ -62,7 +64,6 @@ bool LoRaDemodSettings::deserialize(const QByteArray& data)
 
         d.readS32(1, &m_centerFrequency, 0);
         d.readS32(2, &m_bandwidthIndex, 0);
-        d.readS32(3, &m_spread, 0);
 
         if (m_spectrumGUI) {
             d.readBlob(4, &bytetmp);
@@ -75,6 +76,9 @@ bool LoRaDemodSettings::deserialize(const QByteArray& data)
         }
 
         d.readString(6, &m_title, "LoRa Demodulator");
+        d.readS32(7, &m_spreadFactor, 8);
+        m_spreadFactor = m_spreadFactor < 7 ? 7 : m_spreadFactor > 12 ? 12 : m_spreadFactor;
+        d.readBool(8, &m_allSpreadFactors, false);
 
         return true;
     }
@@ -13,7 +13,8 @@ struct LoRaDemodSettings
 {
     int m_centerFrequency;
     int m_bandwidthIndex;
-    int m_spread;
+    int m_spreadFactor;     //!< 7 to 12
+    bool m_allSpreadFactors; //!< decode all spread factors in parallel
     uint32_t m_rgbColor;
     QString m_title;
 
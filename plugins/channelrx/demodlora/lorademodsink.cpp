@@ -22,14 +22,9 @@
 #include "dsp/dsptypes.h"
 #include "dsp/basebandsamplesink.h"
 
+#include "lorademoddechirper.h"
 #include "lorademodsink.h"
 
-const int LoRaDemodSink::DATA_BITS = 6;
-const int LoRaDemodSink::SAMPLEBITS = LoRaDemodSink::DATA_BITS + 2;
-const int LoRaDemodSink::SPREADFACTOR = (1 << LoRaDemodSink::SAMPLEBITS);
-const int LoRaDemodSink::LORA_SFFT_LEN = (LoRaDemodSink::SPREADFACTOR / 2);
-const int LoRaDemodSink::LORA_SQUELCH = 3;
-
 LoRaDemodSink::LoRaDemodSink() :
         m_spectrumSink(nullptr)
 {
@@ -40,46 +35,68 @@ LoRaDemodSink::LoRaDemodSink() :
 	m_interpolator.create(16, m_channelSampleRate, m_Bandwidth/1.9);
 	m_sampleDistanceRemain = (Real) m_channelSampleRate / m_Bandwidth;
 
-	m_chirp = 0;
-	m_angle = 0;
-	m_bin = 0;
-	m_result = 0;
-	m_count = 0;
-	m_header = 0;
-	m_time = 0;
-	m_tune = 0;
-
-	loraFilter = new sfft(LORA_SFFT_LEN);
-	negaFilter = new sfft(LORA_SFFT_LEN);
-	mov = new float[4*LORA_SFFT_LEN];
-	history = new short[1024];
-	finetune = new short[16];
+	createDechirpers();
 }
 
 LoRaDemodSink::~LoRaDemodSink()
 {
-    delete loraFilter;
-	delete negaFilter;
-	delete [] mov;
-	delete [] history;
-	delete [] finetune;
+	destroyDechirpers();
+}
+
+void LoRaDemodSink::createDechirpers()
+{
+	m_dechirpers.push_back(new LoRaDemodDechirper(m_settings.m_spreadFactor));
+
+	if (m_settings.m_allSpreadFactors)
+	{
+		for (unsigned int sf = LoRaDemodDechirper::m_minSpreadFactor; sf <= LoRaDemodDechirper::m_maxSpreadFactor; sf++)
+		{
+			if ((int) sf != m_settings.m_spreadFactor) {
+				m_dechirpers.push_back(new LoRaDemodDechirper(sf));
+			}
+		}
+	}
+}
+
+void LoRaDemodSink::destroyDechirpers()
+{
+	for (auto dechirper : m_dechirpers) {
+		delete dechirper;
+	}
+
+	m_dechirpers.clear();
+}
+
+void LoRaDemodSink::dumpSymbols(const LoRaDemodDechirper *dechirper)
+{
+	const std::vector<unsigned short>& symbols = dechirper->getSymbols();
+	QString symbolsStr;
+
+	for (auto symbol : symbols) {
+		symbolsStr += QString(" %1").arg(symbol);
+	}
+
+	qDebug("LoRaDemodSink::dumpSymbols: SF%u %u symbols:%s",
+		dechirper->getSpreadFactor(), (unsigned int) symbols.size(), qPrintable(symbolsStr));
+
+	if (dechirper->getSpreadFactor() == 8) {
+		dumpRaw(symbols);
+	}
 }
 
-void LoRaDemodSink::dumpRaw()
+void LoRaDemodSink::dumpRaw(const std::vector<unsigned short>& symbols)
 {
-	short bin, j, max;
+	short j, max;
 	char text[256];
 
-	max = m_time / 4 - 3;
+	max = symbols.size();
 
 	if (max > 140) {
 		max = 140; // about 2 symbols to each char
 	}
 
-	for ( j=0; j < max; j++)
-	{
-		bin = (history[(j + 1)  * 4] + m_tune ) & (LORA_SFFT_LEN - 1);
-		text[j] = toGray(bin >> 1);
+	for ( j=0; j < max; j++) {
+		text[j] = toGray(symbols[j] >> 2); // 6 bits per symbol out of 8
 	}
 
 	prng6(text, max);
@@ -106,139 +123,36 @@ void LoRaDemodSink::dumpRaw()
 	qDebug("LoRaDemodSink::dumpRaw: %s", &text[1]);
 }
 
-short LoRaDemodSink::synch(short bin)
+void LoRaDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
-	short i, j;
+	Complex ci;
+	int nbSamples = end - begin;
 
-	if (bin < 0)
-	{
-		if (m_time > 70) {
-			dumpRaw();
-		}
+	m_sampleBuffer.clear();
 
-		m_time = 0;
-		return -1;
+	if ((int) m_mixBuffer.size() < nbSamples) {
+		m_mixBuffer.resize(nbSamples);
 	}
 
-	history[m_time] = bin;
+	if (nbSamples > 0) {
+		m_nco.mixIQBlock(&(*begin), m_mixBuffer.data(), nbSamples); // shift to channel center
+	}
 
-	if (m_time > 12)
+	for (int i = 0; i < nbSamples; i++)
 	{
-		if (bin == history[m_time - 6])
+		Complex c = m_mixBuffer[i] / SDR_RX_SCALEF;
+
+		if (m_interpolator.decimate(&m_sampleDistanceRemain, c, &ci))
 		{
-			if (bin == history[m_time - 12])
+			for (auto dechirper : m_dechirpers)
 			{
-				m_tune = LORA_SFFT_LEN - bin;
-				j = 0;
-
-				for (i=0; i<12; i++) {
-					j += finetune[15 & (m_time - i)];
-				}
-
-				if (j < 0) {
-					m_tune += 1;
+				if (dechirper->feed(ci)) {
+					dumpSymbols(dechirper);
 				}
-
-				m_tune &= (LORA_SFFT_LEN - 1);
-				m_time = 0;
-				return -1;
 			}
-		}
-	}
-
-	m_time++;
-	m_time &= 1023;
-
-	if (m_time & 3) {
-		return -1;
-	}
-
-	return (bin + m_tune) & (LORA_SFFT_LEN - 1);
-}
-
-int LoRaDemodSink::detect(Complex c, Complex a)
-{
-	int p, q;
-	short i, result, negresult, movpoint;
-	float peak, negpeak, tfloat;
-	float mag[LORA_SFFT_LEN];
-	float rev[LORA_SFFT_LEN];
-
-	loraFilter->run(c * a);
-	negaFilter->run(c * conj(a));
-
-	// process spectrum twice in FFTLEN
-	if (++m_count & ((1 << DATA_BITS) - 1)) {
-		return m_result;
-	}
-
-	movpoint = 3 & (m_count >> DATA_BITS);
-
-	loraFilter->fetch(mag);
-	negaFilter->fetch(rev);
-	peak = negpeak = 0.0f;
-	result = negresult = 0;
-
-	for (i = 0; i < LORA_SFFT_LEN; i++)
-	{
-		if (rev[i] > negpeak)
-		{
-			negpeak = rev[i];
-			negresult = i;
-		}
-
-		tfloat = mov[i] + mov[LORA_SFFT_LEN + i] +mov[2 * LORA_SFFT_LEN + i]
-				+ mov[3 * LORA_SFFT_LEN + i] + mag[i];
-
-		if (tfloat > peak)
-		{
-			peak = tfloat;
-			result = i;
-		}
-
-		mov[movpoint * LORA_SFFT_LEN + i] = mag[i];
-	}
-
-	p = (result - 1 + LORA_SFFT_LEN) & (LORA_SFFT_LEN -1);
-	q = (result + 1) & (LORA_SFFT_LEN -1);
-	finetune[15 & m_time] = (mag[p] > mag[q]) ? -1 : 1;
-
-	if (peak < negpeak * LORA_SQUELCH)
-	{
-		result = -1;
-	}
-
-	result = synch(result);
-
-	if (result >= 0) {
-		m_result = result;
-	}
-
-	return m_result;
-}
-
-void LoRaDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
-{
-	int newangle;
-	Complex ci;
-
-	m_sampleBuffer.clear();
-
-	for (SampleVector::const_iterator it = begin; it < end; ++it)
-	{
-		Complex c(it->real() / SDR_RX_SCALEF, it->imag() / SDR_RX_SCALEF);
-		c *= m_nco.nextIQ();
 
-		if (m_interpolator.decimate(&m_sampleDistanceRemain, c, &ci))
-		{
-			m_chirp = (m_chirp + 1) & (SPREADFACTOR - 1);
-                        m_angle = (m_angle + m_chirp) & (SPREADFACTOR - 1);
-			Complex cangle(cos(M_PI*2*m_angle/SPREADFACTOR),-sin(M_PI*2*m_angle/SPREADFACTOR));
-			newangle = detect(ci, cangle);
-
-			m_bin = (m_bin + newangle) & (LORA_SFFT_LEN - 1);
-			Complex nangle(cos(M_PI*2*m_bin/LORA_SFFT_LEN),sin(M_PI*2*m_bin/LORA_SFFT_LEN));
-			m_sampleBuffer.push_back(Sample(nangle.real() * 100, nangle.imag() * 100));
+			const Complex& dechirped = m_dechirpers[0]->getDechirped();
+			m_sampleBuffer.push_back(Sample(dechirped.real() * SDR_RX_SCALEF, dechirped.imag() * SDR_RX_SCALEF));
 			m_sampleDistanceRemain += (Real) m_channelSampleRate / m_Bandwidth;
 		}
 	}
@@ -277,10 +191,19 @@ void LoRaDemodSink::applySettings(const LoRaDemodSettings& settings, bool force)
     qDebug() << "LoRaDemodSink::applySettings:"
             << " m_centerFrequency: " << settings.m_centerFrequency
             << " m_bandwidthIndex: " << settings.m_bandwidthIndex
-            << " m_spread: " << settings.m_spread
+            << " m_spreadFactor: " << settings.m_spreadFactor
+            << " m_allSpreadFactors: " << settings.m_allSpreadFactors
             << " m_rgbColor: " << settings.m_rgbColor
             << " m_title: " << settings.m_title
             << " force: " << force;
 
+    bool rebuild = (settings.m_spreadFactor != m_settings.m_spreadFactor)
+        || (settings.m_allSpreadFactors != m_settings.m_allSpreadFactors) || force;
     m_settings = settings;
+
+    if (rebuild)
+    {
+        destroyDechirpers();
+        createDechirpers();
+    }
 }
@@ -24,11 +24,11 @@
 #include "dsp/nco.h"
 #include "dsp/interpolator.h"
 #include "util/message.h"
-#include "dsp/fftfilt.h"
 
 #include "lorademodsettings.h"
 
 class BasebandSampleSink;
+class LoRaDemodDechirper;
 
 class LoRaDemodSink : public ChannelSampleSink {
 public:
@@ -46,20 +46,7 @@ private:
 	Real m_Bandwidth;
     int m_channelSampleRate;
     int m_channelFrequencyOffset;
-	int m_chirp;
-	int m_angle;
-	int m_bin;
-	int m_result;
-	int m_count;
-	int m_header;
-	int m_time;
-	short m_tune;
-
-	sfft* loraFilter;
-	sfft* negaFilter;
-	float* mov;
-	short* history;
-	short* finetune;
+	std::vector<LoRaDemodDechirper*> m_dechirpers; //!< settings spread factor first then the others when all are decoded
 
 	NCO m_nco;
 	Interpolator m_interpolator;
@@ -67,16 +54,12 @@ private:
 
 	BasebandSampleSink* m_spectrumSink;
 	SampleVector m_sampleBuffer;
+	std::vector<Complex> m_mixBuffer; //!< channel samples shifted by the NCO
 
-    static const int DATA_BITS;
-    static const int SAMPLEBITS;
-    static const int SPREADFACTOR;
-    static const int LORA_SFFT_LEN;
-    static const int LORA_SQUELCH;
-
-	int  detect(Complex sample, Complex angle);
-	void dumpRaw(void);
-	short synch (short bin);
+	void createDechirpers();
+	void destroyDechirpers();
+	void dumpSymbols(const LoRaDemodDechirper *dechirper);
+	void dumpRaw(const std::vector<unsigned short>& symbols);
 
     /*
     Interleaving is "easiest" if the same number of bits is used per symbol as for FEC
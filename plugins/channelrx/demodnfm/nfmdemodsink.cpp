@@ -17,6 +17,8 @@
 
 #include <stdio.h>
 #include <complex.h>
+#include <cstring>
+#include <algorithm>
 
 #include <QTime>
 #include <QDebug>
@@ -58,6 +60,9 @@ NFMDemodSink::NFMDemodSink() :
 {
 	m_agcLevel = 1.0;
     m_audioBuffer.resize(1<<14);
+    m_iqBuffer.reserve(1<<14);
+    m_demodBuffer.resize(1<<14);
+    m_phaseDiscri.reset();
 
 	applySettings(m_settings, true);
     applyChannelSettings(m_channelSampleRate, m_channelFrequencyOffset, true);
@@ -68,19 +73,58 @@ NFMDemodSink::~NFMDemodSink()
 }
 
 void NFMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    if (!m_idleGate.feed(begin, end, m_squelchOpen)) // idle: channel power only
+    {
+        m_magsqSum += m_idleGate.getMagsqSum();
+        m_magsqCount += m_idleGate.getMagsqCount();
+        m_magsq = m_idleGate.getMagsqCount() > 0 ? m_idleGate.getMagsqSum() / m_idleGate.getMagsqCount() : 0.0;
+
+        if (m_idleGate.getMagsqPeak() > m_magsqPeak) {
+            m_magsqPeak = m_idleGate.getMagsqPeak();
+        }
+
+        return;
+    }
+
+    m_iqBuffer.clear();
+    const SampleVector& preroll = m_idleGate.getPreroll();
+
+    if (preroll.size() > 0) {
+        processSamples(preroll.begin(), preroll.end());
+    }
+
+    processSamples(begin, end);
+
+    if (m_iqBuffer.size() > 0) {
+        processBlock();
+    }
+}
+
+void NFMDemodSink::processSamples(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
 	Complex ci;
+	int nbSamples = end - begin;
+
+	if (nbSamples == 0) {
+		return;
+	}
+
+	if ((int) m_mixBuffer.size() < nbSamples) {
+		m_mixBuffer.resize(nbSamples);
+	}
+
+	m_nco.mixIQBlock(&(*begin), m_mixBuffer.data(), nbSamples); // shift to channel center
 
-	for (SampleVector::const_iterator it = begin; it != end; ++it)
+	for (int i = 0; i < nbSamples; i++)
 	{
-		Complex c(it->real(), it->imag());
-		c *= m_nco.nextIQ();
+		Complex& c = m_mixBuffer[i];
 
         if (m_interpolatorDistance < 1.0f) // interpolate
         {
             while (!m_interpolator.interpolate(&m_interpolatorDistanceRemain, c, &ci))
             {
-                processOneSample(ci);
+                m_iqBuffer.push_back(ci);
                 m_interpolatorDistanceRemain += m_interpolatorDistance;
             }
         }
@@ -88,82 +132,104 @@ void NFMDemodSink::feed(const SampleVector::const_iterator& begin, const SampleV
         {
             if (m_interpolator.decimate(&m_interpolatorDistanceRemain, c, &ci))
             {
-                processOneSample(ci);
+                m_iqBuffer.push_back(ci);
                 m_interpolatorDistanceRemain += m_interpolatorDistance;
             }
         }
     }
-
 }
 
-void NFMDemodSink::processOneSample(Complex &ci)
+void NFMDemodSink::processBlock()
 {
-    qint16 sample;
+    int nbSamples = m_iqBuffer.size();
 
-    double magsqRaw; // = ci.real()*ci.real() + c.imag()*c.imag();
-    Real deviation;
+    if ((int) m_demodBuffer.size() < nbSamples) {
+        m_demodBuffer.resize(nbSamples);
+    }
 
-    Real demod = m_phaseDiscri.phaseDiscriminatorDelta(ci, magsqRaw, deviation);
+    // discriminate the whole block then evaluate squelch in smaller blocks
+    m_phaseDiscri.phaseDiscriminatorBlock(m_iqBuffer.data(), m_demodBuffer.data(), nbSamples);
+    Real *demod = m_demodBuffer.data();
 
-    Real magsq = magsqRaw / (SDR_RX_SCALED*SDR_RX_SCALED);
-    m_movingAverage(magsq);
-    m_magsqSum += magsq;
+    for (int i = 0; i < nbSamples; i++) {
+        demod[i] *= m_discriCompensation;
+    }
+
+    for (int i = 0; i < nbSamples; i += m_squelchBlockSize) {
+        processSquelchBlock(&m_iqBuffer[i], &demod[i], std::min(m_squelchBlockSize, nbSamples - i));
+    }
+}
+
+void NFMDemodSink::processSquelchBlock(const Complex *iq, const Real *demod, int nbSamples)
+{
+    double magsqSum = 0.0;
+    double magsqPeak = 0.0;
 
-    if (magsq > m_magsqPeak)
+    for (int i = 0; i < nbSamples; i++)
     {
-        m_magsqPeak = magsq;
+        double magsq = iq[i].real()*iq[i].real() + iq[i].imag()*iq[i].imag();
+        magsqSum += magsq;
+        magsqPeak = magsq > magsqPeak ? magsq : magsqPeak;
     }
 
-    m_magsqCount++;
-    m_sampleCount++;
+    magsqSum /= (SDR_RX_SCALED*SDR_RX_SCALED);
+    magsqPeak /= (SDR_RX_SCALED*SDR_RX_SCALED);
+    m_magsqSum += magsqSum;
 
-    // AF processing
+    if (magsqPeak > m_magsqPeak) {
+        m_magsqPeak = magsqPeak;
+    }
+
+    m_magsqCount += nbSamples;
 
     if (m_settings.m_deltaSquelch)
     {
-        if (m_afSquelch.analyze(demod * m_discriCompensation))
+        for (int i = 0; i < nbSamples; i++)
         {
-            m_afSquelchOpen = m_afSquelch.evaluate(); // ? m_squelchGate + m_squelchDecay : 0;
+            if (m_afSquelch.analyze(demod[i]))
+            {
+                m_afSquelchOpen = m_afSquelch.evaluate();
 
-            if (!m_afSquelchOpen) {
-                m_squelchDelayLine.zeroBack(m_audioSampleRate/10); // zero out evaluation period
+                if (!m_afSquelchOpen) {
+                    m_squelchDelayLine.zeroBack(m_audioSampleRate/10); // zero out evaluation period
+                }
             }
-        }
 
-        if (m_afSquelchOpen)
-        {
-            m_squelchDelayLine.write(demod * m_discriCompensation);
+            if (m_afSquelchOpen)
+            {
+                m_squelchDelayLine.write(demod[i]);
 
-            if (m_squelchCount < 2*m_squelchGate) {
-                m_squelchCount++;
+                if (m_squelchCount < 2*m_squelchGate) {
+                    m_squelchCount++;
+                }
             }
-        }
-        else
-        {
-            m_squelchDelayLine.write(0);
+            else
+            {
+                m_squelchDelayLine.write(0);
 
-            if (m_squelchCount > 0) {
-                m_squelchCount--;
+                if (m_squelchCount > 0) {
+                    m_squelchCount--;
+                }
             }
         }
     }
     else
     {
-        if ((Real) m_movingAverage < m_squelchLevel)
+        if (magsqSum / nbSamples < m_squelchLevel)
         {
-            m_squelchDelayLine.write(0);
-
-            if (m_squelchCount > 0) {
-                m_squelchCount--;
+            for (int i = 0; i < nbSamples; i++) {
+                m_squelchDelayLine.write(0);
             }
+
+            m_squelchCount = m_squelchCount > nbSamples ? m_squelchCount - nbSamples : 0;
         }
         else
         {
-            m_squelchDelayLine.write(demod * m_discriCompensation);
-
-            if (m_squelchCount < 2*m_squelchGate) {
-                m_squelchCount++;
+            for (int i = 0; i < nbSamples; i++) {
+                m_squelchDelayLine.write(demod[i]);
             }
+
+            m_squelchCount = std::min(m_squelchCount + nbSamples, 2*m_squelchGate);
         }
     }
 
@@ -171,100 +237,133 @@ void NFMDemodSink::processOneSample(Complex &ci)
 
     if (m_settings.m_audioMute)
     {
-        sample = 0;
+        pushSilence(nbSamples);
     }
-    else
+    else if (m_squelchOpen)
     {
-        if (m_squelchOpen)
-        {
-            if (m_settings.m_ctcssOn)
-            {
-                Real ctcss_sample = m_ctcssLowpass.filter(demod * m_discriCompensation);
+        processAudio(demod, nbSamples);
+    }
+    else // no CTCSS, audio filtering or delay line read while closed
+    {
+        resetCTCSS();
+        pushSilence(nbSamples);
+    }
+}
 
-                if ((m_sampleCount & 7) == 7) // decimate 48k -> 6k
-                {
-                    if (m_ctcssDetector.analyze(&ctcss_sample))
-                    {
-                        int maxToneIndex;
-
-                        if (m_ctcssDetector.getDetectedTone(maxToneIndex))
-                        {
-                            if (maxToneIndex+1 != m_ctcssIndex)
-                            {
-                                if (getMessageQueueToGUI())
-                                {
-                                    NFMDemodReport::MsgReportCTCSSFreq *msg = NFMDemodReport::MsgReportCTCSSFreq::create(m_ctcssDetector.getToneSet()[maxToneIndex]);
-                                    getMessageQueueToGUI()->push(msg);
-                                }
-
-                                m_ctcssIndex = maxToneIndex+1;
-                            }
-                        }
-                        else
-                        {
-                            if (m_ctcssIndex != 0)
-                            {
-                                if (getMessageQueueToGUI())
-                                {
-                                    NFMDemodReport::MsgReportCTCSSFreq *msg = NFMDemodReport::MsgReportCTCSSFreq::create(0);
-                                    getMessageQueueToGUI()->push(msg);
-                                }
-
-                                m_ctcssIndex = 0;
-                            }
-                        }
-                    }
-                }
-            }
+void NFMDemodSink::processAudio(const Real *demod, int nbSamples)
+{
+    qint16 sample;
 
-            if (m_settings.m_ctcssOn && m_ctcssIndexSelected && (m_ctcssIndexSelected != m_ctcssIndex))
-            {
-                sample = 0;
-            }
-            else
-            {
-                if (m_settings.m_highPass) {
-                    sample = m_bandpass.filter(m_squelchDelayLine.readBack(m_squelchGate)) * m_settings.m_volume;
-                } else {
-                    sample = m_lowpass.filter(m_squelchDelayLine.readBack(m_squelchGate)) * m_settings.m_volume * 301.0f;
-                }
-            }
+    for (int i = 0; i < nbSamples; i++)
+    {
+        if (m_settings.m_ctcssOn) {
+            processCTCSS(demod[i]);
+        }
+
+        if (m_settings.m_ctcssOn && m_ctcssIndexSelected && (m_ctcssIndexSelected != m_ctcssIndex))
+        {
+            sample = 0;
         }
         else
         {
-            if (m_ctcssIndex != 0)
+            // the whole block is already in the delay line
+            Real delayed = m_squelchDelayLine.readBack(m_squelchGate + nbSamples - 1 - i);
+
+            if (m_settings.m_highPass) {
+                sample = m_bandpass.filter(delayed) * m_settings.m_volume;
+            } else {
+                sample = m_lowpass.filter(delayed) * m_settings.m_volume * 301.0f;
+            }
+        }
+
+        pushAudioSample(sample);
+    }
+}
+
+void NFMDemodSink::processCTCSS(Real demod)
+{
+    Real ctcss_sample = m_ctcssLowpass.filter(demod);
+
+    if ((m_sampleCount++ & 7) != 7) { // decimate 48k -> 6k
+        return;
+    }
+
+    if (m_ctcssDetector.analyze(&ctcss_sample))
+    {
+        int maxToneIndex;
+
+        if (m_ctcssDetector.getDetectedTone(maxToneIndex))
+        {
+            if (maxToneIndex+1 != m_ctcssIndex)
             {
                 if (getMessageQueueToGUI())
                 {
-                    NFMDemodReport::MsgReportCTCSSFreq *msg = NFMDemodReport::MsgReportCTCSSFreq::create(0);
+                    NFMDemodReport::MsgReportCTCSSFreq *msg = NFMDemodReport::MsgReportCTCSSFreq::create(m_ctcssDetector.getToneSet()[maxToneIndex]);
                     getMessageQueueToGUI()->push(msg);
                 }
 
-                m_ctcssIndex = 0;
+                m_ctcssIndex = maxToneIndex+1;
             }
+        }
+        else
+        {
+            resetCTCSS();
+        }
+    }
+}
 
-            sample = 0;
+void NFMDemodSink::resetCTCSS()
+{
+    if (m_ctcssIndex != 0)
+    {
+        if (getMessageQueueToGUI())
+        {
+            NFMDemodReport::MsgReportCTCSSFreq *msg = NFMDemodReport::MsgReportCTCSSFreq::create(0);
+            getMessageQueueToGUI()->push(msg);
         }
+
+        m_ctcssIndex = 0;
     }
+}
 
+void NFMDemodSink::pushAudioSample(qint16 sample)
+{
     m_audioBuffer[m_audioBufferFill].l = sample;
     m_audioBuffer[m_audioBufferFill].r = sample;
     ++m_audioBufferFill;
 
-    if (m_audioBufferFill >= m_audioBuffer.size())
+    if (m_audioBufferFill >= m_audioBuffer.size()) {
+        flushAudio();
+    }
+}
+
+void NFMDemodSink::pushSilence(int nbSamples)
+{
+    while (nbSamples > 0)
     {
-        uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
+        int count = std::min(nbSamples, (int) (m_audioBuffer.size() - m_audioBufferFill));
+        std::memset(&m_audioBuffer[m_audioBufferFill], 0, count * sizeof(AudioSample));
+        m_audioBufferFill += count;
+        nbSamples -= count;
 
-        if (res != m_audioBufferFill)
-        {
-            qDebug("NFMDemodSink::feed: %u/%u audio samples written", res, m_audioBufferFill);
-            qDebug("NFMDemodSink::feed: m_audioSampleRate: %u m_channelSampleRate: %d", m_audioSampleRate, m_channelSampleRate);
+        if (m_audioBufferFill >= m_audioBuffer.size()) {
+            flushAudio();
         }
-
-        m_audioBufferFill = 0;
     }
 }
 
+void NFMDemodSink::flushAudio()
+{
+    uint res = m_audioFifo.write((const quint8*)&m_audioBuffer[0], m_audioBufferFill);
+
+    if (res != m_audioBufferFill)
+    {
+        qDebug("NFMDemodSink::flushAudio: %u/%u audio samples written", res, m_audioBufferFill);
+        qDebug("NFMDemodSink::flushAudio: m_audioSampleRate: %u m_channelSampleRate: %d", m_audioSampleRate, m_channelSampleRate);
+    }
+
+    m_audioBufferFill = 0;
+}
 
 void NFMDemodSink::applyChannelSettings(int channelSampleRate, int channelFrequencyOffset, bool force)
 {
@@ -285,6 +384,7 @@ void NFMDemodSink::applyChannelSettings(int channelSampleRate, int channelFreque
         m_interpolatorDistance =  (Real) channelSampleRate / (Real) m_audioSampleRate;
     }
 
+    m_idleGate.setSampleRate(channelSampleRate);
     m_channelSampleRate = channelSampleRate;
     m_channelFrequencyOffset = channelFrequencyOffset;
 }
@@ -339,11 +439,12 @@ void NFMDemodSink::applySettings(const NFMDemodSettings& settings, bool force)
             m_squelchLevel = (- settings.m_squelch) / 100.0;
             m_afSquelch.setThreshold(m_squelchLevel);
             m_afSquelch.reset();
+            m_idleGate.setThreshold(0.0); // no power threshold
         }
         else
         { // input is a value in deci-Bels
             m_squelchLevel = std::pow(10.0, settings.m_squelch / 10.0);
-            m_movingAverage.reset();
+            m_idleGate.setThreshold(DSPEngine::instance()->getChannelIdle() ? m_squelchLevel : 0.0);
         }
 
         m_squelchCount = 0; // reset squelch open counter
@@ -29,7 +29,7 @@
 #include "dsp/afsquelch.h"
 #include "dsp/agc.h"
 #include "dsp/ctcssdetector.h"
-#include "util/movingaverage.h"
+#include "dsp/channelidlegate.h"
 #include "util/doublebufferfifo.h"
 #include "audio/audiofifo.h"
 
@@ -129,7 +129,6 @@ private:
     int  m_magsqCount;
     MagSqLevelsStore m_magSqLevelStore;
 
-	MovingAverageUtil<Real, double, 32> m_movingAverage;
 	AFSquelch m_afSquelch;
 	Real m_agcLevel; // AGC will aim to  this level
 	DoubleBufferFIFO<Real> m_squelchDelayLine;
@@ -137,10 +136,24 @@ private:
     PhaseDiscriminators m_phaseDiscri;
     MessageQueue *m_messageQueueToGUI;
 
+    std::vector<Complex> m_mixBuffer; //!< channel samples shifted by the NCO
+    std::vector<Complex> m_iqBuffer;  //!< interpolated samples of one feed call
+    std::vector<Real> m_demodBuffer;  //!< discriminator output of one feed call
+    ChannelIdleGate m_idleGate;
+
     static const double afSqTones[];
     static const double afSqTones_lowrate[];
-
-    void processOneSample(Complex &ci);
+    static const int m_squelchBlockSize = 32; //!< power squelch evaluation span in audio samples
+
+    void processSamples(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    void processBlock();
+    void processSquelchBlock(const Complex *iq, const Real *demod, int nbSamples);
+    void processAudio(const Real *demod, int nbSamples);
+    void processCTCSS(Real demod);
+    void resetCTCSS();
+    void pushAudioSample(qint16 sample);
+    void pushSilence(int nbSamples);
+    void flushAudio();
     MessageQueue *getMessageQueueToGUI() { return m_messageQueueToGUI; }
 
     inline float arctan2(Real y, Real x)
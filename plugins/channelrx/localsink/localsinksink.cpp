@@ -17,23 +17,19 @@
 
 #include <QDebug>
 
-#include <boost/crc.hpp>
-#include <boost/cstdint.hpp>
 #include "dsp/devicesamplesource.h"
-#include "dsp/hbfilterchainconverter.h"
+#include "dsp/samplesinkfifo.h"
 
-#include "localsinkworker.h"
 #include "localsinksink.h"
 
 LocalSinkSink::LocalSinkSink() :
-        m_sinkWorker(nullptr),
+        m_deviceSampleFifo(nullptr),
         m_running(false),
         m_centerFrequency(0),
         m_frequencyOffset(0),
         m_sampleRate(48000),
         m_deviceSampleRate(48000)
 {
-    m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(4000000));
     applySettings(m_settings, true);
 }
 
@@ -43,7 +39,9 @@ LocalSinkSink::~LocalSinkSink()
 
 void LocalSinkSink::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
 {
-    m_sampleFifo.write(begin, end);
+    if (m_running && m_deviceSampleFifo) {
+        m_deviceSampleFifo->write(begin, end);
+    }
 }
 
 void LocalSinkSink::start(DeviceSampleSource *deviceSource)
@@ -54,60 +52,17 @@ void LocalSinkSink::start(DeviceSampleSource *deviceSource)
         stop();
     }
 
-    m_sinkWorker = new LocalSinkWorker();
-    m_sinkWorker->moveToThread(&m_sinkWorkerThread);
-    m_sinkWorker->setSampleFifo(&m_sampleFifo);
-
-    if (deviceSource) {
-        m_sinkWorker->setDeviceSampleFifo(deviceSource->getSampleFifo());
-    }
-
-    QObject::connect(
-        &m_sampleFifo,
-        &SampleSinkFifo::dataReady,
-        m_sinkWorker,
-        &LocalSinkWorker::handleData,
-        Qt::QueuedConnection
-    );
-
-    startWorker();
+    m_deviceSampleFifo = deviceSource ? deviceSource->getSampleFifo() : nullptr;
     m_running = true;
 }
 
 void LocalSinkSink::stop()
 {
     qDebug("LocalSinkSink::stop");
-
-    QObject::disconnect(
-        &m_sampleFifo,
-        &SampleSinkFifo::dataReady,
-        m_sinkWorker,
-        &LocalSinkWorker::handleData
-    );
-
-    if (m_sinkWorker != 0)
-    {
-        stopWorker();
-        m_sinkWorker->deleteLater();
-        m_sinkWorker = nullptr;
-    }
-
+    m_deviceSampleFifo = nullptr;
     m_running = false;
 }
 
-void LocalSinkSink::startWorker()
-{
-	m_sinkWorker->startStop(true);
-	m_sinkWorkerThread.start();
-}
-
-void LocalSinkSink::stopWorker()
-{
-	m_sinkWorker->startStop(false);
-	m_sinkWorkerThread.quit();
-	m_sinkWorkerThread.wait();
-}
-
 void LocalSinkSink::applySettings(const LocalSinkSettings& settings, bool force)
 {
     qDebug() << "LocalSinkSink::applySettings:"
@@ -120,5 +75,5 @@ void LocalSinkSink::applySettings(const LocalSinkSettings& settings, bool force)
 
 void LocalSinkSink::setSampleRate(int sampleRate)
 {
-    m_sampleFifo.setSize(SampleSinkFifo::getSizePolicy(sampleRate));
+    m_sampleRate = sampleRate;
 }
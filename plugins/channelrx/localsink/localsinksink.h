@@ -19,14 +19,19 @@
 #define INCLUDE_LOCALSINKSINK_H_
 
 #include <QObject>
-#include <QThread>
 
 #include "dsp/channelsamplesink.h"
 
 #include "localsinksettings.h"
 
 class DeviceSampleSource;
-class LocalSinkWorker;
+class SampleSinkFifo;
+
+/**
+ * Channelized samples are written directly in the sample FIFO of the Local Input device
+ * that is read by the device set DSP engine. The caller (baseband sink) serializes feed
+ * with start and stop.
+ */
 
 class LocalSinkSink : public QObject, public ChannelSampleSink {
     Q_OBJECT
@@ -43,19 +48,14 @@ public:
     void setSampleRate(int sampleRate);
 
 private:
-    SampleSinkFifo m_sampleFifo;
     LocalSinkSettings m_settings;
-    LocalSinkWorker *m_sinkWorker;
-    QThread m_sinkWorkerThread;
+    SampleSinkFifo *m_deviceSampleFifo;
     bool m_running;
 
     uint64_t m_centerFrequency;
     int64_t m_frequencyOffset;
     uint32_t m_sampleRate;
     uint32_t m_deviceSampleRate;
-
-	void startWorker();
-	void stopWorker();
 };
 
 #endif // INCLUDE_LOCALSINKSINK_H_
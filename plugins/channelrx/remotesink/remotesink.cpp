@@ -173,6 +173,7 @@ void RemoteSink::applySettings(const RemoteSinkSettings& settings, bool force)
             << " m_txDelay: " << settings.m_txDelay
             << " m_dataAddress: " << settings.m_dataAddress
             << " m_dataPort: " << settings.m_dataPort
+            << " m_sharedMemoryName: " << settings.m_sharedMemoryName
             << " m_streamIndex: " << settings.m_streamIndex
             << " force: " << force;
 
@@ -191,6 +192,9 @@ void RemoteSink::applySettings(const RemoteSinkSettings& settings, bool force)
     if ((m_settings.m_dataPort != settings.m_dataPort) || force) {
         reverseAPIKeys.append("dataPort");
     }
+    if ((m_settings.m_sharedMemoryName != settings.m_sharedMemoryName) || force) {
+        reverseAPIKeys.append("sharedMemoryName");
+    }
     if ((m_settings.m_rgbColor != settings.m_rgbColor) || force) {
         reverseAPIKeys.append("rgbColor");
     }
@@ -339,6 +343,10 @@ void RemoteSink::webapiUpdateChannelSettings(
         }
     }
 
+    if (channelSettingsKeys.contains("sharedMemoryName")) {
+        settings.m_sharedMemoryName = *response.getRemoteSinkSettings()->getSharedMemoryName();
+    }
+
     if (channelSettingsKeys.contains("rgbColor")) {
         settings.m_rgbColor = response.getRemoteSinkSettings()->getRgbColor();
     }
@@ -388,6 +396,13 @@ void RemoteSink::webapiFormatChannelSettings(SWGSDRangel::SWGChannelSettings& re
     }
 
     response.getRemoteSinkSettings()->setDataPort(settings.m_dataPort);
+
+    if (response.getRemoteSinkSettings()->getSharedMemoryName()) {
+        *response.getRemoteSinkSettings()->getSharedMemoryName() = settings.m_sharedMemoryName;
+    } else {
+        response.getRemoteSinkSettings()->setSharedMemoryName(new QString(settings.m_sharedMemoryName));
+    }
+
     response.getRemoteSinkSettings()->setRgbColor(settings.m_rgbColor);
 
     if (response.getRemoteSinkSettings()->getTitle()) {
@@ -437,6 +452,9 @@ void RemoteSink::webapiReverseSendSettings(QList<QString>& channelSettingsKeys,
     if (channelSettingsKeys.contains("dataPort") || force) {
         swgRemoteSinkSettings->setDataPort(settings.m_dataPort);
     }
+    if (channelSettingsKeys.contains("sharedMemoryName") || force) {
+        swgRemoteSinkSettings->setSharedMemoryName(new QString(settings.m_sharedMemoryName));
+    }
     if (channelSettingsKeys.contains("rgbColor") || force) {
         swgRemoteSinkSettings->setRgbColor(settings.m_rgbColor);
     }
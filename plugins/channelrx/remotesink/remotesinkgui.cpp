@@ -187,6 +187,7 @@ void RemoteSinkGUI::displaySettings()
     ui->decimationFactor->setCurrentIndex(m_settings.m_log2Decim);
     ui->dataAddress->setText(m_settings.m_dataAddress);
     ui->dataPort->setText(tr("%1").arg(m_settings.m_dataPort));
+    ui->sharedMemoryName->setText(m_settings.m_sharedMemoryName);
     QString s = QString::number(128 + m_settings.m_nbFECBlocks, 'f', 0);
     QString s1 = QString::number(m_settings.m_nbFECBlocks, 'f', 0);
     ui->nominalNbBlocksText->setText(tr("%1/%2").arg(s).arg(s1));
@@ -328,6 +329,12 @@ void RemoteSinkGUI::on_dataPort_returnPressed()
     applySettings();
 }
 
+void RemoteSinkGUI::on_sharedMemoryName_returnPressed()
+{
+    m_settings.m_sharedMemoryName = ui->sharedMemoryName->text().trimmed();
+    applySettings();
+}
+
 void RemoteSinkGUI::on_dataApplyButton_clicked(bool checked)
 {
     (void) checked;
@@ -341,6 +348,7 @@ void RemoteSinkGUI::on_dataApplyButton_clicked(bool checked)
         m_settings.m_dataPort = udpDataPort;
     }
 
+    m_settings.m_sharedMemoryName = ui->sharedMemoryName->text().trimmed();
     applySettings();
 }
 
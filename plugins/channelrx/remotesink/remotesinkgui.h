@@ -93,6 +93,7 @@ private slots:
     void on_position_valueChanged(int value);
     void on_dataAddress_returnPressed();
     void on_dataPort_returnPressed();
+    void on_sharedMemoryName_returnPressed();
     void on_dataApplyButton_clicked(bool checked);
     void on_nbFECBlocks_valueChanged(int value);
     void on_txDelay_valueChanged(int value);
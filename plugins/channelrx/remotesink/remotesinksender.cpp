@@ -35,12 +35,21 @@
 RemoteSinkSender::RemoteSinkSender() :
     m_fifo(20, this),
     m_address(QHostAddress::LocalHost),
-    m_socket(nullptr)
+    m_socket(nullptr),
+    m_sharedMemoryRetryMs(m_sharedMemoryMinRetryMs)
 {
     qDebug("RemoteSinkSender::RemoteSinkSender");
     m_cm256p = m_cm256.isInitialized() ? &m_cm256 : nullptr;
     m_socket = new QUdpSocket(this);
 
+    Metrics& metrics = Metrics::instance();
+    QString framesHelp("Frames sent by the Remote Sinks");
+    m_metricsUDPFrames = metrics.counter("sdrangel_remote_sink_frames_total", framesHelp, {{"transport", "udp"}});
+    m_metricsSharedMemoryFrames = metrics.counter("sdrangel_remote_sink_frames_total", framesHelp, {{"transport", "shm"}});
+    m_metricsUDPBlocks = metrics.counter("sdrangel_remote_sink_udp_blocks_total", "UDP blocks (datagrams) sent by the Remote Sinks including FEC");
+    m_metricsSharedMemoryDroppedFrames = metrics.counter("sdrangel_remote_sink_shm_dropped_frames_total", "Frames dropped by the Remote Sinks because the shared memory ring was full");
+    m_metricsFECErrors = metrics.counter("sdrangel_remote_sink_fec_errors_total", "FEC encoding failures in the Remote Sinks");
+
     QObject::connect(
         &m_fifo,
         &RemoteSinkFifo::dataBlockServed,
@@ -89,6 +98,16 @@ void RemoteSinkSender::sendDataBlock(RemoteDataBlock *dataBlock)
     uint16_t dataPort = dataBlock->m_txControlBlock.m_dataPort;
     RemoteSuperBlock *txBlockx = dataBlock->m_superBlocks;
 
+    if (!dataBlock->m_txControlBlock.m_sharedMemoryName.isEmpty())
+    {
+        writeSharedMemory(dataBlock);
+        return;
+    }
+    else if (m_sharedMemory.isOpen())
+    {
+        m_sharedMemory.close();
+    }
+
     if ((nbBlocksFEC == 0) || !m_cm256p) // Do not FEC encode
     {
         if (m_socket)
@@ -99,6 +118,9 @@ void RemoteSinkSender::sendDataBlock(RemoteDataBlock *dataBlock)
                 m_socket->writeDatagram((const char*)&txBlockx[i], (qint64 ) RemoteUdpSize, m_address, dataPort);
                 std::this_thread::sleep_for(std::chrono::microseconds(txDelay));
             }
+
+            m_metricsUDPFrames->inc();
+            m_metricsUDPBlocks->inc(RemoteNbOrginalBlocks);
         }
     }
     else
@@ -126,6 +148,7 @@ void RemoteSinkSender::sendDataBlock(RemoteDataBlock *dataBlock)
         if (m_cm256p->cm256_encode(cm256Params, descriptorBlocks, fecBlocks))
         {
             qWarning("RemoteSinkSender::handleDataBlock: CM256 encode failed. No transmission.");
+            m_metricsFECErrors->inc();
             // TODO: send without FEC changing meta data to set indication of no FEC
         }
 
@@ -144,8 +167,67 @@ void RemoteSinkSender::sendDataBlock(RemoteDataBlock *dataBlock)
                 m_socket->writeDatagram((const char*)&txBlockx[i], (qint64 ) RemoteUdpSize, m_address, dataPort);
                 std::this_thread::sleep_for(std::chrono::microseconds(txDelay));
             }
+
+            m_metricsUDPFrames->inc();
+            m_metricsUDPBlocks->inc(cm256Params.OriginalCount + cm256Params.RecoveryCount);
+        }
+    }
+
+    dataBlock->m_txControlBlock.m_processed = true;
+}
+
+void RemoteSinkSender::writeSharedMemory(RemoteDataBlock *dataBlock)
+{
+    const QString& name = dataBlock->m_txControlBlock.m_sharedMemoryName;
+
+    if (!m_sharedMemory.isOpen() || (m_sharedMemory.getName() != name))
+    {
+        // the reader may start later: retry with a growing delay after a failure
+        bool retry = (name != m_sharedMemoryFailedName) || (m_sharedMemoryRetryTimer.elapsed() >= m_sharedMemoryRetryMs);
+
+        if (retry && m_sharedMemory.open(name, true))
+        {
+            if (!m_sharedMemoryFailedName.isEmpty()) {
+                qInfo("RemoteSinkSender::writeSharedMemory: %s: opened after failure", qPrintable(name));
+            }
+
+            m_sharedMemoryFailedName.clear();
+            m_sharedMemoryRetryMs = m_sharedMemoryMinRetryMs;
+        }
+        else if (retry)
+        {
+            if (name != m_sharedMemoryFailedName)
+            {
+                qWarning("RemoteSinkSender::writeSharedMemory: %s: cannot open. Frames are dropped until it opens", qPrintable(name));
+                m_sharedMemoryFailedName = name;
+                m_sharedMemoryRetryMs = m_sharedMemoryMinRetryMs;
+            }
+            else
+            {
+                m_sharedMemoryRetryMs = 2 * m_sharedMemoryRetryMs > m_sharedMemoryMaxRetryMs ? m_sharedMemoryMaxRetryMs : 2 * m_sharedMemoryRetryMs;
+            }
+
+            m_sharedMemoryRetryTimer.start();
         }
     }
 
+    // original blocks only: nothing is lost in shared memory. Block headers are set by the sink.
+    if (m_sharedMemory.isOpen())
+    {
+        if (m_sharedMemory.writeBlocks(dataBlock->m_superBlocks, RemoteNbOrginalBlocks))
+        {
+            m_metricsSharedMemoryFrames->inc();
+        }
+        else
+        {
+            qDebug("RemoteSinkSender::writeSharedMemory: ring full: frame %u dropped", dataBlock->m_txControlBlock.m_frameIndex);
+            m_metricsSharedMemoryDroppedFrames->inc();
+        }
+    }
+    else
+    {
+        m_metricsSharedMemoryDroppedFrames->inc();
+    }
+
     dataBlock->m_txControlBlock.m_processed = true;
 }
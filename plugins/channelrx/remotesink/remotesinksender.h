@@ -28,11 +28,14 @@
 #include <QMutex>
 #include <QWaitCondition>
 #include <QHostAddress>
+#include <QElapsedTimer>
 
 #include "cm256cc/cm256.h"
 
 #include "util/message.h"
 #include "util/messagequeue.h"
+#include "channel/remotesharedmemory.h"
+#include "util/metrics.h"
 
 #include "remotesinkfifo.h"
 
@@ -57,7 +60,22 @@ private:
     QHostAddress m_address;
     QUdpSocket *m_socket;
 
+    RemoteSharedMemory m_sharedMemory;
+
+    Metrics::Counter *m_metricsUDPFrames;
+    Metrics::Counter *m_metricsUDPBlocks;
+    Metrics::Counter *m_metricsSharedMemoryFrames;
+    Metrics::Counter *m_metricsSharedMemoryDroppedFrames;
+    Metrics::Counter *m_metricsFECErrors;
+    QString m_sharedMemoryFailedName;        //!< name that failed to open last
+    QElapsedTimer m_sharedMemoryRetryTimer;  //!< time since the last failed open
+    int m_sharedMemoryRetryMs;               //!< do not retry to open on each frame but after this delay
+
+    static const int m_sharedMemoryMinRetryMs = 100;
+    static const int m_sharedMemoryMaxRetryMs = 5000;
+
     void sendDataBlock(RemoteDataBlock *dataBlock);
+    void writeSharedMemory(RemoteDataBlock *dataBlock);
 
 private slots:
     void handleData();
@@ -40,6 +40,7 @@ void RemoteSinkSettings::resetToDefaults()
     m_txDelay = 35;
     m_dataAddress = "127.0.0.1";
     m_dataPort = 9090;
+    m_sharedMemoryName = "";
     m_rgbColor = QColor(140, 4, 4).rgb();
     m_title = "Remote sink";
     m_log2Decim = 0;
@@ -70,6 +71,7 @@ QByteArray RemoteSinkSettings::serialize() const
     s.writeU32(12, m_log2Decim);
     s.writeU32(13, m_filterChainHash);
     s.writeS32(14, m_streamIndex);
+    s.writeString(15, m_sharedMemoryName);
 
     return s.final();
 }
@@ -127,6 +129,7 @@ bool RemoteSinkSettings::deserialize(const QByteArray& data)
         m_log2Decim = tmp > 6 ? 6 : tmp;
         d.readU32(13, &m_filterChainHash, 0);
         d.readS32(14, &m_streamIndex, 0);
+        d.readString(15, &m_sharedMemoryName, "");
 
         return true;
     }
@@ -35,6 +35,7 @@ struct RemoteSinkSettings
     uint32_t m_txDelay;
     QString  m_dataAddress;
     uint16_t m_dataPort;
+    QString  m_sharedMemoryName; //!< use shared memory with this name instead of UDP if not empty
     quint32 m_rgbColor;
     QString m_title;
     uint32_t m_log2Decim;
@@ -111,7 +111,7 @@ void RemoteSinkSink::feed(const SampleVector::const_iterator& begin, const Sampl
             metaData.m_sampleBytes = (SDR_RX_SAMP_SZ <= 16 ? 2 : 4);
             metaData.m_sampleBits = SDR_RX_SAMP_SZ;
             metaData.m_nbOriginalBlocks = RemoteNbOrginalBlocks;
-            metaData.m_nbFECBlocks = m_nbBlocksFEC;
+            metaData.m_nbFECBlocks = m_sharedMemoryName.isEmpty() ? m_nbBlocksFEC : 0; // no FEC in shared memory
             metaData.m_tv_sec = nowus / 1000000UL;  // tv.tv_sec;
             metaData.m_tv_usec = nowus % 1000000UL; // tv.tv_usec;
 
@@ -183,6 +183,7 @@ void RemoteSinkSink::feed(const SampleVector::const_iterator& begin, const Sampl
                 m_dataBlock->m_txControlBlock.m_txDelay = m_txDelay;
                 m_dataBlock->m_txControlBlock.m_dataAddress = m_dataAddress;
                 m_dataBlock->m_txControlBlock.m_dataPort = m_dataPort;
+                m_dataBlock->m_txControlBlock.m_sharedMemoryName = m_sharedMemoryName;
 
                 m_dataBlock = m_remoteSinkSender->getDataBlock(); // ask a new block to sender
 
@@ -204,6 +205,7 @@ void RemoteSinkSink::applySettings(const RemoteSinkSettings& settings, bool forc
             << " m_txDelay: " << settings.m_txDelay
             << " m_dataAddress: " << settings.m_dataAddress
             << " m_dataPort: " << settings.m_dataPort
+            << " m_sharedMemoryName: " << settings.m_sharedMemoryName
             << " m_streamIndex: " << settings.m_streamIndex
             << " force: " << force;
 
@@ -215,6 +217,10 @@ void RemoteSinkSink::applySettings(const RemoteSinkSettings& settings, bool forc
         m_dataPort = settings.m_dataPort;
     }
 
+    if ((m_settings.m_sharedMemoryName != settings.m_sharedMemoryName) || force) {
+        m_sharedMemoryName = settings.m_sharedMemoryName;
+    }
+
     if ((m_settings.m_log2Decim != settings.m_log2Decim)
      || (m_settings.m_filterChainHash != settings.m_filterChainHash)
      || (m_settings.m_nbFECBlocks != settings.m_nbFECBlocks)
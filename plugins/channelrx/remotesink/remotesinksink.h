@@ -64,6 +64,7 @@ private:
     int m_txDelay;
     QString m_dataAddress;
     uint16_t m_dataPort;
+    QString m_sharedMemoryName;
 
     void setNbBlocksFEC(int nbBlocksFEC);
     void setTxDelay(int txDelay, int nbBlocksFEC, int log2Decim);
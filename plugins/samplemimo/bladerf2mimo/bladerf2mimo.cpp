@@ -0,0 +1,670 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include <QDebug>
+
+#include "SWGDeviceSettings.h"
+#include "SWGDeviceState.h"
+#include "SWGBladeRF2MIMOSettings.h"
+
+#include "device/deviceapi.h"
+#include "dsp/dspcommands.h"
+#include "dsp/devicesamplesource.h"
+#include "bladerf2/devicebladerf2.h"
+
+#include "bladerf2mithread.h"
+#include "bladerf2mimo.h"
+
+MESSAGE_CLASS_DEFINITION(BladeRF2MIMO::MsgConfigureBladeRF2MIMO, Message)
+MESSAGE_CLASS_DEFINITION(BladeRF2MIMO::MsgStartStop, Message)
+MESSAGE_CLASS_DEFINITION(BladeRF2MIMO::MsgReportGainRange, Message)
+
+BladeRF2MIMO::BladeRF2MIMO(DeviceAPI *deviceAPI) :
+    m_deviceAPI(deviceAPI),
+    m_settings(),
+    m_deviceDescription("BladeRF2MIMO"),
+    m_running(false),
+    m_dev(nullptr),
+    m_thread(nullptr)
+{
+    m_mimoType = MIMOHalfSynchronous;
+    m_sampleMIFifo.init(m_nbRxStreams, 96000 * 4);
+    m_deviceAPI->setNbSourceStreams(m_nbRxStreams);
+    m_deviceAPI->setNbSinkStreams(0);
+
+    if (openDevice())
+    {
+        const bladerf_gain_modes *modes = nullptr;
+        int nbModes = m_dev->getGainModesRx(&modes);
+
+        if (modes)
+        {
+            for (int i = 0; i < nbModes; i++) {
+                m_rxGainModes.push_back(GainMode{QString(modes[i].name), modes[i].mode});
+            }
+        }
+    }
+}
+
+BladeRF2MIMO::~BladeRF2MIMO()
+{
+    if (m_running) {
+        stopRx();
+    }
+
+    closeDevice();
+}
+
+void BladeRF2MIMO::destroy()
+{
+    delete this;
+}
+
+bool BladeRF2MIMO::openDevice()
+{
+    // The MIMO device set owns the whole physical device so there are no buddies to look for
+    m_dev = new DeviceBladeRF2();
+    char serial[256];
+    strcpy(serial, qPrintable(m_deviceAPI->getSamplingDeviceSerial()));
+
+    if (!m_dev->open(serial))
+    {
+        qCritical("BladeRF2MIMO::openDevice: cannot open BladeRF2 device");
+        delete m_dev;
+        m_dev = nullptr;
+        return false;
+    }
+
+    qDebug("BladeRF2MIMO::openDevice: device opened");
+    return true;
+}
+
+void BladeRF2MIMO::closeDevice()
+{
+    if (m_dev == nullptr) { // was never open
+        return;
+    }
+
+    if (m_running) {
+        stopRx();
+    }
+
+    m_dev->close();
+    delete m_dev;
+    m_dev = nullptr;
+}
+
+void BladeRF2MIMO::init()
+{
+    applySettings(m_settings, true);
+}
+
+bool BladeRF2MIMO::startRx()
+{
+    qDebug("BladeRF2MIMO::startRx");
+
+    if (!m_dev)
+    {
+        qDebug("BladeRF2MIMO::startRx: no device object");
+        return false;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_running) {
+        return true;
+    }
+
+    m_sampleMIFifo.reset();
+    m_thread = new BladeRF2MIThread(m_dev->getDev());
+    m_thread->setFifo(&m_sampleMIFifo);
+    m_thread->setLog2Decimation(m_settings.m_log2Decim);
+    m_thread->setFcPos((int) m_settings.m_fcPosRx);
+    m_thread->setIQOrder(m_settings.m_iqOrder);
+
+    // both channels must be enabled before the streams are configured in the thread
+    for (unsigned int i = 0; i < m_nbRxStreams; i++)
+    {
+        if (!m_dev->openRx(i)) {
+            qCritical("BladeRF2MIMO::startRx: channel %u cannot be enabled", i);
+        }
+    }
+
+    m_thread->startWork();
+    m_running = true;
+
+    return true;
+}
+
+void BladeRF2MIMO::stopRx()
+{
+    qDebug("BladeRF2MIMO::stopRx");
+
+    if (!m_thread) {
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    m_thread->stopWork();
+    delete m_thread;
+    m_thread = nullptr;
+
+    for (unsigned int i = 0; i < m_nbRxStreams; i++) {
+        m_dev->closeRx(i);
+    }
+
+    m_running = false;
+}
+
+QByteArray BladeRF2MIMO::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool BladeRF2MIMO::deserialize(const QByteArray& data)
+{
+    bool success = true;
+
+    if (!m_settings.deserialize(data))
+    {
+        m_settings.resetToDefaults();
+        success = false;
+    }
+
+    MsgConfigureBladeRF2MIMO* message = MsgConfigureBladeRF2MIMO::create(m_settings, true);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue)
+    {
+        MsgConfigureBladeRF2MIMO* messageToGUI = MsgConfigureBladeRF2MIMO::create(m_settings, true);
+        m_guiMessageQueue->push(messageToGUI);
+    }
+
+    return success;
+}
+
+const QString& BladeRF2MIMO::getDeviceDescription() const
+{
+    return m_deviceDescription;
+}
+
+int BladeRF2MIMO::getSourceSampleRate(int index) const
+{
+    (void) index; // both channels share the sample clock
+    return m_settings.m_devSampleRate/(1<<m_settings.m_log2Decim);
+}
+
+quint64 BladeRF2MIMO::getSourceCenterFrequency(int index) const
+{
+    (void) index; // both channels share the local oscillator
+    return m_settings.m_rxCenterFrequency;
+}
+
+void BladeRF2MIMO::setSourceCenterFrequency(qint64 centerFrequency, int index)
+{
+    (void) index;
+    BladeRF2MIMOSettings settings = m_settings;
+    settings.m_rxCenterFrequency = centerFrequency;
+
+    MsgConfigureBladeRF2MIMO* message = MsgConfigureBladeRF2MIMO::create(settings, false);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue)
+    {
+        MsgConfigureBladeRF2MIMO* messageToGUI = MsgConfigureBladeRF2MIMO::create(settings, false);
+        m_guiMessageQueue->push(messageToGUI);
+    }
+}
+
+bool BladeRF2MIMO::setRxDeviceCenterFrequency(struct bladerf *dev, quint64 freq_hz, int loPpmTenths)
+{
+    qint64 df = ((qint64)freq_hz * loPpmTenths) / 10000000LL;
+    freq_hz += df;
+    bool success = true;
+
+    // the LO is common to both Rx channels but libbladeRF expects the frequency per channel
+    for (unsigned int i = 0; i < m_nbRxStreams; i++)
+    {
+        int status = bladerf_set_frequency(dev, BLADERF_CHANNEL_RX(i), freq_hz);
+
+        if (status < 0)
+        {
+            qWarning("BladeRF2MIMO::setRxDeviceCenterFrequency: bladerf_set_frequency(%u, %lld) failed: %s",
+                    i, freq_hz, bladerf_strerror(status));
+            success = false;
+        }
+        else
+        {
+            qDebug("BladeRF2MIMO::setRxDeviceCenterFrequency: bladerf_set_frequency(%u, %lld)", i, freq_hz);
+        }
+    }
+
+    return success;
+}
+
+void BladeRF2MIMO::getRxFrequencyRange(uint64_t& min, uint64_t& max, int& step)
+{
+    if (m_dev) {
+        m_dev->getFrequencyRangeRx(min, max, step);
+    }
+}
+
+void BladeRF2MIMO::getRxSampleRateRange(int& min, int& max, int& step)
+{
+    if (m_dev) {
+        m_dev->getSampleRateRangeRx(min, max, step);
+    }
+}
+
+void BladeRF2MIMO::getRxBandwidthRange(int& min, int& max, int& step)
+{
+    if (m_dev) {
+        m_dev->getBandwidthRangeRx(min, max, step);
+    }
+}
+
+void BladeRF2MIMO::getRxGlobalGainRange(int& min, int& max, int& step)
+{
+    if (m_dev) {
+        m_dev->getGlobalGainRangeRx(min, max, step);
+    }
+}
+
+bool BladeRF2MIMO::handleMessage(const Message& message)
+{
+    if (MsgConfigureBladeRF2MIMO::match(message))
+    {
+        MsgConfigureBladeRF2MIMO& conf = (MsgConfigureBladeRF2MIMO&) message;
+        qDebug() << "BladeRF2MIMO::handleMessage: MsgConfigureBladeRF2MIMO";
+
+        if (!applySettings(conf.getSettings(), conf.getForce())) {
+            qDebug("BladeRF2MIMO::handleMessage: config error");
+        }
+
+        return true;
+    }
+    else if (MsgStartStop::match(message))
+    {
+        MsgStartStop& cmd = (MsgStartStop&) message;
+        qDebug() << "BladeRF2MIMO::handleMessage: MsgStartStop: " << (cmd.getStartStop() ? "start" : "stop");
+
+        if (cmd.getStartStop())
+        {
+            if (m_deviceAPI->initDeviceEngine(0)) {
+                m_deviceAPI->startDeviceEngine(0);
+            }
+        }
+        else
+        {
+            m_deviceAPI->stopDeviceEngine(0);
+        }
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+bool BladeRF2MIMO::applySettings(const BladeRF2MIMOSettings& settings, bool force)
+{
+    qDebug() << "BladeRF2MIMO::applySettings: "
+            << " m_rxCenterFrequency: " << settings.m_rxCenterFrequency << " Hz"
+            << " m_rxTransverterMode: " << settings.m_rxTransverterMode
+            << " m_rxTransverterDeltaFrequency: " << settings.m_rxTransverterDeltaFrequency
+            << " m_LOppmTenths: " << settings.m_LOppmTenths
+            << " m_devSampleRate: " << settings.m_devSampleRate
+            << " m_rxBandwidth: " << settings.m_rxBandwidth
+            << " m_log2Decim: " << settings.m_log2Decim
+            << " m_fcPosRx: " << settings.m_fcPosRx
+            << " m_iqOrder: " << settings.m_iqOrder
+            << " m_rx0GainMode: " << settings.m_rx0GainMode
+            << " m_rx0GlobalGain: " << settings.m_rx0GlobalGain
+            << " m_rx1GainMode: " << settings.m_rx1GainMode
+            << " m_rx1GlobalGain: " << settings.m_rx1GlobalGain
+            << " m_rxBiasTee: " << settings.m_rxBiasTee
+            << " m_dcBlock: " << settings.m_dcBlock
+            << " m_iqCorrection: " << settings.m_iqCorrection
+            << " m_spectrumStreamIndex: " << settings.m_spectrumStreamIndex
+            << " force: " << force;
+
+    bool forwardChangeRxDSP = false;
+    struct bladerf *dev = m_dev ? m_dev->getDev() : nullptr;
+    qint64 xlatedDeviceCenterFrequency = settings.m_rxCenterFrequency;
+    xlatedDeviceCenterFrequency -= settings.m_rxTransverterMode ? settings.m_rxTransverterDeltaFrequency : 0;
+    xlatedDeviceCenterFrequency = xlatedDeviceCenterFrequency < 0 ? 0 : xlatedDeviceCenterFrequency;
+
+    if ((m_settings.m_dcBlock != settings.m_dcBlock) ||
+        (m_settings.m_iqCorrection != settings.m_iqCorrection) || force)
+    {
+        for (unsigned int i = 0; i < m_nbRxStreams; i++) {
+            m_deviceAPI->configureCorrections(settings.m_dcBlock, settings.m_iqCorrection, i);
+        }
+    }
+
+    if ((m_settings.m_devSampleRate != settings.m_devSampleRate) || force)
+    {
+        forwardChangeRxDSP = true;
+
+        if (dev)
+        {
+            for (unsigned int i = 0; i < m_nbRxStreams; i++)
+            {
+                unsigned int actualSamplerate;
+                int status = bladerf_set_sample_rate(dev, BLADERF_CHANNEL_RX(i), settings.m_devSampleRate, &actualSamplerate);
+
+                if (status < 0) {
+                    qCritical("BladeRF2MIMO::applySettings: could not set sample rate: %d: %s",
+                            settings.m_devSampleRate, bladerf_strerror(status));
+                } else {
+                    qDebug() << "BladeRF2MIMO::applySettings: bladerf_set_sample_rate: actual sample rate is " << actualSamplerate;
+                }
+            }
+        }
+    }
+
+    if ((m_settings.m_rxBandwidth != settings.m_rxBandwidth) || force)
+    {
+        if (dev)
+        {
+            for (unsigned int i = 0; i < m_nbRxStreams; i++)
+            {
+                unsigned int actualBandwidth;
+                int status = bladerf_set_bandwidth(dev, BLADERF_CHANNEL_RX(i), settings.m_rxBandwidth, &actualBandwidth);
+
+                if (status < 0) {
+                    qCritical("BladeRF2MIMO::applySettings: could not set bandwidth: %d: %s",
+                            settings.m_rxBandwidth, bladerf_strerror(status));
+                } else {
+                    qDebug() << "BladeRF2MIMO::applySettings: bladerf_set_bandwidth: actual bandwidth is " << actualBandwidth;
+                }
+            }
+        }
+    }
+
+    if ((m_settings.m_fcPosRx != settings.m_fcPosRx) || force)
+    {
+        if (m_thread) {
+            m_thread->setFcPos((int) settings.m_fcPosRx);
+        }
+    }
+
+    if ((m_settings.m_log2Decim != settings.m_log2Decim) || force)
+    {
+        forwardChangeRxDSP = true;
+
+        if (m_thread) {
+            m_thread->setLog2Decimation(settings.m_log2Decim);
+        }
+    }
+
+    if ((m_settings.m_iqOrder != settings.m_iqOrder) || force)
+    {
+        if (m_thread) {
+            m_thread->setIQOrder(settings.m_iqOrder);
+        }
+    }
+
+    if ((m_settings.m_rxCenterFrequency != settings.m_rxCenterFrequency)
+        || (m_settings.m_rxTransverterMode != settings.m_rxTransverterMode)
+        || (m_settings.m_rxTransverterDeltaFrequency != settings.m_rxTransverterDeltaFrequency)
+        || (m_settings.m_LOppmTenths != settings.m_LOppmTenths)
+        || (m_settings.m_devSampleRate != settings.m_devSampleRate)
+        || (m_settings.m_fcPosRx != settings.m_fcPosRx)
+        || (m_settings.m_log2Decim != settings.m_log2Decim) || force)
+    {
+        qint64 deviceCenterFrequency = DeviceSampleSource::calculateDeviceCenterFrequency(
+                xlatedDeviceCenterFrequency,
+                0,
+                settings.m_log2Decim,
+                (DeviceSampleSource::fcPos_t) settings.m_fcPosRx,
+                settings.m_devSampleRate,
+                DeviceSampleSource::FrequencyShiftScheme::FSHIFT_STD,
+                false);
+
+        forwardChangeRxDSP = true;
+
+        if (dev && setRxDeviceCenterFrequency(dev, deviceCenterFrequency, settings.m_LOppmTenths))
+        {
+            if (getMessageQueueToGUI())
+            {
+                int min, max, step;
+                getRxGlobalGainRange(min, max, step);
+                MsgReportGainRange *msg = MsgReportGainRange::create(min, max, step);
+                getMessageQueueToGUI()->push(msg);
+            }
+        }
+    }
+
+    if (((m_settings.m_rxBiasTee != settings.m_rxBiasTee) || force) && m_dev) {
+        m_dev->setBiasTeeRx(settings.m_rxBiasTee);
+    }
+
+    const int gainModes[m_nbRxStreams] = {settings.m_rx0GainMode, settings.m_rx1GainMode};
+    const int currentGainModes[m_nbRxStreams] = {m_settings.m_rx0GainMode, m_settings.m_rx1GainMode};
+    const int globalGains[m_nbRxStreams] = {settings.m_rx0GlobalGain, settings.m_rx1GlobalGain};
+    const int currentGlobalGains[m_nbRxStreams] = {m_settings.m_rx0GlobalGain, m_settings.m_rx1GlobalGain};
+
+    for (unsigned int i = 0; (i < m_nbRxStreams) && dev; i++)
+    {
+        if ((currentGainModes[i] != gainModes[i]) || force)
+        {
+            int status = bladerf_set_gain_mode(dev, BLADERF_CHANNEL_RX(i), (bladerf_gain_mode) gainModes[i]);
+
+            if (status < 0) {
+                qWarning("BladeRF2MIMO::applySettings: bladerf_set_gain_mode(%u, %d) failed: %s",
+                        i, gainModes[i], bladerf_strerror(status));
+            } else {
+                qDebug("BladeRF2MIMO::applySettings: bladerf_set_gain_mode(%u, %d)", i, gainModes[i]);
+            }
+        }
+
+        if ((currentGlobalGains[i] != globalGains[i])
+           || ((currentGainModes[i] != gainModes[i]) && (gainModes[i] == BLADERF_GAIN_MANUAL)) || force)
+        {
+            int status = bladerf_set_gain(dev, BLADERF_CHANNEL_RX(i), globalGains[i]);
+
+            if (status < 0) {
+                qWarning("BladeRF2MIMO::applySettings: bladerf_set_gain(%u, %d) failed: %s",
+                        i, globalGains[i], bladerf_strerror(status));
+            } else {
+                qDebug("BladeRF2MIMO::applySettings: bladerf_set_gain(%u, %d)", i, globalGains[i]);
+            }
+        }
+    }
+
+    if (forwardChangeRxDSP)
+    {
+        int sampleRate = settings.m_devSampleRate/(1<<settings.m_log2Decim);
+
+        for (unsigned int i = 0; i < m_nbRxStreams; i++)
+        {
+            DSPMIMOSignalNotification *notif = new DSPMIMOSignalNotification(sampleRate, settings.m_rxCenterFrequency, true, i);
+            m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+        }
+    }
+
+    if ((m_settings.m_spectrumStreamIndex != settings.m_spectrumStreamIndex) || force) {
+        m_deviceAPI->setSpectrumSinkInput(true, settings.m_spectrumStreamIndex);
+    }
+
+    m_settings = settings;
+    return true;
+}
+
+int BladeRF2MIMO::webapiRunGet(
+        int subsystemIndex,
+        SWGSDRangel::SWGDeviceState& response,
+        QString& errorMessage)
+{
+    if (subsystemIndex != 0)
+    {
+        errorMessage = QString("Subsystem index invalid: expect 0 (Rx) only");
+        return 404;
+    }
+
+    m_deviceAPI->getDeviceEngineStateStr(*response.getState(), subsystemIndex);
+    return 200;
+}
+
+int BladeRF2MIMO::webapiRun(
+        bool run,
+        int subsystemIndex,
+        SWGSDRangel::SWGDeviceState& response,
+        QString& errorMessage)
+{
+    if (subsystemIndex != 0)
+    {
+        errorMessage = QString("Subsystem index invalid: expect 0 (Rx) only");
+        return 404;
+    }
+
+    m_deviceAPI->getDeviceEngineStateStr(*response.getState(), subsystemIndex);
+    MsgStartStop *message = MsgStartStop::create(run);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgStartStop *msgToGUI = MsgStartStop::create(run);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    return 200;
+}
+
+int BladeRF2MIMO::webapiSettingsGet(
+                SWGSDRangel::SWGDeviceSettings& response,
+                QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setBladeRf2MimoSettings(new SWGSDRangel::SWGBladeRF2MIMOSettings());
+    response.getBladeRf2MimoSettings()->init();
+    webapiFormatDeviceSettings(response, m_settings);
+    return 200;
+}
+
+int BladeRF2MIMO::webapiSettingsPutPatch(
+                bool force,
+                const QStringList& deviceSettingsKeys,
+                SWGSDRangel::SWGDeviceSettings& response, // query + response
+                QString& errorMessage)
+{
+    (void) errorMessage;
+    BladeRF2MIMOSettings settings = m_settings;
+    webapiUpdateDeviceSettings(settings, deviceSettingsKeys, response);
+
+    MsgConfigureBladeRF2MIMO *msg = MsgConfigureBladeRF2MIMO::create(settings, force);
+    m_inputMessageQueue.push(msg);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgConfigureBladeRF2MIMO *msgToGUI = MsgConfigureBladeRF2MIMO::create(settings, force);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    webapiFormatDeviceSettings(response, settings);
+    return 200;
+}
+
+void BladeRF2MIMO::webapiUpdateDeviceSettings(
+    BladeRF2MIMOSettings& settings,
+    const QStringList& deviceSettingsKeys,
+    SWGSDRangel::SWGDeviceSettings& response)
+{
+    SWGSDRangel::SWGBladeRF2MIMOSettings *swgSettings = response.getBladeRf2MimoSettings();
+
+    if (deviceSettingsKeys.contains("devSampleRate")) {
+        settings.m_devSampleRate = swgSettings->getDevSampleRate();
+    }
+    if (deviceSettingsKeys.contains("LOppmTenths")) {
+        settings.m_LOppmTenths = swgSettings->getLOppmTenths();
+    }
+    if (deviceSettingsKeys.contains("rxCenterFrequency")) {
+        settings.m_rxCenterFrequency = swgSettings->getRxCenterFrequency();
+    }
+    if (deviceSettingsKeys.contains("log2Decim")) {
+        settings.m_log2Decim = swgSettings->getLog2Decim();
+    }
+    if (deviceSettingsKeys.contains("fcPosRx")) {
+        int fcPos = swgSettings->getFcPosRx();
+        fcPos = fcPos < 0 ? 0 : fcPos > 2 ? 2 : fcPos;
+        settings.m_fcPosRx = (BladeRF2MIMOSettings::fcPos_t) fcPos;
+    }
+    if (deviceSettingsKeys.contains("rxBandwidth")) {
+        settings.m_rxBandwidth = swgSettings->getRxBandwidth();
+    }
+    if (deviceSettingsKeys.contains("rx0GainMode")) {
+        settings.m_rx0GainMode = swgSettings->getRx0GainMode();
+    }
+    if (deviceSettingsKeys.contains("rx0GlobalGain")) {
+        settings.m_rx0GlobalGain = swgSettings->getRx0GlobalGain();
+    }
+    if (deviceSettingsKeys.contains("rx1GainMode")) {
+        settings.m_rx1GainMode = swgSettings->getRx1GainMode();
+    }
+    if (deviceSettingsKeys.contains("rx1GlobalGain")) {
+        settings.m_rx1GlobalGain = swgSettings->getRx1GlobalGain();
+    }
+    if (deviceSettingsKeys.contains("rxBiasTee")) {
+        settings.m_rxBiasTee = swgSettings->getRxBiasTee() != 0;
+    }
+    if (deviceSettingsKeys.contains("dcBlock")) {
+        settings.m_dcBlock = swgSettings->getDcBlock() != 0;
+    }
+    if (deviceSettingsKeys.contains("iqCorrection")) {
+        settings.m_iqCorrection = swgSettings->getIqCorrection() != 0;
+    }
+    if (deviceSettingsKeys.contains("rxTransverterMode")) {
+        settings.m_rxTransverterMode = swgSettings->getRxTransverterMode() != 0;
+    }
+    if (deviceSettingsKeys.contains("rxTransverterDeltaFrequency")) {
+        settings.m_rxTransverterDeltaFrequency = swgSettings->getRxTransverterDeltaFrequency();
+    }
+    if (deviceSettingsKeys.contains("iqOrder")) {
+        settings.m_iqOrder = swgSettings->getIqOrder() != 0;
+    }
+    if (deviceSettingsKeys.contains("spectrumStreamIndex")) {
+        unsigned int index = swgSettings->getSpectrumStreamIndex();
+        settings.m_spectrumStreamIndex = index < m_nbRxStreams ? index : m_nbRxStreams - 1;
+    }
+}
+
+void BladeRF2MIMO::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const BladeRF2MIMOSettings& settings)
+{
+    SWGSDRangel::SWGBladeRF2MIMOSettings *swgSettings = response.getBladeRf2MimoSettings();
+    swgSettings->setDevSampleRate(settings.m_devSampleRate);
+    swgSettings->setLOppmTenths(settings.m_LOppmTenths);
+    swgSettings->setRxCenterFrequency(settings.m_rxCenterFrequency);
+    swgSettings->setLog2Decim(settings.m_log2Decim);
+    swgSettings->setFcPosRx((int) settings.m_fcPosRx);
+    swgSettings->setRxBandwidth(settings.m_rxBandwidth);
+    swgSettings->setRx0GainMode(settings.m_rx0GainMode);
+    swgSettings->setRx0GlobalGain(settings.m_rx0GlobalGain);
+    swgSettings->setRx1GainMode(settings.m_rx1GainMode);
+    swgSettings->setRx1GlobalGain(settings.m_rx1GlobalGain);
+    swgSettings->setRxBiasTee(settings.m_rxBiasTee ? 1 : 0);
+    swgSettings->setDcBlock(settings.m_dcBlock ? 1 : 0);
+    swgSettings->setIqCorrection(settings.m_iqCorrection ? 1 : 0);
+    swgSettings->setRxTransverterMode(settings.m_rxTransverterMode ? 1 : 0);
+    swgSettings->setRxTransverterDeltaFrequency(settings.m_rxTransverterDeltaFrequency);
+    swgSettings->setIqOrder(settings.m_iqOrder ? 1 : 0);
+    swgSettings->setSpectrumStreamIndex(settings.m_spectrumStreamIndex);
+}
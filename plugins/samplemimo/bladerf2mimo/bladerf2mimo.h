@@ -0,0 +1,202 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLUGINS_SAMPLEMIMO_BLADERF2MIMO_BLADERF2MIMO_H_
+#define PLUGINS_SAMPLEMIMO_BLADERF2MIMO_BLADERF2MIMO_H_
+
+#include <stdint.h>
+#include <vector>
+
+#include <QString>
+#include <QByteArray>
+#include <QMutex>
+
+#include "dsp/devicesamplemimo.h"
+#include "bladerf2mimosettings.h"
+
+class DeviceAPI;
+class DeviceBladeRF2;
+class BladeRF2MIThread;
+struct bladerf;
+
+/**
+ * BladeRF2 with its two Rx channels in one MIMO device set. Both channels are read in the same
+ * stream so they are sample aligned and share the LO of the device. The Tx side is not
+ * supported yet.
+ */
+class BladeRF2MIMO : public DeviceSampleMIMO {
+    Q_OBJECT
+public:
+    class MsgConfigureBladeRF2MIMO : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        const BladeRF2MIMOSettings& getSettings() const { return m_settings; }
+        bool getForce() const { return m_force; }
+
+        static MsgConfigureBladeRF2MIMO* create(const BladeRF2MIMOSettings& settings, bool force)
+        {
+            return new MsgConfigureBladeRF2MIMO(settings, force);
+        }
+
+    private:
+        BladeRF2MIMOSettings m_settings;
+        bool m_force;
+
+        MsgConfigureBladeRF2MIMO(const BladeRF2MIMOSettings& settings, bool force) :
+            Message(),
+            m_settings(settings),
+            m_force(force)
+        { }
+    };
+
+    class MsgStartStop : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        bool getStartStop() const { return m_startStop; }
+
+        static MsgStartStop* create(bool startStop) {
+            return new MsgStartStop(startStop);
+        }
+
+    protected:
+        bool m_startStop;
+
+        MsgStartStop(bool startStop) :
+            Message(),
+            m_startStop(startStop)
+        { }
+    };
+
+    class MsgReportGainRange : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        int getMin() const { return m_min; }
+        int getMax() const { return m_max; }
+        int getStep() const { return m_step; }
+
+        static MsgReportGainRange* create(int min, int max, int step) {
+            return new MsgReportGainRange(min, max, step);
+        }
+
+    protected:
+        int m_min;
+        int m_max;
+        int m_step;
+
+        MsgReportGainRange(int min, int max, int step) :
+            Message(),
+            m_min(min),
+            m_max(max),
+            m_step(step)
+        {}
+    };
+
+    struct GainMode
+    {
+        QString m_name;
+        int m_value;
+    };
+
+    BladeRF2MIMO(DeviceAPI *deviceAPI);
+    virtual ~BladeRF2MIMO();
+    virtual void destroy();
+
+    virtual void init();
+    virtual bool startRx();
+    virtual void stopRx();
+    virtual bool startTx() { return false; }
+    virtual void stopTx() {}
+
+    virtual QByteArray serialize() const;
+    virtual bool deserialize(const QByteArray& data);
+
+    virtual void setMessageQueueToGUI(MessageQueue *queue) { m_guiMessageQueue = queue; }
+    virtual const QString& getDeviceDescription() const;
+
+    virtual int getSourceSampleRate(int index) const;
+    virtual void setSourceSampleRate(int sampleRate, int index) { (void) sampleRate; (void) index; }
+    virtual quint64 getSourceCenterFrequency(int index) const;
+    virtual void setSourceCenterFrequency(qint64 centerFrequency, int index);
+
+    virtual int getSinkSampleRate(int index) const { (void) index; return 0; }
+    virtual void setSinkSampleRate(int sampleRate, int index) { (void) sampleRate; (void) index; }
+    virtual quint64 getSinkCenterFrequency(int index) const { (void) index; return 0; }
+    virtual void setSinkCenterFrequency(qint64 centerFrequency, int index) { (void) centerFrequency; (void) index; }
+
+    virtual quint64 getMIMOCenterFrequency() const { return getSourceCenterFrequency(0); }
+    virtual unsigned int getMIMOSampleRate() const { return getSourceSampleRate(0); }
+
+    void getRxFrequencyRange(uint64_t& min, uint64_t& max, int& step);
+    void getRxSampleRateRange(int& min, int& max, int& step);
+    void getRxBandwidthRange(int& min, int& max, int& step);
+    void getRxGlobalGainRange(int& min, int& max, int& step);
+    const std::vector<GainMode>& getRxGainModes() { return m_rxGainModes; }
+
+    virtual bool handleMessage(const Message& message);
+
+    virtual int webapiSettingsGet(
+                SWGSDRangel::SWGDeviceSettings& response,
+                QString& errorMessage);
+
+    virtual int webapiSettingsPutPatch(
+                bool force,
+                const QStringList& deviceSettingsKeys,
+                SWGSDRangel::SWGDeviceSettings& response, // query + response
+                QString& errorMessage);
+
+    virtual int webapiRunGet(
+            int subsystemIndex,
+            SWGSDRangel::SWGDeviceState& response,
+            QString& errorMessage);
+
+    virtual int webapiRun(
+            bool run,
+            int subsystemIndex,
+            SWGSDRangel::SWGDeviceState& response,
+            QString& errorMessage);
+
+    static void webapiFormatDeviceSettings(
+            SWGSDRangel::SWGDeviceSettings& response,
+            const BladeRF2MIMOSettings& settings);
+
+    static void webapiUpdateDeviceSettings(
+            BladeRF2MIMOSettings& settings,
+            const QStringList& deviceSettingsKeys,
+            SWGSDRangel::SWGDeviceSettings& response);
+
+    static const unsigned int m_nbRxStreams = 2;
+
+private:
+    DeviceAPI *m_deviceAPI;
+    QMutex m_mutex;
+    BladeRF2MIMOSettings m_settings;
+    QString m_deviceDescription;
+    bool m_running;
+    DeviceBladeRF2 *m_dev;
+    BladeRF2MIThread *m_thread;
+    std::vector<GainMode> m_rxGainModes;
+
+    bool openDevice();
+    void closeDevice();
+    bool applySettings(const BladeRF2MIMOSettings& settings, bool force);
+    bool setRxDeviceCenterFrequency(struct bladerf *dev, quint64 freq_hz, int loPpmTenths);
+};
+
+#endif /* PLUGINS_SAMPLEMIMO_BLADERF2MIMO_BLADERF2MIMO_H_ */
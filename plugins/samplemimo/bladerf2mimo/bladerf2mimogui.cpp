@@ -0,0 +1,431 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+#include <QMessageBox>
+
+#include <libbladeRF.h>
+
+#include "ui_bladerf2mimogui.h"
+#include "gui/colormapper.h"
+#include "gui/glspectrum.h"
+#include "dsp/dspcommands.h"
+#include "device/deviceapi.h"
+#include "device/deviceuiset.h"
+
+#include "bladerf2mimogui.h"
+
+BladeRF2MIMOGui::BladeRF2MIMOGui(DeviceUISet *deviceUISet, QWidget* parent) :
+    QWidget(parent),
+    ui(new Ui::BladeRF2MIMOGui),
+    m_deviceUISet(deviceUISet),
+    m_settings(),
+    m_doApplySettings(true),
+    m_forceSettings(true),
+    m_sampleMIMO(nullptr),
+    m_deviceSampleRate(3072000),
+    m_deviceCenterFrequency(0),
+    m_lastEngineState(DeviceAPI::StNotStarted)
+{
+    qDebug("BladeRF2MIMOGui::BladeRF2MIMOGui");
+    m_sampleMIMO = (BladeRF2MIMO*) m_deviceUISet->m_deviceAPI->getSampleMIMO();
+    int max, min, step;
+    uint64_t f_min, f_max;
+
+    ui->setupUi(this);
+
+    m_sampleMIMO->getRxFrequencyRange(f_min, f_max, step);
+    ui->centerFrequency->setColorMapper(ColorMapper(ColorMapper::GrayGold));
+    ui->centerFrequency->setValueRange(7, f_min/1000, f_max/1000);
+
+    m_sampleMIMO->getRxSampleRateRange(min, max, step);
+    ui->sampleRate->setColorMapper(ColorMapper(ColorMapper::GrayGreenYellow));
+    ui->sampleRate->setValueRange(8, min, max);
+
+    m_sampleMIMO->getRxBandwidthRange(min, max, step);
+    ui->bandwidth->setColorMapper(ColorMapper(ColorMapper::GrayYellow));
+    ui->bandwidth->setValueRange(5, min/1000, max/1000);
+
+    const std::vector<BladeRF2MIMO::GainMode>& modes = m_sampleMIMO->getRxGainModes();
+    ui->rx0GainMode->blockSignals(true);
+    ui->rx1GainMode->blockSignals(true);
+
+    for (const auto& mode : modes)
+    {
+        ui->rx0GainMode->addItem(mode.m_name);
+        ui->rx1GainMode->addItem(mode.m_name);
+    }
+
+    ui->rx0GainMode->blockSignals(false);
+    ui->rx1GainMode->blockSignals(false);
+
+    m_sampleMIMO->getRxGlobalGainRange(min, max, step);
+
+    for (QDial *gain : {ui->rx0Gain, ui->rx1Gain})
+    {
+        gain->setMinimum(min);
+        gain->setMaximum(max);
+        gain->setPageStep(step);
+        gain->setSingleStep(step);
+    }
+
+    displaySettings();
+
+    connect(&m_updateTimer, SIGNAL(timeout()), this, SLOT(updateHardware()));
+    connect(&m_statusTimer, SIGNAL(timeout()), this, SLOT(updateStatus()));
+    m_statusTimer.start(500);
+
+    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()), Qt::QueuedConnection);
+    m_sampleMIMO->setMessageQueueToGUI(&m_inputMessageQueue);
+
+    sendSettings();
+}
+
+BladeRF2MIMOGui::~BladeRF2MIMOGui()
+{
+    delete ui;
+}
+
+void BladeRF2MIMOGui::destroy()
+{
+    delete this;
+}
+
+void BladeRF2MIMOGui::setName(const QString& name)
+{
+    setObjectName(name);
+}
+
+QString BladeRF2MIMOGui::getName() const
+{
+    return objectName();
+}
+
+void BladeRF2MIMOGui::resetToDefaults()
+{
+    m_settings.resetToDefaults();
+    displaySettings();
+    sendSettings();
+}
+
+qint64 BladeRF2MIMOGui::getCenterFrequency() const
+{
+    return m_settings.m_rxCenterFrequency;
+}
+
+void BladeRF2MIMOGui::setCenterFrequency(qint64 centerFrequency)
+{
+    m_settings.m_rxCenterFrequency = centerFrequency;
+    displaySettings();
+    sendSettings();
+}
+
+QByteArray BladeRF2MIMOGui::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool BladeRF2MIMOGui::deserialize(const QByteArray& data)
+{
+    if (m_settings.deserialize(data))
+    {
+        displaySettings();
+        m_forceSettings = true;
+        sendSettings();
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
+
+void BladeRF2MIMOGui::on_startStop_toggled(bool checked)
+{
+    if (m_doApplySettings)
+    {
+        BladeRF2MIMO::MsgStartStop *message = BladeRF2MIMO::MsgStartStop::create(checked);
+        m_sampleMIMO->getInputMessageQueue()->push(message);
+    }
+}
+
+void BladeRF2MIMOGui::on_centerFrequency_changed(quint64 value)
+{
+    m_settings.m_rxCenterFrequency = value * 1000;
+    sendSettings();
+}
+
+void BladeRF2MIMOGui::on_LOppm_valueChanged(int value)
+{
+    ui->LOppmText->setText(QString("%1").arg(QString::number(value/10.0, 'f', 1)));
+    m_settings.m_LOppmTenths = value;
+    sendSettings();
+}
+
+void BladeRF2MIMOGui::on_dcOffset_toggled(bool checked)
+{
+    m_settings.m_dcBlock = checked;
+    sendSettings();
+}
+
+void BladeRF2MIMOGui::on_iqImbalance_toggled(bool checked)
+{
+    m_settings.m_iqCorrection = checked;
+    sendSettings();
+}
+
+void BladeRF2MIMOGui::on_biasTee_toggled(bool checked)
+{
+    m_settings.m_rxBiasTee = checked;
+    sendSettings();
+}
+
+void BladeRF2MIMOGui::on_sampleRate_changed(quint64 value)
+{
+    m_settings.m_devSampleRate = value;
+    sendSettings();
+}
+
+void BladeRF2MIMOGui::on_decim_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index > 6)) {
+        return;
+    }
+
+    m_settings.m_log2Decim = index;
+    sendSettings();
+}
+
+void BladeRF2MIMOGui::on_fcPos_currentIndexChanged(int index)
+{
+    m_settings.m_fcPosRx = (BladeRF2MIMOSettings::fcPos_t) (index < 0 ? 0 : index > 2 ? 2 : index);
+    sendSettings();
+}
+
+void BladeRF2MIMOGui::on_bandwidth_changed(quint64 value)
+{
+    m_settings.m_rxBandwidth = value * 1000;
+    sendSettings();
+}
+
+void BladeRF2MIMOGui::on_spectrumSource_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index >= (int) BladeRF2MIMO::m_nbRxStreams)) {
+        return;
+    }
+
+    m_settings.m_spectrumStreamIndex = index;
+    sendSettings();
+}
+
+void BladeRF2MIMOGui::setGainMode(int index, int& gainMode, int& globalGain, int gainValue, QDial *gainDial)
+{
+    const std::vector<BladeRF2MIMO::GainMode>& modes = m_sampleMIMO->getRxGainModes();
+    unsigned int uindex = index < 0 ? 0 : (unsigned int) index;
+
+    if (uindex < modes.size())
+    {
+        const BladeRF2MIMO::GainMode& mode = modes[uindex];
+
+        if ((gainMode != mode.m_value) && (mode.m_value == BLADERF_GAIN_MANUAL)) {
+            globalGain = gainValue;
+        }
+
+        gainDial->setEnabled(mode.m_value == BLADERF_GAIN_MANUAL);
+        gainMode = mode.m_value;
+        sendSettings();
+    }
+}
+
+void BladeRF2MIMOGui::on_rx0GainMode_currentIndexChanged(int index)
+{
+    setGainMode(index, m_settings.m_rx0GainMode, m_settings.m_rx0GlobalGain, ui->rx0Gain->value(), ui->rx0Gain);
+}
+
+void BladeRF2MIMOGui::on_rx0Gain_valueChanged(int value)
+{
+    ui->rx0GainText->setText(tr("%1").arg(value));
+    m_settings.m_rx0GlobalGain = value;
+    sendSettings();
+}
+
+void BladeRF2MIMOGui::on_rx1GainMode_currentIndexChanged(int index)
+{
+    setGainMode(index, m_settings.m_rx1GainMode, m_settings.m_rx1GlobalGain, ui->rx1Gain->value(), ui->rx1Gain);
+}
+
+void BladeRF2MIMOGui::on_rx1Gain_valueChanged(int value)
+{
+    ui->rx1GainText->setText(tr("%1").arg(value));
+    m_settings.m_rx1GlobalGain = value;
+    sendSettings();
+}
+
+void BladeRF2MIMOGui::displayGain(int gainMode, int globalGain, QDial *gainDial)
+{
+    gainDial->setValue(globalGain);
+    gainDial->setEnabled(gainMode == BLADERF_GAIN_MANUAL);
+}
+
+void BladeRF2MIMOGui::displaySettings()
+{
+    blockApplySettings(true);
+    ui->centerFrequency->setValue(m_settings.m_rxCenterFrequency / 1000);
+    ui->LOppm->setValue(m_settings.m_LOppmTenths);
+    ui->LOppmText->setText(QString("%1").arg(QString::number(m_settings.m_LOppmTenths/10.0, 'f', 1)));
+    ui->dcOffset->setChecked(m_settings.m_dcBlock);
+    ui->iqImbalance->setChecked(m_settings.m_iqCorrection);
+    ui->biasTee->setChecked(m_settings.m_rxBiasTee);
+    ui->sampleRate->setValue(m_settings.m_devSampleRate);
+    ui->decim->setCurrentIndex(m_settings.m_log2Decim);
+    ui->fcPos->setCurrentIndex((int) m_settings.m_fcPosRx);
+    ui->bandwidth->setValue(m_settings.m_rxBandwidth / 1000);
+    ui->spectrumSource->setCurrentIndex(m_settings.m_spectrumStreamIndex);
+    ui->rx0GainMode->setCurrentIndex(m_settings.m_rx0GainMode);
+    ui->rx0GainText->setText(tr("%1").arg(m_settings.m_rx0GlobalGain));
+    displayGain(m_settings.m_rx0GainMode, m_settings.m_rx0GlobalGain, ui->rx0Gain);
+    ui->rx1GainMode->setCurrentIndex(m_settings.m_rx1GainMode);
+    ui->rx1GainText->setText(tr("%1").arg(m_settings.m_rx1GlobalGain));
+    displayGain(m_settings.m_rx1GainMode, m_settings.m_rx1GlobalGain, ui->rx1Gain);
+    blockApplySettings(false);
+}
+
+void BladeRF2MIMOGui::sendSettings()
+{
+    if (!m_updateTimer.isActive()) {
+        m_updateTimer.start(100);
+    }
+}
+
+void BladeRF2MIMOGui::updateHardware()
+{
+    if (m_doApplySettings)
+    {
+        BladeRF2MIMO::MsgConfigureBladeRF2MIMO* message = BladeRF2MIMO::MsgConfigureBladeRF2MIMO::create(m_settings, m_forceSettings);
+        m_sampleMIMO->getInputMessageQueue()->push(message);
+        m_forceSettings = false;
+        m_updateTimer.stop();
+    }
+}
+
+void BladeRF2MIMOGui::updateStatus()
+{
+    int state = m_deviceUISet->m_deviceAPI->state(0);
+
+    if (m_lastEngineState != state)
+    {
+        switch(state)
+        {
+            case DeviceAPI::StNotStarted:
+                ui->startStop->setStyleSheet("QToolButton { background:rgb(79,79,79); }");
+                break;
+            case DeviceAPI::StIdle:
+                ui->startStop->setStyleSheet("QToolButton { background-color : blue; }");
+                break;
+            case DeviceAPI::StRunning:
+                ui->startStop->setStyleSheet("QToolButton { background-color : green; }");
+                break;
+            case DeviceAPI::StError:
+                ui->startStop->setStyleSheet("QToolButton { background-color : red; }");
+                QMessageBox::information(this, tr("Message"), m_deviceUISet->m_deviceAPI->errorMessage(0));
+                break;
+            default:
+                break;
+        }
+
+        m_lastEngineState = state;
+    }
+}
+
+bool BladeRF2MIMOGui::handleMessage(const Message& message)
+{
+    if (BladeRF2MIMO::MsgConfigureBladeRF2MIMO::match(message))
+    {
+        qDebug("BladeRF2MIMOGui::handleMessage: MsgConfigureBladeRF2MIMO");
+        const BladeRF2MIMO::MsgConfigureBladeRF2MIMO& cfg = (BladeRF2MIMO::MsgConfigureBladeRF2MIMO&) message;
+        m_settings = cfg.getSettings();
+        displaySettings();
+        return true;
+    }
+    else if (BladeRF2MIMO::MsgReportGainRange::match(message))
+    {
+        const BladeRF2MIMO::MsgReportGainRange& cfg = (BladeRF2MIMO::MsgReportGainRange&) message;
+
+        for (QDial *gain : {ui->rx0Gain, ui->rx1Gain})
+        {
+            gain->setMinimum(cfg.getMin());
+            gain->setMaximum(cfg.getMax());
+            gain->setSingleStep(cfg.getStep());
+            gain->setPageStep(cfg.getStep());
+        }
+
+        return true;
+    }
+    else if (BladeRF2MIMO::MsgStartStop::match(message))
+    {
+        qDebug("BladeRF2MIMOGui::handleMessage: MsgStartStop");
+        BladeRF2MIMO::MsgStartStop& notif = (BladeRF2MIMO::MsgStartStop&) message;
+        blockApplySettings(true);
+        ui->startStop->setChecked(notif.getStartStop());
+        blockApplySettings(false);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void BladeRF2MIMOGui::handleInputMessages()
+{
+    Message* message;
+
+    while ((message = m_inputMessageQueue.pop()) != 0)
+    {
+        if (DSPMIMOSignalNotification::match(*message))
+        {
+            DSPMIMOSignalNotification* notif = (DSPMIMOSignalNotification*) message;
+
+            // both channels share the same rate and frequency
+            if (notif->getSourceOrSink() && (notif->getIndex() == 0))
+            {
+                m_deviceSampleRate = notif->getSampleRate();
+                m_deviceCenterFrequency = notif->getCenterFrequency();
+                qDebug("BladeRF2MIMOGui::handleInputMessages: DSPMIMOSignalNotification: SampleRate:%d, CenterFrequency:%llu",
+                        notif->getSampleRate(),
+                        notif->getCenterFrequency());
+                updateSampleRateAndFrequency();
+            }
+
+            delete message;
+        }
+        else
+        {
+            if (handleMessage(*message)) {
+                delete message;
+            }
+        }
+    }
+}
+
+void BladeRF2MIMOGui::updateSampleRateAndFrequency()
+{
+    m_deviceUISet->getSpectrum()->setSampleRate(m_deviceSampleRate);
+    m_deviceUISet->getSpectrum()->setCenterFrequency(m_deviceCenterFrequency);
+    ui->deviceRateText->setText(tr("%1k").arg((float)m_deviceSampleRate / 1000));
+}
@@ -0,0 +1,99 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _BLADERF2MIMO_BLADERF2MIMOGUI_H_
+#define _BLADERF2MIMO_BLADERF2MIMOGUI_H_
+
+#include <plugin/plugininstancegui.h>
+#include <QTimer>
+#include <QWidget>
+
+#include "util/messagequeue.h"
+
+#include "bladerf2mimosettings.h"
+#include "bladerf2mimo.h"
+
+class DeviceUISet;
+class QDial;
+
+namespace Ui {
+	class BladeRF2MIMOGui;
+}
+
+class BladeRF2MIMOGui : public QWidget, public PluginInstanceGUI {
+	Q_OBJECT
+
+public:
+	explicit BladeRF2MIMOGui(DeviceUISet *deviceUISet, QWidget* parent = 0);
+	virtual ~BladeRF2MIMOGui();
+	virtual void destroy();
+
+	void setName(const QString& name);
+	QString getName() const;
+
+	void resetToDefaults();
+	virtual qint64 getCenterFrequency() const;
+	virtual void setCenterFrequency(qint64 centerFrequency);
+	QByteArray serialize() const;
+	bool deserialize(const QByteArray& data);
+	virtual MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; }
+	virtual bool handleMessage(const Message& message);
+
+private:
+	Ui::BladeRF2MIMOGui* ui;
+
+	DeviceUISet* m_deviceUISet;
+	BladeRF2MIMOSettings m_settings;
+    QTimer m_updateTimer;
+    QTimer m_statusTimer;
+	bool m_doApplySettings;
+    bool m_forceSettings;
+	BladeRF2MIMO* m_sampleMIMO;
+    int m_deviceSampleRate;
+    quint64 m_deviceCenterFrequency; //!< Center frequency in device
+	int m_lastEngineState;
+	MessageQueue m_inputMessageQueue;
+
+	void blockApplySettings(bool block) { m_doApplySettings = !block; }
+	void displaySettings();
+    void displayGain(int gainMode, int globalGain, QDial *gainDial);
+	void sendSettings();
+    void updateSampleRateAndFrequency();
+    void setGainMode(int index, int& gainMode, int& globalGain, int gainValue, QDial *gainDial);
+
+private slots:
+    void handleInputMessages();
+	void on_startStop_toggled(bool checked);
+    void on_centerFrequency_changed(quint64 value);
+    void on_LOppm_valueChanged(int value);
+    void on_dcOffset_toggled(bool checked);
+    void on_iqImbalance_toggled(bool checked);
+    void on_biasTee_toggled(bool checked);
+    void on_sampleRate_changed(quint64 value);
+    void on_decim_currentIndexChanged(int index);
+    void on_fcPos_currentIndexChanged(int index);
+    void on_bandwidth_changed(quint64 value);
+    void on_spectrumSource_currentIndexChanged(int index);
+    void on_rx0GainMode_currentIndexChanged(int index);
+    void on_rx0Gain_valueChanged(int value);
+    void on_rx1GainMode_currentIndexChanged(int index);
+    void on_rx1Gain_valueChanged(int value);
+    void updateStatus();
+    void updateHardware();
+};
+
+#endif // _BLADERF2MIMO_BLADERF2MIMOGUI_H_
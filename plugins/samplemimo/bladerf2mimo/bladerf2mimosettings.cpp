@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "bladerf2mimosettings.h"
+
+#include "util/simpleserializer.h"
+
+BladeRF2MIMOSettings::BladeRF2MIMOSettings()
+{
+    resetToDefaults();
+}
+
+void BladeRF2MIMOSettings::resetToDefaults()
+{
+    m_devSampleRate = 3072000;
+    m_LOppmTenths = 0;
+    m_rxCenterFrequency = 435000*1000;
+    m_log2Decim = 0;
+    m_fcPosRx = FC_POS_CENTER;
+    m_rxBandwidth = 1500000;
+    m_rx0GainMode = 0;
+    m_rx0GlobalGain = 0;
+    m_rx1GainMode = 0;
+    m_rx1GlobalGain = 0;
+    m_rxBiasTee = false;
+    m_dcBlock = false;
+    m_iqCorrection = false;
+    m_rxTransverterMode = false;
+    m_rxTransverterDeltaFrequency = 0;
+    m_iqOrder = true;
+    m_spectrumStreamIndex = 0;
+}
+
+QByteArray BladeRF2MIMOSettings::serialize() const
+{
+    SimpleSerializer s(1);
+
+    s.writeS32(1, m_devSampleRate);
+    s.writeS32(2, m_LOppmTenths);
+    s.writeU64(3, m_rxCenterFrequency);
+    s.writeU32(4, m_log2Decim);
+    s.writeS32(5, (int) m_fcPosRx);
+    s.writeS32(6, m_rxBandwidth);
+    s.writeS32(7, m_rx0GainMode);
+    s.writeS32(8, m_rx0GlobalGain);
+    s.writeS32(9, m_rx1GainMode);
+    s.writeS32(10, m_rx1GlobalGain);
+    s.writeBool(11, m_rxBiasTee);
+    s.writeBool(12, m_dcBlock);
+    s.writeBool(13, m_iqCorrection);
+    s.writeBool(14, m_rxTransverterMode);
+    s.writeS64(15, m_rxTransverterDeltaFrequency);
+    s.writeBool(16, m_iqOrder);
+    s.writeU32(17, m_spectrumStreamIndex);
+
+    return s.final();
+}
+
+bool BladeRF2MIMOSettings::deserialize(const QByteArray& data)
+{
+    SimpleDeserializer d(data);
+
+    if (!d.isValid())
+    {
+        resetToDefaults();
+        return false;
+    }
+
+    if (d.getVersion() == 1)
+    {
+        int intval;
+        uint32_t uintval;
+
+        d.readS32(1, &m_devSampleRate, 3072000);
+        d.readS32(2, &m_LOppmTenths, 0);
+        d.readU64(3, &m_rxCenterFrequency, 435000*1000);
+        d.readU32(4, &m_log2Decim, 0);
+        d.readS32(5, &intval, (int) FC_POS_CENTER);
+        m_fcPosRx = intval < 0 ? FC_POS_INFRA : intval > 2 ? FC_POS_CENTER : (fcPos_t) intval;
+        d.readS32(6, &m_rxBandwidth, 1500000);
+        d.readS32(7, &m_rx0GainMode, 0);
+        d.readS32(8, &m_rx0GlobalGain, 0);
+        d.readS32(9, &m_rx1GainMode, 0);
+        d.readS32(10, &m_rx1GlobalGain, 0);
+        d.readBool(11, &m_rxBiasTee, false);
+        d.readBool(12, &m_dcBlock, false);
+        d.readBool(13, &m_iqCorrection, false);
+        d.readBool(14, &m_rxTransverterMode, false);
+        d.readS64(15, &m_rxTransverterDeltaFrequency, 0);
+        d.readBool(16, &m_iqOrder, true);
+        d.readU32(17, &uintval, 0);
+        m_spectrumStreamIndex = uintval > 1 ? 1 : uintval;
+
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
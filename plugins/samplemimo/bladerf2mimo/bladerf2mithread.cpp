@@ -0,0 +1,231 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "bladerf2/devicebladerf2.h"
+#include "dsp/samplemififo.h"
+
+#include "bladerf2mithread.h"
+
+BladeRF2MIThread::BladeRF2MIThread(struct bladerf* dev, QObject* parent) :
+    QThread(parent),
+    m_running(false),
+    m_dev(dev),
+    m_sampleFifo(nullptr),
+    m_log2Decim(0),
+    m_fcPos(0),
+    m_iqOrder(true)
+{
+    qDebug("BladeRF2MIThread::BladeRF2MIThread");
+
+    for (unsigned int i = 0; i < m_nbChannels; i++) {
+        m_convertBuffer[i].resize(DeviceBladeRF2::blockSize, Sample{0,0});
+    }
+
+    m_buf = new qint16[2*DeviceBladeRF2::blockSize*m_nbChannels];
+}
+
+BladeRF2MIThread::~BladeRF2MIThread()
+{
+    qDebug("BladeRF2MIThread::~BladeRF2MIThread");
+
+    if (m_running) {
+        stopWork();
+    }
+
+    delete[] m_buf;
+}
+
+void BladeRF2MIThread::startWork()
+{
+    m_startWaitMutex.lock();
+    start();
+
+    while(!m_running) {
+        m_startWaiter.wait(&m_startWaitMutex, 100);
+    }
+
+    m_startWaitMutex.unlock();
+}
+
+void BladeRF2MIThread::stopWork()
+{
+    m_running = false;
+    wait();
+}
+
+void BladeRF2MIThread::run()
+{
+    int res;
+
+    m_running = true;
+    m_startWaiter.wakeAll();
+
+    if (m_sampleFifo)
+    {
+        int status = bladerf_sync_config(m_dev, BLADERF_RX_X2, BLADERF_FORMAT_SC16_Q11, 64, 8192, 32, 10000);
+
+        if (status < 0)
+        {
+            qCritical("BladeRF2MIThread::run: cannot configure streams: %s", bladerf_strerror(status));
+        }
+        else
+        {
+            qDebug("BladeRF2MIThread::run: start running loop");
+
+            while (m_running)
+            {
+                res = bladerf_sync_rx(m_dev, m_buf, DeviceBladeRF2::blockSize*m_nbChannels, NULL, 10000);
+
+                if (res < 0)
+                {
+                    qCritical("BladeRF2MIThread::run sync Rx error: %s", bladerf_strerror(res));
+                    break;
+                }
+
+                callback(m_buf, DeviceBladeRF2::blockSize);
+            }
+
+            qDebug("BladeRF2MIThread::run: stop running loop");
+        }
+    }
+    else
+    {
+        qWarning("BladeRF2MIThread::run: no FIFO allocated. Aborting");
+    }
+
+    m_running = false;
+}
+
+void BladeRF2MIThread::callback(const qint16* buf, qint32 samplesPerChannel)
+{
+    int status = bladerf_deinterleave_stream_buffer(BLADERF_RX_X2, BLADERF_FORMAT_SC16_Q11 , samplesPerChannel*m_nbChannels, (void *) buf);
+
+    if (status < 0)
+    {
+        qCritical("BladeRF2MIThread::callback: cannot de-interleave buffer: %s", bladerf_strerror(status));
+        return;
+    }
+
+    std::vector<SampleVector::const_iterator> vbegin;
+    int nbDecimatedSamples = 0;
+
+    for (unsigned int channel = 0; channel < m_nbChannels; channel++)
+    {
+        SampleVector::iterator it = m_convertBuffer[channel].begin();
+
+        if (m_iqOrder) {
+            decimate(m_decimatorsIQ[channel], &it, &buf[2*samplesPerChannel*channel], 2*samplesPerChannel);
+        } else {
+            decimate(m_decimatorsQI[channel], &it, &buf[2*samplesPerChannel*channel], 2*samplesPerChannel);
+        }
+
+        vbegin.push_back(m_convertBuffer[channel].begin());
+        nbDecimatedSamples = it - m_convertBuffer[channel].begin(); // same for all channels
+    }
+
+    m_sampleFifo->writeSync(vbegin, nbDecimatedSamples);
+}
+
+template<class DecimatorsType>
+void BladeRF2MIThread::decimate(DecimatorsType& decimators, SampleVector::iterator* it, const qint16* buf, qint32 len)
+{
+    if (m_log2Decim == 0)
+    {
+        decimators.decimate1(it, buf, len);
+    }
+    else
+    {
+        if (m_fcPos == 0) // Infra
+        {
+            switch (m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_inf(it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_inf(it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_inf(it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_inf(it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_inf(it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_inf(it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_fcPos == 1) // Supra
+        {
+            switch (m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_sup(it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_sup(it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_sup(it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_sup(it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_sup(it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_sup(it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_fcPos == 2) // Center
+        {
+            switch (m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_cen(it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_cen(it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_cen(it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_cen(it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_cen(it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_cen(it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,766 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include <QDebug>
+
+#include "SWGDeviceSettings.h"
+#include "SWGDeviceState.h"
+#include "SWGLimeSdrMIMOSettings.h"
+
+#include "device/deviceapi.h"
+#include "dsp/dspcommands.h"
+#include "dsp/devicesamplesource.h"
+#include "limesdr/devicelimesdr.h"
+#include "limesdr/devicelimesdrparam.h"
+
+#include "limesdrmithread.h"
+#include "limesdrmimo.h"
+
+MESSAGE_CLASS_DEFINITION(LimeSDRMIMO::MsgConfigureLimeSDRMIMO, Message)
+MESSAGE_CLASS_DEFINITION(LimeSDRMIMO::MsgStartStop, Message)
+
+LimeSDRMIMO::LimeSDRMIMO(DeviceAPI *deviceAPI) :
+    m_deviceAPI(deviceAPI),
+    m_settings(),
+    m_deviceDescription("LimeSDRMIMO"),
+    m_running(false),
+    m_deviceParams(nullptr),
+    m_streamsSetUp(false),
+    m_thread(nullptr)
+{
+    m_mimoType = MIMOHalfSynchronous;
+    m_sampleMIFifo.init(m_nbRxStreams, 96000 * 4);
+    m_deviceAPI->setNbSourceStreams(m_nbRxStreams);
+    m_deviceAPI->setNbSinkStreams(0);
+    openDevice();
+}
+
+LimeSDRMIMO::~LimeSDRMIMO()
+{
+    if (m_running) {
+        stopRx();
+    }
+
+    closeDevice();
+}
+
+void LimeSDRMIMO::destroy()
+{
+    delete this;
+}
+
+bool LimeSDRMIMO::openDevice()
+{
+    // The MIMO device set owns the whole physical device so there are no buddies to look for
+    m_deviceParams = new DeviceLimeSDRParams();
+    char serial[256];
+    strcpy(serial, qPrintable(m_deviceAPI->getSamplingDeviceSerial()));
+
+    if (!m_deviceParams->open(serial))
+    {
+        qCritical("LimeSDRMIMO::openDevice: cannot open LimeSDR device");
+        delete m_deviceParams;
+        m_deviceParams = nullptr;
+        return false;
+    }
+
+    if (m_deviceParams->m_nbRxChannels < m_nbRxStreams)
+    {
+        qCritical("LimeSDRMIMO::openDevice: device has only %u Rx channels", m_deviceParams->m_nbRxChannels);
+        m_deviceParams->close();
+        delete m_deviceParams;
+        m_deviceParams = nullptr;
+        return false;
+    }
+
+    for (unsigned int i = 0; i < m_nbRxStreams; i++)
+    {
+        if (LMS_EnableChannel(m_deviceParams->getDevice(), LMS_CH_RX, i, true) != 0) {
+            qCritical("LimeSDRMIMO::openDevice: cannot enable Rx channel %u", i);
+        } else {
+            qDebug("LimeSDRMIMO::openDevice: Rx channel %u enabled", i);
+        }
+    }
+
+    qDebug("LimeSDRMIMO::openDevice: device opened");
+    return true;
+}
+
+void LimeSDRMIMO::closeDevice()
+{
+    if (m_deviceParams == nullptr) { // was never open
+        return;
+    }
+
+    if (m_running) {
+        stopRx();
+    }
+
+    for (unsigned int i = 0; i < m_nbRxStreams; i++)
+    {
+        if (LMS_EnableChannel(m_deviceParams->getDevice(), LMS_CH_RX, i, false) != 0) {
+            qWarning("LimeSDRMIMO::closeDevice: cannot disable Rx channel %u", i);
+        }
+    }
+
+    m_deviceParams->close();
+    delete m_deviceParams;
+    m_deviceParams = nullptr;
+}
+
+bool LimeSDRMIMO::setupStreams()
+{
+    for (unsigned int i = 0; i < m_nbRxStreams; i++)
+    {
+        m_streams[i].channel = i;                            // channel number
+        m_streams[i].fifoSize = 1024 * 1024;                 // fifo size in samples (SR / 10 take ~5MS/s)
+        m_streams[i].throughputVsLatency = 0.5;              // optimize for min latency
+        m_streams[i].isTx = false;                           // RX channel
+        m_streams[i].dataFmt = lms_stream_t::LMS_FMT_I12;    // 12-bit integers
+
+        if (LMS_SetupStream(m_deviceParams->getDevice(), &m_streams[i]) != 0)
+        {
+            qCritical("LimeSDRMIMO::setupStreams: cannot setup the stream on Rx channel %u", i);
+
+            for (unsigned int j = 0; j < i; j++) {
+                LMS_DestroyStream(m_deviceParams->getDevice(), &m_streams[j]);
+            }
+
+            return false;
+        }
+    }
+
+    qDebug("LimeSDRMIMO::setupStreams: streams set up on both Rx channels");
+    m_streamsSetUp = true;
+    return true;
+}
+
+void LimeSDRMIMO::destroyStreams()
+{
+    if (!m_streamsSetUp) {
+        return;
+    }
+
+    for (unsigned int i = 0; i < m_nbRxStreams; i++)
+    {
+        if (LMS_DestroyStream(m_deviceParams->getDevice(), &m_streams[i]) != 0) {
+            qWarning("LimeSDRMIMO::destroyStreams: cannot destroy the stream on Rx channel %u", i);
+        }
+
+        m_streams[i].handle = 0;
+    }
+
+    m_streamsSetUp = false;
+}
+
+void LimeSDRMIMO::init()
+{
+    applySettings(m_settings, true);
+}
+
+bool LimeSDRMIMO::startRx()
+{
+    qDebug("LimeSDRMIMO::startRx");
+
+    if (!m_deviceParams)
+    {
+        qDebug("LimeSDRMIMO::startRx: no device object");
+        return false;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_running) {
+        return true;
+    }
+
+    if (!setupStreams()) {
+        return false;
+    }
+
+    m_sampleMIFifo.reset();
+    m_thread = new LimeSDRMIThread(&m_streams[0], &m_streams[1]);
+    m_thread->setFifo(&m_sampleMIFifo);
+    m_thread->setLog2Decimation(m_settings.m_log2SoftDecim);
+    m_thread->setFcPos((int) m_settings.m_fcPosRx);
+    m_thread->setIQOrder(m_settings.m_iqOrder);
+    m_thread->startWork();
+    m_running = true;
+
+    return true;
+}
+
+void LimeSDRMIMO::stopRx()
+{
+    qDebug("LimeSDRMIMO::stopRx");
+
+    if (!m_thread) {
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    m_thread->stopWork();
+    delete m_thread;
+    m_thread = nullptr;
+    destroyStreams();
+    m_running = false;
+}
+QByteArray LimeSDRMIMO::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool LimeSDRMIMO::deserialize(const QByteArray& data)
+{
+    bool success = true;
+
+    if (!m_settings.deserialize(data))
+    {
+        m_settings.resetToDefaults();
+        success = false;
+    }
+
+    MsgConfigureLimeSDRMIMO* message = MsgConfigureLimeSDRMIMO::create(m_settings, true);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue)
+    {
+        MsgConfigureLimeSDRMIMO* messageToGUI = MsgConfigureLimeSDRMIMO::create(m_settings, true);
+        m_guiMessageQueue->push(messageToGUI);
+    }
+
+    return success;
+}
+
+const QString& LimeSDRMIMO::getDeviceDescription() const
+{
+    return m_deviceDescription;
+}
+
+int LimeSDRMIMO::getSourceSampleRate(int index) const
+{
+    (void) index; // both channels share the sample clock
+    return m_settings.m_devSampleRate/(1<<m_settings.m_log2SoftDecim);
+}
+
+quint64 LimeSDRMIMO::getSourceCenterFrequency(int index) const
+{
+    (void) index; // both channels share the local oscillator
+    return m_settings.m_rxCenterFrequency;
+}
+
+void LimeSDRMIMO::setSourceCenterFrequency(qint64 centerFrequency, int index)
+{
+    (void) index;
+    LimeSDRMIMOSettings settings = m_settings;
+    settings.m_rxCenterFrequency = centerFrequency;
+
+    MsgConfigureLimeSDRMIMO* message = MsgConfigureLimeSDRMIMO::create(settings, false);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue)
+    {
+        MsgConfigureLimeSDRMIMO* messageToGUI = MsgConfigureLimeSDRMIMO::create(settings, false);
+        m_guiMessageQueue->push(messageToGUI);
+    }
+}
+
+void LimeSDRMIMO::getRxFrequencyRange(float& minF, float& maxF) const
+{
+    if (m_deviceParams)
+    {
+        minF = m_deviceParams->m_loRangeRx.min;
+        maxF = m_deviceParams->m_loRangeRx.max;
+    }
+}
+
+void LimeSDRMIMO::getRxSampleRateRange(float& minF, float& maxF) const
+{
+    if (m_deviceParams)
+    {
+        minF = m_deviceParams->m_srRangeRx.min;
+        maxF = m_deviceParams->m_srRangeRx.max;
+    }
+}
+
+void LimeSDRMIMO::getRxLPFRange(float& minF, float& maxF) const
+{
+    if (m_deviceParams)
+    {
+        minF = m_deviceParams->m_lpfRangeRx.min;
+        maxF = m_deviceParams->m_lpfRangeRx.max;
+    }
+}
+
+bool LimeSDRMIMO::handleMessage(const Message& message)
+{
+    if (MsgConfigureLimeSDRMIMO::match(message))
+    {
+        MsgConfigureLimeSDRMIMO& conf = (MsgConfigureLimeSDRMIMO&) message;
+        qDebug() << "LimeSDRMIMO::handleMessage: MsgConfigureLimeSDRMIMO";
+
+        if (!applySettings(conf.getSettings(), conf.getForce())) {
+            qDebug("LimeSDRMIMO::handleMessage: config error");
+        }
+
+        return true;
+    }
+    else if (MsgStartStop::match(message))
+    {
+        MsgStartStop& cmd = (MsgStartStop&) message;
+        qDebug() << "LimeSDRMIMO::handleMessage: MsgStartStop: " << (cmd.getStartStop() ? "start" : "stop");
+
+        if (cmd.getStartStop())
+        {
+            if (m_deviceAPI->initDeviceEngine(0)) {
+                m_deviceAPI->startDeviceEngine(0);
+            }
+        }
+        else
+        {
+            m_deviceAPI->stopDeviceEngine(0);
+        }
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+
+bool LimeSDRMIMO::applySettings(const LimeSDRMIMOSettings& settings, bool force)
+{
+    qDebug() << "LimeSDRMIMO::applySettings: "
+            << " m_rxCenterFrequency: " << settings.m_rxCenterFrequency << " Hz"
+            << " m_devSampleRate: " << settings.m_devSampleRate
+            << " m_log2HardDecim: " << settings.m_log2HardDecim
+            << " m_log2SoftDecim: " << settings.m_log2SoftDecim
+            << " m_fcPosRx: " << settings.m_fcPosRx
+            << " m_lpfBW: " << settings.m_lpfBW
+            << " m_antennaPath: " << settings.m_antennaPath
+            << " m_rx0Gain: " << settings.m_rx0Gain
+            << " m_rx1Gain: " << settings.m_rx1Gain
+            << " m_extClock: " << settings.m_extClock
+            << " m_extClockFreq: " << settings.m_extClockFreq
+            << " m_dcBlock: " << settings.m_dcBlock
+            << " m_iqCorrection: " << settings.m_iqCorrection
+            << " m_rxTransverterMode: " << settings.m_rxTransverterMode
+            << " m_rxTransverterDeltaFrequency: " << settings.m_rxTransverterDeltaFrequency
+            << " m_iqOrder: " << settings.m_iqOrder
+            << " m_spectrumStreamIndex: " << settings.m_spectrumStreamIndex
+            << " force: " << force;
+
+    bool forwardChangeRxDSP = false;
+    bool doCalibration = false;
+    bool doLPCalibration = false;
+    double clockGenFreq = 0.0;
+    lms_device_t *dev = m_deviceParams ? m_deviceParams->getDevice() : nullptr;
+
+    if (dev && (LMS_GetClockFreq(dev, LMS_CLOCK_CGEN, &clockGenFreq) != 0)) {
+        qCritical("LimeSDRMIMO::applySettings: could not get clock gen frequency");
+    }
+
+    if ((m_settings.m_dcBlock != settings.m_dcBlock) ||
+        (m_settings.m_iqCorrection != settings.m_iqCorrection) || force)
+    {
+        for (unsigned int i = 0; i < m_nbRxStreams; i++) {
+            m_deviceAPI->configureCorrections(settings.m_dcBlock, settings.m_iqCorrection, i);
+        }
+    }
+
+    if ((m_settings.m_devSampleRate != settings.m_devSampleRate)
+       || (m_settings.m_log2HardDecim != settings.m_log2HardDecim) || force)
+    {
+        forwardChangeRxDSP = true;
+
+        if (dev)
+        {
+            // the ADC clock is common to both Rx channels
+            if (LMS_SetSampleRateDir(dev, LMS_CH_RX, settings.m_devSampleRate, 1<<settings.m_log2HardDecim) < 0)
+            {
+                qCritical("LimeSDRMIMO::applySettings: could not set sample rate to %d with oversampling of %d",
+                        settings.m_devSampleRate,
+                        1<<settings.m_log2HardDecim);
+            }
+            else
+            {
+                m_deviceParams->m_log2OvSRRx = settings.m_log2HardDecim;
+                m_deviceParams->m_sampleRate = settings.m_devSampleRate;
+                qDebug("LimeSDRMIMO::applySettings: sample rate set to %d with oversampling of %d",
+                        settings.m_devSampleRate,
+                        1<<settings.m_log2HardDecim);
+            }
+        }
+    }
+
+    if ((m_settings.m_lpfBW != settings.m_lpfBW) || force) {
+        doLPCalibration = true;
+    }
+
+    if (((m_settings.m_antennaPath != settings.m_antennaPath) || force) && dev)
+    {
+        for (unsigned int i = 0; i < m_nbRxStreams; i++)
+        {
+            if (DeviceLimeSDR::setRxAntennaPath(dev, i, settings.m_antennaPath))
+            {
+                doCalibration = true;
+                qDebug("LimeSDRMIMO::applySettings: set antenna path to %d on channel %u", settings.m_antennaPath, i);
+            }
+            else
+            {
+                qCritical("LimeSDRMIMO::applySettings: could not set antenna path to %d on channel %u", settings.m_antennaPath, i);
+            }
+        }
+    }
+
+    bool doGain[m_nbRxStreams] = {
+        (m_settings.m_rx0Gain != settings.m_rx0Gain) || force,
+        (m_settings.m_rx1Gain != settings.m_rx1Gain) || force
+    };
+
+    for (unsigned int i = 0; (i < m_nbRxStreams) && dev; i++)
+    {
+        if (!doGain[i]) {
+            continue;
+        }
+
+        uint32_t gain = i == 0 ? settings.m_rx0Gain : settings.m_rx1Gain;
+
+        if (LMS_SetGaindB(dev, LMS_CH_RX, i, gain) < 0)
+        {
+            qWarning("LimeSDRMIMO::applySettings: LMS_SetGaindB(%u, %u) failed", i, gain);
+        }
+        else
+        {
+            doCalibration = true;
+            qDebug("LimeSDRMIMO::applySettings: channel %u gain set to %u", i, gain);
+        }
+    }
+
+    if ((m_settings.m_fcPosRx != settings.m_fcPosRx) || force)
+    {
+        if (m_thread) {
+            m_thread->setFcPos((int) settings.m_fcPosRx);
+        }
+    }
+
+    if ((m_settings.m_log2SoftDecim != settings.m_log2SoftDecim) || force)
+    {
+        forwardChangeRxDSP = true;
+
+        if (m_thread) {
+            m_thread->setLog2Decimation(settings.m_log2SoftDecim);
+        }
+    }
+
+    if ((m_settings.m_iqOrder != settings.m_iqOrder) || force)
+    {
+        if (m_thread) {
+            m_thread->setIQOrder(settings.m_iqOrder);
+        }
+    }
+
+    if ((m_settings.m_rxCenterFrequency != settings.m_rxCenterFrequency)
+        || (m_settings.m_rxTransverterMode != settings.m_rxTransverterMode)
+        || (m_settings.m_rxTransverterDeltaFrequency != settings.m_rxTransverterDeltaFrequency)
+        || (m_settings.m_fcPosRx != settings.m_fcPosRx)
+        || (m_settings.m_log2SoftDecim != settings.m_log2SoftDecim)
+        || (m_settings.m_devSampleRate != settings.m_devSampleRate) || force)
+    {
+        forwardChangeRxDSP = true;
+        qint64 deviceCenterFrequency = DeviceSampleSource::calculateDeviceCenterFrequency(
+                settings.m_rxCenterFrequency,
+                settings.m_rxTransverterDeltaFrequency,
+                settings.m_log2SoftDecim,
+                (DeviceSampleSource::fcPos_t) settings.m_fcPosRx,
+                settings.m_devSampleRate,
+                DeviceSampleSource::FrequencyShiftScheme::FSHIFT_STD,
+                settings.m_rxTransverterMode);
+
+        // the LO is common to both Rx channels
+        if (dev)
+        {
+            if (LMS_SetClockFreq(dev, LMS_CLOCK_SXR, deviceCenterFrequency) < 0)
+            {
+                qCritical("LimeSDRMIMO::applySettings: could not set frequency to %lld", deviceCenterFrequency);
+            }
+            else
+            {
+                doCalibration = true;
+                qDebug("LimeSDRMIMO::applySettings: frequency set to %lld", deviceCenterFrequency);
+            }
+        }
+    }
+
+    if (((m_settings.m_extClock != settings.m_extClock)
+       || (settings.m_extClock && (m_settings.m_extClockFreq != settings.m_extClockFreq)) || force) && dev)
+    {
+        if (DeviceLimeSDR::setClockSource(dev, settings.m_extClock, settings.m_extClockFreq))
+        {
+            doCalibration = true;
+            qDebug("LimeSDRMIMO::applySettings: clock set to %s (Ext: %d Hz)",
+                    settings.m_extClock ? "external" : "internal",
+                    settings.m_extClockFreq);
+        }
+        else
+        {
+            qCritical("LimeSDRMIMO::applySettings: could not set clock to %s (Ext: %d Hz)",
+                    settings.m_extClock ? "external" : "internal",
+                    settings.m_extClockFreq);
+        }
+    }
+
+    bool doSpectrumSource = (m_settings.m_spectrumStreamIndex != settings.m_spectrumStreamIndex) || force;
+
+    m_settings = settings;
+
+    if (dev)
+    {
+        double clockGenFreqAfter;
+
+        if (LMS_GetClockFreq(dev, LMS_CLOCK_CGEN, &clockGenFreqAfter) != 0) {
+            qCritical("LimeSDRMIMO::applySettings: could not get clock gen frequency");
+        } else {
+            doCalibration = doCalibration || (clockGenFreqAfter != clockGenFreq);
+        }
+
+        calibrate(doCalibration, doLPCalibration);
+    }
+
+    if (forwardChangeRxDSP)
+    {
+        int sampleRate = m_settings.m_devSampleRate/(1<<m_settings.m_log2SoftDecim);
+
+        for (unsigned int i = 0; i < m_nbRxStreams; i++)
+        {
+            DSPMIMOSignalNotification *notif = new DSPMIMOSignalNotification(sampleRate, m_settings.m_rxCenterFrequency, true, i);
+            m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+        }
+    }
+
+    if (doSpectrumSource) {
+        m_deviceAPI->setSpectrumSinkInput(true, m_settings.m_spectrumStreamIndex);
+    }
+
+    return true;
+}
+
+void LimeSDRMIMO::calibrate(bool doCalibration, bool doLPCalibration)
+{
+    if (!doCalibration && !doLPCalibration) {
+        return;
+    }
+
+    lms_device_t *dev = m_deviceParams->getDevice();
+    bool threadWasRunning = false;
+
+    // streams must be stopped while the chip is being calibrated
+    if (m_thread && m_thread->isRunning())
+    {
+        m_thread->stopWork();
+        threadWasRunning = true;
+    }
+
+    for (unsigned int i = 0; i < m_nbRxStreams; i++)
+    {
+        if (doCalibration)
+        {
+            if (LMS_Calibrate(dev, LMS_CH_RX, i, m_settings.m_devSampleRate, 0) < 0) {
+                qCritical("LimeSDRMIMO::calibrate: calibration failed on Rx channel %u", i);
+            } else {
+                qDebug("LimeSDRMIMO::calibrate: calibration successful on Rx channel %u", i);
+            }
+        }
+
+        if (doLPCalibration)
+        {
+            if (LMS_SetLPFBW(dev, LMS_CH_RX, i, m_settings.m_lpfBW) < 0) {
+                qCritical("LimeSDRMIMO::calibrate: could not set LPF of channel %u to %f Hz", i, m_settings.m_lpfBW);
+            } else {
+                qDebug("LimeSDRMIMO::calibrate: LPF of channel %u set to %f Hz", i, m_settings.m_lpfBW);
+            }
+        }
+    }
+
+    if (threadWasRunning) {
+        m_thread->startWork();
+    }
+}
+
+int LimeSDRMIMO::webapiRunGet(
+        int subsystemIndex,
+        SWGSDRangel::SWGDeviceState& response,
+        QString& errorMessage)
+{
+    if (subsystemIndex != 0)
+    {
+        errorMessage = QString("Subsystem index invalid: expect 0 (Rx) only");
+        return 404;
+    }
+
+    m_deviceAPI->getDeviceEngineStateStr(*response.getState(), subsystemIndex);
+    return 200;
+}
+
+int LimeSDRMIMO::webapiRun(
+        bool run,
+        int subsystemIndex,
+        SWGSDRangel::SWGDeviceState& response,
+        QString& errorMessage)
+{
+    if (subsystemIndex != 0)
+    {
+        errorMessage = QString("Subsystem index invalid: expect 0 (Rx) only");
+        return 404;
+    }
+
+    m_deviceAPI->getDeviceEngineStateStr(*response.getState(), subsystemIndex);
+    MsgStartStop *message = MsgStartStop::create(run);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgStartStop *msgToGUI = MsgStartStop::create(run);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    return 200;
+}
+
+int LimeSDRMIMO::webapiSettingsGet(
+                SWGSDRangel::SWGDeviceSettings& response,
+                QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setLimeSdrMimoSettings(new SWGSDRangel::SWGLimeSdrMIMOSettings());
+    response.getLimeSdrMimoSettings()->init();
+    webapiFormatDeviceSettings(response, m_settings);
+    return 200;
+}
+
+int LimeSDRMIMO::webapiSettingsPutPatch(
+                bool force,
+                const QStringList& deviceSettingsKeys,
+                SWGSDRangel::SWGDeviceSettings& response, // query + response
+                QString& errorMessage)
+{
+    (void) errorMessage;
+    LimeSDRMIMOSettings settings = m_settings;
+    webapiUpdateDeviceSettings(settings, deviceSettingsKeys, response);
+
+    MsgConfigureLimeSDRMIMO *msg = MsgConfigureLimeSDRMIMO::create(settings, force);
+    m_inputMessageQueue.push(msg);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgConfigureLimeSDRMIMO *msgToGUI = MsgConfigureLimeSDRMIMO::create(settings, force);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    webapiFormatDeviceSettings(response, settings);
+    return 200;
+}
+
+void LimeSDRMIMO::webapiUpdateDeviceSettings(
+    LimeSDRMIMOSettings& settings,
+    const QStringList& deviceSettingsKeys,
+    SWGSDRangel::SWGDeviceSettings& response)
+{
+    SWGSDRangel::SWGLimeSdrMIMOSettings *swgSettings = response.getLimeSdrMimoSettings();
+
+    if (deviceSettingsKeys.contains("devSampleRate")) {
+        settings.m_devSampleRate = swgSettings->getDevSampleRate();
+    }
+    if (deviceSettingsKeys.contains("log2HardDecim")) {
+        settings.m_log2HardDecim = swgSettings->getLog2HardDecim();
+    }
+    if (deviceSettingsKeys.contains("rxCenterFrequency")) {
+        settings.m_rxCenterFrequency = swgSettings->getRxCenterFrequency();
+    }
+    if (deviceSettingsKeys.contains("log2SoftDecim")) {
+        settings.m_log2SoftDecim = swgSettings->getLog2SoftDecim();
+    }
+    if (deviceSettingsKeys.contains("fcPosRx")) {
+        int fcPos = swgSettings->getFcPosRx();
+        fcPos = fcPos < 0 ? 0 : fcPos > 2 ? 2 : fcPos;
+        settings.m_fcPosRx = (LimeSDRMIMOSettings::fcPos_t) fcPos;
+    }
+    if (deviceSettingsKeys.contains("lpfBW")) {
+        settings.m_lpfBW = swgSettings->getLpfBw();
+    }
+    if (deviceSettingsKeys.contains("antennaPath")) {
+        settings.m_antennaPath = swgSettings->getAntennaPath();
+    }
+    if (deviceSettingsKeys.contains("rx0Gain")) {
+        settings.m_rx0Gain = swgSettings->getRx0Gain();
+    }
+    if (deviceSettingsKeys.contains("rx1Gain")) {
+        settings.m_rx1Gain = swgSettings->getRx1Gain();
+    }
+    if (deviceSettingsKeys.contains("extClock")) {
+        settings.m_extClock = swgSettings->getExtClock() != 0;
+    }
+    if (deviceSettingsKeys.contains("extClockFreq")) {
+        settings.m_extClockFreq = swgSettings->getExtClockFreq();
+    }
+    if (deviceSettingsKeys.contains("dcBlock")) {
+        settings.m_dcBlock = swgSettings->getDcBlock() != 0;
+    }
+    if (deviceSettingsKeys.contains("iqCorrection")) {
+        settings.m_iqCorrection = swgSettings->getIqCorrection() != 0;
+    }
+    if (deviceSettingsKeys.contains("rxTransverterMode")) {
+        settings.m_rxTransverterMode = swgSettings->getRxTransverterMode() != 0;
+    }
+    if (deviceSettingsKeys.contains("rxTransverterDeltaFrequency")) {
+        settings.m_rxTransverterDeltaFrequency = swgSettings->getRxTransverterDeltaFrequency();
+    }
+    if (deviceSettingsKeys.contains("iqOrder")) {
+        settings.m_iqOrder = swgSettings->getIqOrder() != 0;
+    }
+    if (deviceSettingsKeys.contains("spectrumStreamIndex")) {
+        unsigned int index = swgSettings->getSpectrumStreamIndex();
+        settings.m_spectrumStreamIndex = index < m_nbRxStreams ? index : m_nbRxStreams - 1;
+    }
+}
+
+void LimeSDRMIMO::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const LimeSDRMIMOSettings& settings)
+{
+    SWGSDRangel::SWGLimeSdrMIMOSettings *swgSettings = response.getLimeSdrMimoSettings();
+    swgSettings->setDevSampleRate(settings.m_devSampleRate);
+    swgSettings->setLog2HardDecim(settings.m_log2HardDecim);
+    swgSettings->setRxCenterFrequency(settings.m_rxCenterFrequency);
+    swgSettings->setLog2SoftDecim(settings.m_log2SoftDecim);
+    swgSettings->setFcPosRx((int) settings.m_fcPosRx);
+    swgSettings->setLpfBw(settings.m_lpfBW);
+    swgSettings->setAntennaPath(settings.m_antennaPath);
+    swgSettings->setRx0Gain(settings.m_rx0Gain);
+    swgSettings->setRx1Gain(settings.m_rx1Gain);
+    swgSettings->setExtClock(settings.m_extClock ? 1 : 0);
+    swgSettings->setExtClockFreq(settings.m_extClockFreq);
+    swgSettings->setDcBlock(settings.m_dcBlock ? 1 : 0);
+    swgSettings->setIqCorrection(settings.m_iqCorrection ? 1 : 0);
+    swgSettings->setRxTransverterMode(settings.m_rxTransverterMode ? 1 : 0);
+    swgSettings->setRxTransverterDeltaFrequency(settings.m_rxTransverterDeltaFrequency);
+    swgSettings->setIqOrder(settings.m_iqOrder ? 1 : 0);
+    swgSettings->setSpectrumStreamIndex(settings.m_spectrumStreamIndex);
+}
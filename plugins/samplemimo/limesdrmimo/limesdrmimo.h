@@ -0,0 +1,172 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLUGINS_SAMPLEMIMO_LIMESDRMIMO_LIMESDRMIMO_H_
+#define PLUGINS_SAMPLEMIMO_LIMESDRMIMO_LIMESDRMIMO_H_
+
+#include <stdint.h>
+
+#include <QString>
+#include <QByteArray>
+#include <QMutex>
+
+#include "lime/LimeSuite.h"
+
+#include "dsp/devicesamplemimo.h"
+#include "limesdrmimosettings.h"
+
+class DeviceAPI;
+struct DeviceLimeSDRParams;
+class LimeSDRMIThread;
+
+/**
+ * LimeSDR with its two Rx channels in one MIMO device set. Both channel streams are started together
+ * so they are sample aligned and share the LO of the device. The Tx side is not
+ * supported yet.
+ */
+class LimeSDRMIMO : public DeviceSampleMIMO {
+    Q_OBJECT
+public:
+    class MsgConfigureLimeSDRMIMO : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        const LimeSDRMIMOSettings& getSettings() const { return m_settings; }
+        bool getForce() const { return m_force; }
+
+        static MsgConfigureLimeSDRMIMO* create(const LimeSDRMIMOSettings& settings, bool force)
+        {
+            return new MsgConfigureLimeSDRMIMO(settings, force);
+        }
+
+    private:
+        LimeSDRMIMOSettings m_settings;
+        bool m_force;
+
+        MsgConfigureLimeSDRMIMO(const LimeSDRMIMOSettings& settings, bool force) :
+            Message(),
+            m_settings(settings),
+            m_force(force)
+        { }
+    };
+
+    class MsgStartStop : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        bool getStartStop() const { return m_startStop; }
+
+        static MsgStartStop* create(bool startStop) {
+            return new MsgStartStop(startStop);
+        }
+
+    protected:
+        bool m_startStop;
+
+        MsgStartStop(bool startStop) :
+            Message(),
+            m_startStop(startStop)
+        { }
+    };
+
+    LimeSDRMIMO(DeviceAPI *deviceAPI);
+    virtual ~LimeSDRMIMO();
+    virtual void destroy();
+
+    virtual void init();
+    virtual bool startRx();
+    virtual void stopRx();
+    virtual bool startTx() { return false; }
+    virtual void stopTx() {}
+
+    virtual QByteArray serialize() const;
+    virtual bool deserialize(const QByteArray& data);
+
+    virtual void setMessageQueueToGUI(MessageQueue *queue) { m_guiMessageQueue = queue; }
+    virtual const QString& getDeviceDescription() const;
+
+    virtual int getSourceSampleRate(int index) const;
+    virtual void setSourceSampleRate(int sampleRate, int index) { (void) sampleRate; (void) index; }
+    virtual quint64 getSourceCenterFrequency(int index) const;
+    virtual void setSourceCenterFrequency(qint64 centerFrequency, int index);
+
+    virtual int getSinkSampleRate(int index) const { (void) index; return 0; }
+    virtual void setSinkSampleRate(int sampleRate, int index) { (void) sampleRate; (void) index; }
+    virtual quint64 getSinkCenterFrequency(int index) const { (void) index; return 0; }
+    virtual void setSinkCenterFrequency(qint64 centerFrequency, int index) { (void) centerFrequency; (void) index; }
+
+    virtual quint64 getMIMOCenterFrequency() const { return getSourceCenterFrequency(0); }
+    virtual unsigned int getMIMOSampleRate() const { return getSourceSampleRate(0); }
+
+    void getRxFrequencyRange(float& minF, float& maxF) const;
+    void getRxSampleRateRange(float& minF, float& maxF) const;
+    void getRxLPFRange(float& minF, float& maxF) const;
+
+    virtual bool handleMessage(const Message& message);
+
+    virtual int webapiSettingsGet(
+                SWGSDRangel::SWGDeviceSettings& response,
+                QString& errorMessage);
+
+    virtual int webapiSettingsPutPatch(
+                bool force,
+                const QStringList& deviceSettingsKeys,
+                SWGSDRangel::SWGDeviceSettings& response, // query + response
+                QString& errorMessage);
+
+    virtual int webapiRunGet(
+            int subsystemIndex,
+            SWGSDRangel::SWGDeviceState& response,
+            QString& errorMessage);
+
+    virtual int webapiRun(
+            bool run,
+            int subsystemIndex,
+            SWGSDRangel::SWGDeviceState& response,
+            QString& errorMessage);
+
+    static void webapiFormatDeviceSettings(
+            SWGSDRangel::SWGDeviceSettings& response,
+            const LimeSDRMIMOSettings& settings);
+
+    static void webapiUpdateDeviceSettings(
+            LimeSDRMIMOSettings& settings,
+            const QStringList& deviceSettingsKeys,
+            SWGSDRangel::SWGDeviceSettings& response);
+
+    static const unsigned int m_nbRxStreams = 2;
+
+private:
+    DeviceAPI *m_deviceAPI;
+    QMutex m_mutex;
+    LimeSDRMIMOSettings m_settings;
+    QString m_deviceDescription;
+    bool m_running;
+    DeviceLimeSDRParams *m_deviceParams;
+    lms_stream_t m_streams[m_nbRxStreams];
+    bool m_streamsSetUp;
+    LimeSDRMIThread *m_thread;
+
+    bool openDevice();
+    void closeDevice();
+    bool applySettings(const LimeSDRMIMOSettings& settings, bool force);
+    bool setupStreams();
+    void destroyStreams();
+    void calibrate(bool doCalibration, bool doLPCalibration);
+};
+
+#endif /* PLUGINS_SAMPLEMIMO_LIMESDRMIMO_LIMESDRMIMO_H_ */
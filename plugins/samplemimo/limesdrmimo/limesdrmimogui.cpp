@@ -0,0 +1,396 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+#include <QMessageBox>
+
+#include "ui_limesdrmimogui.h"
+#include "gui/colormapper.h"
+#include "gui/glspectrum.h"
+#include "dsp/dspcommands.h"
+#include "device/deviceapi.h"
+#include "device/deviceuiset.h"
+
+#include "limesdrmimogui.h"
+
+LimeSDRMIMOGui::LimeSDRMIMOGui(DeviceUISet *deviceUISet, QWidget* parent) :
+    QWidget(parent),
+    ui(new Ui::LimeSDRMIMOGui),
+    m_deviceUISet(deviceUISet),
+    m_settings(),
+    m_doApplySettings(true),
+    m_forceSettings(true),
+    m_sampleMIMO(nullptr),
+    m_deviceSampleRate(5000000),
+    m_deviceCenterFrequency(0),
+    m_lastEngineState(DeviceAPI::StNotStarted)
+{
+    qDebug("LimeSDRMIMOGui::LimeSDRMIMOGui");
+    m_sampleMIMO = (LimeSDRMIMO*) m_deviceUISet->m_deviceAPI->getSampleMIMO();
+    float minF = 0.0f, maxF = 0.0f;
+
+    ui->setupUi(this);
+
+    ui->centerFrequency->setColorMapper(ColorMapper(ColorMapper::GrayGold));
+    updateFrequencyLimits();
+
+    m_sampleMIMO->getRxSampleRateRange(minF, maxF);
+    ui->sampleRate->setColorMapper(ColorMapper(ColorMapper::GrayGreenYellow));
+    ui->sampleRate->setValueRange(8, (uint32_t) minF, (uint32_t) maxF);
+
+    m_sampleMIMO->getRxLPFRange(minF, maxF);
+    ui->lpf->setColorMapper(ColorMapper(ColorMapper::GrayYellow));
+    ui->lpf->setValueRange(6, (minF/1000)+1, maxF/1000);
+
+    displaySettings();
+
+    connect(&m_updateTimer, SIGNAL(timeout()), this, SLOT(updateHardware()));
+    connect(&m_statusTimer, SIGNAL(timeout()), this, SLOT(updateStatus()));
+    m_statusTimer.start(500);
+
+    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()), Qt::QueuedConnection);
+    m_sampleMIMO->setMessageQueueToGUI(&m_inputMessageQueue);
+
+    sendSettings();
+}
+
+LimeSDRMIMOGui::~LimeSDRMIMOGui()
+{
+    delete ui;
+}
+
+void LimeSDRMIMOGui::destroy()
+{
+    delete this;
+}
+
+void LimeSDRMIMOGui::setName(const QString& name)
+{
+    setObjectName(name);
+}
+
+QString LimeSDRMIMOGui::getName() const
+{
+    return objectName();
+}
+
+void LimeSDRMIMOGui::resetToDefaults()
+{
+    m_settings.resetToDefaults();
+    displaySettings();
+    sendSettings();
+}
+
+qint64 LimeSDRMIMOGui::getCenterFrequency() const
+{
+    return m_settings.m_rxCenterFrequency;
+}
+
+void LimeSDRMIMOGui::setCenterFrequency(qint64 centerFrequency)
+{
+    m_settings.m_rxCenterFrequency = centerFrequency;
+    displaySettings();
+    sendSettings();
+}
+
+QByteArray LimeSDRMIMOGui::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool LimeSDRMIMOGui::deserialize(const QByteArray& data)
+{
+    if (m_settings.deserialize(data))
+    {
+        displaySettings();
+        m_forceSettings = true;
+        sendSettings();
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
+
+void LimeSDRMIMOGui::on_startStop_toggled(bool checked)
+{
+    if (m_doApplySettings)
+    {
+        LimeSDRMIMO::MsgStartStop *message = LimeSDRMIMO::MsgStartStop::create(checked);
+        m_sampleMIMO->getInputMessageQueue()->push(message);
+    }
+}
+
+void LimeSDRMIMOGui::on_centerFrequency_changed(quint64 value)
+{
+    m_settings.m_rxCenterFrequency = value * 1000;
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_dcOffset_toggled(bool checked)
+{
+    m_settings.m_dcBlock = checked;
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_iqImbalance_toggled(bool checked)
+{
+    m_settings.m_iqCorrection = checked;
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_extClock_clicked()
+{
+    m_settings.m_extClock = ui->extClock->getExternalClockActive();
+    m_settings.m_extClockFreq = ui->extClock->getExternalClockFrequency();
+    qDebug("LimeSDRMIMOGui::on_extClock_clicked: %u Hz %s", m_settings.m_extClockFreq, m_settings.m_extClock ? "on" : "off");
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_transverter_clicked()
+{
+    m_settings.m_rxTransverterMode = ui->transverter->getDeltaFrequencyAcive();
+    m_settings.m_rxTransverterDeltaFrequency = ui->transverter->getDeltaFrequency();
+    m_settings.m_iqOrder = ui->transverter->getIQOrder();
+    qDebug("LimeSDRMIMOGui::on_transverter_clicked: %lld Hz %s", m_settings.m_rxTransverterDeltaFrequency, m_settings.m_rxTransverterMode ? "on" : "off");
+    updateFrequencyLimits();
+    m_settings.m_rxCenterFrequency = ui->centerFrequency->getValueNew() * 1000;
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_sampleRate_changed(quint64 value)
+{
+    m_settings.m_devSampleRate = value;
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_hwDecim_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index > 5)) {
+        return;
+    }
+
+    m_settings.m_log2HardDecim = index;
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_swDecim_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index > 6)) {
+        return;
+    }
+
+    m_settings.m_log2SoftDecim = index;
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_fcPos_currentIndexChanged(int index)
+{
+    m_settings.m_fcPosRx = (LimeSDRMIMOSettings::fcPos_t) (index < 0 ? 0 : index > 2 ? 2 : index);
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_lpf_changed(quint64 value)
+{
+    m_settings.m_lpfBW = value * 1000;
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_antenna_currentIndexChanged(int index)
+{
+    m_settings.m_antennaPath = index < 0 ? 0 : index;
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_spectrumSource_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index >= (int) LimeSDRMIMO::m_nbRxStreams)) {
+        return;
+    }
+
+    m_settings.m_spectrumStreamIndex = index;
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_rx0Gain_valueChanged(int value)
+{
+    ui->rx0GainText->setText(tr("%1").arg(value));
+    m_settings.m_rx0Gain = value;
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::on_rx1Gain_valueChanged(int value)
+{
+    ui->rx1GainText->setText(tr("%1").arg(value));
+    m_settings.m_rx1Gain = value;
+    sendSettings();
+}
+
+void LimeSDRMIMOGui::displaySettings()
+{
+    blockApplySettings(true);
+    ui->transverter->setDeltaFrequency(m_settings.m_rxTransverterDeltaFrequency);
+    ui->transverter->setDeltaFrequencyActive(m_settings.m_rxTransverterMode);
+    ui->transverter->setIQOrder(m_settings.m_iqOrder);
+    updateFrequencyLimits();
+    ui->centerFrequency->setValue(m_settings.m_rxCenterFrequency / 1000);
+    ui->dcOffset->setChecked(m_settings.m_dcBlock);
+    ui->iqImbalance->setChecked(m_settings.m_iqCorrection);
+    ui->extClock->setExternalClockFrequency(m_settings.m_extClockFreq);
+    ui->extClock->setExternalClockActive(m_settings.m_extClock);
+    ui->sampleRate->setValue(m_settings.m_devSampleRate);
+    ui->hwDecim->setCurrentIndex(m_settings.m_log2HardDecim);
+    ui->swDecim->setCurrentIndex(m_settings.m_log2SoftDecim);
+    ui->fcPos->setCurrentIndex((int) m_settings.m_fcPosRx);
+    ui->lpf->setValue(m_settings.m_lpfBW / 1000);
+    ui->antenna->setCurrentIndex(m_settings.m_antennaPath);
+    ui->spectrumSource->setCurrentIndex(m_settings.m_spectrumStreamIndex);
+    ui->rx0Gain->setValue(m_settings.m_rx0Gain);
+    ui->rx0GainText->setText(tr("%1").arg(m_settings.m_rx0Gain));
+    ui->rx1Gain->setValue(m_settings.m_rx1Gain);
+    ui->rx1GainText->setText(tr("%1").arg(m_settings.m_rx1Gain));
+    blockApplySettings(false);
+}
+
+void LimeSDRMIMOGui::sendSettings()
+{
+    if (!m_updateTimer.isActive()) {
+        m_updateTimer.start(100);
+    }
+}
+
+void LimeSDRMIMOGui::updateHardware()
+{
+    if (m_doApplySettings)
+    {
+        LimeSDRMIMO::MsgConfigureLimeSDRMIMO* message = LimeSDRMIMO::MsgConfigureLimeSDRMIMO::create(m_settings, m_forceSettings);
+        m_sampleMIMO->getInputMessageQueue()->push(message);
+        m_forceSettings = false;
+        m_updateTimer.stop();
+    }
+}
+void LimeSDRMIMOGui::updateStatus()
+{
+    int state = m_deviceUISet->m_deviceAPI->state(0);
+
+    if (m_lastEngineState != state)
+    {
+        switch(state)
+        {
+            case DeviceAPI::StNotStarted:
+                ui->startStop->setStyleSheet("QToolButton { background:rgb(79,79,79); }");
+                break;
+            case DeviceAPI::StIdle:
+                ui->startStop->setStyleSheet("QToolButton { background-color : blue; }");
+                break;
+            case DeviceAPI::StRunning:
+                ui->startStop->setStyleSheet("QToolButton { background-color : green; }");
+                break;
+            case DeviceAPI::StError:
+                ui->startStop->setStyleSheet("QToolButton { background-color : red; }");
+                QMessageBox::information(this, tr("Message"), m_deviceUISet->m_deviceAPI->errorMessage(0));
+                break;
+            default:
+                break;
+        }
+
+        m_lastEngineState = state;
+    }
+}
+
+bool LimeSDRMIMOGui::handleMessage(const Message& message)
+{
+    if (LimeSDRMIMO::MsgConfigureLimeSDRMIMO::match(message))
+    {
+        qDebug("LimeSDRMIMOGui::handleMessage: MsgConfigureLimeSDRMIMO");
+        const LimeSDRMIMO::MsgConfigureLimeSDRMIMO& cfg = (LimeSDRMIMO::MsgConfigureLimeSDRMIMO&) message;
+        m_settings = cfg.getSettings();
+        displaySettings();
+        return true;
+    }
+    else if (LimeSDRMIMO::MsgStartStop::match(message))
+    {
+        qDebug("LimeSDRMIMOGui::handleMessage: MsgStartStop");
+        LimeSDRMIMO::MsgStartStop& notif = (LimeSDRMIMO::MsgStartStop&) message;
+        blockApplySettings(true);
+        ui->startStop->setChecked(notif.getStartStop());
+        blockApplySettings(false);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void LimeSDRMIMOGui::updateFrequencyLimits()
+{
+    // values in kHz
+    float minF = 0.0f, maxF = 0.0f;
+    qint64 deltaFrequency = m_settings.m_rxTransverterMode ? m_settings.m_rxTransverterDeltaFrequency/1000 : 0;
+    m_sampleMIMO->getRxFrequencyRange(minF, maxF);
+    qint64 minLimit = minF/1000 + deltaFrequency;
+    qint64 maxLimit = maxF/1000 + deltaFrequency;
+
+    minLimit = minLimit < 0 ? 0 : minLimit > 9999999 ? 9999999 : minLimit;
+    maxLimit = maxLimit < 0 ? 0 : maxLimit > 9999999 ? 9999999 : maxLimit;
+
+    qDebug("LimeSDRMIMOGui::updateFrequencyLimits: delta: %lld min: %lld max: %lld", deltaFrequency, minLimit, maxLimit);
+
+    ui->centerFrequency->setValueRange(7, minLimit, maxLimit);
+}
+
+void LimeSDRMIMOGui::handleInputMessages()
+{
+    Message* message;
+
+    while ((message = m_inputMessageQueue.pop()) != 0)
+    {
+        if (DSPMIMOSignalNotification::match(*message))
+        {
+            DSPMIMOSignalNotification* notif = (DSPMIMOSignalNotification*) message;
+
+            // both channels share the same rate and frequency
+            if (notif->getSourceOrSink() && (notif->getIndex() == 0))
+            {
+                m_deviceSampleRate = notif->getSampleRate();
+                m_deviceCenterFrequency = notif->getCenterFrequency();
+                qDebug("LimeSDRMIMOGui::handleInputMessages: DSPMIMOSignalNotification: SampleRate:%d, CenterFrequency:%llu",
+                        notif->getSampleRate(),
+                        notif->getCenterFrequency());
+                updateSampleRateAndFrequency();
+            }
+
+            delete message;
+        }
+        else
+        {
+            if (handleMessage(*message)) {
+                delete message;
+            }
+        }
+    }
+}
+
+void LimeSDRMIMOGui::updateSampleRateAndFrequency()
+{
+    m_deviceUISet->getSpectrum()->setSampleRate(m_deviceSampleRate);
+    m_deviceUISet->getSpectrum()->setCenterFrequency(m_deviceCenterFrequency);
+    ui->deviceRateText->setText(tr("%1k").arg((float)m_deviceSampleRate / 1000));
+}
@@ -0,0 +1,97 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _LIMESDRMIMO_LIMESDRMIMOGUI_H_
+#define _LIMESDRMIMO_LIMESDRMIMOGUI_H_
+
+#include <plugin/plugininstancegui.h>
+#include <QTimer>
+#include <QWidget>
+
+#include "util/messagequeue.h"
+
+#include "limesdrmimosettings.h"
+#include "limesdrmimo.h"
+
+class DeviceUISet;
+
+namespace Ui {
+	class LimeSDRMIMOGui;
+}
+
+class LimeSDRMIMOGui : public QWidget, public PluginInstanceGUI {
+	Q_OBJECT
+
+public:
+	explicit LimeSDRMIMOGui(DeviceUISet *deviceUISet, QWidget* parent = 0);
+	virtual ~LimeSDRMIMOGui();
+	virtual void destroy();
+
+	void setName(const QString& name);
+	QString getName() const;
+
+	void resetToDefaults();
+	virtual qint64 getCenterFrequency() const;
+	virtual void setCenterFrequency(qint64 centerFrequency);
+	QByteArray serialize() const;
+	bool deserialize(const QByteArray& data);
+	virtual MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; }
+	virtual bool handleMessage(const Message& message);
+
+private:
+	Ui::LimeSDRMIMOGui* ui;
+
+	DeviceUISet* m_deviceUISet;
+	LimeSDRMIMOSettings m_settings;
+    QTimer m_updateTimer;
+    QTimer m_statusTimer;
+	bool m_doApplySettings;
+    bool m_forceSettings;
+	LimeSDRMIMO* m_sampleMIMO;
+    int m_deviceSampleRate;
+    quint64 m_deviceCenterFrequency; //!< Center frequency in device
+	int m_lastEngineState;
+	MessageQueue m_inputMessageQueue;
+
+	void blockApplySettings(bool block) { m_doApplySettings = !block; }
+	void displaySettings();
+	void sendSettings();
+    void updateSampleRateAndFrequency();
+    void updateFrequencyLimits();
+
+private slots:
+    void handleInputMessages();
+	void on_startStop_toggled(bool checked);
+    void on_centerFrequency_changed(quint64 value);
+    void on_dcOffset_toggled(bool checked);
+    void on_iqImbalance_toggled(bool checked);
+    void on_extClock_clicked();
+    void on_transverter_clicked();
+    void on_sampleRate_changed(quint64 value);
+    void on_hwDecim_currentIndexChanged(int index);
+    void on_swDecim_currentIndexChanged(int index);
+    void on_fcPos_currentIndexChanged(int index);
+    void on_lpf_changed(quint64 value);
+    void on_antenna_currentIndexChanged(int index);
+    void on_spectrumSource_currentIndexChanged(int index);
+    void on_rx0Gain_valueChanged(int value);
+    void on_rx1Gain_valueChanged(int value);
+    void updateStatus();
+    void updateHardware();
+};
+
+#endif // _LIMESDRMIMO_LIMESDRMIMOGUI_H_
@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QtPlugin>
+
+#include "plugin/pluginapi.h"
+#include "util/simpleserializer.h"
+#include "limesdr/devicelimesdr.h"
+
+#ifdef SERVER_MODE
+#include "limesdrmimo.h"
+#else
+#include "limesdrmimogui.h"
+#endif
+#include "limesdrmimoplugin.h"
+#include "limesdrmimowebapiadapter.h"
+
+const PluginDescriptor LimeSDRMIMOPlugin::m_pluginDescriptor = {
+    QString("LimeSDRMIMO"),
+	QString("LimeSDR MIMO"),
+	QString("4.15.0"),
+	QString("(c) Edouard Griffiths, F4EXB"),
+	QString("https://github.com/f4exb/sdrangel"),
+	true,
+	QString("https://github.com/f4exb/sdrangel")
+};
+
+const QString LimeSDRMIMOPlugin::m_hardwareID = "LimeSDR";
+const QString LimeSDRMIMOPlugin::m_deviceTypeID = LIMESDRMIMO_DEVICE_TYPE_ID;
+
+LimeSDRMIMOPlugin::LimeSDRMIMOPlugin(QObject* parent) :
+	QObject(parent)
+{
+}
+
+const PluginDescriptor& LimeSDRMIMOPlugin::getPluginDescriptor() const
+{
+	return m_pluginDescriptor;
+}
+
+void LimeSDRMIMOPlugin::initPlugin(PluginAPI* pluginAPI)
+{
+	pluginAPI->registerSampleMIMO(m_deviceTypeID, this);
+}
+
+void LimeSDRMIMOPlugin::enumOriginDevices(QStringList& listedHwIds, OriginDevices& originDevices)
+{
+    if (listedHwIds.contains(m_hardwareID)) { // check if it was done
+        return;
+    }
+
+    DeviceLimeSDR::enumOriginDevices(m_hardwareID, originDevices);
+    listedHwIds.append(m_hardwareID);
+}
+
+PluginInterface::SamplingDevices LimeSDRMIMOPlugin::enumSampleMIMO(const OriginDevices& originDevices)
+{
+	SamplingDevices result;
+
+	for (OriginDevices::const_iterator it = originDevices.begin(); it != originDevices.end(); ++it)
+    {
+        // only devices with both Rx channels can be used as MIMO
+        if ((it->hardwareId == m_hardwareID) && (it->nbRxStreams >= (int) LimeSDRMIMO::m_nbRxStreams))
+        {
+            QString displayedName = it->displayableName;
+            displayedName.replace(QString("$1]"), QString("MI]"));
+            result.append(SamplingDevice(
+                displayedName,
+                m_hardwareID,
+                m_deviceTypeID,
+                it->serial,
+                it->sequence,
+                PluginInterface::SamplingDevice::PhysicalDevice,
+                PluginInterface::SamplingDevice::StreamMIMO,
+                LimeSDRMIMO::m_nbRxStreams, // nb Rx
+                0  // nb Tx
+            ));
+        }
+    }
+
+	return result;
+}
+
+#ifdef SERVER_MODE
+PluginInstanceGUI* LimeSDRMIMOPlugin::createSampleMIMOPluginInstanceGUI(
+        const QString& mimoId,
+        QWidget **widget,
+        DeviceUISet *deviceUISet)
+{
+    (void) mimoId;
+    (void) widget;
+    (void) deviceUISet;
+    return nullptr;
+}
+#else
+PluginInstanceGUI* LimeSDRMIMOPlugin::createSampleMIMOPluginInstanceGUI(
+        const QString& mimoId,
+        QWidget **widget,
+        DeviceUISet *deviceUISet)
+{
+	if (mimoId == m_deviceTypeID)
+    {
+		LimeSDRMIMOGui* gui = new LimeSDRMIMOGui(deviceUISet);
+		*widget = gui;
+		return gui;
+	}
+    else
+    {
+		return nullptr;
+	}
+}
+#endif
+
+DeviceSampleMIMO *LimeSDRMIMOPlugin::createSampleMIMOPluginInstance(const QString& mimoId, DeviceAPI *deviceAPI)
+{
+    if (mimoId == m_deviceTypeID)
+    {
+        LimeSDRMIMO* input = new LimeSDRMIMO(deviceAPI);
+        return input;
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+DeviceWebAPIAdapter *LimeSDRMIMOPlugin::createDeviceWebAPIAdapter() const
+{
+    return new LimeSDRMIMOWebAPIAdapter();
+}
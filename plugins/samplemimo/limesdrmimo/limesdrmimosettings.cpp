@@ -0,0 +1,115 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include "limesdrmimosettings.h"
+
+#include "util/simpleserializer.h"
+
+LimeSDRMIMOSettings::LimeSDRMIMOSettings()
+{
+    resetToDefaults();
+}
+
+void LimeSDRMIMOSettings::resetToDefaults()
+{
+    m_devSampleRate = 5000000;
+    m_log2HardDecim = 3;
+    m_rxCenterFrequency = 435000*1000;
+    m_log2SoftDecim = 0;
+    m_fcPosRx = FC_POS_CENTER;
+    m_lpfBW = 4.5e6f;
+    m_antennaPath = 0;
+    m_rx0Gain = 50;
+    m_rx1Gain = 50;
+    m_extClock = false;
+    m_extClockFreq = 10000000; // 10 MHz
+    m_dcBlock = false;
+    m_iqCorrection = false;
+    m_rxTransverterMode = false;
+    m_rxTransverterDeltaFrequency = 0;
+    m_iqOrder = true;
+    m_spectrumStreamIndex = 0;
+}
+
+QByteArray LimeSDRMIMOSettings::serialize() const
+{
+    SimpleSerializer s(1);
+
+    s.writeS32(1, m_devSampleRate);
+    s.writeU32(2, m_log2HardDecim);
+    s.writeU64(3, m_rxCenterFrequency);
+    s.writeU32(4, m_log2SoftDecim);
+    s.writeS32(5, (int) m_fcPosRx);
+    s.writeFloat(6, m_lpfBW);
+    s.writeS32(7, m_antennaPath);
+    s.writeU32(8, m_rx0Gain);
+    s.writeU32(9, m_rx1Gain);
+    s.writeBool(10, m_extClock);
+    s.writeU32(11, m_extClockFreq);
+    s.writeBool(12, m_dcBlock);
+    s.writeBool(13, m_iqCorrection);
+    s.writeBool(14, m_rxTransverterMode);
+    s.writeS64(15, m_rxTransverterDeltaFrequency);
+    s.writeBool(16, m_iqOrder);
+    s.writeU32(17, m_spectrumStreamIndex);
+
+    return s.final();
+}
+
+bool LimeSDRMIMOSettings::deserialize(const QByteArray& data)
+{
+    SimpleDeserializer d(data);
+
+    if (!d.isValid())
+    {
+        resetToDefaults();
+        return false;
+    }
+
+    if (d.getVersion() == 1)
+    {
+        int intval;
+        uint32_t uintval;
+
+        d.readS32(1, &m_devSampleRate, 5000000);
+        d.readU32(2, &m_log2HardDecim, 3);
+        d.readU64(3, &m_rxCenterFrequency, 435000*1000);
+        d.readU32(4, &m_log2SoftDecim, 0);
+        d.readS32(5, &intval, (int) FC_POS_CENTER);
+        m_fcPosRx = intval < 0 ? FC_POS_INFRA : intval > 2 ? FC_POS_CENTER : (fcPos_t) intval;
+        d.readFloat(6, &m_lpfBW, 4.5e6f);
+        d.readS32(7, &m_antennaPath, 0);
+        d.readU32(8, &m_rx0Gain, 50);
+        d.readU32(9, &m_rx1Gain, 50);
+        d.readBool(10, &m_extClock, false);
+        d.readU32(11, &m_extClockFreq, 10000000);
+        d.readBool(12, &m_dcBlock, false);
+        d.readBool(13, &m_iqCorrection, false);
+        d.readBool(14, &m_rxTransverterMode, false);
+        d.readS64(15, &m_rxTransverterDeltaFrequency, 0);
+        d.readBool(16, &m_iqOrder, true);
+        d.readU32(17, &uintval, 0);
+        m_spectrumStreamIndex = uintval > 1 ? 1 : uintval;
+
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
@@ -0,0 +1,59 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLUGINS_SAMPLEMIMO_LIMESDRMIMO_LIMESDRMIMOSETTINGS_H_
+#define PLUGINS_SAMPLEMIMO_LIMESDRMIMO_LIMESDRMIMOSETTINGS_H_
+
+#include <QtGlobal>
+#include <QString>
+
+/**
+ * Receive side of the LimeSDR as a MIMO: both Rx channels share the local oscillator,
+ * the sample clock, the decimation, the antenna and the bandwidth. Only the gain is set per channel.
+ */
+struct LimeSDRMIMOSettings {
+    typedef enum {
+        FC_POS_INFRA = 0,
+        FC_POS_SUPRA,
+        FC_POS_CENTER
+    } fcPos_t;
+
+    qint32 m_devSampleRate;
+    quint32 m_log2HardDecim;
+    quint64 m_rxCenterFrequency;
+    quint32 m_log2SoftDecim;
+    fcPos_t m_fcPosRx;
+    float m_lpfBW;              //!< LMS analog lowpass filter bandwidth (Hz)
+    int m_antennaPath;          //!< See DeviceLimeSDR::PathRxRFE
+    quint32 m_rx0Gain;          //!< Rx0 optimally distributed gain (dB)
+    quint32 m_rx1Gain;          //!< Rx1 optimally distributed gain (dB)
+    bool m_extClock;            //!< True if external clock source
+    quint32 m_extClockFreq;     //!< Frequency (Hz) of external clock source
+    bool m_dcBlock;
+    bool m_iqCorrection;
+    bool m_rxTransverterMode;
+    qint64 m_rxTransverterDeltaFrequency;
+    bool m_iqOrder;
+    unsigned int m_spectrumStreamIndex; //!< stream displayed in the main spectrum
+
+    LimeSDRMIMOSettings();
+    void resetToDefaults();
+    QByteArray serialize() const;
+    bool deserialize(const QByteArray& data);
+};
+
+#endif /* PLUGINS_SAMPLEMIMO_LIMESDRMIMO_LIMESDRMIMOSETTINGS_H_ */
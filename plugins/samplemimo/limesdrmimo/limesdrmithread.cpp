@@ -0,0 +1,324 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <algorithm>
+
+#include "limesdr/devicelimesdr.h"
+#include "dsp/samplemififo.h"
+
+#include "limesdrmithread.h"
+
+LimeSDRMIThread::LimeSDRMIThread(lms_stream_t* stream0, lms_stream_t* stream1, QObject* parent) :
+    QThread(parent),
+    m_running(false),
+    m_streams{stream0, stream1},
+    m_sampleFifo(nullptr),
+    m_log2Decim(0),
+    m_fcPos(0),
+    m_iqOrder(true)
+{
+    qDebug("LimeSDRMIThread::LimeSDRMIThread");
+
+    for (unsigned int i = 0; i < m_nbChannels; i++)
+    {
+        m_convertBuffer[i].resize(2*DeviceLimeSDR::blockSize, Sample{0,0});
+        m_buf[i] = new qint16[2*2*DeviceLimeSDR::blockSize];
+        m_bufCount[i] = 0;
+        m_bufTimestamp[i] = 0;
+    }
+}
+
+LimeSDRMIThread::~LimeSDRMIThread()
+{
+    qDebug("LimeSDRMIThread::~LimeSDRMIThread");
+
+    if (m_running) {
+        stopWork();
+    }
+
+    for (unsigned int i = 0; i < m_nbChannels; i++) {
+        delete[] m_buf[i];
+    }
+}
+
+void LimeSDRMIThread::startWork()
+{
+    // start both streams back to back. The thread aligns them on the device timestamps
+    for (unsigned int i = 0; i < m_nbChannels; i++)
+    {
+        if (LMS_StartStream(m_streams[i]) < 0) {
+            qCritical("LimeSDRMIThread::startWork: could not start stream %u", i);
+        }
+    }
+
+    usleep(50000);
+    qDebug("LimeSDRMIThread::startWork: streams started");
+
+    m_startWaitMutex.lock();
+    start();
+
+    while(!m_running) {
+        m_startWaiter.wait(&m_startWaitMutex, 100);
+    }
+
+    m_startWaitMutex.unlock();
+}
+
+void LimeSDRMIThread::stopWork()
+{
+    m_running = false;
+    wait();
+
+    for (unsigned int i = 0; i < m_nbChannels; i++)
+    {
+        if (LMS_StopStream(m_streams[i]) < 0) {
+            qCritical("LimeSDRMIThread::stopWork: could not stop stream %u", i);
+        }
+    }
+
+    usleep(50000);
+    qDebug("LimeSDRMIThread::stopWork: streams stopped");
+}
+
+void LimeSDRMIThread::run()
+{
+    lms_stream_meta_t metadata[m_nbChannels]; //Use metadata for additional control over sample receive function behaviour
+
+    for (unsigned int i = 0; i < m_nbChannels; i++)
+    {
+        metadata[i].timestamp = 0;
+        metadata[i].flushPartialPacket = false; //Do not discard data remainder when read size differs from packet size
+        metadata[i].waitForTimestamp = false;   //Do not wait for specific timestamps
+        m_bufCount[i] = 0;
+        m_bufTimestamp[i] = 0;
+    }
+
+    m_running = true;
+    m_startWaiter.wakeAll();
+
+    if (!m_sampleFifo)
+    {
+        qWarning("LimeSDRMIThread::run: no FIFO allocated. Aborting");
+        m_running = false;
+        return;
+    }
+
+    while (m_running)
+    {
+        for (unsigned int i = 0; i < m_nbChannels; i++)
+        {
+            if (m_bufCount[i] >= (int) DeviceLimeSDR::blockSize) { // wait for the other stream to catch up
+                continue;
+            }
+
+            int res = LMS_RecvStream(m_streams[i], (void *) &m_buf[i][2*m_bufCount[i]], DeviceLimeSDR::blockSize, &metadata[i], 1000);
+
+            if (res < 0)
+            {
+                qCritical("LimeSDRMIThread::run read error on stream %u: %s", i, strerror(errno));
+                m_running = false;
+                break;
+            }
+
+            if (res == 0) {
+                continue;
+            }
+
+            if (m_bufCount[i] == 0)
+            {
+                m_bufTimestamp[i] = metadata[i].timestamp;
+            }
+            else if (metadata[i].timestamp != m_bufTimestamp[i] + m_bufCount[i])
+            {
+                // samples were lost (overflow): restart the buffer at the samples just read
+                qWarning("LimeSDRMIThread::run: stream %u: gap of %lld samples",
+                    i, (long long) (metadata[i].timestamp - (m_bufTimestamp[i] + m_bufCount[i])));
+                memmove(m_buf[i], &m_buf[i][2*m_bufCount[i]], 2*res*sizeof(qint16));
+                m_bufCount[i] = 0;
+                m_bufTimestamp[i] = metadata[i].timestamp;
+            }
+
+            m_bufCount[i] += res;
+        }
+
+        if (!m_running) {
+            break;
+        }
+
+        if ((m_bufCount[0] == 0) || (m_bufCount[1] == 0)) {
+            continue;
+        }
+
+        // drop the samples of the stream that starts earlier so that both start on the same timestamp
+        uint64_t startTimestamp = std::max(m_bufTimestamp[0], m_bufTimestamp[1]);
+
+        for (unsigned int i = 0; i < m_nbChannels; i++)
+        {
+            if (m_bufTimestamp[i] < startTimestamp)
+            {
+                uint64_t nbLate = startTimestamp - m_bufTimestamp[i];
+
+                if (nbLate >= (uint64_t) m_bufCount[i]) {
+                    m_bufCount[i] = 0; // timestamp is set again on next read
+                } else {
+                    consume(i, (int) nbLate);
+                }
+            }
+        }
+
+        // the samples present in both streams are written synchronously and the remainder is kept
+        int nbSamples = std::min(m_bufCount[0], m_bufCount[1]);
+
+        if (nbSamples > 0)
+        {
+            callback(nbSamples);
+
+            for (unsigned int i = 0; i < m_nbChannels; i++) {
+                consume(i, nbSamples);
+            }
+        }
+    }
+
+    m_running = false;
+}
+
+void LimeSDRMIThread::callback(qint32 samplesPerChannel)
+{
+    std::vector<SampleVector::const_iterator> vbegin;
+    int nbDecimatedSamples = 0;
+
+    for (unsigned int channel = 0; channel < m_nbChannels; channel++)
+    {
+        SampleVector::iterator it = m_convertBuffer[channel].begin();
+
+        if (m_iqOrder) {
+            decimate(m_decimatorsIQ[channel], &it, m_buf[channel], 2*samplesPerChannel);
+        } else {
+            decimate(m_decimatorsQI[channel], &it, m_buf[channel], 2*samplesPerChannel);
+        }
+
+        vbegin.push_back(m_convertBuffer[channel].begin());
+        nbDecimatedSamples = it - m_convertBuffer[channel].begin(); // same for all channels
+    }
+
+    m_sampleFifo->writeSync(vbegin, nbDecimatedSamples);
+}
+
+void LimeSDRMIThread::consume(unsigned int channel, int nbSamples)
+{
+    int remainder = m_bufCount[channel] - nbSamples;
+
+    if (remainder > 0) {
+        memmove(m_buf[channel], &m_buf[channel][2*nbSamples], 2*remainder*sizeof(qint16));
+    }
+
+    m_bufCount[channel] = remainder;
+    m_bufTimestamp[channel] += nbSamples;
+}
+
+template<class DecimatorsType>
+void LimeSDRMIThread::decimate(DecimatorsType& decimators, SampleVector::iterator* it, const qint16* buf, qint32 len)
+{
+    if (m_log2Decim == 0)
+    {
+        decimators.decimate1(it, buf, len);
+    }
+    else
+    {
+        if (m_fcPos == 0) // Infra
+        {
+            switch (m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_inf(it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_inf(it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_inf(it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_inf(it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_inf(it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_inf(it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_fcPos == 1) // Supra
+        {
+            switch (m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_sup(it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_sup(it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_sup(it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_sup(it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_sup(it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_sup(it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_fcPos == 2) // Center
+        {
+            switch (m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_cen(it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_cen(it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_cen(it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_cen(it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_cen(it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_cen(it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
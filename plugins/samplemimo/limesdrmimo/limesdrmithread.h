@@ -0,0 +1,81 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLUGINS_SAMPLEMIMO_LIMESDRMIMO_LIMESDRMITHREAD_H_
+#define PLUGINS_SAMPLEMIMO_LIMESDRMIMO_LIMESDRMITHREAD_H_
+
+// Reads both Rx channel streams of the LimeSDR in turn and writes them synchronously
+// to the multiple input FIFO so that the channel samples stay aligned down to the MIMO engine.
+// Streams are aligned on the device timestamps. Samples read from one stream in excess of
+// the other are kept for the next iteration.
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+
+#include "lime/LimeSuite.h"
+
+#include "dsp/decimators.h"
+
+class SampleMIFifo;
+
+class LimeSDRMIThread : public QThread {
+    Q_OBJECT
+
+public:
+    LimeSDRMIThread(lms_stream_t* stream0, lms_stream_t* stream1, QObject* parent = nullptr);
+    ~LimeSDRMIThread();
+
+    void startWork();
+    void stopWork();
+    bool isRunning() const { return m_running; }
+    void setLog2Decimation(unsigned int log2Decim) { m_log2Decim = log2Decim; }
+    unsigned int getLog2Decimation() const { return m_log2Decim; }
+    void setFcPos(int fcPos) { m_fcPos = fcPos; }
+    int getFcPos() const { return m_fcPos; }
+    void setFifo(SampleMIFifo *sampleFifo) { m_sampleFifo = sampleFifo; }
+    SampleMIFifo *getFifo() { return m_sampleFifo; }
+    void setIQOrder(bool iqOrder) { m_iqOrder = iqOrder; }
+
+    static const unsigned int m_nbChannels = 2;
+
+private:
+    QMutex m_startWaitMutex;
+    QWaitCondition m_startWaiter;
+    bool m_running;
+    lms_stream_t *m_streams[m_nbChannels];
+
+    qint16 *m_buf[m_nbChannels]; //!< One buffer per channel of twice the block size
+    int m_bufCount[m_nbChannels];          //!< number of samples in each buffer
+    uint64_t m_bufTimestamp[m_nbChannels]; //!< device timestamp of the first sample in each buffer
+    SampleVector m_convertBuffer[m_nbChannels];
+    SampleMIFifo* m_sampleFifo;
+    Decimators<qint32, qint16, SDR_RX_SAMP_SZ, 12, true> m_decimatorsIQ[m_nbChannels];
+    Decimators<qint32, qint16, SDR_RX_SAMP_SZ, 12, false> m_decimatorsQI[m_nbChannels];
+    unsigned int m_log2Decim;
+    int m_fcPos;
+    bool m_iqOrder;
+
+    void run();
+    void callback(qint32 samplesPerChannel);
+    void consume(unsigned int channel, int nbSamples);
+
+    template<class DecimatorsType>
+    void decimate(DecimatorsType& decimators, SampleVector::iterator* it, const qint16* buf, qint32 len);
+};
+
+#endif /* PLUGINS_SAMPLEMIMO_LIMESDRMIMO_LIMESDRMITHREAD_H_ */
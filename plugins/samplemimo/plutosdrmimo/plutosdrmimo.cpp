@@ -0,0 +1,702 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+#include <string.h>
+
+#include <QDebug>
+
+#include "SWGDeviceSettings.h"
+#include "SWGDeviceState.h"
+#include "SWGPlutoSdrMIMOSettings.h"
+
+#include "device/deviceapi.h"
+#include "dsp/dspcommands.h"
+#include "dsp/devicesamplesource.h"
+#include "plutosdr/deviceplutosdr.h"
+#include "plutosdr/deviceplutosdrbox.h"
+#include "plutosdr/deviceplutosdrparams.h"
+
+#include "plutosdrmithread.h"
+#include "plutosdrmimo.h"
+
+#define PLUTOSDR_BLOCKSIZE_SAMPLES (16*1024) //complex samples per buffer and per channel (must be multiple of 64)
+
+MESSAGE_CLASS_DEFINITION(PlutoSDRMIMO::MsgConfigurePlutoSDRMIMO, Message)
+MESSAGE_CLASS_DEFINITION(PlutoSDRMIMO::MsgStartStop, Message)
+
+PlutoSDRMIMO::PlutoSDRMIMO(DeviceAPI *deviceAPI) :
+    m_deviceAPI(deviceAPI),
+    m_settings(),
+    m_deviceDescription("PlutoSDRMIMO"),
+    m_running(false),
+    m_deviceParams(nullptr),
+    m_open(false),
+    m_thread(nullptr)
+{
+    m_mimoType = MIMOHalfSynchronous;
+    m_sampleMIFifo.init(m_nbRxStreams, 96000 * 4);
+    m_deviceAPI->setNbSourceStreams(m_nbRxStreams);
+    m_deviceAPI->setNbSinkStreams(0);
+    m_open = openDevice();
+}
+
+PlutoSDRMIMO::~PlutoSDRMIMO()
+{
+    if (m_running) {
+        stopRx();
+    }
+
+    closeDevice();
+}
+
+void PlutoSDRMIMO::destroy()
+{
+    delete this;
+}
+
+bool PlutoSDRMIMO::openDevice()
+{
+    // The MIMO device set owns the whole physical device so there are no buddies to look for
+    m_deviceParams = new DevicePlutoSDRParams();
+    bool opened;
+
+    if (m_deviceAPI->getHardwareUserArguments().size() != 0)
+    {
+        QStringList kv = m_deviceAPI->getHardwareUserArguments().split('='); // expecting "uri=xxx"
+
+        if ((kv.size() > 1) && (kv.at(0) == "uri"))
+        {
+            opened = m_deviceParams->openURI(kv.at(1).toStdString());
+        }
+        else
+        {
+            qCritical("PlutoSDRMIMO::openDevice: unexpected user arguments %s", qPrintable(m_deviceAPI->getHardwareUserArguments()));
+            opened = false;
+        }
+    }
+    else
+    {
+        opened = m_deviceParams->open(m_deviceAPI->getSamplingDeviceSerial().toStdString());
+    }
+
+    if (!opened)
+    {
+        qCritical("PlutoSDRMIMO::openDevice: cannot open PlutoSDR device");
+        delete m_deviceParams;
+        m_deviceParams = nullptr;
+        return false;
+    }
+
+    DevicePlutoSDRBox *plutoBox = m_deviceParams->getBox();
+
+    if (!plutoBox->openRx())
+    {
+        qCritical("PlutoSDRMIMO::openDevice: cannot open Rx channel 0");
+        closeDevice();
+        return false;
+    }
+
+    if (!plutoBox->openSecondRx())
+    {
+        qCritical("PlutoSDRMIMO::openDevice: cannot open Rx channel 1. Is the device in 2R2T mode?");
+        closeDevice();
+        return false;
+    }
+
+    qDebug("PlutoSDRMIMO::openDevice: device opened with both Rx channels");
+    return true;
+}
+
+void PlutoSDRMIMO::closeDevice()
+{
+    if (m_deviceParams == nullptr) { // was never open
+        return;
+    }
+
+    if (m_running) {
+        stopRx();
+    }
+
+    m_deviceParams->getBox()->closeSecondRx();
+    m_deviceParams->getBox()->closeRx();
+    m_deviceParams->close();
+    delete m_deviceParams;
+    m_deviceParams = nullptr;
+    m_open = false;
+}
+
+void PlutoSDRMIMO::init()
+{
+    applySettings(m_settings, true);
+}
+
+bool PlutoSDRMIMO::startRx()
+{
+    qDebug("PlutoSDRMIMO::startRx");
+
+    if (!m_open)
+    {
+        qCritical("PlutoSDRMIMO::startRx: device was not opened");
+        return false;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_running) {
+        return true;
+    }
+
+    // the buffer spans all enabled channels so it is created once both Rx channels are enabled
+    if (!m_deviceParams->getBox()->createRxBuffer(PLUTOSDR_BLOCKSIZE_SAMPLES, false))
+    {
+        qCritical("PlutoSDRMIMO::startRx: cannot create Rx buffer");
+        return false;
+    }
+
+    m_sampleMIFifo.reset();
+    m_thread = new PlutoSDRMIThread(PLUTOSDR_BLOCKSIZE_SAMPLES, m_deviceParams->getBox());
+    m_thread->setFifo(&m_sampleMIFifo);
+    m_thread->setLog2Decimation(m_settings.m_log2SoftDecim);
+    m_thread->setFcPos((int) m_settings.m_fcPosRx);
+    m_thread->setIQOrder(m_settings.m_iqOrder);
+    m_thread->startWork();
+    m_running = true;
+
+    return true;
+}
+
+void PlutoSDRMIMO::stopRx()
+{
+    qDebug("PlutoSDRMIMO::stopRx");
+
+    if (!m_thread) {
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    m_thread->stopWork();
+    delete m_thread;
+    m_thread = nullptr;
+    m_deviceParams->getBox()->deleteRxBuffer();
+    m_running = false;
+}
+
+QByteArray PlutoSDRMIMO::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool PlutoSDRMIMO::deserialize(const QByteArray& data)
+{
+    bool success = true;
+
+    if (!m_settings.deserialize(data))
+    {
+        m_settings.resetToDefaults();
+        success = false;
+    }
+
+    MsgConfigurePlutoSDRMIMO* message = MsgConfigurePlutoSDRMIMO::create(m_settings, true);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue)
+    {
+        MsgConfigurePlutoSDRMIMO* messageToGUI = MsgConfigurePlutoSDRMIMO::create(m_settings, true);
+        m_guiMessageQueue->push(messageToGUI);
+    }
+
+    return success;
+}
+
+const QString& PlutoSDRMIMO::getDeviceDescription() const
+{
+    return m_deviceDescription;
+}
+
+int PlutoSDRMIMO::getSourceSampleRate(int index) const
+{
+    (void) index; // both channels share the sample clock
+    return m_settings.m_devSampleRate/(1<<m_settings.m_log2SoftDecim);
+}
+
+quint64 PlutoSDRMIMO::getSourceCenterFrequency(int index) const
+{
+    (void) index; // both channels share the local oscillator
+    return m_settings.m_rxCenterFrequency;
+}
+
+void PlutoSDRMIMO::setSourceCenterFrequency(qint64 centerFrequency, int index)
+{
+    (void) index;
+    PlutoSDRMIMOSettings settings = m_settings;
+    settings.m_rxCenterFrequency = centerFrequency;
+
+    MsgConfigurePlutoSDRMIMO* message = MsgConfigurePlutoSDRMIMO::create(settings, false);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue)
+    {
+        MsgConfigurePlutoSDRMIMO* messageToGUI = MsgConfigurePlutoSDRMIMO::create(settings, false);
+        m_guiMessageQueue->push(messageToGUI);
+    }
+}
+
+void PlutoSDRMIMO::getRxFrequencyRange(quint64& minF, quint64& maxF)
+{
+    if (m_deviceParams)
+    {
+        uint64_t min, max;
+        m_deviceParams->getBox()->getRxLORange(min, max);
+        minF = min;
+        maxF = max;
+    }
+    else
+    {
+        minF = DevicePlutoSDR::rxLOLowLimitFreq;
+        maxF = DevicePlutoSDR::rxLOHighLimitFreq;
+    }
+}
+
+void PlutoSDRMIMO::getRxLPFRange(quint32& minF, quint32& maxF)
+{
+    if (m_deviceParams)
+    {
+        uint32_t min, max;
+        m_deviceParams->getBox()->getbbLPRxRange(min, max);
+        minF = min;
+        maxF = max;
+    }
+    else
+    {
+        minF = DevicePlutoSDR::bbLPRxLowLimitFreq;
+        maxF = DevicePlutoSDR::bbLPRxHighLimitFreq;
+    }
+}
+
+bool PlutoSDRMIMO::handleMessage(const Message& message)
+{
+    if (MsgConfigurePlutoSDRMIMO::match(message))
+    {
+        MsgConfigurePlutoSDRMIMO& conf = (MsgConfigurePlutoSDRMIMO&) message;
+        qDebug() << "PlutoSDRMIMO::handleMessage: MsgConfigurePlutoSDRMIMO";
+
+        if (!applySettings(conf.getSettings(), conf.getForce())) {
+            qDebug("PlutoSDRMIMO::handleMessage: config error");
+        }
+
+        return true;
+    }
+    else if (MsgStartStop::match(message))
+    {
+        MsgStartStop& cmd = (MsgStartStop&) message;
+        qDebug() << "PlutoSDRMIMO::handleMessage: MsgStartStop: " << (cmd.getStartStop() ? "start" : "stop");
+
+        if (cmd.getStartStop())
+        {
+            if (m_deviceAPI->initDeviceEngine(0)) {
+                m_deviceAPI->startDeviceEngine(0);
+            }
+        }
+        else
+        {
+            m_deviceAPI->stopDeviceEngine(0);
+        }
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+
+bool PlutoSDRMIMO::applySettings(const PlutoSDRMIMOSettings& settings, bool force)
+{
+    if (!m_open)
+    {
+        qCritical("PlutoSDRMIMO::applySettings: device not open");
+        return false;
+    }
+
+    qDebug() << "PlutoSDRMIMO::applySettings: "
+            << " m_rxCenterFrequency: " << settings.m_rxCenterFrequency << " Hz"
+            << " m_devSampleRate: " << settings.m_devSampleRate
+            << " m_LOppmTenths: " << settings.m_LOppmTenths
+            << " m_lpfFIREnable: " << settings.m_lpfFIREnable
+            << " m_lpfFIRBW: " << settings.m_lpfFIRBW
+            << " m_lpfFIRlog2Decim: " << settings.m_lpfFIRlog2Decim
+            << " m_lpfFIRGain: " << settings.m_lpfFIRGain
+            << " m_log2SoftDecim: " << settings.m_log2SoftDecim
+            << " m_fcPosRx: " << settings.m_fcPosRx
+            << " m_dcBlock: " << settings.m_dcBlock
+            << " m_iqCorrection: " << settings.m_iqCorrection
+            << " m_hwBBDCBlock: " << settings.m_hwBBDCBlock
+            << " m_hwRFDCBlock: " << settings.m_hwRFDCBlock
+            << " m_hwIQCorrection: " << settings.m_hwIQCorrection
+            << " m_lpfBW: " << settings.m_lpfBW
+            << " m_antennaPath: " << (int) settings.m_antennaPath
+            << " m_gainMode: " << (int) settings.m_gainMode
+            << " m_rx0Gain: " << settings.m_rx0Gain
+            << " m_rx1Gain: " << settings.m_rx1Gain
+            << " m_rxTransverterMode: " << settings.m_rxTransverterMode
+            << " m_rxTransverterDeltaFrequency: " << settings.m_rxTransverterDeltaFrequency
+            << " m_iqOrder: " << settings.m_iqOrder
+            << " m_spectrumStreamIndex: " << settings.m_spectrumStreamIndex
+            << " force: " << force;
+
+    bool forwardChangeRxDSP = false;
+    bool threadWasRunning = false;
+    DevicePlutoSDRBox *plutoBox = m_deviceParams->getBox();
+    std::vector<std::string> params;
+
+    // changes of the sample rate chain need the stream to be stopped
+    bool changeSampleRateChain = (m_settings.m_devSampleRate != settings.m_devSampleRate)
+        || (m_settings.m_lpfFIREnable != settings.m_lpfFIREnable)
+        || (m_settings.m_lpfFIRlog2Decim != settings.m_lpfFIRlog2Decim)
+        || (m_settings.m_lpfFIRBW != settings.m_lpfFIRBW)
+        || (m_settings.m_lpfFIRGain != settings.m_lpfFIRGain) || force;
+
+    if ((changeSampleRateChain || (m_settings.m_LOppmTenths != settings.m_LOppmTenths)) && m_thread && m_thread->isRunning())
+    {
+        m_thread->stopWork();
+        threadWasRunning = true;
+    }
+
+    if ((m_settings.m_dcBlock != settings.m_dcBlock) ||
+        (m_settings.m_iqCorrection != settings.m_iqCorrection) || force)
+    {
+        for (unsigned int i = 0; i < m_nbRxStreams; i++) {
+            m_deviceAPI->configureCorrections(settings.m_dcBlock, settings.m_iqCorrection, i);
+        }
+    }
+
+    if (changeSampleRateChain)
+    {
+        plutoBox->setFIR(settings.m_devSampleRate, settings.m_lpfFIRlog2Decim, DevicePlutoSDRBox::USE_RX, settings.m_lpfFIRBW, settings.m_lpfFIRGain);
+        plutoBox->setFIREnable(settings.m_lpfFIREnable);   // eventually enable/disable FIR
+        plutoBox->setSampleRate(settings.m_devSampleRate); // and set end point sample rate
+        forwardChangeRxDSP = true;
+    }
+
+    if ((m_settings.m_LOppmTenths != settings.m_LOppmTenths) || force) {
+        plutoBox->setLOPPMTenths(settings.m_LOppmTenths);
+    }
+
+    if ((m_settings.m_log2SoftDecim != settings.m_log2SoftDecim) || force)
+    {
+        forwardChangeRxDSP = true;
+
+        if (m_thread) {
+            m_thread->setLog2Decimation(settings.m_log2SoftDecim);
+        }
+    }
+
+    if ((m_settings.m_fcPosRx != settings.m_fcPosRx) || force)
+    {
+        if (m_thread) {
+            m_thread->setFcPos((int) settings.m_fcPosRx);
+        }
+    }
+
+    if ((m_settings.m_iqOrder != settings.m_iqOrder) || force)
+    {
+        if (m_thread) {
+            m_thread->setIQOrder(settings.m_iqOrder);
+        }
+    }
+
+    // the LO is common to both Rx channels
+    if ((m_settings.m_rxCenterFrequency != settings.m_rxCenterFrequency)
+        || (m_settings.m_fcPosRx != settings.m_fcPosRx)
+        || (m_settings.m_log2SoftDecim != settings.m_log2SoftDecim)
+        || (m_settings.m_devSampleRate != settings.m_devSampleRate)
+        || (m_settings.m_rxTransverterMode != settings.m_rxTransverterMode)
+        || (m_settings.m_rxTransverterDeltaFrequency != settings.m_rxTransverterDeltaFrequency) || force)
+    {
+        qint64 deviceCenterFrequency = DeviceSampleSource::calculateDeviceCenterFrequency(
+                settings.m_rxCenterFrequency,
+                settings.m_rxTransverterDeltaFrequency,
+                settings.m_log2SoftDecim,
+                (DeviceSampleSource::fcPos_t) settings.m_fcPosRx,
+                settings.m_devSampleRate,
+                DeviceSampleSource::FrequencyShiftScheme::FSHIFT_STD,
+                settings.m_rxTransverterMode);
+
+        params.push_back(QString("out_altvoltage0_RX_LO_frequency=%1").arg(deviceCenterFrequency).toStdString());
+        forwardChangeRxDSP = true;
+    }
+
+    if ((m_settings.m_lpfBW != settings.m_lpfBW) || force) {
+        params.push_back(QString("in_voltage_rf_bandwidth=%1").arg(settings.m_lpfBW).toStdString());
+    }
+
+    // the RF port selection of the AD9361 applies to both receivers
+    if ((m_settings.m_antennaPath != settings.m_antennaPath) || force)
+    {
+        QString rfPortStr;
+        PlutoSDRMIMOSettings::translateRFPath(settings.m_antennaPath, rfPortStr);
+        params.push_back(QString("in_voltage0_rf_port_select=%1").arg(rfPortStr).toStdString());
+    }
+
+    if ((m_settings.m_gainMode != settings.m_gainMode) || force)
+    {
+        QString gainModeStr;
+        PlutoSDRMIMOSettings::translateGainMode(settings.m_gainMode, gainModeStr);
+
+        for (unsigned int i = 0; i < m_nbRxStreams; i++) {
+            params.push_back(QString("in_voltage%1_gain_control_mode=%2").arg(i).arg(gainModeStr).toStdString());
+        }
+    }
+
+    if ((m_settings.m_rx0Gain != settings.m_rx0Gain) || force) {
+        params.push_back(QString("in_voltage0_hardwaregain=%1").arg(settings.m_rx0Gain).toStdString());
+    }
+
+    if ((m_settings.m_rx1Gain != settings.m_rx1Gain) || force) {
+        params.push_back(QString("in_voltage1_hardwaregain=%1").arg(settings.m_rx1Gain).toStdString());
+    }
+
+    if ((m_settings.m_hwBBDCBlock != settings.m_hwBBDCBlock) || force) {
+        params.push_back(QString("in_voltage_bb_dc_offset_tracking_en=%1").arg(settings.m_hwBBDCBlock ? 1 : 0).toStdString());
+    }
+
+    if ((m_settings.m_hwRFDCBlock != settings.m_hwRFDCBlock) || force) {
+        params.push_back(QString("in_voltage_rf_dc_offset_tracking_en=%1").arg(settings.m_hwRFDCBlock ? 1 : 0).toStdString());
+    }
+
+    if ((m_settings.m_hwIQCorrection != settings.m_hwIQCorrection) || force) {
+        params.push_back(QString("in_voltage_quadrature_tracking_en=%1").arg(settings.m_hwIQCorrection ? 1 : 0).toStdString());
+    }
+
+    if (params.size() > 0) {
+        plutoBox->set_params(DevicePlutoSDRBox::DEVICE_PHY, params);
+    }
+
+    bool doSpectrumSource = (m_settings.m_spectrumStreamIndex != settings.m_spectrumStreamIndex) || force;
+
+    m_settings = settings;
+
+    if (threadWasRunning) {
+        m_thread->startWork();
+    }
+
+    if (forwardChangeRxDSP)
+    {
+        int sampleRate = m_settings.m_devSampleRate/(1<<m_settings.m_log2SoftDecim);
+
+        for (unsigned int i = 0; i < m_nbRxStreams; i++)
+        {
+            DSPMIMOSignalNotification *notif = new DSPMIMOSignalNotification(sampleRate, m_settings.m_rxCenterFrequency, true, i);
+            m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+        }
+    }
+
+    if (doSpectrumSource) {
+        m_deviceAPI->setSpectrumSinkInput(true, m_settings.m_spectrumStreamIndex);
+    }
+
+    return true;
+}
+
+int PlutoSDRMIMO::webapiRunGet(
+        int subsystemIndex,
+        SWGSDRangel::SWGDeviceState& response,
+        QString& errorMessage)
+{
+    if (subsystemIndex != 0)
+    {
+        errorMessage = QString("Subsystem index invalid: expect 0 (Rx) only");
+        return 404;
+    }
+
+    m_deviceAPI->getDeviceEngineStateStr(*response.getState(), subsystemIndex);
+    return 200;
+}
+
+int PlutoSDRMIMO::webapiRun(
+        bool run,
+        int subsystemIndex,
+        SWGSDRangel::SWGDeviceState& response,
+        QString& errorMessage)
+{
+    if (subsystemIndex != 0)
+    {
+        errorMessage = QString("Subsystem index invalid: expect 0 (Rx) only");
+        return 404;
+    }
+
+    m_deviceAPI->getDeviceEngineStateStr(*response.getState(), subsystemIndex);
+    MsgStartStop *message = MsgStartStop::create(run);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgStartStop *msgToGUI = MsgStartStop::create(run);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    return 200;
+}
+
+int PlutoSDRMIMO::webapiSettingsGet(
+                SWGSDRangel::SWGDeviceSettings& response,
+                QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setPlutoSdrMimoSettings(new SWGSDRangel::SWGPlutoSdrMIMOSettings());
+    response.getPlutoSdrMimoSettings()->init();
+    webapiFormatDeviceSettings(response, m_settings);
+    return 200;
+}
+
+int PlutoSDRMIMO::webapiSettingsPutPatch(
+                bool force,
+                const QStringList& deviceSettingsKeys,
+                SWGSDRangel::SWGDeviceSettings& response, // query + response
+                QString& errorMessage)
+{
+    (void) errorMessage;
+    PlutoSDRMIMOSettings settings = m_settings;
+    webapiUpdateDeviceSettings(settings, deviceSettingsKeys, response);
+
+    MsgConfigurePlutoSDRMIMO *msg = MsgConfigurePlutoSDRMIMO::create(settings, force);
+    m_inputMessageQueue.push(msg);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgConfigurePlutoSDRMIMO *msgToGUI = MsgConfigurePlutoSDRMIMO::create(settings, force);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    webapiFormatDeviceSettings(response, settings);
+    return 200;
+}
+
+void PlutoSDRMIMO::webapiUpdateDeviceSettings(
+    PlutoSDRMIMOSettings& settings,
+    const QStringList& deviceSettingsKeys,
+    SWGSDRangel::SWGDeviceSettings& response)
+{
+    SWGSDRangel::SWGPlutoSdrMIMOSettings *swgSettings = response.getPlutoSdrMimoSettings();
+
+    if (deviceSettingsKeys.contains("devSampleRate")) {
+        settings.m_devSampleRate = swgSettings->getDevSampleRate();
+    }
+    if (deviceSettingsKeys.contains("LOppmTenths")) {
+        settings.m_LOppmTenths = swgSettings->getLOppmTenths();
+    }
+    if (deviceSettingsKeys.contains("lpfFIREnable")) {
+        settings.m_lpfFIREnable = swgSettings->getLpfFirEnable() != 0;
+    }
+    if (deviceSettingsKeys.contains("lpfFIRBW")) {
+        settings.m_lpfFIRBW = swgSettings->getLpfFirbw();
+    }
+    if (deviceSettingsKeys.contains("lpfFIRlog2Decim")) {
+        int log2Decim = swgSettings->getLpfFiRlog2Decim();
+        settings.m_lpfFIRlog2Decim = log2Decim < 0 ? 0 : log2Decim > 2 ? 2 : log2Decim;
+    }
+    if (deviceSettingsKeys.contains("lpfFIRGain")) {
+        settings.m_lpfFIRGain = swgSettings->getLpfFirGain();
+    }
+    if (deviceSettingsKeys.contains("rxCenterFrequency")) {
+        settings.m_rxCenterFrequency = swgSettings->getRxCenterFrequency();
+    }
+    if (deviceSettingsKeys.contains("log2SoftDecim")) {
+        settings.m_log2SoftDecim = swgSettings->getLog2SoftDecim();
+    }
+    if (deviceSettingsKeys.contains("fcPosRx")) {
+        int fcPos = swgSettings->getFcPosRx();
+        fcPos = fcPos < 0 ? 0 : fcPos > 2 ? 2 : fcPos;
+        settings.m_fcPosRx = (PlutoSDRMIMOSettings::fcPos_t) fcPos;
+    }
+    if (deviceSettingsKeys.contains("dcBlock")) {
+        settings.m_dcBlock = swgSettings->getDcBlock() != 0;
+    }
+    if (deviceSettingsKeys.contains("iqCorrection")) {
+        settings.m_iqCorrection = swgSettings->getIqCorrection() != 0;
+    }
+    if (deviceSettingsKeys.contains("hwBBDCBlock")) {
+        settings.m_hwBBDCBlock = swgSettings->getHwBbdcBlock() != 0;
+    }
+    if (deviceSettingsKeys.contains("hwRFDCBlock")) {
+        settings.m_hwRFDCBlock = swgSettings->getHwRfdcBlock() != 0;
+    }
+    if (deviceSettingsKeys.contains("hwIQCorrection")) {
+        settings.m_hwIQCorrection = swgSettings->getHwIqCorrection() != 0;
+    }
+    if (deviceSettingsKeys.contains("lpfBW")) {
+        settings.m_lpfBW = swgSettings->getLpfBw();
+    }
+    if (deviceSettingsKeys.contains("antennaPath")) {
+        int antennaPath = swgSettings->getAntennaPath();
+        settings.m_antennaPath = (antennaPath >= 0) && (antennaPath < (int) PlutoSDRMIMOSettings::RFPATH_END) ?
+            (PlutoSDRMIMOSettings::RFPath) antennaPath : PlutoSDRMIMOSettings::RFPATH_A_BAL;
+    }
+    if (deviceSettingsKeys.contains("gainMode")) {
+        int gainMode = swgSettings->getGainMode();
+        settings.m_gainMode = (gainMode >= 0) && (gainMode < (int) PlutoSDRMIMOSettings::GAIN_END) ?
+            (PlutoSDRMIMOSettings::GainMode) gainMode : PlutoSDRMIMOSettings::GAIN_MANUAL;
+    }
+    if (deviceSettingsKeys.contains("rx0Gain")) {
+        settings.m_rx0Gain = swgSettings->getRx0Gain();
+    }
+    if (deviceSettingsKeys.contains("rx1Gain")) {
+        settings.m_rx1Gain = swgSettings->getRx1Gain();
+    }
+    if (deviceSettingsKeys.contains("rxTransverterMode")) {
+        settings.m_rxTransverterMode = swgSettings->getRxTransverterMode() != 0;
+    }
+    if (deviceSettingsKeys.contains("rxTransverterDeltaFrequency")) {
+        settings.m_rxTransverterDeltaFrequency = swgSettings->getRxTransverterDeltaFrequency();
+    }
+    if (deviceSettingsKeys.contains("iqOrder")) {
+        settings.m_iqOrder = swgSettings->getIqOrder() != 0;
+    }
+    if (deviceSettingsKeys.contains("spectrumStreamIndex")) {
+        unsigned int index = swgSettings->getSpectrumStreamIndex();
+        settings.m_spectrumStreamIndex = index < m_nbRxStreams ? index : m_nbRxStreams - 1;
+    }
+}
+
+void PlutoSDRMIMO::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const PlutoSDRMIMOSettings& settings)
+{
+    SWGSDRangel::SWGPlutoSdrMIMOSettings *swgSettings = response.getPlutoSdrMimoSettings();
+    swgSettings->setDevSampleRate(settings.m_devSampleRate);
+    swgSettings->setLOppmTenths(settings.m_LOppmTenths);
+    swgSettings->setLpfFirEnable(settings.m_lpfFIREnable ? 1 : 0);
+    swgSettings->setLpfFirbw(settings.m_lpfFIRBW);
+    swgSettings->setLpfFiRlog2Decim(settings.m_lpfFIRlog2Decim);
+    swgSettings->setLpfFirGain(settings.m_lpfFIRGain);
+    swgSettings->setRxCenterFrequency(settings.m_rxCenterFrequency);
+    swgSettings->setLog2SoftDecim(settings.m_log2SoftDecim);
+    swgSettings->setFcPosRx((int) settings.m_fcPosRx);
+    swgSettings->setDcBlock(settings.m_dcBlock ? 1 : 0);
+    swgSettings->setIqCorrection(settings.m_iqCorrection ? 1 : 0);
+    swgSettings->setHwBbdcBlock(settings.m_hwBBDCBlock ? 1 : 0);
+    swgSettings->setHwRfdcBlock(settings.m_hwRFDCBlock ? 1 : 0);
+    swgSettings->setHwIqCorrection(settings.m_hwIQCorrection ? 1 : 0);
+    swgSettings->setLpfBw(settings.m_lpfBW);
+    swgSettings->setAntennaPath((int) settings.m_antennaPath);
+    swgSettings->setGainMode((int) settings.m_gainMode);
+    swgSettings->setRx0Gain(settings.m_rx0Gain);
+    swgSettings->setRx1Gain(settings.m_rx1Gain);
+    swgSettings->setRxTransverterMode(settings.m_rxTransverterMode ? 1 : 0);
+    swgSettings->setRxTransverterDeltaFrequency(settings.m_rxTransverterDeltaFrequency);
+    swgSettings->setIqOrder(settings.m_iqOrder ? 1 : 0);
+    swgSettings->setSpectrumStreamIndex(settings.m_spectrumStreamIndex);
+}
@@ -0,0 +1,165 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLUGINS_SAMPLEMIMO_PLUTOSDRMIMO_PLUTOSDRMIMO_H_
+#define PLUGINS_SAMPLEMIMO_PLUTOSDRMIMO_PLUTOSDRMIMO_H_
+
+#include <stdint.h>
+
+#include <QString>
+#include <QByteArray>
+#include <QMutex>
+
+#include "dsp/devicesamplemimo.h"
+#include "plutosdrmimosettings.h"
+
+class DeviceAPI;
+class DevicePlutoSDRParams;
+class PlutoSDRMIThread;
+
+/**
+ * PlutoSDR in 2R2T mode with its two Rx channels in one MIMO device set. Both channels are read from
+ * the same IIO buffer so they are sample aligned and share the LO of the device. The Tx side is not
+ * supported yet.
+ */
+class PlutoSDRMIMO : public DeviceSampleMIMO {
+    Q_OBJECT
+public:
+    class MsgConfigurePlutoSDRMIMO : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        const PlutoSDRMIMOSettings& getSettings() const { return m_settings; }
+        bool getForce() const { return m_force; }
+
+        static MsgConfigurePlutoSDRMIMO* create(const PlutoSDRMIMOSettings& settings, bool force)
+        {
+            return new MsgConfigurePlutoSDRMIMO(settings, force);
+        }
+
+    private:
+        PlutoSDRMIMOSettings m_settings;
+        bool m_force;
+
+        MsgConfigurePlutoSDRMIMO(const PlutoSDRMIMOSettings& settings, bool force) :
+            Message(),
+            m_settings(settings),
+            m_force(force)
+        { }
+    };
+
+    class MsgStartStop : public Message {
+        MESSAGE_CLASS_DECLARATION
+
+    public:
+        bool getStartStop() const { return m_startStop; }
+
+        static MsgStartStop* create(bool startStop) {
+            return new MsgStartStop(startStop);
+        }
+
+    protected:
+        bool m_startStop;
+
+        MsgStartStop(bool startStop) :
+            Message(),
+            m_startStop(startStop)
+        { }
+    };
+
+    PlutoSDRMIMO(DeviceAPI *deviceAPI);
+    virtual ~PlutoSDRMIMO();
+    virtual void destroy();
+
+    virtual void init();
+    virtual bool startRx();
+    virtual void stopRx();
+    virtual bool startTx() { return false; }
+    virtual void stopTx() {}
+
+    virtual QByteArray serialize() const;
+    virtual bool deserialize(const QByteArray& data);
+
+    virtual void setMessageQueueToGUI(MessageQueue *queue) { m_guiMessageQueue = queue; }
+    virtual const QString& getDeviceDescription() const;
+
+    virtual int getSourceSampleRate(int index) const;
+    virtual void setSourceSampleRate(int sampleRate, int index) { (void) sampleRate; (void) index; }
+    virtual quint64 getSourceCenterFrequency(int index) const;
+    virtual void setSourceCenterFrequency(qint64 centerFrequency, int index);
+
+    virtual int getSinkSampleRate(int index) const { (void) index; return 0; }
+    virtual void setSinkSampleRate(int sampleRate, int index) { (void) sampleRate; (void) index; }
+    virtual quint64 getSinkCenterFrequency(int index) const { (void) index; return 0; }
+    virtual void setSinkCenterFrequency(qint64 centerFrequency, int index) { (void) centerFrequency; (void) index; }
+
+    virtual quint64 getMIMOCenterFrequency() const { return getSourceCenterFrequency(0); }
+    virtual unsigned int getMIMOSampleRate() const { return getSourceSampleRate(0); }
+
+    void getRxFrequencyRange(quint64& minF, quint64& maxF);
+    void getRxLPFRange(quint32& minF, quint32& maxF);
+
+    virtual bool handleMessage(const Message& message);
+
+    virtual int webapiSettingsGet(
+                SWGSDRangel::SWGDeviceSettings& response,
+                QString& errorMessage);
+
+    virtual int webapiSettingsPutPatch(
+                bool force,
+                const QStringList& deviceSettingsKeys,
+                SWGSDRangel::SWGDeviceSettings& response, // query + response
+                QString& errorMessage);
+
+    virtual int webapiRunGet(
+            int subsystemIndex,
+            SWGSDRangel::SWGDeviceState& response,
+            QString& errorMessage);
+
+    virtual int webapiRun(
+            bool run,
+            int subsystemIndex,
+            SWGSDRangel::SWGDeviceState& response,
+            QString& errorMessage);
+
+    static void webapiFormatDeviceSettings(
+            SWGSDRangel::SWGDeviceSettings& response,
+            const PlutoSDRMIMOSettings& settings);
+
+    static void webapiUpdateDeviceSettings(
+            PlutoSDRMIMOSettings& settings,
+            const QStringList& deviceSettingsKeys,
+            SWGSDRangel::SWGDeviceSettings& response);
+
+    static const unsigned int m_nbRxStreams = 2;
+
+private:
+    DeviceAPI *m_deviceAPI;
+    QMutex m_mutex;
+    PlutoSDRMIMOSettings m_settings;
+    QString m_deviceDescription;
+    bool m_running;
+    DevicePlutoSDRParams *m_deviceParams;
+    bool m_open;
+    PlutoSDRMIThread *m_thread;
+
+    bool openDevice();
+    void closeDevice();
+    bool applySettings(const PlutoSDRMIMOSettings& settings, bool force);
+};
+
+#endif /* PLUGINS_SAMPLEMIMO_PLUTOSDRMIMO_PLUTOSDRMIMO_H_ */
@@ -0,0 +1,456 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+#include <QMessageBox>
+
+#include "ui_plutosdrmimogui.h"
+#include "gui/colormapper.h"
+#include "gui/glspectrum.h"
+#include "dsp/dspcommands.h"
+#include "device/deviceapi.h"
+#include "device/deviceuiset.h"
+#include "plutosdr/deviceplutosdr.h"
+
+#include "plutosdrmimogui.h"
+
+PlutoSDRMIMOGui::PlutoSDRMIMOGui(DeviceUISet *deviceUISet, QWidget* parent) :
+    QWidget(parent),
+    ui(new Ui::PlutoSDRMIMOGui),
+    m_deviceUISet(deviceUISet),
+    m_settings(),
+    m_doApplySettings(true),
+    m_forceSettings(true),
+    m_sampleMIMO(nullptr),
+    m_deviceSampleRate(2500000),
+    m_deviceCenterFrequency(0),
+    m_lastEngineState(DeviceAPI::StNotStarted)
+{
+    qDebug("PlutoSDRMIMOGui::PlutoSDRMIMOGui");
+    m_sampleMIMO = (PlutoSDRMIMO*) m_deviceUISet->m_deviceAPI->getSampleMIMO();
+    quint32 minLPF = 0, maxLPF = 0;
+
+    ui->setupUi(this);
+
+    ui->centerFrequency->setColorMapper(ColorMapper(ColorMapper::GrayGold));
+    updateFrequencyLimits();
+
+    ui->sampleRate->setColorMapper(ColorMapper(ColorMapper::GrayGreenYellow));
+    updateSampleRateLimits();
+
+    m_sampleMIMO->getRxLPFRange(minLPF, maxLPF);
+    ui->lpf->setColorMapper(ColorMapper(ColorMapper::GrayYellow));
+    ui->lpf->setValueRange(5, minLPF/1000, maxLPF/1000);
+
+    ui->lpFIR->setColorMapper(ColorMapper(ColorMapper::GrayYellow));
+    ui->lpFIR->setValueRange(5, 1U, 56000U);
+
+    displaySettings();
+
+    connect(&m_updateTimer, SIGNAL(timeout()), this, SLOT(updateHardware()));
+    connect(&m_statusTimer, SIGNAL(timeout()), this, SLOT(updateStatus()));
+    m_statusTimer.start(500);
+
+    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()), Qt::QueuedConnection);
+    m_sampleMIMO->setMessageQueueToGUI(&m_inputMessageQueue);
+
+    sendSettings();
+}
+
+PlutoSDRMIMOGui::~PlutoSDRMIMOGui()
+{
+    delete ui;
+}
+
+void PlutoSDRMIMOGui::destroy()
+{
+    delete this;
+}
+
+void PlutoSDRMIMOGui::setName(const QString& name)
+{
+    setObjectName(name);
+}
+
+QString PlutoSDRMIMOGui::getName() const
+{
+    return objectName();
+}
+
+void PlutoSDRMIMOGui::resetToDefaults()
+{
+    m_settings.resetToDefaults();
+    displaySettings();
+    sendSettings();
+}
+
+qint64 PlutoSDRMIMOGui::getCenterFrequency() const
+{
+    return m_settings.m_rxCenterFrequency;
+}
+
+void PlutoSDRMIMOGui::setCenterFrequency(qint64 centerFrequency)
+{
+    m_settings.m_rxCenterFrequency = centerFrequency;
+    displaySettings();
+    sendSettings();
+}
+
+QByteArray PlutoSDRMIMOGui::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool PlutoSDRMIMOGui::deserialize(const QByteArray& data)
+{
+    if (m_settings.deserialize(data))
+    {
+        displaySettings();
+        m_forceSettings = true;
+        sendSettings();
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
+
+void PlutoSDRMIMOGui::on_startStop_toggled(bool checked)
+{
+    if (m_doApplySettings)
+    {
+        PlutoSDRMIMO::MsgStartStop *message = PlutoSDRMIMO::MsgStartStop::create(checked);
+        m_sampleMIMO->getInputMessageQueue()->push(message);
+    }
+}
+
+void PlutoSDRMIMOGui::on_centerFrequency_changed(quint64 value)
+{
+    m_settings.m_rxCenterFrequency = value * 1000;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_dcOffset_toggled(bool checked)
+{
+    m_settings.m_dcBlock = checked;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_iqImbalance_toggled(bool checked)
+{
+    m_settings.m_iqCorrection = checked;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_hwBBDCBlock_toggled(bool checked)
+{
+    m_settings.m_hwBBDCBlock = checked;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_hwRFDCBlock_toggled(bool checked)
+{
+    m_settings.m_hwRFDCBlock = checked;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_hwIQCorrection_toggled(bool checked)
+{
+    m_settings.m_hwIQCorrection = checked;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_transverter_clicked()
+{
+    m_settings.m_rxTransverterMode = ui->transverter->getDeltaFrequencyAcive();
+    m_settings.m_rxTransverterDeltaFrequency = ui->transverter->getDeltaFrequency();
+    m_settings.m_iqOrder = ui->transverter->getIQOrder();
+    qDebug("PlutoSDRMIMOGui::on_transverter_clicked: %lld Hz %s", m_settings.m_rxTransverterDeltaFrequency, m_settings.m_rxTransverterMode ? "on" : "off");
+    updateFrequencyLimits();
+    m_settings.m_rxCenterFrequency = ui->centerFrequency->getValueNew() * 1000;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_sampleRate_changed(quint64 value)
+{
+    m_settings.m_devSampleRate = value;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_swDecim_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index > 6)) {
+        return;
+    }
+
+    m_settings.m_log2SoftDecim = index;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_fcPos_currentIndexChanged(int index)
+{
+    m_settings.m_fcPosRx = (PlutoSDRMIMOSettings::fcPos_t) (index < 0 ? 0 : index > 2 ? 2 : index);
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_lpf_changed(quint64 value)
+{
+    m_settings.m_lpfBW = value * 1000;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_antenna_currentIndexChanged(int index)
+{
+    m_settings.m_antennaPath = (PlutoSDRMIMOSettings::RFPath) (index < 0 ? 0 : index);
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_spectrumSource_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index >= (int) PlutoSDRMIMO::m_nbRxStreams)) {
+        return;
+    }
+
+    m_settings.m_spectrumStreamIndex = index;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_lpFIREnable_toggled(bool checked)
+{
+    m_settings.m_lpfFIREnable = checked;
+    updateSampleRateLimits();
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_lpFIR_changed(quint64 value)
+{
+    m_settings.m_lpfFIRBW = value * 1000;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_lpFIRDecimation_currentIndexChanged(int index)
+{
+    m_settings.m_lpfFIRlog2Decim = index < 0 ? 0 : index > 2 ? 2 : index;
+    updateSampleRateLimits();
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_lpFIRGain_currentIndexChanged(int index)
+{
+    m_settings.m_lpfFIRGain = 6*(index < 0 ? 0 : index > 3 ? 3 : index) - 12;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_gainMode_currentIndexChanged(int index)
+{
+    m_settings.m_gainMode = (PlutoSDRMIMOSettings::GainMode) (index < 0 ? 0 : index);
+    ui->rx0Gain->setEnabled(m_settings.m_gainMode == PlutoSDRMIMOSettings::GAIN_MANUAL);
+    ui->rx1Gain->setEnabled(m_settings.m_gainMode == PlutoSDRMIMOSettings::GAIN_MANUAL);
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_loPPM_valueChanged(int value)
+{
+    m_settings.m_LOppmTenths = value;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_rx0Gain_valueChanged(int value)
+{
+    ui->rx0GainText->setText(tr("%1").arg(value));
+    m_settings.m_rx0Gain = value;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::on_rx1Gain_valueChanged(int value)
+{
+    ui->rx1GainText->setText(tr("%1").arg(value));
+    m_settings.m_rx1Gain = value;
+    sendSettings();
+}
+
+void PlutoSDRMIMOGui::displaySettings()
+{
+    blockApplySettings(true);
+    ui->transverter->setDeltaFrequency(m_settings.m_rxTransverterDeltaFrequency);
+    ui->transverter->setDeltaFrequencyActive(m_settings.m_rxTransverterMode);
+    ui->transverter->setIQOrder(m_settings.m_iqOrder);
+    updateFrequencyLimits();
+    ui->centerFrequency->setValue(m_settings.m_rxCenterFrequency / 1000);
+    ui->dcOffset->setChecked(m_settings.m_dcBlock);
+    ui->iqImbalance->setChecked(m_settings.m_iqCorrection);
+    ui->hwBBDCBlock->setChecked(m_settings.m_hwBBDCBlock);
+    ui->hwRFDCBlock->setChecked(m_settings.m_hwRFDCBlock);
+    ui->hwIQCorrection->setChecked(m_settings.m_hwIQCorrection);
+    ui->lpFIREnable->setChecked(m_settings.m_lpfFIREnable);
+    ui->lpFIR->setValue(m_settings.m_lpfFIRBW / 1000);
+    ui->lpFIRDecimation->setCurrentIndex(m_settings.m_lpfFIRlog2Decim);
+    ui->lpFIRGain->setCurrentIndex((m_settings.m_lpfFIRGain + 12)/6);
+    updateSampleRateLimits();
+    ui->sampleRate->setValue(m_settings.m_devSampleRate);
+    ui->swDecim->setCurrentIndex(m_settings.m_log2SoftDecim);
+    ui->fcPos->setCurrentIndex((int) m_settings.m_fcPosRx);
+    ui->lpf->setValue(m_settings.m_lpfBW / 1000);
+    ui->antenna->setCurrentIndex((int) m_settings.m_antennaPath);
+    ui->gainMode->setCurrentIndex((int) m_settings.m_gainMode);
+    ui->loPPM->setValue(m_settings.m_LOppmTenths);
+    ui->rx0Gain->setEnabled(m_settings.m_gainMode == PlutoSDRMIMOSettings::GAIN_MANUAL);
+    ui->rx1Gain->setEnabled(m_settings.m_gainMode == PlutoSDRMIMOSettings::GAIN_MANUAL);
+    ui->spectrumSource->setCurrentIndex(m_settings.m_spectrumStreamIndex);
+    ui->rx0Gain->setValue(m_settings.m_rx0Gain);
+    ui->rx0GainText->setText(tr("%1").arg(m_settings.m_rx0Gain));
+    ui->rx1Gain->setValue(m_settings.m_rx1Gain);
+    ui->rx1GainText->setText(tr("%1").arg(m_settings.m_rx1Gain));
+    blockApplySettings(false);
+}
+
+void PlutoSDRMIMOGui::sendSettings()
+{
+    if (!m_updateTimer.isActive()) {
+        m_updateTimer.start(100);
+    }
+}
+
+void PlutoSDRMIMOGui::updateHardware()
+{
+    if (m_doApplySettings)
+    {
+        PlutoSDRMIMO::MsgConfigurePlutoSDRMIMO* message = PlutoSDRMIMO::MsgConfigurePlutoSDRMIMO::create(m_settings, m_forceSettings);
+        m_sampleMIMO->getInputMessageQueue()->push(message);
+        m_forceSettings = false;
+        m_updateTimer.stop();
+    }
+}
+void PlutoSDRMIMOGui::updateStatus()
+{
+    int state = m_deviceUISet->m_deviceAPI->state(0);
+
+    if (m_lastEngineState != state)
+    {
+        switch(state)
+        {
+            case DeviceAPI::StNotStarted:
+                ui->startStop->setStyleSheet("QToolButton { background:rgb(79,79,79); }");
+                break;
+            case DeviceAPI::StIdle:
+                ui->startStop->setStyleSheet("QToolButton { background-color : blue; }");
+                break;
+            case DeviceAPI::StRunning:
+                ui->startStop->setStyleSheet("QToolButton { background-color : green; }");
+                break;
+            case DeviceAPI::StError:
+                ui->startStop->setStyleSheet("QToolButton { background-color : red; }");
+                QMessageBox::information(this, tr("Message"), m_deviceUISet->m_deviceAPI->errorMessage(0));
+                break;
+            default:
+                break;
+        }
+
+        m_lastEngineState = state;
+    }
+}
+
+bool PlutoSDRMIMOGui::handleMessage(const Message& message)
+{
+    if (PlutoSDRMIMO::MsgConfigurePlutoSDRMIMO::match(message))
+    {
+        qDebug("PlutoSDRMIMOGui::handleMessage: MsgConfigurePlutoSDRMIMO");
+        const PlutoSDRMIMO::MsgConfigurePlutoSDRMIMO& cfg = (PlutoSDRMIMO::MsgConfigurePlutoSDRMIMO&) message;
+        m_settings = cfg.getSettings();
+        displaySettings();
+        return true;
+    }
+    else if (PlutoSDRMIMO::MsgStartStop::match(message))
+    {
+        qDebug("PlutoSDRMIMOGui::handleMessage: MsgStartStop");
+        PlutoSDRMIMO::MsgStartStop& notif = (PlutoSDRMIMO::MsgStartStop&) message;
+        blockApplySettings(true);
+        ui->startStop->setChecked(notif.getStartStop());
+        blockApplySettings(false);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void PlutoSDRMIMOGui::updateFrequencyLimits()
+{
+    // values in kHz
+    quint64 minF = 0, maxF = 0;
+    qint64 deltaFrequency = m_settings.m_rxTransverterMode ? m_settings.m_rxTransverterDeltaFrequency/1000 : 0;
+    m_sampleMIMO->getRxFrequencyRange(minF, maxF);
+    qint64 minLimit = (qint64) (minF/1000) + deltaFrequency;
+    qint64 maxLimit = (qint64) (maxF/1000) + deltaFrequency;
+
+    minLimit = minLimit < 0 ? 0 : minLimit > 9999999 ? 9999999 : minLimit;
+    maxLimit = maxLimit < 0 ? 0 : maxLimit > 9999999 ? 9999999 : maxLimit;
+
+    qDebug("PlutoSDRMIMOGui::updateFrequencyLimits: delta: %lld min: %lld max: %lld", deltaFrequency, minLimit, maxLimit);
+
+    ui->centerFrequency->setValueRange(7, minLimit, maxLimit);
+}
+
+void PlutoSDRMIMOGui::updateSampleRateLimits()
+{
+    // the FIR decimation lowers the minimum host interface sample rate
+    uint32_t low = m_settings.m_lpfFIREnable ?
+        DevicePlutoSDR::srLowLimitFreq / (1<<m_settings.m_lpfFIRlog2Decim) : DevicePlutoSDR::srLowLimitFreq;
+    ui->sampleRate->setValueRange(8, low, DevicePlutoSDR::srHighLimitFreq);
+}
+
+void PlutoSDRMIMOGui::handleInputMessages()
+{
+    Message* message;
+
+    while ((message = m_inputMessageQueue.pop()) != 0)
+    {
+        if (DSPMIMOSignalNotification::match(*message))
+        {
+            DSPMIMOSignalNotification* notif = (DSPMIMOSignalNotification*) message;
+
+            // both channels share the same rate and frequency
+            if (notif->getSourceOrSink() && (notif->getIndex() == 0))
+            {
+                m_deviceSampleRate = notif->getSampleRate();
+                m_deviceCenterFrequency = notif->getCenterFrequency();
+                qDebug("PlutoSDRMIMOGui::handleInputMessages: DSPMIMOSignalNotification: SampleRate:%d, CenterFrequency:%llu",
+                        notif->getSampleRate(),
+                        notif->getCenterFrequency());
+                updateSampleRateAndFrequency();
+            }
+
+            delete message;
+        }
+        else
+        {
+            if (handleMessage(*message)) {
+                delete message;
+            }
+        }
+    }
+}
+
+void PlutoSDRMIMOGui::updateSampleRateAndFrequency()
+{
+    m_deviceUISet->getSpectrum()->setSampleRate(m_deviceSampleRate);
+    m_deviceUISet->getSpectrum()->setCenterFrequency(m_deviceCenterFrequency);
+    ui->deviceRateText->setText(tr("%1k").arg((float)m_deviceSampleRate / 1000));
+}
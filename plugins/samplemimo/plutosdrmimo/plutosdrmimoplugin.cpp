@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QtPlugin>
+
+#include "plugin/pluginapi.h"
+#include "util/simpleserializer.h"
+#include "plutosdr/deviceplutosdr.h"
+
+#ifdef SERVER_MODE
+#include "plutosdrmimo.h"
+#else
+#include "plutosdrmimogui.h"
+#endif
+#include "plutosdrmimoplugin.h"
+#include "plutosdrmimowebapiadapter.h"
+
+const PluginDescriptor PlutoSDRMIMOPlugin::m_pluginDescriptor = {
+    QString("PlutoSDRMIMO"),
+	QString("PlutoSDR MIMO"),
+	QString("4.15.0"),
+	QString("(c) Edouard Griffiths, F4EXB"),
+	QString("https://github.com/f4exb/sdrangel"),
+	true,
+	QString("https://github.com/f4exb/sdrangel")
+};
+
+const QString PlutoSDRMIMOPlugin::m_hardwareID = "PlutoSDR";
+const QString PlutoSDRMIMOPlugin::m_deviceTypeID = PLUTOSDRMIMO_DEVICE_TYPE_ID;
+
+PlutoSDRMIMOPlugin::PlutoSDRMIMOPlugin(QObject* parent) :
+	QObject(parent)
+{
+}
+
+const PluginDescriptor& PlutoSDRMIMOPlugin::getPluginDescriptor() const
+{
+	return m_pluginDescriptor;
+}
+
+void PlutoSDRMIMOPlugin::initPlugin(PluginAPI* pluginAPI)
+{
+	pluginAPI->registerSampleMIMO(m_deviceTypeID, this);
+}
+
+void PlutoSDRMIMOPlugin::enumOriginDevices(QStringList& listedHwIds, OriginDevices& originDevices)
+{
+    if (listedHwIds.contains(m_hardwareID)) { // check if it was done
+        return;
+    }
+
+    DevicePlutoSDR::instance().enumOriginDevices(m_hardwareID, originDevices);
+    listedHwIds.append(m_hardwareID);
+}
+
+PluginInterface::SamplingDevices PlutoSDRMIMOPlugin::enumSampleMIMO(const OriginDevices& originDevices)
+{
+	SamplingDevices result;
+
+	for (OriginDevices::const_iterator it = originDevices.begin(); it != originDevices.end(); ++it)
+    {
+        // the scan cannot tell if the device is in 2R2T mode so this is checked when the device is opened
+        if (it->hardwareId == m_hardwareID)
+        {
+            QString displayedName = it->displayableName;
+            displayedName.replace(QString("]"), QString(":MI]"));
+            result.append(SamplingDevice(
+                displayedName,
+                m_hardwareID,
+                m_deviceTypeID,
+                it->serial,
+                it->sequence,
+                PluginInterface::SamplingDevice::PhysicalDevice,
+                PluginInterface::SamplingDevice::StreamMIMO,
+                PlutoSDRMIMO::m_nbRxStreams, // nb Rx
+                0  // nb Tx
+            ));
+        }
+    }
+
+	return result;
+}
+
+#ifdef SERVER_MODE
+PluginInstanceGUI* PlutoSDRMIMOPlugin::createSampleMIMOPluginInstanceGUI(
+        const QString& mimoId,
+        QWidget **widget,
+        DeviceUISet *deviceUISet)
+{
+    (void) mimoId;
+    (void) widget;
+    (void) deviceUISet;
+    return nullptr;
+}
+#else
+PluginInstanceGUI* PlutoSDRMIMOPlugin::createSampleMIMOPluginInstanceGUI(
+        const QString& mimoId,
+        QWidget **widget,
+        DeviceUISet *deviceUISet)
+{
+	if (mimoId == m_deviceTypeID)
+    {
+		PlutoSDRMIMOGui* gui = new PlutoSDRMIMOGui(deviceUISet);
+		*widget = gui;
+		return gui;
+	}
+    else
+    {
+		return nullptr;
+	}
+}
+#endif
+
+DeviceSampleMIMO *PlutoSDRMIMOPlugin::createSampleMIMOPluginInstance(const QString& mimoId, DeviceAPI *deviceAPI)
+{
+    if (mimoId == m_deviceTypeID)
+    {
+        PlutoSDRMIMO* input = new PlutoSDRMIMO(deviceAPI);
+        return input;
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+DeviceWebAPIAdapter *PlutoSDRMIMOPlugin::createDeviceWebAPIAdapter() const
+{
+    return new PlutoSDRMIMOWebAPIAdapter();
+}
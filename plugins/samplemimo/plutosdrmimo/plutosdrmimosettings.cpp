@@ -0,0 +1,203 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+#include "plutosdrmimosettings.h"
+
+#include "util/simpleserializer.h"
+
+PlutoSDRMIMOSettings::PlutoSDRMIMOSettings()
+{
+    resetToDefaults();
+}
+
+void PlutoSDRMIMOSettings::resetToDefaults()
+{
+    m_devSampleRate = 2500 * 1000;
+    m_LOppmTenths = 0;
+    m_lpfFIREnable = false;
+    m_lpfFIRBW = 500000U;
+    m_lpfFIRlog2Decim = 0;
+    m_lpfFIRGain = 0;
+    m_rxCenterFrequency = 435000 * 1000;
+    m_log2SoftDecim = 0;
+    m_fcPosRx = FC_POS_CENTER;
+    m_dcBlock = false;
+    m_iqCorrection = false;
+    m_hwBBDCBlock = true;
+    m_hwRFDCBlock = true;
+    m_hwIQCorrection = true;
+    m_lpfBW = 1500000U;
+    m_antennaPath = RFPATH_A_BAL;
+    m_gainMode = GAIN_MANUAL;
+    m_rx0Gain = 40;
+    m_rx1Gain = 40;
+    m_rxTransverterMode = false;
+    m_rxTransverterDeltaFrequency = 0;
+    m_iqOrder = true;
+    m_spectrumStreamIndex = 0;
+}
+
+QByteArray PlutoSDRMIMOSettings::serialize() const
+{
+    SimpleSerializer s(1);
+
+    s.writeU64(1, m_devSampleRate);
+    s.writeS32(2, m_LOppmTenths);
+    s.writeBool(3, m_lpfFIREnable);
+    s.writeU32(4, m_lpfFIRBW);
+    s.writeU32(5, m_lpfFIRlog2Decim);
+    s.writeS32(6, m_lpfFIRGain);
+    s.writeU64(7, m_rxCenterFrequency);
+    s.writeU32(8, m_log2SoftDecim);
+    s.writeS32(9, (int) m_fcPosRx);
+    s.writeBool(10, m_dcBlock);
+    s.writeBool(11, m_iqCorrection);
+    s.writeBool(12, m_hwBBDCBlock);
+    s.writeBool(13, m_hwRFDCBlock);
+    s.writeBool(14, m_hwIQCorrection);
+    s.writeU32(15, m_lpfBW);
+    s.writeS32(16, (int) m_antennaPath);
+    s.writeS32(17, (int) m_gainMode);
+    s.writeU32(18, m_rx0Gain);
+    s.writeU32(19, m_rx1Gain);
+    s.writeBool(20, m_rxTransverterMode);
+    s.writeS64(21, m_rxTransverterDeltaFrequency);
+    s.writeBool(22, m_iqOrder);
+    s.writeU32(23, m_spectrumStreamIndex);
+
+    return s.final();
+}
+
+bool PlutoSDRMIMOSettings::deserialize(const QByteArray& data)
+{
+    SimpleDeserializer d(data);
+
+    if (!d.isValid())
+    {
+        resetToDefaults();
+        return false;
+    }
+
+    if (d.getVersion() == 1)
+    {
+        int intval;
+        uint32_t uintval;
+
+        d.readU64(1, &m_devSampleRate, 2500 * 1000);
+        d.readS32(2, &m_LOppmTenths, 0);
+        d.readBool(3, &m_lpfFIREnable, false);
+        d.readU32(4, &m_lpfFIRBW, 500000U);
+        d.readU32(5, &uintval, 0);
+        m_lpfFIRlog2Decim = uintval > 2 ? 2 : uintval;
+        d.readS32(6, &m_lpfFIRGain, 0);
+        d.readU64(7, &m_rxCenterFrequency, 435000 * 1000);
+        d.readU32(8, &m_log2SoftDecim, 0);
+        d.readS32(9, &intval, (int) FC_POS_CENTER);
+        m_fcPosRx = intval < 0 ? FC_POS_INFRA : intval > 2 ? FC_POS_CENTER : (fcPos_t) intval;
+        d.readBool(10, &m_dcBlock, false);
+        d.readBool(11, &m_iqCorrection, false);
+        d.readBool(12, &m_hwBBDCBlock, true);
+        d.readBool(13, &m_hwRFDCBlock, true);
+        d.readBool(14, &m_hwIQCorrection, true);
+        d.readU32(15, &m_lpfBW, 1500000U);
+        d.readS32(16, &intval, 0);
+        m_antennaPath = (intval >= 0) && (intval < (int) RFPATH_END) ? (RFPath) intval : RFPATH_A_BAL;
+        d.readS32(17, &intval, 0);
+        m_gainMode = (intval >= 0) && (intval < (int) GAIN_END) ? (GainMode) intval : GAIN_MANUAL;
+        d.readU32(18, &m_rx0Gain, 40);
+        d.readU32(19, &m_rx1Gain, 40);
+        d.readBool(20, &m_rxTransverterMode, false);
+        d.readS64(21, &m_rxTransverterDeltaFrequency, 0);
+        d.readBool(22, &m_iqOrder, true);
+        d.readU32(23, &uintval, 0);
+        m_spectrumStreamIndex = uintval > 1 ? 1 : uintval;
+
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
+
+void PlutoSDRMIMOSettings::translateRFPath(RFPath path, QString& s)
+{
+    switch(path)
+    {
+    case RFPATH_A_BAL:
+        s = "A_BALANCED";
+        break;
+    case RFPATH_B_BAL:
+        s = "B_BALANCED";
+        break;
+    case RFPATH_C_BAL:
+        s = "C_BALANCED";
+        break;
+    case RFPATH_A_NEG:
+        s = "A_N";
+        break;
+    case RFPATH_A_POS:
+        s = "A_P";
+        break;
+    case RFPATH_B_NEG:
+        s = "B_N";
+        break;
+    case RFPATH_B_POS:
+        s = "B_P";
+        break;
+    case RFPATH_C_NEG:
+        s = "C_N";
+        break;
+    case RFPATH_C_POS:
+        s = "C_P";
+        break;
+    case RFPATH_TX1MON:
+        s = "TX_MONITOR1";
+        break;
+    case RFPATH_TX2MON:
+        s = "TX_MONITOR2";
+        break;
+    case RFPATH_TX3MON:
+        s = "TX_MONITOR3";
+        break;
+    default:
+        s = "A_BALANCED";
+        break;
+    }
+}
+
+void PlutoSDRMIMOSettings::translateGainMode(GainMode mode, QString& s)
+{
+    switch(mode)
+    {
+    case GAIN_MANUAL:
+        s = "manual";
+        break;
+    case GAIN_AGC_SLOW:
+        s = "slow_attack";
+        break;
+    case GAIN_AGC_FAST:
+        s = "fast_attack";
+        break;
+    case GAIN_HYBRID:
+        s = "hybrid";
+        break;
+    default:
+        s = "manual";
+        break;
+    }
+}
@@ -0,0 +1,94 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+#ifndef PLUGINS_SAMPLEMIMO_PLUTOSDRMIMO_PLUTOSDRMIMOSETTINGS_H_
+#define PLUGINS_SAMPLEMIMO_PLUTOSDRMIMO_PLUTOSDRMIMOSETTINGS_H_
+
+#include <QtGlobal>
+#include <QString>
+
+/**
+ * Receive side of the PlutoSDR in 2R2T mode as a MIMO: both Rx channels share the local oscillator,
+ * the sample rate chain, the antenna port and the bandwidth. Only the gain is set per channel.
+ */
+struct PlutoSDRMIMOSettings {
+    typedef enum {
+        FC_POS_INFRA = 0,
+        FC_POS_SUPRA,
+        FC_POS_CENTER
+    } fcPos_t;
+
+    enum RFPath
+    {
+        RFPATH_A_BAL = 0,
+        RFPATH_B_BAL,
+        RFPATH_C_BAL,
+        RFPATH_A_NEG,
+        RFPATH_A_POS,
+        RFPATH_B_NEG,
+        RFPATH_B_POS,
+        RFPATH_C_NEG,
+        RFPATH_C_POS,
+        RFPATH_TX1MON,
+        RFPATH_TX2MON,
+        RFPATH_TX3MON,
+        RFPATH_END
+    };
+
+    typedef enum {
+        GAIN_MANUAL,
+        GAIN_AGC_SLOW,
+        GAIN_AGC_FAST,
+        GAIN_HYBRID,
+        GAIN_END
+    } GainMode;
+
+    // common device settings
+    quint64 m_devSampleRate;      //!< Host interface sample rate
+    qint32  m_LOppmTenths;        //!< XO correction
+    bool    m_lpfFIREnable;       //!< enable digital lowpass FIR filter
+    quint32 m_lpfFIRBW;           //!< digital lowpass FIR filter bandwidth (Hz)
+    quint32 m_lpfFIRlog2Decim;    //!< digital lowpass FIR filter log2 of decimation factor (0..2)
+    int     m_lpfFIRGain;         //!< digital lowpass FIR filter gain (dB)
+    // Rx settings common to both channels
+    quint64 m_rxCenterFrequency;
+    quint32 m_log2SoftDecim;
+    fcPos_t m_fcPosRx;
+    bool    m_dcBlock;
+    bool    m_iqCorrection;
+    bool    m_hwBBDCBlock;        //!< Hardware baseband DC blocking
+    bool    m_hwRFDCBlock;        //!< Hardware RF DC blocking
+    bool    m_hwIQCorrection;     //!< Hardware IQ correction
+    quint32 m_lpfBW;              //!< analog lowpass filter bandwidth (Hz)
+    RFPath  m_antennaPath;
+    GainMode m_gainMode;
+    // Rx settings per channel
+    quint32 m_rx0Gain;            //!< Rx0 "hardware" gain
+    quint32 m_rx1Gain;            //!< Rx1 "hardware" gain
+    bool    m_rxTransverterMode;
+    qint64  m_rxTransverterDeltaFrequency;
+    bool    m_iqOrder;
+    unsigned int m_spectrumStreamIndex; //!< stream displayed in the main spectrum
+
+    PlutoSDRMIMOSettings();
+    void resetToDefaults();
+    QByteArray serialize() const;
+    bool deserialize(const QByteArray& data);
+    static void translateRFPath(RFPath path, QString& s);
+    static void translateGainMode(GainMode mode, QString& s);
+};
+
+#endif /* PLUGINS_SAMPLEMIMO_PLUTOSDRMIMO_PLUTOSDRMIMOSETTINGS_H_ */
@@ -0,0 +1,232 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+#include <unistd.h>
+
+#include "plutosdr/deviceplutosdrbox.h"
+#include "dsp/samplemififo.h"
+
+#include "plutosdrmithread.h"
+
+PlutoSDRMIThread::PlutoSDRMIThread(uint32_t blockSizeSamples, DevicePlutoSDRBox* plutoBox, QObject* parent) :
+    QThread(parent),
+    m_running(false),
+    m_plutoBox(plutoBox),
+    m_blockSizeSamples(blockSizeSamples),
+    m_sampleFifo(nullptr),
+    m_log2Decim(0),
+    m_fcPos(0),
+    m_iqOrder(true)
+{
+    qDebug("PlutoSDRMIThread::PlutoSDRMIThread");
+
+    for (unsigned int i = 0; i < m_nbChannels; i++)
+    {
+        m_convertBuffer[i].resize(m_blockSizeSamples, Sample{0,0});
+        m_buf[i] = new qint16[2*m_blockSizeSamples];
+    }
+}
+
+PlutoSDRMIThread::~PlutoSDRMIThread()
+{
+    qDebug("PlutoSDRMIThread::~PlutoSDRMIThread");
+
+    if (m_running) {
+        stopWork();
+    }
+
+    for (unsigned int i = 0; i < m_nbChannels; i++) {
+        delete[] m_buf[i];
+    }
+}
+
+void PlutoSDRMIThread::startWork()
+{
+    m_startWaitMutex.lock();
+    start();
+
+    while(!m_running) {
+        m_startWaiter.wait(&m_startWaitMutex, 100);
+    }
+
+    m_startWaitMutex.unlock();
+}
+
+void PlutoSDRMIThread::stopWork()
+{
+    m_running = false;
+    wait();
+}
+
+void PlutoSDRMIThread::run()
+{
+    std::ptrdiff_t p_inc = m_plutoBox->rxBufferStep();
+    // 2 bytes per I or Q and both channels in each step
+    ssize_t nbytesExpected = m_blockSizeSamples * 4 * m_nbChannels;
+
+    qDebug("PlutoSDRMIThread::run: rxBufferStep: %ld bytes", p_inc);
+
+    m_running = true;
+    m_startWaiter.wakeAll();
+
+    if (!m_sampleFifo)
+    {
+        qWarning("PlutoSDRMIThread::run: no FIFO allocated. Aborting");
+        m_running = false;
+        return;
+    }
+
+    while (m_running)
+    {
+        ssize_t nbytes_rx = m_plutoBox->rxBufferRefill();
+
+        if (nbytes_rx != nbytesExpected)
+        {
+            qWarning("PlutoSDRMIThread::run: error refilling buf %d / %d", (int) nbytes_rx, (int) nbytesExpected);
+            usleep(200000);
+            continue;
+        }
+
+        char *p_end = m_plutoBox->rxBufferEnd();
+        int ihs = 0; // half sample index (I then Q to make a sample)
+
+        // each step holds I0 Q0 I1 Q1 as little endian 16 bit integers
+        for (char *p_dat = m_plutoBox->rxBufferFirst(); p_dat < p_end; p_dat += p_inc)
+        {
+            m_buf[0][ihs]   = *((int16_t *) p_dat);
+            m_buf[0][ihs+1] = *(((int16_t *) p_dat) + 1);
+            m_buf[1][ihs]   = *(((int16_t *) p_dat) + 2);
+            m_buf[1][ihs+1] = *(((int16_t *) p_dat) + 3);
+            ihs += 2;
+        }
+
+        callback(ihs/2);
+    }
+
+    m_running = false;
+}
+
+void PlutoSDRMIThread::callback(qint32 samplesPerChannel)
+{
+    std::vector<SampleVector::const_iterator> vbegin;
+    int nbDecimatedSamples = 0;
+
+    for (unsigned int channel = 0; channel < m_nbChannels; channel++)
+    {
+        SampleVector::iterator it = m_convertBuffer[channel].begin();
+
+        if (m_iqOrder) {
+            decimate(m_decimatorsIQ[channel], &it, m_buf[channel], 2*samplesPerChannel);
+        } else {
+            decimate(m_decimatorsQI[channel], &it, m_buf[channel], 2*samplesPerChannel);
+        }
+
+        vbegin.push_back(m_convertBuffer[channel].begin());
+        nbDecimatedSamples = it - m_convertBuffer[channel].begin(); // same for all channels
+    }
+
+    m_sampleFifo->writeSync(vbegin, nbDecimatedSamples);
+}
+
+template<class DecimatorsType>
+void PlutoSDRMIThread::decimate(DecimatorsType& decimators, SampleVector::iterator* it, const qint16* buf, qint32 len)
+{
+    if (m_log2Decim == 0)
+    {
+        decimators.decimate1(it, buf, len);
+    }
+    else
+    {
+        if (m_fcPos == 0) // Infra
+        {
+            switch (m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_inf(it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_inf(it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_inf(it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_inf(it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_inf(it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_inf(it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_fcPos == 1) // Supra
+        {
+            switch (m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_sup(it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_sup(it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_sup(it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_sup(it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_sup(it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_sup(it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_fcPos == 2) // Center
+        {
+            switch (m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_cen(it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_cen(it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_cen(it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_cen(it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_cen(it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_cen(it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,408 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+
+#include "SWGDeviceSettings.h"
+#include "SWGDeviceState.h"
+#include "SWGTestMISettings.h"
+#include "SWGTestMIStreamSettings.h"
+
+#include "device/deviceapi.h"
+#include "dsp/dspcommands.h"
+
+#include "testmiworker.h"
+#include "testmi.h"
+
+MESSAGE_CLASS_DEFINITION(TestMI::MsgConfigureTestMI, Message)
+MESSAGE_CLASS_DEFINITION(TestMI::MsgStartStop, Message)
+
+TestMI::TestMI(DeviceAPI *deviceAPI) :
+    m_deviceAPI(deviceAPI),
+	m_settings(),
+	m_worker(nullptr),
+	m_deviceDescription("TestMI"),
+	m_running(false)
+{
+    m_mimoType = MIMOHalfSynchronous;
+    m_sampleMIFifo.init(TestMISettings::m_nbStreams, 96000 * 4);
+    m_deviceAPI->setNbSourceStreams(TestMISettings::m_nbStreams);
+    m_deviceAPI->setNbSinkStreams(0);
+}
+
+TestMI::~TestMI()
+{
+    if (m_running) {
+        stopRx();
+    }
+}
+
+void TestMI::destroy()
+{
+    delete this;
+}
+
+void TestMI::init()
+{
+    applySettings(m_settings, true);
+}
+
+bool TestMI::startRx()
+{
+    qDebug("TestMI::startRx");
+	QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_running) {
+        return true;
+    }
+
+    m_sampleMIFifo.reset();
+    m_worker = new TestMIWorker(&m_sampleMIFifo);
+    m_worker->moveToThread(&m_workerThread);
+    m_worker->setSettings(m_settings);
+    m_worker->startWork();
+    m_workerThread.start();
+	m_running = true;
+
+	return true;
+}
+
+void TestMI::stopRx()
+{
+    qDebug("TestMI::stopRx");
+	QMutexLocker mutexLocker(&m_mutex);
+
+	if (m_worker)
+	{
+        m_worker->stopWork();
+        m_workerThread.quit();
+        m_workerThread.wait();
+        m_worker->deleteLater();
+		m_worker = nullptr;
+	}
+
+	m_running = false;
+}
+
+QByteArray TestMI::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool TestMI::deserialize(const QByteArray& data)
+{
+    bool success = true;
+
+    if (!m_settings.deserialize(data))
+    {
+        m_settings.resetToDefaults();
+        success = false;
+    }
+
+    MsgConfigureTestMI* message = MsgConfigureTestMI::create(m_settings, true);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue)
+    {
+        MsgConfigureTestMI* messageToGUI = MsgConfigureTestMI::create(m_settings, true);
+        m_guiMessageQueue->push(messageToGUI);
+    }
+
+    return success;
+}
+
+const QString& TestMI::getDeviceDescription() const
+{
+	return m_deviceDescription;
+}
+
+int TestMI::getSourceSampleRate(int index) const
+{
+    (void) index; // all streams share the same sample rate
+	return m_settings.m_sampleRate;
+}
+
+quint64 TestMI::getSourceCenterFrequency(int index) const
+{
+    (void) index; // all streams share the same local oscillator
+	return m_settings.m_centerFrequency;
+}
+
+void TestMI::setSourceCenterFrequency(qint64 centerFrequency, int index)
+{
+    (void) index;
+    TestMISettings settings = m_settings;
+    settings.m_centerFrequency = centerFrequency;
+
+    MsgConfigureTestMI* message = MsgConfigureTestMI::create(settings, false);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue)
+    {
+        MsgConfigureTestMI* messageToGUI = MsgConfigureTestMI::create(settings, false);
+        m_guiMessageQueue->push(messageToGUI);
+    }
+}
+
+bool TestMI::handleMessage(const Message& message)
+{
+    if (MsgConfigureTestMI::match(message))
+    {
+        MsgConfigureTestMI& conf = (MsgConfigureTestMI&) message;
+        qDebug() << "TestMI::handleMessage: MsgConfigureTestMI";
+
+        bool success = applySettings(conf.getSettings(), conf.getForce());
+
+        if (!success) {
+            qDebug("TestMI::handleMessage: config error");
+        }
+
+        return true;
+    }
+    else if (MsgStartStop::match(message))
+    {
+        MsgStartStop& cmd = (MsgStartStop&) message;
+        qDebug() << "TestMI::handleMessage: MsgStartStop: " << (cmd.getStartStop() ? "start" : "stop");
+
+        if (cmd.getStartStop())
+        {
+            if (m_deviceAPI->initDeviceEngine(0)) {
+                m_deviceAPI->startDeviceEngine(0);
+            }
+        }
+        else
+        {
+            m_deviceAPI->stopDeviceEngine(0);
+        }
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+bool TestMI::applySettings(const TestMISettings& settings, bool force)
+{
+    qDebug() << "TestMI::applySettings:"
+        << " m_centerFrequency: " << settings.m_centerFrequency
+        << " m_sampleRate: " << settings.m_sampleRate
+        << " m_frequencyShift: " << settings.m_frequencyShift
+        << " m_modulation: " << settings.m_modulation
+        << " m_signalLevel: " << settings.m_signalLevel
+        << " m_noiseLevel: " << settings.m_noiseLevel
+        << " m_arrivalAngle: " << settings.m_arrivalAngle
+        << " m_elementSpacing: " << settings.m_elementSpacing
+        << " m_spectrumStreamIndex: " << settings.m_spectrumStreamIndex
+        << " force: " << force;
+
+    if (m_worker) {
+        m_worker->setSettings(settings);
+    }
+
+    if ((m_settings.m_sampleRate != settings.m_sampleRate)
+        || (m_settings.m_centerFrequency != settings.m_centerFrequency) || force)
+    {
+        for (unsigned int i = 0; i < TestMISettings::m_nbStreams; i++)
+        {
+            DSPMIMOSignalNotification *notif = new DSPMIMOSignalNotification(
+                settings.m_sampleRate, settings.m_centerFrequency, true, i);
+            m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+        }
+    }
+
+    if ((m_settings.m_spectrumStreamIndex != settings.m_spectrumStreamIndex) || force) {
+        m_deviceAPI->setSpectrumSinkInput(true, settings.m_spectrumStreamIndex);
+    }
+
+    m_settings = settings;
+    return true;
+}
+
+int TestMI::webapiRunGet(
+        int subsystemIndex,
+        SWGSDRangel::SWGDeviceState& response,
+        QString& errorMessage)
+{
+    if (subsystemIndex != 0)
+    {
+        errorMessage = QString("Subsystem index invalid: expect 0 (Rx) only");
+        return 404;
+    }
+
+    m_deviceAPI->getDeviceEngineStateStr(*response.getState(), subsystemIndex);
+    return 200;
+}
+
+int TestMI::webapiRun(
+        bool run,
+        int subsystemIndex,
+        SWGSDRangel::SWGDeviceState& response,
+        QString& errorMessage)
+{
+    if (subsystemIndex != 0)
+    {
+        errorMessage = QString("Subsystem index invalid: expect 0 (Rx) only");
+        return 404;
+    }
+
+    m_deviceAPI->getDeviceEngineStateStr(*response.getState(), subsystemIndex);
+    MsgStartStop *message = MsgStartStop::create(run);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgStartStop *msgToGUI = MsgStartStop::create(run);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    return 200;
+}
+
+int TestMI::webapiSettingsGet(
+                SWGSDRangel::SWGDeviceSettings& response,
+                QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setTestMiSettings(new SWGSDRangel::SWGTestMISettings());
+    response.getTestMiSettings()->init();
+    webapiFormatDeviceSettings(response, m_settings);
+    return 200;
+}
+
+int TestMI::webapiSettingsPutPatch(
+                bool force,
+                const QStringList& deviceSettingsKeys,
+                SWGSDRangel::SWGDeviceSettings& response, // query + response
+                QString& errorMessage)
+{
+    (void) errorMessage;
+    TestMISettings settings = m_settings;
+    webapiUpdateDeviceSettings(settings, deviceSettingsKeys, response);
+
+    MsgConfigureTestMI *msg = MsgConfigureTestMI::create(settings, force);
+    m_inputMessageQueue.push(msg);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgConfigureTestMI *msgToGUI = MsgConfigureTestMI::create(settings, force);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    webapiFormatDeviceSettings(response, settings);
+    return 200;
+}
+
+void TestMI::webapiUpdateDeviceSettings(
+    TestMISettings& settings,
+    const QStringList& deviceSettingsKeys,
+    SWGSDRangel::SWGDeviceSettings& response)
+{
+    SWGSDRangel::SWGTestMISettings *swgSettings = response.getTestMiSettings();
+
+    if (deviceSettingsKeys.contains("centerFrequency")) {
+        settings.m_centerFrequency = swgSettings->getCenterFrequency();
+    }
+    if (deviceSettingsKeys.contains("sampleRate")) {
+        settings.m_sampleRate = swgSettings->getSampleRate();
+    }
+    if (deviceSettingsKeys.contains("frequencyShift")) {
+        settings.m_frequencyShift = swgSettings->getFrequencyShift();
+    }
+    if (deviceSettingsKeys.contains("modulation")) {
+        int modulation = swgSettings->getModulation();
+        modulation = modulation < 0 ? 0 : modulation >= TestMISettings::ModulationLast ? TestMISettings::ModulationLast-1 : modulation;
+        settings.m_modulation = (TestMISettings::Modulation) modulation;
+    }
+    if (deviceSettingsKeys.contains("modulationTone")) {
+        settings.m_modulationTone = swgSettings->getModulationTone();
+    }
+    if (deviceSettingsKeys.contains("amModulation")) {
+        settings.m_amModulation = swgSettings->getAmModulation();
+    }
+    if (deviceSettingsKeys.contains("fmDeviation")) {
+        settings.m_fmDeviation = swgSettings->getFmDeviation();
+    }
+    if (deviceSettingsKeys.contains("signalLevel")) {
+        settings.m_signalLevel = swgSettings->getSignalLevel();
+    }
+    if (deviceSettingsKeys.contains("noiseLevel")) {
+        settings.m_noiseLevel = swgSettings->getNoiseLevel();
+    }
+    if (deviceSettingsKeys.contains("arrivalAngle")) {
+        settings.m_arrivalAngle = swgSettings->getArrivalAngle();
+    }
+    if (deviceSettingsKeys.contains("elementSpacing")) {
+        settings.m_elementSpacing = swgSettings->getElementSpacing();
+    }
+    if (deviceSettingsKeys.contains("spectrumStreamIndex")) {
+        unsigned int index = swgSettings->getSpectrumStreamIndex();
+        settings.m_spectrumStreamIndex = index < TestMISettings::m_nbStreams ? index : TestMISettings::m_nbStreams - 1;
+    }
+    if (deviceSettingsKeys.contains("streams") && swgSettings->getStreams())
+    {
+        // streams are identified by their index so that only some of them can be given
+        for (auto swgStream : *swgSettings->getStreams())
+        {
+            unsigned int index = swgStream->getStreamIndex();
+
+            if (index >= TestMISettings::m_nbStreams) {
+                continue;
+            }
+
+            settings.m_streams[index].m_gain = swgStream->getGain();
+            settings.m_streams[index].m_phase = swgStream->getPhase();
+            int delay = swgStream->getDelay();
+            settings.m_streams[index].m_delay = delay < 0 ? 0 : delay > TestMISettings::m_maxDelay ? TestMISettings::m_maxDelay : delay;
+        }
+    }
+}
+
+void TestMI::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const TestMISettings& settings)
+{
+    SWGSDRangel::SWGTestMISettings *swgSettings = response.getTestMiSettings();
+    swgSettings->setCenterFrequency(settings.m_centerFrequency);
+    swgSettings->setSampleRate(settings.m_sampleRate);
+    swgSettings->setFrequencyShift(settings.m_frequencyShift);
+    swgSettings->setModulation((int) settings.m_modulation);
+    swgSettings->setModulationTone(settings.m_modulationTone);
+    swgSettings->setAmModulation(settings.m_amModulation);
+    swgSettings->setFmDeviation(settings.m_fmDeviation);
+    swgSettings->setSignalLevel(settings.m_signalLevel);
+    swgSettings->setNoiseLevel(settings.m_noiseLevel);
+    swgSettings->setArrivalAngle(settings.m_arrivalAngle);
+    swgSettings->setElementSpacing(settings.m_elementSpacing);
+    swgSettings->setSpectrumStreamIndex(settings.m_spectrumStreamIndex);
+
+    if (swgSettings->getStreams()) {
+        qDeleteAll(*swgSettings->getStreams());
+        swgSettings->getStreams()->clear();
+    } else {
+        swgSettings->setStreams(new QList<SWGSDRangel::SWGTestMIStreamSettings*>());
+    }
+
+    for (unsigned int i = 0; i < TestMISettings::m_nbStreams; i++)
+    {
+        SWGSDRangel::SWGTestMIStreamSettings *swgStream = new SWGSDRangel::SWGTestMIStreamSettings();
+        swgStream->setStreamIndex(i);
+        swgStream->setGain(settings.m_streams[i].m_gain);
+        swgStream->setPhase(settings.m_streams[i].m_phase);
+        swgStream->setDelay(settings.m_streams[i].m_delay);
+        swgSettings->getStreams()->append(swgStream);
+    }
+}
@@ -0,0 +1,414 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <math.h>
+
+#include <QDebug>
+#include <QMessageBox>
+
+#include "ui_testmigui.h"
+#include "gui/colormapper.h"
+#include "gui/glspectrum.h"
+#include "dsp/dspcommands.h"
+#include "device/deviceapi.h"
+#include "device/deviceuiset.h"
+
+#include "testmigui.h"
+
+TestMIGui::TestMIGui(DeviceUISet *deviceUISet, QWidget* parent) :
+    QWidget(parent),
+    ui(new Ui::TestMIGui),
+    m_deviceUISet(deviceUISet),
+    m_settings(),
+    m_streamIndex(0),
+    m_doApplySettings(true),
+    m_forceSettings(true),
+    m_sampleMIMO(nullptr),
+    m_deviceSampleRate(48000),
+    m_deviceCenterFrequency(0),
+    m_lastEngineState(DeviceAPI::StNotStarted)
+{
+    qDebug("TestMIGui::TestMIGui");
+    m_sampleMIMO = m_deviceUISet->m_deviceAPI->getSampleMIMO();
+
+    ui->setupUi(this);
+    ui->centerFrequency->setColorMapper(ColorMapper(ColorMapper::GrayGold));
+    ui->centerFrequency->setValueRange(7, 0, 9999999);
+    ui->sampleRate->setColorMapper(ColorMapper(ColorMapper::GrayGreenYellow));
+    ui->sampleRate->setValueRange(8, 48000, 99999999);
+    ui->frequencyShift->setColorMapper(ColorMapper(ColorMapper::GrayGold));
+    ui->frequencyShift->setValueRange(false, 8, -99999999, 99999999);
+    ui->frequencyShiftLabel->setText(QString("%1").arg(QChar(0x94, 0x03)));
+    ui->delay->setMaximum(TestMISettings::m_maxDelay);
+
+    displaySettings();
+
+    connect(&m_updateTimer, SIGNAL(timeout()), this, SLOT(updateHardware()));
+    connect(&m_statusTimer, SIGNAL(timeout()), this, SLOT(updateStatus()));
+    m_statusTimer.start(500);
+
+    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()), Qt::QueuedConnection);
+    m_sampleMIMO->setMessageQueueToGUI(&m_inputMessageQueue);
+}
+
+TestMIGui::~TestMIGui()
+{
+    delete ui;
+}
+
+void TestMIGui::destroy()
+{
+    delete this;
+}
+
+void TestMIGui::setName(const QString& name)
+{
+    setObjectName(name);
+}
+
+QString TestMIGui::getName() const
+{
+    return objectName();
+}
+
+void TestMIGui::resetToDefaults()
+{
+    m_settings.resetToDefaults();
+    displaySettings();
+    sendSettings();
+}
+
+qint64 TestMIGui::getCenterFrequency() const
+{
+    return m_settings.m_centerFrequency;
+}
+
+void TestMIGui::setCenterFrequency(qint64 centerFrequency)
+{
+    m_settings.m_centerFrequency = centerFrequency;
+    displaySettings();
+    sendSettings();
+}
+
+QByteArray TestMIGui::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool TestMIGui::deserialize(const QByteArray& data)
+{
+    if (m_settings.deserialize(data))
+    {
+        displaySettings();
+        m_forceSettings = true;
+        sendSettings();
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
+
+void TestMIGui::on_startStop_toggled(bool checked)
+{
+    if (m_doApplySettings)
+    {
+        TestMI::MsgStartStop *message = TestMI::MsgStartStop::create(checked);
+        m_sampleMIMO->getInputMessageQueue()->push(message);
+    }
+}
+
+void TestMIGui::on_centerFrequency_changed(quint64 value)
+{
+    m_settings.m_centerFrequency = value * 1000;
+    sendSettings();
+}
+
+void TestMIGui::on_sampleRate_changed(quint64 value)
+{
+    updateFrequencyShiftLimit();
+    m_settings.m_frequencyShift = ui->frequencyShift->getValueNew();
+    m_settings.m_sampleRate = value;
+    sendSettings();
+}
+
+void TestMIGui::on_frequencyShift_changed(qint64 value)
+{
+    m_settings.m_frequencyShift = value;
+    sendSettings();
+}
+
+void TestMIGui::on_modulation_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index >= TestMISettings::ModulationLast)) {
+        return;
+    }
+
+    m_settings.m_modulation = (TestMISettings::Modulation) index;
+    sendSettings();
+}
+
+void TestMIGui::on_modulationFrequency_valueChanged(int value)
+{
+    m_settings.m_modulationTone = value;
+    ui->modulationFrequencyText->setText(QString("%1").arg(value));
+    sendSettings();
+}
+
+void TestMIGui::on_amModulation_valueChanged(int value)
+{
+    m_settings.m_amModulation = value;
+    ui->amModulationText->setText(QString("%1").arg(value));
+    sendSettings();
+}
+
+void TestMIGui::on_fmDeviation_valueChanged(int value)
+{
+    m_settings.m_fmDeviation = value * 100;
+    ui->fmDeviationText->setText(QString("%1").arg(value / 10.0, 0, 'f', 1));
+    sendSettings();
+}
+
+void TestMIGui::on_signalLevel_valueChanged(int value)
+{
+    m_settings.m_signalLevel = value;
+    ui->signalLevelText->setText(QString("%1").arg(value));
+    sendSettings();
+}
+
+void TestMIGui::on_noiseLevel_valueChanged(int value)
+{
+    m_settings.m_noiseLevel = value;
+    ui->noiseLevelText->setText(QString("%1").arg(value));
+    sendSettings();
+}
+
+void TestMIGui::on_arrivalAngle_valueChanged(int value)
+{
+    m_settings.m_arrivalAngle = value;
+    ui->arrivalAngleText->setText(QString("%1").arg(value));
+    sendSettings();
+}
+
+void TestMIGui::on_elementSpacing_valueChanged(int value)
+{
+    m_settings.m_elementSpacing = value / 100.0f;
+    ui->elementSpacingText->setText(QString("%1").arg(value / 100.0, 0, 'f', 2));
+    sendSettings();
+}
+
+void TestMIGui::on_spectrumSource_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index >= (int) TestMISettings::m_nbStreams)) {
+        return;
+    }
+
+    m_settings.m_spectrumStreamIndex = index;
+    sendSettings();
+}
+
+void TestMIGui::on_streamIndex_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index >= (int) TestMISettings::m_nbStreams)) {
+        return;
+    }
+
+    m_streamIndex = index;
+    displayStreamSettings();
+}
+
+void TestMIGui::on_gain_valueChanged(int value)
+{
+    m_settings.m_streams[m_streamIndex].m_gain = value / 10.0f;
+    ui->gainText->setText(QString("%1").arg(value / 10.0, 0, 'f', 1));
+    sendSettings();
+}
+
+void TestMIGui::on_phase_valueChanged(int value)
+{
+    m_settings.m_streams[m_streamIndex].m_phase = value;
+    ui->phaseText->setText(QString("%1").arg(value));
+    sendSettings();
+}
+
+void TestMIGui::on_delay_valueChanged(int value)
+{
+    m_settings.m_streams[m_streamIndex].m_delay = value;
+    sendSettings();
+}
+
+void TestMIGui::updateFrequencyShiftLimit()
+{
+    qint64 sampleRate = ui->sampleRate->getValueNew();
+    ui->frequencyShift->setValueRange(false, 7, -sampleRate/2, sampleRate/2);
+    ui->frequencyShift->setValue(m_settings.m_frequencyShift);
+}
+
+void TestMIGui::displaySettings()
+{
+    blockApplySettings(true);
+    ui->centerFrequency->setValue(m_settings.m_centerFrequency / 1000);
+    ui->sampleRate->setValue(m_settings.m_sampleRate);
+    updateFrequencyShiftLimit();
+    ui->modulation->setCurrentIndex((int) m_settings.m_modulation);
+    ui->modulationFrequency->setValue(m_settings.m_modulationTone);
+    ui->modulationFrequencyText->setText(QString("%1").arg(m_settings.m_modulationTone));
+    ui->amModulation->setValue(m_settings.m_amModulation);
+    ui->amModulationText->setText(QString("%1").arg(m_settings.m_amModulation));
+    ui->fmDeviation->setValue(m_settings.m_fmDeviation / 100);
+    ui->fmDeviationText->setText(QString("%1").arg(m_settings.m_fmDeviation / 1000.0, 0, 'f', 1));
+    ui->signalLevel->setValue((int) m_settings.m_signalLevel);
+    ui->signalLevelText->setText(QString("%1").arg((int) m_settings.m_signalLevel));
+    ui->noiseLevel->setValue((int) m_settings.m_noiseLevel);
+    ui->noiseLevelText->setText(QString("%1").arg((int) m_settings.m_noiseLevel));
+    ui->arrivalAngle->setValue((int) m_settings.m_arrivalAngle);
+    ui->arrivalAngleText->setText(QString("%1").arg((int) m_settings.m_arrivalAngle));
+    ui->elementSpacing->setValue(roundf(m_settings.m_elementSpacing * 100.0f));
+    ui->elementSpacingText->setText(QString("%1").arg(m_settings.m_elementSpacing, 0, 'f', 2));
+    ui->spectrumSource->setCurrentIndex(m_settings.m_spectrumStreamIndex);
+    displayStreamSettings();
+    blockApplySettings(false);
+}
+
+void TestMIGui::displayStreamSettings()
+{
+    const TestMIStreamSettings& streamSettings = m_settings.m_streams[m_streamIndex];
+    ui->gain->blockSignals(true);
+    ui->phase->blockSignals(true);
+    ui->delay->blockSignals(true);
+    ui->gain->setValue(roundf(streamSettings.m_gain * 10.0f));
+    ui->gainText->setText(QString("%1").arg(streamSettings.m_gain, 0, 'f', 1));
+    ui->phase->setValue((int) streamSettings.m_phase);
+    ui->phaseText->setText(QString("%1").arg((int) streamSettings.m_phase));
+    ui->delay->setValue(streamSettings.m_delay);
+    ui->gain->blockSignals(false);
+    ui->phase->blockSignals(false);
+    ui->delay->blockSignals(false);
+}
+
+void TestMIGui::sendSettings()
+{
+    if (!m_updateTimer.isActive()) {
+        m_updateTimer.start(100);
+    }
+}
+
+void TestMIGui::updateHardware()
+{
+    if (m_doApplySettings)
+    {
+        TestMI::MsgConfigureTestMI* message = TestMI::MsgConfigureTestMI::create(m_settings, m_forceSettings);
+        m_sampleMIMO->getInputMessageQueue()->push(message);
+        m_forceSettings = false;
+        m_updateTimer.stop();
+    }
+}
+
+void TestMIGui::updateStatus()
+{
+    int state = m_deviceUISet->m_deviceAPI->state(0);
+
+    if (m_lastEngineState != state)
+    {
+        switch(state)
+        {
+            case DeviceAPI::StNotStarted:
+                ui->startStop->setStyleSheet("QToolButton { background:rgb(79,79,79); }");
+                break;
+            case DeviceAPI::StIdle:
+                ui->startStop->setStyleSheet("QToolButton { background-color : blue; }");
+                break;
+            case DeviceAPI::StRunning:
+                ui->startStop->setStyleSheet("QToolButton { background-color : green; }");
+                break;
+            case DeviceAPI::StError:
+                ui->startStop->setStyleSheet("QToolButton { background-color : red; }");
+                QMessageBox::information(this, tr("Message"), m_deviceUISet->m_deviceAPI->errorMessage(0));
+                break;
+            default:
+                break;
+        }
+
+        m_lastEngineState = state;
+    }
+}
+
+bool TestMIGui::handleMessage(const Message& message)
+{
+    if (TestMI::MsgConfigureTestMI::match(message))
+    {
+        qDebug("TestMIGui::handleMessage: MsgConfigureTestMI");
+        const TestMI::MsgConfigureTestMI& cfg = (TestMI::MsgConfigureTestMI&) message;
+        m_settings = cfg.getSettings();
+        displaySettings();
+        return true;
+    }
+    else if (TestMI::MsgStartStop::match(message))
+    {
+        qDebug("TestMIGui::handleMessage: MsgStartStop");
+        TestMI::MsgStartStop& notif = (TestMI::MsgStartStop&) message;
+        blockApplySettings(true);
+        ui->startStop->setChecked(notif.getStartStop());
+        blockApplySettings(false);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void TestMIGui::handleInputMessages()
+{
+    Message* message;
+
+    while ((message = m_inputMessageQueue.pop()) != 0)
+    {
+        if (DSPMIMOSignalNotification::match(*message))
+        {
+            DSPMIMOSignalNotification* notif = (DSPMIMOSignalNotification*) message;
+
+            // all streams share the same rate and frequency
+            if (notif->getSourceOrSink() && (notif->getIndex() == 0))
+            {
+                m_deviceSampleRate = notif->getSampleRate();
+                m_deviceCenterFrequency = notif->getCenterFrequency();
+                qDebug("TestMIGui::handleInputMessages: DSPMIMOSignalNotification: SampleRate:%d, CenterFrequency:%llu",
+                        notif->getSampleRate(),
+                        notif->getCenterFrequency());
+                updateSampleRateAndFrequency();
+            }
+
+            delete message;
+        }
+        else
+        {
+            if (handleMessage(*message)) {
+                delete message;
+            }
+        }
+    }
+}
+
+void TestMIGui::updateSampleRateAndFrequency()
+{
+    m_deviceUISet->getSpectrum()->setSampleRate(m_deviceSampleRate);
+    m_deviceUISet->getSpectrum()->setCenterFrequency(m_deviceCenterFrequency);
+    ui->deviceRateText->setText(tr("%1k").arg((float)m_deviceSampleRate / 1000));
+}
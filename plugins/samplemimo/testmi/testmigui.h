@@ -0,0 +1,101 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTMI_TESTMIGUI_H_
+#define _TESTMI_TESTMIGUI_H_
+
+#include <plugin/plugininstancegui.h>
+#include <QTimer>
+#include <QWidget>
+
+#include "util/messagequeue.h"
+
+#include "testmisettings.h"
+#include "testmi.h"
+
+class DeviceUISet;
+
+namespace Ui {
+	class TestMIGui;
+}
+
+class TestMIGui : public QWidget, public PluginInstanceGUI {
+	Q_OBJECT
+
+public:
+	explicit TestMIGui(DeviceUISet *deviceUISet, QWidget* parent = 0);
+	virtual ~TestMIGui();
+	virtual void destroy();
+
+	void setName(const QString& name);
+	QString getName() const;
+
+	void resetToDefaults();
+	virtual qint64 getCenterFrequency() const;
+	virtual void setCenterFrequency(qint64 centerFrequency);
+	QByteArray serialize() const;
+	bool deserialize(const QByteArray& data);
+	virtual MessageQueue *getInputMessageQueue() { return &m_inputMessageQueue; }
+	virtual bool handleMessage(const Message& message);
+
+private:
+	Ui::TestMIGui* ui;
+
+	DeviceUISet* m_deviceUISet;
+	TestMISettings m_settings;
+    unsigned int m_streamIndex; //!< stream whose errors are displayed
+    QTimer m_updateTimer;
+    QTimer m_statusTimer;
+	bool m_doApplySettings;
+    bool m_forceSettings;
+	DeviceSampleMIMO* m_sampleMIMO;
+    int m_deviceSampleRate;
+    quint64 m_deviceCenterFrequency; //!< Center frequency in device
+	int m_lastEngineState;
+	MessageQueue m_inputMessageQueue;
+
+	void blockApplySettings(bool block) { m_doApplySettings = !block; }
+	void displaySettings();
+    void displayStreamSettings();
+	void sendSettings();
+    void updateSampleRateAndFrequency();
+    void updateFrequencyShiftLimit();
+
+private slots:
+    void handleInputMessages();
+	void on_startStop_toggled(bool checked);
+    void on_centerFrequency_changed(quint64 value);
+    void on_sampleRate_changed(quint64 value);
+    void on_frequencyShift_changed(qint64 value);
+    void on_modulation_currentIndexChanged(int index);
+    void on_modulationFrequency_valueChanged(int value);
+    void on_amModulation_valueChanged(int value);
+    void on_fmDeviation_valueChanged(int value);
+    void on_signalLevel_valueChanged(int value);
+    void on_noiseLevel_valueChanged(int value);
+    void on_arrivalAngle_valueChanged(int value);
+    void on_elementSpacing_valueChanged(int value);
+    void on_spectrumSource_currentIndexChanged(int index);
+    void on_streamIndex_currentIndexChanged(int index);
+    void on_gain_valueChanged(int value);
+    void on_phase_valueChanged(int value);
+    void on_delay_valueChanged(int value);
+    void updateStatus();
+    void updateHardware();
+};
+
+#endif // _TESTMI_TESTMIGUI_H_
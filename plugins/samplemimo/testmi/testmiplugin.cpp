@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QtPlugin>
+
+#include "plugin/pluginapi.h"
+#include "util/simpleserializer.h"
+
+#ifdef SERVER_MODE
+#include "testmi.h"
+#else
+#include "testmigui.h"
+#endif
+#include "testmiplugin.h"
+#include "testmiwebapiadapter.h"
+
+const PluginDescriptor TestMIPlugin::m_pluginDescriptor = {
+    QString("TestMI"),
+	QString("Test Multiple Input"),
+	QString("4.15.0"),
+	QString("(c) Edouard Griffiths, F4EXB"),
+	QString("https://github.com/f4exb/sdrangel"),
+	true,
+	QString("https://github.com/f4exb/sdrangel")
+};
+
+const QString TestMIPlugin::m_hardwareID = "TestMI";
+const QString TestMIPlugin::m_deviceTypeID = TESTMI_DEVICE_TYPE_ID;
+
+TestMIPlugin::TestMIPlugin(QObject* parent) :
+	QObject(parent)
+{
+}
+
+const PluginDescriptor& TestMIPlugin::getPluginDescriptor() const
+{
+	return m_pluginDescriptor;
+}
+
+void TestMIPlugin::initPlugin(PluginAPI* pluginAPI)
+{
+	pluginAPI->registerSampleMIMO(m_deviceTypeID, this);
+}
+
+void TestMIPlugin::enumOriginDevices(QStringList& listedHwIds, OriginDevices& originDevices)
+{
+    if (listedHwIds.contains(m_hardwareID)) { // check if it was done
+        return;
+    }
+
+    originDevices.append(OriginDevice(
+        "TestMI",
+        m_hardwareID,
+        QString(),
+        0,
+        TestMISettings::m_nbStreams, // nb Rx
+        0  // nb Tx
+    ));
+
+    listedHwIds.append(m_hardwareID);
+}
+
+PluginInterface::SamplingDevices TestMIPlugin::enumSampleMIMO(const OriginDevices& originDevices)
+{
+	SamplingDevices result;
+
+	for (OriginDevices::const_iterator it = originDevices.begin(); it != originDevices.end(); ++it)
+    {
+        if (it->hardwareId == m_hardwareID)
+        {
+            result.append(SamplingDevice(
+                it->displayableName,
+                m_hardwareID,
+                m_deviceTypeID,
+                it->serial,
+                it->sequence,
+                PluginInterface::SamplingDevice::BuiltInDevice,
+                PluginInterface::SamplingDevice::StreamMIMO,
+                TestMISettings::m_nbStreams, // nb Rx
+                0  // nb Tx
+            ));
+        }
+    }
+
+	return result;
+}
+
+#ifdef SERVER_MODE
+PluginInstanceGUI* TestMIPlugin::createSampleMIMOPluginInstanceGUI(
+        const QString& mimoId,
+        QWidget **widget,
+        DeviceUISet *deviceUISet)
+{
+    (void) mimoId;
+    (void) widget;
+    (void) deviceUISet;
+    return nullptr;
+}
+#else
+PluginInstanceGUI* TestMIPlugin::createSampleMIMOPluginInstanceGUI(
+        const QString& mimoId,
+        QWidget **widget,
+        DeviceUISet *deviceUISet)
+{
+	if (mimoId == m_deviceTypeID)
+    {
+		TestMIGui* gui = new TestMIGui(deviceUISet);
+		*widget = gui;
+		return gui;
+	}
+    else
+    {
+		return nullptr;
+	}
+}
+#endif
+
+DeviceSampleMIMO *TestMIPlugin::createSampleMIMOPluginInstance(const QString& mimoId, DeviceAPI *deviceAPI)
+{
+    if (mimoId == m_deviceTypeID)
+    {
+        TestMI* input = new TestMI(deviceAPI);
+        return input;
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+DeviceWebAPIAdapter *TestMIPlugin::createDeviceWebAPIAdapter() const
+{
+    return new TestMIWebAPIAdapter();
+}
@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QtGlobal>
+
+#include "util/simpleserializer.h"
+#include "testmisettings.h"
+
+TestMIStreamSettings::TestMIStreamSettings()
+{
+    resetToDefaults();
+}
+
+void TestMIStreamSettings::resetToDefaults()
+{
+    m_gain = 0.0f;
+    m_phase = 0.0f;
+    m_delay = 0;
+}
+
+QByteArray TestMIStreamSettings::serialize() const
+{
+    SimpleSerializer s(1);
+
+    s.writeFloat(1, m_gain);
+    s.writeFloat(2, m_phase);
+    s.writeS32(3, m_delay);
+
+    return s.final();
+}
+
+bool TestMIStreamSettings::deserialize(const QByteArray& data)
+{
+    SimpleDeserializer d(data);
+
+    if (!d.isValid() || (d.getVersion() != 1))
+    {
+        resetToDefaults();
+        return false;
+    }
+
+    d.readFloat(1, &m_gain, 0.0f);
+    d.readFloat(2, &m_phase, 0.0f);
+    d.readS32(3, &m_delay, 0);
+    m_delay = m_delay < 0 ? 0 : m_delay > TestMISettings::m_maxDelay ? TestMISettings::m_maxDelay : m_delay;
+
+    return true;
+}
+
+TestMISettings::TestMISettings()
+{
+    resetToDefaults();
+}
+
+void TestMISettings::resetToDefaults()
+{
+    m_centerFrequency = 435000*1000;
+    m_sampleRate = 48000;
+    m_frequencyShift = 0;
+    m_modulation = ModulationNone;
+    m_modulationTone = 440;
+    m_amModulation = 50;
+    m_fmDeviation = 5000;
+    m_signalLevel = -20.0f;
+    m_noiseLevel = -60.0f;
+    m_arrivalAngle = 0.0f;
+    m_elementSpacing = 0.5f;
+    m_spectrumStreamIndex = 0;
+    m_streams.assign(m_nbStreams, TestMIStreamSettings());
+}
+
+QByteArray TestMISettings::serialize() const
+{
+    SimpleSerializer s(1);
+
+    s.writeU64(1, m_centerFrequency);
+    s.writeU32(2, m_sampleRate);
+    s.writeS32(3, m_frequencyShift);
+    s.writeS32(4, (int) m_modulation);
+    s.writeS32(5, m_modulationTone);
+    s.writeS32(6, m_amModulation);
+    s.writeS32(7, m_fmDeviation);
+    s.writeFloat(8, m_signalLevel);
+    s.writeFloat(9, m_noiseLevel);
+    s.writeFloat(10, m_arrivalAngle);
+    s.writeFloat(11, m_elementSpacing);
+    s.writeU32(12, m_spectrumStreamIndex);
+
+    for (unsigned int i = 0; i < m_streams.size(); i++) {
+        s.writeBlob(100 + i, m_streams[i].serialize());
+    }
+
+    return s.final();
+}
+
+bool TestMISettings::deserialize(const QByteArray& data)
+{
+    SimpleDeserializer d(data);
+
+    if (!d.isValid())
+    {
+        resetToDefaults();
+        return false;
+    }
+
+    if (d.getVersion() == 1)
+    {
+        int intval;
+        QByteArray bytetmp;
+
+        d.readU64(1, &m_centerFrequency, 435000*1000);
+        d.readU32(2, &m_sampleRate, 48000);
+        d.readS32(3, &m_frequencyShift, 0);
+        d.readS32(4, &intval, 0);
+
+        if ((intval < 0) || (intval >= (int) ModulationLast)) {
+            m_modulation = ModulationNone;
+        } else {
+            m_modulation = (Modulation) intval;
+        }
+
+        d.readS32(5, &m_modulationTone, 440);
+        d.readS32(6, &m_amModulation, 50);
+        d.readS32(7, &m_fmDeviation, 5000);
+        d.readFloat(8, &m_signalLevel, -20.0f);
+        d.readFloat(9, &m_noiseLevel, -60.0f);
+        d.readFloat(10, &m_arrivalAngle, 0.0f);
+        d.readFloat(11, &m_elementSpacing, 0.5f);
+        d.readU32(12, &m_spectrumStreamIndex, 0);
+        m_spectrumStreamIndex = m_spectrumStreamIndex < m_nbStreams ? m_spectrumStreamIndex : 0;
+        m_streams.assign(m_nbStreams, TestMIStreamSettings());
+
+        for (unsigned int i = 0; i < m_nbStreams; i++)
+        {
+            d.readBlob(100 + i, &bytetmp);
+            m_streams[i].deserialize(bytetmp);
+        }
+
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
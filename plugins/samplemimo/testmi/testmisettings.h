@@ -0,0 +1,74 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTMI_TESTMISETTINGS_H_
+#define _TESTMI_TESTMISETTINGS_H_
+
+#include <vector>
+
+#include <QString>
+
+struct TestMIStreamSettings
+{
+    float m_gain;  //!< dB relative to the signal level
+    float m_phase; //!< degrees. Phase error added to the arrival phase of the wave front.
+    int m_delay;   //!< samples. Delay added to the stream.
+
+    TestMIStreamSettings();
+    void resetToDefaults();
+    QByteArray serialize() const;
+    bool deserialize(const QByteArray& data);
+};
+
+/**
+ * The test MIMO emulates a uniform linear array of phase coherent receivers. A single signal is
+ * received by all the streams as a plane wave coming from m_arrivalAngle off the array broadside.
+ * Each stream adds its own gain, phase and delay errors and an independent noise.
+ */
+struct TestMISettings
+{
+    typedef enum {
+        ModulationNone,
+        ModulationAM,
+        ModulationFM,
+        ModulationLast
+    } Modulation;
+
+    quint64 m_centerFrequency;
+    quint32 m_sampleRate;
+    qint32 m_frequencyShift;  //!< signal frequency from the center frequency
+    Modulation m_modulation;
+    int m_modulationTone;     //!< Hz
+    int m_amModulation;       //!< percent
+    int m_fmDeviation;        //!< Hz
+    float m_signalLevel;      //!< dB relative to full scale
+    float m_noiseLevel;       //!< dB relative to full scale. Noise power in each stream.
+    float m_arrivalAngle;     //!< degrees from the array broadside
+    float m_elementSpacing;   //!< distance between two array elements in wavelengths
+    unsigned int m_spectrumStreamIndex; //!< stream displayed in the main spectrum
+    std::vector<TestMIStreamSettings> m_streams;
+
+    static const unsigned int m_nbStreams = 4;
+    static const int m_maxDelay = 1000;
+
+    TestMISettings();
+    void resetToDefaults();
+    QByteArray serialize() const;
+    bool deserialize(const QByteArray& data);
+};
+
+#endif /* _TESTMI_TESTMISETTINGS_H_ */
@@ -0,0 +1,174 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <algorithm>
+
+#include <QDebug>
+
+#include "dsp/samplemififo.h"
+
+#include "testmiworker.h"
+
+TestMIWorker::TestMIWorker(SampleMIFifo* sampleFifo, QObject* parent) :
+    QObject(parent),
+    m_running(false),
+    m_sampleFifo(sampleFifo),
+    m_fmPhasor(0.0f),
+    m_signalAmplitude(0.0f),
+    m_noiseAmplitude(0.0f),
+    m_generator(0),
+    m_noise(0.0f, 1.0f),
+    m_samplesDone(0),
+    m_mutex(QMutex::Recursive)
+{
+    m_streamSamples.resize(TestMISettings::m_nbStreams);
+    m_steering.resize(TestMISettings::m_nbStreams);
+    m_signal.assign(TestMISettings::m_maxDelay, Complex{0.0f, 0.0f});
+    applySettings();
+}
+
+TestMIWorker::~TestMIWorker()
+{
+}
+
+void TestMIWorker::startWork()
+{
+    qDebug("TestMIWorker::startWork");
+    m_samplesDone = 0;
+    m_elapsedTimer.start();
+    m_timer.setTimerType(Qt::PreciseTimer);
+    connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+    m_timer.start(m_throttleMs);
+    m_running = true;
+}
+
+void TestMIWorker::stopWork()
+{
+    qDebug("TestMIWorker::stopWork");
+    m_timer.stop();
+    disconnect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
+    m_running = false;
+}
+
+void TestMIWorker::setSettings(const TestMISettings& settings)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (settings.m_sampleRate != m_settings.m_sampleRate) // restart the time base
+    {
+        m_samplesDone = 0;
+        m_elapsedTimer.restart();
+    }
+
+    m_settings = settings;
+    applySettings();
+}
+
+void TestMIWorker::applySettings()
+{
+    m_nco.setFreq(m_settings.m_frequencyShift, m_settings.m_sampleRate);
+    m_toneNco.setFreq(m_settings.m_modulationTone, m_settings.m_sampleRate);
+    m_signalAmplitude = pow(10.0, m_settings.m_signalLevel / 20.0);
+    // complex noise: the power is split between I and Q
+    m_noiseAmplitude = pow(10.0, m_settings.m_noiseLevel / 20.0) / sqrt(2.0);
+
+    // plane wave phase progression along the array plus the errors of each stream
+    float arrivalPhase = 2.0 * M_PI * m_settings.m_elementSpacing * sin(m_settings.m_arrivalAngle * M_PI / 180.0);
+
+    for (unsigned int i = 0; i < TestMISettings::m_nbStreams; i++)
+    {
+        const TestMIStreamSettings& streamSettings = m_settings.m_streams[i];
+        float gain = pow(10.0, streamSettings.m_gain / 20.0);
+        float phase = -arrivalPhase * i + streamSettings.m_phase * M_PI / 180.0;
+        m_steering[i] = std::polar(gain, phase);
+    }
+}
+
+void TestMIWorker::tick()
+{
+    if (!m_running) {
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+    quint64 samplesDue = (m_elapsedTimer.nsecsElapsed() * m_settings.m_sampleRate) / 1000000000;
+
+    if (samplesDue <= m_samplesDone) {
+        return;
+    }
+
+    // do not try to catch up more than half a second (i.e. if the thread was stalled)
+    quint64 nbSamples = std::min(samplesDue - m_samplesDone, (quint64) m_settings.m_sampleRate / 2);
+    m_samplesDone = samplesDue;
+    generate(nbSamples);
+}
+
+void TestMIWorker::generate(unsigned int nbSamples)
+{
+    const int history = TestMISettings::m_maxDelay;
+    m_signal.resize(history + nbSamples);
+    Complex *signal = &m_signal[history];
+    m_nco.nextIQBlock(signal, nbSamples);
+
+    if (m_settings.m_modulation == TestMISettings::ModulationAM)
+    {
+        float modulation = m_settings.m_amModulation / 100.0f;
+
+        for (unsigned int i = 0; i < nbSamples; i++) {
+            signal[i] *= (1.0f + modulation * m_toneNco.next()) / (1.0f + modulation);
+        }
+    }
+    else if (m_settings.m_modulation == TestMISettings::ModulationFM)
+    {
+        float deviation = (2.0f * M_PI * m_settings.m_fmDeviation) / m_settings.m_sampleRate;
+
+        for (unsigned int i = 0; i < nbSamples; i++)
+        {
+            m_fmPhasor += deviation * m_toneNco.next();
+            m_fmPhasor = m_fmPhasor > M_PI ? m_fmPhasor - 2.0f * M_PI : m_fmPhasor < -M_PI ? m_fmPhasor + 2.0f * M_PI : m_fmPhasor;
+            signal[i] *= std::polar(1.0f, m_fmPhasor);
+        }
+    }
+
+    std::vector<SampleVector::const_iterator> vbegin;
+
+    for (unsigned int stream = 0; stream < TestMISettings::m_nbStreams; stream++)
+    {
+        SampleVector& samples = m_streamSamples[stream];
+        samples.resize(nbSamples);
+        const Complex *delayed = signal - m_settings.m_streams[stream].m_delay;
+        Complex steering = m_steering[stream] * m_signalAmplitude;
+
+        for (unsigned int i = 0; i < nbSamples; i++)
+        {
+            Complex c = steering * delayed[i] + Complex{m_noiseAmplitude * m_noise(m_generator), m_noiseAmplitude * m_noise(m_generator)};
+            float re = std::max(-1.0f, std::min(c.real(), 1.0f));
+            float im = std::max(-1.0f, std::min(c.imag(), 1.0f));
+            samples[i].setReal(re * (SDR_RX_SCALEF - 1.0f));
+            samples[i].setImag(im * (SDR_RX_SCALEF - 1.0f));
+        }
+
+        vbegin.push_back(samples.begin());
+    }
+
+    m_sampleFifo->writeSync(vbegin, nbSamples);
+
+    // keep the end of the signal as the history of the next block
+    std::copy(m_signal.end() - history, m_signal.end(), m_signal.begin());
+}
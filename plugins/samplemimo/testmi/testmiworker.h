@@ -0,0 +1,80 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTMI_TESTMIWORKER_H_
+#define _TESTMI_TESTMIWORKER_H_
+
+#include <random>
+#include <vector>
+
+#include <QObject>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QMutex>
+
+#include "dsp/dsptypes.h"
+#include "dsp/ncof.h"
+
+#include "testmisettings.h"
+
+class SampleMIFifo;
+
+/**
+ * Generates the synchronous streams of the test MIMO. All the streams of a block are computed
+ * together from the same signal and written at once in the multiple input FIFO so that they
+ * stay sample aligned as they would from a phase coherent multi channel device.
+ */
+class TestMIWorker : public QObject {
+    Q_OBJECT
+
+public:
+    TestMIWorker(SampleMIFifo* sampleFifo, QObject* parent = nullptr);
+    ~TestMIWorker();
+
+    void startWork();
+    void stopWork();
+    void setSettings(const TestMISettings& settings);
+
+private:
+    bool m_running;
+    SampleMIFifo* m_sampleFifo;
+    TestMISettings m_settings;
+    NCOF m_nco;
+    NCOF m_toneNco;
+    float m_fmPhasor;
+    std::vector<Complex> m_signal;   //!< signal common to all streams preceded by m_maxDelay samples of history
+    std::vector<Complex> m_steering; //!< gain and phase of each stream
+    std::vector<SampleVector> m_streamSamples;
+    float m_signalAmplitude;
+    float m_noiseAmplitude;
+    std::mt19937 m_generator;
+    std::normal_distribution<float> m_noise;
+    quint64 m_samplesDone;
+    QTimer m_timer;
+    QElapsedTimer m_elapsedTimer;
+    QMutex m_mutex;
+
+    void applySettings();
+    void generate(unsigned int nbSamples);
+
+    static const int m_throttleMs = 50;
+
+private slots:
+    void tick();
+};
+
+#endif // _TESTMI_TESTMIWORKER_H_
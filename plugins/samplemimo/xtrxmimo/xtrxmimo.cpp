@@ -0,0 +1,658 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+#include <math.h>
+
+#include <QDebug>
+
+#include "xtrx_api.h"
+
+#include "SWGDeviceSettings.h"
+#include "SWGDeviceState.h"
+#include "SWGXtrxMIMOSettings.h"
+
+#include "device/deviceapi.h"
+#include "dsp/dspcommands.h"
+#include "dsp/devicesamplesource.h"
+#include "xtrx/devicextrx.h"
+
+#include "xtrxmithread.h"
+#include "xtrxmimo.h"
+
+MESSAGE_CLASS_DEFINITION(XTRXMIMO::MsgConfigureXTRXMIMO, Message)
+MESSAGE_CLASS_DEFINITION(XTRXMIMO::MsgStartStop, Message)
+
+XTRXMIMO::XTRXMIMO(DeviceAPI *deviceAPI) :
+    m_deviceAPI(deviceAPI),
+    m_settings(),
+    m_deviceDescription("XTRXMIMO"),
+    m_running(false),
+    m_dev(nullptr),
+    m_thread(nullptr)
+{
+    m_mimoType = MIMOHalfSynchronous;
+    m_sampleMIFifo.init(m_nbRxStreams, 96000 * 4);
+    m_deviceAPI->setNbSourceStreams(m_nbRxStreams);
+    m_deviceAPI->setNbSinkStreams(0);
+    openDevice();
+}
+
+XTRXMIMO::~XTRXMIMO()
+{
+    if (m_running) {
+        stopRx();
+    }
+
+    closeDevice();
+}
+
+void XTRXMIMO::destroy()
+{
+    delete this;
+}
+
+bool XTRXMIMO::openDevice()
+{
+    // The MIMO device set owns the whole physical device so there are no buddies to look for
+    m_dev = new DeviceXTRX();
+    char serial[256];
+    strcpy(serial, qPrintable(m_deviceAPI->getSamplingDeviceSerial()));
+
+    if (!m_dev->open(serial))
+    {
+        qCritical("XTRXMIMO::openDevice: cannot open XTRX device");
+        delete m_dev;
+        m_dev = nullptr;
+        return false;
+    }
+
+    qDebug("XTRXMIMO::openDevice: device opened");
+    return true;
+}
+
+void XTRXMIMO::closeDevice()
+{
+    if (m_dev == nullptr) { // was never open
+        return;
+    }
+
+    if (m_running) {
+        stopRx();
+    }
+
+    m_dev->close();
+    delete m_dev;
+    m_dev = nullptr;
+}
+
+void XTRXMIMO::init()
+{
+    applySettings(m_settings, true);
+}
+
+bool XTRXMIMO::startRx()
+{
+    qDebug("XTRXMIMO::startRx");
+
+    if (!m_dev)
+    {
+        qDebug("XTRXMIMO::startRx: no device object");
+        return false;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (m_running) {
+        return true;
+    }
+
+    m_sampleMIFifo.reset();
+    m_thread = new XTRXMIThread(m_dev->getDevice());
+    m_thread->setFifo(&m_sampleMIFifo);
+    m_thread->setLog2Decimation(m_settings.m_log2SoftDecim);
+    m_thread->setFcPos((int) m_settings.m_fcPosRx);
+    m_thread->setIQOrder(m_settings.m_iqOrder);
+    m_thread->startWork();
+    m_running = true;
+
+    return true;
+}
+
+void XTRXMIMO::stopRx()
+{
+    qDebug("XTRXMIMO::stopRx");
+
+    if (!m_thread) {
+        return;
+    }
+
+    QMutexLocker mutexLocker(&m_mutex);
+
+    m_thread->stopWork();
+    delete m_thread;
+    m_thread = nullptr;
+    m_running = false;
+}
+
+QByteArray XTRXMIMO::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool XTRXMIMO::deserialize(const QByteArray& data)
+{
+    bool success = true;
+
+    if (!m_settings.deserialize(data))
+    {
+        m_settings.resetToDefaults();
+        success = false;
+    }
+
+    MsgConfigureXTRXMIMO* message = MsgConfigureXTRXMIMO::create(m_settings, true);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue)
+    {
+        MsgConfigureXTRXMIMO* messageToGUI = MsgConfigureXTRXMIMO::create(m_settings, true);
+        m_guiMessageQueue->push(messageToGUI);
+    }
+
+    return success;
+}
+
+const QString& XTRXMIMO::getDeviceDescription() const
+{
+    return m_deviceDescription;
+}
+
+int XTRXMIMO::getSourceSampleRate(int index) const
+{
+    (void) index; // both channels share the sample clock
+    return m_settings.m_devSampleRate/(1<<m_settings.m_log2SoftDecim);
+}
+
+quint64 XTRXMIMO::getSourceCenterFrequency(int index) const
+{
+    (void) index; // both channels share the local oscillator
+    return m_settings.m_rxCenterFrequency;
+}
+
+void XTRXMIMO::setSourceCenterFrequency(qint64 centerFrequency, int index)
+{
+    (void) index;
+    XTRXMIMOSettings settings = m_settings;
+    settings.m_rxCenterFrequency = centerFrequency;
+
+    MsgConfigureXTRXMIMO* message = MsgConfigureXTRXMIMO::create(settings, false);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue)
+    {
+        MsgConfigureXTRXMIMO* messageToGUI = MsgConfigureXTRXMIMO::create(settings, false);
+        m_guiMessageQueue->push(messageToGUI);
+    }
+}
+
+void XTRXMIMO::getRxFrequencyRange(float& minF, float& maxF, float& stepF) const
+{
+    minF = 29e6;
+    maxF = 3840e6;
+    stepF = 10;
+}
+
+void XTRXMIMO::getRxSampleRateRange(float& minF, float& maxF, float& stepF) const
+{
+    minF = 100e3;
+    maxF = 120e6;
+    stepF = 10;
+}
+
+void XTRXMIMO::getRxLPFRange(float& minF, float& maxF, float& stepF) const
+{
+    minF = 500e3;
+    maxF = 130e6;
+    stepF = 10;
+}
+
+uint32_t XTRXMIMO::getLog2HardDecim() const
+{
+    if (m_dev && (m_dev->getActualInputRate() != 0.0)) {
+        return log2(m_dev->getClockGen() / m_dev->getActualInputRate() / 4);
+    } else {
+        return m_settings.m_log2HardDecim;
+    }
+}
+
+bool XTRXMIMO::handleMessage(const Message& message)
+{
+    if (MsgConfigureXTRXMIMO::match(message))
+    {
+        MsgConfigureXTRXMIMO& conf = (MsgConfigureXTRXMIMO&) message;
+        qDebug() << "XTRXMIMO::handleMessage: MsgConfigureXTRXMIMO";
+
+        if (!applySettings(conf.getSettings(), conf.getForce())) {
+            qDebug("XTRXMIMO::handleMessage: config error");
+        }
+
+        return true;
+    }
+    else if (MsgStartStop::match(message))
+    {
+        MsgStartStop& cmd = (MsgStartStop&) message;
+        qDebug() << "XTRXMIMO::handleMessage: MsgStartStop: " << (cmd.getStartStop() ? "start" : "stop");
+
+        if (cmd.getStartStop())
+        {
+            if (m_deviceAPI->initDeviceEngine(0)) {
+                m_deviceAPI->startDeviceEngine(0);
+            }
+        }
+        else
+        {
+            m_deviceAPI->stopDeviceEngine(0);
+        }
+
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+static double tia_to_db(unsigned idx)
+{
+    switch (idx) {
+    case 1: return 12;
+    case 2: return 9;
+    default: return 0;
+    }
+}
+
+void XTRXMIMO::applyGain(unsigned int channel, uint32_t gain)
+{
+    uint32_t lna, tia, pga;
+    DeviceXTRX::getAutoGains(gain, lna, tia, pga);
+    xtrx_channel_t xtrxChannel = channel == 0 ? XTRX_CH_A : XTRX_CH_B;
+
+    if ((xtrx_set_gain(m_dev->getDevice(), xtrxChannel, XTRX_RX_LNA_GAIN, lna, 0) < 0)
+     || (xtrx_set_gain(m_dev->getDevice(), xtrxChannel, XTRX_RX_TIA_GAIN, tia_to_db(tia), 0) < 0)
+     || (xtrx_set_gain(m_dev->getDevice(), xtrxChannel, XTRX_RX_PGA_GAIN, pga, 0) < 0))
+    {
+        qWarning("XTRXMIMO::applyGain: xtrx_set_gain(%u, %u) failed", channel, gain);
+    }
+    else
+    {
+        qDebug("XTRXMIMO::applyGain: channel %u gain set to %u (LNA: %u TIA: %u PGA: %u)", channel, gain, lna, tia, pga);
+    }
+}
+
+bool XTRXMIMO::applySettings(const XTRXMIMOSettings& settings, bool force)
+{
+    qDebug() << "XTRXMIMO::applySettings: "
+            << " m_rxCenterFrequency: " << settings.m_rxCenterFrequency << " Hz"
+            << " m_devSampleRate: " << settings.m_devSampleRate
+            << " m_log2HardDecim: " << settings.m_log2HardDecim
+            << " m_log2SoftDecim: " << settings.m_log2SoftDecim
+            << " m_fcPosRx: " << settings.m_fcPosRx
+            << " m_lpfBW: " << settings.m_lpfBW
+            << " m_antennaPath: " << settings.m_antennaPath
+            << " m_rx0Gain: " << settings.m_rx0Gain
+            << " m_rx1Gain: " << settings.m_rx1Gain
+            << " m_extClock: " << settings.m_extClock
+            << " m_extClockFreq: " << settings.m_extClockFreq
+            << " m_pwrmode: " << settings.m_pwrmode
+            << " m_dcBlock: " << settings.m_dcBlock
+            << " m_iqCorrection: " << settings.m_iqCorrection
+            << " m_iqOrder: " << settings.m_iqOrder
+            << " m_spectrumStreamIndex: " << settings.m_spectrumStreamIndex
+            << " force: " << force;
+
+    bool forwardChangeRxDSP = false;
+    bool doChangeSampleRate = false;
+    bool doChangeFreq = false;
+    bool doLPCalibration = false;
+    struct xtrx_dev *dev = m_dev ? m_dev->getDevice() : nullptr;
+
+    if ((m_settings.m_dcBlock != settings.m_dcBlock) ||
+        (m_settings.m_iqCorrection != settings.m_iqCorrection) || force)
+    {
+        for (unsigned int i = 0; i < m_nbRxStreams; i++) {
+            m_deviceAPI->configureCorrections(settings.m_dcBlock, settings.m_iqCorrection, i);
+        }
+    }
+
+    if (((m_settings.m_pwrmode != settings.m_pwrmode) || force) && dev)
+    {
+        if (xtrx_val_set(dev, XTRX_TRX, XTRX_CH_AB, XTRX_LMS7_PWR_MODE, settings.m_pwrmode) < 0) {
+            qCritical("XTRXMIMO::applySettings: could not set power mode %d", settings.m_pwrmode);
+        }
+    }
+
+    if ((m_settings.m_extClock != settings.m_extClock)
+       || (settings.m_extClock && (m_settings.m_extClockFreq != settings.m_extClockFreq)) || force)
+    {
+        if (dev)
+        {
+            xtrx_set_ref_clk(dev,
+                             (settings.m_extClock) ? settings.m_extClockFreq : 0,
+                             (settings.m_extClock) ? XTRX_CLKSRC_EXT : XTRX_CLKSRC_INT);
+            doChangeSampleRate = true;
+            doChangeFreq = true;
+            qDebug("XTRXMIMO::applySettings: clock set to %s (Ext: %d Hz)",
+                    settings.m_extClock ? "external" : "internal",
+                    settings.m_extClockFreq);
+        }
+    }
+
+    if ((m_settings.m_devSampleRate != settings.m_devSampleRate)
+       || (m_settings.m_log2HardDecim != settings.m_log2HardDecim) || force)
+    {
+        forwardChangeRxDSP = true;
+        doChangeSampleRate = true;
+    }
+
+    if ((m_settings.m_lpfBW != settings.m_lpfBW) || force) {
+        doLPCalibration = true;
+    }
+
+    if (((m_settings.m_antennaPath != settings.m_antennaPath) || force) && dev)
+    {
+        if (xtrx_set_antenna(dev, settings.m_antennaPath) < 0) {
+            qCritical("XTRXMIMO::applySettings: could not set antenna path to %d", (int) settings.m_antennaPath);
+        } else {
+            qDebug("XTRXMIMO::applySettings: set antenna path to %d", (int) settings.m_antennaPath);
+        }
+    }
+
+    if ((m_settings.m_fcPosRx != settings.m_fcPosRx) || force)
+    {
+        if (m_thread) {
+            m_thread->setFcPos((int) settings.m_fcPosRx);
+        }
+    }
+
+    if ((m_settings.m_log2SoftDecim != settings.m_log2SoftDecim) || force)
+    {
+        forwardChangeRxDSP = true;
+
+        if (m_thread) {
+            m_thread->setLog2Decimation(settings.m_log2SoftDecim);
+        }
+    }
+
+    if ((m_settings.m_iqOrder != settings.m_iqOrder) || force)
+    {
+        if (m_thread) {
+            m_thread->setIQOrder(settings.m_iqOrder);
+        }
+    }
+
+    if ((m_settings.m_rxCenterFrequency != settings.m_rxCenterFrequency)
+        || (m_settings.m_fcPosRx != settings.m_fcPosRx)
+        || (m_settings.m_log2SoftDecim != settings.m_log2SoftDecim) || force)
+    {
+        doChangeFreq = true;
+    }
+
+    bool doGain[m_nbRxStreams] = {
+        (m_settings.m_rx0Gain != settings.m_rx0Gain) || force,
+        (m_settings.m_rx1Gain != settings.m_rx1Gain) || force
+    };
+    bool doSpectrumSource = (m_settings.m_spectrumStreamIndex != settings.m_spectrumStreamIndex) || force;
+
+    m_settings = settings;
+
+    if (doChangeSampleRate && dev && (m_settings.m_devSampleRate != 0))
+    {
+        double master = (m_settings.m_log2HardDecim == 0) ? 0 : (m_settings.m_devSampleRate * 4 * (1 << m_settings.m_log2HardDecim));
+
+        if (m_dev->setSamplerate(m_settings.m_devSampleRate, master, false) == 0)
+        {
+            qCritical("XTRXMIMO::applySettings: could not set sample rate to %d", m_settings.m_devSampleRate);
+        }
+        else
+        {
+            // report the actual values back to the GUI
+            m_settings.m_devSampleRate = m_dev->getActualInputRate();
+            m_settings.m_log2HardDecim = getLog2HardDecim();
+            doChangeFreq = true;
+
+            qDebug("XTRXMIMO::applySettings: sample rate set to %d with hard decimation of %d",
+                m_settings.m_devSampleRate, m_settings.m_log2HardDecim);
+
+            if (getMessageQueueToGUI())
+            {
+                MsgConfigureXTRXMIMO *msg = MsgConfigureXTRXMIMO::create(m_settings, false);
+                getMessageQueueToGUI()->push(msg);
+            }
+        }
+    }
+
+    for (unsigned int i = 0; (i < m_nbRxStreams) && dev; i++)
+    {
+        if (doLPCalibration)
+        {
+            if (xtrx_tune_rx_bandwidth(dev, i == 0 ? XTRX_CH_A : XTRX_CH_B, m_settings.m_lpfBW, 0) < 0) {
+                qCritical("XTRXMIMO::applySettings: could not set LPF of channel %u to %f Hz", i, m_settings.m_lpfBW);
+            } else {
+                qDebug("XTRXMIMO::applySettings: LPF of channel %u set to %f Hz", i, m_settings.m_lpfBW);
+            }
+        }
+
+        if (doGain[i]) {
+            applyGain(i, i == 0 ? m_settings.m_rx0Gain : m_settings.m_rx1Gain);
+        }
+    }
+
+    if (doChangeFreq)
+    {
+        forwardChangeRxDSP = true;
+        qint64 deviceCenterFrequency = DeviceSampleSource::calculateDeviceCenterFrequency(
+                m_settings.m_rxCenterFrequency,
+                0,
+                m_settings.m_log2SoftDecim,
+                (DeviceSampleSource::fcPos_t) m_settings.m_fcPosRx,
+                m_settings.m_devSampleRate,
+                DeviceSampleSource::FrequencyShiftScheme::FSHIFT_STD,
+                false);
+
+        // the LO is common to both Rx channels
+        if (dev)
+        {
+            if (xtrx_tune(dev, XTRX_TUNE_RX_FDD, deviceCenterFrequency, 0) < 0) {
+                qCritical("XTRXMIMO::applySettings: could not set frequency to %lld", deviceCenterFrequency);
+            } else {
+                qDebug("XTRXMIMO::applySettings: frequency set to %lld", deviceCenterFrequency);
+            }
+        }
+    }
+
+    if (forwardChangeRxDSP)
+    {
+        int sampleRate = m_settings.m_devSampleRate/(1<<m_settings.m_log2SoftDecim);
+
+        for (unsigned int i = 0; i < m_nbRxStreams; i++)
+        {
+            DSPMIMOSignalNotification *notif = new DSPMIMOSignalNotification(sampleRate, m_settings.m_rxCenterFrequency, true, i);
+            m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+        }
+    }
+
+    if (doSpectrumSource) {
+        m_deviceAPI->setSpectrumSinkInput(true, m_settings.m_spectrumStreamIndex);
+    }
+
+    return true;
+}
+
+int XTRXMIMO::webapiRunGet(
+        int subsystemIndex,
+        SWGSDRangel::SWGDeviceState& response,
+        QString& errorMessage)
+{
+    if (subsystemIndex != 0)
+    {
+        errorMessage = QString("Subsystem index invalid: expect 0 (Rx) only");
+        return 404;
+    }
+
+    m_deviceAPI->getDeviceEngineStateStr(*response.getState(), subsystemIndex);
+    return 200;
+}
+
+int XTRXMIMO::webapiRun(
+        bool run,
+        int subsystemIndex,
+        SWGSDRangel::SWGDeviceState& response,
+        QString& errorMessage)
+{
+    if (subsystemIndex != 0)
+    {
+        errorMessage = QString("Subsystem index invalid: expect 0 (Rx) only");
+        return 404;
+    }
+
+    m_deviceAPI->getDeviceEngineStateStr(*response.getState(), subsystemIndex);
+    MsgStartStop *message = MsgStartStop::create(run);
+    m_inputMessageQueue.push(message);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgStartStop *msgToGUI = MsgStartStop::create(run);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    return 200;
+}
+
+int XTRXMIMO::webapiSettingsGet(
+                SWGSDRangel::SWGDeviceSettings& response,
+                QString& errorMessage)
+{
+    (void) errorMessage;
+    response.setXtrxMimoSettings(new SWGSDRangel::SWGXtrxMIMOSettings());
+    response.getXtrxMimoSettings()->init();
+    webapiFormatDeviceSettings(response, m_settings);
+    return 200;
+}
+
+int XTRXMIMO::webapiSettingsPutPatch(
+                bool force,
+                const QStringList& deviceSettingsKeys,
+                SWGSDRangel::SWGDeviceSettings& response, // query + response
+                QString& errorMessage)
+{
+    (void) errorMessage;
+    XTRXMIMOSettings settings = m_settings;
+    webapiUpdateDeviceSettings(settings, deviceSettingsKeys, response);
+
+    MsgConfigureXTRXMIMO *msg = MsgConfigureXTRXMIMO::create(settings, force);
+    m_inputMessageQueue.push(msg);
+
+    if (m_guiMessageQueue) // forward to GUI if any
+    {
+        MsgConfigureXTRXMIMO *msgToGUI = MsgConfigureXTRXMIMO::create(settings, force);
+        m_guiMessageQueue->push(msgToGUI);
+    }
+
+    webapiFormatDeviceSettings(response, settings);
+    return 200;
+}
+
+void XTRXMIMO::webapiUpdateDeviceSettings(
+    XTRXMIMOSettings& settings,
+    const QStringList& deviceSettingsKeys,
+    SWGSDRangel::SWGDeviceSettings& response)
+{
+    SWGSDRangel::SWGXtrxMIMOSettings *swgSettings = response.getXtrxMimoSettings();
+
+    if (deviceSettingsKeys.contains("devSampleRate")) {
+        settings.m_devSampleRate = swgSettings->getDevSampleRate();
+    }
+    if (deviceSettingsKeys.contains("log2HardDecim")) {
+        settings.m_log2HardDecim = swgSettings->getLog2HardDecim();
+    }
+    if (deviceSettingsKeys.contains("rxCenterFrequency")) {
+        settings.m_rxCenterFrequency = swgSettings->getRxCenterFrequency();
+    }
+    if (deviceSettingsKeys.contains("log2SoftDecim")) {
+        settings.m_log2SoftDecim = swgSettings->getLog2SoftDecim();
+    }
+    if (deviceSettingsKeys.contains("fcPosRx")) {
+        int fcPos = swgSettings->getFcPosRx();
+        fcPos = fcPos < 0 ? 0 : fcPos > 2 ? 2 : fcPos;
+        settings.m_fcPosRx = (XTRXMIMOSettings::fcPos_t) fcPos;
+    }
+    if (deviceSettingsKeys.contains("lpfBW")) {
+        settings.m_lpfBW = swgSettings->getLpfBw();
+    }
+    if (deviceSettingsKeys.contains("antennaPath")) {
+        settings.m_antennaPath = (xtrx_antenna_t) swgSettings->getAntennaPath();
+    }
+    if (deviceSettingsKeys.contains("rx0Gain")) {
+        settings.m_rx0Gain = swgSettings->getRx0Gain();
+    }
+    if (deviceSettingsKeys.contains("rx1Gain")) {
+        settings.m_rx1Gain = swgSettings->getRx1Gain();
+    }
+    if (deviceSettingsKeys.contains("extClock")) {
+        settings.m_extClock = swgSettings->getExtClock() != 0;
+    }
+    if (deviceSettingsKeys.contains("extClockFreq")) {
+        settings.m_extClockFreq = swgSettings->getExtClockFreq();
+    }
+    if (deviceSettingsKeys.contains("pwrmode")) {
+        settings.m_pwrmode = swgSettings->getPwrmode();
+    }
+    if (deviceSettingsKeys.contains("dcBlock")) {
+        settings.m_dcBlock = swgSettings->getDcBlock() != 0;
+    }
+    if (deviceSettingsKeys.contains("iqCorrection")) {
+        settings.m_iqCorrection = swgSettings->getIqCorrection() != 0;
+    }
+    if (deviceSettingsKeys.contains("iqOrder")) {
+        settings.m_iqOrder = swgSettings->getIqOrder() != 0;
+    }
+    if (deviceSettingsKeys.contains("spectrumStreamIndex")) {
+        unsigned int index = swgSettings->getSpectrumStreamIndex();
+        settings.m_spectrumStreamIndex = index < m_nbRxStreams ? index : m_nbRxStreams - 1;
+    }
+}
+
+void XTRXMIMO::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const XTRXMIMOSettings& settings)
+{
+    SWGSDRangel::SWGXtrxMIMOSettings *swgSettings = response.getXtrxMimoSettings();
+    swgSettings->setDevSampleRate(settings.m_devSampleRate);
+    swgSettings->setLog2HardDecim(settings.m_log2HardDecim);
+    swgSettings->setRxCenterFrequency(settings.m_rxCenterFrequency);
+    swgSettings->setLog2SoftDecim(settings.m_log2SoftDecim);
+    swgSettings->setFcPosRx((int) settings.m_fcPosRx);
+    swgSettings->setLpfBw(settings.m_lpfBW);
+    swgSettings->setAntennaPath((int) settings.m_antennaPath);
+    swgSettings->setRx0Gain(settings.m_rx0Gain);
+    swgSettings->setRx1Gain(settings.m_rx1Gain);
+    swgSettings->setExtClock(settings.m_extClock ? 1 : 0);
+    swgSettings->setExtClockFreq(settings.m_extClockFreq);
+    swgSettings->setPwrmode(settings.m_pwrmode);
+    swgSettings->setDcBlock(settings.m_dcBlock ? 1 : 0);
+    swgSettings->setIqCorrection(settings.m_iqCorrection ? 1 : 0);
+    swgSettings->setIqOrder(settings.m_iqOrder ? 1 : 0);
+    swgSettings->setSpectrumStreamIndex(settings.m_spectrumStreamIndex);
+}
@@ -0,0 +1,372 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+#include <QMessageBox>
+
+#include "ui_xtrxmimogui.h"
+#include "gui/colormapper.h"
+#include "gui/glspectrum.h"
+#include "dsp/dspcommands.h"
+#include "device/deviceapi.h"
+#include "device/deviceuiset.h"
+
+#include "xtrxmimogui.h"
+
+XTRXMIMOGui::XTRXMIMOGui(DeviceUISet *deviceUISet, QWidget* parent) :
+    QWidget(parent),
+    ui(new Ui::XTRXMIMOGui),
+    m_deviceUISet(deviceUISet),
+    m_settings(),
+    m_doApplySettings(true),
+    m_forceSettings(true),
+    m_sampleMIMO(nullptr),
+    m_deviceSampleRate(5000000),
+    m_deviceCenterFrequency(0),
+    m_lastEngineState(DeviceAPI::StNotStarted)
+{
+    qDebug("XTRXMIMOGui::XTRXMIMOGui");
+    m_sampleMIMO = (XTRXMIMO*) m_deviceUISet->m_deviceAPI->getSampleMIMO();
+    float minF, maxF, stepF;
+
+    ui->setupUi(this);
+
+    m_sampleMIMO->getRxFrequencyRange(minF, maxF, stepF);
+    ui->centerFrequency->setColorMapper(ColorMapper(ColorMapper::GrayGold));
+    ui->centerFrequency->setValueRange(7, ((uint32_t) minF)/1000, ((uint32_t) maxF)/1000);
+
+    m_sampleMIMO->getRxSampleRateRange(minF, maxF, stepF);
+    ui->sampleRate->setColorMapper(ColorMapper(ColorMapper::GrayGreenYellow));
+    ui->sampleRate->setValueRange(8, (uint32_t) minF, (uint32_t) maxF);
+
+    m_sampleMIMO->getRxLPFRange(minF, maxF, stepF);
+    ui->lpf->setColorMapper(ColorMapper(ColorMapper::GrayYellow));
+    ui->lpf->setValueRange(6, (minF/1000)+1, maxF/1000);
+
+    displaySettings();
+
+    connect(&m_updateTimer, SIGNAL(timeout()), this, SLOT(updateHardware()));
+    connect(&m_statusTimer, SIGNAL(timeout()), this, SLOT(updateStatus()));
+    m_statusTimer.start(500);
+
+    connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()), Qt::QueuedConnection);
+    m_sampleMIMO->setMessageQueueToGUI(&m_inputMessageQueue);
+
+    sendSettings();
+}
+
+XTRXMIMOGui::~XTRXMIMOGui()
+{
+    delete ui;
+}
+
+void XTRXMIMOGui::destroy()
+{
+    delete this;
+}
+
+void XTRXMIMOGui::setName(const QString& name)
+{
+    setObjectName(name);
+}
+
+QString XTRXMIMOGui::getName() const
+{
+    return objectName();
+}
+
+void XTRXMIMOGui::resetToDefaults()
+{
+    m_settings.resetToDefaults();
+    displaySettings();
+    sendSettings();
+}
+
+qint64 XTRXMIMOGui::getCenterFrequency() const
+{
+    return m_settings.m_rxCenterFrequency;
+}
+
+void XTRXMIMOGui::setCenterFrequency(qint64 centerFrequency)
+{
+    m_settings.m_rxCenterFrequency = centerFrequency;
+    displaySettings();
+    sendSettings();
+}
+
+QByteArray XTRXMIMOGui::serialize() const
+{
+    return m_settings.serialize();
+}
+
+bool XTRXMIMOGui::deserialize(const QByteArray& data)
+{
+    if (m_settings.deserialize(data))
+    {
+        displaySettings();
+        m_forceSettings = true;
+        sendSettings();
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
+
+void XTRXMIMOGui::on_startStop_toggled(bool checked)
+{
+    if (m_doApplySettings)
+    {
+        XTRXMIMO::MsgStartStop *message = XTRXMIMO::MsgStartStop::create(checked);
+        m_sampleMIMO->getInputMessageQueue()->push(message);
+    }
+}
+
+void XTRXMIMOGui::on_centerFrequency_changed(quint64 value)
+{
+    m_settings.m_rxCenterFrequency = value * 1000;
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_dcOffset_toggled(bool checked)
+{
+    m_settings.m_dcBlock = checked;
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_iqImbalance_toggled(bool checked)
+{
+    m_settings.m_iqCorrection = checked;
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_extClock_clicked()
+{
+    m_settings.m_extClock = ui->extClock->getExternalClockActive();
+    m_settings.m_extClockFreq = ui->extClock->getExternalClockFrequency();
+    qDebug("XTRXMIMOGui::on_extClock_clicked: %u Hz %s", m_settings.m_extClockFreq, m_settings.m_extClock ? "on" : "off");
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_pwrmode_currentIndexChanged(int index)
+{
+    m_settings.m_pwrmode = index < 0 ? 0 : index;
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_sampleRate_changed(quint64 value)
+{
+    m_settings.m_devSampleRate = value;
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_hwDecim_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index > 6)) {
+        return;
+    }
+
+    m_settings.m_log2HardDecim = index;
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_swDecim_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index > 6)) {
+        return;
+    }
+
+    m_settings.m_log2SoftDecim = index;
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_fcPos_currentIndexChanged(int index)
+{
+    m_settings.m_fcPosRx = (XTRXMIMOSettings::fcPos_t) (index < 0 ? 0 : index > 2 ? 2 : index);
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_lpf_changed(quint64 value)
+{
+    m_settings.m_lpfBW = value * 1000;
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_antenna_currentIndexChanged(int index)
+{
+    m_settings.m_antennaPath = (xtrx_antenna_t) (index < 0 ? 0 : index);
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_spectrumSource_currentIndexChanged(int index)
+{
+    if ((index < 0) || (index >= (int) XTRXMIMO::m_nbRxStreams)) {
+        return;
+    }
+
+    m_settings.m_spectrumStreamIndex = index;
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_rx0Gain_valueChanged(int value)
+{
+    ui->rx0GainText->setText(tr("%1").arg(value));
+    m_settings.m_rx0Gain = value;
+    sendSettings();
+}
+
+void XTRXMIMOGui::on_rx1Gain_valueChanged(int value)
+{
+    ui->rx1GainText->setText(tr("%1").arg(value));
+    m_settings.m_rx1Gain = value;
+    sendSettings();
+}
+
+void XTRXMIMOGui::displaySettings()
+{
+    blockApplySettings(true);
+    ui->centerFrequency->setValue(m_settings.m_rxCenterFrequency / 1000);
+    ui->dcOffset->setChecked(m_settings.m_dcBlock);
+    ui->iqImbalance->setChecked(m_settings.m_iqCorrection);
+    ui->extClock->setExternalClockFrequency(m_settings.m_extClockFreq);
+    ui->extClock->setExternalClockActive(m_settings.m_extClock);
+    ui->pwrmode->setCurrentIndex(m_settings.m_pwrmode);
+    ui->sampleRate->setValue(m_settings.m_devSampleRate);
+    ui->hwDecim->setCurrentIndex(m_settings.m_log2HardDecim);
+    ui->swDecim->setCurrentIndex(m_settings.m_log2SoftDecim);
+    ui->fcPos->setCurrentIndex((int) m_settings.m_fcPosRx);
+    ui->lpf->setValue(m_settings.m_lpfBW / 1000);
+    ui->antenna->setCurrentIndex((int) m_settings.m_antennaPath);
+    ui->spectrumSource->setCurrentIndex(m_settings.m_spectrumStreamIndex);
+    ui->rx0Gain->setValue(m_settings.m_rx0Gain);
+    ui->rx0GainText->setText(tr("%1").arg(m_settings.m_rx0Gain));
+    ui->rx1Gain->setValue(m_settings.m_rx1Gain);
+    ui->rx1GainText->setText(tr("%1").arg(m_settings.m_rx1Gain));
+    blockApplySettings(false);
+}
+
+void XTRXMIMOGui::sendSettings()
+{
+    if (!m_updateTimer.isActive()) {
+        m_updateTimer.start(100);
+    }
+}
+
+void XTRXMIMOGui::updateHardware()
+{
+    if (m_doApplySettings)
+    {
+        XTRXMIMO::MsgConfigureXTRXMIMO* message = XTRXMIMO::MsgConfigureXTRXMIMO::create(m_settings, m_forceSettings);
+        m_sampleMIMO->getInputMessageQueue()->push(message);
+        m_forceSettings = false;
+        m_updateTimer.stop();
+    }
+}
+void XTRXMIMOGui::updateStatus()
+{
+    int state = m_deviceUISet->m_deviceAPI->state(0);
+
+    if (m_lastEngineState != state)
+    {
+        switch(state)
+        {
+            case DeviceAPI::StNotStarted:
+                ui->startStop->setStyleSheet("QToolButton { background:rgb(79,79,79); }");
+                break;
+            case DeviceAPI::StIdle:
+                ui->startStop->setStyleSheet("QToolButton { background-color : blue; }");
+                break;
+            case DeviceAPI::StRunning:
+                ui->startStop->setStyleSheet("QToolButton { background-color : green; }");
+                break;
+            case DeviceAPI::StError:
+                ui->startStop->setStyleSheet("QToolButton { background-color : red; }");
+                QMessageBox::information(this, tr("Message"), m_deviceUISet->m_deviceAPI->errorMessage(0));
+                break;
+            default:
+                break;
+        }
+
+        m_lastEngineState = state;
+    }
+}
+
+bool XTRXMIMOGui::handleMessage(const Message& message)
+{
+    if (XTRXMIMO::MsgConfigureXTRXMIMO::match(message))
+    {
+        qDebug("XTRXMIMOGui::handleMessage: MsgConfigureXTRXMIMO");
+        const XTRXMIMO::MsgConfigureXTRXMIMO& cfg = (XTRXMIMO::MsgConfigureXTRXMIMO&) message;
+        m_settings = cfg.getSettings();
+        displaySettings();
+        return true;
+    }
+    else if (XTRXMIMO::MsgStartStop::match(message))
+    {
+        qDebug("XTRXMIMOGui::handleMessage: MsgStartStop");
+        XTRXMIMO::MsgStartStop& notif = (XTRXMIMO::MsgStartStop&) message;
+        blockApplySettings(true);
+        ui->startStop->setChecked(notif.getStartStop());
+        blockApplySettings(false);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+void XTRXMIMOGui::handleInputMessages()
+{
+    Message* message;
+
+    while ((message = m_inputMessageQueue.pop()) != 0)
+    {
+        if (DSPMIMOSignalNotification::match(*message))
+        {
+            DSPMIMOSignalNotification* notif = (DSPMIMOSignalNotification*) message;
+
+            // both channels share the same rate and frequency
+            if (notif->getSourceOrSink() && (notif->getIndex() == 0))
+            {
+                m_deviceSampleRate = notif->getSampleRate();
+                m_deviceCenterFrequency = notif->getCenterFrequency();
+                qDebug("XTRXMIMOGui::handleInputMessages: DSPMIMOSignalNotification: SampleRate:%d, CenterFrequency:%llu",
+                        notif->getSampleRate(),
+                        notif->getCenterFrequency());
+                updateSampleRateAndFrequency();
+            }
+
+            delete message;
+        }
+        else
+        {
+            if (handleMessage(*message)) {
+                delete message;
+            }
+        }
+    }
+}
+
+void XTRXMIMOGui::updateSampleRateAndFrequency()
+{
+    m_deviceUISet->getSpectrum()->setSampleRate(m_deviceSampleRate);
+    m_deviceUISet->getSpectrum()->setCenterFrequency(m_deviceCenterFrequency);
+    ui->deviceRateText->setText(tr("%1k").arg((float)m_deviceSampleRate / 1000));
+}
@@ -0,0 +1,144 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QtPlugin>
+
+#include "plugin/pluginapi.h"
+#include "util/simpleserializer.h"
+#include "xtrx/devicextrx.h"
+
+#ifdef SERVER_MODE
+#include "xtrxmimo.h"
+#else
+#include "xtrxmimogui.h"
+#endif
+#include "xtrxmimoplugin.h"
+#include "xtrxmimowebapiadapter.h"
+
+const PluginDescriptor XTRXMIMOPlugin::m_pluginDescriptor = {
+    QString("XTRXMIMO"),
+	QString("XTRX MIMO"),
+	QString("4.15.0"),
+	QString("(c) Edouard Griffiths, F4EXB"),
+	QString("https://github.com/f4exb/sdrangel"),
+	true,
+	QString("https://github.com/f4exb/sdrangel")
+};
+
+const QString XTRXMIMOPlugin::m_hardwareID = "XTRX";
+const QString XTRXMIMOPlugin::m_deviceTypeID = XTRXMIMO_DEVICE_TYPE_ID;
+
+XTRXMIMOPlugin::XTRXMIMOPlugin(QObject* parent) :
+	QObject(parent)
+{
+}
+
+const PluginDescriptor& XTRXMIMOPlugin::getPluginDescriptor() const
+{
+	return m_pluginDescriptor;
+}
+
+void XTRXMIMOPlugin::initPlugin(PluginAPI* pluginAPI)
+{
+	pluginAPI->registerSampleMIMO(m_deviceTypeID, this);
+}
+
+void XTRXMIMOPlugin::enumOriginDevices(QStringList& listedHwIds, OriginDevices& originDevices)
+{
+    if (listedHwIds.contains(m_hardwareID)) { // check if it was done
+        return;
+    }
+
+    DeviceXTRX::enumOriginDevices(m_hardwareID, originDevices);
+    listedHwIds.append(m_hardwareID);
+}
+
+PluginInterface::SamplingDevices XTRXMIMOPlugin::enumSampleMIMO(const OriginDevices& originDevices)
+{
+	SamplingDevices result;
+
+	for (OriginDevices::const_iterator it = originDevices.begin(); it != originDevices.end(); ++it)
+    {
+        // only devices with both Rx channels can be used as MIMO
+        if ((it->hardwareId == m_hardwareID) && (it->nbRxStreams >= (int) XTRXMIMO::m_nbRxStreams))
+        {
+            QString displayedName = it->displayableName;
+            displayedName.replace(QString("$1]"), QString("MI]"));
+            result.append(SamplingDevice(
+                displayedName,
+                m_hardwareID,
+                m_deviceTypeID,
+                it->serial,
+                it->sequence,
+                PluginInterface::SamplingDevice::PhysicalDevice,
+                PluginInterface::SamplingDevice::StreamMIMO,
+                XTRXMIMO::m_nbRxStreams, // nb Rx
+                0  // nb Tx
+            ));
+        }
+    }
+
+	return result;
+}
+
+#ifdef SERVER_MODE
+PluginInstanceGUI* XTRXMIMOPlugin::createSampleMIMOPluginInstanceGUI(
+        const QString& mimoId,
+        QWidget **widget,
+        DeviceUISet *deviceUISet)
+{
+    (void) mimoId;
+    (void) widget;
+    (void) deviceUISet;
+    return nullptr;
+}
+#else
+PluginInstanceGUI* XTRXMIMOPlugin::createSampleMIMOPluginInstanceGUI(
+        const QString& mimoId,
+        QWidget **widget,
+        DeviceUISet *deviceUISet)
+{
+	if (mimoId == m_deviceTypeID)
+    {
+		XTRXMIMOGui* gui = new XTRXMIMOGui(deviceUISet);
+		*widget = gui;
+		return gui;
+	}
+    else
+    {
+		return nullptr;
+	}
+}
+#endif
+
+DeviceSampleMIMO *XTRXMIMOPlugin::createSampleMIMOPluginInstance(const QString& mimoId, DeviceAPI *deviceAPI)
+{
+    if (mimoId == m_deviceTypeID)
+    {
+        XTRXMIMO* input = new XTRXMIMO(deviceAPI);
+        return input;
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+DeviceWebAPIAdapter *XTRXMIMOPlugin::createDeviceWebAPIAdapter() const
+{
+    return new XTRXMIMOWebAPIAdapter();
+}
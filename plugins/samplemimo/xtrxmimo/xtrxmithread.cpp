@@ -0,0 +1,263 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <thread>
+
+#include "xtrx_api.h"
+
+#include "xtrx/devicextrx.h"
+#include "dsp/samplemififo.h"
+
+#include "xtrxmithread.h"
+
+XTRXMIThread::XTRXMIThread(struct xtrx_dev* dev, QObject* parent) :
+    QThread(parent),
+    m_running(false),
+    m_dev(dev),
+    m_sampleFifo(nullptr),
+    m_log2Decim(0),
+    m_fcPos(0),
+    m_iqOrder(true)
+{
+    qDebug("XTRXMIThread::XTRXMIThread");
+
+    for (unsigned int i = 0; i < m_nbChannels; i++)
+    {
+        m_convertBuffer[i].resize(DeviceXTRX::blockSize, Sample{0,0});
+        m_buf[i] = new qint16[2*DeviceXTRX::blockSize];
+    }
+}
+
+XTRXMIThread::~XTRXMIThread()
+{
+    qDebug("XTRXMIThread::~XTRXMIThread");
+
+    if (m_running) {
+        stopWork();
+    }
+
+    for (unsigned int i = 0; i < m_nbChannels; i++) {
+        delete[] m_buf[i];
+    }
+}
+
+void XTRXMIThread::startWork()
+{
+    m_startWaitMutex.lock();
+    start();
+
+    while(!m_running) {
+        m_startWaiter.wait(&m_startWaitMutex, 100);
+    }
+
+    m_startWaitMutex.unlock();
+}
+
+void XTRXMIThread::stopWork()
+{
+    m_running = false;
+    wait();
+}
+
+void XTRXMIThread::run()
+{
+    int res;
+
+    m_running = true;
+    m_startWaiter.wakeAll();
+
+    if (!m_sampleFifo)
+    {
+        qWarning("XTRXMIThread::run: no FIFO allocated. Aborting");
+        m_running = false;
+        return;
+    }
+
+    xtrx_run_params params;
+    xtrx_run_params_init(&params);
+
+    params.dir = XTRX_RX;
+    params.rx.chs = XTRX_CH_AB;
+    params.rx.wfmt = XTRX_WF_16;
+    params.rx.hfmt = XTRX_IQ_INT16;
+    params.rx_stream_start = 2*DeviceXTRX::blockSize;
+    params.rx.paketsize = 2*DeviceXTRX::blockSize;
+
+    res = xtrx_run_ex(m_dev, &params);
+
+    if (res != 0)
+    {
+        qCritical("XTRXMIThread::run: could not start stream err:%d", res);
+        m_running = false;
+        return;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    qDebug("XTRXMIThread::run: stream started");
+
+    void *buffs[m_nbChannels] = {m_buf[0], m_buf[1]};
+    xtrx_recv_ex_info_t nfo;
+    nfo.samples = DeviceXTRX::blockSize;
+    nfo.buffer_count = m_nbChannels;
+    nfo.buffers = (void* const*) buffs;
+    nfo.flags = RCVEX_DONT_INSER_ZEROS | RCVEX_DROP_OLD_ON_OVERFLOW;
+
+    while (m_running)
+    {
+        res = xtrx_recv_sync_ex(m_dev, &nfo);
+
+        if (res < 0)
+        {
+            qCritical("XTRXMIThread::run read error: %d", res);
+            qDebug("XTRXMIThread::run: out_samples: %u out_events: %u", nfo.out_samples, nfo.out_events);
+            break;
+        }
+
+        if (nfo.out_events & RCVEX_EVENT_OVERFLOW) {
+            qDebug("XTRXMIThread::run: overflow");
+        }
+
+        callback(nfo.out_samples);
+    }
+
+    res = xtrx_stop(m_dev, XTRX_RX);
+
+    if (res != 0)
+    {
+        qCritical("XTRXMIThread::run: could not stop stream");
+    }
+    else
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        qDebug("XTRXMIThread::run: stream stopped");
+    }
+
+    m_running = false;
+}
+
+void XTRXMIThread::callback(qint32 samplesPerChannel)
+{
+    std::vector<SampleVector::const_iterator> vbegin;
+    int nbDecimatedSamples = 0;
+
+    for (unsigned int channel = 0; channel < m_nbChannels; channel++)
+    {
+        SampleVector::iterator it = m_convertBuffer[channel].begin();
+
+        if (m_iqOrder) {
+            decimate(m_decimatorsIQ[channel], &it, m_buf[channel], 2*samplesPerChannel);
+        } else {
+            decimate(m_decimatorsQI[channel], &it, m_buf[channel], 2*samplesPerChannel);
+        }
+
+        vbegin.push_back(m_convertBuffer[channel].begin());
+        nbDecimatedSamples = it - m_convertBuffer[channel].begin(); // same for all channels
+    }
+
+    m_sampleFifo->writeSync(vbegin, nbDecimatedSamples);
+}
+
+template<class DecimatorsType>
+void XTRXMIThread::decimate(DecimatorsType& decimators, SampleVector::iterator* it, const qint16* buf, qint32 len)
+{
+    if (m_log2Decim == 0)
+    {
+        decimators.decimate1(it, buf, len);
+    }
+    else
+    {
+        if (m_fcPos == 0) // Infra
+        {
+            switch (m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_inf(it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_inf(it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_inf(it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_inf(it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_inf(it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_inf(it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_fcPos == 1) // Supra
+        {
+            switch (m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_sup(it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_sup(it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_sup(it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_sup(it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_sup(it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_sup(it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+        else if (m_fcPos == 2) // Center
+        {
+            switch (m_log2Decim)
+            {
+            case 1:
+                decimators.decimate2_cen(it, buf, len);
+                break;
+            case 2:
+                decimators.decimate4_cen(it, buf, len);
+                break;
+            case 3:
+                decimators.decimate8_cen(it, buf, len);
+                break;
+            case 4:
+                decimators.decimate16_cen(it, buf, len);
+                break;
+            case 5:
+                decimators.decimate32_cen(it, buf, len);
+                break;
+            case 6:
+                decimators.decimate64_cen(it, buf, len);
+                break;
+            default:
+                break;
+            }
+        }
+    }
+}
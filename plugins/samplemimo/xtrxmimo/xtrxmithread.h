@@ -0,0 +1,75 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef PLUGINS_SAMPLEMIMO_XTRXMIMO_XTRXMITHREAD_H_
+#define PLUGINS_SAMPLEMIMO_XTRXMIMO_XTRXMITHREAD_H_
+
+// Reads both Rx channels of the XTRX in a single MIMO stream and writes them synchronously
+// to the multiple input FIFO so that the channel samples stay aligned down to the MIMO engine.
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+
+#include "dsp/decimators.h"
+
+class SampleMIFifo;
+struct xtrx_dev;
+
+class XTRXMIThread : public QThread {
+    Q_OBJECT
+
+public:
+    XTRXMIThread(struct xtrx_dev* dev, QObject* parent = nullptr);
+    ~XTRXMIThread();
+
+    void startWork();
+    void stopWork();
+    bool isRunning() const { return m_running; }
+    void setLog2Decimation(unsigned int log2Decim) { m_log2Decim = log2Decim; }
+    unsigned int getLog2Decimation() const { return m_log2Decim; }
+    void setFcPos(int fcPos) { m_fcPos = fcPos; }
+    int getFcPos() const { return m_fcPos; }
+    void setFifo(SampleMIFifo *sampleFifo) { m_sampleFifo = sampleFifo; }
+    SampleMIFifo *getFifo() { return m_sampleFifo; }
+    void setIQOrder(bool iqOrder) { m_iqOrder = iqOrder; }
+
+    static const unsigned int m_nbChannels = 2;
+
+private:
+    QMutex m_startWaitMutex;
+    QWaitCondition m_startWaiter;
+    bool m_running;
+    struct xtrx_dev* m_dev;
+
+    qint16 *m_buf[m_nbChannels]; //!< One buffer per channel
+    SampleVector m_convertBuffer[m_nbChannels];
+    SampleMIFifo* m_sampleFifo;
+    Decimators<qint32, qint16, SDR_RX_SAMP_SZ, 12, true> m_decimatorsIQ[m_nbChannels];
+    Decimators<qint32, qint16, SDR_RX_SAMP_SZ, 12, false> m_decimatorsQI[m_nbChannels];
+    unsigned int m_log2Decim;
+    int m_fcPos;
+    bool m_iqOrder;
+
+    void run();
+    void callback(qint32 samplesPerChannel);
+
+    template<class DecimatorsType>
+    void decimate(DecimatorsType& decimators, SampleVector::iterator* it, const qint16* buf, qint32 len);
+};
+
+#endif /* PLUGINS_SAMPLEMIMO_XTRXMIMO_XTRXMITHREAD_H_ */
@@ -53,6 +53,7 @@ AirspyInput::AirspyInput(DeviceAPI *deviceAPI) :
 {
     openDevice();
     m_deviceAPI->setNbSourceStreams(1);
+    DSPEngine::instance()->applyThreadPriorityOnStart(&m_airspyWorkerThread, m_deviceAPI, ThreadPriority::RoleWorker);
 
     m_networkManager = new QNetworkAccessManager();
     connect(m_networkManager, SIGNAL(finished(QNetworkReply*)), this, SLOT(networkManagerFinished(QNetworkReply*)));
@@ -62,6 +62,7 @@ FileInput::FileInput(DeviceAPI *deviceAPI) :
     m_startingTimeStamp(0)
 {
     m_deviceAPI->setNbSourceStreams(1);
+    DSPEngine::instance()->applyThreadPriorityOnStart(&m_fileInputWorkerThread, m_deviceAPI, ThreadPriority::RoleWorker);
     qDebug("FileInput::FileInput: device source engine: %p", m_deviceAPI->getDeviceSourceEngine());
     qDebug("FileInput::FileInput: device source engine message queue: %p", m_deviceAPI->getDeviceEngineInputMessageQueue());
     qDebug("FileInput::FileInput: device source: %p", m_deviceAPI->getDeviceSourceEngine()->getSource());
@@ -0,0 +1,349 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <algorithm>
+
+#include <QMutexLocker>
+
+#include "dsp/samplesinkfifo.h"
+#include "kiwisdraggregator.h"
+
+KiwiSDRAggregator::KiwiSDRAggregator(SampleSinkFifo *sampleFifo, unsigned int nbSessions) :
+    m_sampleFifo(sampleFifo),
+    m_sessions(std::max(1U, std::min(nbSessions, m_maxSessions))),
+    m_aligned(false),
+    m_gpsAligned(false),
+    m_outPosition(0),
+    m_lostSamples(0),
+    m_lateSamples(0)
+{
+    unsigned int interpolation = m_sessions.size();
+    int outputRate = getSampleRate(interpolation);
+
+    // Blackman windowed sinc at the output rate with the gain of the interpolation
+    unsigned int nbTaps = m_tapsPerPhase * interpolation;
+    double fc = (m_tileSpacing / 2.0) / outputRate;
+    std::vector<float> taps(nbTaps);
+
+    for (unsigned int i = 0; i < nbTaps; i++)
+    {
+        double x = i - (nbTaps - 1) / 2.0;
+        double sinc = x == 0.0 ? 2.0 * fc : sin(2.0 * M_PI * fc * x) / (M_PI * x);
+        double window = 0.42 - 0.5 * cos(2.0 * M_PI * i / (nbTaps - 1)) + 0.08 * cos(4.0 * M_PI * i / (nbTaps - 1));
+        taps[i] = interpolation * sinc * window;
+    }
+
+    m_phases.resize(interpolation);
+
+    for (unsigned int p = 0; p < interpolation; p++)
+    {
+        m_phases[p].resize(m_tapsPerPhase);
+
+        for (unsigned int k = 0; k < m_tapsPerPhase; k++) {
+            m_phases[p][k] = taps[p + k*interpolation];
+        }
+    }
+
+    for (unsigned int i = 0; i < m_sessions.size(); i++)
+    {
+        m_sessions[i].m_history.assign(2*m_tapsPerPhase, Complex{0.0f, 0.0f});
+        m_sessions[i].m_nco.setFreq(getFrequencyOffset(i), outputRate);
+    }
+}
+
+int KiwiSDRAggregator::getFrequencyOffset(unsigned int sessionIndex, unsigned int nbSessions)
+{
+    return (((int) (2*sessionIndex) - (int) (nbSessions - 1)) * m_tileSpacing) / 2;
+}
+
+void KiwiSDRAggregator::pushFrame(unsigned int sessionIndex, const Frame& frame)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if ((sessionIndex >= m_sessions.size()) || (frame.m_samples.size() == 0)) {
+        return;
+    }
+
+    Session& session = m_sessions[sessionIndex];
+
+    if (!session.m_started) {
+        startSession(session, frame);
+    }
+
+    qint64 position = (qint64) (quint32) (frame.m_sequence - session.m_sequenceBase) * session.m_frameSize;
+
+    if (position > session.getBufferEnd() + m_maxGap) // long outage or the server has restarted its stream
+    {
+        qDebug("KiwiSDRAggregator::pushFrame: restart session %u", sessionIndex);
+        startSession(session, frame);
+        position = 0;
+    }
+
+    qint64 bufferEnd = session.getBufferEnd();
+    int skip = 0;
+
+    if (position < bufferEnd) // late frame or already filled with zeros
+    {
+        skip = std::min(bufferEnd - position, (qint64) frame.m_samples.size());
+        m_lateSamples += skip;
+    }
+    else if (position > bufferEnd) // lost frames
+    {
+        session.m_buffer.insert(session.m_buffer.end(), position - bufferEnd, Complex{0.0f, 0.0f});
+        m_lostSamples += position - bufferEnd;
+    }
+
+    session.m_buffer.insert(session.m_buffer.end(), frame.m_samples.begin() + skip, frame.m_samples.end());
+    session.m_gpsValid = frame.m_gpsValid;
+    session.m_gpsTime = frame.m_gpsTime;
+    session.m_gpsPosition = position;
+
+    if (!m_aligned) {
+        align();
+    } else if (!session.m_placed) {
+        place(session);
+    }
+
+    if (m_aligned) {
+        produce();
+    }
+}
+
+void KiwiSDRAggregator::startSession(Session& session, const Frame& frame)
+{
+    session.m_started = true;
+    session.m_placed = false;
+    session.m_sequenceBase = frame.m_sequence;
+    session.m_frameSize = frame.m_samples.size();
+    session.m_bufferStart = 0;
+    session.m_buffer.clear();
+}
+
+void KiwiSDRAggregator::align()
+{
+    bool allStarted = true;
+    bool waitedEnough = false;
+
+    for (const auto& session : m_sessions)
+    {
+        allStarted = allStarted && session.m_started;
+        waitedEnough = waitedEnough || (session.m_buffer.size() >= (unsigned int) m_maxLag);
+    }
+
+    if (!allStarted && !waitedEnough) {
+        return;
+    }
+
+    // GPS alignment if all started sessions report GPS times close enough to be consistent
+    bool gpsValid = true;
+    double gpsTimeMin = 0.0, gpsTimeMax = 0.0;
+    bool first = true;
+
+    for (const auto& session : m_sessions)
+    {
+        if (!session.m_started) {
+            continue;
+        }
+
+        gpsValid = gpsValid && session.m_gpsValid;
+        gpsTimeMin = first ? session.m_gpsTime : std::min(gpsTimeMin, session.m_gpsTime);
+        gpsTimeMax = first ? session.m_gpsTime : std::max(gpsTimeMax, session.m_gpsTime);
+        first = false;
+    }
+
+    m_gpsAligned = gpsValid && (gpsTimeMax - gpsTimeMin < 1.0);
+    bool firstHead = true;
+
+    for (auto& session : m_sessions)
+    {
+        if (!session.m_started) {
+            continue;
+        }
+
+        if (m_gpsAligned) {
+            session.m_offset = llround((session.m_gpsTime - gpsTimeMax) * m_sessionSampleRate) - session.m_gpsPosition;
+        } else {
+            session.m_offset = -session.getBufferEnd(); // the last samples arrived at the same time
+        }
+
+        qint64 head = session.m_bufferStart + session.m_offset;
+        m_outPosition = firstHead ? head : std::max(m_outPosition, head);
+        firstHead = false;
+    }
+
+    for (auto& session : m_sessions)
+    {
+        if (session.m_started) {
+            place(session);
+        }
+    }
+
+    m_aligned = true;
+    qDebug("KiwiSDRAggregator::align: sessions aligned on %s", m_gpsAligned ? "GPS time" : "arrival time");
+}
+
+void KiwiSDRAggregator::place(Session& session)
+{
+    if (!session.m_placed && m_aligned) // session starting while the others are running
+    {
+        const Session *reference = nullptr;
+        qint64 referenceEnd = m_outPosition;
+
+        for (const auto& other : m_sessions)
+        {
+            if (!other.m_placed) {
+                continue;
+            }
+
+            if (other.m_gpsValid && (!reference)) {
+                reference = &other;
+            }
+
+            referenceEnd = std::max(referenceEnd, other.getBufferEnd() + other.m_offset);
+        }
+
+        if (m_gpsAligned && session.m_gpsValid && reference && (fabs(session.m_gpsTime - reference->m_gpsTime) < 60.0))
+        {
+            session.m_offset = reference->m_gpsPosition + reference->m_offset
+                + llround((session.m_gpsTime - reference->m_gpsTime) * m_sessionSampleRate)
+                - session.m_gpsPosition;
+        }
+        else
+        {
+            session.m_offset = referenceEnd - session.getBufferEnd();
+        }
+    }
+
+    // make the buffer start at the output position
+    qint64 head = session.m_bufferStart + session.m_offset;
+
+    if (head < m_outPosition)
+    {
+        qint64 drop = std::min(m_outPosition - head, (qint64) session.m_buffer.size());
+        session.m_buffer.erase(session.m_buffer.begin(), session.m_buffer.begin() + drop);
+        session.m_bufferStart = m_outPosition - session.m_offset; // frames before are late if the buffer was too short
+    }
+    else if (head > m_outPosition)
+    {
+        session.m_buffer.insert(session.m_buffer.begin(), head - m_outPosition, Complex{0.0f, 0.0f});
+        session.m_bufferStart = m_outPosition - session.m_offset;
+    }
+
+    session.m_placed = true;
+}
+
+void KiwiSDRAggregator::produce()
+{
+    while (true)
+    {
+        int minAvailable = m_maxBlockSize;
+        int maxAvailable = 0;
+
+        for (const auto& session : m_sessions)
+        {
+            if (session.m_placed)
+            {
+                minAvailable = std::min(minAvailable, (int) session.m_buffer.size());
+                maxAvailable = std::max(maxAvailable, (int) session.m_buffer.size());
+            }
+        }
+
+        if (maxAvailable == 0) {
+            return;
+        }
+
+        if (minAvailable < m_blockSize)
+        {
+            if (maxAvailable < m_maxLag) {
+                return;
+            }
+
+            for (auto& session : m_sessions) // fill the starved sessions with zeros
+            {
+                if (session.m_placed && (session.m_buffer.size() < (unsigned int) m_blockSize))
+                {
+                    m_lostSamples += m_blockSize - session.m_buffer.size();
+                    session.m_buffer.resize(m_blockSize, Complex{0.0f, 0.0f});
+                }
+            }
+
+            minAvailable = m_blockSize;
+        }
+
+        mix(minAvailable);
+    }
+}
+
+void KiwiSDRAggregator::mix(int nbSamples)
+{
+    unsigned int interpolation = m_sessions.size();
+    unsigned int nbOutSamples = nbSamples * interpolation;
+    m_mixBuffer.assign(nbOutSamples, Complex{0.0f, 0.0f});
+    m_ncoBuffer.resize(nbOutSamples);
+
+    for (auto& session : m_sessions)
+    {
+        if (!session.m_placed) { // not connected: no contribution
+            continue;
+        }
+
+        session.m_nco.nextIQBlock(m_ncoBuffer.data(), nbOutSamples);
+        Complex *history = session.m_history.data();
+
+        for (int i = 0; i < nbSamples; i++)
+        {
+            session.m_historyIndex = session.m_historyIndex == 0 ? m_tapsPerPhase - 1 : session.m_historyIndex - 1;
+            history[session.m_historyIndex] = session.m_buffer[i];
+            history[session.m_historyIndex + m_tapsPerPhase] = session.m_buffer[i];
+            const Complex *x = &history[session.m_historyIndex];
+
+            for (unsigned int p = 0; p < interpolation; p++)
+            {
+                const float *h = m_phases[p].data();
+                Real re = 0.0f, im = 0.0f;
+
+                for (unsigned int k = 0; k < m_tapsPerPhase; k++)
+                {
+                    re += h[k] * x[k].real();
+                    im += h[k] * x[k].imag();
+                }
+
+                unsigned int j = i*interpolation + p;
+                m_mixBuffer[j] += Complex{re, im} * m_ncoBuffer[j];
+            }
+        }
+
+        session.m_buffer.erase(session.m_buffer.begin(), session.m_buffer.begin() + nbSamples);
+        session.m_bufferStart += nbSamples;
+    }
+
+    m_outPosition += nbSamples;
+    m_samplesBuf.resize(nbOutSamples);
+
+    for (unsigned int j = 0; j < nbOutSamples; j++)
+    {
+        // session samples are 16 bit
+        qint32 re = (qint32) std::max(-32768.0f, std::min(32767.0f, m_mixBuffer[j].real()));
+        qint32 im = (qint32) std::max(-32768.0f, std::min(32767.0f, m_mixBuffer[j].imag()));
+        m_samplesBuf[j].setReal(re << (SDR_RX_SAMP_SZ - 16));
+        m_samplesBuf[j].setImag(im << (SDR_RX_SAMP_SZ - 16));
+    }
+
+    m_sampleFifo->write(m_samplesBuf.begin(), m_samplesBuf.end());
+}
@@ -0,0 +1,132 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _KIWISDR_KIWISDRAGGREGATOR_H_
+#define _KIWISDR_KIWISDRAGGREGATOR_H_
+
+#include <deque>
+#include <vector>
+
+#include <QMutex>
+
+#include "dsp/dsptypes.h"
+#include "dsp/ncof.h"
+
+class SampleSinkFifo;
+
+/**
+ * Combines the I/Q streams of several KiwiSDR sessions into a single wider band. Session i of N
+ * is tuned at (i - (N-1)/2) * m_tileSpacing from the center frequency. Its 12 kS/s stream is
+ * interpolated to N x 12 kS/s with a low pass filter cutting at half the tile spacing and is
+ * shifted to its place in the band. The output covers N x 10 kHz at N x 12 kS/s. Signals within
+ * about 500 Hz of a tile boundary are received by both neighbouring sessions.
+ *
+ * Frames are placed on the timeline of their session from their sequence numbers so that lost
+ * frames are replaced by zeros and late frames are dropped. The sessions are aligned on their
+ * GPS timestamps when they all report a GPS solution or else on the arrival of their first
+ * frames. A session that stays behind the others by more than m_maxLag samples is filled with
+ * zeros so that the other sessions keep streaming.
+ *
+ * Frames are pushed from the threads of the sessions sockets. The output is computed by the
+ * thread pushing the frame that completes a block for all sessions.
+ */
+class KiwiSDRAggregator
+{
+public:
+    struct Frame
+    {
+        quint32 m_sequence;
+        bool m_gpsValid;
+        double m_gpsTime;   //!< GPS time of the first sample in seconds (of the week)
+        std::vector<Complex> m_samples;
+    };
+
+    KiwiSDRAggregator(SampleSinkFifo *sampleFifo, unsigned int nbSessions);
+
+    void pushFrame(unsigned int sessionIndex, const Frame& frame);
+    unsigned int getNbSessions() const { return m_sessions.size(); }
+    int getFrequencyOffset(unsigned int sessionIndex) const { return getFrequencyOffset(sessionIndex, m_sessions.size()); }
+    quint64 getLostSamples() const { return m_lostSamples; }     //!< samples of lost frames or starved sessions replaced by zeros
+    quint64 getLateSamples() const { return m_lateSamples; }     //!< samples of late frames dropped
+
+    static int getFrequencyOffset(unsigned int sessionIndex, unsigned int nbSessions);
+    static int getSampleRate(unsigned int nbSessions) { return m_sessionSampleRate * nbSessions; }
+
+    static const int m_sessionSampleRate = 12000;
+    static const int m_tileSpacing = 10000;
+    static const unsigned int m_maxSessions = 8;
+
+private:
+    struct Session
+    {
+        bool m_started;
+        bool m_placed;              //!< on the common timeline
+        quint32 m_sequenceBase;
+        int m_frameSize;
+        qint64 m_bufferStart;       //!< session position of the first buffered sample
+        std::deque<Complex> m_buffer;
+        qint64 m_offset;            //!< session position to common position
+        bool m_gpsValid;
+        double m_gpsTime;           //!< GPS time of the last frame
+        qint64 m_gpsPosition;       //!< session position of the last frame
+        std::vector<Complex> m_history; //!< interpolator input samples twice for contiguous reads
+        unsigned int m_historyIndex;
+        NCOF m_nco;
+
+        Session() :
+            m_started(false),
+            m_placed(false),
+            m_sequenceBase(0),
+            m_frameSize(0),
+            m_bufferStart(0),
+            m_offset(0),
+            m_gpsValid(false),
+            m_gpsTime(0.0),
+            m_gpsPosition(0),
+            m_historyIndex(0)
+        {}
+
+        qint64 getBufferEnd() const { return m_bufferStart + m_buffer.size(); }
+    };
+
+    SampleSinkFifo *m_sampleFifo;
+    std::vector<Session> m_sessions;
+    std::vector<std::vector<float>> m_phases; //!< polyphase interpolation filter coefficients
+    bool m_aligned;
+    bool m_gpsAligned;
+    qint64 m_outPosition;           //!< common position of the next output sample
+    std::vector<Complex> m_mixBuffer;
+    std::vector<Complex> m_ncoBuffer;
+    SampleVector m_samplesBuf;
+    quint64 m_lostSamples;
+    quint64 m_lateSamples;
+    QMutex m_mutex;
+
+    static const unsigned int m_tapsPerPhase = 64;
+    static const int m_blockSize = 512;             //!< minimum output block in session samples
+    static const int m_maxLag = 6000;               //!< 0.5s of session samples
+    static const int m_maxGap = 60000;              //!< 5s of session samples. Session is restarted beyond.
+    static const int m_maxBlockSize = 8192;
+
+    void startSession(Session& session, const Frame& frame);
+    void align();
+    void place(Session& session);
+    void produce();
+    void mix(int nbSamples);
+};
+
+#endif // _KIWISDR_KIWISDRAGGREGATOR_H_
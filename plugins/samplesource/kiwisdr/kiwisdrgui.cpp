@@ -172,6 +172,12 @@ void KiwiSDRGui::on_dcBlock_toggled(bool checked)
 	sendSettings();
 }
 
+void KiwiSDRGui::on_nbReceivers_valueChanged(int value)
+{
+	m_settings.m_nbReceivers = value;
+	sendSettings();
+}
+
 void KiwiSDRGui::on_agc_toggled(bool checked)
 {
 	m_settings.m_useAGC = checked;
@@ -195,6 +201,7 @@ void KiwiSDRGui::displaySettings()
 	ui->gainText->setText(QString::number(m_settings.m_gain) + " dB");
 	ui->agc->setChecked(m_settings.m_useAGC);
     ui->dcBlock->setChecked(m_settings.m_dcBlock);
+    ui->nbReceivers->setValue(m_settings.m_nbReceivers);
 
     blockApplySettings(false);
 }
@@ -18,6 +18,7 @@
 
 #include <string.h>
 #include <errno.h>
+#include <algorithm>
 
 #include <QDebug>
 #include <QNetworkReply>
@@ -32,6 +33,7 @@
 #include "kiwisdrinput.h"
 #include "device/deviceapi.h"
 #include "kiwisdrworker.h"
+#include "kiwisdraggregator.h"
 #include "dsp/dspcommands.h"
 #include "dsp/dspengine.h"
 
@@ -43,12 +45,12 @@ MESSAGE_CLASS_DEFINITION(KiwiSDRInput::MsgSetStatus, Message)
 KiwiSDRInput::KiwiSDRInput(DeviceAPI *deviceAPI) :
     m_deviceAPI(deviceAPI),
 	m_settings(),
-	m_kiwiSDRWorker(nullptr),
 	m_deviceDescription(),
 	m_running(false),
 	m_masterTimer(deviceAPI->getMasterTimer())
 {
-	m_kiwiSDRWorkerThread.start();
+	m_kiwiSDRWorkerThreads.push_back(new QThread());
+	m_kiwiSDRWorkerThreads.back()->start();
 
     m_deviceAPI->setNbSourceStreams(1);
 
@@ -69,8 +71,12 @@ KiwiSDRInput::~KiwiSDRInput()
         stop();
     }
 
-	m_kiwiSDRWorkerThread.quit();
-	m_kiwiSDRWorkerThread.wait();
+    for (auto thread : m_kiwiSDRWorkerThreads)
+    {
+        thread->quit();
+        thread->wait();
+        delete thread;
+    }
 }
 
 void KiwiSDRInput::destroy()
@@ -89,14 +95,7 @@ bool KiwiSDRInput::start()
 
     if (m_running) stop();
 
-	m_kiwiSDRWorker = new KiwiSDRWorker(&m_sampleFifo);
-	m_kiwiSDRWorker->moveToThread(&m_kiwiSDRWorkerThread);
-
-	connect(this, &KiwiSDRInput::setWorkerCenterFrequency, m_kiwiSDRWorker, &KiwiSDRWorker::onCenterFrequencyChanged);
-	connect(this, &KiwiSDRInput::setWorkerServerAddress, m_kiwiSDRWorker, &KiwiSDRWorker::onServerAddressChanged);
-	connect(this, &KiwiSDRInput::setWorkerGain, m_kiwiSDRWorker, &KiwiSDRWorker::onGainChanged);
-	connect(m_kiwiSDRWorker, &KiwiSDRWorker::updateStatus, this, &KiwiSDRInput::setWorkerStatus);
-
+	startWorkers(m_settings.m_nbReceivers);
 	mutexLocker.unlock();
 
 	applySettings(m_settings, true);
@@ -109,15 +108,52 @@ void KiwiSDRInput::stop()
 {
 	QMutexLocker mutexLocker(&m_mutex);
 
+	stopWorkers();
 	setWorkerStatus(0);
+	m_running = false;
+}
 
-	if (m_kiwiSDRWorker != 0)
-	{
-		m_kiwiSDRWorker->deleteLater();
-		m_kiwiSDRWorker = 0;
-	}
+void KiwiSDRInput::startWorkers(unsigned int nbReceivers)
+{
+    if (nbReceivers <= 1)
+    {
+        m_kiwiSDRWorkers.push_back(new KiwiSDRWorker(&m_sampleFifo));
+    }
+    else
+    {
+        // the sessions decode their frames in their socket thread and the aggregator mixes them in the thread completing a block
+        std::shared_ptr<KiwiSDRAggregator> aggregator(new KiwiSDRAggregator(&m_sampleFifo, nbReceivers));
+        unsigned int nbThreads = std::min(nbReceivers, (unsigned int) std::max(1, QThread::idealThreadCount()));
 
-	m_running = false;
+        while (m_kiwiSDRWorkerThreads.size() < nbThreads)
+        {
+            m_kiwiSDRWorkerThreads.push_back(new QThread());
+            m_kiwiSDRWorkerThreads.back()->start();
+        }
+
+        for (unsigned int i = 0; i < nbReceivers; i++) {
+            m_kiwiSDRWorkers.push_back(new KiwiSDRWorker(aggregator, i));
+        }
+    }
+
+    for (unsigned int i = 0; i < m_kiwiSDRWorkers.size(); i++)
+    {
+        KiwiSDRWorker *worker = m_kiwiSDRWorkers[i];
+        worker->moveToThread(m_kiwiSDRWorkerThreads[i % m_kiwiSDRWorkerThreads.size()]);
+        connect(this, &KiwiSDRInput::setWorkerCenterFrequency, worker, &KiwiSDRWorker::onCenterFrequencyChanged);
+        connect(this, &KiwiSDRInput::setWorkerServerAddress, worker, &KiwiSDRWorker::onServerAddressChanged);
+        connect(this, &KiwiSDRInput::setWorkerGain, worker, &KiwiSDRWorker::onGainChanged);
+        connect(worker, &KiwiSDRWorker::updateStatus, this, &KiwiSDRInput::setWorkerStatus);
+    }
+}
+
+void KiwiSDRInput::stopWorkers()
+{
+    for (auto worker : m_kiwiSDRWorkers) {
+        worker->deleteLater();
+    }
+
+    m_kiwiSDRWorkers.clear();
 }
 
 QByteArray KiwiSDRInput::serialize() const
@@ -154,7 +190,7 @@ const QString& KiwiSDRInput::getDeviceDescription() const
 
 int KiwiSDRInput::getSampleRate() const
 {
-	return 12000;
+	return KiwiSDRAggregator::getSampleRate(m_settings.m_nbReceivers);
 }
 
 quint64 KiwiSDRInput::getCenterFrequency() const
@@ -180,7 +216,7 @@ void KiwiSDRInput::setCenterFrequency(qint64 centerFrequency)
 void KiwiSDRInput::setWorkerStatus(int status)
 {
 	if (m_guiMessageQueue) {
-		m_guiMessageQueue->push(MsgSetStatus::create(status));
+		m_guiMessageQueue->push(MsgSetStatus::create(m_kiwiSDRWorkers.size() > 1 ? getStatus() : status));
     }
 }
 
@@ -231,11 +267,25 @@ bool KiwiSDRInput::handleMessage(const Message& message)
 
 int KiwiSDRInput::getStatus() const
 {
-    if (m_kiwiSDRWorker) {
-        return m_kiwiSDRWorker->getStatus();
-    } else {
+    if (m_kiwiSDRWorkers.size() == 0) {
         return 0;
+    } else if (m_kiwiSDRWorkers.size() == 1) {
+        return m_kiwiSDRWorkers[0]->getStatus();
     }
+
+    // aggregate: worst status of the sessions in the order error, disconnected, connecting, idle, connected
+    bool error = false, disconnected = false, connecting = false, idle = false;
+
+    for (auto worker : m_kiwiSDRWorkers)
+    {
+        int status = worker->getStatus();
+        error = error || (status == 3);
+        disconnected = disconnected || (status == 4);
+        connecting = connecting || (status == 1);
+        idle = idle || (status == 0);
+    }
+
+    return error ? 3 : disconnected ? 4 : connecting ? 1 : idle ? 0 : 2;
 }
 
 bool KiwiSDRInput::applySettings(const KiwiSDRSettings& settings, bool force)
@@ -245,13 +295,31 @@ bool KiwiSDRInput::applySettings(const KiwiSDRSettings& settings, bool force)
         << " m_centerFrequency: " << settings.m_centerFrequency
         << " m_gain: " << settings.m_gain
         << " m_useAGC: " << settings.m_useAGC
-        << " m_useAGC: " << settings.m_useAGC
+        << " m_nbReceivers: " << settings.m_nbReceivers
         << " m_useReverseAPI: " << settings.m_useReverseAPI
         << " m_reverseAPIAddress: " << settings.m_reverseAPIAddress
         << " m_reverseAPIPort: " << settings.m_reverseAPIPort
         << " m_reverseAPIDeviceIndex: " << settings.m_reverseAPIDeviceIndex;
 
     QList<QString> reverseAPIKeys;
+    bool restartWorkers = m_running && (m_settings.m_nbReceivers != settings.m_nbReceivers);
+
+    if (m_settings.m_nbReceivers != settings.m_nbReceivers || force)
+    {
+        reverseAPIKeys.append("nbReceivers");
+
+        if (!m_sampleFifo.setSize(KiwiSDRAggregator::getSampleRate(settings.m_nbReceivers) * 2)) {
+            qCritical("KiwiSDRInput::applySettings: Could not allocate SampleFifo");
+        }
+    }
+
+    if (restartWorkers) // new sessions need all parameters
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        stopWorkers();
+        startWorkers(settings.m_nbReceivers);
+        force = true;
+    }
 
 	if (m_settings.m_serverAddress != settings.m_serverAddress || force)
     {
@@ -278,14 +346,15 @@ bool KiwiSDRInput::applySettings(const KiwiSDRSettings& settings, bool force)
         m_deviceAPI->configureCorrections(settings.m_dcBlock, false);
     }
 
-    if (m_settings.m_centerFrequency != settings.m_centerFrequency || force)
+    if (m_settings.m_centerFrequency != settings.m_centerFrequency
+        || m_settings.m_nbReceivers != settings.m_nbReceivers || force)
     {
         reverseAPIKeys.append("centerFrequency");
 
         emit setWorkerCenterFrequency(settings.m_centerFrequency);
 
 		DSPSignalNotification *notif = new DSPSignalNotification(
-			getSampleRate(), settings.m_centerFrequency);
+			KiwiSDRAggregator::getSampleRate(settings.m_nbReceivers), settings.m_centerFrequency);
 		m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
 	}
 
@@ -385,6 +454,11 @@ void KiwiSDRInput::webapiUpdateDeviceSettings(
     if (deviceSettingsKeys.contains("serverAddress")) {
         settings.m_serverAddress = *response.getKiwiSdrSettings()->getServerAddress();
     }
+    if (deviceSettingsKeys.contains("nbReceivers")) {
+        int nbReceivers = response.getKiwiSdrSettings()->getNbReceivers();
+        settings.m_nbReceivers = nbReceivers < 1 ? 1 :
+            nbReceivers > (int) KiwiSDRAggregator::m_maxSessions ? KiwiSDRAggregator::m_maxSessions : nbReceivers;
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getKiwiSdrSettings()->getUseReverseApi() != 0;
     }
@@ -423,6 +497,8 @@ void KiwiSDRInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& re
         response.getKiwiSdrSettings()->setServerAddress(new QString(settings.m_serverAddress));
     }
 
+    response.getKiwiSdrSettings()->setNbReceivers(settings.m_nbReceivers);
+
     response.getKiwiSdrSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
     if (response.getKiwiSdrSettings()->getReverseApiAddress()) {
@@ -466,6 +542,9 @@ void KiwiSDRInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys,
     if (deviceSettingsKeys.contains("serverAddress") || force) {
         swgKiwiSDRSettings->setServerAddress(new QString(settings.m_serverAddress));
     }
+    if (deviceSettingsKeys.contains("nbReceivers") || force) {
+        swgKiwiSDRSettings->setNbReceivers(settings.m_nbReceivers);
+    }
 
     QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
             .arg(settings.m_reverseAPIAddress)
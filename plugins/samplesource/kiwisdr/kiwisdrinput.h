@@ -19,6 +19,8 @@
 #ifndef _KIWISDR_KIWISDRINPUT_H_
 #define _KIWISDR_KIWISDRINPUT_H_
 
+#include <vector>
+
 #include <QString>
 #include <QByteArray>
 #include <QTimer>
@@ -153,8 +155,8 @@ private:
 	DeviceAPI *m_deviceAPI;
 	QMutex m_mutex;
 	KiwiSDRSettings m_settings;
-	KiwiSDRWorker* m_kiwiSDRWorker;
-	QThread m_kiwiSDRWorkerThread;
+	std::vector<KiwiSDRWorker*> m_kiwiSDRWorkers; //!< one per receiver session
+	std::vector<QThread*> m_kiwiSDRWorkerThreads; //!< sessions are spread over these threads
 	QString m_deviceDescription;
 	bool m_running;
     const QTimer& m_masterTimer;
@@ -162,6 +164,8 @@ private:
     QNetworkRequest m_networkRequest;
 
     int getStatus() const;
+    void startWorkers(unsigned int nbReceivers);
+    void stopWorkers();
 	bool applySettings(const KiwiSDRSettings& settings, bool force);
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const KiwiSDRSettings& settings, bool force);
@@ -33,6 +33,7 @@ void KiwiSDRSettings::resetToDefaults()
     m_dcBlock = false;
 
 	m_serverAddress = "127.0.0.1:8073";
+	m_nbReceivers = 1;
 
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
@@ -47,6 +48,7 @@ QByteArray KiwiSDRSettings::serialize() const
 	s.writeString(2, m_serverAddress);
 	s.writeU32(3, m_gain);
 	s.writeBool(4, m_useAGC);
+	s.writeU32(5, m_nbReceivers);
 
     s.writeBool(100, m_useReverseAPI);
     s.writeString(101, m_reverseAPIAddress);
@@ -73,6 +75,8 @@ bool KiwiSDRSettings::deserialize(const QByteArray& data)
 		d.readString(2, &m_serverAddress, "127.0.0.1:8073");
 		d.readU32(3, &m_gain, 20);
 		d.readBool(4, &m_useAGC, true);
+		d.readU32(5, &utmp, 1);
+		m_nbReceivers = utmp < 1 ? 1 : utmp > 8 ? 8 : utmp;
 
 		d.readBool(100, &m_useReverseAPI, false);
 		d.readString(101, &m_reverseAPIAddress, "127.0.0.1");
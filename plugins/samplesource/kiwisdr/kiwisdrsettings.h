@@ -28,7 +28,8 @@ struct KiwiSDRSettings {
     bool m_dcBlock;
 
     quint64 m_centerFrequency;
-	QString m_serverAddress;
+	QString m_serverAddress; //!< comma separated list for several receivers
+	uint32_t m_nbReceivers;  //!< sessions aggregated in a wider band
 
 	bool m_useReverseAPI;
     QString m_reverseAPIAddress;
@@ -15,6 +15,7 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <string.h>
 #include <boost/endian/conversion.hpp>
 #include "kiwisdrworker.h"
 
@@ -23,10 +24,33 @@ KiwiSDRWorker::KiwiSDRWorker(SampleSinkFifo* sampleFifo)
 	m_timer(this),
 	m_sampleFifo(sampleFifo),
 	m_samplesBuf(),
+	m_sessionIndex(0),
+	m_frequencyOffset(0),
 	m_centerFrequency(1450000),
 	m_gain(20),
 	m_useAGC(true),
     m_status(0)
+{
+	init();
+}
+
+KiwiSDRWorker::KiwiSDRWorker(std::shared_ptr<KiwiSDRAggregator> aggregator, unsigned int sessionIndex)
+	: QObject(),
+	m_timer(this),
+	m_sampleFifo(nullptr),
+	m_samplesBuf(),
+	m_aggregator(aggregator),
+	m_sessionIndex(sessionIndex),
+	m_frequencyOffset(aggregator->getFrequencyOffset(sessionIndex)),
+	m_centerFrequency(1450000),
+	m_gain(20),
+	m_useAGC(true),
+    m_status(0)
+{
+	init();
+}
+
+void KiwiSDRWorker::init()
 {
 	connect(&m_timer, SIGNAL(timeout()), this, SLOT(tick()));
 
@@ -64,7 +88,7 @@ void KiwiSDRWorker::sendCenterFrequency()
 	if (!m_webSocket.isValid())
 		return;
 
-	QString freq = QString::number(m_centerFrequency / 1000.0, 'f', 3);
+	QString freq = QString::number(((qint64) m_centerFrequency + m_frequencyOffset) / 1000.0, 'f', 3);
 	QString msg = "SET mod=iq low_cut=-5980 high_cut=5980 freq=" + freq;
 	m_webSocket.sendTextMessage(msg);
 }
@@ -101,9 +125,40 @@ void KiwiSDRWorker::onBinaryMessageReceived(const QByteArray &message)
 	else if (message[0] == 'S' && message[1] == 'N' && message[2] == 'D')
 	{
 		int dataOffset = 20;
-		int sampleCount = 512;
+		int sampleCount = (message.size() - dataOffset) / 4;
 		const int16_t* messageSamples = (const int16_t*)(message.constData() + dataOffset);
 
+		if (sampleCount <= 0) {
+			return;
+		}
+
+		if (m_aggregator)
+		{
+			// header: flags (1), sequence (4 LE), S-meter (2 BE), GPS solution age (1), dummy (1), GPS seconds (4 LE), GPS nanoseconds (4 LE)
+			quint32 sequence, gpsSeconds, gpsNanoseconds;
+			memcpy(&sequence, message.constData() + 4, 4);
+			memcpy(&gpsSeconds, message.constData() + 12, 4);
+			memcpy(&gpsNanoseconds, message.constData() + 16, 4);
+			quint8 lastGpsSolution = message[10];
+			m_frame.m_sequence = boost::endian::little_to_native(sequence);
+			gpsSeconds = boost::endian::little_to_native(gpsSeconds);
+			gpsNanoseconds = boost::endian::little_to_native(gpsNanoseconds);
+			m_frame.m_gpsValid = (lastGpsSolution != 255) && ((gpsSeconds != 0) || (gpsNanoseconds != 0));
+			m_frame.m_gpsTime = gpsSeconds + gpsNanoseconds * 1e-9;
+			m_frame.m_samples.resize(sampleCount);
+
+			for (int i = 0; i < sampleCount; i++)
+			{
+				m_frame.m_samples[i] = Complex(
+					boost::endian::big_to_native(messageSamples[i * 2]),
+					boost::endian::big_to_native(messageSamples[i * 2 + 1])
+				);
+			}
+
+			m_aggregator->pushFrame(m_sessionIndex, m_frame);
+			return;
+		}
+
 		m_samplesBuf.clear();
 		for (int i = 0; i < sampleCount; i++)
 		{
@@ -139,9 +194,17 @@ void KiwiSDRWorker::onGainChanged(quint32 gain, bool useAGC)
 
 void KiwiSDRWorker::onServerAddressChanged(QString serverAddress)
 {
-	if (m_serverAddress == serverAddress)
+	QStringList serverAddresses = serverAddress.split(',', QString::SkipEmptyParts);
+
+	if (serverAddresses.size() == 0) {
+		return;
+	}
+
+	QString sessionServerAddress = serverAddresses[m_sessionIndex % serverAddresses.size()].trimmed();
+
+	if (m_serverAddress == sessionServerAddress)
 		return;
-	m_serverAddress = serverAddress;
+	m_serverAddress = sessionServerAddress;
 
     m_status = 1;
 	emit updateStatus(1);
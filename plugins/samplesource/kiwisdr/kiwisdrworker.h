@@ -18,16 +18,21 @@
 #ifndef _KIWISDR_KIWISDRWORKER_H_
 #define _KIWISDR_KIWISDRWORKER_H_
 
+#include <memory>
+
 #include <QTimer>
 #include <QtWebSockets/QtWebSockets>
 
 #include "dsp/samplesinkfifo.h"
+#include "kiwisdraggregator.h"
 
 class KiwiSDRWorker : public QObject {
 	Q_OBJECT
 
 public:
 	KiwiSDRWorker(SampleSinkFifo* sampleFifo);
+	/** Session of an aggregate of receivers. It uses the session index-th server address of the comma separated list (modulo) */
+	KiwiSDRWorker(std::shared_ptr<KiwiSDRAggregator> aggregator, unsigned int sessionIndex);
     int getStatus() const { return m_status; }
 
 private:
@@ -36,6 +41,10 @@ private:
 
 	SampleVector m_samplesBuf;
 	SampleSinkFifo* m_sampleFifo;
+	std::shared_ptr<KiwiSDRAggregator> m_aggregator; //!< shared by the sessions and deleted with the last one
+	unsigned int m_sessionIndex;
+	int m_frequencyOffset; //!< of the session from the center frequency
+	KiwiSDRAggregator::Frame m_frame;
 
 	QString m_serverAddress;
 	uint64_t m_centerFrequency;
@@ -47,6 +56,7 @@ private:
 
 	void sendCenterFrequency();
 	void sendGain();
+	void init();
 
 signals:
 	void updateStatus(int status);
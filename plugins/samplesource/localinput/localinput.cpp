@@ -17,6 +17,7 @@
 
 #include <string.h>
 #include <errno.h>
+#include <algorithm>
 
 #include <QDebug>
 #include <QNetworkReply>
@@ -42,9 +43,10 @@ LocalInput::LocalInput(DeviceAPI *deviceAPI) :
     m_deviceAPI(deviceAPI),
     m_settings(),
     m_centerFrequency(0),
+    m_sampleRate(48000),
 	m_deviceDescription("LocalInput")
 {
-	m_sampleFifo.setSize(96000 * 4);
+	resizeSampleFifo();
 
     m_deviceAPI->setNbSourceStreams(1);
 
@@ -124,7 +126,14 @@ int LocalInput::getSampleRate() const
 
 void LocalInput::setSampleRate(int sampleRate)
 {
-    m_sampleRate = sampleRate;
+    if (sampleRate != m_sampleRate)
+    {
+        m_sampleRate = sampleRate;
+
+        if (m_settings.m_fifoSizeMs != 0) {
+            resizeSampleFifo();
+        }
+    }
 
     DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency); // Frequency in Hz for the DSP engine
     m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
@@ -217,6 +226,13 @@ void LocalInput::applySettings(const LocalInputSettings& settings, bool force)
 
     mutexLocker.unlock();
 
+    if ((m_settings.m_fifoSizeMs != settings.m_fifoSizeMs) || force)
+    {
+        reverseAPIKeys.append("fifoSizeMs");
+        m_settings.m_fifoSizeMs = settings.m_fifoSizeMs;
+        resizeSampleFifo();
+    }
+
     if (settings.m_useReverseAPI)
     {
         bool fullUpdate = ((m_settings.m_useReverseAPI != settings.m_useReverseAPI) && settings.m_useReverseAPI) ||
@@ -232,9 +248,27 @@ void LocalInput::applySettings(const LocalInputSettings& settings, bool force)
     qDebug() << "LocalInput::applySettings: "
             << " m_dcBlock: " << m_settings.m_dcBlock
             << " m_iqCorrection: " << m_settings.m_iqCorrection
+            << " m_fifoSizeMs: " << m_settings.m_fifoSizeMs
             << " m_remoteAddress: " << m_remoteAddress;
 }
 
+void LocalInput::resizeSampleFifo()
+{
+    // The Local Sink writes the samples directly in this FIFO. A deeper FIFO absorbs longer
+    // DSP engine latencies of this device set at the expense of memory and delay.
+    unsigned int size = 96000 * 4;
+
+    if (m_settings.m_fifoSizeMs != 0) {
+        size = std::max(((quint64) m_sampleRate * m_settings.m_fifoSizeMs) / 1000, (quint64) 4800);
+    }
+
+    if (size != m_sampleFifo.size())
+    {
+        qDebug("LocalInput::resizeSampleFifo: %u samples", size);
+        m_sampleFifo.setSize(size);
+    }
+}
+
 int LocalInput::webapiRunGet(
         SWGSDRangel::SWGDeviceState& response,
         QString& errorMessage)
@@ -320,6 +354,9 @@ void LocalInput::webapiUpdateDeviceSettings(
     if (deviceSettingsKeys.contains("reverseAPIDeviceIndex")) {
         settings.m_reverseAPIDeviceIndex = response.getLocalInputSettings()->getReverseApiDeviceIndex();
     }
+    if (deviceSettingsKeys.contains("fifoSizeMs")) {
+        settings.m_fifoSizeMs = response.getLocalInputSettings()->getFifoSizeMs();
+    }
 }
 
 void LocalInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& response, const LocalInputSettings& settings)
@@ -337,6 +374,7 @@ void LocalInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& resp
 
     response.getLocalInputSettings()->setReverseApiPort(settings.m_reverseAPIPort);
     response.getLocalInputSettings()->setReverseApiDeviceIndex(settings.m_reverseAPIDeviceIndex);
+    response.getLocalInputSettings()->setFifoSizeMs(settings.m_fifoSizeMs);
 }
 
 int LocalInput::webapiReportGet(
@@ -354,6 +392,9 @@ void LocalInput::webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response
 {
     response.getLocalInputReport()->setCenterFrequency(m_centerFrequency);
     response.getLocalInputReport()->setSampleRate(m_sampleRate);
+    response.getLocalInputReport()->setFifoSize(m_sampleFifo.size());
+    response.getLocalInputReport()->setFifoFill(m_sampleFifo.fill());
+    response.getLocalInputReport()->setDroppedSamples(m_sampleFifo.getDroppedSamples());
 }
 
 void LocalInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const LocalInputSettings& settings, bool force)
@@ -373,6 +414,9 @@ void LocalInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, c
     if (deviceSettingsKeys.contains("iqCorrection") || force) {
         swgLocalInputSettings->setIqCorrection(settings.m_iqCorrection ? 1 : 0);
     }
+    if (deviceSettingsKeys.contains("fifoSizeMs") || force) {
+        swgLocalInputSettings->setFifoSizeMs(settings.m_fifoSizeMs);
+    }
 
     QString deviceSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
             .arg(settings.m_reverseAPIAddress)
@@ -122,6 +122,8 @@ public:
 
 	virtual bool handleMessage(const Message& message);
 
+    quint64 getDroppedSamples() { return m_sampleFifo.getDroppedSamples(); } //!< samples lost because the FIFO was full
+
     virtual int webapiSettingsGet(
                 SWGSDRangel::SWGDeviceSettings& response,
                 QString& errorMessage);
@@ -166,6 +168,7 @@ private:
     QNetworkRequest m_networkRequest;
 
     void applySettings(const LocalInputSettings& settings, bool force = false);
+    void resizeSampleFifo();
     void webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& response);
     void webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const LocalInputSettings& settings, bool force);
     void webapiReverseSendStartStop(bool start);
@@ -265,6 +265,7 @@ void LocalInputGui::displaySettings()
 
 	ui->dcOffset->setChecked(m_settings.m_dcBlock);
 	ui->iqImbalance->setChecked(m_settings.m_iqCorrection);
+    ui->fifoSizeMs->setValue(m_settings.m_fifoSizeMs);
 
 	blockApplySettings(false);
 }
@@ -287,6 +288,12 @@ void LocalInputGui::on_iqImbalance_toggled(bool checked)
     sendSettings();
 }
 
+void LocalInputGui::on_fifoSizeMs_valueChanged(int value)
+{
+    m_settings.m_fifoSizeMs = value;
+    sendSettings();
+}
+
 void LocalInputGui::on_startStop_toggled(bool checked)
 {
     if (m_doApplySettings)
@@ -336,6 +343,8 @@ void LocalInputGui::updateStatus()
 
         m_lastEngineState = state;
     }
+
+    ui->droppedSamplesText->setText(tr("%1").arg(m_sampleSource->getDroppedSamples()));
 }
 
 void LocalInputGui::openDeviceSettingsDialog(const QPoint& p)
@@ -116,6 +116,7 @@ private slots:
     void handleInputMessages();
 	void on_dcOffset_toggled(bool checked);
 	void on_iqImbalance_toggled(bool checked);
+    void on_fifoSizeMs_valueChanged(int value);
 	void on_startStop_toggled(bool checked);
     void updateHardware();
 	void updateStatus();
@@ -31,6 +31,7 @@ void LocalInputSettings::resetToDefaults()
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
     m_reverseAPIDeviceIndex = 0;
+    m_fifoSizeMs = 0;
 }
 
 QByteArray LocalInputSettings::serialize() const
@@ -43,6 +44,7 @@ QByteArray LocalInputSettings::serialize() const
     s.writeString(4, m_reverseAPIAddress);
     s.writeU32(5, m_reverseAPIPort);
     s.writeU32(6, m_reverseAPIDeviceIndex);
+    s.writeU32(7, m_fifoSizeMs);
 
     return s.final();
 }
@@ -75,6 +77,8 @@ bool LocalInputSettings::deserialize(const QByteArray& data)
 
         d.readU32(6, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readU32(7, &uintval, 0);
+        m_fifoSizeMs = uintval > 2000 ? 2000 : uintval;
         return true;
     }
     else
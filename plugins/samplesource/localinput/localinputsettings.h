@@ -28,6 +28,7 @@ struct LocalInputSettings {
     QString  m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
     uint16_t m_reverseAPIDeviceIndex;
+    uint32_t m_fifoSizeMs; //!< samples FIFO depth in milliseconds at current sample rate (0: default size)
 
     LocalInputSettings();
     void resetToDefaults();
@@ -239,6 +239,9 @@ void RemoteInput::applySettings(const RemoteInputSettings& settings, bool force)
     if ((m_settings.m_multicastJoin != settings.m_multicastJoin) || force) {
         reverseAPIKeys.append("multicastJoin");
     }
+    if ((m_settings.m_sharedMemoryName != settings.m_sharedMemoryName) || force) {
+        reverseAPIKeys.append("sharedMemoryName");
+    }
 
     if ((m_settings.m_dcBlock != settings.m_dcBlock) || (m_settings.m_iqCorrection != settings.m_iqCorrection) || force)
     {
@@ -251,9 +254,10 @@ void RemoteInput::applySettings(const RemoteInputSettings& settings, bool force)
     if ((m_settings.m_dataAddress != settings.m_dataAddress) || 
         (m_settings.m_dataPort != settings.m_dataPort) || 
         (m_settings.m_multicastAddress != settings.m_multicastAddress) || 
-        (m_settings.m_multicastJoin != settings.m_multicastJoin) || force) 
+        (m_settings.m_multicastJoin != settings.m_multicastJoin) ||
+        (m_settings.m_sharedMemoryName != settings.m_sharedMemoryName) || force)
     {
-        m_remoteInputUDPHandler->configureUDPLink(settings.m_dataAddress, settings.m_dataPort, settings.m_multicastAddress, settings.m_multicastJoin);
+        m_remoteInputUDPHandler->configureUDPLink(settings.m_dataAddress, settings.m_dataPort, settings.m_multicastAddress, settings.m_multicastJoin, settings.m_sharedMemoryName);
         m_remoteInputUDPHandler->getRemoteAddress(remoteAddress);
     }
 
@@ -276,6 +280,7 @@ void RemoteInput::applySettings(const RemoteInputSettings& settings, bool force)
             << " m_dataPort: " << m_settings.m_dataPort
             << " m_multicastAddress: " << m_settings.m_multicastAddress
             << " m_multicastJoin: " << m_settings.m_multicastJoin
+            << " m_sharedMemoryName: " << m_settings.m_sharedMemoryName
             << " m_apiAddress: " << m_settings.m_apiAddress
             << " m_apiPort: " << m_settings.m_apiPort
             << " m_remoteAddress: " << m_remoteAddress;
@@ -366,6 +371,9 @@ void RemoteInput::webapiUpdateDeviceSettings(
     if (deviceSettingsKeys.contains("multicastAddress")) {
         settings.m_multicastJoin = response.getRemoteInputSettings()->getMulticastJoin() != 0;
     }
+    if (deviceSettingsKeys.contains("sharedMemoryName")) {
+        settings.m_sharedMemoryName = *response.getRemoteInputSettings()->getSharedMemoryName();
+    }
     if (deviceSettingsKeys.contains("dcBlock")) {
         settings.m_dcBlock = response.getRemoteInputSettings()->getDcBlock() != 0;
     }
@@ -394,6 +402,7 @@ void RemoteInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings& res
     response.getRemoteInputSettings()->setDataPort(settings.m_dataPort);
     response.getRemoteInputSettings()->setMulticastAddress(new QString(settings.m_multicastAddress));
     response.getRemoteInputSettings()->setMulticastJoin(settings.m_multicastJoin ? 1 : 0);
+    response.getRemoteInputSettings()->setSharedMemoryName(new QString(settings.m_sharedMemoryName));
     response.getRemoteInputSettings()->setDcBlock(settings.m_dcBlock ? 1 : 0);
     response.getRemoteInputSettings()->setIqCorrection(settings.m_iqCorrection);
 
@@ -431,6 +440,7 @@ void RemoteInput::webapiFormatDeviceReport(SWGSDRangel::SWGDeviceReport& respons
 
     response.getRemoteInputReport()->setMinNbBlocks(m_remoteInputUDPHandler->getMinNbBlocks());
     response.getRemoteInputReport()->setMaxNbRecovery(m_remoteInputUDPHandler->getMaxNbRecovery());
+    response.getRemoteInputReport()->setSharedMemoryDroppedFrames(m_remoteInputUDPHandler->getSharedMemoryDroppedFrames());
 }
 
 void RemoteInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys, const RemoteInputSettings& settings, bool force)
@@ -462,6 +472,9 @@ void RemoteInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKeys,
     if (deviceSettingsKeys.contains("multicastJoin") || force) {
         swgRemoteInputSettings->setMulticastJoin(settings.m_multicastJoin ? 1 : 0);
     }
+    if (deviceSettingsKeys.contains("sharedMemoryName") || force) {
+        swgRemoteInputSettings->setSharedMemoryName(new QString(settings.m_sharedMemoryName));
+    }
     if (deviceSettingsKeys.contains("dcBlock") || force) {
         swgRemoteInputSettings->setDcBlock(settings.m_dcBlock ? 1 : 0);
     }
@@ -47,6 +47,11 @@ RemoteInputBuffer::RemoteInputBuffer() :
 	    m_balCorrLimit(0)
 {
 	m_currentMeta.init();
+    Metrics& metrics = Metrics::instance();
+    m_metricsFrames = metrics.counter("sdrangel_remote_input_frames_total", "Frames received by the Remote Inputs");
+    m_metricsIncompleteFrames = metrics.counter("sdrangel_remote_input_incomplete_frames_total", "Frames received by the Remote Inputs with not enough blocks to be decoded");
+    m_metricsRecoveredBlocks = metrics.counter("sdrangel_remote_input_recovered_blocks_total", "Blocks restored from FEC by the Remote Inputs");
+    m_metricsFECErrors = metrics.counter("sdrangel_remote_input_fec_errors_total", "FEC decoding failures in the Remote Inputs");
     setNbDecoderSlots(16);
 	m_tvOut_sec = 0;
 	m_tvOut_usec = 0;
@@ -213,8 +218,11 @@ void RemoteInputBuffer::checkSlotData(int slotIndex)
         m_tvOut_usec = ts - (m_tvOut_sec * 1000000LL);
     }
 
+    m_metricsFrames->inc();
+
     if (!m_decoderSlots[slotIndex].m_decoded)
     {
+        m_metricsIncompleteFrames->inc();
         qDebug() << "RemoteInputBuffer::checkSlotData: incomplete frame:"
                 << " slotIndex: " << slotIndex
                 << " m_blockCount: " << m_decoderSlots[slotIndex].m_blockCount
@@ -293,6 +301,7 @@ void RemoteInputBuffer::writeData(char *array)
 
             if (m_cm256.cm256_decode(m_paramsCM256, m_decoderSlots[decoderIndex].m_cm256DescriptorBlocks)) // CM256 decode
             {
+                m_metricsFECErrors->inc();
                 qDebug() << "RemoteInputBuffer::writeData: decode CM256 error:"
                         << " decoderIndex: " << decoderIndex
                         << " m_blockCount: " << m_decoderSlots[decoderIndex].m_blockCount
@@ -301,6 +310,7 @@ void RemoteInputBuffer::writeData(char *array)
             }
             else
             {
+                m_metricsRecoveredBlocks->inc(m_decoderSlots[decoderIndex].m_recoveryCount);
                 qDebug() << "RemoteInputBuffer::writeData: decode CM256 success:"
                         << " decoderIndex: " << decoderIndex
                         << " m_blockCount: " << m_decoderSlots[decoderIndex].m_blockCount
@@ -24,6 +24,7 @@
 #include <cstdlib>
 #include "cm256cc/cm256.h"
 #include "util/movingaverage.h"
+#include "util/metrics.h"
 
 
 #define REMOTEINPUT_UDPSIZE 512               // UDP payload size
@@ -148,6 +149,10 @@ private:
     int                  m_minOriginalBlocks;    //!< (stats) minimum number of original blocks received since last poll
     int                  m_curNbRecovery;        //!< (stats) instantaneous number of recovery blocks used
     int                  m_maxNbRecovery;        //!< (stats) maximum number of recovery blocks used since last poll
+    Metrics::Counter    *m_metricsFrames;        //!< frames completed (decoded or not)
+    Metrics::Counter    *m_metricsIncompleteFrames;
+    Metrics::Counter    *m_metricsRecoveredBlocks;
+    Metrics::Counter    *m_metricsFECErrors;
     MovingAverageUtil<int, int, 10> m_avgNbBlocks;   //!< (stats) average number of blocks received
     MovingAverageUtil<int, int, 10> m_avgOrigBlocks; //!< (stats) average number of original blocks received
     MovingAverageUtil<int, int, 10> m_avgNbRecovery; //!< (stats) average number of recovery blocks used
@@ -306,6 +306,7 @@ void RemoteInputGui::displaySettings()
     ui->dataAddress->setText(m_settings.m_dataAddress);
     ui->multicastAddress->setText(m_settings.m_multicastAddress);
     ui->multicastJoin->setChecked(m_settings.m_multicastJoin);
+    ui->sharedMemoryName->setText(m_settings.m_sharedMemoryName);
 
     ui->dataApplyButton->setEnabled(false);
     ui->dataApplyButton->setStyleSheet("QPushButton { background:rgb(79,79,79); }");
@@ -399,6 +400,13 @@ void RemoteInputGui::on_multicastJoin_toggled(bool checked)
     ui->dataApplyButton->setStyleSheet("QPushButton { background-color : green; }");
 }
 
+void RemoteInputGui::on_sharedMemoryName_returnPressed()
+{
+    m_settings.m_sharedMemoryName = ui->sharedMemoryName->text().trimmed();
+    ui->dataApplyButton->setEnabled(true);
+    ui->dataApplyButton->setStyleSheet("QPushButton { background-color : green; }");
+}
+
 void RemoteInputGui::on_apiPort_returnPressed()
 {
     bool ctlOk;
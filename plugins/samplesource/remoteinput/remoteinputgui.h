@@ -131,6 +131,7 @@ private slots:
 	void on_dataPort_returnPressed();
     void on_multicastAddress_returnPressed();
 	void on_multicastJoin_toggled(bool checked);
+    void on_sharedMemoryName_returnPressed();
 	void on_startStop_toggled(bool checked);
     void on_eventCountsReset_clicked(bool checked);
     void updateHardware();
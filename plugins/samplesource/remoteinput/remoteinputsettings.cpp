@@ -31,6 +31,7 @@ void RemoteInputSettings::resetToDefaults()
     m_dataPort = 9090;
     m_multicastAddress = "224.0.0.1";
     m_multicastJoin = false;
+    m_sharedMemoryName = "";
     m_dcBlock = false;
     m_iqCorrection = false;
     m_useReverseAPI = false;
@@ -55,6 +56,7 @@ QByteArray RemoteInputSettings::serialize() const
     s.writeString(12, m_reverseAPIAddress);
     s.writeU32(13, m_reverseAPIPort);
     s.writeU32(14, m_reverseAPIDeviceIndex);
+    s.writeString(15, m_sharedMemoryName);
 
     return s.final();
 }
@@ -95,6 +97,7 @@ bool RemoteInputSettings::deserialize(const QByteArray& data)
 
         d.readU32(14, &uintval, 0);
         m_reverseAPIDeviceIndex = uintval > 99 ? 99 : uintval;
+        d.readString(15, &m_sharedMemoryName, "");
         return true;
     }
     else
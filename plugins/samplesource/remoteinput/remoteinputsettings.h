@@ -28,6 +28,7 @@ struct RemoteInputSettings {
     quint16 m_dataPort;
     QString m_multicastAddress;
     bool    m_multicastJoin;
+    QString m_sharedMemoryName; //!< read from shared memory with this name instead of UDP if not empty
     bool    m_dcBlock;
     bool    m_iqCorrection;
     bool     m_useReverseAPI;
@@ -42,6 +42,7 @@ RemoteInputUDPHandler::RemoteInputUDPHandler(SampleSinkFifo *sampleFifo, DeviceA
     m_multicastAddress(QStringLiteral("224.0.0.1")),
     m_multicast(false),
 	m_dataConnected(false),
+    m_sharedMemoryNotifier(nullptr),
 	m_udpBuf(0),
 	m_udpReadBytes(0),
 	m_sampleFifo(sampleFifo),
@@ -95,6 +96,26 @@ void RemoteInputUDPHandler::start()
 	    return;
 	}
 
+    if (!m_sharedMemoryName.isEmpty())
+    {
+        // the shared memory replaces the UDP link: same blocks without FEC
+        if (m_sharedMemory.open(m_sharedMemoryName, false))
+        {
+            qDebug("RemoteInputUDPHandler::start: read from shared memory %s", qPrintable(m_sharedMemoryName));
+            m_sharedMemoryNotifier = new RemoteSharedMemoryNotifier(&m_sharedMemory);
+            connect(m_sharedMemoryNotifier, SIGNAL(dataReady()), this, SLOT(sharedMemoryReadyRead()), Qt::QueuedConnection);
+            m_sharedMemoryNotifier->start();
+        }
+        else
+        {
+            qWarning("RemoteInputUDPHandler::start: cannot open shared memory %s", qPrintable(m_sharedMemoryName));
+        }
+
+        m_elapsedTimer.start();
+        m_running = true;
+        return;
+    }
+
 	if (!m_dataSocket) {
 		m_dataSocket = new QUdpSocket(this);
 	}
@@ -138,6 +159,16 @@ void RemoteInputUDPHandler::stop()
 
 	disconnectTimer();
 
+    if (m_sharedMemoryNotifier)
+    {
+        disconnect(m_sharedMemoryNotifier, SIGNAL(dataReady()), this, SLOT(sharedMemoryReadyRead()));
+        m_sharedMemoryNotifier->stopWork();
+        delete m_sharedMemoryNotifier;
+        m_sharedMemoryNotifier = nullptr;
+    }
+
+    m_sharedMemory.close();
+
     if (m_dataConnected)
     {
 		m_dataConnected = false;
@@ -155,19 +186,20 @@ void RemoteInputUDPHandler::stop()
 	m_running = false;
 }
 
-void RemoteInputUDPHandler::configureUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin)
+void RemoteInputUDPHandler::configureUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin, const QString& sharedMemoryName)
 {
-    Message* msg = MsgUDPAddressAndPort::create(address, port, multicastAddress, multicastJoin);
+    Message* msg = MsgUDPAddressAndPort::create(address, port, multicastAddress, multicastJoin, sharedMemoryName);
     m_inputMessageQueue.push(msg);
 }
 
-void RemoteInputUDPHandler::applyUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin)
+void RemoteInputUDPHandler::applyUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin, const QString& sharedMemoryName)
 {
     qDebug() << "RemoteInputUDPHandler::applyUDPLink: "
         << " address: " << address
         << " port: " << port
         << " multicastAddress: " << multicastAddress
-        << " multicastJoin: " << multicastJoin;    
+        << " multicastJoin: " << multicastJoin
+        << " sharedMemoryName: " << sharedMemoryName;
 
 	bool addressOK = m_dataAddress.setAddress(address);
 
@@ -187,6 +219,7 @@ void RemoteInputUDPHandler::applyUDPLink(const QString& address, quint16 port, c
     }
 
 	m_dataPort = port;
+    m_sharedMemoryName = sharedMemoryName;
 	stop();
 	start();
 }
@@ -207,6 +240,13 @@ void RemoteInputUDPHandler::dataReadyRead()
 	}
 }
 
+void RemoteInputUDPHandler::sharedMemoryReadyRead()
+{
+    while (m_sharedMemory.isOpen() && (m_sharedMemory.readBlocks((RemoteSuperBlock*) m_udpBuf, 1) == 1)) {
+        processData();
+    }
+}
+
 void RemoteInputUDPHandler::processData()
 {
     m_remoteInputBuffer.writeData(m_udpBuf);
@@ -439,7 +479,7 @@ bool RemoteInputUDPHandler::handleMessage(const Message& cmd)
     if (RemoteInputUDPHandler::MsgUDPAddressAndPort::match(cmd))
     {
         RemoteInputUDPHandler::MsgUDPAddressAndPort& notif = (RemoteInputUDPHandler::MsgUDPAddressAndPort&) cmd;
-        applyUDPLink(notif.getAddress(), notif.getPort(), notif.getMulticastAddress(), notif.getMulticastJoin());
+        applyUDPLink(notif.getAddress(), notif.getPort(), notif.getMulticastAddress(), notif.getMulticastJoin(), notif.getSharedMemoryName());
         return true;
     }
     else
@@ -25,6 +25,7 @@
 #include <QElapsedTimer>
 
 #include "util/messagequeue.h"
+#include "channel/remotesharedmemory.h"
 #include "remoteinputbuffer.h"
 
 #define REMOTEINPUT_THROTTLE_MS 50
@@ -64,7 +65,7 @@ public:
 	void setMessageQueueToGUI(MessageQueue *queue) { m_messageQueueToGUI = queue; }
     void start();
 	void stop();
-	void configureUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin);
+	void configureUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin, const QString& sharedMemoryName);
 	void getRemoteAddress(QString& s) const { s = m_remoteAddress.toString(); }
     int getNbOriginalBlocks() const { return RemoteNbOrginalBlocks; }
     bool isStreaming() const { return m_masterTimerConnected; }
@@ -74,8 +75,10 @@ public:
     uint64_t getTVmSec() const { return m_tv_msec; }
     int getMinNbBlocks() { return m_remoteInputBuffer.getMinNbBlocks(); }
     int getMaxNbRecovery() { return m_remoteInputBuffer.getMaxNbRecovery(); }
+    quint64 getSharedMemoryDroppedFrames() const { return m_sharedMemory.isOpen() ? m_sharedMemory.getDroppedFrames() : 0; }
 public slots:
 	void dataReadyRead();
+	void sharedMemoryReadyRead();
 
 private:
     class MsgUDPAddressAndPort : public Message {
@@ -86,10 +89,11 @@ private:
         quint16 getPort() const { return m_port; }
         const QString& getMulticastAddress() const { return m_multicastAddress; }
         bool getMulticastJoin() const { return m_multicastJoin; }
+        const QString& getSharedMemoryName() const { return m_sharedMemoryName; }
 
-        static MsgUDPAddressAndPort* create(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin)
+        static MsgUDPAddressAndPort* create(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin, const QString& sharedMemoryName)
         {
-            return new MsgUDPAddressAndPort(address, port, multicastAddress, multicastJoin);
+            return new MsgUDPAddressAndPort(address, port, multicastAddress, multicastJoin, sharedMemoryName);
         }
 
     private:
@@ -97,13 +101,15 @@ private:
         quint16 m_port;
         QString m_multicastAddress;
         bool m_multicastJoin;
+        QString m_sharedMemoryName;
 
-        MsgUDPAddressAndPort(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin) :
+        MsgUDPAddressAndPort(const QString& address, quint16 port, const QString& multicastAddress, bool multicastJoin, const QString& sharedMemoryName) :
             Message(),
             m_address(address),
             m_port(port),
             m_multicastAddress(multicastAddress),
-            m_multicastJoin(multicastJoin)
+            m_multicastJoin(multicastJoin),
+            m_sharedMemoryName(sharedMemoryName)
         { }
     };
 
@@ -120,6 +126,9 @@ private:
 	QHostAddress m_multicastAddress;
 	bool m_multicast;
 	bool m_dataConnected;
+    QString m_sharedMemoryName;
+    RemoteSharedMemory m_sharedMemory;
+    RemoteSharedMemoryNotifier *m_sharedMemoryNotifier;
 	char *m_udpBuf;
 	qint64 m_udpReadBytes;
 	SampleSinkFifo *m_sampleFifo;
@@ -147,7 +156,7 @@ private:
     void disconnectTimer();
 	void processData();
     void adjustNbDecoderSlots(const RemoteMetaDataFEC& metaData);
-	void applyUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool muticastJoin);
+	void applyUDPLink(const QString& address, quint16 port, const QString& multicastAddress, bool muticastJoin, const QString& sharedMemoryName);
 	bool handleMessage(const Message& message);
 
 private slots:
@@ -197,6 +197,7 @@ bool RTLSDRInput::start()
     if (m_running) stop();
 
 	m_rtlSDRThread = new RTLSDRThread(m_dev, &m_sampleFifo);
+	DSPEngine::instance()->applyThreadPriorityOnStart(m_rtlSDRThread, m_deviceAPI, ThreadPriority::RoleWorker);
 	m_rtlSDRThread->setSamplerate(m_settings.m_devSampleRate);
 	m_rtlSDRThread->setLog2Decimation(m_settings.m_log2Decim);
 	m_rtlSDRThread->setFcPos((int) m_settings.m_fcPos);
@@ -57,9 +57,9 @@ TestSourceGui::TestSourceGui(DeviceUISet *deviceUISet, QWidget* parent) :
     ui->centerFrequency->setColorMapper(ColorMapper(ColorMapper::GrayGold));
     ui->centerFrequency->setValueRange(7, 0, 9999999);
     ui->sampleRate->setColorMapper(ColorMapper(ColorMapper::GrayGreenYellow));
-    ui->sampleRate->setValueRange(7, 48000, 9999999);
+    ui->sampleRate->setValueRange(8, 48000, 99999999);
     ui->frequencyShift->setColorMapper(ColorMapper(ColorMapper::GrayGold));
-    ui->frequencyShift->setValueRange(false, 7, -9999999, 9999999);
+    ui->frequencyShift->setValueRange(false, 8, -99999999, 99999999);
     ui->frequencyShiftLabel->setText(QString("%1").arg(QChar(0x94, 0x03)));
 
     displaySettings();
@@ -232,6 +232,12 @@ void TestSourceGui::on_modulation_currentIndexChanged(int index)
     sendSettings();
 }
 
+void TestSourceGui::on_scenario_editingFinished()
+{
+    m_settings.m_scenario = ui->scenario->text();
+    sendSettings();
+}
+
 void TestSourceGui::on_modulationFrequency_valueChanged(int value)
 {
     m_settings.m_modulationTone = value;
@@ -354,7 +360,7 @@ void TestSourceGui::updateAmpFineLimit()
 void TestSourceGui::updateFrequencyShiftLimit()
 {
     int sampleRate = ui->sampleRate->getValueNew();
-    ui->frequencyShift->setValueRange(false, 7, -sampleRate, sampleRate);
+    ui->frequencyShift->setValueRange(false, 8, -sampleRate, sampleRate);
 }
 
 void TestSourceGui::displaySettings()
@@ -396,6 +402,7 @@ void TestSourceGui::displaySettings()
     ui->amModulationText->setText(QString("%1").arg(m_settings.m_amModulation));
     ui->fmDeviation->setValue(m_settings.m_fmDeviation);
     ui->fmDeviationText->setText(QString("%1").arg(m_settings.m_fmDeviation / 10.0, 0, 'f', 1));
+    ui->scenario->setText(m_settings.m_scenario);
     blockApplySettings(false);
 }
 
@@ -91,6 +91,7 @@ private slots:
     void on_amplitudeFine_valueChanged(int value);
     void on_modulation_currentIndexChanged(int index);
     void on_modulationFrequency_valueChanged(int value);
+    void on_scenario_editingFinished();
     void on_amModulation_valueChanged(int value);
     void on_fmDeviation_valueChanged(int value);
     void on_dcBias_valueChanged(int value);
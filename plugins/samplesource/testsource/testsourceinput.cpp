@@ -423,6 +423,15 @@ bool TestSourceInput::applySettings(const TestSourceSettings& settings, bool for
         }
     }
 
+    if ((m_settings.m_scenario != settings.m_scenario) || force)
+    {
+        reverseAPIKeys.append("scenario");
+
+        if (m_testSourceWorker != 0) {
+            m_testSourceWorker->setScenario(settings.m_scenario);
+        }
+    }
+
     if (settings.m_useReverseAPI)
     {
         qDebug("TestSourceInput::applySettings: call webapiReverseSendSettings");
@@ -560,6 +569,9 @@ void TestSourceInput::webapiUpdateDeviceSettings(
     if (deviceSettingsKeys.contains("phaseImbalance")) {
         settings.m_phaseImbalance = response.getTestSourceSettings()->getPhaseImbalance();
     };
+    if (deviceSettingsKeys.contains("scenario")) {
+        settings.m_scenario = *response.getTestSourceSettings()->getScenario();
+    }
     if (deviceSettingsKeys.contains("useReverseAPI")) {
         settings.m_useReverseAPI = response.getTestSourceSettings()->getUseReverseApi() != 0;
     }
@@ -593,6 +605,12 @@ void TestSourceInput::webapiFormatDeviceSettings(SWGSDRangel::SWGDeviceSettings&
     response.getTestSourceSettings()->setQFactor(settings.m_qFactor);
     response.getTestSourceSettings()->setPhaseImbalance(settings.m_phaseImbalance);
 
+    if (response.getTestSourceSettings()->getScenario()) {
+        *response.getTestSourceSettings()->getScenario() = settings.m_scenario;
+    } else {
+        response.getTestSourceSettings()->setScenario(new QString(settings.m_scenario));
+    }
+
     response.getTestSourceSettings()->setUseReverseApi(settings.m_useReverseAPI ? 1 : 0);
 
     if (response.getTestSourceSettings()->getReverseApiAddress()) {
@@ -664,6 +682,9 @@ void TestSourceInput::webapiReverseSendSettings(QList<QString>& deviceSettingsKe
     if (deviceSettingsKeys.contains("phaseImbalance") || force) {
         swgTestSourceSettings->setPhaseImbalance(settings.m_phaseImbalance);
     };
+    if (deviceSettingsKeys.contains("scenario") || force) {
+        swgTestSourceSettings->setScenario(new QString(settings.m_scenario));
+    }
 
     QString channelSettingsURL = QString("http://%1:%2/sdrangel/deviceset/%3/device/settings")
             .arg(settings.m_reverseAPIAddress)
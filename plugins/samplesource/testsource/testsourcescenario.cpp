@@ -0,0 +1,403 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <algorithm>
+#include <random>
+
+#include <QStringList>
+#include <QDebug>
+
+#include "testsourcescenario.h"
+
+const char *TestSourceScenario::m_defaultDefinition =
+    "nfm:-300000:-30:2500:8:25000;am:50000:-25:50;usb:120000:-30;lsb:-50000:-30;burst:200000:-25:9600;noise:-70";
+
+TestSourceScenario::TestSourceScenario() :
+    m_sampleRate(48000),
+    m_frequencyShift(0),
+    m_dirty(true),
+    m_index(0)
+{
+}
+
+void TestSourceScenario::setDefinition(const QString& definition)
+{
+    if (definition != m_definition)
+    {
+        m_definition = definition;
+        m_dirty = true;
+    }
+}
+
+void TestSourceScenario::setSampleRate(int sampleRate)
+{
+    if (sampleRate != m_sampleRate)
+    {
+        m_sampleRate = sampleRate;
+        m_dirty = true;
+    }
+}
+
+void TestSourceScenario::setFrequencyShift(int frequencyShift)
+{
+    if (frequencyShift != m_frequencyShift)
+    {
+        m_frequencyShift = frequencyShift;
+        m_dirty = true;
+    }
+}
+
+bool TestSourceScenario::parse(const QString& definition, std::vector<Carrier>& carriers)
+{
+    QStringList carrierDefinitions = definition.split(';', QString::SkipEmptyParts);
+    bool valid = true;
+
+    for (const auto& carrierDefinition : carrierDefinitions)
+    {
+        QStringList fields = carrierDefinition.trimmed().split(':');
+        QString type = fields[0].trimmed().toLower();
+        bool ok = true;
+        Carrier carrier;
+        carrier.m_offset = 0;
+        carrier.m_level = -20.0f;
+        carrier.m_param = 0;
+
+        if (type == "noise")
+        {
+            carrier.m_type = CarrierNoise;
+
+            if (fields.size() > 1) {
+                carrier.m_level = fields[1].toFloat(&ok);
+            }
+
+            if (ok) {
+                carriers.push_back(carrier);
+            } else {
+                qWarning("TestSourceScenario::parse: invalid noise level in %s", qPrintable(carrierDefinition));
+                valid = false;
+            }
+
+            continue;
+        }
+        else if (type == "nfm")
+        {
+            carrier.m_type = CarrierNFM;
+            carrier.m_param = 2500;
+        }
+        else if (type == "am")
+        {
+            carrier.m_type = CarrierAM;
+            carrier.m_param = 50;
+        }
+        else if (type == "usb")
+        {
+            carrier.m_type = CarrierUSB;
+        }
+        else if (type == "lsb")
+        {
+            carrier.m_type = CarrierLSB;
+        }
+        else if (type == "burst")
+        {
+            carrier.m_type = CarrierBurst;
+            carrier.m_param = 9600;
+        }
+        else
+        {
+            qWarning("TestSourceScenario::parse: unknown carrier type in %s", qPrintable(carrierDefinition));
+            valid = false;
+            continue;
+        }
+
+        int count = 1;
+        int spacing = 12500;
+        bool okField = true;
+
+        if (fields.size() < 2)
+        {
+            qWarning("TestSourceScenario::parse: missing offset in %s", qPrintable(carrierDefinition));
+            valid = false;
+            continue;
+        }
+
+        carrier.m_offset = fields[1].toInt(&okField);
+        ok = ok && okField;
+
+        if (fields.size() > 2)
+        {
+            carrier.m_level = fields[2].toFloat(&okField);
+            ok = ok && okField;
+        }
+
+        if (fields.size() > 3)
+        {
+            carrier.m_param = fields[3].toInt(&okField);
+            ok = ok && okField && (carrier.m_param > 0);
+        }
+
+        if (fields.size() > 4)
+        {
+            count = fields[4].toInt(&okField);
+            ok = ok && okField && (count > 0);
+        }
+
+        if (fields.size() > 5)
+        {
+            spacing = fields[5].toInt(&okField);
+            ok = ok && okField;
+        }
+
+        if (!ok)
+        {
+            qWarning("TestSourceScenario::parse: invalid field in %s", qPrintable(carrierDefinition));
+            valid = false;
+            continue;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            carriers.push_back(carrier);
+            carrier.m_offset += spacing;
+        }
+    }
+
+    return valid;
+}
+
+void TestSourceScenario::generate(qint16 *buf, int nbSamples, float amplitudeI, float amplitudeQ, qint16 dc, float phaseImbalance)
+{
+    if (m_dirty) {
+        build();
+    }
+
+    while (nbSamples > 0)
+    {
+        int count = std::min(nbSamples, (int) (m_tableSize - m_index));
+        const float *re = &m_re[m_index];
+        const float *im = &m_im[m_index];
+
+        for (int i = 0; i < count; i++)
+        {
+            buf[2*i]   = (qint16) (re[i] * amplitudeI) + dc;
+            buf[2*i+1] = (qint16) ((im[i] + phaseImbalance*re[i]) * amplitudeQ);
+        }
+
+        buf += 2*count;
+        nbSamples -= count;
+        m_index = (m_index + count) % m_tableSize;
+    }
+}
+
+unsigned int TestSourceScenario::toBin(double frequency) const
+{
+    long long bin = llround((frequency * m_tableSize) / m_sampleRate);
+    bin %= (long long) m_tableSize;
+    return bin < 0 ? bin + m_tableSize : bin;
+}
+
+void TestSourceScenario::build()
+{
+    m_carriers.clear();
+    parse(m_definition, m_carriers);
+
+    if (m_carriers.size() > m_maxCarriers)
+    {
+        qWarning("TestSourceScenario::build: %u carriers truncated to %u", (unsigned int) m_carriers.size(), m_maxCarriers);
+        m_carriers.resize(m_maxCarriers);
+    }
+
+    m_re.assign(m_tableSize, 0.0f);
+    m_im.assign(m_tableSize, 0.0f);
+    m_index = 0;
+    m_dirty = false;
+
+    // one period of the oscillator at sample rate / m_tableSize: bin k is read every k samples
+    std::vector<float> cosTable(m_tableSize);
+    std::vector<float> sinTable(m_tableSize);
+
+    for (unsigned int i = 0; i < m_tableSize; i++)
+    {
+        double phase = (2.0 * M_PI * i) / m_tableSize;
+        cosTable[i] = cos(phase);
+        sinTable[i] = sin(phase);
+    }
+
+    for (const auto& carrier : m_carriers)
+    {
+        if (carrier.m_type == CarrierNoise)
+        {
+            addNoise(carrier);
+            continue;
+        }
+
+        int frequency = carrier.m_offset + m_frequencyShift;
+
+        if ((frequency < -m_sampleRate/2) || (frequency > m_sampleRate/2))
+        {
+            qDebug("TestSourceScenario::build: carrier at %d Hz out of band", frequency);
+            continue;
+        }
+
+        if (carrier.m_type == CarrierBurst) {
+            addBurst(carrier, cosTable, sinTable);
+        } else {
+            addVoice(carrier, cosTable, sinTable);
+        }
+    }
+
+    // saturate like an ADC would
+    for (unsigned int i = 0; i < m_tableSize; i++)
+    {
+        m_re[i] = m_re[i] > 1.0f ? 1.0f : m_re[i] < -1.0f ? -1.0f : m_re[i];
+        m_im[i] = m_im[i] > 1.0f ? 1.0f : m_im[i] < -1.0f ? -1.0f : m_im[i];
+    }
+
+    qDebug("TestSourceScenario::build: %u carriers at %d S/s", (unsigned int) m_carriers.size(), m_sampleRate);
+}
+
+void TestSourceScenario::addVoice(const Carrier& carrier, const std::vector<float>& cosTable, const std::vector<float>& sinTable)
+{
+    // speech like modulating signal: three tones with decreasing weights (peak amplitude 1)
+    static const int nbTones = 3;
+    static const double toneFrequencies[nbTones] = {400.0, 1000.0, 2200.0};
+    static const float toneWeights[nbTones] = {0.5f, 0.3f, 0.2f};
+    unsigned int mask = m_tableSize - 1;
+    unsigned int toneBins[nbTones];
+    unsigned int toneIndexes[nbTones];
+    float fmIndexes[nbTones];
+
+    for (int k = 0; k < nbTones; k++)
+    {
+        toneBins[k] = std::max(toBin(toneFrequencies[k]), 1U);
+        toneIndexes[k] = (carrier.m_offset * (k+1)) & mask; // spread the tone phases across carriers
+        double toneFrequency = ((double) toneBins[k] * m_sampleRate) / m_tableSize;
+        fmIndexes[k] = toneWeights[k] * (carrier.m_param / toneFrequency);
+    }
+
+    unsigned int carrierBin = toBin(carrier.m_offset + m_frequencyShift);
+    unsigned int carrierIndex = 0;
+    float amplitude = pow(10.0, carrier.m_level / 20.0);
+    float amModulation = carrier.m_param / 100.0f;
+
+    for (unsigned int i = 0; i < m_tableSize; i++)
+    {
+        float envRe, envIm;
+
+        if (carrier.m_type == CarrierNFM)
+        {
+            float phase = 0.0f;
+
+            for (int k = 0; k < nbTones; k++) {
+                phase += fmIndexes[k] * sinTable[toneIndexes[k]];
+            }
+
+            envRe = cos(phase);
+            envIm = sin(phase);
+        }
+        else if (carrier.m_type == CarrierAM)
+        {
+            float af = 0.0f;
+
+            for (int k = 0; k < nbTones; k++) {
+                af += toneWeights[k] * cosTable[toneIndexes[k]];
+            }
+
+            envRe = (1.0f + amModulation * af) / (1.0f + amModulation);
+            envIm = 0.0f;
+        }
+        else // SSB: the tones on one side of the carrier
+        {
+            envRe = 0.0f;
+            envIm = 0.0f;
+
+            for (int k = 0; k < nbTones; k++)
+            {
+                envRe += toneWeights[k] * cosTable[toneIndexes[k]];
+                envIm += toneWeights[k] * sinTable[toneIndexes[k]];
+            }
+
+            envIm = carrier.m_type == CarrierLSB ? -envIm : envIm;
+        }
+
+        float re = cosTable[carrierIndex];
+        float im = sinTable[carrierIndex];
+        m_re[i] += amplitude * (envRe * re - envIm * im);
+        m_im[i] += amplitude * (envRe * im + envIm * re);
+
+        for (int k = 0; k < nbTones; k++) {
+            toneIndexes[k] = (toneIndexes[k] + toneBins[k]) & mask;
+        }
+
+        carrierIndex = (carrierIndex + carrierBin) & mask;
+    }
+}
+
+void TestSourceScenario::addBurst(const Carrier& carrier, const std::vector<float>& cosTable, const std::vector<float>& sinTable)
+{
+    // 2-FSK with modulation index 0.5 keyed by random bits. Bursts of different carriers are staggered.
+    std::mt19937 generator(carrier.m_offset);
+    std::uniform_int_distribution<int> bitDistribution(0, 1);
+    unsigned int mask = m_tableSize - 1;
+    double samplesPerSymbol = (double) m_sampleRate / carrier.m_param;
+    double phaseStep = (M_PI / 2.0) / samplesPerSymbol;
+    unsigned int periodSamples = std::max(1LL, ((long long) m_sampleRate * m_burstPeriodMs) / 1000);
+    unsigned int onSamples = ((long long) m_sampleRate * m_burstOnMs) / 1000;
+    unsigned int start = generator() % periodSamples;
+    unsigned int carrierBin = toBin(carrier.m_offset + m_frequencyShift);
+    unsigned int carrierIndex = 0;
+    float amplitude = pow(10.0, carrier.m_level / 20.0);
+    double phase = 0.0;
+    double symbolClock = 0.0;
+    int bit = bitDistribution(generator);
+
+    for (unsigned int i = 0; i < m_tableSize; i++)
+    {
+        if ((i + start) % periodSamples < onSamples)
+        {
+            float envRe = cos(phase);
+            float envIm = sin(phase);
+            float re = cosTable[carrierIndex];
+            float im = sinTable[carrierIndex];
+            m_re[i] += amplitude * (envRe * re - envIm * im);
+            m_im[i] += amplitude * (envRe * im + envIm * re);
+            phase += bit ? phaseStep : -phaseStep;
+            symbolClock += 1.0;
+
+            if (symbolClock >= samplesPerSymbol)
+            {
+                symbolClock -= samplesPerSymbol;
+                bit = bitDistribution(generator);
+            }
+        }
+
+        carrierIndex = (carrierIndex + carrierBin) & mask;
+    }
+}
+
+void TestSourceScenario::addNoise(const Carrier& carrier)
+{
+    std::mt19937 generator(m_tableSize);
+    std::normal_distribution<float> distribution(0.0f, sqrt(pow(10.0, carrier.m_level / 10.0) / 2.0));
+
+    for (unsigned int i = 0; i < m_tableSize; i++)
+    {
+        m_re[i] += distribution(generator);
+        m_im[i] += distribution(generator);
+    }
+}
@@ -0,0 +1,97 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _TESTSOURCE_TESTSOURCESCENARIO_H_
+#define _TESTSOURCE_TESTSOURCESCENARIO_H_
+
+#include <vector>
+
+#include <QString>
+
+/**
+ * Multiple carriers load generator of the test source. The scenario is a list of carriers
+ * separated by ';'. Each carrier is defined as type:offset:level[:param[:count:spacing]]
+ *
+ * - type: nfm (param: deviation Hz), am (param: modulation %), usb, lsb, burst (2-FSK bursts,
+ *   param: symbol rate in Baud) or noise (noise floor defined as noise:level only)
+ * - offset: carrier frequency from the test signal frequency in Hz
+ * - level: carrier power in dB relative to full scale
+ * - count, spacing: repeat the carrier count times every spacing Hz
+ *
+ * The whole signal is computed once for a period of m_tableSize samples and then played in a
+ * loop so that generating samples costs a table read and a conversion per sample at any rate.
+ * Carrier and modulating tone frequencies are rounded to a multiple of sample rate / m_tableSize
+ * so that the signals are continuous over the loop (except bursts and noise).
+ */
+class TestSourceScenario
+{
+public:
+    enum CarrierType
+    {
+        CarrierNFM,
+        CarrierAM,
+        CarrierUSB,
+        CarrierLSB,
+        CarrierBurst,
+        CarrierNoise
+    };
+
+    struct Carrier
+    {
+        CarrierType m_type;
+        int m_offset; //!< Hz
+        float m_level; //!< dB relative to full scale
+        int m_param;
+    };
+
+    TestSourceScenario();
+
+    void setDefinition(const QString& definition);
+    void setSampleRate(int sampleRate);
+    void setFrequencyShift(int frequencyShift);
+    unsigned int getNbCarriers() const { return m_carriers.size(); }
+
+    /** Write nbSamples interleaved I/Q samples. The table is rebuilt first if anything has changed. */
+    void generate(qint16 *buf, int nbSamples, float amplitudeI, float amplitudeQ, qint16 dc, float phaseImbalance);
+
+    /** Returns false if any carrier definition is invalid. The valid ones are still appended. */
+    static bool parse(const QString& definition, std::vector<Carrier>& carriers);
+    static const char *m_defaultDefinition;
+
+private:
+    QString m_definition;
+    std::vector<Carrier> m_carriers;
+    int m_sampleRate;
+    int m_frequencyShift;
+    bool m_dirty;
+    std::vector<float> m_re;
+    std::vector<float> m_im;
+    unsigned int m_index; //!< next table sample to play
+
+    static const unsigned int m_tableSize = 1<<18;
+    static const unsigned int m_maxCarriers = 1024;
+    static const int m_burstOnMs = 20;
+    static const int m_burstPeriodMs = 100;
+
+    void build();
+    unsigned int toBin(double frequency) const;
+    void addVoice(const Carrier& carrier, const std::vector<float>& cosTable, const std::vector<float>& sinTable);
+    void addBurst(const Carrier& carrier, const std::vector<float>& cosTable, const std::vector<float>& sinTable);
+    void addNoise(const Carrier& carrier);
+};
+
+#endif /* _TESTSOURCE_TESTSOURCESCENARIO_H_ */
@@ -18,6 +18,7 @@
 #include <QtGlobal>
 #include "util/simpleserializer.h"
 #include "testsourcesettings.h"
+#include "testsourcescenario.h"
 
 TestSourceSettings::TestSourceSettings()
 {
@@ -42,6 +43,7 @@ void TestSourceSettings::resetToDefaults()
     m_iFactor = 0.0f;
     m_qFactor = 0.0f;
     m_phaseImbalance = 0.0f;
+    m_scenario = TestSourceScenario::m_defaultDefinition;
     m_useReverseAPI = false;
     m_reverseAPIAddress = "127.0.0.1";
     m_reverseAPIPort = 8888;
@@ -71,6 +73,7 @@ QByteArray TestSourceSettings::serialize() const
     s.writeString(19, m_reverseAPIAddress);
     s.writeU32(20, m_reverseAPIPort);
     s.writeU32(21, m_reverseAPIDeviceIndex);
+    s.writeString(22, m_scenario);
     return s.final();
 }
 
@@ -132,6 +135,7 @@ bool TestSourceSettings::deserialize(const QByteArray& data)
 
         d.readU32(21, &utmp, 0);
         m_reverseAPIDeviceIndex = utmp > 99 ? 99 : utmp;
+        d.readString(22, &m_scenario, TestSourceScenario::m_defaultDefinition);
 
         return true;
     }
@@ -41,6 +41,7 @@ struct TestSourceSettings {
         ModulationPattern0,
         ModulationPattern1,
         ModulationPattern2,
+        ModulationScenario,
         ModulationLast
     } Modulation;
 
@@ -60,6 +61,7 @@ struct TestSourceSettings {
     float m_iFactor;        //!< -1.0 < x < 1.0
     float m_qFactor;        //!< -1.0 < x < 1.0
     float m_phaseImbalance; //!< -1.0 < x < 1.0
+    QString m_scenario;     //!< carriers definition of the scenario modulation (see TestSourceScenario)
     bool m_useReverseAPI;
     QString m_reverseAPIAddress;
     uint16_t m_reverseAPIPort;
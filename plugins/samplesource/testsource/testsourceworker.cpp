@@ -97,6 +97,7 @@ void TestSourceWorker::setSamplerate(int samplerate)
     m_throttleToggle = !m_throttleToggle;
 	m_nco.setFreq(m_frequencyShift, m_samplerate);
 	m_toneNco.setFreq(m_toneFrequency, m_samplerate);
+    m_scenario.setSampleRate(m_samplerate);
 }
 
 void TestSourceWorker::setLog2Decimation(unsigned int log2_decim)
@@ -162,7 +163,9 @@ void TestSourceWorker::setPhaseImbalance(float phaseImbalance)
 
 void TestSourceWorker::setFrequencyShift(int shift)
 {
+    QMutexLocker mutexLocker(&m_mutex);
     m_nco.setFreq(shift, m_samplerate);
+    m_scenario.setFrequencyShift(shift);
 }
 
 void TestSourceWorker::setToneFrequency(int toneFrequency)
@@ -187,6 +190,12 @@ void TestSourceWorker::setFMDeviation(float deviation)
     qDebug("TestSourceWorker::setFMDeviation: m_fmDeviationUnit: %f", m_fmDeviationUnit);
 }
 
+void TestSourceWorker::setScenario(const QString& scenario)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_scenario.setDefinition(scenario);
+}
+
 void TestSourceWorker::setBuffers(quint32 chunksize)
 {
     if (chunksize > m_bufsize)
@@ -218,6 +227,14 @@ void TestSourceWorker::generate(quint32 chunksize)
     int n = chunksize / 2;
     setBuffers(chunksize);
 
+    if (m_modulation == TestSourceSettings::ModulationScenario) // the table is (re)built here in the worker thread if needed
+    {
+        QMutexLocker mutexLocker(&m_mutex);
+        m_scenario.generate(m_buf, n/2, m_amplitudeBitsI, m_amplitudeBitsQ, m_amplitudeBitsDC, m_phaseImbalance);
+        callback(m_buf, n);
+        return;
+    }
+
     for (int i = 0; i < n-1;)
     {
         switch (m_modulation)
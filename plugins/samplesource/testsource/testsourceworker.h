@@ -32,6 +32,7 @@
 #include "util/messagequeue.h"
 
 #include "testsourcesettings.h"
+#include "testsourcescenario.h"
 
 #define TESTSOURCE_THROTTLE_MS 50
 
@@ -58,6 +59,7 @@ public:
     void setModulation(TestSourceSettings::Modulation modulation);
     void setAMModulation(float amModulation);
     void setFMDeviation(float deviation);
+    void setScenario(const QString& scenario);
     void setPattern0();
     void setPattern1();
     void setPattern2();
@@ -83,6 +85,7 @@ private:
     uint32_t m_pulsePatternCount;
     uint32_t m_pulsePatternCycle;
     uint32_t m_pulsePatternPlaces;
+    TestSourceScenario m_scenario;
 
 	int m_samplerate;
     unsigned int m_log2Decim;
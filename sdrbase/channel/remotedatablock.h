@@ -129,6 +129,7 @@ struct RemoteTxControlBlock
     int m_txDelay;
     QString m_dataAddress;
     uint16_t m_dataPort;
+    QString m_sharedMemoryName; //!< send in this shared memory ring instead of UDP if not empty
 
     RemoteTxControlBlock() {
         m_complete = false;
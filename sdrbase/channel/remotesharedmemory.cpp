@@ -0,0 +1,431 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// Remote sink to remote input transport in shared memory between two processes //
+// on the same host.                                                             //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <errno.h>
+#include <string.h>
+#include <algorithm>
+#include <new>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef __linux__
+#include <limits.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#endif
+
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include "remotesharedmemory.h"
+
+/**
+ * Control data at the start of the shared memory object followed by the blocks.
+ * Only lock-free atomics are used so they work across processes.
+ */
+struct RemoteSharedMemory::Header
+{
+    quint32 m_version;
+    quint32 m_blockSize;
+    quint32 m_nbBlocks;                   //!< power of 2
+    std::atomic<quint32> m_ready;         //!< m_magic when initialized by the creator
+    std::atomic<qint64> m_writerPid;      //!< 0 if no writer attached
+    std::atomic<qint64> m_readerPid;      //!< 0 if no reader attached
+    std::atomic<quint64> m_droppedFrames;
+    std::atomic<quint32> m_writeCount;    //!< incremented on each frame written (futex word)
+    std::atomic<quint32> m_waiters;       //!< reader waiting on the futex
+    alignas(64) std::atomic<quint64> m_writeIndex; //!< blocks written since creation
+    alignas(64) std::atomic<quint64> m_readIndex;  //!< blocks read since creation
+};
+
+// blocks start at this offset from the start of the shared memory object
+static const std::size_t headerSize = 512;
+
+const quint32 RemoteSharedMemory::m_magic = 0x53444752; // SDRG
+const quint32 RemoteSharedMemory::m_version = 1;
+
+RemoteSharedMemory::RemoteSharedMemory() :
+    m_writer(false),
+    m_fd(-1),
+    m_mappedSize(0),
+    m_header(nullptr),
+    m_blocks(nullptr),
+    m_lastWriteCount(0)
+{
+    static_assert(sizeof(Header) <= headerSize, "RemoteSharedMemory header too large");
+}
+
+RemoteSharedMemory::~RemoteSharedMemory()
+{
+    close();
+}
+
+QString RemoteSharedMemory::getObjectName(const QString& name)
+{
+    QString objectName = name;
+    objectName.replace('/', '_');
+    return QString("/sdrangel.%1").arg(objectName);
+}
+
+#ifdef _WIN32
+
+bool RemoteSharedMemory::open(const QString& name, bool writer, unsigned int nbBlocks)
+{
+    (void) writer;
+    (void) nbBlocks;
+    qWarning("RemoteSharedMemory::open: %s: shared memory transport is not supported on Windows", qPrintable(name));
+    return false;
+}
+
+void RemoteSharedMemory::close()
+{}
+
+#else
+
+// a process we are not allowed to signal (EPERM) still exists
+static bool isProcessAlive(qint64 pid)
+{
+    return (pid != 0) && ((kill((pid_t) pid, 0) == 0) || (errno == EPERM));
+}
+
+bool RemoteSharedMemory::open(const QString& name, bool writer, unsigned int nbBlocks)
+{
+    close();
+
+    QByteArray objectName = getObjectName(name).toLatin1();
+    bool created = false;
+    m_fd = shm_open(objectName.constData(), O_RDWR | O_CREAT | O_EXCL, 0600);
+
+    if (m_fd >= 0)
+    {
+        created = true;
+        unsigned int size = 2;
+
+        while (size < nbBlocks) {
+            size <<= 1;
+        }
+
+        m_mappedSize = headerSize + size * sizeof(RemoteSuperBlock);
+
+        if (ftruncate(m_fd, m_mappedSize) < 0)
+        {
+            qWarning("RemoteSharedMemory::open: %s: cannot set size: %s", objectName.constData(), strerror(errno));
+            ::close(m_fd);
+            shm_unlink(objectName.constData());
+            m_fd = -1;
+            return false;
+        }
+    }
+    else if (errno == EEXIST)
+    {
+        m_fd = shm_open(objectName.constData(), O_RDWR, 0);
+        QElapsedTimer timer;
+        timer.start();
+        struct stat st;
+
+        // the creator may not have set the size yet
+        while ((m_fd >= 0) && (fstat(m_fd, &st) == 0) && (st.st_size < (off_t) headerSize) && (timer.elapsed() < 1000)) {
+            QThread::msleep(10);
+        }
+
+        if ((m_fd < 0) || (fstat(m_fd, &st) != 0) || (st.st_size < (off_t) headerSize))
+        {
+            qWarning("RemoteSharedMemory::open: %s: cannot open: %s", objectName.constData(), strerror(errno));
+
+            if (m_fd >= 0) {
+                ::close(m_fd);
+            }
+
+            m_fd = -1;
+            return false;
+        }
+
+        m_mappedSize = st.st_size;
+    }
+    else
+    {
+        qWarning("RemoteSharedMemory::open: %s: cannot create: %s", objectName.constData(), strerror(errno));
+        return false;
+    }
+
+    void *address = mmap(nullptr, m_mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, 0);
+
+    if (address == MAP_FAILED)
+    {
+        qWarning("RemoteSharedMemory::open: %s: cannot map: %s", objectName.constData(), strerror(errno));
+        ::close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+
+    Header *header = (Header *) address;
+
+    if (created)
+    {
+        header = new (address) Header(); // zero initialized by ftruncate
+        header->m_version = m_version;
+        header->m_blockSize = sizeof(RemoteSuperBlock);
+        header->m_nbBlocks = (m_mappedSize - headerSize) / sizeof(RemoteSuperBlock);
+        header->m_ready.store(m_magic, std::memory_order_release);
+    }
+    else
+    {
+        QElapsedTimer timer;
+        timer.start();
+
+        while ((header->m_ready.load(std::memory_order_acquire) != m_magic) && (timer.elapsed() < 1000)) {
+            QThread::msleep(10);
+        }
+
+        if ((header->m_ready.load(std::memory_order_acquire) != m_magic)
+         || (header->m_version != m_version)
+         || (header->m_blockSize != sizeof(RemoteSuperBlock))
+         || (m_mappedSize != headerSize + (std::size_t) header->m_nbBlocks * sizeof(RemoteSuperBlock)))
+        {
+            qWarning("RemoteSharedMemory::open: %s: incompatible shared memory object", objectName.constData());
+            munmap(address, m_mappedSize);
+            ::close(m_fd);
+            m_fd = -1;
+            return false;
+        }
+    }
+
+    // only one attachment per side, including from this process. A process that died without closing is replaced.
+    std::atomic<qint64>& pid = writer ? header->m_writerPid : header->m_readerPid;
+    qint64 currentPid = pid.load();
+
+    if (isProcessAlive(currentPid) || !pid.compare_exchange_strong(currentPid, (qint64) getpid()))
+    {
+        qWarning("RemoteSharedMemory::open: %s: already opened for %s by process %lld",
+            objectName.constData(), writer ? "writing" : "reading", currentPid);
+        munmap(address, m_mappedSize);
+        ::close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+
+    m_header = header;
+    m_blocks = (RemoteSuperBlock *) ((char *) address + headerSize);
+    m_name = name;
+    m_writer = writer;
+
+    if (!writer)
+    {
+        // start from what is written from now on
+        m_header->m_readIndex.store(m_header->m_writeIndex.load(std::memory_order_acquire), std::memory_order_release);
+        m_lastWriteCount = m_header->m_writeCount.load(std::memory_order_acquire);
+    }
+
+    qDebug("RemoteSharedMemory::open: %s: %s %s with %u blocks", objectName.constData(),
+        created ? "created" : "opened", writer ? "for writing" : "for reading", m_header->m_nbBlocks);
+
+    return true;
+}
+
+void RemoteSharedMemory::close()
+{
+    if (!m_header) {
+        return;
+    }
+
+    std::atomic<qint64>& pid = m_writer ? m_header->m_writerPid : m_header->m_readerPid;
+    std::atomic<qint64>& peerPid = m_writer ? m_header->m_readerPid : m_header->m_writerPid;
+    pid.store(0);
+
+    if (!m_writer) {
+        wakeReader();
+    }
+
+    if (!isProcessAlive(peerPid.load())) // last one leaving removes the object. So does a survivor of a dead peer
+    {
+        qDebug("RemoteSharedMemory::close: remove %s", qPrintable(getObjectName(m_name)));
+        shm_unlink(getObjectName(m_name).toLatin1().constData());
+    }
+
+    munmap((void *) m_header, m_mappedSize);
+    ::close(m_fd);
+    m_fd = -1;
+    m_header = nullptr;
+    m_blocks = nullptr;
+}
+
+#endif // _WIN32
+
+bool RemoteSharedMemory::writeBlocks(const RemoteSuperBlock *blocks, unsigned int nbBlocks)
+{
+    if (!m_header) {
+        return false;
+    }
+
+    if (m_header->m_readerPid.load(std::memory_order_relaxed) == 0) {
+        return true; // nobody to read: discard
+    }
+
+    quint64 writeIndex = m_header->m_writeIndex.load(std::memory_order_relaxed);
+    quint64 readIndex = m_header->m_readIndex.load(std::memory_order_acquire);
+    quint32 mask = m_header->m_nbBlocks - 1;
+
+    if (writeIndex - readIndex + nbBlocks > m_header->m_nbBlocks)
+    {
+        m_header->m_droppedFrames.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    for (unsigned int i = 0; i < nbBlocks; i++) {
+        m_blocks[(writeIndex + i) & mask] = blocks[i];
+    }
+
+    m_header->m_writeIndex.store(writeIndex + nbBlocks, std::memory_order_release);
+    m_header->m_writeCount.fetch_add(1, std::memory_order_release);
+
+#ifdef __linux__
+    if (m_header->m_waiters.load() != 0) {
+        syscall(SYS_futex, (int *) &m_header->m_writeCount, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+#endif
+
+    return true;
+}
+
+unsigned int RemoteSharedMemory::readBlocks(RemoteSuperBlock *blocks, unsigned int nbBlocks)
+{
+    if (!m_header) {
+        return 0;
+    }
+
+    quint64 readIndex = m_header->m_readIndex.load(std::memory_order_relaxed);
+    quint64 writeIndex = m_header->m_writeIndex.load(std::memory_order_acquire);
+    quint32 mask = m_header->m_nbBlocks - 1;
+    unsigned int count = std::min((quint64) nbBlocks, writeIndex - readIndex);
+
+    for (unsigned int i = 0; i < count; i++) {
+        blocks[i] = m_blocks[(readIndex + i) & mask];
+    }
+
+    m_header->m_readIndex.store(readIndex + count, std::memory_order_release);
+    return count;
+}
+
+bool RemoteSharedMemory::waitWrite(int timeoutMs)
+{
+    if (!m_header)
+    {
+        QThread::msleep(timeoutMs);
+        return false;
+    }
+
+    quint32 writeCount = m_header->m_writeCount.load(std::memory_order_acquire);
+
+    if (writeCount == m_lastWriteCount)
+    {
+#ifdef __linux__
+        struct timespec timeout;
+        timeout.tv_sec = timeoutMs / 1000;
+        timeout.tv_nsec = (timeoutMs % 1000) * 1000000L;
+        m_header->m_waiters.fetch_add(1);
+        // returns immediately if the count changed in the meantime
+        syscall(SYS_futex, (int *) &m_header->m_writeCount, FUTEX_WAIT, (int) writeCount, &timeout, nullptr, 0);
+        m_header->m_waiters.fetch_sub(1);
+#else
+        QElapsedTimer timer;
+        timer.start();
+
+        while ((m_header->m_writeCount.load(std::memory_order_acquire) == writeCount) && (timer.elapsed() < timeoutMs)) {
+            QThread::msleep(1);
+        }
+#endif
+        writeCount = m_header->m_writeCount.load(std::memory_order_acquire);
+    }
+
+    bool written = writeCount != m_lastWriteCount;
+    m_lastWriteCount = writeCount;
+    return written;
+}
+
+void RemoteSharedMemory::wakeReader()
+{
+#ifdef __linux__
+    if (m_header) {
+        syscall(SYS_futex, (int *) &m_header->m_writeCount, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+    }
+#endif
+}
+
+unsigned int RemoteSharedMemory::getFill() const
+{
+    if (!m_header) {
+        return 0;
+    }
+
+    return m_header->m_writeIndex.load(std::memory_order_acquire) - m_header->m_readIndex.load(std::memory_order_acquire);
+}
+
+unsigned int RemoteSharedMemory::getSize() const
+{
+    return m_header ? m_header->m_nbBlocks : 0;
+}
+
+quint64 RemoteSharedMemory::getDroppedFrames() const
+{
+    return m_header ? m_header->m_droppedFrames.load(std::memory_order_relaxed) : 0;
+}
+
+bool RemoteSharedMemory::isPeerAttached() const
+{
+    if (!m_header) {
+        return false;
+    }
+
+    return (m_writer ? m_header->m_readerPid.load() : m_header->m_writerPid.load()) != 0;
+}
+
+RemoteSharedMemoryNotifier::RemoteSharedMemoryNotifier(RemoteSharedMemory *sharedMemory, QObject *parent) :
+    QThread(parent),
+    m_sharedMemory(sharedMemory),
+    m_stop(false)
+{}
+
+RemoteSharedMemoryNotifier::~RemoteSharedMemoryNotifier()
+{
+    stopWork();
+}
+
+void RemoteSharedMemoryNotifier::stopWork()
+{
+    m_stop.store(true);
+    m_sharedMemory->wakeReader();
+    wait();
+}
+
+void RemoteSharedMemoryNotifier::run()
+{
+    while (!m_stop.load())
+    {
+        if (m_sharedMemory->waitWrite(100)) {
+            emit dataReady();
+        }
+    }
+}
@@ -0,0 +1,116 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// Remote sink to remote input transport in shared memory between two processes //
+// on the same host.                                                             //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CHANNEL_REMOTESHAREDMEMORY_H_
+#define CHANNEL_REMOTESHAREDMEMORY_H_
+
+#include <atomic>
+
+#include <QString>
+#include <QThread>
+
+#include "channel/remotedatablock.h"
+#include "export.h"
+
+/**
+ * Ring of RemoteSuperBlock in a POSIX shared memory object (/dev/shm/sdrangel.<name> on Linux)
+ * with one writer process (Remote Sink) and one reader process (Remote Input).
+ *
+ * Blocks are the same as the ones sent over UDP including the meta data (RemoteMetaDataFEC)
+ * in block zero of each frame so the reader feeds them to the same decoding buffer. Since
+ * nothing gets lost only the original blocks are written (no FEC). A frame is written entirely
+ * or dropped if there is not enough room and the writer never waits for the reader.
+ *
+ * The reader is woken up on each frame written with a futex in the shared memory (Linux) or
+ * polls every millisecond elsewhere. Not available on Windows.
+ */
+class SDRBASE_API RemoteSharedMemory
+{
+public:
+    RemoteSharedMemory();
+    ~RemoteSharedMemory();
+
+    /**
+     * Attach to the shared memory ring creating it if necessary. The first side opening it
+     * sets the ring size. The object is removed from the system when both sides are closed.
+     * @param name Ring identification (shared by both sides)
+     * @param writer true for the writer side
+     * @param nbBlocks Size of the ring in blocks if created. Rounded up to a power of 2.
+     */
+    bool open(const QString& name, bool writer, unsigned int nbBlocks = 8192);
+    void close();
+    bool isOpen() const { return m_header != nullptr; }
+    const QString& getName() const { return m_name; }
+
+    /** Writer: write the blocks of a frame. Returns false if the frame was dropped because the ring is full. */
+    bool writeBlocks(const RemoteSuperBlock *blocks, unsigned int nbBlocks);
+    /** Reader: read up to nbBlocks blocks without waiting and return the number of blocks read */
+    unsigned int readBlocks(RemoteSuperBlock *blocks, unsigned int nbBlocks);
+    /** Reader: wait until something was written since the last call or timeout. Returns true if woken by a write. */
+    bool waitWrite(int timeoutMs);
+    /** Reader: wake up a thread waiting in waitWrite (for example to stop it) */
+    void wakeReader();
+
+    unsigned int getFill() const;          //!< Blocks waiting to be read
+    unsigned int getSize() const;          //!< Ring size in blocks
+    quint64 getDroppedFrames() const;      //!< Frames dropped by the writer because the ring was full
+    bool isPeerAttached() const;           //!< The other side has the ring opened
+
+private:
+    struct Header;
+
+    QString m_name;
+    bool m_writer;
+    int m_fd;
+    std::size_t m_mappedSize;
+    Header *m_header;
+    RemoteSuperBlock *m_blocks;
+    quint32 m_lastWriteCount;              //!< Reader: last write count seen by waitWrite
+
+    static const quint32 m_magic;
+    static const quint32 m_version;
+
+    static QString getObjectName(const QString& name);
+};
+
+/**
+ * Thread of the reader side waiting for the writer and signaling each frame written.
+ * Data is read in the thread of the receiver of the signal.
+ */
+class SDRBASE_API RemoteSharedMemoryNotifier : public QThread
+{
+    Q_OBJECT
+public:
+    RemoteSharedMemoryNotifier(RemoteSharedMemory *sharedMemory, QObject *parent = nullptr);
+    ~RemoteSharedMemoryNotifier();
+    void stopWork();
+
+signals:
+    void dataReady();
+
+protected:
+    virtual void run();
+
+private:
+    RemoteSharedMemory *m_sharedMemory;
+    std::atomic<bool> m_stop;
+};
+
+#endif /* CHANNEL_REMOTESHAREDMEMORY_H_ */
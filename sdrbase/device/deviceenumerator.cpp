@@ -15,12 +15,73 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+
 #include <QGlobalStatic>
+#include <QThreadPool>
+#include <QRunnable>
+#include <QElapsedTimer>
+#include <QDir>
+#include <QFile>
+#include <QDataStream>
 
 #include "plugin/pluginmanager.h"
 
 #include "deviceenumerator.h"
 
+namespace {
+
+class OriginDevicesEnumeration : public QRunnable
+{
+public:
+    explicit OriginDevicesEnumeration(PluginInterface *plugin) :
+        m_plugin(plugin),
+        m_nsecs(0)
+    {
+        setAutoDelete(false);
+    }
+
+    void run() override
+    {
+        QElapsedTimer timer;
+        timer.start();
+        m_plugin->enumOriginDevices(m_hwIds, m_originDevices);
+        m_nsecs = timer.nsecsElapsed();
+    }
+
+    PluginInterface *m_plugin;
+    QStringList m_hwIds;
+    PluginInterface::OriginDevices m_originDevices;
+    qint64 m_nsecs;
+};
+
+// runs enumerations one after the other in the same task
+class SequentialOriginDevicesEnumeration : public QRunnable
+{
+public:
+    explicit SequentialOriginDevicesEnumeration(const std::vector<OriginDevicesEnumeration*>& enumerations) :
+        m_enumerations(enumerations)
+    {}
+
+    void run() override
+    {
+        for (auto enumeration : m_enumerations) {
+            enumeration->run();
+        }
+    }
+
+private:
+    std::vector<OriginDevicesEnumeration*> m_enumerations;
+};
+
+// hardware IDs of the plugins that list their devices without opening any hardware
+const QStringList listOnlyHardwareIds = {
+    "FileInput", "FileOutput", "KiwiSDR", "LocalInput", "LocalOutput",
+    "RemoteInput", "RemoteOutput", "TestMI", "TestSink", "TestSource"
+};
+
+}
+
 Q_GLOBAL_STATIC(DeviceEnumerator, deviceEnumerator)
 DeviceEnumerator *DeviceEnumerator::instance()
 {
@@ -181,6 +242,206 @@ bool DeviceEnumerator::isTxEnumerated(const QString& deviceHwId, int deviceSeque
     return false;
 }
 
+bool DeviceEnumerator::isEnumerationFiltered(const QString& deviceHwId) const
+{
+    if (m_enumerationFilter.isEmpty()) {
+        return false;
+    }
+
+    // file devices and test MIMO are the default devices and are always enumerated
+    if ((deviceHwId == PluginManager::getFileInputHardwareId())
+     || (deviceHwId == PluginManager::getFileOutputHardwareId())
+     || (deviceHwId == PluginManager::getTestMIMOHardwareId())) {
+        return false;
+    }
+
+    return !m_enumerationFilter.contains(deviceHwId, Qt::CaseInsensitive);
+}
+
+QString DeviceEnumerator::getUSBTopology()
+{
+    QString topology;
+#if defined(__linux__)
+    QDir usbDevicesDir("/sys/bus/usb/devices");
+    QStringList usbDevices = usbDevicesDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot, QDir::Name);
+
+    for (const auto& usbDevice : usbDevices)
+    {
+        QFile vendorFile(usbDevicesDir.filePath(usbDevice + "/idVendor"));
+
+        if (!vendorFile.open(QIODevice::ReadOnly)) { // interfaces have no vendor
+            continue;
+        }
+
+        QFile productFile(usbDevicesDir.filePath(usbDevice + "/idProduct"));
+        QFile serialFile(usbDevicesDir.filePath(usbDevice + "/serial"));
+        productFile.open(QIODevice::ReadOnly);
+        serialFile.open(QIODevice::ReadOnly);
+        topology += QString("%1:%2:%3:%4;")
+            .arg(usbDevice)
+            .arg(QString(vendorFile.readAll().trimmed()))
+            .arg(QString(productFile.readAll().trimmed()))
+            .arg(QString(serialFile.readAll().trimmed()));
+    }
+#endif
+    return topology;
+}
+
+bool DeviceEnumerator::loadEnumerationCache(const QString& key, PluginInterface::OriginDevices& originDevices, QStringList& hwIds)
+{
+    QFile cacheFile(m_enumerationCacheFile);
+
+    if (!cacheFile.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&cacheFile);
+    quint32 version;
+    QString cacheKey;
+    stream >> version >> cacheKey;
+
+    if ((version != 1) || (cacheKey != key))
+    {
+        qDebug("DeviceEnumerator::loadEnumerationCache: cache outdated");
+        return false;
+    }
+
+    quint32 nbOriginDevices;
+    stream >> hwIds >> nbOriginDevices;
+
+    for (quint32 i = 0; (i < nbOriginDevices) && (stream.status() == QDataStream::Ok); i++)
+    {
+        QString displayableName, hardwareId, serial;
+        qint32 sequence, nbRxStreams, nbTxStreams;
+        stream >> displayableName >> hardwareId >> serial >> sequence >> nbRxStreams >> nbTxStreams;
+        originDevices.append(PluginInterface::OriginDevice(displayableName, hardwareId, serial, sequence, nbRxStreams, nbTxStreams));
+    }
+
+    if (stream.status() != QDataStream::Ok)
+    {
+        qWarning("DeviceEnumerator::loadEnumerationCache: corrupted cache %s", qPrintable(m_enumerationCacheFile));
+        originDevices.clear();
+        hwIds.clear();
+        return false;
+    }
+
+    return true;
+}
+
+void DeviceEnumerator::saveEnumerationCache(const QString& key, const PluginInterface::OriginDevices& originDevices, const QStringList& hwIds)
+{
+    QFile cacheFile(m_enumerationCacheFile);
+
+    if (!cacheFile.open(QIODevice::WriteOnly))
+    {
+        qWarning("DeviceEnumerator::saveEnumerationCache: cannot write %s", qPrintable(m_enumerationCacheFile));
+        return;
+    }
+
+    QDataStream stream(&cacheFile);
+    stream << (quint32) 1 << key << hwIds << (quint32) originDevices.size();
+
+    for (const auto& originDevice : originDevices)
+    {
+        stream << originDevice.displayableName << originDevice.hardwareId << originDevice.serial
+            << (qint32) originDevice.sequence << (qint32) originDevice.nbRxStreams << (qint32) originDevice.nbTxStreams;
+    }
+}
+
+void DeviceEnumerator::enumerateOriginDevices(PluginManager *pluginManager)
+{
+    m_originDevices.clear();
+    m_originDevicesHwIds.clear();
+    m_enumerationTimings.clear();
+
+    // one plugin per hardware ID taken in the Rx, Tx, MIMO registrations order
+    const PluginAPI::SamplingDeviceRegistrations *registrations[3] = {
+        &pluginManager->getSourceDeviceRegistrations(),
+        &pluginManager->getSinkDeviceRegistrations(),
+        &pluginManager->getMIMODeviceRegistrations()
+    };
+    QStringList hwIds;
+    QList<PluginInterface*> plugins;
+
+    for (int i = 0; i < 3; i++)
+    {
+        for (const auto& registration : *registrations[i])
+        {
+            if (!isEnumerationFiltered(registration.m_deviceHardwareId) && !hwIds.contains(registration.m_deviceHardwareId))
+            {
+                hwIds.append(registration.m_deviceHardwareId);
+                plugins.append(registration.m_plugin);
+            }
+        }
+    }
+
+    QString cacheKey;
+
+    if (!m_enumerationCacheFile.isEmpty())
+    {
+        QString usbTopology = getUSBTopology();
+
+        if (usbTopology.isEmpty()) {
+            qInfo("DeviceEnumerator::enumerateOriginDevices: USB topology unavailable. Cache not used");
+        } else {
+            cacheKey = hwIds.join(",") + "|" + usbTopology;
+        }
+    }
+
+    if (!cacheKey.isEmpty() && loadEnumerationCache(cacheKey, m_originDevices, m_originDevicesHwIds))
+    {
+        qInfo("DeviceEnumerator::enumerateOriginDevices: %d devices from cache %s",
+            m_originDevices.size(), qPrintable(m_enumerationCacheFile));
+        return;
+    }
+
+    // Hardware probes open the devices (e.g. BladeRF, SoapySDR, XTRX) and concurrent opens
+    // race on the shared USB state. They run one after the other in a single task while the
+    // plugins that only list their devices run concurrently each in its own task.
+    QThreadPool threadPool;
+    threadPool.setMaxThreadCount(std::max(plugins.size(), 1));
+    std::vector<OriginDevicesEnumeration*> enumerations;
+    std::vector<OriginDevicesEnumeration*> hardwareEnumerations;
+
+    for (int i = 0; i < plugins.size(); i++)
+    {
+        enumerations.push_back(new OriginDevicesEnumeration(plugins[i]));
+
+        if (listOnlyHardwareIds.contains(hwIds[i])) {
+            threadPool.start(enumerations.back());
+        } else {
+            hardwareEnumerations.push_back(enumerations.back());
+        }
+    }
+
+    if (hardwareEnumerations.size() > 0) {
+        threadPool.start(new SequentialOriginDevicesEnumeration(hardwareEnumerations)); // auto deleted
+    }
+
+    threadPool.waitForDone();
+
+    for (unsigned int i = 0; i < enumerations.size(); i++)
+    {
+        m_originDevices.append(enumerations[i]->m_originDevices);
+
+        for (const auto& hwId : enumerations[i]->m_hwIds)
+        {
+            if (!m_originDevicesHwIds.contains(hwId)) {
+                m_originDevicesHwIds.append(hwId);
+            }
+        }
+
+        m_enumerationTimings.append(QPair<QString, qint64>(hwIds[i], enumerations[i]->m_nsecs));
+        qDebug("DeviceEnumerator::enumerateOriginDevices: %s: %d devices in %lld ms",
+            qPrintable(hwIds[i]), enumerations[i]->m_originDevices.size(), enumerations[i]->m_nsecs / 1000000);
+        delete enumerations[i];
+    }
+
+    if (!cacheKey.isEmpty()) {
+        saveEnumerationCache(cacheKey, m_originDevices, m_originDevicesHwIds);
+    }
+}
+
 void DeviceEnumerator::enumerateRxDevices(PluginManager *pluginManager)
 {
     m_rxEnumeration.clear();
@@ -189,8 +450,11 @@ void DeviceEnumerator::enumerateRxDevices(PluginManager *pluginManager)
 
     for (int i = 0; i < rxDeviceRegistrations.count(); i++)
     {
+        if (isEnumerationFiltered(rxDeviceRegistrations[i].m_deviceHardwareId)) {
+            continue;
+        }
+
         qDebug("DeviceEnumerator::enumerateRxDevices: %s", qPrintable(rxDeviceRegistrations[i].m_deviceId));
-        rxDeviceRegistrations[i].m_plugin->enumOriginDevices(m_originDevicesHwIds, m_originDevices);
         PluginInterface::SamplingDevices samplingDevices = rxDeviceRegistrations[i].m_plugin->enumSampleSources(m_originDevices);
 
         for (int j = 0; j < samplingDevices.count(); j++)
@@ -215,8 +479,11 @@ void DeviceEnumerator::enumerateTxDevices(PluginManager *pluginManager)
 
     for (int i = 0; i < txDeviceRegistrations.count(); i++)
     {
+        if (isEnumerationFiltered(txDeviceRegistrations[i].m_deviceHardwareId)) {
+            continue;
+        }
+
         qDebug("DeviceEnumerator::enumerateTxDevices: %s", qPrintable(txDeviceRegistrations[i].m_deviceId));
-        txDeviceRegistrations[i].m_plugin->enumOriginDevices(m_originDevicesHwIds, m_originDevices);
         PluginInterface::SamplingDevices samplingDevices = txDeviceRegistrations[i].m_plugin->enumSampleSinks(m_originDevices);
 
         for (int j = 0; j < samplingDevices.count(); j++)
@@ -241,8 +508,11 @@ void DeviceEnumerator::enumerateMIMODevices(PluginManager *pluginManager)
 
     for (int i = 0; i < mimoDeviceRegistrations.count(); i++)
     {
+        if (isEnumerationFiltered(mimoDeviceRegistrations[i].m_deviceHardwareId)) {
+            continue;
+        }
+
         qDebug("DeviceEnumerator::enumerateMIMODevices: %s", qPrintable(mimoDeviceRegistrations[i].m_deviceId));
-        mimoDeviceRegistrations[i].m_plugin->enumOriginDevices(m_originDevicesHwIds, m_originDevices);
         PluginInterface::SamplingDevices samplingDevices = mimoDeviceRegistrations[i].m_plugin->enumSampleMIMO(m_originDevices);
 
         for (int j = 0; j < samplingDevices.count(); j++)
@@ -388,6 +658,18 @@ int DeviceEnumerator::getFileOutputDeviceIndex() const
     return -1;
 }
 
+int DeviceEnumerator::getTestMIMODeviceIndex() const
+{
+    for (DevicesEnumeration::const_iterator it = m_mimoEnumeration.begin(); it != m_mimoEnumeration.end(); ++it)
+    {
+        if (it->m_samplingDevice.id == PluginManager::getTestMIMODeviceId()) {
+            return it->m_index;
+        }
+    }
+
+    return -1;
+}
+
 int DeviceEnumerator::getRxSamplingDeviceIndex(const QString& deviceId, int sequence)
 {
     for (DevicesEnumeration::iterator it = m_rxEnumeration.begin(); it != m_rxEnumeration.end(); ++it)
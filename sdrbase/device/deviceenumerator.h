@@ -20,6 +20,9 @@
 
 #include <vector>
 
+#include <QStringList>
+#include <QPair>
+
 #include "plugin/plugininterface.h"
 #include "device/deviceuserargs.h"
 #include "export.h"
@@ -34,6 +37,10 @@ public:
 
     static DeviceEnumerator *instance();
 
+    void setEnumerationFilter(const QStringList& hardwareIds) { m_enumerationFilter = hardwareIds; }
+    void setEnumerationCacheFile(const QString& fileName) { m_enumerationCacheFile = fileName; }
+    void enumerateOriginDevices(PluginManager *pluginManager);
+    const QList<QPair<QString, qint64>>& getEnumerationTimings() const { return m_enumerationTimings; }
     void enumerateRxDevices(PluginManager *pluginManager);
     void enumerateTxDevices(PluginManager *pluginManager);
     void enumerateMIMODevices(PluginManager *pluginManager);
@@ -58,6 +65,7 @@ public:
     PluginInterface *getMIMOPluginInterface(int deviceIndex) { return m_mimoEnumeration[deviceIndex].m_pluginInterface; }
     int getFileInputDeviceIndex() const;  //!< Get Rx default device
     int getFileOutputDeviceIndex() const;   //!< Get Tx default device
+    int getTestMIMODeviceIndex() const;     //!< Get MIMO default device
     int getRxSamplingDeviceIndex(const QString& deviceId, int sequence);
     int getTxSamplingDeviceIndex(const QString& deviceId, int sequence);
     int getMIMOSamplingDeviceIndex(const QString& deviceId, int sequence);
@@ -83,6 +91,14 @@ private:
     DevicesEnumeration m_mimoEnumeration;
     PluginInterface::OriginDevices m_originDevices;
     QStringList m_originDevicesHwIds;
+    QStringList m_enumerationFilter;   //!< hardware IDs of the devices to enumerate. All devices if empty.
+    QString m_enumerationCacheFile;    //!< origin devices cache file. No cache if empty.
+    QList<QPair<QString, qint64>> m_enumerationTimings; //!< time in ns spent to enumerate each hardware ID
+
+    bool isEnumerationFiltered(const QString& deviceHwId) const;
+    static QString getUSBTopology();
+    bool loadEnumerationCache(const QString& key, PluginInterface::OriginDevices& originDevices, QStringList& hwIds);
+    void saveEnumerationCache(const QString& key, const PluginInterface::OriginDevices& originDevices, const QStringList& hwIds);
 
     PluginInterface *getRxRegisteredPlugin(PluginManager *pluginManager, const QString& deviceHwId);
     PluginInterface *getTxRegisteredPlugin(PluginManager *pluginManager, const QString& deviceHwId);
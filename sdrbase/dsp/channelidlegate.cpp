@@ -0,0 +1,148 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "channelidlegate.h"
+
+ChannelIdleGate::ChannelIdleGate() :
+    m_sampleRate(0),
+    m_threshold(0.0),
+    m_idle(false),
+    m_quietSamples(0),
+    m_holdSamples(0),
+    m_historyIndex(0),
+    m_historyCount(0),
+    m_magsqSum(0.0),
+    m_magsqPeak(0.0),
+    m_magsqCount(0)
+{
+    setSampleRate(48000);
+}
+
+void ChannelIdleGate::setSampleRate(int sampleRate)
+{
+    if (sampleRate == m_sampleRate) {
+        return;
+    }
+
+    m_sampleRate = sampleRate;
+    m_holdSamples = (sampleRate / 1000) * m_holdMs;
+    m_history.resize((sampleRate / 1000) * m_prerollMs);
+    m_preroll.reserve(m_history.size());
+    m_historyIndex = 0;
+    m_historyCount = 0;
+    m_quietSamples = 0;
+    m_idle = false;
+}
+
+void ChannelIdleGate::setThreshold(double threshold)
+{
+    m_threshold = threshold;
+    m_quietSamples = 0;
+    m_idle = false;
+}
+
+bool ChannelIdleGate::feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool squelchOpen)
+{
+    m_preroll.clear();
+
+    if (!isEnabled())
+    {
+        m_idle = false;
+        return true;
+    }
+
+    measure(begin, end);
+    bool quiet = (m_magsqCount == 0) || (m_magsqSum / m_magsqCount < m_threshold);
+
+    if (m_idle)
+    {
+        if (quiet)
+        {
+            storeHistory(begin, end);
+            return false;
+        }
+
+        int historySize = m_history.size();
+        int start = (m_historyIndex - m_historyCount + historySize) % historySize;
+
+        for (int i = 0; i < m_historyCount; i++) {
+            m_preroll.push_back(m_history[(start + i) % historySize]);
+        }
+
+        m_idle = false;
+        m_quietSamples = 0;
+        return true;
+    }
+
+    if (quiet && !squelchOpen) {
+        m_quietSamples += end - begin;
+    } else {
+        m_quietSamples = 0;
+    }
+
+    if (m_quietSamples >= m_holdSamples) // the following blocks are skipped
+    {
+        m_idle = true;
+        m_historyIndex = 0;
+        m_historyCount = 0;
+    }
+
+    return true;
+}
+
+void ChannelIdleGate::measure(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    int nbSamples = end - begin;
+    double sum = 0.0;
+    double peak = 0.0;
+    int count = 0;
+
+    for (int i = 0; i < nbSamples; i += m_decimation, count++)
+    {
+        double re = begin[i].real();
+        double im = begin[i].imag();
+        double magsq = re*re + im*im;
+        sum += magsq;
+        peak = magsq > peak ? magsq : peak;
+    }
+
+    m_magsqSum = sum / (SDR_RX_SCALED*SDR_RX_SCALED);
+    m_magsqPeak = peak / (SDR_RX_SCALED*SDR_RX_SCALED);
+    m_magsqCount = count;
+}
+
+void ChannelIdleGate::storeHistory(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end)
+{
+    int historySize = m_history.size();
+
+    if (historySize == 0) {
+        return;
+    }
+
+    SampleVector::const_iterator it = (end - begin) > historySize ? end - historySize : begin;
+
+    while (it != end)
+    {
+        int count = std::min((int) (end - it), historySize - m_historyIndex);
+        std::copy(it, it + count, m_history.begin() + m_historyIndex);
+        it += count;
+        m_historyIndex = (m_historyIndex + count) % historySize;
+        m_historyCount = std::min(m_historyCount + count, historySize);
+    }
+}
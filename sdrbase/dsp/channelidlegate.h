@@ -0,0 +1,82 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_DSP_CHANNELIDLEGATE_H_
+#define SDRBASE_DSP_CHANNELIDLEGATE_H_
+
+#include "export.h"
+#include "dsptypes.h"
+
+/**
+ * Idle mode of a channel sink with a power squelch. It is fed with the channel samples before
+ * any processing and measures their power on one sample out of m_decimation per block.
+ *
+ * When the power stays below the threshold and the squelch is closed for the hold time the
+ * channel goes idle: the sink skips its demodulation chain entirely and only the power
+ * measurement runs. The last samples are kept and replayed on wake up (pre-roll) so that the
+ * NCO, interpolator and filters of the sink settle before the block that crossed the threshold.
+ *
+ * The power is measured on the whole channel sample rate band so it is an upper bound of the
+ * power in the demodulator bandwidth: a signal that would open the squelch always wakes the
+ * channel.
+ */
+class SDRBASE_API ChannelIdleGate
+{
+public:
+    ChannelIdleGate();
+
+    void setSampleRate(int sampleRate);
+    void setThreshold(double threshold); //!< power relative to full scale. 0 disables the idle mode
+    bool isEnabled() const { return m_threshold > 0.0; }
+    bool isIdle() const { return m_idle; }
+
+    /**
+     * Measure the block and update the idle state. Returns true when the block must go through
+     * the full demodulation chain. When the channel just woke up getPreroll() holds the samples
+     * preceding the block that must be processed first. It is empty otherwise.
+     */
+    bool feed(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end, bool squelchOpen);
+    const SampleVector& getPreroll() const { return m_preroll; }
+
+    // Power of the last block measured (samples relative to full scale)
+    double getMagsqSum() const { return m_magsqSum; }
+    double getMagsqPeak() const { return m_magsqPeak; }
+    int getMagsqCount() const { return m_magsqCount; }
+
+private:
+    int m_sampleRate;
+    double m_threshold;
+    bool m_idle;
+    int m_quietSamples;   //!< consecutive samples below threshold with squelch closed
+    int m_holdSamples;
+    SampleVector m_history; //!< ring of the last samples while idle
+    int m_historyIndex;
+    int m_historyCount;
+    SampleVector m_preroll;
+    double m_magsqSum;
+    double m_magsqPeak;
+    int m_magsqCount;
+
+    static const int m_decimation = 8;
+    static const int m_holdMs = 200;
+    static const int m_prerollMs = 20;
+
+    void measure(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+    void storeHistory(const SampleVector::const_iterator& begin, const SampleVector::const_iterator& end);
+};
+
+#endif // SDRBASE_DSP_CHANNELIDLEGATE_H_
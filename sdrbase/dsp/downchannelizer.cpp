@@ -35,6 +35,16 @@ DownChannelizer::DownChannelizer(ChannelSampleSink* sampleSink) :
     m_log2Decim(0),
     m_filterChainHash(0)
 {
+    m_metricsSamples = Metrics::instance().counter(
+        "sdrangel_channelizer_samples_total",
+        "Baseband samples processed by the channelizers",
+        {{"direction", "rx"}});
+    m_metricsWorkTime = Metrics::instance().histogram(
+        "sdrangel_channelizer_work_seconds",
+        "Time spent in one channelizer call including the channel",
+        Metrics::exponentialBuckets(1e-6, 4, 10),
+        {{"direction", "rx"}});
+    m_metricsTimer.start();
 }
 
 DownChannelizer::~DownChannelizer()
@@ -50,6 +60,8 @@ void DownChannelizer::feed(const SampleVector::const_iterator& begin, const Samp
 		return;
 	}
 
+    qint64 startNs = m_metricsTimer.nsecsElapsed();
+
 	if (m_filterStages.size() == 0) // optimization when no downsampling is done anyway
 	{
 		m_sampleSink->feed(begin, end);
@@ -85,6 +97,9 @@ void DownChannelizer::feed(const SampleVector::const_iterator& begin, const Samp
 		m_sampleSink->feed(m_sampleBuffer.begin(), m_sampleBuffer.end());
 		m_sampleBuffer.clear();
 	}
+
+    m_metricsSamples->inc(end - begin);
+    m_metricsWorkTime->observe((m_metricsTimer.nsecsElapsed() - startNs) * 1e-9);
 }
 
 void DownChannelizer::setChannelization(int requestedSampleRate, qint64 requestedCenterFrequency)
@@ -22,8 +22,11 @@
 #include <list>
 #include <vector>
 
+#include <QElapsedTimer>
+
 #include "export.h"
 #include "util/message.h"
+#include "util/metrics.h"
 #include "dsp/inthalfbandfiltereo.h"
 
 #include "channelsamplesink.h"
@@ -84,6 +87,9 @@ protected:
     unsigned int m_log2Decim;
     unsigned int m_filterChainHash;
 	SampleVector m_sampleBuffer;
+    QElapsedTimer m_metricsTimer;
+    Metrics::Counter *m_metricsSamples;
+    Metrics::Histogram *m_metricsWorkTime;
 
 	void applyChannelization();
     void applyDecimation();
@@ -226,6 +226,21 @@ private:
 
 };
 
+class SDRBASE_API DSPConfigureThreadPriority : public Message {
+	MESSAGE_CLASS_DECLARATION
+
+public:
+	DSPConfigureThreadPriority(int deviceSetIndex) :
+		Message(),
+		m_deviceSetIndex(deviceSetIndex)
+	{ }
+
+	int getDeviceSetIndex() const { return m_deviceSetIndex; }
+
+private:
+	int m_deviceSetIndex;
+};
+
 class SDRBASE_API DSPEngineReport : public Message {
 	MESSAGE_CLASS_DECLARATION
 
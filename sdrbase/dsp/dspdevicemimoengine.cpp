@@ -19,6 +19,7 @@
 #include <QDebug>
 
 #include "dspcommands.h"
+#include "dspengine.h"
 #include "basebandsamplesink.h"
 #include "basebandsamplesource.h"
 #include "devicesamplemimo.h"
@@ -811,13 +812,14 @@ void DSPDeviceMIMOEngine::handleSetMIMO(DeviceSampleMIMO* mimo)
         return;
     }
 
-    for (int i = 0; i < m_deviceSampleMIMO->getNbSinkFifos(); i++)
+    // grow only so that the channels attached to the streams of a previous device are kept
+    for (unsigned int i = m_basebandSampleSinks.size(); i < m_deviceSampleMIMO->getNbSinkFifos(); i++)
     {
         m_basebandSampleSinks.push_back(BasebandSampleSinks());
         m_sourcesCorrections.push_back(SourceCorrection());
     }
 
-    for (int i = 0; i < m_deviceSampleMIMO->getNbSourceFifos(); i++)
+    for (unsigned int i = m_basebandSampleSources.size(); i < m_deviceSampleMIMO->getNbSourceFifos(); i++)
     {
         m_basebandSampleSources.push_back(BasebandSampleSources());
         m_sourceSampleBuffers.push_back(IncrementalVector<Sample>());
@@ -1125,7 +1127,13 @@ void DSPDeviceMIMOEngine::handleInputMessages()
 	{
 		qDebug("DSPDeviceMIMOEngine::handleInputMessages: message: %s", message->getIdentifier());
 
-		if (ConfigureCorrection::match(*message))
+		if (DSPConfigureThreadPriority::match(*message))
+		{
+			DSPConfigureThreadPriority* conf = (DSPConfigureThreadPriority*) message;
+			DSPEngine::instance()->applyThreadPriority(conf->getDeviceSetIndex(), ThreadPriority::RoleEngine);
+			delete message;
+		}
+		else if (ConfigureCorrection::match(*message))
 		{
 			ConfigureCorrection* conf = (ConfigureCorrection*) message;
             unsigned int isource = conf->getIndex();
@@ -26,6 +26,7 @@
 #include "dsp/basebandsamplesink.h"
 #include "dsp/devicesamplesink.h"
 #include "dsp/dspcommands.h"
+#include "dsp/dspengine.h"
 #include "samplesourcefifodb.h"
 
 DSPDeviceSinkEngine::DSPDeviceSinkEngine(uint32_t uid, QObject* parent) :
@@ -39,6 +40,18 @@ DSPDeviceSinkEngine::DSPDeviceSinkEngine(uint32_t uid, QObject* parent) :
 	m_sampleRate(0),
 	m_centerFrequency(0)
 {
+    Metrics::Labels labels{{"engine", QString::number(uid)}, {"direction", "tx"}};
+    m_metricsWorkTime = Metrics::instance().histogram(
+        "sdrangel_dsp_engine_work_seconds",
+        "Time spent in one DSP engine work call",
+        Metrics::exponentialBuckets(1e-5, 4, 10),
+        labels);
+    m_metricsSamples = Metrics::instance().counter(
+        "sdrangel_dsp_engine_samples_total",
+        "Samples processed by the DSP engine",
+        labels);
+    m_metricsTimer.start();
+
 	connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()), Qt::QueuedConnection);
 	connect(&m_syncMessenger, SIGNAL(messageSent()), this, SLOT(handleSynchronousMessages()), Qt::QueuedConnection);
 
@@ -49,6 +62,7 @@ DSPDeviceSinkEngine::~DSPDeviceSinkEngine()
 {
     stop();
 	wait();
+    Metrics::instance().removeSeries({{"engine", QString::number(m_uid)}, {"direction", "tx"}});
 }
 
 void DSPDeviceSinkEngine::run()
@@ -166,6 +180,8 @@ void DSPDeviceSinkEngine::workSampleFifo()
     SampleVector& data = sourceFifo->getData();
     unsigned int iPart1Begin, iPart1End, iPart2Begin, iPart2End;
     unsigned int remainder = sourceFifo->remainder();
+    qint64 startNs = m_metricsTimer.nsecsElapsed();
+    std::size_t samplesDone = 0;
 
     while ((remainder > 0) && (m_inputMessageQueue.size() == 0))
     {
@@ -179,8 +195,12 @@ void DSPDeviceSinkEngine::workSampleFifo()
             workSamples(data, iPart2Begin, iPart2End);
         }
 
+        samplesDone += (iPart1End - iPart1Begin) + (iPart2End - iPart2Begin);
         remainder = sourceFifo->remainder();
     }
+
+    m_metricsSamples->inc(samplesDone);
+    m_metricsWorkTime->observe((m_metricsTimer.nsecsElapsed() - startNs) * 1e-9);
 }
 
 void DSPDeviceSinkEngine::workSamples(SampleVector& data, unsigned int iBegin, unsigned int iEnd)
@@ -503,7 +523,13 @@ void DSPDeviceSinkEngine::handleInputMessages()
 	{
 		qDebug("DSPDeviceSinkEngine::handleInputMessages: message: %s", message->getIdentifier());
 
-		if (DSPSignalNotification::match(*message))
+		if (DSPConfigureThreadPriority::match(*message))
+		{
+			DSPConfigureThreadPriority* conf = (DSPConfigureThreadPriority*) message;
+			DSPEngine::instance()->applyThreadPriority(conf->getDeviceSetIndex(), ThreadPriority::RoleEngine);
+			delete message;
+		}
+		else if (DSPSignalNotification::match(*message))
 		{
 			DSPSignalNotification *notif = (DSPSignalNotification *) message;
 
@@ -23,6 +23,7 @@
 #include <QTimer>
 #include <QMutex>
 #include <QWaitCondition>
+#include <QElapsedTimer>
 
 #include <stdint.h>
 #include <list>
@@ -33,6 +34,7 @@
 #include "util/messagequeue.h"
 #include "util/syncmessenger.h"
 #include "util/incrementalvector.h"
+#include "util/metrics.h"
 #include "export.h"
 
 class DeviceSampleSink;
@@ -105,6 +107,10 @@ private:
 	quint64 m_centerFrequency;
     unsigned int m_sumIndex; //!< channel index when summing channels
 
+    QElapsedTimer m_metricsTimer;
+    Metrics::Histogram *m_metricsWorkTime;
+    Metrics::Counter *m_metricsSamples;
+
 	void run();
 	void workSampleFifo(); //!< transfer samples from baseband sources to sink if in running state
     void workSamples(SampleVector& data, unsigned int iBegin, unsigned int iEnd);
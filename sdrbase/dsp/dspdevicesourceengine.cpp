@@ -23,7 +23,9 @@
 #include <stdio.h>
 #include <QDebug>
 #include "dsp/dspcommands.h"
+#include "dsp/dspengine.h"
 #include "util/fixed.h"
+#include "util/metrics.h"
 #include "samplesinkfifo.h"
 
 DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
@@ -43,6 +45,22 @@ DSPDeviceSourceEngine::DSPDeviceSourceEngine(uint uid, QObject* parent) :
 	m_qRange(1 << 16),
 	m_imbalance(65536)
 {
+    Metrics::Labels labels{{"engine", QString::number(uid)}, {"direction", "rx"}};
+    m_metricsWorkTime = Metrics::instance().histogram(
+        "sdrangel_dsp_engine_work_seconds",
+        "Time spent in one DSP engine work call",
+        Metrics::exponentialBuckets(1e-5, 4, 10),
+        labels);
+    m_metricsSamples = Metrics::instance().counter(
+        "sdrangel_dsp_engine_samples_total",
+        "Samples processed by the DSP engine",
+        labels);
+    m_metricsFifoFill = Metrics::instance().gauge(
+        "sdrangel_dsp_engine_fifo_fill_ratio",
+        "Fill of the device sample FIFO when the DSP engine starts working on it (0 to 1)",
+        labels);
+    m_metricsTimer.start();
+
 	connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleInputMessages()), Qt::QueuedConnection);
 	connect(&m_syncMessenger, SIGNAL(messageSent()), this, SLOT(handleSynchronousMessages()), Qt::QueuedConnection);
 
@@ -53,6 +71,7 @@ DSPDeviceSourceEngine::~DSPDeviceSourceEngine()
 {
     stop();
     wait();
+    Metrics::instance().removeSeries({{"engine", QString::number(m_uid)}, {"direction", "rx"}});
 }
 
 void DSPDeviceSourceEngine::run()
@@ -312,6 +331,8 @@ void DSPDeviceSourceEngine::work()
 	SampleSinkFifo* sampleFifo = m_deviceSampleSource->getSampleFifo();
 	std::size_t samplesDone = 0;
 	bool positiveOnly = false;
+    qint64 startNs = m_metricsTimer.nsecsElapsed();
+    m_metricsFifoFill->set(sampleFifo->size() == 0 ? 0.0 : (double) sampleFifo->fill() / sampleFifo->size());
 
 	while ((sampleFifo->fill() > 0) && (m_inputMessageQueue.size() == 0) && (samplesDone < m_sampleRate))
 	{
@@ -360,6 +381,9 @@ void DSPDeviceSourceEngine::work()
 		sampleFifo->readCommit((unsigned int) count);
 		samplesDone += count;
 	}
+
+    m_metricsSamples->inc(samplesDone);
+    m_metricsWorkTime->observe((m_metricsTimer.nsecsElapsed() - startNs) * 1e-9);
 }
 
 // notStarted -> idle -> init -> running -+
@@ -610,7 +634,13 @@ void DSPDeviceSourceEngine::handleInputMessages()
 	{
 		qDebug("DSPDeviceSourceEngine::handleInputMessages: message: %s", message->getIdentifier());
 
-		if (DSPConfigureCorrection::match(*message))
+		if (DSPConfigureThreadPriority::match(*message))
+		{
+			DSPConfigureThreadPriority* conf = (DSPConfigureThreadPriority*) message;
+			DSPEngine::instance()->applyThreadPriority(conf->getDeviceSetIndex(), ThreadPriority::RoleEngine);
+			delete message;
+		}
+		else if (DSPConfigureCorrection::match(*message))
 		{
 			DSPConfigureCorrection* conf = (DSPConfigureCorrection*) message;
 			m_iqImbalanceCorrection = conf->getIQImbalanceCorrection();
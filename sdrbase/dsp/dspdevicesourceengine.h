@@ -23,12 +23,14 @@
 #include <QTimer>
 #include <QMutex>
 #include <QWaitCondition>
+#include <QElapsedTimer>
 #include "dsp/dsptypes.h"
 #include "dsp/fftwindow.h"
 #include "util/messagequeue.h"
 #include "util/syncmessenger.h"
 #include "export.h"
 #include "util/movingaverage.h"
+#include "util/metrics.h"
 
 class DeviceSampleSource;
 class BasebandSampleSink;
@@ -97,6 +99,11 @@ private:
 	bool m_iqImbalanceCorrection;
 	double m_iOffset, m_qOffset;
 
+    QElapsedTimer m_metricsTimer;
+    Metrics::Histogram *m_metricsWorkTime;
+    Metrics::Counter *m_metricsSamples;
+    Metrics::Gauge *m_metricsFifoFill;
+
 	MovingAverageUtil<int32_t, int64_t, 1024> m_iBeta;
     MovingAverageUtil<int32_t, int64_t, 1024> m_qBeta;
 
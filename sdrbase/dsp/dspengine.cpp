@@ -24,6 +24,7 @@
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
 #include "dsp/fftfactory.h"
+#include "device/deviceapi.h"
 
 DSPEngine::DSPEngine() :
     m_deviceSourceEnginesUIDSequence(0),
@@ -35,6 +36,7 @@ DSPEngine::DSPEngine() :
 {
 	m_dvSerialSupport = false;
     m_mimoSupport = false;
+    m_channelIdle = false;
     m_masterTimer.start(50);
 }
 
@@ -200,4 +202,63 @@ void DSPEngine::createFFTFactory(const QString& fftWisdomFileName)
 void DSPEngine::preAllocateFFTs()
 {
     m_fftFactory->preallocate(7, 10, 1, 0); // pre-acllocate forward FFT only 1 per size from 128 to 1024
-}
\ No newline at end of file
+}
+void DSPEngine::setThreadPrioritySettings(int deviceSetIndex, const ThreadPriority::Settings& settings)
+{
+    QMutexLocker mutexLocker(&m_threadPriorityMutex);
+    m_threadPrioritySettings[deviceSetIndex] = settings;
+}
+
+ThreadPriority::Settings DSPEngine::getThreadPrioritySettings(int deviceSetIndex)
+{
+    QMutexLocker mutexLocker(&m_threadPriorityMutex);
+    return m_threadPrioritySettings.value(deviceSetIndex, ThreadPriority::Settings());
+}
+
+QList<int> DSPEngine::getIsolatedCPUs()
+{
+    QMutexLocker mutexLocker(&m_threadPriorityMutex);
+    QList<int> isolatedCPUs;
+
+    for (const auto& settings : m_threadPrioritySettings)
+    {
+        if (!settings.m_isolate) {
+            continue;
+        }
+
+        QList<int> cpus;
+        ThreadPriority::parseCPUList(settings.m_cpuAffinity, cpus);
+
+        for (auto cpu : cpus)
+        {
+            if (!isolatedCPUs.contains(cpu)) {
+                isolatedCPUs.append(cpu);
+            }
+        }
+    }
+
+    return isolatedCPUs;
+}
+
+void DSPEngine::applyThreadPriority(int deviceSetIndex, ThreadPriority::Role role)
+{
+    ThreadPriority::Settings settings = getThreadPrioritySettings(deviceSetIndex);
+    ThreadPriority::Status status = ThreadPriority::applyToCurrentThread(settings, getIsolatedCPUs());
+    QMutexLocker mutexLocker(&m_threadPriorityMutex);
+    m_threadPriorityStatus[QPair<int, int>(deviceSetIndex, (int) role)] = status;
+}
+
+void DSPEngine::applyThreadPriorityOnStart(QThread *thread, const DeviceAPI *deviceAPI, ThreadPriority::Role role)
+{
+    // QThread::started is emitted from the new thread so the direct connection executes there.
+    // The device set index is looked up at each start as it may have changed since connection.
+    QObject::connect(thread, &QThread::started, [=]() {
+        applyThreadPriority(deviceAPI->getDeviceSetIndex(), role);
+    });
+}
+
+ThreadPriority::Status DSPEngine::getThreadPriorityStatus(int deviceSetIndex, ThreadPriority::Role role)
+{
+    QMutexLocker mutexLocker(&m_threadPriorityMutex);
+    return m_threadPriorityStatus.value(QPair<int, int>(deviceSetIndex, (int) role), ThreadPriority::Status());
+}
@@ -21,6 +21,9 @@
 
 #include <QObject>
 #include <QTimer>
+#include <QMutex>
+#include <QMap>
+#include <QPair>
 #include <vector>
 
 #include "audio/audiodevicemanager.h"
@@ -28,11 +31,14 @@
 #include "audio/audioinput.h"
 #include "export.h"
 #include "ambe/ambeengine.h"
+#include "util/threadpriority.h"
 
 class DSPDeviceSourceEngine;
 class DSPDeviceSinkEngine;
 class DSPDeviceMIMOEngine;
 class FFTFactory;
+class QThread;
+class DeviceAPI;
 
 class SDRBASE_API DSPEngine : public QObject {
 	Q_OBJECT
@@ -85,10 +91,21 @@ public:
     const QTimer& getMasterTimer() const { return m_masterTimer; }
     void setMIMOSupport(bool mimoSupport) { m_mimoSupport = mimoSupport; }
     bool getMIMOSupport() const { return m_mimoSupport; }
+    void setChannelIdle(bool channelIdle) { m_channelIdle = channelIdle; }
+    bool getChannelIdle() const { return m_channelIdle; } //!< Rx channels may skip demodulation while squelch is closed (see ChannelIdleGate)
     void createFFTFactory(const QString& fftWisdomFileName);
     void preAllocateFFTs();
     FFTFactory *getFFTFactory() { return m_fftFactory; }
 
+    // Thread priority and CPU affinity per device set:
+
+    void setThreadPrioritySettings(int deviceSetIndex, const ThreadPriority::Settings& settings);
+    ThreadPriority::Settings getThreadPrioritySettings(int deviceSetIndex);
+    QList<int> getIsolatedCPUs();
+    void applyThreadPriority(int deviceSetIndex, ThreadPriority::Role role); //!< to be called from the thread itself
+    void applyThreadPriorityOnStart(QThread *thread, const DeviceAPI *deviceAPI, ThreadPriority::Role role); //!< apply each time the thread starts
+    ThreadPriority::Status getThreadPriorityStatus(int deviceSetIndex, ThreadPriority::Role role);
+
 private:
 	std::vector<DSPDeviceSourceEngine*> m_deviceSourceEngines;
 	uint m_deviceSourceEnginesUIDSequence;
@@ -102,8 +119,12 @@ private:
     QTimer m_masterTimer;
 	bool m_dvSerialSupport;
     bool m_mimoSupport;
+    bool m_channelIdle;
 	AMBEEngine m_ambeEngine;
     FFTFactory *m_fftFactory;
+    QMap<int, ThreadPriority::Settings> m_threadPrioritySettings;
+    QMap<QPair<int, int>, ThreadPriority::Status> m_threadPriorityStatus;
+    QMutex m_threadPriorityMutex;
 };
 
 #endif // INCLUDE_DSPENGINE_H
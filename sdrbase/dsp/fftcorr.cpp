@@ -41,6 +41,7 @@ void fftcorr::init_fft()
 
     std::fill(dataA, dataA+flen, 0);
     std::fill(dataB, dataB+flen, 0);
+    std::fill(dataP, dataP+flen, 0);
 
     inptrA = 0;
     inptrB = 0;
@@ -84,16 +85,23 @@ int fftcorr::run(const cmplx& inA, const cmplx* inB, cmplx **out)
         return 0;
     }
 
+    correlate(inB != nullptr);
+    *out = dataP;
+    return flen2;
+}
+
+void fftcorr::correlate(bool cross)
+{
     m_window.apply(dataA, fftA->in());
     fftA->transform();
 
-    if (inB)
+    if (cross)
     {
         m_window.apply(dataB, fftB->in());
         fftB->transform();
     }
 
-    if (inB) {
+    if (cross) {
         std::transform(fftB->out(), fftB->out()+flen, dataBj, [](const cmplx& c) -> cmplx { return std::conj(c); });
     } else {
         std::transform(fftA->out(), fftA->out()+flen, dataBj, [](const cmplx& c) -> cmplx { return std::conj(c); });
@@ -107,14 +115,11 @@ int fftcorr::run(const cmplx& inA, const cmplx* inB, cmplx **out)
     std::fill(dataA, dataA+flen, 0);
     inptrA = 0;
 
-    if (inB)
+    if (cross)
     {
         std::fill(dataB, dataB+flen, 0);
         inptrB = 0;
     }
-
-    *out = dataP;
-    return flen2;
 }
 
 const fftcorr::cmplx& fftcorr::run(const cmplx& inA, const cmplx* inB)
@@ -127,3 +132,36 @@ const fftcorr::cmplx& fftcorr::run(const cmplx& inA, const cmplx* inB)
 
     return dataP[outptr++];
 }
+
+void fftcorr::run(const cmplx *inA, const cmplx *inB, int nbSamples, cmplx *out)
+{
+    int i = 0;
+
+    while (i < nbSamples)
+    {
+        int n = std::min(flen2 - inptrA, nbSamples - i);
+        std::copy(inA + i, inA + i + n, dataA + inptrA);
+        inptrA += n;
+
+        if (inB)
+        {
+            std::copy(inB + i, inB + i + n, dataB + inptrB);
+            inptrB += n;
+        }
+
+        if (inptrA < flen2)
+        {
+            std::copy(dataP + outptr, dataP + outptr + n, out + i);
+            outptr += n;
+        }
+        else // last sample of the chunk completes the block: same output sequence as the sample by sample version
+        {
+            std::copy(dataP + outptr, dataP + outptr + n - 1, out + i);
+            correlate(inB != nullptr);
+            out[i + n - 1] = dataP[0];
+            outptr = 1;
+        }
+
+        i += n;
+    }
+}
@@ -36,9 +36,11 @@ public:
 
     int run(const cmplx& inA, const cmplx* inB, cmplx **out); //!< if inB = 0 then run auto-correlation
     const cmplx& run(const cmplx& inA, const cmplx* inB);
+    void run(const cmplx *inA, const cmplx *inB, int nbSamples, cmplx *out); //!< block version of the above. inB can be 0 for auto-correlation
 
 private:
     void init_fft();
+    void correlate(bool cross); //!< process a full half FFT length of input
     int flen;  //!< FFT length
     int flen2; //!< half FFT length
     FFTEngine *fftA;
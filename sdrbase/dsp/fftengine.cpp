@@ -1,7 +1,6 @@
 #include "dsp/fftengine.h"
-#ifdef USE_KISSFFT
 #include "dsp/kissengine.h"
-#endif
+#include "dsp/gfftengine.h"
 #ifdef USE_FFTW
 #include "dsp/fftwengine.h"
 #endif // USE_FFTW
@@ -10,17 +9,39 @@ FFTEngine::~FFTEngine()
 {
 }
 
-FFTEngine* FFTEngine::create(const QString& fftWisdomFileName)
+FFTEngine* FFTEngine::create(const QString& fftWisdomFileName, const QString& engineName)
 {
+    const QString& name = getAllNames().contains(engineName) ? engineName : getAllNames().front();
+
 #ifdef USE_FFTW
-	qDebug("FFTEngine::create: using FFTW engine");
-	return new FFTWEngine(fftWisdomFileName);
-#elif USE_KISSFFT
-	qDebug("FFTEngine::create: using KissFFT engine");
+    if (name == FFTWEngine::m_name)
+    {
+        qDebug("FFTEngine::create: using FFTW engine");
+        return new FFTWEngine(fftWisdomFileName);
+    }
+#else
     (void) fftWisdomFileName;
-	return new KissEngine;
-#else // USE_KISSFFT
-	qCritical("FFTEngine::create: no engine built");
-	return 0;
 #endif
+
+    if (name == GFFTEngine::m_name)
+    {
+        qDebug("FFTEngine::create: using GFFT engine");
+        return new GFFTEngine;
+    }
+    else
+    {
+        qDebug("FFTEngine::create: using KissFFT engine");
+        return new KissEngine;
+    }
+}
+
+const QStringList& FFTEngine::getAllNames()
+{
+    static const QStringList names = QStringList()
+#ifdef USE_FFTW
+        << FFTWEngine::m_name
+#endif
+        << KissEngine::m_name
+        << GFFTEngine::m_name;
+    return names;
 }
@@ -2,6 +2,7 @@
 #define INCLUDE_FFTENGINE_H
 
 #include <QString>
+#include <QStringList>
 
 #include "dsp/dsptypes.h"
 #include "export.h"
@@ -17,8 +18,10 @@ public:
 	virtual Complex* out() = 0;
 
     virtual void setReuse(bool reuse) = 0;
+    virtual QString getName() const = 0;
 
-	static FFTEngine* create(const QString& fftWisdomFileName);
+	static FFTEngine* create(const QString& fftWisdomFileName, const QString& engineName = ""); //!< default engine if name is empty or unknown
+    static const QStringList& getAllNames(); //!< engines built in. The first one is the default.
 };
 
 #endif // INCLUDE_FFTENGINE_H
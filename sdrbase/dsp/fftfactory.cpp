@@ -15,11 +15,21 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <random>
+
 #include <QMutexLocker>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QDataStream>
+#include <QSysInfo>
+
+#include "gfftengine.h"
 #include "fftfactory.h"
 
 FFTFactory::FFTFactory(const QString& fftwWisdomFileName) :
     m_fftwWisdomFileName(fftwWisdomFileName),
+    m_autoTune(false),
     m_mutex(QMutex::Recursive)
 {}
 
@@ -54,17 +64,13 @@ void FFTFactory::preallocate(
             for (unsigned int i = 0; i < numberFFT; i++)
             {
                 fftEngines.push_back(AllocatedEngine());
-                fftEngines.back().m_engine = FFTEngine::create(m_fftwWisdomFileName);
-                fftEngines.back().m_engine->setReuse(false);
-                fftEngines.back().m_engine->configure(fftSize, false);
+                fftEngines.back().m_engine = createEngine(fftSize, false);
             }
 
             for (unsigned int i = 0; i < numberInvFFT; i++)
             {
                 invFFTEngines.push_back(AllocatedEngine());
-                invFFTEngines.back().m_engine = FFTEngine::create(m_fftwWisdomFileName);
-                fftEngines.back().m_engine->setReuse(false);
-                invFFTEngines.back().m_engine->configure(fftSize, true);
+                invFFTEngines.back().m_engine = createEngine(fftSize, true);
             }
         }
     }
@@ -83,9 +89,7 @@ unsigned int FFTFactory::getEngine(unsigned int fftSize, bool inverse, FFTEngine
         std::vector<AllocatedEngine>& engines = enginesBySize[fftSize];
         engines.push_back(AllocatedEngine());
         engines.back().m_inUse = true;
-        engines.back().m_engine = FFTEngine::create(m_fftwWisdomFileName);
-        engines.back().m_engine->setReuse(false);
-        engines.back().m_engine->configure(fftSize, inverse);
+        engines.back().m_engine = createEngine(fftSize, inverse);
         *engine = engines.back().m_engine;
         return 0;
     }
@@ -113,9 +117,7 @@ unsigned int FFTFactory::getEngine(unsigned int fftSize, bool inverse, FFTEngine
             qDebug("FFTFactory::getEngine: create engine: %lu FFT %s size: %u", engines.size(), (inverse ? "inv" : "fwd"), fftSize);
             engines.push_back(AllocatedEngine());
             engines.back().m_inUse = true;
-            engines.back().m_engine = FFTEngine::create(m_fftwWisdomFileName);
-            engines.back().m_engine->setReuse(false);
-            engines.back().m_engine->configure(fftSize, inverse);
+            engines.back().m_engine = createEngine(fftSize, inverse);
             *engine = engines.back().m_engine;
             return engines.size() - 1;
         }
@@ -139,4 +141,166 @@ void FFTFactory::releaseEngine(unsigned int fftSize, bool inverse, unsigned int
             engines[engineSequence].m_inUse = false;
         }
     }
-}
\ No newline at end of file
+}
+
+FFTEngine *FFTFactory::createEngine(unsigned int fftSize, bool inverse)
+{
+    FFTEngine *engine = FFTEngine::create(m_fftwWisdomFileName, getEngineName(fftSize, inverse));
+    engine->setReuse(false);
+    engine->configure(fftSize, inverse);
+    return engine;
+}
+
+void FFTFactory::setAutoTune(const QString& cacheFileName)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    m_autoTune = true;
+    m_autoTuneCacheFileName = cacheFileName;
+    loadAutoTuneCache();
+}
+
+QString FFTFactory::getEngineName(unsigned int fftSize, bool inverse)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!m_autoTune) {
+        return FFTEngine::getAllNames().front();
+    }
+
+    unsigned int key = 2*fftSize + (inverse ? 1 : 0);
+    auto it = m_engineNames.find(key);
+
+    if (it != m_engineNames.end()) {
+        return it->second;
+    }
+
+    QString name = tuneEngine(fftSize, inverse);
+    m_engineNames[key] = name;
+    saveAutoTuneCache();
+    return name;
+}
+
+QString FFTFactory::tuneEngine(unsigned int fftSize, bool inverse)
+{
+    unsigned int nbTransforms = std::max(16U, (1U<<20) / fftSize);
+    QString bestName = FFTEngine::getAllNames().front();
+    double bestTime = 0.0;
+
+    for (const auto& name : FFTEngine::getAllNames())
+    {
+        if ((name == GFFTEngine::m_name) && !GFFTEngine::isSizeSupported(fftSize)) {
+            continue;
+        }
+
+        FFTEngine *engine = FFTEngine::create(m_fftwWisdomFileName, name);
+        engine->setReuse(false);
+        engine->configure(fftSize, inverse);
+        double nsecs = timeEngine(engine, fftSize, nbTransforms);
+        delete engine;
+        qDebug("FFTFactory::tuneEngine: FFT %s size: %u %s: %.0f ns", (inverse ? "inv" : "fwd"), fftSize, qPrintable(name), nsecs);
+
+        if ((bestTime == 0.0) || (nsecs < bestTime))
+        {
+            bestTime = nsecs;
+            bestName = name;
+        }
+    }
+
+    qInfo("FFTFactory::tuneEngine: FFT %s size: %u use %s", (inverse ? "inv" : "fwd"), fftSize, qPrintable(bestName));
+    return bestName;
+}
+
+double FFTFactory::timeEngine(FFTEngine *engine, unsigned int fftSize, unsigned int nbTransforms)
+{
+    std::mt19937 generator(fftSize);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    Complex *in = engine->in();
+
+    for (unsigned int i = 0; i < fftSize; i++) {
+        in[i] = Complex(distribution(generator), distribution(generator));
+    }
+
+    engine->transform(); // warm up caches
+    QElapsedTimer timer;
+    timer.start();
+
+    for (unsigned int i = 0; i < nbTransforms; i++) {
+        engine->transform();
+    }
+
+    return timer.nsecsElapsed() / (double) nbTransforms;
+}
+
+QString FFTFactory::getAutoTuneCacheKey() const
+{
+    return QSysInfo::currentCpuArchitecture() + "|" + QSysInfo::buildAbi() + "|" + FFTEngine::getAllNames().join(",");
+}
+
+void FFTFactory::loadAutoTuneCache()
+{
+    if (m_autoTuneCacheFileName.isEmpty()) {
+        return;
+    }
+
+    QFile cacheFile(m_autoTuneCacheFileName);
+
+    if (!cacheFile.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream stream(&cacheFile);
+    quint32 version;
+    QString cacheKey;
+    stream >> version >> cacheKey;
+
+    if ((version != 1) || (cacheKey != getAutoTuneCacheKey()))
+    {
+        qDebug("FFTFactory::loadAutoTuneCache: cache outdated");
+        return;
+    }
+
+    quint32 size;
+    stream >> size;
+
+    for (quint32 i = 0; (i < size) && (stream.status() == QDataStream::Ok); i++)
+    {
+        quint32 key;
+        QString name;
+        stream >> key >> name;
+
+        if (FFTEngine::getAllNames().contains(name)) {
+            m_engineNames[key] = name;
+        }
+    }
+
+    if (stream.status() != QDataStream::Ok)
+    {
+        qWarning("FFTFactory::loadAutoTuneCache: corrupted cache %s", qPrintable(m_autoTuneCacheFileName));
+        m_engineNames.clear();
+        return;
+    }
+
+    qDebug("FFTFactory::loadAutoTuneCache: %d engines from %s", (int) m_engineNames.size(), qPrintable(m_autoTuneCacheFileName));
+}
+
+void FFTFactory::saveAutoTuneCache()
+{
+    if (m_autoTuneCacheFileName.isEmpty()) {
+        return;
+    }
+
+    QFile cacheFile(m_autoTuneCacheFileName);
+
+    if (!cacheFile.open(QIODevice::WriteOnly))
+    {
+        qWarning("FFTFactory::saveAutoTuneCache: cannot write %s", qPrintable(m_autoTuneCacheFileName));
+        return;
+    }
+
+    QDataStream stream(&cacheFile);
+    stream << (quint32) 1 << getAutoTuneCacheKey() << (quint32) m_engineNames.size();
+
+    for (const auto& engineName : m_engineNames) {
+        stream << (quint32) engineName.first << engineName.second;
+    }
+}
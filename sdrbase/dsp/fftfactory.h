@@ -37,6 +37,18 @@ public:
     unsigned int getEngine(unsigned int fftSize, bool inverse, FFTEngine **engine); //!< returns an engine sequence
     void releaseEngine(unsigned int fftSize, bool inverse, unsigned int engineSequence);
 
+    /**
+     * Pick the fastest engine among the engines built in for each size and direction. Engines
+     * are timed on the first request of a size and direction and the choices are saved to the
+     * cache file if not empty so that next runs do not time them again.
+     */
+    void setAutoTune(const QString& cacheFileName);
+    bool getAutoTune() const { return m_autoTune; }
+    QString getEngineName(unsigned int fftSize, bool inverse); //!< engine used for new engines of this size and direction
+
+    /** Average time of one transform in nanoseconds */
+    static double timeEngine(FFTEngine *engine, unsigned int fftSize, unsigned int nbTransforms);
+
 private:
     struct AllocatedEngine
     {
@@ -50,9 +62,18 @@ private:
     };
 
     QString m_fftwWisdomFileName;
+    bool m_autoTune;
+    QString m_autoTuneCacheFileName;
+    std::map<unsigned int, QString> m_engineNames; //!< tuned engine by 2*size + inverse
     std::map<unsigned int, std::vector<AllocatedEngine>> m_fftEngineBySize;
     std::map<unsigned int, std::vector<AllocatedEngine>> m_invFFTEngineBySize;
     QMutex m_mutex;
+
+    FFTEngine *createEngine(unsigned int fftSize, bool inverse);
+    QString tuneEngine(unsigned int fftSize, bool inverse);
+    QString getAutoTuneCacheKey() const;
+    void loadAutoTuneCache();
+    void saveAutoTuneCache();
 };
 
 #endif // _SDRBASE_FFTWFACTORY_H
@@ -18,6 +18,8 @@
 #include <QElapsedTimer>
 #include "dsp/fftwengine.h"
 
+const QString FFTWEngine::m_name = "FFTW";
+
 FFTWEngine::FFTWEngine(const QString& fftWisdomFileName) :
     m_fftWisdomFileName(fftWisdomFileName),
 	m_plans(),
@@ -31,6 +33,11 @@ FFTWEngine::~FFTWEngine()
 	freeAll();
 }
 
+QString FFTWEngine::getName() const
+{
+    return m_name;
+}
+
 void FFTWEngine::configure(int n, bool inverse)
 {
     if (m_reuse)
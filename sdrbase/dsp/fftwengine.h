@@ -38,6 +38,9 @@ public:
 	virtual Complex* out();
 
     virtual void setReuse(bool reuse) { m_reuse = reuse; }
+    virtual QString getName() const;
+
+    static const QString m_name;
 
 protected:
 	static QMutex m_globalPlanMutex;
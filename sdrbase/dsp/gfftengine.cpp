@@ -0,0 +1,86 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "dsp/gfft.h"
+#include "dsp/gfftengine.h"
+
+const QString GFFTEngine::m_name = "GFFT";
+
+GFFTEngine::GFFTEngine() :
+    m_fft(nullptr),
+    m_n(0),
+    m_inverse(false)
+{
+}
+
+GFFTEngine::~GFFTEngine()
+{
+    delete m_fft;
+}
+
+QString GFFTEngine::getName() const
+{
+    return m_name;
+}
+
+void GFFTEngine::configure(int n, bool inverse)
+{
+    if (!isSizeSupported(n)) {
+        qWarning("GFFTEngine::configure: unsupported size %d", n);
+    }
+
+    if (n != m_n)
+    {
+        delete m_fft;
+        m_fft = new g_fft<float>(n);
+        m_n = n;
+        m_in.resize(n);
+        m_out.resize(n);
+    }
+
+    m_inverse = inverse;
+}
+
+void GFFTEngine::transform()
+{
+    std::copy(m_in.begin(), m_in.end(), m_out.begin());
+
+    if (m_inverse)
+    {
+        m_fft->InverseComplexFFT(m_out.data());
+
+        for (auto& c : m_out) { // g_fft scales the inverse by 1/n
+            c *= (float) m_n;
+        }
+    }
+    else
+    {
+        m_fft->ComplexFFT(m_out.data());
+    }
+}
+
+Complex* GFFTEngine::in()
+{
+    return m_in.data();
+}
+
+Complex* GFFTEngine::out()
+{
+    return m_out.data();
+}
@@ -0,0 +1,58 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_GFFTENGINE_H
+#define INCLUDE_GFFTENGINE_H
+
+#include <vector>
+
+#include "dsp/fftengine.h"
+#include "export.h"
+
+template <typename FFT_TYPE> class g_fft;
+
+/**
+ * FFT engine on the g_fft template also used by the FFT filters. It works in place on
+ * power of two sizes from 16 only. The inverse transform is not scaled like with the other
+ * engines.
+ */
+class SDRBASE_API GFFTEngine : public FFTEngine {
+public:
+    GFFTEngine();
+    virtual ~GFFTEngine();
+
+    virtual void configure(int n, bool inverse);
+    virtual void transform();
+
+    virtual Complex* in();
+    virtual Complex* out();
+
+    virtual void setReuse(bool reuse) { (void) reuse; }
+    virtual QString getName() const;
+
+    static bool isSizeSupported(int n) { return (n >= 16) && ((n & (n - 1)) == 0); }
+    static const QString m_name;
+
+protected:
+    g_fft<float> *m_fft;
+    int m_n;
+    bool m_inverse;
+    std::vector<Complex> m_in;
+    std::vector<Complex> m_out;
+};
+
+#endif // INCLUDE_GFFTENGINE_H
@@ -1,5 +1,12 @@
 #include "dsp/kissengine.h"
 
+const QString KissEngine::m_name = "Kiss";
+
+QString KissEngine::getName() const
+{
+    return m_name;
+}
+
 void KissEngine::configure(int n, bool inverse)
 {
 	m_fft.configure(n, inverse);
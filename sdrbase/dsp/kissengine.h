@@ -14,6 +14,9 @@ public:
 	virtual Complex* out();
 
     virtual void setReuse(bool reuse);
+    virtual QString getName() const;
+
+    static const QString m_name;
 
 protected:
 	typedef kissfft<Real, Complex> KissFFT;
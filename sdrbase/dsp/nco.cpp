@@ -21,6 +21,7 @@
 #define _USE_MATH_DEFINES
 #include <math.h>
 #include "dsp/nco.h"
+#include "dsp/ncoblock.h"
 
 #undef M_PI
 #define M_PI		3.14159265358979323846
@@ -107,3 +108,51 @@ void NCO::getQI(Complex& c)
 	c.imag(m_table[m_phase]);
 	c.real(-m_table[(m_phase + TableSize / 4) % TableSize]);
 }
+
+void NCO::seedBlock(NCOBlock& block) const
+{
+	for (int l = 0; l < NCOBlock::m_lanes; l++)
+	{
+		int phase = (int) ((m_phase + (qint64) (l + 1) * m_phaseIncrement) % TableSize);
+		phase = phase < 0 ? phase + TableSize : phase;
+		block.m_re[l] = m_table[phase];
+		block.m_im[l] = -m_table[(phase + TableSize / 4) % TableSize];
+	}
+
+	int step = (int) (((qint64) NCOBlock::m_lanes * m_phaseIncrement) % TableSize);
+	step = step < 0 ? step + TableSize : step;
+	block.m_stepRe = m_table[step];
+	block.m_stepIm = -m_table[(step + TableSize / 4) % TableSize];
+}
+
+void NCO::advance(int nbSamples)
+{
+	m_phase = (int) ((m_phase + (qint64) nbSamples * m_phaseIncrement) % TableSize);
+	m_phase = m_phase < 0 ? m_phase + TableSize : m_phase;
+}
+
+void NCO::nextIQBlock(Complex *out, int nbSamples)
+{
+	NCOBlock block;
+
+	for (int i = 0; i < nbSamples; i += NCOBlock::m_chunkSize)
+	{
+		int n = nbSamples - i < NCOBlock::m_chunkSize ? nbSamples - i : NCOBlock::m_chunkSize;
+		seedBlock(block); // exact phase at each chunk start
+		block.fill(&out[i], n);
+		advance(n);
+	}
+}
+
+void NCO::mixIQBlock(const Sample *in, Complex *out, int nbSamples)
+{
+	NCOBlock block;
+
+	for (int i = 0; i < nbSamples; i += NCOBlock::m_chunkSize)
+	{
+		int n = nbSamples - i < NCOBlock::m_chunkSize ? nbSamples - i : NCOBlock::m_chunkSize;
+		seedBlock(block);
+		block.mix(&in[i], &out[i], n);
+		advance(n);
+	}
+}
@@ -22,6 +22,8 @@
 #include "dsp/dsptypes.h"
 #include "export.h"
 
+struct NCOBlock;
+
 class SDRBASE_API NCO {
 private:
 	enum {
@@ -31,6 +33,8 @@ private:
 	static bool m_tableInitialized;
 
 	static void initTable();
+	void seedBlock(NCOBlock& block) const;
+	void advance(int nbSamples);
 
 	int m_phaseIncrement;
 	int m_phase;
@@ -59,6 +63,10 @@ public:
 	void getIQ(Complex& c); //!< Sets to the current complex sample (no phase increment)
 	Complex getQI();        //!< Return current complex sample (no phase increment, reversed)
 	void getQI(Complex& c); //!< Sets to the current complex sample (no phase increment, reversed)
+
+	// Block versions: same phase sequence as successive nextIQ() calls
+	void nextIQBlock(Complex *out, int nbSamples);                  //!< Fill with the next complex samples
+	void mixIQBlock(const Sample *in, Complex *out, int nbSamples); //!< Multiply input samples by the next complex samples
 };
 
 #endif // INCLUDE_NCO_H
@@ -0,0 +1,97 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_NCOBLOCK_H
+#define INCLUDE_NCOBLOCK_H
+
+#include "dsp/dsptypes.h"
+
+/**
+ * Block complex oscillator used by the NCO and NCOF block methods. The oscillator runs as
+ * m_lanes independent recurrences: lane l holds exp(j(phi + (l+1)*step)) and every lane is
+ * rotated by exp(j*m_lanes*step) at each iteration. The lane loops are branchless so that the
+ * compiler vectorizes them (SSE/AVX/NEON depending on target).
+ *
+ * The lanes are seeded by the NCO from its exact phase at most every m_chunkSize samples so that
+ * the amplitude and phase rounding errors of the recurrence do not accumulate.
+ */
+struct NCOBlock
+{
+    static const int m_lanes = 8;
+    static const int m_chunkSize = 256;
+
+    float m_re[m_lanes];
+    float m_im[m_lanes];
+    float m_stepRe; //!< exp(j*m_lanes*step)
+    float m_stepIm;
+
+    void rotate()
+    {
+        for (int l = 0; l < m_lanes; l++)
+        {
+            float re = m_re[l] * m_stepRe - m_im[l] * m_stepIm;
+            m_im[l] = m_re[l] * m_stepIm + m_im[l] * m_stepRe;
+            m_re[l] = re;
+        }
+    }
+
+    /** Write nbSamples (at most m_chunkSize) oscillator values */
+    void fill(Complex *out, int nbSamples)
+    {
+        int i = 0;
+
+        for (; i + m_lanes <= nbSamples; i += m_lanes)
+        {
+            for (int l = 0; l < m_lanes; l++) {
+                out[i+l] = Complex(m_re[l], m_im[l]);
+            }
+
+            rotate();
+        }
+
+        for (int l = 0; i + l < nbSamples; l++) {
+            out[i+l] = Complex(m_re[l], m_im[l]);
+        }
+    }
+
+    /** Multiply nbSamples (at most m_chunkSize) input samples by the oscillator values */
+    void mix(const Sample *in, Complex *out, int nbSamples)
+    {
+        int i = 0;
+
+        for (; i + m_lanes <= nbSamples; i += m_lanes)
+        {
+            for (int l = 0; l < m_lanes; l++)
+            {
+                float x = in[i+l].m_real;
+                float y = in[i+l].m_imag;
+                out[i+l] = Complex(x * m_re[l] - y * m_im[l], x * m_im[l] + y * m_re[l]);
+            }
+
+            rotate();
+        }
+
+        for (int l = 0; i + l < nbSamples; l++)
+        {
+            float x = in[i+l].m_real;
+            float y = in[i+l].m_imag;
+            out[i+l] = Complex(x * m_re[l] - y * m_im[l], x * m_im[l] + y * m_re[l]);
+        }
+    }
+};
+
+#endif // INCLUDE_NCOBLOCK_H
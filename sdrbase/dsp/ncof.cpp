@@ -20,6 +20,7 @@
 #define _USE_MATH_DEFINES
 #include <math.h>
 #include "dsp/ncof.h"
+#include "dsp/ncoblock.h"
 
 #undef M_PI
 #define M_PI		3.14159265358979323846
@@ -106,3 +107,53 @@ void NCOF::getQI(Complex& c)
 	c.imag(m_table[(int) m_phase]);
 	c.real(-m_table[((int) m_phase + TableSize / 4) % TableSize]);
 }
+
+void NCOF::seedBlock(NCOBlock& block) const
+{
+	for (int l = 0; l < NCOBlock::m_lanes; l++)
+	{
+		double angle = (2.0 * M_PI * (m_phase + (l + 1) * (double) m_phaseIncrement)) / TableSize;
+		block.m_re[l] = cos(angle);
+		block.m_im[l] = sin(angle);
+	}
+
+	double step = (2.0 * M_PI * NCOBlock::m_lanes * (double) m_phaseIncrement) / TableSize;
+	block.m_stepRe = cos(step);
+	block.m_stepIm = sin(step);
+}
+
+void NCOF::advance(int nbSamples)
+{
+	double phase = fmod(m_phase + nbSamples * (double) m_phaseIncrement, (double) TableSize);
+	m_phase = phase < 0.0 ? phase + TableSize : phase;
+
+	if (m_phase >= m_tableSizeLimit) { // float rounding
+		m_phase = 0.0f;
+	}
+}
+
+void NCOF::nextIQBlock(Complex *out, int nbSamples)
+{
+	NCOBlock block;
+
+	for (int i = 0; i < nbSamples; i += NCOBlock::m_chunkSize)
+	{
+		int n = nbSamples - i < NCOBlock::m_chunkSize ? nbSamples - i : NCOBlock::m_chunkSize;
+		seedBlock(block); // exact phase at each chunk start
+		block.fill(&out[i], n);
+		advance(n);
+	}
+}
+
+void NCOF::mixIQBlock(const Sample *in, Complex *out, int nbSamples)
+{
+	NCOBlock block;
+
+	for (int i = 0; i < nbSamples; i += NCOBlock::m_chunkSize)
+	{
+		int n = nbSamples - i < NCOBlock::m_chunkSize ? nbSamples - i : NCOBlock::m_chunkSize;
+		seedBlock(block);
+		block.mix(&in[i], &out[i], n);
+		advance(n);
+	}
+}
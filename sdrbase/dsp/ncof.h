@@ -21,6 +21,8 @@
 #include "dsp/dsptypes.h"
 #include "export.h"
 
+struct NCOBlock;
+
 class SDRBASE_API NCOF {
 private:
 	enum {
@@ -31,6 +33,8 @@ private:
 	static float m_tableSizeLimit;
 
 	static void initTable();
+	void seedBlock(NCOBlock& block) const;
+	void advance(int nbSamples);
 
 	Real m_phaseIncrement;
 	Real m_phase;
@@ -62,6 +66,10 @@ public:
 	void getIQ(Complex& c);             //!< Sets to the current complex sample (no phase increment)
 	Complex getQI();                    //!< Return current complex sample (no phase increment, reversed)
 	void getQI(Complex& c);             //!< Sets to the current complex sample (no phase increment, reversed)
+
+	// Block versions: same frequency as successive nextIQ() calls but the phase is not truncated to the table index
+	void nextIQBlock(Complex *out, int nbSamples);                  //!< Fill with the next complex samples
+	void mixIQBlock(const Sample *in, Complex *out, int nbSamples); //!< Multiply input samples by the next complex samples
 };
 
 #endif // INCLUDE_NCO_H
@@ -55,6 +55,31 @@ public:
 		return (std::atan2(d.imag(), d.real()) / M_PI) * m_fmScaling;
 	}
 
+	/**
+	 * Block version of the atan2 discriminator. Processes nbSamples samples of in and writes
+	 * the discriminator output in out. The loop body is branchless so that the compiler can
+	 * vectorize it (SSE/AVX/NEON depending on target). Error is below 1e-5 rad.
+	 */
+	void phaseDiscriminatorBlock(const Complex *in, Real *out, int nbSamples)
+	{
+		if (nbSamples <= 0) {
+			return;
+		}
+
+		const Real scale = m_fmScaling / M_PI;
+		Complex d(std::conj(m_m1Sample) * in[0]);
+		out[0] = atan2Block(d.imag(), d.real()) * scale;
+
+		for (int i = 1; i < nbSamples; i++)
+		{
+			Real re = in[i-1].real() * in[i].real() + in[i-1].imag() * in[i].imag();
+			Real im = in[i-1].real() * in[i].imag() - in[i-1].imag() * in[i].real();
+			out[i] = atan2Block(im, re) * scale;
+		}
+
+		m_m1Sample = in[nbSamples-1];
+	}
+
     /**
      * Discriminator with phase detection using atan2 and frequency by derivation.
      * This yields a precise deviation to sample rate ratio: Sample rate => +/-1.0
@@ -139,6 +164,24 @@ private:
     Real m_fltPreviousQ2;
     Real m_prevArg;
 
+    /**
+     * Branchless atan2 using a 11th order minimax polynomial on [0,1]
+     * Suitable for auto-vectorization in block processing loops
+     */
+    static inline float atan2Block(float y, float x)
+    {
+        const float ax = std::fabs(x);
+        const float ay = std::fabs(y);
+        const float mx = ax > ay ? ax : ay;
+        const float mn = ax > ay ? ay : ax;
+        const float a = mn / (mx + 1e-30f);
+        const float s = a * a;
+        float r = ((((( -0.0117212f * s + 0.05265332f) * s - 0.11643287f) * s + 0.19354346f) * s - 0.33262347f) * s + 0.99997726f) * a;
+        r = ay > ax ? 1.57079637f - r : r;
+        r = x < 0.0f ? 3.14159274f - r : r;
+        return y < 0.0f ? -r : r;
+    }
+
     float atan2_approximation1(float y, float x)
     {
         //http://pubs.opengroup.org/onlinepubs/009695399/functions/atan2.html
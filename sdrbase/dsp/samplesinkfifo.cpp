@@ -17,6 +17,27 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include "samplesinkfifo.h"
+#include "util/metrics.h"
+
+namespace {
+
+Metrics::Counter *writtenSamplesCounter()
+{
+    static Metrics::Counter *counter = Metrics::instance().counter(
+        "sdrangel_sample_sink_fifo_written_samples_total",
+        "Samples written to the device sample FIFOs");
+    return counter;
+}
+
+Metrics::Counter *droppedSamplesCounter()
+{
+    static Metrics::Counter *counter = Metrics::instance().counter(
+        "sdrangel_sample_sink_fifo_dropped_samples_total",
+        "Samples dropped on device sample FIFO overflow");
+    return counter;
+}
+
+} // namespace
 
 //#define MIN(x, y) (((x) < (y)) ? (x) : (y))
 
@@ -34,6 +55,7 @@ void SampleSinkFifo::create(unsigned int s)
 void SampleSinkFifo::reset()
 {
 	m_suppressed = -1;
+	m_droppedSamples = 0;
 	m_fill = 0;
 	m_head = 0;
 	m_tail = 0;
@@ -44,6 +66,7 @@ SampleSinkFifo::SampleSinkFifo(QObject* parent) :
 	m_data()
 {
 	m_suppressed = -1;
+	m_droppedSamples = 0;
 	m_size = 0;
 	m_fill = 0;
 	m_head = 0;
@@ -55,6 +78,7 @@ SampleSinkFifo::SampleSinkFifo(int size, QObject* parent) :
 	m_data()
 {
 	m_suppressed = -1;
+	m_droppedSamples = 0;
 	create(size);
 }
 
@@ -63,6 +87,7 @@ SampleSinkFifo::SampleSinkFifo(const SampleSinkFifo& other) :
     m_data(other.m_data)
 {
   	m_suppressed = -1;
+	m_droppedSamples = 0;
 	m_size = m_data.size();
 	m_fill = 0;
 	m_head = 0;
@@ -77,6 +102,7 @@ SampleSinkFifo::~SampleSinkFifo()
 
 bool SampleSinkFifo::setSize(int size)
 {
+	QMutexLocker mutexLocker(&m_mutex); // may be resized while written from another thread
 	create(size);
 
 	return m_data.size() == (unsigned int)size;
@@ -92,9 +118,13 @@ unsigned int SampleSinkFifo::write(const quint8* data, unsigned int count)
 	count /= sizeof(Sample);
 
 	total = std::min(count, m_size - m_fill);
+	writtenSamplesCounter()->inc(total);
 
     if (total < count)
     {
+		m_droppedSamples += count - total;
+		droppedSamplesCounter()->inc(count - total);
+
 		if (m_suppressed < 0)
         {
 			m_suppressed = 0;
@@ -145,9 +175,13 @@ unsigned int SampleSinkFifo::write(SampleVector::const_iterator begin, SampleVec
 	unsigned int len;
 
 	total = std::min(count, m_size - m_fill);
+	writtenSamplesCounter()->inc(total);
 
     if (total < count)
     {
+		m_droppedSamples += count - total;
+		droppedSamplesCounter()->inc(count - total);
+
 		if (m_suppressed < 0)
         {
 			m_suppressed = 0;
@@ -32,6 +32,7 @@ private:
 	QMutex m_mutex;
 	QElapsedTimer m_msgRateTimer;
 	int m_suppressed;
+	quint64 m_droppedSamples; //!< samples dropped on overflow since last reset
 
 	SampleVector m_data;
 
@@ -52,6 +53,7 @@ public:
     void reset();
 	inline unsigned int size() const { return m_size; }
 	inline unsigned int fill() { QMutexLocker mutexLocker(&m_mutex); unsigned int fill = m_fill; return fill; }
+	inline quint64 getDroppedSamples() { QMutexLocker mutexLocker(&m_mutex); return m_droppedSamples; }
 
 	unsigned int write(const quint8* data, unsigned int count);
 	unsigned int write(SampleVector::const_iterator begin, SampleVector::const_iterator end);
@@ -16,6 +16,19 @@
 ///////////////////////////////////////////////////////////////////////////////////
 
 #include "samplesourcefifo.h"
+#include "util/metrics.h"
+
+namespace {
+
+Metrics::Counter *fifoEventsCounter(const QString& event)
+{
+    return Metrics::instance().counter(
+        "sdrangel_sample_source_fifo_events_total",
+        "Device sample FIFO resynchronizations on transmit side",
+        {{"event", event}});
+}
+
+} // namespace
 
 const unsigned int SampleSourceFifo::m_rwDivisor = 2;
 const unsigned int SampleSourceFifo::m_guardDivisor = 10;
@@ -97,11 +110,15 @@ void SampleSourceFifo::write(
     if (rwDelta < m_lowGuard)
     {
         qWarning("SampleSourceFifo::write: underrun (write too slow) using %d old samples", m_midPoint - m_lowGuard);
+        static Metrics::Counter *underrunCounter = fifoEventsCounter("underrun");
+        underrunCounter->inc();
         m_writeHead = m_readHead + m_midPoint < m_size ? m_readHead + m_midPoint : m_readHead + m_midPoint - m_size;
     }
     else if (rwDelta > m_highGuard)
     {
         qWarning("SampleSourceFifo::write: overrrun (read too slow) dropping %d samples", m_highGuard - m_midPoint);
+        static Metrics::Counter *overrunCounter = fifoEventsCounter("overrun");
+        overrunCounter->inc();
         m_writeHead = m_readHead + m_midPoint < m_size ? m_readHead + m_midPoint : m_readHead + m_midPoint - m_size;
     }
 
@@ -37,6 +37,16 @@ UpChannelizer::UpChannelizer(ChannelSampleSource* sampleSource) :
     m_log2Interp(0),
     m_filterChainHash(0)
 {
+    m_metricsSamples = Metrics::instance().counter(
+        "sdrangel_channelizer_samples_total",
+        "Baseband samples processed by the channelizers",
+        {{"direction", "tx"}});
+    m_metricsWorkTime = Metrics::instance().histogram(
+        "sdrangel_channelizer_work_seconds",
+        "Time spent in one channelizer call including the channel",
+        Metrics::exponentialBuckets(1e-6, 4, 10),
+        {{"direction", "tx"}});
+    m_metricsTimer.start();
 }
 
 UpChannelizer::~UpChannelizer()
@@ -93,6 +103,7 @@ void UpChannelizer::pull(SampleVector::iterator begin, unsigned int nbSamples)
         return;
     }
 
+    qint64 startNs = m_metricsTimer.nsecsElapsed();
     unsigned int log2Interp = m_filterStages.size();
 
     if (log2Interp == 0) // optimization when no downsampling is done anyway
@@ -109,6 +120,9 @@ void UpChannelizer::pull(SampleVector::iterator begin, unsigned int nbSamples)
             }
         );
     }
+
+    m_metricsSamples->inc(nbSamples);
+    m_metricsWorkTime->observe((m_metricsTimer.nsecsElapsed() - startNs) * 1e-9);
 }
 
 void UpChannelizer::prefetch(unsigned int nbSamples)
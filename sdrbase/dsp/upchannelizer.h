@@ -20,10 +20,12 @@
 #define SDRBASE_DSP_UPCHANNELIZER_H_
 
 #include <QObject>
+#include <QElapsedTimer>
 #include <algorithm>
 
 #include "export.h"
 #include "util/message.h"
+#include "util/metrics.h"
 
 #include "channelsamplesource.h"
 
@@ -89,6 +91,9 @@ protected:
     unsigned int m_filterChainHash;
     SampleVector m_sampleBuffer;
     Sample m_sampleIn;
+    QElapsedTimer m_metricsTimer;
+    Metrics::Counter *m_metricsSamples;
+    Metrics::Histogram *m_metricsWorkTime;
 
     void applyChannelization();
     void applyInterpolation();
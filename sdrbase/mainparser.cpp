@@ -31,15 +31,50 @@ MainParser::MainParser() :
         "Web API server port.",
         "port",
         "8091"),
+    m_wsReportsPortOption(QStringList() << "ws-reports-port",
+        "Channel reports WebSocket server port. 0 to disable.",
+        "port",
+        "0"),
     m_fftwfWisdomOption(QStringList() << "w" << "fftwf-wisdom",
         "FFTW Wisdom file.",
         "file",
-        "")
+        ""),
+    m_threadPriorityOption(QStringList() << "t" << "thread-priority",
+        "DSP threads priority and CPU affinity of a device set. Can be repeated. "
+        "Policy is one of default, nice, fifo, rr. Priority is the real time priority or nice value. "
+        "CPUs is a list like 2,3 or 2-3. Example: 0:fifo:50:2-3:isolate",
+        "deviceset:policy[:priority[:cpus[:isolate]]]"),
+    m_devicesOption(QStringList() << "d" << "devices",
+        "Enumerate only these device types given as comma separated hardware IDs (e.g. RTLSDR,HackRF). "
+        "File input and output are always enumerated.",
+        "hwids"),
+    m_devicesCacheOption(QStringList() << "devices-cache",
+        "Reuse the previous devices enumeration when the USB devices have not changed (Linux)."),
+    m_asyncLoggingOption(QStringList() << "async-log",
+        "Write log messages from a dedicated thread. Messages are dropped if the queue is full."),
+    m_metricsPathOption(QStringList() << "metrics-path",
+        "Path of the internal metrics in Prometheus text format on the Web API server (e.g. /metrics). Disabled if not set.",
+        "path",
+        ""),
+    m_channelIdleOption(QStringList() << "channel-idle",
+        "Rx channels with a power squelch skip their demodulation while the channel power stays below the squelch threshold. "
+        "Spectrum and scope displays of idle channels are not updated."),
+    m_fftAutoTuneOption(QStringList() << "fft-autotune",
+        "Time the FFT engines on first use of each FFT size and direction and use the fastest. "
+        "The choices are saved for the next runs."),
+    m_mimoOption(QStringList() << "mimo",
+        "Enable MIMO device sets where the synchronous streams of a multi channel device are processed by a single device engine.")
 {
     m_serverAddress = "127.0.0.1";
     m_serverPort = 8091;
+    m_wsReportsPort = 0;
     m_mimoSupport = false;
     m_fftwfWindowFileName = "";
+    m_devicesCache = false;
+    m_asyncLogging = false;
+    m_metricsPath = "";
+    m_channelIdle = false;
+    m_fftAutoTune = false;
 
     m_parser.setApplicationDescription("Software Defined Radio application");
     m_parser.addHelpOption();
@@ -47,7 +82,16 @@ MainParser::MainParser() :
 
     m_parser.addOption(m_serverAddressOption);
     m_parser.addOption(m_serverPortOption);
+    m_parser.addOption(m_wsReportsPortOption);
     m_parser.addOption(m_fftwfWisdomOption);
+    m_parser.addOption(m_threadPriorityOption);
+    m_parser.addOption(m_devicesOption);
+    m_parser.addOption(m_devicesCacheOption);
+    m_parser.addOption(m_asyncLoggingOption);
+    m_parser.addOption(m_metricsPathOption);
+    m_parser.addOption(m_channelIdleOption);
+    m_parser.addOption(m_fftAutoTuneOption);
+    m_parser.addOption(m_mimoOption);
 }
 
 MainParser::~MainParser()
@@ -88,15 +132,78 @@ void MainParser::parse(const QCoreApplication& app)
         qWarning() << "MainParser::parse: server port invalid. Defaulting to " << m_serverPort;
     }
 
+    // channel reports WebSocket server port
+
+    QString wsReportsPortStr = m_parser.value(m_wsReportsPortOption);
+    int wsReportsPort = wsReportsPortStr.toInt(&ok);
+
+    if (ok && ((wsReportsPort == 0) || ((wsReportsPort > 1023) && (wsReportsPort < 65536)))) {
+        m_wsReportsPort = wsReportsPort;
+    } else {
+        qWarning() << "MainParser::parse: channel reports WebSocket port invalid. Disabling";
+    }
+
+    // devices enumeration
+
+    if (m_parser.isSet(m_devicesOption))
+    {
+        QStringList hwIds = m_parser.value(m_devicesOption).split(',', QString::SkipEmptyParts);
+
+        for (const auto& hwId : hwIds)
+        {
+            QString trimmedHwId = hwId.trimmed(); // as in "RTLSDR, HackRF"
+
+            if (!trimmedHwId.isEmpty()) {
+                m_deviceHardwareIds.append(trimmedHwId);
+            }
+        }
+    }
+
+    m_devicesCache = m_parser.isSet(m_devicesCacheOption);
+    m_asyncLogging = m_parser.isSet(m_asyncLoggingOption);
+    m_channelIdle = m_parser.isSet(m_channelIdleOption);
+    m_fftAutoTune = m_parser.isSet(m_fftAutoTuneOption);
+
+    // metrics
+
+    QString metricsPath = m_parser.value(m_metricsPathOption);
+
+    if (metricsPath.isEmpty() || metricsPath.startsWith('/')) {
+        m_metricsPath = metricsPath;
+    } else {
+        qWarning() << "MainParser::parse: metrics path must start with /. Metrics disabled";
+    }
+
     // FFTWF wisdom file
 
     m_fftwfWindowFileName = m_parser.value(m_fftwfWisdomOption);
 
-    // MIMO - from version
+    // DSP threads priority
+
+    QStringList threadPriorities = m_parser.values(m_threadPriorityOption);
+
+    for (const auto& threadPriority : threadPriorities)
+    {
+        int sep = threadPriority.indexOf(':');
+        int deviceSetIndex = threadPriority.left(sep).toInt(&ok);
+        ThreadPriority::Settings settings;
+
+        if ((sep > 0) && ok && (deviceSetIndex >= 0) && settings.parse(threadPriority.mid(sep + 1))) {
+            m_threadPrioritySettings[deviceSetIndex] = settings;
+        } else {
+            qWarning() << "MainParser::parse: thread priority invalid. Ignoring " << threadPriority;
+        }
+    }
+
+    // MIMO - from version or forced
 
     QStringList versionParts = app.applicationVersion().split(".");
 
-    if (versionParts.size() > 0)
+    if (m_parser.isSet(m_mimoOption))
+    {
+        m_mimoSupport = true;
+    }
+    else if (versionParts.size() > 0)
     {
         bool ok;
         int maj = versionParts.at(0).toInt(&ok);
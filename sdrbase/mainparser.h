@@ -20,8 +20,11 @@
 #define SDRBASE_MAINPARSER_H_
 
 #include <QCommandLineParser>
+#include <QMap>
+#include <QStringList>
 #include <stdint.h>
 
+#include "util/threadpriority.h"
 #include "export.h"
 
 class SDRBASE_API MainParser
@@ -34,19 +37,44 @@ public:
 
     const QString& getServerAddress() const { return m_serverAddress; }
     uint16_t getServerPort() const { return m_serverPort; }
+    uint16_t getWSReportsPort() const { return m_wsReportsPort; }
     bool getMIMOSupport() const { return m_mimoSupport; }
     const QString& getFFTWFWisdomFileName() const { return m_fftwfWindowFileName; }
+    const QMap<int, ThreadPriority::Settings>& getThreadPrioritySettings() const { return m_threadPrioritySettings; }
+    const QStringList& getDeviceHardwareIds() const { return m_deviceHardwareIds; }
+    bool getDevicesCache() const { return m_devicesCache; }
+    bool getAsyncLogging() const { return m_asyncLogging; }
+    const QString& getMetricsPath() const { return m_metricsPath; }
+    bool getChannelIdle() const { return m_channelIdle; }
+    bool getFFTAutoTune() const { return m_fftAutoTune; }
 
 private:
     QString  m_serverAddress;
     uint16_t m_serverPort;
+    uint16_t m_wsReportsPort; //!< channel reports WebSocket server port (0: disabled)
     QString  m_fftwfWindowFileName;
-    bool m_mimoSupport; //!< obtained from major version
+    bool m_mimoSupport; //!< obtained from major version or forced with the mimo option
+    QMap<int, ThreadPriority::Settings> m_threadPrioritySettings; //!< by device set index
+    QStringList m_deviceHardwareIds; //!< hardware IDs of devices to enumerate (all if empty)
+    bool m_devicesCache;             //!< use devices enumeration cache
+    bool m_asyncLogging;             //!< log messages from a dedicated thread
+    QString m_metricsPath;           //!< Web API path of the metrics in Prometheus format (disabled if empty)
+    bool m_channelIdle;              //!< Rx channels idle mode while squelch is closed
+    bool m_fftAutoTune;              //!< use the fastest FFT engine for each size
 
     QCommandLineParser m_parser;
     QCommandLineOption m_serverAddressOption;
     QCommandLineOption m_serverPortOption;
+    QCommandLineOption m_wsReportsPortOption;
     QCommandLineOption m_fftwfWisdomOption;
+    QCommandLineOption m_threadPriorityOption;
+    QCommandLineOption m_devicesOption;
+    QCommandLineOption m_devicesCacheOption;
+    QCommandLineOption m_asyncLoggingOption;
+    QCommandLineOption m_metricsPathOption;
+    QCommandLineOption m_channelIdleOption;
+    QCommandLineOption m_fftAutoTuneOption;
+    QCommandLineOption m_mimoOption;
 };
 
 
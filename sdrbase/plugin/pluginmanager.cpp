@@ -17,6 +17,9 @@
 
 #include <QCoreApplication>
 #include <QPluginLoader>
+#include <QThreadPool>
+#include <QRunnable>
+#include <QElapsedTimer>
 #include <QDebug>
 
 #include <cstdio>
@@ -45,9 +48,41 @@ const QString PluginManager::m_remoteOutputDeviceTypeID = "sdrangel.samplesink.r
 const QString PluginManager::m_fileOutputHardwareID = "FileOutput";
 const QString PluginManager::m_fileOutputDeviceTypeID = "sdrangel.samplesink.fileoutput";
 
+const QString PluginManager::m_testMIMOHardwareID = "TestMI";
+const QString PluginManager::m_testMIMODeviceTypeID = "sdrangel.samplemimo.testmi";
+
+namespace {
+
+class PluginLibraryLoad : public QRunnable
+{
+public:
+    explicit PluginLibraryLoad(QPluginLoader *pluginLoader) :
+        m_pluginLoader(pluginLoader),
+        m_loaded(false),
+        m_nsecs(0)
+    {
+        setAutoDelete(false);
+    }
+
+    void run() override
+    {
+        QElapsedTimer timer;
+        timer.start();
+        m_loaded = m_pluginLoader->load();
+        m_nsecs = timer.nsecsElapsed();
+    }
+
+    QPluginLoader *m_pluginLoader;
+    bool m_loaded;
+    qint64 m_nsecs;
+};
+
+}
+
 PluginManager::PluginManager(QObject* parent) :
 	QObject(parent),
-    m_pluginAPI(this)
+    m_pluginAPI(this),
+    m_loadNsecs(0)
 {
 }
 
@@ -103,6 +138,8 @@ void PluginManager::loadPluginsPart(const QString& pluginsSubDir)
 
 void PluginManager::loadPluginsFinal()
 {
+    QElapsedTimer timer;
+    timer.start();
     std::sort(m_plugins.begin(), m_plugins.end());
 
     for (Plugins::const_iterator it = m_plugins.begin(); it != m_plugins.end(); ++it)
@@ -110,9 +147,33 @@ void PluginManager::loadPluginsFinal()
         it->pluginInterface->initPlugin(&m_pluginAPI);
     }
 
+    qint64 initNsecs = timer.nsecsElapsed();
+    timer.restart();
+    DeviceEnumerator::instance()->enumerateOriginDevices(this);
+    qint64 originNsecs = timer.nsecsElapsed();
+    timer.restart();
     DeviceEnumerator::instance()->enumerateRxDevices(this);
     DeviceEnumerator::instance()->enumerateTxDevices(this);
     DeviceEnumerator::instance()->enumerateMIMODevices(this);
+    qint64 samplingNsecs = timer.nsecsElapsed();
+
+    // startup timing report with the slowest devices enumerations
+    QList<QPair<QString, qint64>> enumerationTimings = DeviceEnumerator::instance()->getEnumerationTimings();
+    std::sort(enumerationTimings.begin(), enumerationTimings.end(), [](const QPair<QString, qint64>& a, const QPair<QString, qint64>& b) {
+        return a.second > b.second;
+    });
+    QStringList slowest;
+
+    for (int i = 0; (i < enumerationTimings.size()) && (i < 5); i++) {
+        slowest.append(QString("%1 %2 ms").arg(enumerationTimings[i].first).arg(enumerationTimings[i].second / 1000000));
+    }
+
+    qInfo("PluginManager::loadPluginsFinal: startup timing: load %lld ms (%d plugins) init %lld ms devices %lld ms sampling devices %lld ms",
+        m_loadNsecs / 1000000, m_plugins.size(), initNsecs / 1000000, originNsecs / 1000000, samplingNsecs / 1000000);
+
+    if (slowest.size() > 0) {
+        qInfo("PluginManager::loadPluginsFinal: slowest devices enumerations: %s", qPrintable(slowest.join(", ")));
+    }
 }
 
 void PluginManager::loadPluginsNonDiscoverable(const DeviceUserArgs& deviceUserArgs)
@@ -192,35 +253,50 @@ void PluginManager::registerSampleMIMO(const QString& mimoName, PluginInterface*
 void PluginManager::loadPluginsDir(const QDir& dir)
 {
     QDir pluginsDir(dir);
+    QElapsedTimer timer;
+    timer.start();
+    std::vector<PluginLibraryLoad*> loads;
+
+    // the libraries and their dependencies are loaded concurrently
+    QThreadPool threadPool;
 
     foreach (QString fileName, pluginsDir.entryList(QDir::Files))
     {
         if (QLibrary::isLibrary(fileName))
         {
             qDebug("PluginManager::loadPluginsDir: fileName: %s", qPrintable(fileName));
+            loads.push_back(new PluginLibraryLoad(new QPluginLoader(pluginsDir.absoluteFilePath(fileName))));
+            threadPool.start(loads.back());
+        }
+    }
+
+    threadPool.waitForDone();
 
-            QPluginLoader* pluginLoader = new QPluginLoader(pluginsDir.absoluteFilePath(fileName));
-            if (!pluginLoader->load())
-            {
-                qWarning("PluginManager::loadPluginsDir: %s", qPrintable(pluginLoader->errorString()));
-                delete pluginLoader;
-                continue;
-            }
-
-            PluginInterface* instance = qobject_cast<PluginInterface*>(pluginLoader->instance());
-            if (instance == nullptr)
-            {
-                qWarning("PluginManager::loadPluginsDir: Unable to get main instance of plugin: %s", qPrintable(fileName) );
-                delete pluginLoader;
-                continue;
-            }
-
-            delete(pluginLoader);
-
-            qInfo("PluginManager::loadPluginsDir: loaded plugin %s", qPrintable(fileName));
+    // plugin instances are created in this thread
+    for (auto load : loads)
+    {
+        QPluginLoader *pluginLoader = load->m_pluginLoader;
+        QString fileName = QFileInfo(pluginLoader->fileName()).fileName();
+        qint64 loadNsecs = load->m_nsecs;
+        PluginInterface* instance = nullptr;
+
+        if (!load->m_loaded) {
+            qWarning("PluginManager::loadPluginsDir: %s", qPrintable(pluginLoader->errorString()));
+        } else if ((instance = qobject_cast<PluginInterface*>(pluginLoader->instance())) == nullptr) {
+            qWarning("PluginManager::loadPluginsDir: Unable to get main instance of plugin: %s", qPrintable(fileName) );
+        }
+
+        delete pluginLoader;
+        delete load;
+
+        if (instance)
+        {
+            qInfo("PluginManager::loadPluginsDir: loaded plugin %s in %lld ms", qPrintable(fileName), loadNsecs / 1000000);
             m_plugins.append(Plugin(fileName, instance));
-       }
+        }
     }
+
+    m_loadNsecs += timer.nsecsElapsed();
 }
 
 void PluginManager::listTxChannels(QList<QString>& list)
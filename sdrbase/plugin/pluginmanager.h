@@ -92,6 +92,10 @@ public:
 
 	static const QString& getFileInputDeviceId() { return m_fileInputDeviceTypeID; }
 	static const QString& getFileOutputDeviceId() { return m_fileOutputDeviceTypeID; }
+	static const QString& getFileInputHardwareId() { return m_fileInputHardwareID; }
+	static const QString& getFileOutputHardwareId() { return m_fileOutputHardwareID; }
+	static const QString& getTestMIMODeviceId() { return m_testMIMODeviceTypeID; }
+	static const QString& getTestMIMOHardwareId() { return m_testMIMOHardwareID; }
 
 private:
 	struct SamplingDevice { //!< This is the device registration
@@ -121,6 +125,7 @@ private:
 
 	PluginAPI m_pluginAPI;
 	Plugins m_plugins;
+	qint64 m_loadNsecs; //!< time spent loading the plugins libraries
 
 	PluginAPI::ChannelRegistrations m_rxChannelRegistrations;           //!< Channel plugins register here
 	PluginAPI::ChannelRegistrations m_txChannelRegistrations;           //!< Channel plugins register here
@@ -146,6 +151,10 @@ private:
     static const QString m_fileOutputHardwareID;     //!< FileOutput sink hardware ID
     static const QString m_fileOutputDeviceTypeID;   //!< FileOutput sink plugin ID
 
+    // "Local" sample MIMO device IDs
+    static const QString m_testMIMOHardwareID;       //!< Test MIMO hardware ID
+    static const QString m_testMIMODeviceTypeID;     //!< Test MIMO plugin ID
+
 	void loadPluginsDir(const QDir& dir);
 };
 
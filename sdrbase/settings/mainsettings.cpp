@@ -1,5 +1,6 @@
 #include <QSettings>
 #include <QStringList>
+#include <QStandardPaths>
 
 #include <algorithm>
 
@@ -13,7 +14,9 @@ MainSettings::MainSettings() :
     m_ambeEngine(nullptr)
 {
 	resetToDefaults();
+    m_presetStore.setDirectory(QStandardPaths::writableLocation(QStandardPaths::AppDataLocation) + "/presets");
     qInfo("MainSettings::MainSettings: settings file: format: %d location: %s", getFileFormat(), qPrintable(getFileLocation()));
+    qInfo("MainSettings::MainSettings: presets location: %s", qPrintable(getPresetsLocation()));
 }
 
 MainSettings::~MainSettings()
@@ -46,7 +49,11 @@ void MainSettings::load()
 	QSettings s;
 
 	m_preferences.deserialize(qUncompress(QByteArray::fromBase64(s.value("preferences").toByteArray())));
-	m_workingPreset.deserialize(qUncompress(QByteArray::fromBase64(s.value("current").toByteArray())));
+	bool presetStoreLoaded = m_presetStore.exists() && m_presetStore.load(m_presets, m_workingPreset);
+
+	if (!presetStoreLoaded) { // settings saved before the preset store
+		m_workingPreset.deserialize(qUncompress(QByteArray::fromBase64(s.value("current").toByteArray())));
+	}
 
 	if (m_audioDeviceManager) {
 	    m_audioDeviceManager->deserialize(qUncompress(QByteArray::fromBase64(s.value("audio").toByteArray())));
@@ -60,7 +67,7 @@ void MainSettings::load()
 
 	for(int i = 0; i < groups.size(); ++i)
 	{
-		if (groups[i].startsWith("preset"))
+		if (groups[i].startsWith("preset") && !presetStoreLoaded)
 		{
 			s.beginGroup(groups[i]);
 			Preset* preset = new Preset;
@@ -103,7 +110,13 @@ void MainSettings::save() const
 	QSettings s;
 
 	s.setValue("preferences", qCompress(m_preferences.serialize()).toBase64());
-	s.setValue("current", qCompress(m_workingPreset.serialize()).toBase64());
+	bool presetStoreSaved = m_presetStore.save(m_presets, m_workingPreset);
+
+	if (presetStoreSaved) { // now in the preset store
+		s.remove("current");
+	} else {
+		s.setValue("current", qCompress(m_workingPreset.serialize()).toBase64());
+	}
 
 	if (m_audioDeviceManager) {
 	    s.setValue("audio", qCompress(m_audioDeviceManager->serialize()).toBase64());
@@ -117,20 +130,12 @@ void MainSettings::save() const
 
 	for(int i = 0; i < groups.size(); ++i)
 	{
-		if ((groups[i].startsWith("preset")) || (groups[i].startsWith("command")))
+		if ((groups[i].startsWith("preset") && presetStoreSaved) || (groups[i].startsWith("command")))
 		{
 			s.remove(groups[i]);
 		}
 	}
 
-	for (int i = 0; i < m_presets.count(); ++i)
-	{
-		QString group = QString("preset-%1").arg(i + 1);
-		s.beginGroup(group);
-		s.setValue("data", qCompress(m_presets[i]->serialize()).toBase64());
-		s.endGroup();
-	}
-
     for (int i = 0; i < m_commands.count(); ++i)
     {
         QString group = QString("command-%1").arg(i + 1);
@@ -6,6 +6,7 @@
 #include "limerfe/limerfeusbcalib.h"
 #include "preferences.h"
 #include "preset.h"
+#include "presetstore.h"
 #include "export.h"
 
 class Command;
@@ -24,6 +25,7 @@ public:
     void initialize();
 	QString getFileLocation() const;
 	int getFileFormat() const; //!< see QSettings::Format for the values
+	const QString& getPresetsLocation() const { return m_presetStore.getDirectory(); }
 
     const Preferences& getPreferences() const { return m_preferences; }
     void setPreferences(const Preferences& preferences) { m_preferences = preferences; }
@@ -69,6 +71,8 @@ public:
     QtMsgType getFileMinLogLevel() const { return m_preferences.getFileMinLogLevel(); }
     bool getUseLogFile() const { return m_preferences.getUseLogFile(); }
     const QString& getLogFileName() const { return m_preferences.getLogFileName(); }
+    void setThreadPrioritySettings(int deviceSetIndex, const ThreadPriority::Settings& settings) { m_preferences.setThreadPrioritySettings(deviceSetIndex, settings); }
+    const QMap<int, ThreadPriority::Settings>& getThreadPrioritySettings() const { return m_preferences.getThreadPrioritySettings(); }
 	DeviceUserArgs& getDeviceUserArgs() { return m_hardwareDeviceUserArgs; }
 	LimeRFEUSBCalib& getLimeRFEUSBCalib() { return m_limeRFEUSBCalib; }
 
@@ -82,6 +86,7 @@ protected:
 	Preset m_workingPreset;
 	typedef QList<Preset*> Presets;
 	Presets m_presets;
+	mutable PresetStore m_presetStore; //!< presets and working preset storage
     typedef QList<Command*> Commands;
     Commands m_commands;
 	DeviceUserArgs m_hardwareDeviceUserArgs;
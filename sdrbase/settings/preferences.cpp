@@ -18,6 +18,7 @@ void Preferences::resetToDefaults()
 	m_logFileName = "sdrangel.log";
 	m_consoleMinLogLevel = QtDebugMsg;
     m_fileMinLogLevel = QtDebugMsg;
+	m_threadPrioritySettings.clear();
 }
 
 QByteArray Preferences::serialize() const
@@ -33,6 +34,15 @@ QByteArray Preferences::serialize() const
 	s.writeBool(9, m_useLogFile);
 	s.writeString(10, m_logFileName);
     s.writeS32(11, (int) m_fileMinLogLevel);
+	s.writeS32(12, m_threadPrioritySettings.size());
+	int i = 0;
+
+	for (QMap<int, ThreadPriority::Settings>::const_iterator it = m_threadPrioritySettings.begin(); it != m_threadPrioritySettings.end(); ++it, i++)
+	{
+		s.writeS32(100 + 2*i, it.key());
+		s.writeBlob(101 + 2*i, it.value().serialize());
+	}
+
 	return s.final();
 }
 
@@ -83,6 +93,23 @@ bool Preferences::deserialize(const QByteArray& data)
             m_fileMinLogLevel = QtDebugMsg;
         }
 
+		int nbThreadPrioritySettings;
+		d.readS32(12, &nbThreadPrioritySettings, 0);
+		m_threadPrioritySettings.clear();
+
+		for (int i = 0; i < nbThreadPrioritySettings; i++)
+		{
+			int deviceSetIndex;
+			QByteArray blob;
+			ThreadPriority::Settings settings;
+			d.readS32(100 + 2*i, &deviceSetIndex, -1);
+			d.readBlob(101 + 2*i, &blob);
+
+			if ((deviceSetIndex >= 0) && settings.deserialize(blob)) {
+				m_threadPrioritySettings[deviceSetIndex] = settings;
+			}
+		}
+
 		return true;
 	} else
 	{
@@ -2,7 +2,9 @@
 #define INCLUDE_PREFERENCES_H
 
 #include <QString>
+#include <QMap>
 
+#include "util/threadpriority.h"
 #include "export.h"
 
 class SDRBASE_API Preferences {
@@ -37,6 +39,9 @@ public:
 	bool getUseLogFile() const { return m_useLogFile; }
 	const QString& getLogFileName() const { return m_logFileName; }
 
+	void setThreadPrioritySettings(int deviceSetIndex, const ThreadPriority::Settings& settings) { m_threadPrioritySettings[deviceSetIndex] = settings; }
+	const QMap<int, ThreadPriority::Settings>& getThreadPrioritySettings() const { return m_threadPrioritySettings; }
+
 protected:
 	QString m_sourceDevice; //!< Identification of the source used in R0 tab (GUI flavor) at startup
 	int m_sourceIndex;      //!< Index of the source used in R0 tab (GUI flavor) at startup
@@ -51,6 +56,8 @@ protected:
     QtMsgType m_fileMinLogLevel;
 	bool m_useLogFile;
 	QString m_logFileName;
+
+	QMap<int, ThreadPriority::Settings> m_threadPrioritySettings; //!< DSP threads priority and CPU affinity by device set index
 };
 
 #endif // INCLUDE_PREFERENCES_H
@@ -28,6 +28,7 @@ Preset::Preset()
 }
 
 Preset::Preset(const Preset& other) :
+	m_presetType(other.m_presetType),
 	m_group(other.m_group),
 	m_description(other.m_description),
 	m_centerFrequency(other.m_centerFrequency),
@@ -36,7 +37,8 @@ Preset::Preset(const Preset& other) :
 	m_iqImbalanceCorrection(other.m_iqImbalanceCorrection),
 	m_channelConfigs(other.m_channelConfigs),
 	m_deviceConfigs(other.m_deviceConfigs),
-	m_layout(other.m_layout)
+	m_layout(other.m_layout),
+	m_deferredData(other.m_deferredData)
 {}
 
 void Preset::resetToDefaults()
@@ -50,10 +52,34 @@ void Preset::resetToDefaults()
 	m_channelConfigs.clear();
 	m_dcOffsetCorrection = false;
 	m_iqImbalanceCorrection = false;
+	m_deferredData.clear();
+}
+
+void Preset::loadDeferred() const
+{
+	// header may have been changed before the first use
+	Preset *preset = const_cast<Preset*>(this);
+	PresetType presetType = m_presetType;
+	QString group = m_group;
+	QString description = m_description;
+	quint64 centerFrequency = m_centerFrequency;
+	QByteArray data;
+	data.swap(m_deferredData);
+
+	if (!preset->deserialize(data)) {
+		qWarning("Preset::loadDeferred: invalid data for %s:%s", qPrintable(group), qPrintable(description));
+	}
+
+	preset->m_presetType = presetType;
+	preset->m_group = group;
+	preset->m_description = description;
+	preset->m_centerFrequency = centerFrequency;
 }
 
 QByteArray Preset::serialize() const
 {
+	load();
+
 //	qDebug("Preset::serialize: m_group: %s mode: %s m_description: %s m_centerFrequency: %llu",
 //			qPrintable(m_group),
 //			m_sourcePreset ? "Rx" : "Tx",
@@ -106,6 +132,8 @@ QByteArray Preset::serialize() const
 
 bool Preset::deserialize(const QByteArray& data)
 {
+	m_deferredData.clear();
+
 	SimpleDeserializer d(data);
 
 	if (!d.isValid())
@@ -201,6 +229,8 @@ void Preset::addOrUpdateDeviceConfig(const QString& sourceId,
 		int sourceSequence,
 		const QByteArray& config)
 {
+	load();
+
 	DeviceeConfigs::iterator it = m_deviceConfigs.begin();
 
 	for (; it != m_deviceConfigs.end(); ++it)
@@ -239,6 +269,8 @@ const QByteArray* Preset::findDeviceConfig(
         const QString& deviceSerial,
         int deviceSequence) const
 {
+    load();
+
     DeviceeConfigs::const_iterator it = m_deviceConfigs.begin();
 
     for (; it != m_deviceConfigs.end(); ++it)
@@ -256,6 +288,8 @@ const QByteArray* Preset::findBestDeviceConfig(
 		const QString& sourceSerial,
 		int sourceSequence) const
 {
+	load();
+
 	// Special case for SoapySDR based on serial (driver name)
 	if (sourceId == "sdrangel.samplesource.soapysdrinput") {
 		return findBestDeviceConfigSoapy(sourceId, sourceSerial);
@@ -327,6 +361,8 @@ const QByteArray* Preset::findBestDeviceConfig(
 
 const QByteArray* Preset::findBestDeviceConfigSoapy(const QString& sourceId, const QString& sourceSerial) const
 {
+	load();
+
 	QStringList sourceSerialPieces = sourceSerial.split("-");
 
 	if (sourceSerialPieces.size() == 0) {
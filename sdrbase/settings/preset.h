@@ -80,6 +80,8 @@ public:
 
 	QByteArray serialize() const;
 	bool deserialize(const QByteArray& data);
+	void setDeferredData(const QByteArray& data) { m_deferredData = data; } //!< data deserialized on first use. Header (type, group, description, frequency) must be set.
+	bool isLoaded() const { return m_deferredData.isEmpty(); }
 
 	void setGroup(const QString& group) { m_group = group; }
 	const QString& getGroup() const { return m_group; }
@@ -88,28 +90,28 @@ public:
 	void setCenterFrequency(const quint64 centerFrequency) { m_centerFrequency = centerFrequency; }
 	quint64 getCenterFrequency() const { return m_centerFrequency; }
 
-	void setSpectrumConfig(const QByteArray& data) { m_spectrumConfig = data; }
-	const QByteArray& getSpectrumConfig() const { return m_spectrumConfig; }
+	void setSpectrumConfig(const QByteArray& data) { load(); m_spectrumConfig = data; }
+	const QByteArray& getSpectrumConfig() const { load(); return m_spectrumConfig; }
 
-	bool hasDCOffsetCorrection() const { return m_dcOffsetCorrection; }
-    void setDCOffsetCorrection(bool dcOffsetCorrection) { m_dcOffsetCorrection = dcOffsetCorrection; }
-	bool hasIQImbalanceCorrection() const { return m_iqImbalanceCorrection; }
-    void setIQImbalanceCorrection(bool iqImbalanceCorrection) { m_iqImbalanceCorrection = iqImbalanceCorrection; }
+	bool hasDCOffsetCorrection() const { load(); return m_dcOffsetCorrection; }
+    void setDCOffsetCorrection(bool dcOffsetCorrection) { load(); m_dcOffsetCorrection = dcOffsetCorrection; }
+	bool hasIQImbalanceCorrection() const { load(); return m_iqImbalanceCorrection; }
+    void setIQImbalanceCorrection(bool iqImbalanceCorrection) { load(); m_iqImbalanceCorrection = iqImbalanceCorrection; }
 
-	void setLayout(const QByteArray& data) { m_layout = data; }
-	const QByteArray& getLayout() const { return m_layout; }
+	void setLayout(const QByteArray& data) { load(); m_layout = data; }
+	const QByteArray& getLayout() const { load(); return m_layout; }
 
-	void clearChannels() { m_channelConfigs.clear(); }
-	void addChannel(const QString& channel, const QByteArray& config) { m_channelConfigs.append(ChannelConfig(channel, config)); }
-	int getChannelCount() const { return m_channelConfigs.count(); }
-	const ChannelConfig& getChannelConfig(int index) const { return m_channelConfigs.at(index); }
+	void clearChannels() { load(); m_channelConfigs.clear(); }
+	void addChannel(const QString& channel, const QByteArray& config) { load(); m_channelConfigs.append(ChannelConfig(channel, config)); }
+	int getChannelCount() const { load(); return m_channelConfigs.count(); }
+	const ChannelConfig& getChannelConfig(int index) const { load(); return m_channelConfigs.at(index); }
 
-    void clearDevices() { m_deviceConfigs.clear(); }
+    void clearDevices() { load(); m_deviceConfigs.clear(); }
 	void setDeviceConfig(const QString& deviceId, const QString& deviceSerial, int deviceSequence, const QByteArray& config) {
 		addOrUpdateDeviceConfig(deviceId, deviceSerial, deviceSequence, config);
 	}
-    int getDeviceCount() const { return m_deviceConfigs.count(); }
-    const DeviceConfig& getDeviceConfig(int index) const { return m_deviceConfigs.at(index); }
+    int getDeviceCount() const { load(); return m_deviceConfigs.count(); }
+    const DeviceConfig& getDeviceConfig(int index) const { load(); return m_deviceConfigs.at(index); }
 
 	void addOrUpdateDeviceConfig(const QString& deviceId,
 			const QString& deviceSerial,
@@ -166,7 +168,17 @@ protected:
 	// screen and dock layout
 	QByteArray m_layout;
 
+	mutable QByteArray m_deferredData; //!< serialized data waiting for deserialization
+
+	void load() const
+	{
+		if (!m_deferredData.isEmpty()) {
+			loadDeferred();
+		}
+	}
+
 private:
+	void loadDeferred() const;
 	const QByteArray* findBestDeviceConfigSoapy(const QString& sourceId, const QString& deviceSerial) const;
 };
 
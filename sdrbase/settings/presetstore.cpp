@@ -0,0 +1,282 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QDataStream>
+#include <QSet>
+#include <QDateTime>
+#include <QCryptographicHash>
+#include <QElapsedTimer>
+#include <QDebug>
+
+#include "presetstore.h"
+
+const quint32 PresetStore::m_version = 1;
+const QString PresetStore::m_indexFileName = "index";
+const QString PresetStore::m_workingPresetFileName = "current.preset";
+
+void PresetStore::Entry::setHeader(const Preset *preset)
+{
+    m_presetType = preset->getPresetType();
+    m_group = preset->getGroup();
+    m_description = preset->getDescription();
+    m_centerFrequency = preset->getCenterFrequency();
+}
+
+bool PresetStore::Entry::sameHeader(const Preset *preset) const
+{
+    return (m_presetType == preset->getPresetType())
+        && (m_group == preset->getGroup())
+        && (m_description == preset->getDescription())
+        && (m_centerFrequency == preset->getCenterFrequency());
+}
+
+PresetStore::PresetStore() :
+    m_nextId(1),
+    m_loadFailed(false)
+{}
+
+QString PresetStore::getPresetFileName(quint32 id) const
+{
+    return QString("%1/%2.preset").arg(m_directory).arg(id);
+}
+
+QByteArray PresetStore::digest(const QByteArray& data)
+{
+    return QCryptographicHash::hash(data, QCryptographicHash::Sha1);
+}
+
+bool PresetStore::backup()
+{
+    QString backupDirectory = QString("%1.%2.bak")
+        .arg(m_directory)
+        .arg(QDateTime::currentDateTime().toString("yyyyMMddhhmmss"));
+
+    if (!QDir().rename(m_directory, backupDirectory))
+    {
+        qWarning("PresetStore::backup: cannot move %s to %s", qPrintable(m_directory), qPrintable(backupDirectory));
+        return false;
+    }
+
+    qWarning("PresetStore::backup: unreadable presets moved to %s", qPrintable(backupDirectory));
+
+    // everything is written again in a new store
+    m_entries.clear();
+    m_nextId = 1;
+    m_workingPresetDigest.clear();
+    m_loadFailed = false;
+    return true;
+}
+
+bool PresetStore::exists() const
+{
+    return QFile::exists(m_directory + "/" + m_indexFileName);
+}
+
+bool PresetStore::readFile(const QString& fileName, QByteArray& data) const
+{
+    QFile file(fileName);
+
+    if (!file.open(QIODevice::ReadOnly))
+    {
+        qWarning("PresetStore::readFile: cannot read %s", qPrintable(fileName));
+        return false;
+    }
+
+    data = file.readAll();
+    return true;
+}
+
+bool PresetStore::writeFile(const QString& fileName, const QByteArray& data) const
+{
+    QSaveFile file(fileName);
+
+    if (!file.open(QIODevice::WriteOnly))
+    {
+        qWarning("PresetStore::writeFile: cannot write %s", qPrintable(fileName));
+        return false;
+    }
+
+    file.write(data);
+    return file.commit();
+}
+
+bool PresetStore::load(QList<Preset*>& presets, Preset& workingPreset)
+{
+    QElapsedTimer timer;
+    timer.start();
+    QByteArray indexData;
+    m_loadFailed = true; // until the index is read entirely
+
+    if (!readFile(m_directory + "/" + m_indexFileName, indexData)) {
+        return false;
+    }
+
+    QDataStream index(indexData);
+    quint32 version, nextId, nbPresets;
+    index >> version >> nextId >> nbPresets;
+
+    if ((index.status() != QDataStream::Ok) || (version != m_version))
+    {
+        qWarning("PresetStore::load: invalid index or unsupported version %u", version);
+        return false;
+    }
+
+    m_nextId = nextId;
+
+    for (quint32 i = 0; (i < nbPresets) && (index.status() == QDataStream::Ok); i++)
+    {
+        Entry entry;
+        qint32 presetType;
+        index >> entry.m_id >> presetType >> entry.m_group >> entry.m_description >> entry.m_centerFrequency;
+        entry.m_presetType = (Preset::PresetType) presetType;
+        QByteArray data;
+
+        if ((index.status() != QDataStream::Ok) || !readFile(getPresetFileName(entry.m_id), data)) {
+            continue;
+        }
+
+        Preset *preset = new Preset();
+        preset->setPresetType(entry.m_presetType);
+        preset->setGroup(entry.m_group);
+        preset->setDescription(entry.m_description);
+        preset->setCenterFrequency(entry.m_centerFrequency);
+        preset->setDeferredData(data);
+        entry.m_digest = digest(data);
+        m_entries.insert(preset, entry);
+        presets.append(preset);
+    }
+
+    if (index.status() == QDataStream::Ok) {
+        m_loadFailed = false;
+    } else {
+        qWarning("PresetStore::load: corrupt index: %d presets read", presets.size());
+    }
+
+    QByteArray workingPresetData;
+
+    if (readFile(m_directory + "/" + m_workingPresetFileName, workingPresetData))
+    {
+        workingPreset.deserialize(workingPresetData);
+        m_workingPresetDigest = digest(workingPresetData);
+    }
+
+    qDebug("PresetStore::load: %d presets from %s in %lld ms",
+        presets.size(), qPrintable(m_directory), timer.elapsed());
+
+    return true;
+}
+
+bool PresetStore::save(const QList<Preset*>& presets, const Preset& workingPreset)
+{
+    QElapsedTimer timer;
+    timer.start();
+
+    if (m_loadFailed && exists() && !backup()) {
+        return false; // do not touch a store that could not be read
+    }
+
+    if (!QDir().mkpath(m_directory))
+    {
+        qWarning("PresetStore::save: cannot create %s", qPrintable(m_directory));
+        return false;
+    }
+
+    QSet<const Preset*> current;
+    QByteArray indexData;
+    QDataStream index(&indexData, QIODevice::WriteOnly);
+    int nbWritten = 0;
+    bool success = true;
+
+    for (const Preset *preset : presets)
+    {
+        current.insert(preset);
+        auto it = m_entries.find(preset);
+        bool isNew = it == m_entries.end();
+
+        if (isNew)
+        {
+            it = m_entries.insert(preset, Entry());
+            it->m_id = m_nextId++;
+        }
+
+        // presets not yet used cannot have changed except for their header
+        if (isNew || preset->isLoaded() || !it->sameHeader(preset))
+        {
+            QByteArray data = preset->serialize();
+            QByteArray dataDigest = digest(data);
+
+            if (isNew || (dataDigest != it->m_digest) || !it->sameHeader(preset))
+            {
+                if (writeFile(getPresetFileName(it->m_id), data))
+                {
+                    nbWritten++;
+                    it->m_digest = dataDigest;
+                }
+                else
+                {
+                    success = false;
+                }
+            }
+        }
+
+        it->setHeader(preset);
+    }
+
+    // removed presets
+    for (auto it = m_entries.begin(); it != m_entries.end();)
+    {
+        if (current.contains(it.key()))
+        {
+            ++it;
+        }
+        else
+        {
+            QFile::remove(getPresetFileName(it->m_id));
+            it = m_entries.erase(it);
+        }
+    }
+
+    index << m_version << m_nextId << (quint32) presets.size();
+
+    for (const Preset *preset : presets)
+    {
+        const Entry& entry = m_entries[preset];
+        index << entry.m_id << (qint32) entry.m_presetType << entry.m_group << entry.m_description << entry.m_centerFrequency;
+    }
+
+    success = writeFile(m_directory + "/" + m_indexFileName, indexData) && success;
+
+    QByteArray workingPresetData = workingPreset.serialize();
+    QByteArray workingPresetDigest = digest(workingPresetData);
+
+    if (workingPresetDigest != m_workingPresetDigest)
+    {
+        if (writeFile(m_directory + "/" + m_workingPresetFileName, workingPresetData)) {
+            m_workingPresetDigest = workingPresetDigest;
+        } else {
+            success = false;
+        }
+    }
+
+    qDebug("PresetStore::save: %d of %d presets written to %s in %lld ms",
+        nbWritten, presets.size(), qPrintable(m_directory), timer.elapsed());
+
+    return success;
+}
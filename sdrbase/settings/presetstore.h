@@ -0,0 +1,87 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef INCLUDE_SETTINGS_PRESETSTORE_H
+#define INCLUDE_SETTINGS_PRESETSTORE_H
+
+#include <QString>
+#include <QList>
+#include <QHash>
+
+#include "settings/preset.h"
+#include "export.h"
+
+/**
+ * Presets storage in a directory with one binary file per preset (<id>.preset) plus the
+ * working preset (current.preset) and an index file giving the presets order and headers
+ * (type, group, description, center frequency).
+ *
+ * On load presets are created with their header only and their data is deserialized on first use.
+ * On save only the presets that changed since they were loaded or last saved are rewritten.
+ *
+ * A store that cannot be read entirely is moved aside to a backup directory before the next save
+ * so that its presets are never overwritten or pruned.
+ */
+class SDRBASE_API PresetStore
+{
+public:
+    PresetStore();
+
+    void setDirectory(const QString& directory) { m_directory = directory; }
+    const QString& getDirectory() const { return m_directory; }
+    bool exists() const; //!< true if an index was saved in the directory
+    bool load(QList<Preset*>& presets, Preset& workingPreset);
+    bool save(const QList<Preset*>& presets, const Preset& workingPreset); //!< false if something could not be written
+
+private:
+    struct Entry
+    {
+        quint32 m_id;        //!< file name
+        QByteArray m_digest; //!< digest of the data as last read or written
+        Preset::PresetType m_presetType;
+        QString m_group;
+        QString m_description;
+        quint64 m_centerFrequency;
+
+        Entry() :
+            m_id(0),
+            m_presetType(Preset::PresetSource),
+            m_centerFrequency(0)
+        {}
+
+        void setHeader(const Preset *preset);
+        bool sameHeader(const Preset *preset) const;
+    };
+
+    QString m_directory;
+    QHash<const Preset*, Entry> m_entries;
+    quint32 m_nextId;
+    QByteArray m_workingPresetDigest;
+    bool m_loadFailed; //!< the store in the directory could not be read entirely
+
+    static const quint32 m_version;
+    static const QString m_indexFileName;
+    static const QString m_workingPresetFileName;
+
+    QString getPresetFileName(quint32 id) const;
+    bool backup();
+    static QByteArray digest(const QByteArray& data);
+    bool readFile(const QString& fileName, QByteArray& data) const;
+    bool writeFile(const QString& fileName, const QByteArray& data) const;
+};
+
+#endif // INCLUDE_SETTINGS_PRESETSTORE_H
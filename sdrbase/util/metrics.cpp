@@ -0,0 +1,381 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <algorithm>
+#include <new>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#include <QMutexLocker>
+#include <QStringList>
+
+#include "metrics.h"
+
+namespace {
+
+quint64 toBits(double value)
+{
+    quint64 bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+double fromBits(quint64 bits)
+{
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+void addDouble(std::atomic<quint64>& bits, double value)
+{
+    quint64 expected = bits.load(std::memory_order_relaxed);
+
+    while (!bits.compare_exchange_weak(expected, toBits(fromBits(expected) + value), std::memory_order_relaxed)) {}
+}
+
+} // namespace
+
+Metrics::Counter::Counter() :
+    m_stripes(m_nbStripes)
+{
+    for (auto& stripe : m_stripes) {
+        stripe.m_values[0].store(0, std::memory_order_relaxed);
+    }
+}
+
+quint64 Metrics::Counter::value() const
+{
+    quint64 sum = 0;
+
+    for (const auto& stripe : m_stripes) {
+        sum += stripe.m_values[0].load(std::memory_order_relaxed);
+    }
+
+    return sum;
+}
+
+Metrics::Gauge::Gauge() :
+    m_value(toBits(0.0))
+{}
+
+void Metrics::Gauge::set(double value)
+{
+    m_value.store(toBits(value), std::memory_order_relaxed);
+}
+
+void Metrics::Gauge::add(double value)
+{
+    addDouble(m_value, value);
+}
+
+double Metrics::Gauge::value() const
+{
+    return fromBits(m_value.load(std::memory_order_relaxed));
+}
+
+Metrics::Histogram::Histogram(const std::vector<double>& bounds) :
+    m_bounds(bounds),
+    m_linesPerStripe((bounds.size() + 2 + sizeof(CacheLine) / sizeof(quint64) - 1) / (sizeof(CacheLine) / sizeof(quint64))),
+    m_stripes(m_nbStripes * m_linesPerStripe)
+{
+    std::sort(m_bounds.begin(), m_bounds.end());
+
+    for (auto& line : m_stripes)
+    {
+        for (auto& value : line.m_values) {
+            value.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    for (int i = 0; i < m_nbStripes; i++) {
+        at(i, m_bounds.size() + 1).store(toBits(0.0), std::memory_order_relaxed);
+    }
+}
+
+std::atomic<quint64>& Metrics::Histogram::at(int stripe, unsigned int index)
+{
+    const unsigned int valuesPerLine = sizeof(CacheLine) / sizeof(quint64);
+    return m_stripes[stripe * m_linesPerStripe + index / valuesPerLine].m_values[index % valuesPerLine];
+}
+
+const std::atomic<quint64>& Metrics::Histogram::at(int stripe, unsigned int index) const
+{
+    const unsigned int valuesPerLine = sizeof(CacheLine) / sizeof(quint64);
+    return m_stripes[stripe * m_linesPerStripe + index / valuesPerLine].m_values[index % valuesPerLine];
+}
+
+void Metrics::Histogram::observe(double value)
+{
+    int stripe = stripeIndex();
+    unsigned int bucket = std::lower_bound(m_bounds.begin(), m_bounds.end(), value) - m_bounds.begin(); // le semantics
+    at(stripe, bucket).fetch_add(1, std::memory_order_relaxed);
+    addDouble(at(stripe, m_bounds.size() + 1), value); // uncontended unless threads share the stripe
+}
+
+void Metrics::Histogram::getValues(std::vector<quint64>& bucketCounts, double& sum, quint64& count) const
+{
+    unsigned int nbBuckets = m_bounds.size() + 1;
+    bucketCounts.assign(nbBuckets, 0);
+    sum = 0.0;
+    count = 0;
+
+    for (int i = 0; i < m_nbStripes; i++)
+    {
+        for (unsigned int j = 0; j < nbBuckets; j++)
+        {
+            quint64 n = at(i, j).load(std::memory_order_relaxed);
+            bucketCounts[j] += n;
+            count += n;
+        }
+
+        sum += fromBits(at(i, nbBuckets).load(std::memory_order_relaxed));
+    }
+}
+
+Metrics& Metrics::instance()
+{
+    static Metrics metrics;
+    return metrics;
+}
+
+Metrics::Metrics()
+{}
+
+Metrics::~Metrics()
+{
+    for (auto& family : m_families)
+    {
+        for (void *series : family.m_series) {
+            deleteSeries(family.m_type, series);
+        }
+    }
+}
+
+void Metrics::deleteSeries(Type type, void *series)
+{
+    if (type == TypeCounter) {
+        delete static_cast<Counter*>(series);
+    } else if (type == TypeGauge) {
+        delete static_cast<Gauge*>(series);
+    } else {
+        delete static_cast<Histogram*>(series);
+    }
+}
+
+void *Metrics::alignedAlloc(std::size_t size, std::size_t alignment)
+{
+    void *p;
+#ifdef _WIN32
+    p = _aligned_malloc(size, alignment);
+#else
+    if (posix_memalign(&p, alignment, size) != 0) {
+        p = nullptr;
+    }
+#endif
+    if (!p) {
+        throw std::bad_alloc();
+    }
+
+    return p;
+}
+
+void Metrics::alignedFree(void *p)
+{
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+int Metrics::stripeIndex()
+{
+    static std::atomic<int> nextIndex(0);
+    static thread_local int index = nextIndex.fetch_add(1, std::memory_order_relaxed) % m_nbStripes;
+    return index;
+}
+
+Metrics::Counter *Metrics::counter(const QString& name, const QString& help, const Labels& labels)
+{
+    return static_cast<Counter*>(getSeries(TypeCounter, name, help, labels, nullptr));
+}
+
+Metrics::Gauge *Metrics::gauge(const QString& name, const QString& help, const Labels& labels)
+{
+    return static_cast<Gauge*>(getSeries(TypeGauge, name, help, labels, nullptr));
+}
+
+Metrics::Histogram *Metrics::histogram(const QString& name, const QString& help, const std::vector<double>& bounds, const Labels& labels)
+{
+    return static_cast<Histogram*>(getSeries(TypeHistogram, name, help, labels, &bounds));
+}
+
+void *Metrics::getSeries(Type type, const QString& name, const QString& help, const Labels& labels, const std::vector<double>* bounds)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    auto familyIt = m_families.find(name);
+
+    if (familyIt == m_families.end())
+    {
+        familyIt = m_families.insert(name, Family());
+        familyIt->m_type = type;
+        familyIt->m_help = help;
+    }
+    else if (familyIt->m_type != type)
+    {
+        qWarning("Metrics::getSeries: %s already registered with another type", qPrintable(name));
+        return nullptr;
+    }
+
+    QString labelsStr = formatLabels(labels);
+    auto seriesIt = familyIt->m_series.find(labelsStr);
+
+    if (seriesIt != familyIt->m_series.end()) {
+        return seriesIt.value();
+    }
+
+    void *series;
+
+    if (type == TypeCounter) {
+        series = new Counter();
+    } else if (type == TypeGauge) {
+        series = new Gauge();
+    } else {
+        series = new Histogram(*bounds);
+    }
+
+    familyIt->m_series.insert(labelsStr, series);
+    return series;
+}
+
+void Metrics::removeSeries(const Labels& labels)
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    QString labelsStr = formatLabels(labels);
+    auto familyIt = m_families.begin();
+
+    while (familyIt != m_families.end())
+    {
+        auto seriesIt = familyIt->m_series.find(labelsStr);
+
+        if (seriesIt != familyIt->m_series.end())
+        {
+            deleteSeries(familyIt->m_type, seriesIt.value());
+            familyIt->m_series.erase(seriesIt);
+        }
+
+        if (familyIt->m_series.isEmpty()) { // no HELP and TYPE lines without samples
+            familyIt = m_families.erase(familyIt);
+        } else {
+            ++familyIt;
+        }
+    }
+}
+
+std::vector<double> Metrics::exponentialBuckets(double start, double factor, int count)
+{
+    std::vector<double> bounds;
+
+    for (int i = 0; i < count; i++, start *= factor) {
+        bounds.push_back(start);
+    }
+
+    return bounds;
+}
+
+QString Metrics::formatLabels(const Labels& labels)
+{
+    QStringList pairs;
+
+    for (const auto& label : labels)
+    {
+        QString value = label.second;
+        value.replace("\\", "\\\\").replace("\"", "\\\"").replace("\n", "\\n");
+        pairs.append(QString("%1=\"%2\"").arg(label.first).arg(value));
+    }
+
+    return pairs.join(",");
+}
+
+QString Metrics::formatValue(double value)
+{
+    if (std::isinf(value)) {
+        return value > 0 ? "+Inf" : "-Inf";
+    } else if (std::isnan(value)) {
+        return "NaN";
+    } else {
+        return QString::number(value, 'g', 12);
+    }
+}
+
+QByteArray Metrics::exportPrometheus() const
+{
+    QMutexLocker mutexLocker(&m_mutex);
+    QString out;
+    std::vector<quint64> bucketCounts;
+
+    for (auto familyIt = m_families.begin(); familyIt != m_families.end(); ++familyIt)
+    {
+        const QString& name = familyIt.key();
+        const Family& family = familyIt.value();
+        static const char *typeNames[] = {"counter", "gauge", "histogram"};
+        out += QString("# HELP %1 %2\n").arg(name).arg(family.m_help);
+        out += QString("# TYPE %1 %2\n").arg(name).arg(typeNames[family.m_type]);
+
+        for (auto seriesIt = family.m_series.begin(); seriesIt != family.m_series.end(); ++seriesIt)
+        {
+            const QString& labels = seriesIt.key();
+            QString braced = labels.isEmpty() ? QString() : "{" + labels + "}";
+
+            if (family.m_type == TypeCounter)
+            {
+                out += QString("%1%2 %3\n").arg(name).arg(braced).arg(static_cast<Counter*>(seriesIt.value())->value());
+            }
+            else if (family.m_type == TypeGauge)
+            {
+                out += QString("%1%2 %3\n").arg(name).arg(braced).arg(formatValue(static_cast<Gauge*>(seriesIt.value())->value()));
+            }
+            else
+            {
+                const Histogram *histogram = static_cast<Histogram*>(seriesIt.value());
+                const std::vector<double>& bounds = histogram->getBounds();
+                QString prefix = labels.isEmpty() ? QString() : labels + ",";
+                double sum;
+                quint64 count, cumulated = 0;
+                histogram->getValues(bucketCounts, sum, count);
+
+                for (unsigned int i = 0; i < bucketCounts.size(); i++)
+                {
+                    cumulated += bucketCounts[i];
+                    QString le = i < bounds.size() ? formatValue(bounds[i]) : QString("+Inf");
+                    out += QString("%1_bucket{%2le=\"%3\"} %4\n").arg(name).arg(prefix).arg(le).arg(cumulated);
+                }
+
+                out += QString("%1_sum%2 %3\n").arg(name).arg(braced).arg(formatValue(sum));
+                out += QString("%1_count%2 %3\n").arg(name).arg(braced).arg(count);
+            }
+        }
+    }
+
+    return out.toUtf8();
+}
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_UTIL_METRICS_H_
+#define SDRBASE_UTIL_METRICS_H_
+
+#include <atomic>
+#include <vector>
+#include <cstddef>
+
+#include <QString>
+#include <QList>
+#include <QPair>
+#include <QMap>
+#include <QMutex>
+#include <QByteArray>
+
+#include "export.h"
+
+/**
+ * Registry of the internal metrics exported in Prometheus text format.
+ *
+ * Metrics are created once by name and labels and live until the end of the program or until
+ * the series with their labels are removed by their owner (e.g. a DSP engine being deleted) so
+ * the pointers returned can be cached by the instrumented code. Creating or getting a metric
+ * takes a lock and should not be done in the sample path. Updating a metric is lock free:
+ * counters and histograms are split in stripes each on its own cache lines and each thread
+ * accumulates in the stripe it was given on first use. Stripes are summed at export time.
+ */
+class SDRBASE_API Metrics
+{
+public:
+    typedef QList<QPair<QString, QString>> Labels;
+
+    static const int m_cacheLineSize = 64;
+
+    /** Values of a stripe that share a cache line with no other stripe */
+    struct alignas(m_cacheLineSize) CacheLine
+    {
+        std::atomic<quint64> m_values[m_cacheLineSize / sizeof(quint64)];
+    };
+
+    /** std::allocator does not honor over aligned types before C++17 */
+    template<typename T>
+    struct AlignedAllocator
+    {
+        typedef T value_type;
+
+        AlignedAllocator() {}
+        template<typename U> AlignedAllocator(const AlignedAllocator<U>&) {}
+        T *allocate(std::size_t n) { return static_cast<T*>(alignedAlloc(n * sizeof(T), alignof(T))); }
+        void deallocate(T *p, std::size_t) { alignedFree(p); }
+        template<typename U> bool operator==(const AlignedAllocator<U>&) const { return true; }
+        template<typename U> bool operator!=(const AlignedAllocator<U>&) const { return false; }
+    };
+
+    typedef std::vector<CacheLine, AlignedAllocator<CacheLine>> CacheLines;
+
+    class SDRBASE_API Counter
+    {
+    public:
+        void inc(quint64 n = 1) { m_stripes[stripeIndex()].m_values[0].fetch_add(n, std::memory_order_relaxed); }
+        quint64 value() const;
+
+    private:
+        friend class Metrics;
+        Counter();
+        CacheLines m_stripes; //!< one cache line per stripe
+    };
+
+    /** Last value set. Gauges are typically updated at a low rate (e.g. once per work call). */
+    class SDRBASE_API Gauge
+    {
+    public:
+        void set(double value);
+        void add(double value);
+        double value() const;
+
+    private:
+        friend class Metrics;
+        Gauge();
+        std::atomic<quint64> m_value; //!< bits of the double value
+    };
+
+    /** Distribution of observed values in cumulative buckets with their sum and count */
+    class SDRBASE_API Histogram
+    {
+    public:
+        void observe(double value);
+        void getValues(std::vector<quint64>& bucketCounts, double& sum, quint64& count) const; //!< counts are not cumulative
+        const std::vector<double>& getBounds() const { return m_bounds; }
+
+    private:
+        friend class Metrics;
+        Histogram(const std::vector<double>& bounds);
+        std::vector<double> m_bounds;      //!< upper bounds in increasing order (+Inf is implicit)
+        unsigned int m_linesPerStripe;     //!< cache lines holding the buckets, +Inf and sum of a stripe
+        CacheLines m_stripes;
+
+        std::atomic<quint64>& at(int stripe, unsigned int index); //!< bucket (or sum) of a stripe
+        const std::atomic<quint64>& at(int stripe, unsigned int index) const;
+    };
+
+    static Metrics& instance();
+
+    Counter *counter(const QString& name, const QString& help, const Labels& labels = Labels());
+    Gauge *gauge(const QString& name, const QString& help, const Labels& labels = Labels());
+    Histogram *histogram(const QString& name, const QString& help, const std::vector<double>& bounds, const Labels& labels = Labels());
+    void removeSeries(const Labels& labels); //!< deletes the series with exactly these labels in all metrics
+
+    /** Exponential bucket bounds: start, start*factor, ... (count values) */
+    static std::vector<double> exponentialBuckets(double start, double factor, int count);
+
+    /** All metrics in Prometheus text exposition format version 0.0.4 */
+    QByteArray exportPrometheus() const;
+
+private:
+    enum Type { TypeCounter, TypeGauge, TypeHistogram };
+
+    struct Family
+    {
+        Type m_type;
+        QString m_help;
+        QMap<QString, void*> m_series; //!< by formatted labels
+    };
+
+    mutable QMutex m_mutex;
+    QMap<QString, Family> m_families; //!< by name
+
+    static const int m_nbStripes = 16;
+
+    Metrics();
+    ~Metrics();
+    static void deleteSeries(Type type, void *series);
+    static void *alignedAlloc(std::size_t size, std::size_t alignment);
+    static void alignedFree(void *p);
+    void *getSeries(Type type, const QString& name, const QString& help, const Labels& labels, const std::vector<double>* bounds);
+    static int stripeIndex();
+    static QString formatLabels(const Labels& labels);
+    static QString formatValue(double value);
+};
+
+#endif // SDRBASE_UTIL_METRICS_H_
@@ -0,0 +1,470 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#endif
+
+#include <algorithm>
+
+#include <QStringList>
+#include <QDebug>
+
+#include "util/simpleserializer.h"
+#include "threadpriority.h"
+
+#if defined(__linux__)
+namespace {
+
+// affinity inherited by the process (taskset, cgroup cpuset...) captured when the library is loaded
+// before any thread changes its own
+cpu_set_t getInitialCPUSet()
+{
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+
+    if (sched_getaffinity(0, sizeof(cpu_set_t), &cpuSet) != 0)
+    {
+        int nbCPUs = (int) sysconf(_SC_NPROCESSORS_CONF);
+
+        for (int cpu = 0; (cpu < nbCPUs) && (cpu < CPU_SETSIZE); cpu++) {
+            CPU_SET(cpu, &cpuSet);
+        }
+    }
+
+    return cpuSet;
+}
+
+const cpu_set_t initialCPUSet = getInitialCPUSet();
+
+}
+#endif
+
+ThreadPriority::Settings::Settings()
+{
+    resetToDefaults();
+}
+
+void ThreadPriority::Settings::resetToDefaults()
+{
+    m_policy = PolicyDefault;
+    m_priority = 0;
+    m_cpuAffinity = "";
+    m_isolate = false;
+}
+
+QByteArray ThreadPriority::Settings::serialize() const
+{
+    SimpleSerializer s(1);
+    s.writeS32(1, (int) m_policy);
+    s.writeS32(2, m_priority);
+    s.writeString(3, m_cpuAffinity);
+    s.writeBool(4, m_isolate);
+    return s.final();
+}
+
+bool ThreadPriority::Settings::deserialize(const QByteArray& data)
+{
+    SimpleDeserializer d(data);
+
+    if (!d.isValid())
+    {
+        resetToDefaults();
+        return false;
+    }
+
+    if (d.getVersion() == 1)
+    {
+        int tmp;
+
+        d.readS32(1, &tmp, 0);
+        m_policy = tmp < 0 ? PolicyDefault : tmp > (int) PolicyRR ? PolicyRR : (Policy) tmp;
+        d.readS32(2, &m_priority, 0);
+        d.readString(3, &m_cpuAffinity, "");
+        d.readBool(4, &m_isolate, false);
+
+        return true;
+    }
+    else
+    {
+        resetToDefaults();
+        return false;
+    }
+}
+
+bool ThreadPriority::Settings::parse(const QString& spec)
+{
+    QStringList parts = spec.split(":");
+    Policy policy;
+
+    if ((parts.size() == 0) || !getPolicyFromName(parts[0], policy)) {
+        return false;
+    }
+
+    int priority = policy == PolicyNice ? 0 : 1;
+    QString cpuAffinity;
+    bool isolate = false;
+
+    if (parts.size() > 1)
+    {
+        bool ok;
+        priority = parts[1].toInt(&ok);
+
+        if (!ok) {
+            return false;
+        }
+    }
+
+    if (parts.size() > 2)
+    {
+        QList<int> cpus;
+
+        if (!parseCPUList(parts[2], cpus)) {
+            return false;
+        }
+
+        cpuAffinity = parts[2];
+    }
+
+    if (parts.size() > 3)
+    {
+        if (parts[3] != "isolate") {
+            return false;
+        }
+
+        isolate = true;
+    }
+
+    m_policy = policy;
+    m_priority = priority;
+    m_cpuAffinity = cpuAffinity;
+    m_isolate = isolate;
+
+    return true;
+}
+
+ThreadPriority::Status::Status() :
+    m_applied(false),
+    m_policy(PolicyDefault),
+    m_priority(0)
+{}
+
+bool ThreadPriority::parseCPUList(const QString& cpuList, QList<int>& cpus)
+{
+    cpus.clear();
+
+    if (cpuList.trimmed().isEmpty()) {
+        return true;
+    }
+
+    QStringList items = cpuList.split(",");
+
+    for (const auto& item : items)
+    {
+        QStringList bounds = item.trimmed().split("-");
+        bool ok1, ok2 = true;
+        int first = bounds[0].toInt(&ok1);
+        int last = bounds.size() > 1 ? bounds[1].toInt(&ok2) : first;
+
+        if (!ok1 || !ok2 || (bounds.size() > 2) || (first < 0) || (last < first) || (last > 1023)) {
+            return false;
+        }
+
+        for (int cpu = first; cpu <= last; cpu++)
+        {
+            if (!cpus.contains(cpu)) {
+                cpus.append(cpu);
+            }
+        }
+    }
+
+    std::sort(cpus.begin(), cpus.end());
+    return true;
+}
+
+QString ThreadPriority::formatCPUList(const QList<int>& cpus)
+{
+    QStringList items;
+    int i = 0;
+
+    while (i < cpus.size())
+    {
+        int j = i;
+
+        while ((j + 1 < cpus.size()) && (cpus[j+1] == cpus[j] + 1)) {
+            j++;
+        }
+
+        items.append(j > i ? QString("%1-%2").arg(cpus[i]).arg(cpus[j]) : QString::number(cpus[i]));
+        i = j + 1;
+    }
+
+    return items.join(",");
+}
+
+QString ThreadPriority::getPolicyName(Policy policy)
+{
+    switch (policy)
+    {
+    case PolicyNice:
+        return "nice";
+    case PolicyFIFO:
+        return "fifo";
+    case PolicyRR:
+        return "rr";
+    case PolicyDefault:
+    default:
+        return "default";
+    }
+}
+
+bool ThreadPriority::getPolicyFromName(const QString& name, Policy& policy)
+{
+    QString lname = name.trimmed().toLower();
+
+    if (lname == "default") {
+        policy = PolicyDefault;
+    } else if (lname == "nice") {
+        policy = PolicyNice;
+    } else if (lname == "fifo") {
+        policy = PolicyFIFO;
+    } else if (lname == "rr") {
+        policy = PolicyRR;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+#if defined(__linux__)
+
+ThreadPriority::Status ThreadPriority::getCurrentThreadStatus()
+{
+    Status status;
+    int policy;
+    struct sched_param param;
+
+    if (pthread_getschedparam(pthread_self(), &policy, &param) == 0)
+    {
+        if (policy == SCHED_FIFO)
+        {
+            status.m_policy = PolicyFIFO;
+            status.m_priority = param.sched_priority;
+        }
+        else if (policy == SCHED_RR)
+        {
+            status.m_policy = PolicyRR;
+            status.m_priority = param.sched_priority;
+        }
+        else
+        {
+            status.m_policy = PolicyNice;
+            errno = 0;
+            status.m_priority = getpriority(PRIO_PROCESS, (id_t) syscall(SYS_gettid));
+        }
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) == 0)
+    {
+        QList<int> cpus;
+
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (CPU_ISSET(cpu, &cpuSet)) {
+                cpus.append(cpu);
+            }
+        }
+
+        status.m_cpuAffinity = formatCPUList(cpus);
+    }
+
+    return status;
+}
+
+ThreadPriority::Status ThreadPriority::applyToCurrentThread(const Settings& settings, const QList<int>& isolatedCPUs)
+{
+    QStringList messages;
+    pid_t tid = (pid_t) syscall(SYS_gettid);
+
+    if ((settings.m_policy == PolicyFIFO) || (settings.m_policy == PolicyRR))
+    {
+        int policy = settings.m_policy == PolicyFIFO ? SCHED_FIFO : SCHED_RR;
+        struct sched_param param;
+        int minPriority = sched_get_priority_min(policy);
+        int maxPriority = sched_get_priority_max(policy);
+        param.sched_priority = settings.m_priority < minPriority ? minPriority : settings.m_priority > maxPriority ? maxPriority : settings.m_priority;
+        int res = pthread_setschedparam(pthread_self(), policy, &param);
+
+        if (res != 0)
+        {
+            // fall back to the highest permitted nice value in proportion of the requested priority
+            int nice = -1 - ((param.sched_priority - 1) * 19) / 98;
+            messages.append(QString("%1 not permitted (%2) falling back to nice %3")
+                .arg(getPolicyName(settings.m_policy)).arg(strerror(res)).arg(nice));
+
+            if (setpriority(PRIO_PROCESS, (id_t) tid, nice) != 0) {
+                messages.append(QString("nice %1 not permitted (%2)").arg(nice).arg(strerror(errno)));
+            }
+        }
+    }
+    else // nice or default: back to normal scheduling if the thread was real time
+    {
+        struct sched_param param;
+        param.sched_priority = 0;
+        int res = pthread_setschedparam(pthread_self(), SCHED_OTHER, &param);
+
+        if (res != 0) {
+            messages.append(QString("normal scheduling not restored (%1)").arg(strerror(res)));
+        }
+
+        // default takes the nice value of the process main thread
+        int nice = settings.m_policy == PolicyDefault ? getpriority(PRIO_PROCESS, (id_t) getpid()) :
+            settings.m_priority < -20 ? -20 : settings.m_priority > 19 ? 19 : settings.m_priority;
+
+        if (setpriority(PRIO_PROCESS, (id_t) tid, nice) != 0) {
+            messages.append(QString("nice %1 not permitted (%2)").arg(nice).arg(strerror(errno)));
+        }
+    }
+
+    QList<int> cpus;
+
+    if (!parseCPUList(settings.m_cpuAffinity, cpus)) {
+        messages.append(QString("invalid CPU list %1").arg(settings.m_cpuAffinity));
+    }
+
+    if (cpus.size() == 0) // not pinned: inherited CPUs but the isolated ones. Reverts a previous pinning
+    {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+        {
+            if (CPU_ISSET(cpu, &initialCPUSet) && !isolatedCPUs.contains(cpu)) {
+                cpus.append(cpu);
+            }
+        }
+
+        if (cpus.size() == 0) // all inherited CPUs are isolated
+        {
+            for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            {
+                if (CPU_ISSET(cpu, &initialCPUSet)) {
+                    cpus.append(cpu);
+                }
+            }
+        }
+    }
+
+    if (cpus.size() > 0)
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+
+        for (auto cpu : cpus) {
+            CPU_SET(cpu, &cpuSet);
+        }
+
+        int res = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+
+        if (res != 0) {
+            messages.append(QString("CPU affinity %1 not applied (%2)").arg(formatCPUList(cpus)).arg(strerror(res)));
+        }
+    }
+
+    Status status = getCurrentThreadStatus();
+    status.m_applied = true;
+    status.m_message = messages.join("; ");
+
+    if (status.m_message.size() > 0) {
+        qWarning("ThreadPriority::applyToCurrentThread: tid %d: %s", tid, qPrintable(status.m_message));
+    }
+
+    qDebug("ThreadPriority::applyToCurrentThread: tid %d: policy: %s priority: %d CPUs: %s",
+        tid, qPrintable(getPolicyName(status.m_policy)), status.m_priority, qPrintable(status.m_cpuAffinity));
+
+    return status;
+}
+
+bool ThreadPriority::isolateCPUs(const QList<int>& cpus)
+{
+    if (cpus.size() == 0) {
+        return true;
+    }
+
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+
+    if (pthread_getaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet) != 0) {
+        return false;
+    }
+
+    for (auto cpu : cpus) {
+        CPU_CLR(cpu, &cpuSet);
+    }
+
+    if (CPU_COUNT(&cpuSet) == 0)
+    {
+        qWarning("ThreadPriority::isolateCPUs: cannot isolate all CPUs");
+        return false;
+    }
+
+    int res = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+
+    if (res != 0)
+    {
+        qWarning("ThreadPriority::isolateCPUs: %s", strerror(res));
+        return false;
+    }
+
+    qDebug("ThreadPriority::isolateCPUs: %s", qPrintable(formatCPUList(cpus)));
+    return true;
+}
+
+#else
+
+ThreadPriority::Status ThreadPriority::getCurrentThreadStatus()
+{
+    Status status;
+    status.m_message = "not supported on this platform";
+    return status;
+}
+
+ThreadPriority::Status ThreadPriority::applyToCurrentThread(const Settings& settings, const QList<int>& isolatedCPUs)
+{
+    (void) isolatedCPUs;
+    Status status = getCurrentThreadStatus();
+
+    if ((settings.m_policy != PolicyDefault) || (settings.m_cpuAffinity.size() > 0)) {
+        qWarning("ThreadPriority::applyToCurrentThread: not supported on this platform");
+    }
+
+    return status;
+}
+
+bool ThreadPriority::isolateCPUs(const QList<int>& cpus)
+{
+    return cpus.size() == 0;
+}
+
+#endif
@@ -0,0 +1,85 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_UTIL_THREADPRIORITY_H_
+#define SDRBASE_UTIL_THREADPRIORITY_H_
+
+#include <QString>
+#include <QByteArray>
+#include <QList>
+
+#include "export.h"
+
+/**
+ * Scheduling policy, priority and CPU affinity of the calling thread.
+ * Real time policies (SCHED_FIFO, SCHED_RR) need the proper privileges (CAP_SYS_NICE or
+ * rtprio limit). When they cannot be obtained the thread falls back to a negative nice value
+ * if permitted. The policy actually in effect is always read back from the system.
+ * Only implemented for Linux. Other platforms report the request as not supported.
+ */
+class SDRBASE_API ThreadPriority
+{
+public:
+    enum Policy
+    {
+        PolicyDefault, //!< normal scheduling as created. Reverts a previous policy
+        PolicyNice,    //!< normal scheduling with nice value
+        PolicyFIFO,    //!< SCHED_FIFO real time
+        PolicyRR       //!< SCHED_RR real time
+    };
+
+    enum Role
+    {
+        RoleEngine, //!< DSP device engine thread
+        RoleWorker  //!< device worker thread
+    };
+
+    struct SDRBASE_API Settings
+    {
+        Policy m_policy;
+        int m_priority;        //!< real time priority (1..99) for FIFO and RR or nice value (-20..19) for nice
+        QString m_cpuAffinity; //!< list of CPUs like "2,3" or "4-7". Empty for no pinning
+        bool m_isolate;        //!< keep the other application threads off these CPUs
+
+        Settings();
+        void resetToDefaults();
+        QByteArray serialize() const;
+        bool deserialize(const QByteArray& data);
+        bool parse(const QString& spec); //!< from policy[:priority[:cpus[:isolate]]] e.g. fifo:50:2-3:isolate
+    };
+
+    struct SDRBASE_API Status
+    {
+        bool m_applied;        //!< settings have been applied to the thread
+        Policy m_policy;       //!< policy in effect
+        int m_priority;        //!< real time priority or nice value in effect
+        QString m_cpuAffinity; //!< CPUs the thread may run on
+        QString m_message;     //!< fallback or error explanation
+
+        Status();
+    };
+
+    static Status applyToCurrentThread(const Settings& settings, const QList<int>& isolatedCPUs);
+    static Status getCurrentThreadStatus();
+    static bool isolateCPUs(const QList<int>& cpus); //!< remove CPUs from calling thread affinity. Threads it creates afterwards inherit it.
+    static bool parseCPUList(const QString& cpuList, QList<int>& cpus);
+    static QString formatCPUList(const QList<int>& cpus);
+    static QString getPolicyName(Policy policy);
+    static bool getPolicyFromName(const QString& name, Policy& policy);
+};
+
+#endif // SDRBASE_UTIL_THREADPRIORITY_H_
@@ -17,6 +17,8 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include "SWGDeviceSetList.h"
+
 #include "plugin/pluginmanager.h"
 #include "channel/channelwebapiadapter.h"
 #include "channel/channelutils.h"
@@ -418,6 +420,152 @@ void WebAPIAdapterBase::webapiUpdateCommand(
     }
 }
 
+void WebAPIAdapterBase::webapiFormatThreadPriority(
+        SWGSDRangel::SWGThreadPrioritySettings *apiThreadPriority,
+        const ThreadPriority::Settings& settings,
+        const ThreadPriority::Status& engineStatus,
+        const ThreadPriority::Status& workerStatus
+)
+{
+    apiThreadPriority->init();
+    apiThreadPriority->setPolicy(new QString(ThreadPriority::getPolicyName(settings.m_policy)));
+    apiThreadPriority->setPriority(settings.m_priority);
+    apiThreadPriority->setCpuAffinity(new QString(settings.m_cpuAffinity));
+    apiThreadPriority->setIsolate(settings.m_isolate ? 1 : 0);
+
+    const ThreadPriority::Status *statuses[2] = {&engineStatus, &workerStatus};
+    SWGSDRangel::SWGThreadPriorityStatus *apiStatuses[2] = {
+        apiThreadPriority->getEngineThread(),
+        apiThreadPriority->getWorkerThread()
+    };
+
+    for (int i = 0; i < 2; i++)
+    {
+        apiStatuses[i]->setApplied(statuses[i]->m_applied ? 1 : 0);
+        apiStatuses[i]->setPolicy(new QString(ThreadPriority::getPolicyName(statuses[i]->m_policy)));
+        apiStatuses[i]->setPriority(statuses[i]->m_priority);
+        apiStatuses[i]->setCpuAffinity(new QString(statuses[i]->m_cpuAffinity));
+        apiStatuses[i]->setMessage(new QString(statuses[i]->m_message));
+    }
+}
+
+bool WebAPIAdapterBase::webapiUpdateThreadPriority(
+        bool force,
+        SWGSDRangel::SWGThreadPrioritySettings *apiThreadPriority,
+        const QStringList& threadPriorityKeys,
+        ThreadPriority::Settings& settings,
+        QString& errorMessage
+)
+{
+    ThreadPriority::Settings newSettings = settings;
+
+    if (force) {
+        newSettings.resetToDefaults();
+    }
+
+    if (threadPriorityKeys.contains("policy") && !ThreadPriority::getPolicyFromName(*apiThreadPriority->getPolicy(), newSettings.m_policy))
+    {
+        errorMessage = QString("Invalid policy %1. Valid policies are default, nice, fifo and rr").arg(*apiThreadPriority->getPolicy());
+        return false;
+    }
+    if (threadPriorityKeys.contains("priority")) {
+        newSettings.m_priority = apiThreadPriority->getPriority();
+    }
+    if (threadPriorityKeys.contains("cpuAffinity"))
+    {
+        QList<int> cpus;
+
+        if (!ThreadPriority::parseCPUList(*apiThreadPriority->getCpuAffinity(), cpus))
+        {
+            errorMessage = QString("Invalid CPU list %1").arg(*apiThreadPriority->getCpuAffinity());
+            return false;
+        }
+
+        newSettings.m_cpuAffinity = ThreadPriority::formatCPUList(cpus);
+    }
+    if (threadPriorityKeys.contains("isolate")) {
+        newSettings.m_isolate = apiThreadPriority->getIsolate() != 0;
+    }
+
+    settings = newSettings;
+    return true;
+}
+
+bool WebAPIAdapterBase::webapiChannelsSelection(
+        WebAPIAdapterInterface *adapter,
+        const QString& selectionStr,
+        QList<QPair<int, int>>& channels,
+        QString& errorMessage
+)
+{
+    // selection is a comma separated list of deviceSetIndex:channelIndex or deviceSetIndex for all its channels
+    QList<QPair<int, int>> selection;
+    QStringList items = selectionStr.split(',');
+    bool expand = selectionStr.isEmpty();
+    channels.clear();
+
+    if (!selectionStr.isEmpty())
+    {
+        for (const auto& item : items)
+        {
+            QStringList indexes = item.trimmed().split(':');
+            bool ok1, ok2 = true;
+            int deviceSetIndex = indexes[0].toInt(&ok1);
+            int channelIndex = indexes.size() > 1 ? indexes[1].toInt(&ok2) : -1;
+
+            if (!ok1 || !ok2 || (indexes.size() > 2) || (deviceSetIndex < 0) || ((indexes.size() > 1) && (channelIndex < 0)))
+            {
+                errorMessage = QString("Invalid channel selection item: %1").arg(item);
+                return false;
+            }
+
+            expand = expand || (channelIndex < 0);
+            selection.append(QPair<int, int>(deviceSetIndex, channelIndex));
+        }
+    }
+
+    if (!expand)
+    {
+        channels = selection;
+        return true;
+    }
+
+    // channel counts of all device sets are obtained in a single call
+    SWGSDRangel::SWGDeviceSetList deviceSetList;
+    SWGSDRangel::SWGErrorResponse deviceSetsError;
+    deviceSetsError.init();
+    *deviceSetsError.getMessage() = "Cannot get device sets";
+    int status = adapter->instanceDeviceSetsGet(deviceSetList, deviceSetsError);
+
+    if (status/100 != 2)
+    {
+        errorMessage = *deviceSetsError.getMessage();
+        return false;
+    }
+
+    QList<SWGSDRangel::SWGDeviceSet*> *deviceSets = deviceSetList.getDeviceSets();
+
+    if (selectionStr.isEmpty())
+    {
+        for (int deviceSetIndex = 0; deviceSetIndex < deviceSets->size(); deviceSetIndex++) {
+            selection.append(QPair<int, int>(deviceSetIndex, -1));
+        }
+    }
+
+    for (const auto& item : selection)
+    {
+        if (item.second >= 0) {
+            channels.append(item);
+        } else if (item.first < deviceSets->size()) {
+            for (int channelIndex = 0; channelIndex < deviceSets->at(item.first)->getChannelcount(); channelIndex++) {
+                channels.append(QPair<int, int>(item.first, channelIndex));
+            }
+        }
+    }
+
+    return true;
+}
+
 ChannelWebAPIAdapter *WebAPIAdapterBase::WebAPIChannelAdapters::getChannelWebAPIAdapter(const QString& channelURI, const PluginManager *pluginManager)
 {
     QString registeredChannelURI = ChannelUtils::getRegisteredChannelURI(channelURI);
@@ -20,15 +20,18 @@
 #define SDRBASE_WEBAPI_WEBAPIADAPTERBASE_H_
 
 #include <QMap>
+#include <QPair>
 
 #include "export.h"
 #include "SWGPreferences.h"
 #include "SWGPreset.h"
 #include "SWGCommand.h"
+#include "SWGThreadPrioritySettings.h"
 #include "settings/preferences.h"
 #include "settings/preset.h"
 #include "settings/mainsettings.h"
 #include "commands/command.h"
+#include "util/threadpriority.h"
 #include "webapiadapterinterface.h"
 
 class PluginManager;
@@ -77,6 +80,25 @@ public:
         const WebAPIAdapterInterface::CommandKeys& commandKeys,
         Command& command
     );
+    static void webapiFormatThreadPriority(
+        SWGSDRangel::SWGThreadPrioritySettings *apiThreadPriority,
+        const ThreadPriority::Settings& settings,
+        const ThreadPriority::Status& engineStatus,
+        const ThreadPriority::Status& workerStatus
+    );
+    static bool webapiUpdateThreadPriority(
+        bool force,
+        SWGSDRangel::SWGThreadPrioritySettings *apiThreadPriority,
+        const QStringList& threadPriorityKeys,
+        ThreadPriority::Settings& settings,
+        QString& errorMessage
+    );
+    static bool webapiChannelsSelection(
+        WebAPIAdapterInterface *adapter,
+        const QString& selectionStr,
+        QList<QPair<int, int>>& channels,
+        QString& errorMessage
+    );
 
 private:
     class WebAPIChannelAdapters
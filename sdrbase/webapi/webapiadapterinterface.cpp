@@ -23,6 +23,8 @@ QString WebAPIAdapterInterface::instanceSummaryURL = "/sdrangel";
 QString WebAPIAdapterInterface::instanceConfigURL = "/sdrangel/config";
 QString WebAPIAdapterInterface::instanceDevicesURL = "/sdrangel/devices";
 QString WebAPIAdapterInterface::instanceChannelsURL = "/sdrangel/channels";
+QString WebAPIAdapterInterface::instanceChannelsReportURL = "/sdrangel/channels/report";
+QString WebAPIAdapterInterface::instanceChannelsSettingsURL = "/sdrangel/channels/settings";
 QString WebAPIAdapterInterface::instanceLoggingURL = "/sdrangel/logging";
 QString WebAPIAdapterInterface::instanceAudioURL = "/sdrangel/audio";
 QString WebAPIAdapterInterface::instanceAudioInputParametersURL = "/sdrangel/audio/input/parameters";
@@ -47,6 +49,7 @@ std::regex WebAPIAdapterInterface::devicesetFocusURLRe("^/sdrangel/deviceset/([0
 std::regex WebAPIAdapterInterface::devicesetDeviceURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device$");
 std::regex WebAPIAdapterInterface::devicesetDeviceSettingsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/settings$");
 std::regex WebAPIAdapterInterface::devicesetDeviceRunURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/run$");
+std::regex WebAPIAdapterInterface::devicesetDeviceThreadPriorityURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/threadpriority$");
 std::regex WebAPIAdapterInterface::devicesetDeviceSubsystemRunURLRe("^/sdrangel/deviceset/([0-9]{1,2})/subdevice/([0-9]{1,2})/run$");
 std::regex WebAPIAdapterInterface::devicesetDeviceReportURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/report$");
 std::regex WebAPIAdapterInterface::devicesetDeviceActionsURLRe("^/sdrangel/deviceset/([0-9]{1,2})/device/actions$");
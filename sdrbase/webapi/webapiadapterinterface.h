@@ -57,6 +57,7 @@ namespace SWGSDRangel
     class SWGDeviceState;
     class SWGDeviceReport;
     class SWGDeviceActions;
+    class SWGThreadPrioritySettings;
     class SWGChannelsDetail;
     class SWGChannelSettings;
     class SWGChannelReport;
@@ -744,6 +745,42 @@ public:
     	return 501;
     }
 
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/threadpriority (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDeviceThreadPriorityGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGThreadPrioritySettings& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) response;
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
+    /**
+     * Handler of /sdrangel/deviceset/{devicesetIndex}/device/threadpriority (PUT, PATCH) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
+     * returns the Http status code (default 501: not implemented)
+     */
+    virtual int devicesetDeviceThreadPriorityPutPatch(
+            int deviceSetIndex,
+            bool force, //!< true to force settings = put else patch
+            const QStringList& threadPriorityKeys,
+            SWGSDRangel::SWGThreadPrioritySettings& response,
+            SWGSDRangel::SWGErrorResponse& error)
+    {
+        (void) deviceSetIndex;
+        (void) force;
+        (void) threadPriorityKeys;
+        (void) response;
+    	error.init();
+    	*error.getMessage() = QString("Function not implemented");
+    	return 501;
+    }
+
     /**
      * Handler of /sdrangel/deviceset/{devicesetIndex}/device/run (GET) swagger/sdrangel/code/html2/index.html#api-Default-instanceChannels
      * returns the Http status code (default 501: not implemented)
@@ -1021,6 +1058,8 @@ public:
     static QString instanceConfigURL;
     static QString instanceDevicesURL;
     static QString instanceChannelsURL;
+    static QString instanceChannelsReportURL;
+    static QString instanceChannelsSettingsURL;
     static QString instanceLoggingURL;
     static QString instanceAudioURL;
     static QString instanceAudioInputParametersURL;
@@ -1044,6 +1083,7 @@ public:
     static std::regex devicesetDeviceURLRe;
     static std::regex devicesetDeviceSettingsURLRe;
     static std::regex devicesetDeviceRunURLRe;
+    static std::regex devicesetDeviceThreadPriorityURLRe;
     static std::regex devicesetDeviceSubsystemRunURLRe;
     static std::regex devicesetDeviceReportURLRe;
     static std::regex devicesetDeviceActionsURLRe;
@@ -45,13 +45,19 @@
 #include "SWGDeviceState.h"
 #include "SWGDeviceReport.h"
 #include "SWGDeviceActions.h"
+#include "SWGThreadPrioritySettings.h"
 #include "SWGChannelsDetail.h"
 #include "SWGChannelSettings.h"
 #include "SWGChannelReport.h"
 #include "SWGChannelActions.h"
+#include "SWGInstanceChannelReports.h"
+#include "SWGInstanceChannelSettings.h"
 #include "SWGSuccessResponse.h"
 #include "SWGErrorResponse.h"
 
+#include "webapiadapterbase.h"
+#include "util/metrics.h"
+
 const QMap<QString, QString> WebAPIRequestMapper::m_channelURIToSettingsKey = {
     {"sdrangel.channel.amdemod", "AMDemodSettings"},
     {"de.maintech.sdrangelove.channel.am", "AMDemodSettings"}, // remap
@@ -69,6 +75,7 @@ const QMap<QString, QString> WebAPIRequestMapper::m_channelURIToSettingsKey = {
     {"sdrangel.channel.freedvdemod", "FreeDVDemodSettings"},
     {"sdrangel.channeltx.freedvmod", "FreeDVModSettings"},
     {"sdrangel.channel.freqtracker", "FreqTrackerSettings"},
+    {"sdrangel.channel.interferometer", "InterferometerSettings"},
     {"sdrangel.channel.nfmdemod", "NFMDemodSettings"},
     {"de.maintech.sdrangelove.channel.nfm", "NFMDemodSettings"}, // remap
     {"sdrangel.channeltx.modnfm", "NFMModSettings"},
@@ -124,7 +131,12 @@ const QMap<QString, QString> WebAPIRequestMapper::m_deviceIdToSettingsKey = {
     {"sdrangel.samplesink.soapysdroutput", "soapySDROutputSettings"},
     {"sdrangel.samplesource.testsource", "testSourceSettings"},
     {"sdrangel.samplesource.xtrx", "XtrxInputSettings"},
-    {"sdrangel.samplesink.xtrx", "XtrxOutputSettings"}
+    {"sdrangel.samplesink.xtrx", "XtrxOutputSettings"},
+    {"sdrangel.samplemimo.bladerf2mimo", "bladeRF2MIMOSettings"},
+    {"sdrangel.samplemimo.limesdrmimo", "limeSdrMIMOSettings"},
+    {"sdrangel.samplemimo.plutosdrmimo", "plutoSdrMIMOSettings"},
+    {"sdrangel.samplemimo.xtrxmimo", "xtrxMIMOSettings"},
+    {"sdrangel.samplemimo.testmi", "testMISettings"}
 };
 
 const QMap<QString, QString> WebAPIRequestMapper::m_channelTypeToSettingsKey = {
@@ -141,6 +153,7 @@ const QMap<QString, QString> WebAPIRequestMapper::m_channelTypeToSettingsKey = {
     {"FreeDVDemod", "FreeDVDemodSettings"},
     {"FreeDVMod", "FreeDVModSettings"},
     {"FreqTracker", "FreqTrackerSettings"},
+    {"Interferometer", "InterferometerSettings"},
     {"NFMDemod", "NFMDemodSettings"},
     {"NFMMod", "NFMModSettings"},
     {"LocalSink", "LocalSinkSettings"},
@@ -219,6 +232,9 @@ const QMap<QString, QString> WebAPIRequestMapper::m_sinkDeviceHwIdToActionsKey =
 
 const QMap<QString, QString> WebAPIRequestMapper::m_mimoDeviceHwIdToSettingsKey= {
     {"BladeRF2", "bladeRF2MIMOSettings"},
+    {"LimeSDR", "limeSdrMIMOSettings"},
+    {"PlutoSDR", "plutoSdrMIMOSettings"},
+    {"XTRX", "xtrxMIMOSettings"},
     {"TestMI", "testMISettings"},
     {"TestMOSync", "testMOSyncSettings"}
 };
@@ -248,6 +264,12 @@ WebAPIRequestMapper::~WebAPIRequestMapper()
 
 void WebAPIRequestMapper::service(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
+    if (!m_metricsPath.isEmpty() && (request.getPath() == m_metricsPath)) // metrics do not depend on the adapter
+    {
+        metricsService(request, response);
+        return;
+    }
+
     if (m_adapter == 0) // format service unavailable if adapter is null
     {
         SWGSDRangel::SWGErrorResponse errorResponse;
@@ -274,96 +296,147 @@ void WebAPIRequestMapper::service(qtwebapp::HttpRequest& request, qtwebapp::Http
             return;
         }
 
-        if (path == WebAPIAdapterInterface::instanceSummaryURL) {
+        WebAPIRouter::Match match;
+
+        switch (m_router.match(path.constData(), path.length(), match))
+        {
+        case WebAPIRouter::RouteInstanceSummary:
             instanceSummaryService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceConfigURL) {
+            break;
+        case WebAPIRouter::RouteInstanceConfig:
             instanceConfigService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDevicesURL) {
+            break;
+        case WebAPIRouter::RouteInstanceDevices:
             instanceDevicesService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceChannelsURL) {
+            break;
+        case WebAPIRouter::RouteInstanceChannels:
             instanceChannelsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLoggingURL) {
+            break;
+        case WebAPIRouter::RouteInstanceChannelsReport:
+            instanceChannelsReportService(request, response);
+            break;
+        case WebAPIRouter::RouteInstanceChannelsSettings:
+            instanceChannelsSettingsService(request, response);
+            break;
+        case WebAPIRouter::RouteInstanceLogging:
             instanceLoggingService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioURL) {
+            break;
+        case WebAPIRouter::RouteInstanceAudio:
             instanceAudioService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioInputParametersURL) {
+            break;
+        case WebAPIRouter::RouteInstanceAudioInputParameters:
             instanceAudioInputParametersService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioOutputParametersURL) {
+            break;
+        case WebAPIRouter::RouteInstanceAudioOutputParameters:
             instanceAudioOutputParametersService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioInputCleanupURL) {
+            break;
+        case WebAPIRouter::RouteInstanceAudioInputCleanup:
             instanceAudioInputCleanupService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAudioOutputCleanupURL) {
+            break;
+        case WebAPIRouter::RouteInstanceAudioOutputCleanup:
             instanceAudioOutputCleanupService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLocationURL) {
+            break;
+        case WebAPIRouter::RouteInstanceLocation:
             instanceLocationService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAMBESerialURL) {
+            break;
+        case WebAPIRouter::RouteInstanceAMBESerial:
             instanceAMBESerialService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceAMBEDevicesURL) {
+            break;
+        case WebAPIRouter::RouteInstanceAMBEDevices:
             instanceAMBEDevicesService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLimeRFESerialURL) {
+            break;
+        case WebAPIRouter::RouteInstanceLimeRFESerial:
             instanceLimeRFESerialService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLimeRFEConfigURL) {
+            break;
+        case WebAPIRouter::RouteInstanceLimeRFEConfig:
             instanceLimeRFEConfigService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLimeRFERunURL) {
+            break;
+        case WebAPIRouter::RouteInstanceLimeRFERun:
             instanceLimeRFERunService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceLimeRFEPowerURL) {
+            break;
+        case WebAPIRouter::RouteInstanceLimeRFEPower:
             instanceLimeRFEPowerService(request, response);
-        } else if (path == WebAPIAdapterInterface::instancePresetsURL) {
+            break;
+        case WebAPIRouter::RouteInstancePresets:
             instancePresetsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instancePresetURL) {
+            break;
+        case WebAPIRouter::RouteInstancePreset:
             instancePresetService(request, response);
-        } else if (path == WebAPIAdapterInterface::instancePresetFileURL) {
+            break;
+        case WebAPIRouter::RouteInstancePresetFile:
             instancePresetFileService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDeviceSetsURL) {
+            break;
+        case WebAPIRouter::RouteInstanceDeviceSets:
             instanceDeviceSetsService(request, response);
-        } else if (path == WebAPIAdapterInterface::instanceDeviceSetURL) {
+            break;
+        case WebAPIRouter::RouteInstanceDeviceSet:
             instanceDeviceSetService(request, response);
+            break;
+        case WebAPIRouter::RouteDeviceset:
+            devicesetService(match.getCapture(0), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetDevice:
+            devicesetDeviceService(match.getCapture(0), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetFocus:
+            devicesetFocusService(match.getCapture(0), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetDeviceSettings:
+            devicesetDeviceSettingsService(match.getCapture(0), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetDeviceRun:
+            devicesetDeviceRunService(match.getCapture(0), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetDeviceThreadPriority:
+            devicesetDeviceThreadPriorityService(match.getCapture(0), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetDeviceSubsystemRun:
+            devicesetDeviceSubsystemRunService(match.getCapture(0), match.getCapture(1), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetDeviceReport:
+            devicesetDeviceReportService(match.getCapture(0), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetDeviceActions:
+            devicesetDeviceActionsService(match.getCapture(0), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetChannelsReport:
+            devicesetChannelsReportService(match.getCapture(0), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetChannel:
+            devicesetChannelService(match.getCapture(0), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetChannelIndex:
+            devicesetChannelIndexService(match.getCapture(0), match.getCapture(1), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetChannelSettings:
+            devicesetChannelSettingsService(match.getCapture(0), match.getCapture(1), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetChannelReport:
+            devicesetChannelReportService(match.getCapture(0), match.getCapture(1), request, response);
+            break;
+        case WebAPIRouter::RouteDevicesetChannelActions:
+            devicesetChannelActionsService(match.getCapture(0), match.getCapture(1), request, response);
+            break;
+        default: // serve static documentation pages
+            m_staticFileController->service(request, response);
+            break;
         }
-        else
-        {
-            std::smatch desc_match;
-            std::string pathStr(path.constData(), path.length());
-
-            if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetURLRe)) {
-                devicesetService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceURLRe)) {
-                devicesetDeviceService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetFocusURLRe)) {
-                devicesetFocusService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceSettingsURLRe)) {
-                devicesetDeviceSettingsService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceRunURLRe)) {
-                devicesetDeviceRunService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceSubsystemRunURLRe)) {
-                devicesetDeviceSubsystemRunService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceReportURLRe)) {
-                devicesetDeviceReportService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetDeviceActionsURLRe)) {
-                devicesetDeviceActionsService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelsReportURLRe)) {
-                devicesetChannelsReportService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelURLRe)) {
-                devicesetChannelService(std::string(desc_match[1]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelIndexURLRe)) {
-                devicesetChannelIndexService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelSettingsURLRe)) {
-                devicesetChannelSettingsService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelReportURLRe)) {
-                devicesetChannelReportService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            } else if (std::regex_match(pathStr, desc_match, WebAPIAdapterInterface::devicesetChannelActionsURLRe)) {
-                devicesetChannelActionsService(std::string(desc_match[1]), std::string(desc_match[2]), request, response);
-            }
-            else // serve static documentation pages
-            {
-                m_staticFileController->service(request, response);
-            }
-
-//            QDirIterator it(":", QDirIterator::Subdirectories);
-//            while (it.hasNext()) {
-//                qDebug() << "WebAPIRequestMapper::service: " << it.next();
-//            }
+    }
+}
 
-        }
+void WebAPIRequestMapper::metricsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    if (request.getMethod() == "GET")
+    {
+        response.setHeader("Content-Type", "text/plain; version=0.0.4; charset=utf-8");
+        response.setStatus(200, "OK");
+        response.write(Metrics::instance().exportPrometheus(), true);
+    }
+    else
+    {
+        response.setHeader("Content-Type", "text/plain");
+        response.setStatus(405,"Invalid HTTP method");
+        response.write("Invalid HTTP method");
     }
 }
 
@@ -567,6 +640,195 @@ void WebAPIRequestMapper::instanceChannelsService(qtwebapp::HttpRequest& request
     }
 }
 
+void WebAPIRequestMapper::instanceChannelsReportService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() == "GET")
+    {
+        QList<QPair<int, int>> channels;
+
+        errorResponse.init();
+
+        if (WebAPIAdapterBase::webapiChannelsSelection(m_adapter, request.getParameter("channels"), channels, *errorResponse.getMessage()))
+        {
+            SWGSDRangel::SWGInstanceChannelReports normalResponse;
+            normalResponse.init();
+            QList<SWGSDRangel::SWGChannelReportItem*> *items = normalResponse.getChannels();
+
+            for (const auto& channel : channels)
+            {
+                SWGSDRangel::SWGChannelReportItem *item = new SWGSDRangel::SWGChannelReportItem();
+                SWGSDRangel::SWGErrorResponse itemError;
+                item->setReport(new SWGSDRangel::SWGChannelReport());
+                itemError.init();
+                resetChannelReport(*item->getReport());
+                int status = m_adapter->devicesetChannelReportGet(channel.first, channel.second, *item->getReport(), itemError);
+                item->setDeviceSetIndex(channel.first);
+                item->setChannelIndex(channel.second);
+                item->setStatus(status);
+
+                if (status/100 != 2) {
+                    item->setMessage(new QString(*itemError.getMessage()));
+                }
+
+                items->append(item);
+            }
+
+            normalResponse.setChannelcount(items->size());
+            response.setStatus(200);
+            response.write(normalResponse.asJson().toUtf8());
+        }
+        else
+        {
+            response.setStatus(400,"Invalid channels selection");
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    else
+    {
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
+void WebAPIRequestMapper::instanceChannelsSettingsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    if (request.getMethod() == "GET")
+    {
+        QList<QPair<int, int>> channels;
+
+        errorResponse.init();
+
+        if (WebAPIAdapterBase::webapiChannelsSelection(m_adapter, request.getParameter("channels"), channels, *errorResponse.getMessage()))
+        {
+            SWGSDRangel::SWGInstanceChannelSettings normalResponse;
+            normalResponse.init();
+            QList<SWGSDRangel::SWGChannelSettingsItem*> *items = normalResponse.getChannels();
+
+            for (const auto& channel : channels)
+            {
+                SWGSDRangel::SWGChannelSettingsItem *item = new SWGSDRangel::SWGChannelSettingsItem();
+                SWGSDRangel::SWGErrorResponse itemError;
+                item->setSettings(new SWGSDRangel::SWGChannelSettings());
+                itemError.init();
+                resetChannelSettings(*item->getSettings());
+                int status = m_adapter->devicesetChannelSettingsGet(channel.first, channel.second, *item->getSettings(), itemError);
+                item->setDeviceSetIndex(channel.first);
+                item->setChannelIndex(channel.second);
+                item->setStatus(status);
+
+                if (status/100 != 2) {
+                    item->setMessage(new QString(*itemError.getMessage()));
+                }
+
+                items->append(item);
+            }
+
+            normalResponse.setChannelcount(items->size());
+            response.setStatus(200);
+            response.write(normalResponse.asJson().toUtf8());
+        }
+        else
+        {
+            response.setStatus(400,"Invalid channels selection");
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    else if ((request.getMethod() == "PUT") || (request.getMethod() == "PATCH"))
+    {
+        QString jsonStr = request.getBody();
+        QJsonObject jsonObject;
+
+        if (parseJsonBody(jsonStr, jsonObject, response))
+        {
+            if (!jsonObject.contains("channels") || !jsonObject["channels"].isArray())
+            {
+                response.setStatus(400,"Invalid JSON request");
+                errorResponse.init();
+                *errorResponse.getMessage() = "Invalid JSON request: no channels list";
+                response.write(errorResponse.asJson().toUtf8());
+                return;
+            }
+
+            SWGSDRangel::SWGInstanceChannelSettings normalResponse;
+            normalResponse.init();
+            QList<SWGSDRangel::SWGChannelSettingsItem*> *items = normalResponse.getChannels();
+            QJsonArray channelsArray = jsonObject["channels"].toArray();
+
+            for (const auto& channelValue : channelsArray)
+            {
+                QJsonObject channelObject = channelValue.toObject();
+                SWGSDRangel::SWGChannelSettingsItem *item = new SWGSDRangel::SWGChannelSettingsItem();
+                SWGSDRangel::SWGErrorResponse itemError;
+                item->setSettings(new SWGSDRangel::SWGChannelSettings());
+                itemError.init();
+                QStringList channelSettingsKeys;
+                resetChannelSettings(*item->getSettings());
+                item->setDeviceSetIndex(channelObject["deviceSetIndex"].toInt(-1));
+                item->setChannelIndex(channelObject["channelIndex"].toInt(-1));
+                QJsonObject settingsObject = channelObject["settings"].toObject();
+                int status;
+
+                if (!channelObject.contains("deviceSetIndex") || !channelObject.contains("channelIndex"))
+                {
+                    status = 400;
+                    *itemError.getMessage() = "Missing device set or channel index";
+                }
+                else if (validateChannelSettings(*item->getSettings(), settingsObject, channelSettingsKeys))
+                {
+                    status = m_adapter->devicesetChannelSettingsPutPatch(
+                        item->getDeviceSetIndex(),
+                        item->getChannelIndex(),
+                        (request.getMethod() == "PUT"), // force settings on PUT
+                        channelSettingsKeys,
+                        *item->getSettings(),
+                        itemError);
+                }
+                else
+                {
+                    status = 400;
+                    *itemError.getMessage() = "Invalid JSON request";
+                }
+
+                item->setStatus(status);
+
+                if (status/100 != 2) {
+                    item->setMessage(new QString(*itemError.getMessage()));
+                }
+
+                items->append(item);
+            }
+
+            normalResponse.setChannelcount(items->size());
+            response.setStatus(200);
+            response.write(normalResponse.asJson().toUtf8());
+        }
+        else
+        {
+            response.setStatus(400,"Invalid JSON format");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid JSON format";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    else
+    {
+        response.setStatus(405,"Invalid HTTP method");
+        errorResponse.init();
+        *errorResponse.getMessage() = "Invalid HTTP method";
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
 void WebAPIRequestMapper::instanceLoggingService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
     SWGSDRangel::SWGLoggingInfo query;
@@ -1785,6 +2047,86 @@ void WebAPIRequestMapper::devicesetDeviceSettingsService(const std::string& inde
     }
 }
 
+void WebAPIRequestMapper::devicesetDeviceThreadPriorityService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
+{
+    SWGSDRangel::SWGErrorResponse errorResponse;
+    response.setHeader("Content-Type", "application/json");
+    response.setHeader("Access-Control-Allow-Origin", "*");
+
+    try
+    {
+        int deviceSetIndex = boost::lexical_cast<int>(indexStr);
+
+        if ((request.getMethod() == "PUT") || (request.getMethod() == "PATCH"))
+        {
+            QString jsonStr = request.getBody();
+            QJsonObject jsonObject;
+
+            if (parseJsonBody(jsonStr, jsonObject, response))
+            {
+                SWGSDRangel::SWGThreadPrioritySettings normalResponse;
+                normalResponse.fromJson(jsonStr);
+                QStringList threadPriorityKeys;
+                QStringList validKeys = QStringList() << "policy" << "priority" << "cpuAffinity" << "isolate";
+
+                for (const auto& key : validKeys)
+                {
+                    if (jsonObject.contains(key)) {
+                        threadPriorityKeys.append(key);
+                    }
+                }
+
+                int status = m_adapter->devicesetDeviceThreadPriorityPutPatch(
+                        deviceSetIndex,
+                        (request.getMethod() == "PUT"), // force settings on PUT
+                        threadPriorityKeys,
+                        normalResponse,
+                        errorResponse);
+                response.setStatus(status);
+
+                if (status/100 == 2) {
+                    response.write(normalResponse.asJson().toUtf8());
+                } else {
+                    response.write(errorResponse.asJson().toUtf8());
+                }
+            }
+            else
+            {
+                response.setStatus(400,"Invalid JSON format");
+                errorResponse.init();
+                *errorResponse.getMessage() = "Invalid JSON format";
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else if (request.getMethod() == "GET")
+        {
+            SWGSDRangel::SWGThreadPrioritySettings normalResponse;
+            int status = m_adapter->devicesetDeviceThreadPriorityGet(deviceSetIndex, normalResponse, errorResponse);
+            response.setStatus(status);
+
+            if (status/100 == 2) {
+                response.write(normalResponse.asJson().toUtf8());
+            } else {
+                response.write(errorResponse.asJson().toUtf8());
+            }
+        }
+        else
+        {
+            response.setStatus(405,"Invalid HTTP method");
+            errorResponse.init();
+            *errorResponse.getMessage() = "Invalid HTTP method";
+            response.write(errorResponse.asJson().toUtf8());
+        }
+    }
+    catch (const boost::bad_lexical_cast &e)
+    {
+        errorResponse.init();
+        *errorResponse.getMessage() = "Wrong integer conversion on device set index";
+        response.setStatus(400,"Invalid data");
+        response.write(errorResponse.asJson().toUtf8());
+    }
+}
+
 void WebAPIRequestMapper::devicesetDeviceRunService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response)
 {
     SWGSDRangel::SWGErrorResponse errorResponse;
@@ -2559,6 +2901,14 @@ bool WebAPIRequestMapper::validateDeviceSettings(
             return false;
         }
     }
+    else if (deviceSettings.getDirection() == 2) // MIMO
+    {
+        if (m_mimoDeviceHwIdToSettingsKey.contains(*deviceHwType)) {
+            deviceSettingsKey = m_mimoDeviceHwIdToSettingsKey[*deviceHwType];
+        } else {
+            return false;
+        }
+    }
     else
     {
         return false;
@@ -3153,6 +3503,11 @@ bool WebAPIRequestMapper::getChannelSettings(
             channelSettings->setFreqTrackerSettings(new SWGSDRangel::SWGFreqTrackerSettings());
             channelSettings->getFreqTrackerSettings()->fromJsonObject(settingsJsonObject);
         }
+        else if (channelSettingsKey == "InterferometerSettings")
+        {
+            channelSettings->setInterferometerSettings(new SWGSDRangel::SWGInterferometerSettings());
+            channelSettings->getInterferometerSettings()->fromJsonObject(settingsJsonObject);
+        }
         else if (channelSettingsKey == "NFMDemodSettings")
         {
             channelSettings->setNfmDemodSettings(new SWGSDRangel::SWGNFMDemodSettings());
@@ -3432,6 +3787,31 @@ bool WebAPIRequestMapper::getDeviceSettings(
             deviceSettings->setTestSourceSettings(new SWGSDRangel::SWGTestSourceSettings());
             deviceSettings->getTestSourceSettings()->fromJsonObject(settingsJsonObject);
         }
+        else if (deviceSettingsKey == "testMISettings")
+        {
+            deviceSettings->setTestMiSettings(new SWGSDRangel::SWGTestMISettings());
+            deviceSettings->getTestMiSettings()->fromJsonObject(settingsJsonObject);
+        }
+        else if (deviceSettingsKey == "bladeRF2MIMOSettings")
+        {
+            deviceSettings->setBladeRf2MimoSettings(new SWGSDRangel::SWGBladeRF2MIMOSettings());
+            deviceSettings->getBladeRf2MimoSettings()->fromJsonObject(settingsJsonObject);
+        }
+        else if (deviceSettingsKey == "limeSdrMIMOSettings")
+        {
+            deviceSettings->setLimeSdrMimoSettings(new SWGSDRangel::SWGLimeSdrMIMOSettings());
+            deviceSettings->getLimeSdrMimoSettings()->fromJsonObject(settingsJsonObject);
+        }
+        else if (deviceSettingsKey == "plutoSdrMIMOSettings")
+        {
+            deviceSettings->setPlutoSdrMimoSettings(new SWGSDRangel::SWGPlutoSdrMIMOSettings());
+            deviceSettings->getPlutoSdrMimoSettings()->fromJsonObject(settingsJsonObject);
+        }
+        else if (deviceSettingsKey == "xtrxMIMOSettings")
+        {
+            deviceSettings->setXtrxMimoSettings(new SWGSDRangel::SWGXtrxMIMOSettings());
+            deviceSettings->getXtrxMimoSettings()->fromJsonObject(settingsJsonObject);
+        }
         else if (deviceSettingsKey == "XtrxInputSettings")
         {
             deviceSettings->setXtrxInputSettings(new SWGSDRangel::SWGXtrxInputSettings());
@@ -3570,6 +3950,11 @@ void WebAPIRequestMapper::resetDeviceSettings(SWGSDRangel::SWGDeviceSettings& de
     deviceSettings.setRemoteInputSettings(nullptr);
     deviceSettings.setSdrPlaySettings(nullptr);
     deviceSettings.setTestSourceSettings(nullptr);
+    deviceSettings.setTestMiSettings(nullptr);
+    deviceSettings.setBladeRf2MimoSettings(nullptr);
+    deviceSettings.setLimeSdrMimoSettings(nullptr);
+    deviceSettings.setPlutoSdrMimoSettings(nullptr);
+    deviceSettings.setXtrxMimoSettings(nullptr);
 }
 
 void WebAPIRequestMapper::resetDeviceReport(SWGSDRangel::SWGDeviceReport& deviceReport)
@@ -3603,11 +3988,22 @@ void WebAPIRequestMapper::resetChannelSettings(SWGSDRangel::SWGChannelSettings&
     channelSettings.setChannelType(nullptr);
     channelSettings.setAmDemodSettings(nullptr);
     channelSettings.setAmModSettings(nullptr);
+    channelSettings.setAtvDemodSettings(nullptr);
     channelSettings.setAtvModSettings(nullptr);
     channelSettings.setBfmDemodSettings(nullptr);
+    channelSettings.setChannelAnalyzerSettings(nullptr);
+    channelSettings.setDatvDemodSettings(nullptr);
     channelSettings.setDsdDemodSettings(nullptr);
+    channelSettings.setFileSinkSettings(nullptr);
+    channelSettings.setFileSourceSettings(nullptr);
+    channelSettings.setFreeDvDemodSettings(nullptr);
+    channelSettings.setFreeDvModSettings(nullptr);
+    channelSettings.setFreqTrackerSettings(nullptr);
+    channelSettings.setInterferometerSettings(nullptr);
     channelSettings.setNfmDemodSettings(nullptr);
     channelSettings.setNfmModSettings(nullptr);
+    channelSettings.setLocalSinkSettings(nullptr);
+    channelSettings.setLocalSourceSettings(nullptr);
     channelSettings.setRemoteSinkSettings(nullptr);
     channelSettings.setRemoteSourceSettings(nullptr);
     channelSettings.setSsbDemodSettings(nullptr);
@@ -3626,7 +4022,14 @@ void WebAPIRequestMapper::resetChannelReport(SWGSDRangel::SWGChannelReport& chan
     channelReport.setAmModReport(nullptr);
     channelReport.setAtvModReport(nullptr);
     channelReport.setBfmDemodReport(nullptr);
+    channelReport.setChannelAnalyzerReport(nullptr);
     channelReport.setDsdDemodReport(nullptr);
+    channelReport.setFileSinkReport(nullptr);
+    channelReport.setFileSourceReport(nullptr);
+    channelReport.setFreeDvDemodReport(nullptr);
+    channelReport.setFreeDvModReport(nullptr);
+    channelReport.setFreqTrackerReport(nullptr);
+    channelReport.setInterferometerReport(nullptr);
     channelReport.setNfmDemodReport(nullptr);
     channelReport.setNfmModReport(nullptr);
     channelReport.setRemoteSourceReport(nullptr);
@@ -27,6 +27,7 @@
 #include "httpresponse.h"
 #include "staticfilecontroller.h"
 #include "webapiadapterinterface.h"
+#include "webapirouter.h"
 
 #include "export.h"
 
@@ -46,15 +47,21 @@ public:
     ~WebAPIRequestMapper();
     void service(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void setAdapter(WebAPIAdapterInterface *adapter) { m_adapter = adapter; }
+    void setMetricsPath(const QString& metricsPath) { m_metricsPath = metricsPath.toUtf8(); } //!< empty to disable
 
 private:
     WebAPIAdapterInterface *m_adapter;
+    QByteArray m_metricsPath; //!< path of the internal metrics in Prometheus format
     qtwebapp::StaticFileController *m_staticFileController;
+    WebAPIRouter m_router;
 
+    void metricsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceSummaryService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceConfigService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceDevicesService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceChannelsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void instanceChannelsReportService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void instanceChannelsSettingsService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceLoggingService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceAudioService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void instanceAudioInputParametersService(qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
@@ -80,6 +87,7 @@ private:
     void devicesetDeviceService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetDeviceSettingsService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetDeviceRunService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
+    void devicesetDeviceThreadPriorityService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetDeviceSubsystemRunService(const std::string& indexStr, const std::string& subsystemIndexStr,qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetDeviceReportService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
     void devicesetDeviceActionsService(const std::string& indexStr, qtwebapp::HttpRequest& request, qtwebapp::HttpResponse& response);
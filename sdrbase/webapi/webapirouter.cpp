@@ -0,0 +1,195 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include <QDebug>
+
+#include "webapiadapterinterface.h"
+#include "webapirouter.h"
+
+WebAPIRouter::WebAPIRouter()
+{
+    m_nodes.push_back(Node()); // root
+    const RouteTable& routeTable = getRouteTable();
+
+    for (const auto& route : routeTable) {
+        addRoute(route.first, route.second);
+    }
+}
+
+const WebAPIRouter::RouteTable& WebAPIRouter::getRouteTable()
+{
+    static const RouteTable routeTable = {
+        {RouteInstanceSummary, WebAPIAdapterInterface::instanceSummaryURL.toStdString()},
+        {RouteInstanceConfig, WebAPIAdapterInterface::instanceConfigURL.toStdString()},
+        {RouteInstanceDevices, WebAPIAdapterInterface::instanceDevicesURL.toStdString()},
+        {RouteInstanceChannels, WebAPIAdapterInterface::instanceChannelsURL.toStdString()},
+        {RouteInstanceChannelsReport, WebAPIAdapterInterface::instanceChannelsReportURL.toStdString()},
+        {RouteInstanceChannelsSettings, WebAPIAdapterInterface::instanceChannelsSettingsURL.toStdString()},
+        {RouteInstanceLogging, WebAPIAdapterInterface::instanceLoggingURL.toStdString()},
+        {RouteInstanceAudio, WebAPIAdapterInterface::instanceAudioURL.toStdString()},
+        {RouteInstanceAudioInputParameters, WebAPIAdapterInterface::instanceAudioInputParametersURL.toStdString()},
+        {RouteInstanceAudioOutputParameters, WebAPIAdapterInterface::instanceAudioOutputParametersURL.toStdString()},
+        {RouteInstanceAudioInputCleanup, WebAPIAdapterInterface::instanceAudioInputCleanupURL.toStdString()},
+        {RouteInstanceAudioOutputCleanup, WebAPIAdapterInterface::instanceAudioOutputCleanupURL.toStdString()},
+        {RouteInstanceLocation, WebAPIAdapterInterface::instanceLocationURL.toStdString()},
+        {RouteInstanceAMBESerial, WebAPIAdapterInterface::instanceAMBESerialURL.toStdString()},
+        {RouteInstanceAMBEDevices, WebAPIAdapterInterface::instanceAMBEDevicesURL.toStdString()},
+        {RouteInstanceLimeRFESerial, WebAPIAdapterInterface::instanceLimeRFESerialURL.toStdString()},
+        {RouteInstanceLimeRFEConfig, WebAPIAdapterInterface::instanceLimeRFEConfigURL.toStdString()},
+        {RouteInstanceLimeRFERun, WebAPIAdapterInterface::instanceLimeRFERunURL.toStdString()},
+        {RouteInstanceLimeRFEPower, WebAPIAdapterInterface::instanceLimeRFEPowerURL.toStdString()},
+        {RouteInstancePresets, WebAPIAdapterInterface::instancePresetsURL.toStdString()},
+        {RouteInstancePreset, WebAPIAdapterInterface::instancePresetURL.toStdString()},
+        {RouteInstancePresetFile, WebAPIAdapterInterface::instancePresetFileURL.toStdString()},
+        {RouteInstanceDeviceSets, WebAPIAdapterInterface::instanceDeviceSetsURL.toStdString()},
+        {RouteInstanceDeviceSet, WebAPIAdapterInterface::instanceDeviceSetURL.toStdString()},
+        {RouteDeviceset, "/sdrangel/deviceset/{deviceSetIndex}"},
+        {RouteDevicesetFocus, "/sdrangel/deviceset/{deviceSetIndex}/focus"},
+        {RouteDevicesetDevice, "/sdrangel/deviceset/{deviceSetIndex}/device"},
+        {RouteDevicesetDeviceSettings, "/sdrangel/deviceset/{deviceSetIndex}/device/settings"},
+        {RouteDevicesetDeviceRun, "/sdrangel/deviceset/{deviceSetIndex}/device/run"},
+        {RouteDevicesetDeviceThreadPriority, "/sdrangel/deviceset/{deviceSetIndex}/device/threadpriority"},
+        {RouteDevicesetDeviceSubsystemRun, "/sdrangel/deviceset/{deviceSetIndex}/subdevice/{subsystemIndex}/run"},
+        {RouteDevicesetDeviceReport, "/sdrangel/deviceset/{deviceSetIndex}/device/report"},
+        {RouteDevicesetDeviceActions, "/sdrangel/deviceset/{deviceSetIndex}/device/actions"},
+        {RouteDevicesetChannelsReport, "/sdrangel/deviceset/{deviceSetIndex}/channels/report"},
+        {RouteDevicesetChannel, "/sdrangel/deviceset/{deviceSetIndex}/channel"},
+        {RouteDevicesetChannelIndex, "/sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}"},
+        {RouteDevicesetChannelSettings, "/sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/settings"},
+        {RouteDevicesetChannelReport, "/sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/report"},
+        {RouteDevicesetChannelActions, "/sdrangel/deviceset/{deviceSetIndex}/channel/{channelIndex}/actions"}
+    };
+
+    return routeTable;
+}
+
+void WebAPIRouter::addRoute(Route route, const std::string& pattern)
+{
+    if ((pattern.size() == 0) || (pattern[0] != '/'))
+    {
+        qWarning("WebAPIRouter::addRoute: pattern must start with /: %s", pattern.c_str());
+        return;
+    }
+
+    int nodeIndex = 0;
+    std::size_t start = 1;
+
+    while (start <= pattern.size())
+    {
+        std::size_t end = pattern.find('/', start);
+
+        if (end == std::string::npos) {
+            end = pattern.size();
+        }
+
+        std::string segment = pattern.substr(start, end - start);
+        int childIndex = -1;
+
+        if ((segment.size() > 1) && (segment.front() == '{') && (segment.back() == '}'))
+        {
+            childIndex = m_nodes[nodeIndex].m_indexChild;
+
+            if (childIndex < 0)
+            {
+                childIndex = m_nodes.size();
+                m_nodes[nodeIndex].m_indexChild = childIndex;
+                m_nodes.push_back(Node());
+            }
+        }
+        else
+        {
+            for (const auto& literal : m_nodes[nodeIndex].m_literals)
+            {
+                if (literal.first == segment)
+                {
+                    childIndex = literal.second;
+                    break;
+                }
+            }
+
+            if (childIndex < 0)
+            {
+                childIndex = m_nodes.size();
+                m_nodes[nodeIndex].m_literals.push_back(std::pair<std::string, int>(segment, childIndex));
+                m_nodes.push_back(Node());
+            }
+        }
+
+        nodeIndex = childIndex;
+        start = end + 1;
+    }
+
+    if (m_nodes[nodeIndex].m_route != RouteNone) {
+        qWarning("WebAPIRouter::addRoute: route already defined for %s", pattern.c_str());
+    }
+
+    m_nodes[nodeIndex].m_route = route;
+}
+
+WebAPIRouter::Route WebAPIRouter::match(const char *path, int length, Match& match) const
+{
+    match.m_route = RouteNone;
+    match.m_nbCaptures = 0;
+
+    if ((length == 0) || (path[0] != '/')) {
+        return RouteNone;
+    }
+
+    int nodeIndex = 0;
+    int start = 1;
+
+    while (start <= length)
+    {
+        const char *segment = path + start;
+        const char *slash = (const char *) memchr(segment, '/', length - start);
+        int segmentLength = slash ? slash - segment : length - start;
+        const Node& node = m_nodes[nodeIndex];
+        int childIndex = -1;
+
+        for (const auto& literal : node.m_literals)
+        {
+            if (((int) literal.first.size() == segmentLength) && (memcmp(literal.first.data(), segment, segmentLength) == 0))
+            {
+                childIndex = literal.second;
+                break;
+            }
+        }
+
+        if ((childIndex < 0) && (node.m_indexChild >= 0)
+            && (segmentLength > 0) && (segmentLength <= 2) && (match.m_nbCaptures < m_maxCaptures)
+            && (segment[0] >= '0') && (segment[0] <= '9')
+            && ((segmentLength == 1) || ((segment[1] >= '0') && (segment[1] <= '9'))))
+        {
+            match.m_captures[match.m_nbCaptures] = segment;
+            match.m_captureLengths[match.m_nbCaptures] = segmentLength;
+            match.m_nbCaptures++;
+            childIndex = node.m_indexChild;
+        }
+
+        if (childIndex < 0) {
+            return RouteNone;
+        }
+
+        nodeIndex = childIndex;
+        start += segmentLength + 1;
+    }
+
+    match.m_route = m_nodes[nodeIndex].m_route;
+    return match.m_route;
+}
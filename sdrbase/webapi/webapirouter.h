@@ -0,0 +1,111 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_WEBAPI_WEBAPIROUTER_H_
+#define SDRBASE_WEBAPI_WEBAPIROUTER_H_
+
+#include <string>
+#include <vector>
+#include <utility>
+
+#include "export.h"
+
+/**
+ * Path router of the REST API. Routes are compiled in a trie keyed on the path segments.
+ * A segment of the pattern in braces e.g. {deviceSetIndex} matches an index of 1 or 2 digits
+ * that is captured. Matching a path takes a single pass over its characters.
+ */
+class SDRBASE_API WebAPIRouter
+{
+public:
+    enum Route
+    {
+        RouteNone,
+        RouteInstanceSummary,
+        RouteInstanceConfig,
+        RouteInstanceDevices,
+        RouteInstanceChannels,
+        RouteInstanceChannelsReport,
+        RouteInstanceChannelsSettings,
+        RouteInstanceLogging,
+        RouteInstanceAudio,
+        RouteInstanceAudioInputParameters,
+        RouteInstanceAudioOutputParameters,
+        RouteInstanceAudioInputCleanup,
+        RouteInstanceAudioOutputCleanup,
+        RouteInstanceLocation,
+        RouteInstanceAMBESerial,
+        RouteInstanceAMBEDevices,
+        RouteInstanceLimeRFESerial,
+        RouteInstanceLimeRFEConfig,
+        RouteInstanceLimeRFERun,
+        RouteInstanceLimeRFEPower,
+        RouteInstancePresets,
+        RouteInstancePreset,
+        RouteInstancePresetFile,
+        RouteInstanceDeviceSets,
+        RouteInstanceDeviceSet,
+        RouteDeviceset,
+        RouteDevicesetFocus,
+        RouteDevicesetDevice,
+        RouteDevicesetDeviceSettings,
+        RouteDevicesetDeviceRun,
+        RouteDevicesetDeviceThreadPriority,
+        RouteDevicesetDeviceSubsystemRun,
+        RouteDevicesetDeviceReport,
+        RouteDevicesetDeviceActions,
+        RouteDevicesetChannelsReport,
+        RouteDevicesetChannel,
+        RouteDevicesetChannelIndex,
+        RouteDevicesetChannelSettings,
+        RouteDevicesetChannelReport,
+        RouteDevicesetChannelActions
+    };
+
+    struct SDRBASE_API Match
+    {
+        Route m_route;
+        int m_nbCaptures;
+        const char *m_captures[2];  //!< start of captured segments in the matched path
+        int m_captureLengths[2];
+
+        Match() : m_route(RouteNone), m_nbCaptures(0) {}
+        std::string getCapture(int index) const { return std::string(m_captures[index], m_captureLengths[index]); }
+    };
+
+    typedef std::vector<std::pair<Route, std::string>> RouteTable;
+
+    WebAPIRouter(); //!< compiles the SDRangel route table
+    void addRoute(Route route, const std::string& pattern);
+    Route match(const char *path, int length, Match& match) const;
+    static const RouteTable& getRouteTable();
+
+private:
+    struct Node
+    {
+        std::vector<std::pair<std::string, int>> m_literals; //!< literal segment and index of child node
+        int m_indexChild; //!< child node matching an index segment or -1
+        Route m_route;    //!< route ending at this node or RouteNone
+
+        Node() : m_indexChild(-1), m_route(RouteNone) {}
+    };
+
+    std::vector<Node> m_nodes; //!< first node is the root
+    static const int m_maxCaptures = 2;
+};
+
+#endif // SDRBASE_WEBAPI_WEBAPIROUTER_H_
@@ -0,0 +1,450 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <string.h>
+
+#include <QtWebSockets>
+#include <QHostAddress>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QJsonArray>
+#include <QDebug>
+
+#include "SWGChannelReport.h"
+#include "SWGErrorResponse.h"
+
+#include "webapi/webapiadapterinterface.h"
+#include "webapi/webapiadapterbase.h"
+#include "wschannelreports.h"
+
+WSChannelReports::WSChannelReports(WebAPIAdapterInterface *adapter, QObject *parent) :
+    QObject(parent),
+    m_listeningAddress(QHostAddress::LocalHost),
+    m_port(8892),
+    m_webSocketServer(nullptr),
+    m_adapter(adapter)
+{
+    m_elapsedTimer.start();
+    connect(&m_timer, &QTimer::timeout, this, &WSChannelReports::tick);
+}
+
+WSChannelReports::~WSChannelReports()
+{
+    closeSocket();
+}
+
+void WSChannelReports::openSocket()
+{
+    m_webSocketServer = new QWebSocketServer(
+        QStringLiteral("Channel Reports Server"),
+        QWebSocketServer::NonSecureMode,
+        this);
+
+    if (m_webSocketServer->listen(m_listeningAddress, m_port))
+    {
+        qDebug() << "WSChannelReports::openSocket: channel reports server listening at " << m_listeningAddress.toString() << " on port " << m_port;
+        connect(m_webSocketServer, &QWebSocketServer::newConnection, this, &WSChannelReports::onNewConnection);
+    }
+    else
+    {
+        qInfo("WSChannelReports::openSocket: cannot start channel reports server at %s on port %u", qPrintable(m_listeningAddress.toString()), m_port);
+    }
+}
+
+void WSChannelReports::closeSocket()
+{
+    m_timer.stop();
+    m_clients.clear();
+
+    if (m_webSocketServer)
+    {
+        delete m_webSocketServer;
+        m_webSocketServer = nullptr;
+    }
+}
+
+bool WSChannelReports::socketOpened()
+{
+    return m_webSocketServer && m_webSocketServer->isListening();
+}
+
+QString WSChannelReports::getWebSocketIdentifier(QWebSocket *peer)
+{
+    return QStringLiteral("%1:%2").arg(peer->peerAddress().toString(), QString::number(peer->peerPort()));
+}
+
+void WSChannelReports::onNewConnection()
+{
+    auto pSocket = m_webSocketServer->nextPendingConnection();
+    qDebug() << "WSChannelReports::onNewConnection: " << getWebSocketIdentifier(pSocket) << " connected";
+    pSocket->setParent(this);
+
+    connect(pSocket, &QWebSocket::textMessageReceived, this, &WSChannelReports::processClientMessage);
+    connect(pSocket, &QWebSocket::disconnected, this, &WSChannelReports::socketDisconnected);
+
+    m_clients.insert(pSocket, Client());
+}
+
+void WSChannelReports::processClientMessage(const QString &message)
+{
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+
+    if (!pClient || !m_clients.contains(pClient)) {
+        return;
+    }
+
+    Client& client = m_clients[pClient];
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(message.toUtf8(), &error);
+
+    if ((error.error != QJsonParseError::NoError) || !doc.isObject())
+    {
+        qDebug() << "WSChannelReports::processClientMessage: invalid message: " << message;
+        pClient->sendTextMessage(QStringLiteral("{\"error\": \"Invalid JSON message\"}"));
+        return;
+    }
+
+    QJsonObject object = doc.object();
+
+    if (object.contains("channels"))
+    {
+        QList<ChannelIndexes> channels;
+        QString errorMessage;
+        client.m_selection = object["channels"].toString();
+
+        if (!WebAPIAdapterBase::webapiChannelsSelection(m_adapter, client.m_selection, channels, errorMessage))
+        {
+            QJsonObject reply;
+            reply["error"] = errorMessage;
+            pClient->sendTextMessage(QString(QJsonDocument(reply).toJson(QJsonDocument::Compact)));
+            return;
+        }
+
+        client.m_subscribed = true;
+        resetFieldIds(client);
+        client.m_nextUpdateMs = 0;
+    }
+
+    if (object.contains("intervalMs"))
+    {
+        int intervalMs = object["intervalMs"].toInt(client.m_intervalMs);
+        client.m_intervalMs = intervalMs < m_minIntervalMs ? m_minIntervalMs : intervalMs > m_maxIntervalMs ? m_maxIntervalMs : intervalMs;
+    }
+
+    if (object["unsubscribe"].toBool(false))
+    {
+        client.m_subscribed = false;
+        resetFieldIds(client);
+    }
+
+    if (object["resync"].toBool(false)) {
+        client.m_sentFields.clear();
+    }
+
+    qDebug() << "WSChannelReports::processClientMessage: " << getWebSocketIdentifier(pClient)
+        << " subscribed: " << client.m_subscribed
+        << " channels: " << client.m_selection
+        << " intervalMs: " << client.m_intervalMs;
+
+    updateTimer();
+}
+
+void WSChannelReports::socketDisconnected()
+{
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+
+    if (pClient)
+    {
+        qDebug() << "WSChannelReports::socketDisconnected: " << getWebSocketIdentifier(pClient) << " disconnected";
+        m_clients.remove(pClient);
+        pClient->deleteLater();
+        updateTimer();
+    }
+}
+
+void WSChannelReports::updateTimer()
+{
+    int intervalMs = 0;
+
+    for (const auto& client : m_clients)
+    {
+        if (client.m_subscribed && ((intervalMs == 0) || (client.m_intervalMs < intervalMs))) {
+            intervalMs = client.m_intervalMs;
+        }
+    }
+
+    if (intervalMs == 0)
+    {
+        m_timer.stop();
+    }
+    else if (!m_timer.isActive() || (m_timer.interval() != intervalMs))
+    {
+        m_timer.start(intervalMs);
+        tick(); // new subscriptions get their first update immediately
+    }
+}
+
+void WSChannelReports::tick()
+{
+    qint64 nowMs = m_elapsedTimer.elapsed();
+    QMap<QString, QList<ChannelIndexes>> selections; // expanded selections of this tick
+    QMap<ChannelIndexes, Report> reports; // reports gathered at this tick
+
+    for (auto it = m_clients.begin(); it != m_clients.end(); ++it)
+    {
+        // allow for timer jitter of a tenth of the interval
+        if (it->m_subscribed && (nowMs >= it->m_nextUpdateMs - it->m_intervalMs/10))
+        {
+            updateClient(it.key(), it.value(), nowMs, selections, reports);
+            it->m_nextUpdateMs = nowMs + it->m_intervalMs;
+        }
+    }
+}
+
+const WSChannelReports::Report& WSChannelReports::getReport(const ChannelIndexes& channel, QMap<ChannelIndexes, Report>& reports)
+{
+    auto it = reports.find(channel);
+
+    if (it != reports.end()) {
+        return it.value();
+    }
+
+    SWGSDRangel::SWGChannelReport channelReport;
+    SWGSDRangel::SWGErrorResponse error;
+    Report& report = reports[channel];
+    int status = m_adapter->devicesetChannelReportGet(channel.first, channel.second, channelReport, error);
+    report.m_ok = status/100 == 2;
+
+    if (report.m_ok)
+    {
+        QJsonObject *jsonObject = channelReport.asJsonObject();
+        flattenJson(*jsonObject, QString(), report.m_fields);
+        delete jsonObject;
+    }
+
+    return report;
+}
+
+void WSChannelReports::flattenJson(const QJsonObject& object, const QString& prefix, QHash<QString, QJsonValue>& fields)
+{
+    for (auto it = object.begin(); it != object.end(); ++it)
+    {
+        QString key = prefix.isEmpty() ? it.key() : prefix + "." + it.key();
+
+        if (it.value().isObject())
+        {
+            flattenJson(it.value().toObject(), key, fields);
+        }
+        else if (it.value().isArray())
+        {
+            QJsonArray array = it.value().toArray();
+
+            for (int i = 0; i < array.size(); i++)
+            {
+                QString itemKey = QString("%1.%2").arg(key).arg(i);
+
+                if (array[i].isObject()) {
+                    flattenJson(array[i].toObject(), itemKey, fields);
+                } else {
+                    fields.insert(itemKey, array[i]);
+                }
+            }
+        }
+        else if (it.value().isBool())
+        {
+            fields.insert(key, QJsonValue(it.value().toBool() ? 1.0 : 0.0));
+        }
+        else if (!it.value().isNull() && !it.value().isUndefined())
+        {
+            fields.insert(key, it.value());
+        }
+    }
+}
+
+void WSChannelReports::resetFieldIds(Client& client)
+{
+    client.m_fieldIds.clear();
+    client.m_sentFields.clear(); // next update is complete
+    client.m_fieldIdsReset = true;
+}
+
+void WSChannelReports::updateClient(
+    QWebSocket *socket,
+    Client& client,
+    qint64 nowMs,
+    QMap<QString, QList<ChannelIndexes>>& selections,
+    QMap<ChannelIndexes, Report>& reports)
+{
+    // keys of changing selections or of channels that come and go accumulate: renumber before overflowing
+    if (client.m_fieldIds.size() >= m_maxFieldIds) {
+        resetFieldIds(client);
+    }
+
+    if (!selections.contains(client.m_selection))
+    {
+        QString errorMessage;
+        WebAPIAdapterBase::webapiChannelsSelection(m_adapter, client.m_selection, selections[client.m_selection], errorMessage);
+    }
+
+    const QList<ChannelIndexes>& channels = selections[client.m_selection];
+    QJsonObject newFieldIds;
+    QByteArray payload;
+    QBuffer buffer(&payload);
+    buffer.open(QIODevice::WriteOnly);
+    buffer.write((char*) &nowMs, sizeof(int64_t));
+    quint16 nbChannelRecords = 0;
+    buffer.write((char*) &nbChannelRecords, sizeof(quint16)); // placeholder
+
+    // channels that are no more in the selection
+
+    for (auto it = client.m_sentFields.begin(); it != client.m_sentFields.end();)
+    {
+        if (channels.contains(it.key()))
+        {
+            ++it;
+        }
+        else
+        {
+            quint8 indexes[3] = {(quint8) it.key().first, (quint8) it.key().second, (quint8) ChannelRemoved};
+            quint16 nbFields = 0;
+            buffer.write((char*) indexes, 3);
+            buffer.write((char*) &nbFields, sizeof(quint16));
+            nbChannelRecords++;
+            it = client.m_sentFields.erase(it);
+        }
+    }
+
+    for (const auto& channel : channels)
+    {
+        const Report& report = getReport(channel, reports);
+        bool known = client.m_sentFields.contains(channel);
+        ChannelFields& sentFields = client.m_sentFields[channel];
+        quint8 indexes[3] = {(quint8) channel.first, (quint8) channel.second, 0};
+
+        if (!report.m_ok)
+        {
+            if (!known || !sentFields.isEmpty()) // signal error once
+            {
+                indexes[2] = ChannelError;
+                quint16 nbFields = 0;
+                buffer.write((char*) indexes, 3);
+                buffer.write((char*) &nbFields, sizeof(quint16));
+                nbChannelRecords++;
+                sentFields.clear();
+            }
+
+            continue;
+        }
+
+        QByteArray fieldsPayload;
+        QBuffer fieldsBuffer(&fieldsPayload);
+        fieldsBuffer.open(QIODevice::WriteOnly);
+        quint16 nbFields = 0;
+        QList<quint16> currentIds;
+
+        for (auto it = report.m_fields.begin(); it != report.m_fields.end(); ++it)
+        {
+            auto idIt = client.m_fieldIds.find(it.key());
+
+            if (idIt == client.m_fieldIds.end())
+            {
+                idIt = client.m_fieldIds.insert(it.key(), (quint16) client.m_fieldIds.size());
+                newFieldIds.insert(QString::number(idIt.value()), it.key());
+            }
+
+            quint16 fieldId = idIt.value();
+            currentIds.append(fieldId);
+            auto sentIt = sentFields.find(fieldId);
+
+            if ((sentIt != sentFields.end()) && (sentIt.value() == it.value())) {
+                continue; // unchanged
+            }
+
+            sentFields.insert(fieldId, it.value());
+            fieldsBuffer.write((char*) &fieldId, sizeof(quint16));
+
+            if (it.value().isString())
+            {
+                QByteArray utf8 = it.value().toString().toUtf8();
+                quint8 type = FieldString;
+                quint16 length = utf8.size();
+                fieldsBuffer.write((char*) &type, 1);
+                fieldsBuffer.write((char*) &length, sizeof(quint16));
+                fieldsBuffer.write(utf8.constData(), length);
+            }
+            else
+            {
+                quint8 type = FieldNumber;
+                double value = it.value().toDouble();
+                fieldsBuffer.write((char*) &type, 1);
+                fieldsBuffer.write((char*) &value, sizeof(double));
+            }
+
+            nbFields++;
+        }
+
+        for (auto it = sentFields.begin(); it != sentFields.end();) // fields not present anymore
+        {
+            if (currentIds.contains(it.key()))
+            {
+                ++it;
+            }
+            else
+            {
+                quint16 fieldId = it.key();
+                quint8 type = FieldRemoved;
+                fieldsBuffer.write((char*) &fieldId, sizeof(quint16));
+                fieldsBuffer.write((char*) &type, 1);
+                nbFields++;
+                it = sentFields.erase(it);
+            }
+        }
+
+        fieldsBuffer.close();
+
+        if (nbFields > 0)
+        {
+            indexes[2] = known ? 0 : ChannelFull;
+            buffer.write((char*) indexes, 3);
+            buffer.write((char*) &nbFields, sizeof(quint16));
+            buffer.write(fieldsPayload);
+            nbChannelRecords++;
+        }
+    }
+
+    buffer.close();
+
+    if (!newFieldIds.isEmpty())
+    {
+        QJsonObject fieldsMessage;
+        fieldsMessage["fields"] = newFieldIds;
+
+        if (client.m_fieldIdsReset)
+        {
+            fieldsMessage["reset"] = true;
+            client.m_fieldIdsReset = false;
+        }
+
+        socket->sendTextMessage(QString(QJsonDocument(fieldsMessage).toJson(QJsonDocument::Compact)));
+    }
+
+    if (nbChannelRecords > 0)
+    {
+        memcpy(payload.data() + sizeof(int64_t), &nbChannelRecords, sizeof(quint16));
+        socket->sendBinaryMessage(payload);
+    }
+}
@@ -0,0 +1,141 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB.                                  //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBASE_WEBSOCKETS_WSCHANNELREPORTS_H_
+#define SDRBASE_WEBSOCKETS_WSCHANNELREPORTS_H_
+
+#include <QObject>
+#include <QMap>
+#include <QHash>
+#include <QPair>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QHostAddress>
+#include <QJsonValue>
+
+#include "export.h"
+
+class QWebSocketServer;
+class QWebSocket;
+class WebAPIAdapterInterface;
+
+/**
+ * Pushes channel reports to WebSocket clients.
+ *
+ * A client subscribes with a text message: {"channels": "0:1,0:2,1", "intervalMs": 250}
+ * using the same channels selection as the /sdrangel/channels/report API (empty for all channels).
+ * {"unsubscribe": true} stops the updates and {"resync": true} makes next update complete.
+ *
+ * Updates are binary messages containing only the report fields that changed since the
+ * previous message sent to this client. Report fields are the flattened JSON report keys
+ * (e.g. nfmDemodReport.channelPowerDB) and are identified by a number. The correspondence
+ * is sent to the client in a text message {"fields": {"<id>": "<key>", ...}} before the
+ * first update using new identifiers. Identifiers restart from 0 on each new subscription and
+ * when the identifier space is nearly exhausted. In this case the message also contains
+ * "reset": true meaning that previous identifiers are void and the next update is complete.
+ *
+ * Binary update (host byte order as for WSSpectrum):
+ *   - int64 timestamp in ms since server start
+ *   - uint16 number of channel records then for each channel:
+ *     - uint8 device set index, uint8 channel index, uint8 flags (see ChannelFlags), uint16 number of fields
+ *     - for each field: uint16 field id, uint8 type (see FieldType) then the value:
+ *       float64 for numbers, uint16 length followed by UTF-8 bytes for strings, nothing for removed fields
+ *
+ * Reports are gathered once per timer tick for all clients due at this tick.
+ */
+class SDRBASE_API WSChannelReports : public QObject
+{
+    Q_OBJECT
+public:
+    enum ChannelFlags
+    {
+        ChannelRemoved = 1, //!< channel is no more part of the selection or does not exist anymore
+        ChannelError = 2,   //!< report could not be obtained
+        ChannelFull = 4     //!< all fields are present
+    };
+
+    enum FieldType
+    {
+        FieldNumber,
+        FieldString,
+        FieldRemoved
+    };
+
+    explicit WSChannelReports(WebAPIAdapterInterface *adapter, QObject *parent = nullptr);
+    ~WSChannelReports() override;
+
+    void openSocket();
+    void closeSocket();
+    bool socketOpened();
+    void setListeningAddress(const QString& address) { m_listeningAddress.setAddress(address); }
+    void setPort(quint16 port) { m_port = port; }
+
+private slots:
+    void onNewConnection();
+    void processClientMessage(const QString &message);
+    void socketDisconnected();
+    void tick();
+
+private:
+    typedef QPair<int, int> ChannelIndexes; //!< device set index, channel index
+    typedef QHash<quint16, QJsonValue> ChannelFields;
+
+    struct Client
+    {
+        bool m_subscribed;
+        QString m_selection;
+        int m_intervalMs;
+        qint64 m_nextUpdateMs;
+        QHash<QString, quint16> m_fieldIds;
+        bool m_fieldIdsReset; //!< numbering restarted since the last fields message
+        QMap<ChannelIndexes, ChannelFields> m_sentFields; //!< field values as last sent to the client
+
+        Client() :
+            m_subscribed(false),
+            m_intervalMs(1000),
+            m_nextUpdateMs(0),
+            m_fieldIdsReset(false)
+        {}
+    };
+
+    struct Report
+    {
+        bool m_ok;
+        QHash<QString, QJsonValue> m_fields;
+    };
+
+    QHostAddress m_listeningAddress;
+    quint16 m_port;
+    QWebSocketServer* m_webSocketServer;
+    WebAPIAdapterInterface *m_adapter;
+    QMap<QWebSocket*, Client> m_clients;
+    QTimer m_timer;
+    QElapsedTimer m_elapsedTimer;
+
+    static const int m_minIntervalMs = 50;
+    static const int m_maxIntervalMs = 60000;
+    static const int m_maxFieldIds = 60000; //!< leaves room under the uint16 limit for the fields of one update
+
+    static QString getWebSocketIdentifier(QWebSocket *peer);
+    static void flattenJson(const QJsonObject& object, const QString& prefix, QHash<QString, QJsonValue>& fields);
+    void updateTimer();
+    static void resetFieldIds(Client& client);
+    const Report& getReport(const ChannelIndexes& channel, QMap<ChannelIndexes, Report>& reports);
+    void updateClient(QWebSocket *socket, Client& client, qint64 nowMs, QMap<QString, QList<ChannelIndexes>>& selections, QMap<ChannelIndexes, Report>& reports);
+};
+
+#endif // SDRBASE_WEBSOCKETS_WSCHANNELREPORTS_H_
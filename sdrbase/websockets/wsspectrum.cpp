@@ -15,8 +15,14 @@
 // along with this program. If not, see <http://www.gnu.org/licenses/>.          //
 ///////////////////////////////////////////////////////////////////////////////////
 
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+
 #include <QtWebSockets>
 #include <QHostAddress>
+#include <QJsonDocument>
+#include <QJsonObject>
 #include <QDebug>
 
 #include "wsspectrum.h"
@@ -55,6 +61,10 @@ void WSSpectrum::openSocket()
 
 void WSSpectrum::closeSocket()
 {
+    QMutexLocker mutexLocker(&m_mutex);
+    m_clients.clear();
+    m_pending.clear();
+
     if (m_webSocketServer)
     {
         delete m_webSocketServer;
@@ -80,27 +90,133 @@ void WSSpectrum::onNewConnection()
 
     connect(pSocket, &QWebSocket::textMessageReceived, this, &WSSpectrum::processClientMessage);
     connect(pSocket, &QWebSocket::disconnected, this, &WSSpectrum::socketDisconnected);
+    connect(pSocket, &QWebSocket::bytesWritten, this, &WSSpectrum::socketBytesWritten);
 
-    m_clients << pSocket;
+    QMutexLocker mutexLocker(&m_mutex);
+    m_clients.insert(pSocket, Client());
 }
 
 void WSSpectrum::processClientMessage(const QString &message)
 {
-     qDebug() << "WSSpectrum::processClientMessage: " << message;
+    qDebug() << "WSSpectrum::processClientMessage: " << message;
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+    QJsonParseError error;
+    QJsonDocument doc = QJsonDocument::fromJson(message.toUtf8(), &error);
+
+    if ((error.error != QJsonParseError::NoError) || !doc.isObject())
+    {
+        qDebug() << "WSSpectrum::processClientMessage: invalid JSON message";
+        return;
+    }
+
+    QJsonObject object = doc.object();
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (!pClient || !m_clients.contains(pClient)) {
+        return;
+    }
+
+    Subscription& subscription = m_clients[pClient].m_subscription;
+
+    if (object["reset"].toBool(false)) {
+        subscription = Subscription();
+    }
+    if (object.contains("fps")) {
+        subscription.m_fps = std::max(1, std::min(m_maxFps, object["fps"].toInt(subscription.m_fps)));
+    }
+    if (object.contains("decimation"))
+    {
+        subscription.m_decimation = std::max(1, object["decimation"].toInt(1));
+        subscription.m_maxBins = 0;
+    }
+    if (object.contains("maxBins"))
+    {
+        subscription.m_maxBins = std::max(1, object["maxBins"].toInt(1));
+        subscription.m_decimation = 0;
+    }
+    if (object.contains("reduction")) {
+        subscription.m_reduction = object["reduction"].toString() == "avg" ? ReductionAvg : ReductionMax;
+    }
+    if (object.contains("centerFrequency")) {
+        subscription.m_spanCenterFrequency = (qint64) object["centerFrequency"].toDouble(0);
+    }
+    if (object.contains("span")) {
+        subscription.m_span = std::max(0, object["span"].toInt(0));
+    }
+    if (object.contains("format")) {
+        subscription.m_format = object["format"].toString() == "uint8" ? FormatUInt8 : FormatFloat32;
+    }
 }
 
 void WSSpectrum::socketDisconnected()
 {
     QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
-    qDebug() << getWebSocketIdentifier(pClient) << " disconnected";
 
     if (pClient)
     {
-        m_clients.removeAll(pClient);
+        qDebug() << getWebSocketIdentifier(pClient) << " disconnected";
+        QMutexLocker mutexLocker(&m_mutex);
+        m_clients.remove(pClient);
         pClient->deleteLater();
     }
 }
 
+void WSSpectrum::socketBytesWritten(qint64 bytes)
+{
+    QWebSocket *pClient = qobject_cast<QWebSocket *>(sender());
+    QMutexLocker mutexLocker(&m_mutex);
+
+    if (pClient && m_clients.contains(pClient))
+    {
+        // written bytes include the WebSocket framing
+        Client& client = m_clients[pClient];
+        client.m_pendingBytes = std::max((qint64) 0, client.m_pendingBytes - bytes);
+    }
+}
+
+void WSSpectrum::sendPending()
+{
+    QList<QPair<QWebSocket*, QByteArray>> pending;
+    QMutexLocker mutexLocker(&m_mutex);
+    pending.swap(m_pending);
+
+    for (const auto& item : pending)
+    {
+        // the client may have disconnected since the payload was queued
+        if (m_clients.contains(item.first)) {
+            item.first->sendBinaryMessage(item.second);
+        }
+    }
+}
+
+WSSpectrum::Profile WSSpectrum::getProfile(const Subscription& subscription, int fftSize, uint64_t centerFrequency, int bandwidth)
+{
+    Profile profile;
+    profile.m_startBin = 0;
+    int nbFFTBins = fftSize;
+
+    if ((subscription.m_span > 0) && (subscription.m_span < bandwidth) && (bandwidth > 0))
+    {
+        // bins are ordered from centerFrequency - bandwidth/2 to centerFrequency + bandwidth/2
+        double binHz = (double) bandwidth / fftSize;
+        double lowFrequency = (double) subscription.m_spanCenterFrequency - subscription.m_span/2.0 - ((double) centerFrequency - bandwidth/2.0);
+        nbFFTBins = std::max(1, (int) (subscription.m_span / binHz));
+        profile.m_startBin = std::max(0, std::min(fftSize - nbFFTBins, (int) (lowFrequency / binHz)));
+    }
+
+    if (subscription.m_decimation > 0) {
+        profile.m_decimation = std::min(subscription.m_decimation, nbFFTBins);
+    } else {
+        profile.m_decimation = (nbFFTBins + subscription.m_maxBins - 1) / subscription.m_maxBins;
+    }
+
+    profile.m_nbBins = nbFFTBins / profile.m_decimation;
+    profile.m_reduction = profile.m_decimation == 1 ? ReductionMax : subscription.m_reduction;
+    profile.m_format = subscription.m_format;
+
+    return profile;
+}
+
 void WSSpectrum::newSpectrum(
     const std::vector<Real>& spectrum,
     int fftSize,
@@ -111,29 +227,76 @@ void WSSpectrum::newSpectrum(
     bool linear
 )
 {
-    if (m_timer.elapsed() < 200) { // Max 5 frames per second
-        return;
+    QMutexLocker mutexLocker(&m_mutex);
+    qint64 nowMs = m_timer.elapsed();
+    QMap<Profile, QList<QWebSocket*>> profiles;
+    bool wasPending = !m_pending.isEmpty();
+    fftSize = std::min(fftSize, (int) spectrum.size());
+
+    for (auto it = m_clients.begin(); it != m_clients.end(); ++it)
+    {
+        Client& client = it.value();
+
+        if (nowMs - client.m_lastFrameMs < 1000 / client.m_subscription.m_fps) {
+            continue;
+        }
+
+        // skip the frame when the client did not yet consume the previous ones
+        if (client.m_pendingBytes > 2 * client.m_lastFrameSize) {
+            continue;
+        }
+
+        profiles[getProfile(client.m_subscription, fftSize, centerFrequency, bandwidth)].append(it.key());
     }
 
-    qint64 elapsed = m_timer.restart();
-    QWebSocket *pSender = qobject_cast<QWebSocket *>(sender());
-    QByteArray payload;
+    for (auto it = profiles.begin(); it != profiles.end(); ++it)
+    {
+        const QList<QWebSocket*>& sockets = it.value();
+        Client& firstClient = m_clients[sockets.front()];
+        QByteArray payload;
+
+        buildPayload(
+            payload,
+            spectrum,
+            fftSize,
+            it.key(),
+            nowMs - firstClient.m_lastFrameMs,
+            refLevel,
+            powerRange,
+            centerFrequency,
+            bandwidth,
+            linear
+        );
+
+        for (QWebSocket *pClient : sockets)
+        {
+            Client& client = m_clients[pClient];
+            int64_t fftTimeMs = nowMs - client.m_lastFrameMs;
 
-    buildPayload(
-        payload,
-        spectrum,
-        fftSize,
-        elapsed,
-        refLevel,
-        powerRange,
-        centerFrequency,
-        bandwidth,
-        linear
-    );
-    //qDebug() << "WSSpectrum::newSpectrum: " << payload.size() << " bytes in " << elapsed << " ms";
+            if (fftTimeMs == nowMs - firstClient.m_lastFrameMs)
+            {
+                m_pending.append(qMakePair(pClient, payload));
+            }
+            else
+            {
+                QByteArray clientPayload(payload);
+                memcpy(clientPayload.data() + sizeof(int), &fftTimeMs, sizeof(int64_t));
+                m_pending.append(qMakePair(pClient, clientPayload));
+            }
 
-    for (QWebSocket *pClient : qAsConst(m_clients)) {
-        pClient->sendBinaryMessage(payload);
+            client.m_lastFrameSize = payload.size();
+            client.m_pendingBytes += payload.size();
+        }
+
+        // first client's time is used for comparisons above so update it last
+        for (QWebSocket *pClient : sockets) {
+            m_clients[pClient].m_lastFrameMs = nowMs;
+        }
+    }
+
+    // one send request covers all payloads queued until it runs
+    if (!wasPending && !m_pending.isEmpty()) {
+        QMetaObject::invokeMethod(this, "sendPending", Qt::QueuedConnection);
     }
 }
 
@@ -141,6 +304,7 @@ void WSSpectrum::buildPayload(
     QByteArray& bytes,
     const std::vector<Real>& spectrum,
     int fftSize,
+    const Profile& profile,
     int64_t fftTimeMs,
     float refLevel,
     float powerRange,
@@ -149,16 +313,85 @@ void WSSpectrum::buildPayload(
     bool linear
 )
 {
+    int nbBins = profile.m_nbBins;
+    // the spectrum vector is allocated for the largest FFT: only its first fftSize bins are valid
+    int nbFFTBins = profile.m_nbBins * profile.m_decimation;
+    uint64_t spanCenterFrequency = centerFrequency;
+    int spanBandwidth = bandwidth;
+
+    if (nbFFTBins != fftSize)
+    {
+        double binHz = (double) bandwidth / fftSize;
+        spanCenterFrequency = centerFrequency - bandwidth/2 + (int64_t) ((profile.m_startBin + nbFFTBins/2.0) * binHz);
+        spanBandwidth = nbFFTBins * binHz;
+    }
+
+    const Real *bins = spectrum.data() + profile.m_startBin;
+
+    if (profile.m_decimation > 1)
+    {
+        m_reduced.resize(nbBins);
+        int decimation = profile.m_decimation;
+
+        for (int i = 0; i < nbBins; i++)
+        {
+            const Real *in = bins + i*decimation;
+            Real v = in[0];
+
+            if (profile.m_reduction == ReductionMax)
+            {
+                for (int j = 1; j < decimation; j++) {
+                    v = in[j] > v ? in[j] : v;
+                }
+            }
+            else
+            {
+                for (int j = 1; j < decimation; j++) {
+                    v += in[j];
+                }
+
+                v /= decimation;
+            }
+
+            m_reduced[i] = v;
+        }
+
+        bins = m_reduced.data();
+    }
+
     QBuffer buffer(&bytes);
     buffer.open(QIODevice::WriteOnly);
-    buffer.write((char*) &fftSize, sizeof(int));
+    buffer.write((char*) &nbBins, sizeof(int));
     buffer.write((char*) &fftTimeMs, sizeof(int64_t));
     buffer.write((char*) &refLevel, sizeof(float));
     buffer.write((char*) &powerRange, sizeof(float));
-    buffer.write((char*) &centerFrequency, sizeof(uint64_t));
-    buffer.write((char*) &bandwidth, sizeof(int));
-    int linearInt = linear ? 1 : 0;
-    buffer.write((char*) &linearInt, sizeof(int));
-    buffer.write((char*) spectrum.data(), fftSize*sizeof(Real));
+    buffer.write((char*) &spanCenterFrequency, sizeof(uint64_t));
+    buffer.write((char*) &spanBandwidth, sizeof(int));
+
+    if (profile.m_format == FormatUInt8)
+    {
+        // always dB values whatever the linear setting
+        int linearInt = 0;
+        buffer.write((char*) &linearInt, sizeof(int));
+        m_quantized.resize(nbBins);
+        float scale = powerRange > 0 ? 255.0f / powerRange : 0.0f;
+        float floor = refLevel - powerRange;
+
+        for (int i = 0; i < nbBins; i++)
+        {
+            float db = linear ? 10.0f * log10f(bins[i] > 1e-20f ? bins[i] : 1e-20f) : bins[i];
+            float q = (db - floor) * scale;
+            m_quantized[i] = q < 0.0f ? 0 : q > 255.0f ? 255 : (uint8_t) q;
+        }
+
+        buffer.write((char*) m_quantized.data(), nbBins);
+    }
+    else
+    {
+        int linearInt = linear ? 1 : 0;
+        buffer.write((char*) &linearInt, sizeof(int));
+        buffer.write((char*) bins, nbBins*sizeof(Real));
+    }
+
     buffer.close();
 }
@@ -21,7 +21,11 @@
 #include <vector>
 
 #include <QObject>
+#include <QMap>
 #include <QList>
+#include <QPair>
+#include <QByteArray>
+#include <QMutex>
 #include <QElapsedTimer>
 #include <QHostAddress>
 
@@ -32,6 +36,32 @@
 class QWebSocketServer;
 class QWebSocket;
 
+/**
+ * Spectrum WebSocket server. Each client receives binary frames made of a header
+ * (FFT size, time in ms since the client's previous frame, reference level, power range,
+ * center frequency, bandwidth, linear flag) followed by the spectrum bins.
+ *
+ * A client may adapt the stream to its needs with a JSON text message. All keys are optional
+ * and missing keys keep their current value:
+ *   {"fps": 10, "maxBins": 1024, "decimation": 4, "reduction": "max", "centerFrequency": 145000000,
+ *    "span": 200000, "format": "uint8"}
+ *   - fps: maximum frame rate (1 to 30, default 5)
+ *   - decimation: number of FFT bins merged in one bin or maxBins: maximum number of bins
+ *     from which the decimation is derived
+ *   - reduction: how bins are merged: "max" (default) or "avg"
+ *   - centerFrequency and span: zoom on a part of the spectrum (span 0 for the full spectrum).
+ *     The header gives the center frequency and bandwidth of the bins actually sent.
+ *   - format: "float32" (default) or "uint8" in which case bins are dB values quantized
+ *     from refLevel - powerRange (0) to refLevel (255)
+ * {"reset": true} returns to the default full spectrum at 5 frames per second.
+ *
+ * The reduction is done once per distinct combination of span, decimation, reduction and
+ * format among the clients due for a frame. Frames are skipped for a client whose socket
+ * has not yet written out its previous frames.
+ *
+ * newSpectrum is called from the DSP thread. Payloads are queued and sent from the thread
+ * of the sockets as QWebSocket is not thread safe.
+ */
 class SDRBASE_API WSSpectrum : public QObject
 {
     Q_OBJECT
@@ -58,19 +88,101 @@ private slots:
     void onNewConnection();
     void processClientMessage(const QString &message);
     void socketDisconnected();
+    void socketBytesWritten(qint64 bytes);
+    void sendPending();
 
 private:
+    enum Reduction
+    {
+        ReductionMax,
+        ReductionAvg
+    };
+
+    enum Format
+    {
+        FormatFloat32,
+        FormatUInt8
+    };
+
+    struct Subscription
+    {
+        int m_fps;
+        int m_decimation;  //!< fixed decimation or 0 to derive it from m_maxBins
+        int m_maxBins;
+        Reduction m_reduction;
+        qint64 m_spanCenterFrequency;
+        int m_span;        //!< zoom span in Hz or 0 for the full spectrum
+        Format m_format;
+
+        Subscription() :
+            m_fps(5),
+            m_decimation(1),
+            m_maxBins(0),
+            m_reduction(ReductionMax),
+            m_spanCenterFrequency(0),
+            m_span(0),
+            m_format(FormatFloat32)
+        {}
+    };
+
+    struct Client
+    {
+        Subscription m_subscription;
+        qint64 m_lastFrameMs;
+        qint64 m_lastFrameSize;
+        qint64 m_pendingBytes; //!< queued or not yet written out by the socket
+
+        Client() :
+            m_lastFrameMs(0),
+            m_lastFrameSize(0),
+            m_pendingBytes(0)
+        {}
+    };
+
+    /** Resolved subscription for a given spectrum. Clients with equal profiles share the payload */
+    struct Profile
+    {
+        int m_startBin;
+        int m_nbBins;      //!< number of output bins
+        int m_decimation;
+        Reduction m_reduction;
+        Format m_format;
+
+        bool operator<(const Profile& other) const
+        {
+            if (m_startBin != other.m_startBin) {
+                return m_startBin < other.m_startBin;
+            } else if (m_nbBins != other.m_nbBins) {
+                return m_nbBins < other.m_nbBins;
+            } else if (m_decimation != other.m_decimation) {
+                return m_decimation < other.m_decimation;
+            } else if (m_reduction != other.m_reduction) {
+                return m_reduction < other.m_reduction;
+            } else {
+                return m_format < other.m_format;
+            }
+        }
+    };
+
     QHostAddress m_listeningAddress;
     quint16 m_port;
     QWebSocketServer* m_webSocketServer;
-    QList<QWebSocket*> m_clients;
+    QMap<QWebSocket*, Client> m_clients;
+    QList<QPair<QWebSocket*, QByteArray>> m_pending; //!< payloads waiting to be sent from the sockets thread
+    QMutex m_mutex; //!< clients are served from the DSP thread
     QElapsedTimer m_timer;
+    std::vector<Real> m_reduced;
+    std::vector<uint8_t> m_quantized;
+
+    static const int m_maxFps = 30;
 
     static QString getWebSocketIdentifier(QWebSocket *peer);
+    static Profile getProfile(const Subscription& subscription, int fftSize, uint64_t centerFrequency, int bandwidth);
     void buildPayload(
         QByteArray& bytes,
         const std::vector<Real>& spectrum,
         int fftSize,
+        const Profile& profile,
         int64_t fftTimeMs,
         float refLevel,
         float powerRange,
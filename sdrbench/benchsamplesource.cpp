@@ -0,0 +1,108 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#define _USE_MATH_DEFINES
+#include <math.h>
+#include <random>
+
+#include "device/deviceapi.h"
+#include "dsp/dspcommands.h"
+
+#include "benchsamplesource.h"
+
+BenchSampleSource::BenchSampleSource(DeviceAPI *deviceAPI, int sampleRate) :
+    m_deviceAPI(deviceAPI),
+    m_deviceDescription("BenchSampleSource"),
+    m_sampleRate(sampleRate),
+    m_centerFrequency(100000000),
+    m_samples(m_blockSize),
+    m_samplesWritten(0),
+    m_worker(this)
+{
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> noise(-0.01f, 0.01f);
+    float deviation = 2500.0f / sampleRate;  // 1 kHz tone at 2.5 kHz deviation
+    float tone = 1000.0f / sampleRate;
+    float phase = 0.0f;
+
+    for (int i = 0; i < m_blockSize; i++)
+    {
+        phase += deviation * cos(2.0 * M_PI * tone * i);
+        m_samples[i].setReal((0.3f * cos(2.0 * M_PI * phase) + noise(generator)) * SDR_RX_SCALEF);
+        m_samples[i].setImag((0.3f * sin(2.0 * M_PI * phase) + noise(generator)) * SDR_RX_SCALEF);
+    }
+
+    m_sampleFifo.setSize(4 * m_blockSize);
+}
+
+BenchSampleSource::~BenchSampleSource()
+{
+    stop();
+}
+
+bool BenchSampleSource::start()
+{
+    m_samplesWritten = 0;
+    m_worker.startWork();
+    DSPSignalNotification *notif = new DSPSignalNotification(m_sampleRate, m_centerFrequency);
+    m_deviceAPI->getDeviceEngineInputMessageQueue()->push(notif);
+    return true;
+}
+
+void BenchSampleSource::stop()
+{
+    m_worker.stopWork();
+}
+
+void BenchSampleSource::Worker::startWork()
+{
+    m_startWaitMutex.lock();
+    start();
+
+    while (!m_running) {
+        m_startWaiter.wait(&m_startWaitMutex, 100);
+    }
+
+    m_startWaitMutex.unlock();
+}
+
+void BenchSampleSource::Worker::stopWork()
+{
+    m_running = false;
+    wait();
+}
+
+void BenchSampleSource::Worker::run()
+{
+    SampleSinkFifo *sampleFifo = m_source->getSampleFifo();
+    const SampleVector& samples = m_source->m_samples;
+
+    m_running = true;
+    m_startWaiter.wakeAll();
+
+    while (m_running)
+    {
+        if (sampleFifo->fill() > sampleFifo->size() / 2) // back pressure from the DSP engine
+        {
+            usleep(100);
+            continue;
+        }
+
+        sampleFifo->write(samples.begin(), samples.end());
+        m_source->m_samplesWritten += samples.size();
+    }
+}
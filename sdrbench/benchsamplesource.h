@@ -0,0 +1,91 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SDRBENCH_BENCHSAMPLESOURCE_H_
+#define SDRBENCH_BENCHSAMPLESOURCE_H_
+
+#include <atomic>
+
+#include <QThread>
+#include <QMutex>
+#include <QWaitCondition>
+
+#include "dsp/devicesamplesource.h"
+
+class DeviceAPI;
+
+/**
+ * Synthetic sample source of the pipeline benchmark. It announces a nominal sample rate to the
+ * DSP engine but writes samples as fast as the engine takes them: a precomputed block (a FM
+ * modulated carrier at the center over a noise floor) is written whenever the FIFO is less
+ * than half full.
+ */
+class BenchSampleSource : public DeviceSampleSource
+{
+    Q_OBJECT
+public:
+    BenchSampleSource(DeviceAPI *deviceAPI, int sampleRate);
+    virtual ~BenchSampleSource();
+    virtual void destroy() { delete this; }
+
+    virtual void init() {}
+    virtual bool start();
+    virtual void stop();
+
+    virtual QByteArray serialize() const { return QByteArray(); }
+    virtual bool deserialize(const QByteArray& data) { (void) data; return true; }
+
+    virtual const QString& getDeviceDescription() const { return m_deviceDescription; }
+    virtual int getSampleRate() const { return m_sampleRate; }
+    virtual void setSampleRate(int sampleRate) { (void) sampleRate; }
+    virtual quint64 getCenterFrequency() const { return m_centerFrequency; }
+    virtual void setCenterFrequency(qint64 centerFrequency) { (void) centerFrequency; }
+
+    virtual bool handleMessage(const Message& message) { (void) message; return false; }
+    virtual void setMessageQueueToGUI(MessageQueue *queue) { (void) queue; }
+
+    quint64 getSamplesWritten() const { return m_samplesWritten.load(); }
+
+private:
+    class Worker : public QThread
+    {
+    public:
+        Worker(BenchSampleSource *source) : m_source(source), m_running(false) {}
+        void startWork();
+        void stopWork();
+
+    private:
+        BenchSampleSource *m_source;
+        QMutex m_startWaitMutex;
+        QWaitCondition m_startWaiter;
+        volatile bool m_running;
+
+        void run();
+    };
+
+    DeviceAPI *m_deviceAPI;
+    QString m_deviceDescription;
+    int m_sampleRate;
+    quint64 m_centerFrequency;
+    SampleVector m_samples; //!< block written in a loop
+    std::atomic<quint64> m_samplesWritten;
+    Worker m_worker;
+
+    static const int m_blockSize = 16384;
+};
+
+#endif // SDRBENCH_BENCHSAMPLESOURCE_H_
@@ -64,6 +64,18 @@ void MainBench::run()
         testDecimateFF();
     } else if (m_parser.getTestType() == ParserBench::TestAMBE) {
         testAMBE();
+    } else if (m_parser.getTestType() == ParserBench::TestWebAPIRouter) {
+        testWebAPIRouter();
+    } else if (m_parser.getTestType() == ParserBench::TestNCO) {
+        testNCO();
+    } else if (m_parser.getTestType() == ParserBench::TestPipeline) {
+        testPipeline();
+    } else if (m_parser.getTestType() == ParserBench::TestFFT) {
+        testFFT();
+    } else if (m_parser.getTestType() == ParserBench::TestPresetStore) {
+        testPresetStore();
+    } else if (m_parser.getTestType() == ParserBench::TestKiwiSDRAggregator) {
+        testKiwiSDRAggregator();
     } else {
         qDebug() << "MainBench::run: unknown test type: " << m_parser.getTestType();
     }
@@ -53,6 +53,12 @@ private:
     void testDecimateFI();
     void testDecimateFF();
     void testAMBE();
+    void testWebAPIRouter();
+    void testNCO();
+    void testPipeline();
+    void testFFT();
+    void testPresetStore();
+    void testKiwiSDRAggregator();
     void decimateII(const qint16 *buf, int len);
     void decimateInfII(const qint16 *buf, int len);
     void decimateSupII(const qint16 *buf, int len);
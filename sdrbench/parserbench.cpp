@@ -24,7 +24,7 @@
 
 ParserBench::ParserBench() :
     m_testOption(QStringList() << "t" << "test",
-        "Test type: decimateii, decimatefi, decimateff, decimateif, decimateinfii, decimatesupii, ambe",
+        "Test type: decimateii, decimatefi, decimateff, decimateif, decimateinfii, decimatesupii, ambe, webapirouter, nco, pipeline, fft, presetstore, kiwiaggregator",
         "test",
         "decimateii"),
     m_nbSamplesOption(QStringList() << "n" << "nb-samples",
@@ -38,12 +38,45 @@ ParserBench::ParserBench() :
     m_log2FactorOption(QStringList() << "l" << "log2-factor",
         "Log2 factor for rate conversion.",
         "log2",
-        "2")
+        "2"),
+    m_channelTypesOption(QStringList() << "channel-types",
+        "Pipeline test: comma separated channel types among nfm, am, ssb, bfm, dsd, spectrum.",
+        "types",
+        "nfm,am,ssb,bfm,dsd,spectrum"),
+    m_channelCountsOption(QStringList() << "channels",
+        "Pipeline test: comma separated numbers of channels of the same type to run.",
+        "counts",
+        "1,2,4,8"),
+    m_coreCountsOption(QStringList() << "cores",
+        "Pipeline test: comma separated numbers of CPU cores the threads are pinned to (Linux only). Empty for no pinning.",
+        "counts",
+        ""),
+    m_durationOption(QStringList() << "duration",
+        "Pipeline test: measurement duration of each run in seconds.",
+        "seconds",
+        "2"),
+    m_sampleRateOption(QStringList() << "sample-rate",
+        "Pipeline test: nominal device sample rate in S/s.",
+        "rate",
+        "1536000"),
+    m_jsonFileOption(QStringList() << "json",
+        "Pipeline and FFT tests: write the results to this file in JSON format.",
+        "file",
+        ""),
+    m_fftSizesOption(QStringList() << "fft-sizes",
+        "FFT test: comma separated FFT sizes.",
+        "sizes",
+        "64,128,256,512,1024,2048,4096,8192,16384,32768,65536")
 {
     m_testStr = "decimateii";
     m_nbSamples = 1048576;
     m_repetition = 1;
     m_log2Factor = 4;
+    m_channelTypes = QStringList{"nfm", "am", "ssb", "bfm", "dsd", "spectrum"};
+    m_channelCounts = std::vector<int>{1, 2, 4, 8};
+    m_duration = 2.0f;
+    m_sampleRate = 1536000;
+    m_fftSizes = std::vector<int>{64, 128, 256, 512, 1024, 2048, 4096, 8192, 16384, 32768, 65536};
 
     m_parser.setApplicationDescription("Software Defined Radio application benchmarks");
     m_parser.addHelpOption();
@@ -53,6 +86,13 @@ ParserBench::ParserBench() :
     m_parser.addOption(m_nbSamplesOption);
     m_parser.addOption(m_repetitionOption);
     m_parser.addOption(m_log2FactorOption);
+    m_parser.addOption(m_channelTypesOption);
+    m_parser.addOption(m_channelCountsOption);
+    m_parser.addOption(m_coreCountsOption);
+    m_parser.addOption(m_durationOption);
+    m_parser.addOption(m_sampleRateOption);
+    m_parser.addOption(m_jsonFileOption);
+    m_parser.addOption(m_fftSizesOption);
 }
 
 ParserBench::~ParserBench()
@@ -111,6 +151,88 @@ void ParserBench::parse(const QCoreApplication& app)
     } else {
         qWarning() << "ParserBench::parse: repetilog2 factortion invalid. Defaulting to " << m_log2Factor;
     }
+
+    // pipeline channel types
+
+    QStringList channelTypes = m_parser.value(m_channelTypesOption).split(',', QString::SkipEmptyParts);
+
+    if (channelTypes.size() > 0) {
+        m_channelTypes = channelTypes;
+    } else {
+        qWarning() << "ParserBench::parse: channel types invalid. Defaulting to " << m_channelTypes;
+    }
+
+    // pipeline channel and core counts
+
+    std::vector<int> channelCounts;
+
+    if (parseIntList(m_parser.value(m_channelCountsOption), channelCounts) && (channelCounts.size() > 0)) {
+        m_channelCounts = channelCounts;
+    } else {
+        qWarning() << "ParserBench::parse: channel counts invalid. Defaulting to 1,2,4,8";
+    }
+
+    if (!parseIntList(m_parser.value(m_coreCountsOption), m_coreCounts))
+    {
+        qWarning() << "ParserBench::parse: core counts invalid. Defaulting to no pinning";
+        m_coreCounts.clear();
+    }
+
+    // pipeline duration
+
+    QString durationStr = m_parser.value(m_durationOption);
+    float duration = durationStr.toFloat(&ok);
+
+    if (ok && (duration > 0.0f)) {
+        m_duration = duration;
+    } else {
+        qWarning() << "ParserBench::parse: duration invalid. Defaulting to " << m_duration;
+    }
+
+    // pipeline sample rate
+
+    QString sampleRateStr = m_parser.value(m_sampleRateOption);
+    int sampleRate = sampleRateStr.toInt(&ok);
+
+    if (ok && (sampleRate >= 48000)) {
+        m_sampleRate = sampleRate;
+    } else {
+        qWarning() << "ParserBench::parse: sample rate invalid. Defaulting to " << m_sampleRate;
+    }
+
+    // JSON output
+
+    m_jsonFileName = m_parser.value(m_jsonFileOption);
+
+    // FFT sizes
+
+    std::vector<int> fftSizes;
+
+    if (parseIntList(m_parser.value(m_fftSizesOption), fftSizes) && (fftSizes.size() > 0)) {
+        m_fftSizes = fftSizes;
+    } else {
+        qWarning() << "ParserBench::parse: FFT sizes invalid. Defaulting to 64 to 65536";
+    }
+}
+
+bool ParserBench::parseIntList(const QString& str, std::vector<int>& list)
+{
+    QStringList items = str.split(',', QString::SkipEmptyParts);
+    list.clear();
+
+    for (const auto& item : items)
+    {
+        bool ok;
+        int value = item.toInt(&ok);
+
+        if (!ok || (value <= 0)) {
+            return false;
+        }
+
+        list.push_back(value);
+    }
+
+    return true;
 }
 
 ParserBench::TestType ParserBench::getTestType() const
@@ -127,6 +249,18 @@ ParserBench::TestType ParserBench::getTestType() const
         return TestDecimatorsSupII;
     } else if (m_testStr == "ambe") {
         return TestAMBE;
+    } else if (m_testStr == "webapirouter") {
+        return TestWebAPIRouter;
+    } else if (m_testStr == "nco") {
+        return TestNCO;
+    } else if (m_testStr == "pipeline") {
+        return TestPipeline;
+    } else if (m_testStr == "fft") {
+        return TestFFT;
+    } else if (m_testStr == "presetstore") {
+        return TestPresetStore;
+    } else if (m_testStr == "kiwiaggregator") {
+        return TestKiwiSDRAggregator;
     } else {
         return TestDecimatorsII;
     }
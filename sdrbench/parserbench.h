@@ -20,7 +20,9 @@
 #define SDRBENCH_PARSERBENCH_H_
 
 #include <QCommandLineParser>
+#include <QStringList>
 #include <stdint.h>
+#include <vector>
 
 class ParserBench
 {
@@ -33,7 +35,13 @@ public:
         TestDecimatorsFF,
         TestDecimatorsInfII,
         TestDecimatorsSupII,
-        TestAMBE
+        TestAMBE,
+        TestWebAPIRouter,
+        TestNCO,
+        TestPipeline,
+        TestFFT,
+        TestPresetStore,
+        TestKiwiSDRAggregator
     } TestType;
 
     ParserBench();
@@ -46,18 +54,41 @@ public:
     uint32_t getNbSamples() const { return m_nbSamples; }
     uint32_t getRepetition() const { return m_repetition; }
     uint32_t getLog2Factor() const { return m_log2Factor; }
+    const QStringList& getChannelTypes() const { return m_channelTypes; }
+    const std::vector<int>& getChannelCounts() const { return m_channelCounts; }
+    const std::vector<int>& getCoreCounts() const { return m_coreCounts; }
+    float getDuration() const { return m_duration; }
+    uint32_t getSampleRate() const { return m_sampleRate; }
+    const QString& getJsonFileName() const { return m_jsonFileName; }
+    const std::vector<int>& getFFTSizes() const { return m_fftSizes; }
 
 private:
     QString  m_testStr;
     uint32_t m_nbSamples;
     uint32_t m_repetition;
     uint32_t m_log2Factor;
+    QStringList m_channelTypes;
+    std::vector<int> m_channelCounts;
+    std::vector<int> m_coreCounts; //!< empty for no CPU pinning
+    float m_duration;
+    uint32_t m_sampleRate;
+    QString m_jsonFileName;
+    std::vector<int> m_fftSizes;
 
     QCommandLineParser m_parser;
     QCommandLineOption m_testOption;
     QCommandLineOption m_nbSamplesOption;
     QCommandLineOption m_repetitionOption;
     QCommandLineOption m_log2FactorOption;
+    QCommandLineOption m_channelTypesOption;
+    QCommandLineOption m_channelCountsOption;
+    QCommandLineOption m_coreCountsOption;
+    QCommandLineOption m_durationOption;
+    QCommandLineOption m_sampleRateOption;
+    QCommandLineOption m_jsonFileOption;
+    QCommandLineOption m_fftSizesOption;
+
+    static bool parseIntList(const QString& str, std::vector<int>& list);
 };
 
 
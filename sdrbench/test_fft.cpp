@@ -0,0 +1,131 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include <QDebug>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonDocument>
+#include <QDateTime>
+#include <QSysInfo>
+
+#include "dsp/fftengine.h"
+#include "dsp/fftfactory.h"
+#include "dsp/gfftengine.h"
+
+#include "mainbench.h"
+
+void MainBench::testFFT()
+{
+    const QStringList& engineNames = FFTEngine::getAllNames();
+    QJsonArray jsonResults;
+
+    qDebug() << "MainBench::testFFT: run test with engines:" << engineNames;
+
+    for (auto fftSize : m_parser.getFFTSizes())
+    {
+        unsigned int nbTransforms = std::max(1U, m_parser.getNbSamples() / fftSize) * std::max(1U, m_parser.getRepetition());
+
+        for (int inverse = 0; inverse < 2; inverse++)
+        {
+            std::vector<Complex> reference;
+            QString bestName;
+            double bestTime = 0.0;
+            QDebug info = qInfo();
+            info.noquote();
+            info << tr("MainBench::testFFT: %1 %2:").arg(fftSize).arg(inverse ? "inv" : "fwd");
+
+            for (const auto& name : engineNames)
+            {
+                if ((name == GFFTEngine::m_name) && !GFFTEngine::isSizeSupported(fftSize)) {
+                    continue;
+                }
+
+                FFTEngine *engine = FFTEngine::create("", name);
+                engine->setReuse(false);
+                engine->configure(fftSize, inverse != 0);
+                // all engines transform the same input so that their outputs can be compared
+                double nsecs = FFTFactory::timeEngine(engine, fftSize, nbTransforms);
+                double maxError = 0.0;
+
+                if (reference.size() == 0)
+                {
+                    reference.assign(engine->out(), engine->out() + fftSize);
+                }
+                else
+                {
+                    double maxMagnitude = 0.0;
+
+                    for (int i = 0; i < fftSize; i++)
+                    {
+                        maxMagnitude = std::max(maxMagnitude, (double) std::abs(reference[i]));
+                        maxError = std::max(maxError, (double) std::abs(engine->out()[i] - reference[i]));
+                    }
+
+                    maxError = maxMagnitude == 0.0 ? 0.0 : maxError / maxMagnitude;
+                }
+
+                delete engine;
+                info << tr("%1: %L2 ns (%L3 MS/s, error %4)")
+                    .arg(name)
+                    .arg(nsecs, 0, 'f', 0)
+                    .arg((fftSize * 1000.0) / nsecs, 0, 'f', 1)
+                    .arg(maxError, 0, 'g', 2);
+
+                if ((bestTime == 0.0) || (nsecs < bestTime))
+                {
+                    bestTime = nsecs;
+                    bestName = name;
+                }
+
+                QJsonObject jsonResult;
+                jsonResult.insert("engine", name);
+                jsonResult.insert("size", fftSize);
+                jsonResult.insert("inverse", inverse != 0);
+                jsonResult.insert("nsPerTransform", nsecs);
+                jsonResult.insert("maxRelativeError", maxError);
+                jsonResults.append(jsonResult);
+            }
+
+            info << tr("- fastest: %1").arg(bestName);
+        }
+    }
+
+    if (m_parser.getJsonFileName().size() > 0)
+    {
+        QJsonObject json;
+        json.insert("test", "fft");
+        json.insert("date", QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+        json.insert("cpu", QSysInfo::currentCpuArchitecture());
+        json.insert("os", QSysInfo::prettyProductName());
+        json.insert("results", jsonResults);
+
+        QFile file(m_parser.getJsonFileName());
+
+        if (file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            file.write(QJsonDocument(json).toJson());
+            qDebug("MainBench::testFFT: results written to %s", qPrintable(m_parser.getJsonFileName()));
+        }
+        else
+        {
+            qWarning("MainBench::testFFT: cannot write %s", qPrintable(m_parser.getJsonFileName()));
+        }
+    }
+}
@@ -0,0 +1,298 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <vector>
+
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include "dsp/samplesinkfifo.h"
+#include "kiwisdraggregator.h"
+
+#include "mainbench.h"
+
+namespace {
+
+const int frameSize = 512;
+const unsigned int nbSessions = 2;
+const int groupDelay = (64 * nbSessions - 1) / 2; //!< interpolation filter delay in output samples
+const int impulseIndex = 100;                     //!< position of the impulse in its frame
+
+struct Push
+{
+    unsigned int m_session;
+    KiwiSDRAggregator::Frame m_frame;
+};
+
+/** Frames pushed in order with the expected output */
+struct Scenario
+{
+    QString m_name;
+    std::vector<Push> m_pushes;
+    unsigned int m_expectedSamples;  //!< output samples
+    int m_expectedPeak;              //!< output index of the impulse
+    quint64 m_expectedLost;
+    quint64 m_expectedLate;
+
+    // zero frame with an impulse if impulse is set. GPS time of the frame if gpsTime >= 0.
+    void push(unsigned int session, quint32 sequence, bool impulse = false, double gpsTime = -1.0)
+    {
+        Push item;
+        item.m_session = session;
+        item.m_frame.m_sequence = sequence;
+        item.m_frame.m_gpsValid = gpsTime >= 0.0;
+        item.m_frame.m_gpsTime = gpsTime;
+        item.m_frame.m_samples.assign(frameSize, Complex{0.0f, 0.0f});
+
+        if (impulse) {
+            item.m_frame.m_samples[impulseIndex] = Complex{10000.0f, 0.0f};
+        }
+
+        m_pushes.push_back(item);
+    }
+};
+
+// output index of the impulse placed at this position of a session whose position 0
+// is output at index outputStart
+int peakIndex(int framePosition, int outputStart)
+{
+    return (framePosition * frameSize + impulseIndex - outputStart) * nbSessions + groupDelay;
+}
+
+bool runScenario(const Scenario& scenario, qint64& nsecs)
+{
+    SampleSinkFifo fifo(1<<20);
+    KiwiSDRAggregator aggregator(&fifo, nbSessions);
+    QElapsedTimer timer;
+    timer.start();
+
+    for (const auto& item : scenario.m_pushes) {
+        aggregator.pushFrame(item.m_session, item.m_frame);
+    }
+
+    nsecs = timer.nsecsElapsed();
+    unsigned int nbSamples = fifo.fill();
+    SampleVector samples(nbSamples);
+    fifo.read(samples.begin(), samples.end());
+    int peak = -1;
+    double peakMagsq = 0.0;
+
+    for (unsigned int i = 0; i < nbSamples; i++)
+    {
+        double magsq = (double) samples[i].real() * samples[i].real() + (double) samples[i].imag() * samples[i].imag();
+
+        if (magsq > peakMagsq)
+        {
+            peakMagsq = magsq;
+            peak = i;
+        }
+    }
+
+    bool ok = (nbSamples == scenario.m_expectedSamples)
+        && (std::abs(peak - scenario.m_expectedPeak) <= 1) // the filter has two equal center taps
+        && (aggregator.getLostSamples() == scenario.m_expectedLost)
+        && (aggregator.getLateSamples() == scenario.m_expectedLate);
+
+    if (!ok)
+    {
+        qWarning("MainBench::testKiwiSDRAggregator: %s: samples: %u (%u) peak: %d (%d) lost: %llu (%llu) late: %llu (%llu)",
+            qPrintable(scenario.m_name),
+            nbSamples, scenario.m_expectedSamples,
+            peak, scenario.m_expectedPeak,
+            aggregator.getLostSamples(), scenario.m_expectedLost,
+            aggregator.getLateSamples(), scenario.m_expectedLate);
+    }
+
+    return ok;
+}
+
+// sessions start together and stream in step. Sequence numbers start anywhere.
+Scenario inStep()
+{
+    Scenario scenario;
+    scenario.m_name = "in step";
+
+    for (int f = 0; f < 100; f++)
+    {
+        scenario.push(0, 1000 + f);
+        scenario.push(1, 77 + f, f == 60);
+    }
+
+    scenario.m_expectedSamples = 100 * frameSize * nbSessions;
+    scenario.m_expectedPeak = peakIndex(60, 0);
+    scenario.m_expectedLost = 0;
+    scenario.m_expectedLate = 0;
+    return scenario;
+}
+
+// session 1 connects 3 frames after session 0: both are aligned on the arrival of their frames
+// so session 0 output starts at its 4th frame
+Scenario arrivalAlignment()
+{
+    Scenario scenario;
+    scenario.m_name = "arrival alignment";
+
+    for (int f = 0; f < 100; f++)
+    {
+        scenario.push(0, f, f == 50);
+
+        if (f >= 3) {
+            scenario.push(1, f - 3);
+        }
+    }
+
+    scenario.m_expectedSamples = 97 * frameSize * nbSessions;
+    scenario.m_expectedPeak = peakIndex(50, 3 * frameSize);
+    scenario.m_expectedLost = 0;
+    scenario.m_expectedLate = 0;
+    return scenario;
+}
+
+// same arrival as above but GPS times say session 1 started 1000 samples after session 0.
+// Session 0 output starts 1000 samples after its first sample instead of 3 frames.
+// The samples before are dropped when the sessions are placed.
+Scenario gpsAlignment()
+{
+    Scenario scenario;
+    scenario.m_name = "GPS alignment";
+    const double gpsStart = 3600.0;
+    const int gpsDelay = 1000;
+    const double frameSeconds = (double) frameSize / KiwiSDRAggregator::m_sessionSampleRate;
+
+    for (int f = 0; f < 100; f++)
+    {
+        scenario.push(0, f, f == 50, gpsStart + f * frameSeconds);
+
+        if (f >= 3) {
+            scenario.push(1, f - 3, false, gpsStart + (double) gpsDelay / KiwiSDRAggregator::m_sessionSampleRate + (f - 3) * frameSeconds);
+        }
+    }
+
+    scenario.m_expectedSamples = 97 * frameSize * nbSessions; // up to the last frame of session 1
+    scenario.m_expectedPeak = peakIndex(50, gpsDelay);
+    scenario.m_expectedLost = 0;
+    scenario.m_expectedLate = 0;
+    return scenario;
+}
+
+// session 1 loses frames 20 to 22 and receives frame 41 before frame 40.
+// Lost frames are replaced by zeros and the frame arriving after its place was filled is dropped.
+Scenario lostAndReordered()
+{
+    Scenario scenario;
+    scenario.m_name = "lost and reordered frames";
+
+    for (int f = 0; f < 100; f++)
+    {
+        scenario.push(0, f);
+
+        if ((f >= 20) && (f <= 22)) {
+            continue;
+        }
+
+        int sequence = f == 40 ? 41 : f == 41 ? 40 : f;
+        scenario.push(1, sequence, sequence == 60);
+    }
+
+    scenario.m_expectedSamples = 100 * frameSize * nbSessions;
+    scenario.m_expectedPeak = peakIndex(60, 0);
+    scenario.m_expectedLost = 4 * frameSize;
+    scenario.m_expectedLate = frameSize;
+    return scenario;
+}
+
+// session 1 stalls for 20 frames (more than the maximum lag): it is filled with zeros
+// so that session 0 keeps streaming and it takes its place again when it resumes
+Scenario lagFill()
+{
+    Scenario scenario;
+    scenario.m_name = "lag fill";
+
+    for (int f = 0; f < 50; f++)
+    {
+        scenario.push(0, f);
+
+        if ((f < 10) || (f >= 30)) {
+            scenario.push(1, f, f == 40);
+        }
+    }
+
+    scenario.m_expectedSamples = 50 * frameSize * nbSessions;
+    scenario.m_expectedPeak = peakIndex(40, 0);
+    scenario.m_expectedLost = 20 * frameSize;
+    scenario.m_expectedLate = 0;
+    return scenario;
+}
+
+// the server of session 1 restarts its stream after frame 29 with unrelated sequence numbers.
+// The session restarts with its new frames placed at the end of session 0.
+Scenario sessionRestart()
+{
+    Scenario scenario;
+    scenario.m_name = "session restart";
+
+    for (int f = 0; f < 50; f++)
+    {
+        scenario.push(0, f);
+
+        if (f < 30) {
+            scenario.push(1, f);
+        } else {
+            scenario.push(1, 1000000 + (f - 30), f == 40);
+        }
+    }
+
+    scenario.m_expectedSamples = 50 * frameSize * nbSessions;
+    scenario.m_expectedPeak = peakIndex(40, 0);
+    scenario.m_expectedLost = 0;
+    scenario.m_expectedLate = 0;
+    return scenario;
+}
+
+} // namespace
+
+void MainBench::testKiwiSDRAggregator()
+{
+    qDebug() << "MainBench::testKiwiSDRAggregator: create test data";
+
+    std::vector<Scenario> scenarios = {
+        inStep(),
+        arrivalAlignment(),
+        gpsAlignment(),
+        lostAndReordered(),
+        lagFill(),
+        sessionRestart()
+    };
+
+    qDebug() << "MainBench::testKiwiSDRAggregator: run test";
+
+    int nbFailed = 0;
+
+    for (const auto& scenario : scenarios)
+    {
+        qint64 nsecs;
+
+        if (!runScenario(scenario, nsecs)) {
+            nbFailed++;
+        }
+
+        printResults("MainBench::testKiwiSDRAggregator: " + scenario.m_name, nsecs);
+    }
+
+    qDebug("MainBench::testKiwiSDRAggregator: %d scenarios failed out of %d", nbFailed, (int) scenarios.size());
+}
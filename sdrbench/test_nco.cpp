@@ -0,0 +1,90 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include "dsp/nco.h"
+#include "dsp/ncof.h"
+
+#include "mainbench.h"
+
+void MainBench::testNCO()
+{
+    QElapsedTimer timer;
+    qint64 nsecsNCO = 0, nsecsNCOBlock = 0, nsecsNCOF = 0, nsecsNCOFBlock = 0;
+
+    qDebug() << "MainBench::testNCO: create test data";
+
+    uint32_t nbSamples = m_parser.getNbSamples();
+    SampleVector samples(nbSamples);
+    std::vector<Complex> out(nbSamples);
+    std::vector<Complex> outBlock(nbSamples);
+
+    for (auto& sample : samples)
+    {
+        sample.m_real = m_uniform_distribution_s16(m_generator);
+        sample.m_imag = m_uniform_distribution_s16(m_generator);
+    }
+
+    NCO nco, ncoBlock;
+    NCOF ncof, ncofBlock;
+    nco.setFreq(-12500.0f, 48000.0f);
+    ncoBlock.setFreq(-12500.0f, 48000.0f);
+    ncof.setFreq(3333.3f, 48000.0f);
+    ncofBlock.setFreq(3333.3f, 48000.0f);
+    double maxError = 0.0;
+
+    qDebug() << "MainBench::testNCO: run test";
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (uint32_t j = 0; j < nbSamples; j++) {
+            out[j] = Complex(samples[j].real(), samples[j].imag()) * nco.nextIQ();
+        }
+
+        nsecsNCO += timer.nsecsElapsed();
+        timer.start();
+        ncoBlock.mixIQBlock(samples.data(), outBlock.data(), nbSamples);
+        nsecsNCOBlock += timer.nsecsElapsed();
+
+        for (uint32_t j = 0; j < nbSamples; j++)
+        {
+            double error = std::abs(out[j] - outBlock[j]) / SDR_RX_SCALED;
+            maxError = error > maxError ? error : maxError;
+        }
+
+        timer.start();
+
+        for (uint32_t j = 0; j < nbSamples; j++) {
+            out[j] = Complex(samples[j].real(), samples[j].imag()) * ncof.nextIQ();
+        }
+
+        nsecsNCOF += timer.nsecsElapsed();
+        timer.start();
+        ncofBlock.mixIQBlock(samples.data(), outBlock.data(), nbSamples);
+        nsecsNCOFBlock += timer.nsecsElapsed();
+    }
+
+    qDebug("MainBench::testNCO: NCO block vs sample by sample max error: %g (relative to full scale)", maxError);
+    printResults("MainBench::testNCO: NCO nextIQ", nsecsNCO);
+    printResults("MainBench::testNCO: NCO mixIQBlock", nsecsNCOBlock);
+    printResults("MainBench::testNCO: NCOF nextIQ", nsecsNCOF);
+    printResults("MainBench::testNCO: NCOF mixIQBlock", nsecsNCOFBlock);
+}
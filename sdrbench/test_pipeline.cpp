@@ -0,0 +1,340 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#ifdef __linux__
+#include <sched.h>
+#endif
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QEventLoop>
+#include <QTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonObject>
+#include <QJsonDocument>
+#include <QDateTime>
+#include <QSysInfo>
+#include <QThread>
+
+#include "plugin/pluginmanager.h"
+#include "plugin/pluginapi.h"
+#include "plugin/plugininterface.h"
+#include "channel/channelapi.h"
+#include "device/deviceapi.h"
+#include "dsp/dspengine.h"
+#include "dsp/dspdevicesourceengine.h"
+#include "dsp/spectrumvis.h"
+#include "dsp/glspectruminterface.h"
+#include "util/metrics.h"
+
+#include "benchsamplesource.h"
+#include "mainbench.h"
+
+namespace {
+
+struct PipelineResult
+{
+    QString m_channelType;
+    int m_nbChannels;
+    int m_nbCores;          //!< 0 if not pinned
+    double m_seconds;
+    double m_sourceRate;    //!< S/s delivered to the DSP engine
+    double m_channelRate;   //!< S/s processed by each channel
+    double m_dropRatio;     //!< samples dropped by the channel FIFOs over samples delivered to the channels
+};
+
+/** Spectrum visualization target so that the spectrum sink computes the FFTs */
+class NullSpectrum : public GLSpectrumInterface
+{
+public:
+    virtual void newSpectrum(const std::vector<Real>& spectrum, int fftSize)
+    {
+        (void) spectrum;
+        (void) fftSize;
+    }
+};
+
+const QMap<QString, QString>& channelIds()
+{
+    static const QMap<QString, QString> ids = {
+        {"nfm", "NFMDemod"},
+        {"am", "AMDemod"},
+        {"ssb", "SSBDemod"},
+        {"bfm", "BFMDemod"},
+        {"dsd", "DSDDemod"}
+    };
+    return ids;
+}
+
+// Run the event loop of this thread: channel objects created here handle their messages in it
+void waitEvents(int ms)
+{
+    QEventLoop loop;
+    QTimer::singleShot(ms, &loop, SLOT(quit()));
+    loop.exec();
+}
+
+#ifdef __linux__
+cpu_set_t initialCPUSet; //!< affinity the bench was started with (e.g. by taskset)
+#endif
+
+void saveAffinity()
+{
+#ifdef __linux__
+    if (sched_getaffinity(0, sizeof(initialCPUSet), &initialCPUSet) != 0)
+    {
+        qWarning("MainBench::testPipeline: cannot get the CPU affinity");
+        CPU_ZERO(&initialCPUSet);
+
+        for (int i = 0; i < QThread::idealThreadCount(); i++) {
+            CPU_SET(i, &initialCPUSet);
+        }
+    }
+#endif
+}
+
+// The threads created afterwards (DSP engine, channels, source) inherit the affinity.
+// Pins to the first nbCores CPUs of the initial affinity or restores it if nbCores is 0.
+void pinCores(int nbCores)
+{
+#ifdef __linux__
+    cpu_set_t cpuSet;
+    CPU_ZERO(&cpuSet);
+    int nbCpus = 0;
+
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++)
+    {
+        if (CPU_ISSET(cpu, &initialCPUSet) && ((nbCores <= 0) || (nbCpus < nbCores)))
+        {
+            CPU_SET(cpu, &cpuSet);
+            nbCpus++;
+        }
+    }
+
+    if (nbCpus < nbCores) {
+        qWarning("MainBench::testPipeline: only %d cores available out of %d", nbCpus, nbCores);
+    }
+
+    if (sched_setaffinity(0, sizeof(cpuSet), &cpuSet) != 0) {
+        qWarning("MainBench::testPipeline: cannot pin to %d cores", nbCpus);
+    }
+#else
+    if (nbCores > 0) {
+        qWarning("MainBench::testPipeline: CPU pinning is not supported on this platform");
+    }
+#endif
+}
+
+bool runPipeline(PluginAPI *pluginAPI, const QString& channelType, int nbChannels, int nbCores, int sampleRate, float duration, PipelineResult& result)
+{
+    PluginInterface *plugin = nullptr;
+
+    if (channelType != "spectrum")
+    {
+        PluginAPI::ChannelRegistrations *registrations = pluginAPI->getRxChannelRegistrations();
+
+        for (const auto& registration : *registrations)
+        {
+            if (registration.m_channelId == channelIds().value(channelType)) {
+                plugin = registration.m_plugin;
+            }
+        }
+
+        if (!plugin)
+        {
+            qWarning("MainBench::testPipeline: channel type %s not available", qPrintable(channelType));
+            return false;
+        }
+    }
+
+    pinCores(nbCores);
+
+    DSPDeviceSourceEngine *deviceSourceEngine = DSPEngine::instance()->addDeviceSourceEngine();
+    deviceSourceEngine->start();
+    DeviceAPI *deviceAPI = new DeviceAPI(DeviceAPI::StreamSingleRx, 0, deviceSourceEngine, nullptr, nullptr);
+    BenchSampleSource *source = new BenchSampleSource(deviceAPI, sampleRate);
+    deviceAPI->setSampleSource(source);
+
+    std::vector<ChannelAPI*> channels;
+    std::vector<SpectrumVis*> spectrums;
+    NullSpectrum nullSpectrum;
+
+    for (int i = 0; i < nbChannels; i++)
+    {
+        if (plugin)
+        {
+            channels.push_back(plugin->createRxChannelCS(deviceAPI));
+        }
+        else
+        {
+            SpectrumVis *spectrumVis = new SpectrumVis(SDR_RX_SCALEF);
+            spectrumVis->setGLSpectrum(&nullSpectrum);
+            deviceAPI->addChannelSink(spectrumVis);
+            spectrums.push_back(spectrumVis);
+        }
+    }
+
+    deviceAPI->initDeviceEngine();
+    deviceAPI->startDeviceEngine();
+    waitEvents(500); // let the channels configure and the FIFOs settle
+
+    Metrics& metrics = Metrics::instance();
+    Metrics::Counter *channelizerSamples = metrics.counter(
+        "sdrangel_channelizer_samples_total",
+        "Baseband samples processed by the channelizers",
+        {{"direction", "rx"}});
+    Metrics::Counter *droppedSamples = metrics.counter(
+        "sdrangel_sample_sink_fifo_dropped_samples_total",
+        "Samples dropped on device sample FIFO overflow");
+
+    quint64 sourceStart = source->getSamplesWritten();
+    quint64 channelizerStart = channelizerSamples->value();
+    quint64 droppedStart = droppedSamples->value();
+    QElapsedTimer timer;
+    timer.start();
+
+    waitEvents(duration * 1000);
+
+    double seconds = timer.nsecsElapsed() / 1e9;
+    quint64 sourceSamples = source->getSamplesWritten() - sourceStart;
+    quint64 channelizerDone = channelizerSamples->value() - channelizerStart;
+    quint64 dropped = droppedSamples->value() - droppedStart;
+
+    deviceSourceEngine->stopAcquistion();
+
+    for (auto channel : channels) {
+        channel->destroy();
+    }
+
+    for (auto spectrumVis : spectrums)
+    {
+        deviceAPI->removeChannelSink(spectrumVis);
+        delete spectrumVis;
+    }
+
+    waitEvents(100); // deferred deletions
+    delete source;
+    deviceSourceEngine->stop();
+    DSPEngine::instance()->removeLastDeviceSourceEngine();
+    delete deviceAPI;
+    pinCores(0);
+
+    result.m_channelType = channelType;
+    result.m_nbChannels = nbChannels;
+    result.m_nbCores = nbCores;
+    result.m_seconds = seconds;
+    result.m_sourceRate = sourceSamples / seconds;
+
+    if (plugin) // the channels process the samples in their own thread after their FIFO
+    {
+        result.m_channelRate = (channelizerDone / (double) nbChannels) / seconds;
+        result.m_dropRatio = sourceSamples == 0 ? 0.0 : dropped / ((double) sourceSamples * nbChannels);
+    }
+    else // the spectrums process all the samples in the DSP engine thread
+    {
+        result.m_channelRate = result.m_sourceRate;
+        result.m_dropRatio = 0.0;
+    }
+
+    return true;
+}
+
+} // namespace
+
+void MainBench::testPipeline()
+{
+    qDebug() << "MainBench::testPipeline: load plugins";
+
+    saveAffinity();
+    DSPEngine::instance()->createFFTFactory("");
+    PluginManager pluginManager(this);
+    pluginManager.loadPlugins(QString("pluginssrv"));
+
+    std::vector<int> coreCounts = m_parser.getCoreCounts();
+
+    if (coreCounts.size() == 0) {
+        coreCounts.push_back(0); // no pinning
+    }
+
+    int sampleRate = m_parser.getSampleRate();
+    QJsonArray jsonResults;
+
+    qDebug() << "MainBench::testPipeline: run test";
+
+    for (const auto& channelType : m_parser.getChannelTypes())
+    {
+        for (auto nbCores : coreCounts)
+        {
+            for (auto nbChannels : m_parser.getChannelCounts())
+            {
+                PipelineResult result;
+
+                if (!runPipeline(pluginManager.getPluginAPI(), channelType, nbChannels, nbCores, sampleRate, m_parser.getDuration(), result)) {
+                    break;
+                }
+
+                QDebug info = qInfo();
+                info.noquote();
+                info << tr("MainBench::testPipeline: %1 x%2 cores: %3 - source: %L4 kS/s - per channel: %L5 kS/s (%6 x real time, %7 channels) - dropped: %8 %")
+                    .arg(channelType)
+                    .arg(nbChannels)
+                    .arg(nbCores == 0 ? tr("all") : QString::number(nbCores))
+                    .arg(result.m_sourceRate / 1000.0, 0, 'f', 0)
+                    .arg(result.m_channelRate / 1000.0, 0, 'f', 0)
+                    .arg(result.m_channelRate / sampleRate, 0, 'f', 2)
+                    .arg((nbChannels * result.m_channelRate) / sampleRate, 0, 'f', 1)
+                    .arg(result.m_dropRatio * 100.0, 0, 'f', 2);
+
+                QJsonObject jsonResult;
+                jsonResult.insert("channelType", result.m_channelType);
+                jsonResult.insert("channels", result.m_nbChannels);
+                jsonResult.insert("cores", result.m_nbCores);
+                jsonResult.insert("seconds", result.m_seconds);
+                jsonResult.insert("sourceSamplesPerSecond", result.m_sourceRate);
+                jsonResult.insert("channelSamplesPerSecond", result.m_channelRate);
+                jsonResult.insert("realTimeFactor", result.m_channelRate / sampleRate);
+                jsonResult.insert("dropRatio", result.m_dropRatio);
+                jsonResults.append(jsonResult);
+            }
+        }
+    }
+
+    if (m_parser.getJsonFileName().size() > 0)
+    {
+        QJsonObject json;
+        json.insert("test", "pipeline");
+        json.insert("date", QDateTime::currentDateTimeUtc().toString(Qt::ISODate));
+        json.insert("cpu", QSysInfo::currentCpuArchitecture());
+        json.insert("os", QSysInfo::prettyProductName());
+        json.insert("idealThreadCount", QThread::idealThreadCount());
+        json.insert("sampleRate", sampleRate);
+        json.insert("results", jsonResults);
+
+        QFile file(m_parser.getJsonFileName());
+
+        if (file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+        {
+            file.write(QJsonDocument(json).toJson());
+            qDebug("MainBench::testPipeline: results written to %s", qPrintable(m_parser.getJsonFileName()));
+        }
+        else
+        {
+            qWarning("MainBench::testPipeline: cannot write %s", qPrintable(m_parser.getJsonFileName()));
+        }
+    }
+}
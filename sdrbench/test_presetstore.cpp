@@ -0,0 +1,160 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QTemporaryDir>
+#include <QDir>
+#include <QFile>
+
+#include "settings/preset.h"
+#include "settings/presetstore.h"
+
+#include "mainbench.h"
+
+namespace {
+
+QByteArray channelConfig(int presetIndex, int size)
+{
+    QByteArray config(size, 0);
+
+    for (int i = 0; i < size; i++) {
+        config[i] = (char) ((presetIndex * 31 + i) & 0xff);
+    }
+
+    return config;
+}
+
+Preset *createPreset(int presetIndex, int configSize)
+{
+    Preset *preset = new Preset();
+    preset->setGroup(QString("group%1").arg(presetIndex % 10));
+    preset->setDescription(QString("preset%1").arg(presetIndex));
+    preset->setCenterFrequency(100000000 + presetIndex * 1000);
+    preset->addChannel("sdrangel.channel.nfmdemod", channelConfig(presetIndex, configSize));
+    return preset;
+}
+
+bool samePresets(const QList<Preset*>& presets1, const QList<Preset*>& presets2)
+{
+    if (presets1.size() != presets2.size()) {
+        return false;
+    }
+
+    for (int i = 0; i < presets1.size(); i++)
+    {
+        if (presets1[i]->serialize() != presets2[i]->serialize()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace
+
+void MainBench::testPresetStore()
+{
+    QElapsedTimer timer;
+    QTemporaryDir tempDir;
+    QString directory = tempDir.path() + "/presets";
+    const int nbPresets = 200;
+    const int configSize = 16384;
+    QList<Preset*> presets;
+    Preset workingPreset;
+
+    qDebug() << "MainBench::testPresetStore: create test data";
+
+    for (int i = 0; i < nbPresets; i++) {
+        presets.append(createPreset(i, configSize));
+    }
+
+    qDebug() << "MainBench::testPresetStore: run test";
+
+    PresetStore store;
+    store.setDirectory(directory);
+    timer.start();
+    bool saved = store.save(presets, workingPreset);
+    printResults("MainBench::testPresetStore: save all", timer.nsecsElapsed());
+
+    QList<Preset*> loadedPresets;
+    Preset loadedWorkingPreset;
+    PresetStore loadStore;
+    loadStore.setDirectory(directory);
+    timer.start();
+    bool loaded = loadStore.load(loadedPresets, loadedWorkingPreset);
+    printResults("MainBench::testPresetStore: load headers", timer.nsecsElapsed());
+
+    if (!saved || !loaded || !samePresets(presets, loadedPresets)) {
+        qWarning("MainBench::testPresetStore: presets differ after save and load");
+    }
+
+    // a change that keeps the size of the data must be written
+    QByteArray config = channelConfig(0, configSize);
+    config[configSize / 2] = ~config[configSize / 2];
+    loadedPresets[0]->clearChannels();
+    loadedPresets[0]->addChannel("sdrangel.channel.nfmdemod", config);
+    timer.start();
+    loadStore.save(loadedPresets, loadedWorkingPreset);
+    printResults("MainBench::testPresetStore: save one change", timer.nsecsElapsed());
+
+    QList<Preset*> reloadedPresets;
+    Preset reloadedWorkingPreset;
+    PresetStore reloadStore;
+    reloadStore.setDirectory(directory);
+    reloadStore.load(reloadedPresets, reloadedWorkingPreset);
+
+    if (!samePresets(loadedPresets, reloadedPresets)) {
+        qWarning("MainBench::testPresetStore: changed preset not written");
+    }
+
+    // a store with a corrupt index must be kept aside and not overwritten by the next save
+    QFile index(directory + "/index");
+    index.open(QIODevice::ReadWrite);
+    index.resize(index.size() / 2);
+    index.close();
+
+    QList<Preset*> corruptPresets;
+    Preset corruptWorkingPreset;
+    PresetStore corruptStore;
+    corruptStore.setDirectory(directory);
+    corruptStore.load(corruptPresets, corruptWorkingPreset);
+    QList<Preset*> newPresets;
+    newPresets.append(createPreset(nbPresets, configSize));
+    corruptStore.save(newPresets, corruptWorkingPreset);
+
+    QStringList backups = QDir(tempDir.path()).entryList(QStringList() << "presets.*.bak", QDir::Dirs);
+
+    if ((backups.size() != 1) || (QDir(tempDir.path() + "/" + backups[0]).entryList(QStringList() << "*.preset").size() < nbPresets)) {
+        qWarning("MainBench::testPresetStore: presets of the corrupt store were not backed up");
+    }
+
+    QList<Preset*> newLoadedPresets;
+    Preset newWorkingPreset;
+    PresetStore newStore;
+    newStore.setDirectory(directory);
+
+    if (!newStore.load(newLoadedPresets, newWorkingPreset) || !samePresets(newPresets, newLoadedPresets)) {
+        qWarning("MainBench::testPresetStore: new store differs after a corrupt store");
+    }
+
+    qDebug() << "MainBench::testPresetStore: cleanup test data";
+
+    for (auto list : {&presets, &loadedPresets, &reloadedPresets, &corruptPresets, &newPresets, &newLoadedPresets}) {
+        qDeleteAll(*list);
+    }
+}
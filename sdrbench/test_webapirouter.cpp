@@ -0,0 +1,196 @@
+///////////////////////////////////////////////////////////////////////////////////
+// Copyright (C) 2020 Edouard Griffiths, F4EXB                                   //
+//                                                                               //
+// This program is free software; you can redistribute it and/or modify          //
+// it under the terms of the GNU General Public License as published by          //
+// the Free Software Foundation as version 3 of the License, or                  //
+// (at your option) any later version.                                           //
+//                                                                               //
+// This program is distributed in the hope that it will be useful,               //
+// but WITHOUT ANY WARRANTY; without even the implied warranty of                //
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the                  //
+// GNU General Public License V3 for more details.                               //
+//                                                                               //
+// You should have received a copy of the GNU General Public License             //
+// along with this program. If not, see <http://www.gnu.org/licenses/>.          //
+///////////////////////////////////////////////////////////////////////////////////
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QByteArray>
+
+#include "webapi/webapiadapterinterface.h"
+#include "webapi/webapirouter.h"
+
+#include "mainbench.h"
+
+namespace {
+
+// Route resolution as done by WebAPIRequestMapper before the router: string compares then regexes
+WebAPIRouter::Route legacyRoute(const QByteArray& path, std::string& captures)
+{
+    static const std::vector<std::pair<WebAPIRouter::Route, const QString*>> urls = {
+        {WebAPIRouter::RouteInstanceSummary, &WebAPIAdapterInterface::instanceSummaryURL},
+        {WebAPIRouter::RouteInstanceConfig, &WebAPIAdapterInterface::instanceConfigURL},
+        {WebAPIRouter::RouteInstanceDevices, &WebAPIAdapterInterface::instanceDevicesURL},
+        {WebAPIRouter::RouteInstanceChannels, &WebAPIAdapterInterface::instanceChannelsURL},
+        {WebAPIRouter::RouteInstanceChannelsReport, &WebAPIAdapterInterface::instanceChannelsReportURL},
+        {WebAPIRouter::RouteInstanceChannelsSettings, &WebAPIAdapterInterface::instanceChannelsSettingsURL},
+        {WebAPIRouter::RouteInstanceLogging, &WebAPIAdapterInterface::instanceLoggingURL},
+        {WebAPIRouter::RouteInstanceAudio, &WebAPIAdapterInterface::instanceAudioURL},
+        {WebAPIRouter::RouteInstanceAudioInputParameters, &WebAPIAdapterInterface::instanceAudioInputParametersURL},
+        {WebAPIRouter::RouteInstanceAudioOutputParameters, &WebAPIAdapterInterface::instanceAudioOutputParametersURL},
+        {WebAPIRouter::RouteInstanceAudioInputCleanup, &WebAPIAdapterInterface::instanceAudioInputCleanupURL},
+        {WebAPIRouter::RouteInstanceAudioOutputCleanup, &WebAPIAdapterInterface::instanceAudioOutputCleanupURL},
+        {WebAPIRouter::RouteInstanceLocation, &WebAPIAdapterInterface::instanceLocationURL},
+        {WebAPIRouter::RouteInstanceAMBESerial, &WebAPIAdapterInterface::instanceAMBESerialURL},
+        {WebAPIRouter::RouteInstanceAMBEDevices, &WebAPIAdapterInterface::instanceAMBEDevicesURL},
+        {WebAPIRouter::RouteInstanceLimeRFESerial, &WebAPIAdapterInterface::instanceLimeRFESerialURL},
+        {WebAPIRouter::RouteInstanceLimeRFEConfig, &WebAPIAdapterInterface::instanceLimeRFEConfigURL},
+        {WebAPIRouter::RouteInstanceLimeRFERun, &WebAPIAdapterInterface::instanceLimeRFERunURL},
+        {WebAPIRouter::RouteInstanceLimeRFEPower, &WebAPIAdapterInterface::instanceLimeRFEPowerURL},
+        {WebAPIRouter::RouteInstancePresets, &WebAPIAdapterInterface::instancePresetsURL},
+        {WebAPIRouter::RouteInstancePreset, &WebAPIAdapterInterface::instancePresetURL},
+        {WebAPIRouter::RouteInstancePresetFile, &WebAPIAdapterInterface::instancePresetFileURL},
+        {WebAPIRouter::RouteInstanceDeviceSets, &WebAPIAdapterInterface::instanceDeviceSetsURL},
+        {WebAPIRouter::RouteInstanceDeviceSet, &WebAPIAdapterInterface::instanceDeviceSetURL}
+    };
+    static const std::vector<std::pair<WebAPIRouter::Route, const std::regex*>> regexes = {
+        {WebAPIRouter::RouteDeviceset, &WebAPIAdapterInterface::devicesetURLRe},
+        {WebAPIRouter::RouteDevicesetDevice, &WebAPIAdapterInterface::devicesetDeviceURLRe},
+        {WebAPIRouter::RouteDevicesetFocus, &WebAPIAdapterInterface::devicesetFocusURLRe},
+        {WebAPIRouter::RouteDevicesetDeviceSettings, &WebAPIAdapterInterface::devicesetDeviceSettingsURLRe},
+        {WebAPIRouter::RouteDevicesetDeviceRun, &WebAPIAdapterInterface::devicesetDeviceRunURLRe},
+        {WebAPIRouter::RouteDevicesetDeviceThreadPriority, &WebAPIAdapterInterface::devicesetDeviceThreadPriorityURLRe},
+        {WebAPIRouter::RouteDevicesetDeviceSubsystemRun, &WebAPIAdapterInterface::devicesetDeviceSubsystemRunURLRe},
+        {WebAPIRouter::RouteDevicesetDeviceReport, &WebAPIAdapterInterface::devicesetDeviceReportURLRe},
+        {WebAPIRouter::RouteDevicesetDeviceActions, &WebAPIAdapterInterface::devicesetDeviceActionsURLRe},
+        {WebAPIRouter::RouteDevicesetChannelsReport, &WebAPIAdapterInterface::devicesetChannelsReportURLRe},
+        {WebAPIRouter::RouteDevicesetChannel, &WebAPIAdapterInterface::devicesetChannelURLRe},
+        {WebAPIRouter::RouteDevicesetChannelIndex, &WebAPIAdapterInterface::devicesetChannelIndexURLRe},
+        {WebAPIRouter::RouteDevicesetChannelSettings, &WebAPIAdapterInterface::devicesetChannelSettingsURLRe},
+        {WebAPIRouter::RouteDevicesetChannelReport, &WebAPIAdapterInterface::devicesetChannelReportURLRe},
+        {WebAPIRouter::RouteDevicesetChannelActions, &WebAPIAdapterInterface::devicesetChannelActionsURLRe}
+    };
+
+    captures.clear();
+
+    for (const auto& url : urls)
+    {
+        if (path == *url.second) {
+            return url.first;
+        }
+    }
+
+    std::smatch desc_match;
+    std::string pathStr(path.constData(), path.length());
+
+    for (const auto& regex : regexes)
+    {
+        if (std::regex_match(pathStr, desc_match, *regex.second))
+        {
+            for (std::size_t i = 1; i < desc_match.size(); i++) {
+                captures += "/" + std::string(desc_match[i]);
+            }
+
+            return regex.first;
+        }
+    }
+
+    return WebAPIRouter::RouteNone;
+}
+
+}
+
+void MainBench::testWebAPIRouter()
+{
+    QElapsedTimer timer;
+    qint64 nsecsRouter = 0;
+    qint64 nsecsLegacy = 0;
+
+    qDebug() << "MainBench::testWebAPIRouter: create test data";
+
+    // expand the full route table with random indexes plus some paths served as static pages
+    WebAPIRouter router;
+    const WebAPIRouter::RouteTable& routeTable = WebAPIRouter::getRouteTable();
+    std::uniform_int_distribution<int> indexDistribution(0, 99);
+    std::vector<QByteArray> paths;
+
+    for (const auto& route : routeTable)
+    {
+        std::string pattern = route.second;
+        std::string path;
+        std::size_t i = 0;
+
+        while (i < pattern.size())
+        {
+            if (pattern[i] == '{')
+            {
+                path += std::to_string(indexDistribution(m_generator));
+                i = pattern.find('}', i) + 1;
+            }
+            else
+            {
+                path += pattern[i++];
+            }
+        }
+
+        paths.push_back(QByteArray(path.c_str()));
+    }
+
+    paths.push_back("/index.html");
+    paths.push_back("/doc/swagger/swagger.yaml");
+    paths.push_back("/sdrangel/deviceset/100/channel/0/report");
+
+    qDebug() << "MainBench::testWebAPIRouter: check routes";
+
+    for (const auto& path : paths)
+    {
+        WebAPIRouter::Match match;
+        std::string legacyCaptures, routerCaptures;
+        WebAPIRouter::Route legacy = legacyRoute(path, legacyCaptures);
+        WebAPIRouter::Route route = router.match(path.constData(), path.length(), match);
+
+        for (int i = 0; i < match.m_nbCaptures; i++) {
+            routerCaptures += "/" + match.getCapture(i);
+        }
+
+        if ((route != legacy) || (routerCaptures != legacyCaptures)) {
+            qWarning("MainBench::testWebAPIRouter: mismatch on %s: %d vs %d", path.constData(), (int) route, (int) legacy);
+        }
+    }
+
+    qDebug() << "MainBench::testWebAPIRouter: run test";
+    uint32_t nbLookups = m_parser.getNbSamples();
+    int nbRoutes = 0;
+
+    for (uint32_t i = 0; i < m_parser.getRepetition(); i++)
+    {
+        timer.start();
+
+        for (uint32_t j = 0; j < nbLookups; j++)
+        {
+            WebAPIRouter::Match match;
+            const QByteArray& path = paths[j % paths.size()];
+            nbRoutes += router.match(path.constData(), path.length(), match) != WebAPIRouter::RouteNone;
+        }
+
+        nsecsRouter += timer.nsecsElapsed();
+        timer.start();
+
+        for (uint32_t j = 0; j < nbLookups; j++)
+        {
+            std::string captures;
+            nbRoutes -= legacyRoute(paths[j % paths.size()], captures) != WebAPIRouter::RouteNone;
+        }
+
+        nsecsLegacy += timer.nsecsElapsed();
+    }
+
+    if (nbRoutes != 0) {
+        qWarning("MainBench::testWebAPIRouter: router and legacy matched a different number of routes");
+    }
+
+    printResults("MainBench::testWebAPIRouter: router", nsecsRouter);
+    printResults("MainBench::testWebAPIRouter: legacy", nsecsLegacy);
+}
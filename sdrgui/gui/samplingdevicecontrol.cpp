@@ -95,6 +95,11 @@ void SamplingDeviceControl::removeSelectedDeviceIndex()
         DeviceEnumerator::instance()->removeTxSelection(m_deviceTabIndex);
         ui->deviceSelectedText->setText("None");
     }
+    else if (m_deviceType == 2) // MIMO
+    {
+        DeviceEnumerator::instance()->removeMIMOSelection(m_deviceTabIndex);
+        ui->deviceSelectedText->setText("None");
+    }
 
     m_selectedDeviceIndex = -1;
 }
@@ -100,6 +100,16 @@ public:
 		}
 	}
 
+	void setSampleValues(int column, const int *values, int count)
+	{
+		int start = column < -2 ? -2 : column;
+		int end = column + count > m_width - 2 ? m_width - 2 : column + count;
+
+		if (end > start) {
+			std::copy(values + (start - column), values + (end - column), m_currentLine + start + 2);
+		}
+	}
+
 private:
 	int m_width;
 	int m_height;
@@ -68,6 +68,7 @@
 #include "webapi/webapirequestmapper.h"
 #include "webapi/webapiserver.h"
 #include "webapi/webapiadaptergui.h"
+#include "websockets/wschannelreports.h"
 #include "commands/command.h"
 
 #include "mainwindow.h"
@@ -190,17 +191,30 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
     splash->showStatusMessage("allocate FFTs...", Qt::white);
     splash->showStatusMessage("allocate FFTs...", Qt::white);
     m_dspEngine->createFFTFactory(parser.getFFTWFWisdomFileName());
+    m_dspEngine->setChannelIdle(parser.getChannelIdle());
+
+    if (parser.getFFTAutoTune()) {
+        m_dspEngine->getFFTFactory()->setAutoTune(QFileInfo(m_settings.getFileLocation()).absolutePath() + "/fftengines.cache");
+    }
+
     m_dspEngine->preAllocateFFTs();
 
     splash->showStatusMessage("load settings...", Qt::white);
     qDebug() << "MainWindow::MainWindow: load settings...";
 
 	loadSettings();
+	applyThreadPrioritySettings(parser);
 
     splash->showStatusMessage("load plugins...", Qt::white);
     qDebug() << "MainWindow::MainWindow: load plugins...";
 
     m_pluginManager = new PluginManager(this);
+    DeviceEnumerator::instance()->setEnumerationFilter(parser.getDeviceHardwareIds());
+
+    if (parser.getDevicesCache()) {
+        DeviceEnumerator::instance()->setEnumerationCacheFile(QFileInfo(m_settings.getFileLocation()).absolutePath() + "/devices.cache");
+    }
+
     m_pluginManager->loadPlugins(QString("plugins"));
     m_pluginManager->loadPluginsNonDiscoverable(m_settings.getDeviceUserArgs());
 
@@ -237,11 +251,20 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
 	m_apiAdapter = new WebAPIAdapterGUI(*this);
 	m_requestMapper = new WebAPIRequestMapper(this);
 	m_requestMapper->setAdapter(m_apiAdapter);
+	m_requestMapper->setMetricsPath(parser.getMetricsPath());
 	m_apiHost = parser.getServerAddress();
 	m_apiPort = parser.getServerPort();
 	m_apiServer = new WebAPIServer(m_apiHost, m_apiPort, m_requestMapper);
 	m_apiServer->start();
 
+	m_wsChannelReports = new WSChannelReports(m_apiAdapter, this);
+	m_wsChannelReports->setListeningAddress(m_apiHost);
+	m_wsChannelReports->setPort(parser.getWSReportsPort());
+
+	if (parser.getWSReportsPort() != 0) {
+		m_wsChannelReports->openSocket();
+	}
+
 	m_commandKeyReceiver = new CommandKeyReceiver();
 	m_commandKeyReceiver->setRelease(true);
 	this->installEventFilter(m_commandKeyReceiver);
@@ -267,6 +290,7 @@ MainWindow::MainWindow(qtwebapp::LoggerWithFile *logger, const MainParser& parse
 MainWindow::~MainWindow()
 {
     m_apiServer->stop();
+    delete m_wsChannelReports;
     delete m_apiServer;
     delete m_requestMapper;
     delete m_apiAdapter;
@@ -296,6 +320,7 @@ void MainWindow::addSourceDevice(int deviceIndex)
     m_deviceUIs.back()->m_deviceSourceEngine = dspDeviceSourceEngine;
     m_deviceUIs.back()->m_deviceSinkEngine = nullptr;
     m_deviceUIs.back()->m_deviceMIMOEngine = nullptr;
+    dspDeviceSourceEngine->getInputMessageQueue()->push(new DSPConfigureThreadPriority(deviceTabIndex));
 
     char tabNameCStr[16];
     sprintf(tabNameCStr, "R%d", deviceTabIndex);
@@ -378,6 +403,7 @@ void MainWindow::addSinkDevice()
     m_deviceUIs.back()->m_deviceSourceEngine = nullptr;
     m_deviceUIs.back()->m_deviceSinkEngine = dspDeviceSinkEngine;
     m_deviceUIs.back()->m_deviceMIMOEngine = nullptr;
+    dspDeviceSinkEngine->getInputMessageQueue()->push(new DSPConfigureThreadPriority(deviceTabIndex));
 
     char tabNameCStr[16];
     sprintf(tabNameCStr, "T%d", deviceTabIndex);
@@ -443,6 +469,96 @@ void MainWindow::addSinkDevice()
     setDeviceGUI(deviceTabIndex, gui, m_deviceUIs.back()->m_deviceAPI->getSamplingDeviceDisplayName(), 1);
 }
 
+void MainWindow::addMIMODevice()
+{
+    int testMIMODeviceIndex = DeviceEnumerator::instance()->getTestMIMODeviceIndex();
+
+    if (testMIMODeviceIndex < 0)
+    {
+        qWarning("MainWindow::addMIMODevice: no test MIMO device available. MIMO device set not created");
+        return;
+    }
+
+    DSPDeviceMIMOEngine *dspDeviceMIMOEngine = m_dspEngine->addDeviceMIMOEngine();
+    dspDeviceMIMOEngine->start();
+
+    uint dspDeviceMIMOEngineUID =  dspDeviceMIMOEngine->getUID();
+    char uidCStr[16];
+    sprintf(uidCStr, "UID:%d", dspDeviceMIMOEngineUID);
+
+    int deviceTabIndex = m_deviceUIs.size();
+    m_deviceUIs.push_back(new DeviceUISet(deviceTabIndex, 2, m_masterTimer));
+    m_deviceUIs.back()->m_deviceSourceEngine = nullptr;
+    m_deviceUIs.back()->m_deviceSinkEngine = nullptr;
+    m_deviceUIs.back()->m_deviceMIMOEngine = dspDeviceMIMOEngine;
+    dspDeviceMIMOEngine->getInputMessageQueue()->push(new DSPConfigureThreadPriority(deviceTabIndex));
+
+    char tabNameCStr[16];
+    sprintf(tabNameCStr, "M%d", deviceTabIndex);
+
+    DeviceAPI *deviceAPI = new DeviceAPI(DeviceAPI::StreamMIMO, deviceTabIndex, nullptr, nullptr, dspDeviceMIMOEngine);
+
+    m_deviceUIs.back()->m_deviceAPI = deviceAPI;
+    m_deviceUIs.back()->m_samplingDeviceControl->setPluginManager(m_pluginManager);
+    // Rx channels on any single stream then MIMO channels on all the streams
+    QList<QString> rxChannelNames;
+    m_pluginManager->listRxChannels(rxChannelNames);
+    QStringList rxChannelNamesList(rxChannelNames);
+    m_deviceUIs.back()->m_samplingDeviceControl->getChannelSelector()->addItems(rxChannelNamesList);
+    m_deviceUIs.back()->setNumberOfAvailableRxChannels(rxChannelNamesList.size());
+    m_deviceUIs.back()->setNumberOfAvailableTxChannels(0);
+    QList<QString> mimoChannelNames;
+    m_pluginManager->listMIMOChannels(mimoChannelNames);
+    QStringList mimoChannelNamesList(mimoChannelNames);
+    m_deviceUIs.back()->m_samplingDeviceControl->getChannelSelector()->addItems(mimoChannelNamesList);
+    m_deviceUIs.back()->setNumberOfAvailableMIMOChannels(mimoChannelNamesList.size());
+
+    connect(m_deviceUIs.back()->m_samplingDeviceControl->getAddChannelButton(), SIGNAL(clicked(bool)), this, SLOT(channelAddClicked(bool)));
+
+    dspDeviceMIMOEngine->addSpectrumSink(m_deviceUIs.back()->m_spectrumVis);
+    dspDeviceMIMOEngine->setSpectrumSinkInput(true, 0);
+    ui->tabSpectra->addTab(m_deviceUIs.back()->m_spectrum, tabNameCStr);
+    ui->tabSpectraGUI->addTab(m_deviceUIs.back()->m_spectrumGUI, tabNameCStr);
+    ui->tabChannels->addTab(m_deviceUIs.back()->m_channelWindow, tabNameCStr);
+
+    connect(m_deviceUIs.back()->m_samplingDeviceControl, SIGNAL(changed()), this, SLOT(sampleMIMOChanged()));
+
+    ui->tabInputsSelect->addTab(m_deviceUIs.back()->m_samplingDeviceControl, tabNameCStr);
+    ui->tabInputsSelect->setTabToolTip(deviceTabIndex, QString(uidCStr));
+
+    // create a test MIMO by default
+    const PluginInterface::SamplingDevice *samplingDevice = DeviceEnumerator::instance()->getMIMOSamplingDevice(testMIMODeviceIndex);
+    m_deviceUIs.back()->m_deviceAPI->setSamplingDeviceSequence(samplingDevice->sequence);
+    m_deviceUIs.back()->m_deviceAPI->setDeviceNbItems(samplingDevice->deviceNbItems);
+    m_deviceUIs.back()->m_deviceAPI->setDeviceItemIndex(samplingDevice->deviceItemIndex);
+    m_deviceUIs.back()->m_deviceAPI->setHardwareId(samplingDevice->hardwareId);
+    m_deviceUIs.back()->m_deviceAPI->setSamplingDeviceId(samplingDevice->id);
+    m_deviceUIs.back()->m_deviceAPI->setSamplingDeviceSerial(samplingDevice->serial);
+    m_deviceUIs.back()->m_deviceAPI->setSamplingDeviceDisplayName(samplingDevice->displayedName);
+    m_deviceUIs.back()->m_deviceAPI->setSamplingDevicePluginInterface(DeviceEnumerator::instance()->getMIMOPluginInterface(testMIMODeviceIndex));
+
+    QString userArgs = m_settings.getDeviceUserArgs().findUserArgs(samplingDevice->hardwareId, samplingDevice->sequence);
+
+    if (userArgs.size() > 0) {
+        m_deviceUIs.back()->m_deviceAPI->setHardwareUserArguments(userArgs);
+    }
+
+    m_deviceUIs.back()->m_samplingDeviceControl->setSelectedDeviceIndex(testMIMODeviceIndex);
+
+    DeviceSampleMIMO *mimo = m_deviceUIs.back()->m_deviceAPI->getPluginInterface()->createSampleMIMOPluginInstance(
+            m_deviceUIs.back()->m_deviceAPI->getSamplingDeviceId(), m_deviceUIs.back()->m_deviceAPI);
+    m_deviceUIs.back()->m_deviceAPI->setSampleMIMO(mimo);
+    QWidget *gui;
+    PluginInstanceGUI *pluginGUI = m_deviceUIs.back()->m_deviceAPI->getPluginInterface()->createSampleMIMOPluginInstanceGUI(
+            m_deviceUIs.back()->m_deviceAPI->getSamplingDeviceId(),
+            &gui,
+            m_deviceUIs.back());
+    m_deviceUIs.back()->m_deviceAPI->getSampleMIMO()->setMessageQueueToGUI(pluginGUI->getInputMessageQueue());
+    m_deviceUIs.back()->m_deviceAPI->setSamplingDevicePluginInstanceGUI(pluginGUI);
+    m_deviceUIs.back()->m_deviceAPI->getSampleMIMO()->init();
+    setDeviceGUI(deviceTabIndex, gui, m_deviceUIs.back()->m_deviceAPI->getSamplingDeviceDisplayName(), 2);
+}
+
 void MainWindow::removeLastDevice()
 {
 	if (m_deviceUIs.back()->m_deviceSourceEngine) // source tab
@@ -938,6 +1054,8 @@ bool MainWindow::handleMessage(const Message& cmd)
             addSinkDevice();
         } else if (direction == 0) { // Single stream Rx
             addSourceDevice(-1); // create with file source device by default
+        } else if ((direction == 2) && m_dspEngine->getMIMOSupport()) { // MIMO
+            addMIMODevice();
         }
 
         return true;
@@ -1889,7 +2007,7 @@ void MainWindow::sampleMIMOChanged()
         deviceUI->m_deviceAPI->getSampleMIMO()->setMessageQueueToGUI(pluginUI->getInputMessageQueue());
         deviceUI->m_deviceAPI->setSamplingDevicePluginInstanceGUI(pluginUI);
         setDeviceGUI(currentMIMOTabIndex, gui, deviceUI->m_deviceAPI->getSamplingDeviceDisplayName(), 2);
-        m_deviceUIs.back()->m_deviceAPI->getSampleMIMO()->init();
+        deviceUI->m_deviceAPI->getSampleMIMO()->init();
 
         deviceUI->m_deviceAPI->loadSamplingDeviceSettings(m_settings.getWorkingPreset()); // load new API settings
     }
@@ -1929,6 +2047,9 @@ void MainWindow::channelAddClicked(bool checked)
             } else if (selectedIndex < nbRxChannels + nbTxChannels) {
                 m_pluginManager->createTxChannelInstance(
                     selectedIndex - nbRxChannels, deviceUI, deviceUI->m_deviceAPI);
+            } else {
+                m_pluginManager->createMIMOChannelInstance(
+                    selectedIndex - nbRxChannels - nbTxChannels, deviceUI, deviceUI->m_deviceAPI);
             }
         }
     }
@@ -1952,7 +2073,11 @@ void MainWindow::on_action_addSinkDevice_triggered()
 
 void MainWindow::on_action_addMIMODevice_triggered()
 {
-    QMessageBox::information(this, tr("Message"), tr("MIMO not supported in this version"));
+    if (m_dspEngine->getMIMOSupport()) {
+        addMIMODevice();
+    } else {
+        QMessageBox::information(this, tr("Message"), tr("MIMO not supported in this version"));
+    }
 }
 
 void MainWindow::on_action_removeLastDevice_triggered()
@@ -1987,6 +2112,25 @@ void MainWindow::updateStatus()
     m_dateTimeWidget->setText(QDateTime::currentDateTime().toString("yyyy-MM-dd HH:mm:ss t"));
 }
 
+void MainWindow::applyThreadPrioritySettings(const MainParser& parser)
+{
+    const QMap<int, ThreadPriority::Settings>& preferences = m_settings.getThreadPrioritySettings();
+
+    for (QMap<int, ThreadPriority::Settings>::const_iterator it = preferences.begin(); it != preferences.end(); ++it) {
+        m_dspEngine->setThreadPrioritySettings(it.key(), it.value());
+    }
+
+    // command line takes precedence over preferences and is not saved
+    const QMap<int, ThreadPriority::Settings>& commandLine = parser.getThreadPrioritySettings();
+
+    for (QMap<int, ThreadPriority::Settings>::const_iterator it = commandLine.begin(); it != commandLine.end(); ++it) {
+        m_dspEngine->setThreadPrioritySettings(it.key(), it.value());
+    }
+
+    // threads created from now on inherit the main thread affinity
+    ThreadPriority::isolateCPUs(m_dspEngine->getIsolatedCPUs());
+}
+
 void MainWindow::setLoggingOptions()
 {
     m_logger->setConsoleMinMessageLevel(m_settings.getConsoleMinLogLevel());
@@ -50,6 +50,7 @@ class QWidget;
 class WebAPIRequestMapper;
 class WebAPIServer;
 class WebAPIAdapterGUI;
+class WSChannelReports;
 class Preset;
 class Command;
 class CommandKeyReceiver;
@@ -341,6 +342,7 @@ private:
 	WebAPIRequestMapper *m_requestMapper;
 	WebAPIServer *m_apiServer;
 	WebAPIAdapterGUI *m_apiAdapter;
+	WSChannelReports *m_wsChannelReports;
 	QString m_apiHost;
 	int m_apiPort;
 
@@ -360,10 +362,12 @@ private:
 
 	void addSourceDevice(int deviceIndex);
 	void addSinkDevice();
+    void addMIMODevice();
     void removeLastDevice();
     void deleteChannel(int deviceSetIndex, int channelIndex);
 
     void setLoggingOptions();
+    void applyThreadPrioritySettings(const MainParser& parser);
 
     bool handleMessage(const Message& cmd);
 
@@ -20,11 +20,13 @@
 #include <QDebug>
 #include <QSysInfo>
 #include <QResource>
+#include <QFileInfo>
 
 #include "dsp/dspengine.h"
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
+#include "dsp/dspcommands.h"
 #include "device/deviceapi.h"
 #include "device/deviceset.h"
 #include "device/deviceenumerator.h"
@@ -33,6 +35,7 @@
 #include "webapi/webapirequestmapper.h"
 #include "webapi/webapiserver.h"
 #include "webapi/webapiadaptersrv.h"
+#include "websockets/wschannelreports.h"
 
 #include "maincore.h"
 
@@ -65,9 +68,20 @@ MainCore::MainCore(qtwebapp::LoggerWithFile *logger, const MainParser& parser, Q
 
     qDebug() << "MainCore::MainCore: create FFT factory...";
     m_dspEngine->createFFTFactory(parser.getFFTWFWisdomFileName());
+    m_dspEngine->setChannelIdle(parser.getChannelIdle());
+
+    if (parser.getFFTAutoTune()) {
+        m_dspEngine->getFFTFactory()->setAutoTune(QFileInfo(m_settings.getFileLocation()).absolutePath() + "/fftengines.cache");
+    }
 
     qDebug() << "MainCore::MainCore: load plugins...";
     m_pluginManager = new PluginManager(this);
+    DeviceEnumerator::instance()->setEnumerationFilter(parser.getDeviceHardwareIds());
+
+    if (parser.getDevicesCache()) {
+        DeviceEnumerator::instance()->setEnumerationCacheFile(QFileInfo(m_settings.getFileLocation()).absolutePath() + "/devicessrv.cache");
+    }
+
     m_pluginManager->loadPlugins(QString("pluginssrv"));
 
     connect(&m_inputMessageQueue, SIGNAL(messageEnqueued()), this, SLOT(handleMessages()), Qt::QueuedConnection);
@@ -76,15 +90,27 @@ MainCore::MainCore(qtwebapp::LoggerWithFile *logger, const MainParser& parser, Q
     qDebug() << "MainCore::MainCore: load setings...";
 	loadSettings();
 
+    qDebug() << "MainCore::MainCore: apply DSP threads priority...";
+    applyThreadPrioritySettings(parser);
+
     qDebug() << "MainCore::MainCore: finishing...";
     QString applicationDirPath = QCoreApplication::instance()->applicationDirPath();
 
     m_apiAdapter = new WebAPIAdapterSrv(*this);
     m_requestMapper = new WebAPIRequestMapper(this);
     m_requestMapper->setAdapter(m_apiAdapter);
+    m_requestMapper->setMetricsPath(parser.getMetricsPath());
     m_apiServer = new WebAPIServer(parser.getServerAddress(), parser.getServerPort(), m_requestMapper);
     m_apiServer->start();
 
+    m_wsChannelReports = new WSChannelReports(m_apiAdapter, this);
+    m_wsChannelReports->setListeningAddress(parser.getServerAddress());
+    m_wsChannelReports->setPort(parser.getWSReportsPort());
+
+    if (parser.getWSReportsPort() != 0) {
+        m_wsChannelReports->openSocket();
+    }
+
     m_dspEngine->setMIMOSupport(parser.getMIMOSupport());
 
     qDebug() << "MainCore::MainCore: end";
@@ -98,6 +124,7 @@ MainCore::~MainCore()
 
 	m_apiServer->stop();
 	m_settings.save();
+    delete m_wsChannelReports;
     delete m_apiServer;
     delete m_requestMapper;
     delete m_apiAdapter;
@@ -151,6 +178,8 @@ bool MainCore::handleMessage(const Message& cmd)
             addSinkDevice();
         } else if (direction == 0) { // Single stream Rx
             addSourceDevice();
+        } else if ((direction == 2) && m_dspEngine->getMIMOSupport()) { // MIMO
+            addMIMODevice();
         }
 
         return true;
@@ -226,6 +255,25 @@ void MainCore::applySettings()
     setLoggingOptions();
 }
 
+void MainCore::applyThreadPrioritySettings(const MainParser& parser)
+{
+    const QMap<int, ThreadPriority::Settings>& preferences = m_settings.getThreadPrioritySettings();
+
+    for (QMap<int, ThreadPriority::Settings>::const_iterator it = preferences.begin(); it != preferences.end(); ++it) {
+        m_dspEngine->setThreadPrioritySettings(it.key(), it.value());
+    }
+
+    // command line takes precedence over preferences and is not saved
+    const QMap<int, ThreadPriority::Settings>& commandLine = parser.getThreadPrioritySettings();
+
+    for (QMap<int, ThreadPriority::Settings>::const_iterator it = commandLine.begin(); it != commandLine.end(); ++it) {
+        m_dspEngine->setThreadPrioritySettings(it.key(), it.value());
+    }
+
+    // threads created from now on inherit the main thread affinity
+    ThreadPriority::isolateCPUs(m_dspEngine->getIsolatedCPUs());
+}
+
 void MainCore::setLoggingOptions()
 {
     m_logger->setConsoleMinMessageLevel(m_settings.getConsoleMinLogLevel());
@@ -289,6 +337,7 @@ void MainCore::addSinkDevice()
     m_deviceSets.back()->m_deviceSourceEngine = nullptr;
     m_deviceSets.back()->m_deviceSinkEngine = dspDeviceSinkEngine;
     m_deviceSets.back()->m_deviceMIMOEngine = nullptr;
+    dspDeviceSinkEngine->getInputMessageQueue()->push(new DSPConfigureThreadPriority(deviceTabIndex));
 
     char tabNameCStr[16];
     sprintf(tabNameCStr, "T%d", deviceTabIndex);
@@ -335,6 +384,7 @@ void MainCore::addSourceDevice()
     m_deviceSets.back()->m_deviceSourceEngine = dspDeviceSourceEngine;
     m_deviceSets.back()->m_deviceSinkEngine = nullptr;
     m_deviceSets.back()->m_deviceMIMOEngine = nullptr;
+    dspDeviceSourceEngine->getInputMessageQueue()->push(new DSPConfigureThreadPriority(deviceTabIndex));
 
     char tabNameCStr[16];
     sprintf(tabNameCStr, "R%d", deviceTabIndex);
@@ -366,6 +416,59 @@ void MainCore::addSourceDevice()
     m_deviceSets.back()->m_deviceAPI->setSampleSource(source);
 }
 
+void MainCore::addMIMODevice()
+{
+    int testMIMODeviceIndex = DeviceEnumerator::instance()->getTestMIMODeviceIndex();
+
+    if (testMIMODeviceIndex < 0)
+    {
+        qWarning("MainCore::addMIMODevice: no test MIMO device available. MIMO device set not created");
+        return;
+    }
+
+    DSPDeviceMIMOEngine *dspDeviceMIMOEngine = m_dspEngine->addDeviceMIMOEngine();
+    dspDeviceMIMOEngine->start();
+
+    uint dspDeviceMIMOEngineUID =  dspDeviceMIMOEngine->getUID();
+    char uidCStr[16];
+    sprintf(uidCStr, "UID:%d", dspDeviceMIMOEngineUID);
+
+    int deviceTabIndex = m_deviceSets.size();
+    m_deviceSets.push_back(new DeviceSet(deviceTabIndex));
+    m_deviceSets.back()->m_deviceSourceEngine = nullptr;
+    m_deviceSets.back()->m_deviceSinkEngine = nullptr;
+    m_deviceSets.back()->m_deviceMIMOEngine = dspDeviceMIMOEngine;
+    dspDeviceMIMOEngine->getInputMessageQueue()->push(new DSPConfigureThreadPriority(deviceTabIndex));
+
+    char tabNameCStr[16];
+    sprintf(tabNameCStr, "M%d", deviceTabIndex);
+
+    DeviceAPI *deviceAPI = new DeviceAPI(DeviceAPI::StreamMIMO, deviceTabIndex, nullptr, nullptr, dspDeviceMIMOEngine);
+
+    m_deviceSets.back()->m_deviceAPI = deviceAPI;
+
+    // create a test MIMO by default
+    const PluginInterface::SamplingDevice *samplingDevice = DeviceEnumerator::instance()->getMIMOSamplingDevice(testMIMODeviceIndex);
+    m_deviceSets.back()->m_deviceAPI->setSamplingDeviceSequence(samplingDevice->sequence);
+    m_deviceSets.back()->m_deviceAPI->setDeviceNbItems(samplingDevice->deviceNbItems);
+    m_deviceSets.back()->m_deviceAPI->setDeviceItemIndex(samplingDevice->deviceItemIndex);
+    m_deviceSets.back()->m_deviceAPI->setHardwareId(samplingDevice->hardwareId);
+    m_deviceSets.back()->m_deviceAPI->setSamplingDeviceId(samplingDevice->id);
+    m_deviceSets.back()->m_deviceAPI->setSamplingDeviceSerial(samplingDevice->serial);
+    m_deviceSets.back()->m_deviceAPI->setSamplingDeviceDisplayName(samplingDevice->displayedName);
+    m_deviceSets.back()->m_deviceAPI->setSamplingDevicePluginInterface(DeviceEnumerator::instance()->getMIMOPluginInterface(testMIMODeviceIndex));
+
+    QString userArgs = m_settings.getDeviceUserArgs().findUserArgs(samplingDevice->hardwareId, samplingDevice->sequence);
+
+    if (userArgs.size() > 0) {
+        m_deviceSets.back()->m_deviceAPI->setHardwareUserArguments(userArgs);
+    }
+
+    DeviceSampleMIMO *mimo = m_deviceSets.back()->m_deviceAPI->getPluginInterface()->createSampleMIMOPluginInstance(
+            m_deviceSets.back()->m_deviceAPI->getSamplingDeviceId(), m_deviceSets.back()->m_deviceAPI);
+    m_deviceSets.back()->m_deviceAPI->setSampleMIMO(mimo);
+}
+
 void MainCore::removeLastDevice()
 {
     if (m_deviceSets.back()->m_deviceSourceEngine) // source set
@@ -408,6 +511,26 @@ void MainCore::removeLastDevice()
 
         delete sinkAPI;
     }
+    else if (m_deviceSets.back()->m_deviceMIMOEngine) // MIMO set
+    {
+        DSPDeviceMIMOEngine *lastDeviceEngine = m_deviceSets.back()->m_deviceMIMOEngine;
+        lastDeviceEngine->stopProcess(1); // Tx side
+        lastDeviceEngine->stopProcess(0); // Rx side
+
+        // deletes old MIMO object
+        m_deviceSets.back()->freeChannels();
+        m_deviceSets.back()->m_deviceAPI->resetSamplingDeviceId();
+        m_deviceSets.back()->m_deviceAPI->getPluginInterface()->deleteSampleMIMOPluginInstanceMIMO(
+                m_deviceSets.back()->m_deviceAPI->getSampleMIMO());
+
+        DeviceAPI *mimoAPI = m_deviceSets.back()->m_deviceAPI;
+        delete m_deviceSets.back();
+
+        lastDeviceEngine->stop();
+        m_dspEngine->removeLastDeviceMIMOEngine();
+
+        delete mimoAPI;
+    }
 
     m_deviceSets.pop_back();
 }
@@ -631,6 +754,10 @@ void MainCore::addChannel(int deviceSetIndex, int selectedChannelIndex)
         {
             deviceSet->addTxChannel(selectedChannelIndex, m_pluginManager->getPluginAPI());
         }
+        else if (deviceSet->m_deviceMIMOEngine) // MIMO device => MIMO channels
+        {
+            deviceSet->addMIMOChannel(selectedChannelIndex, m_pluginManager->getPluginAPI());
+        }
     }
 }
 
@@ -40,6 +40,7 @@ class DeviceSet;
 class WebAPIRequestMapper;
 class WebAPIServer;
 class WebAPIAdapterSrv;
+class WSChannelReports;
 
 namespace qtwebapp {
     class LoggerWithFile;
@@ -61,6 +62,7 @@ public:
 
     void addSourceDevice();
     void addSinkDevice();
+    void addMIMODevice();
     void removeLastDevice();
     void changeSampleSource(int deviceSetIndex, int selectedDeviceIndex);
     void changeSampleSink(int deviceSetIndex, int selectedDeviceIndex);
@@ -297,12 +299,14 @@ private:
     WebAPIRequestMapper *m_requestMapper;
     WebAPIServer *m_apiServer;
     WebAPIAdapterSrv *m_apiAdapter;
+    WSChannelReports *m_wsChannelReports;
 
 	void loadSettings();
     void applySettings();
 	void loadPresetSettings(const Preset* preset, int tabIndex);
 	void savePresetSettings(Preset* preset, int tabIndex);
     void setLoggingOptions();
+    void applyThreadPrioritySettings(const MainParser& parser);
 
     bool handleMessage(const Message& cmd);
 
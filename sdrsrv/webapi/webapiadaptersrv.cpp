@@ -43,6 +43,7 @@
 #include "SWGChannelActions.h"
 #include "SWGSuccessResponse.h"
 #include "SWGErrorResponse.h"
+#include "SWGThreadPrioritySettings.h"
 #include "SWGDeviceState.h"
 #include "SWGDeviceReport.h"
 #include "SWGLimeRFEDevices.h"
@@ -60,6 +61,7 @@
 #include "dsp/dspdevicesourceengine.h"
 #include "dsp/dspdevicesinkengine.h"
 #include "dsp/dspdevicemimoengine.h"
+#include "dsp/dspcommands.h"
 #include "dsp/dspengine.h"
 #include "channel/channelapi.h"
 #include "plugin/pluginapi.h"
@@ -1854,6 +1856,90 @@ int WebAPIAdapterSrv::devicesetDeviceSettingsPutPatch(
     }
 }
 
+int WebAPIAdapterSrv::devicesetDeviceThreadPriorityGet(
+        int deviceSetIndex,
+        SWGSDRangel::SWGThreadPrioritySettings& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DSPEngine *dspEngine = DSPEngine::instance();
+        WebAPIAdapterBase::webapiFormatThreadPriority(
+            &response,
+            dspEngine->getThreadPrioritySettings(deviceSetIndex),
+            dspEngine->getThreadPriorityStatus(deviceSetIndex, ThreadPriority::RoleEngine),
+            dspEngine->getThreadPriorityStatus(deviceSetIndex, ThreadPriority::RoleWorker)
+        );
+        return 200;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
+int WebAPIAdapterSrv::devicesetDeviceThreadPriorityPutPatch(
+        int deviceSetIndex,
+        bool force,
+        const QStringList& threadPriorityKeys,
+        SWGSDRangel::SWGThreadPrioritySettings& response,
+        SWGSDRangel::SWGErrorResponse& error)
+{
+    error.init();
+
+    if ((deviceSetIndex >= 0) && (deviceSetIndex < (int) m_mainCore.m_deviceSets.size()))
+    {
+        DSPEngine *dspEngine = DSPEngine::instance();
+        ThreadPriority::Settings settings = dspEngine->getThreadPrioritySettings(deviceSetIndex);
+        QList<int> isolatedCPUs = dspEngine->getIsolatedCPUs();
+
+        if (!WebAPIAdapterBase::webapiUpdateThreadPriority(force, &response, threadPriorityKeys, settings, *error.getMessage())) {
+            return 400;
+        }
+
+        m_mainCore.m_settings.setThreadPrioritySettings(deviceSetIndex, settings);
+        dspEngine->setThreadPrioritySettings(deviceSetIndex, settings);
+
+        // Settings are applied by each engine in its own thread. When the isolated CPUs change
+        // all engines are reconfigured so that the unpinned ones move off the isolated CPUs.
+        bool isolationChanged = dspEngine->getIsolatedCPUs() != isolatedCPUs;
+
+        for (int i = 0; i < (int) m_mainCore.m_deviceSets.size(); i++)
+        {
+            if ((i != deviceSetIndex) && !isolationChanged) {
+                continue;
+            }
+
+            DeviceSet *engineSet = m_mainCore.m_deviceSets[i];
+
+            if (engineSet->m_deviceSourceEngine) { // Rx
+                engineSet->m_deviceSourceEngine->getInputMessageQueue()->push(new DSPConfigureThreadPriority(i));
+            } else if (engineSet->m_deviceSinkEngine) { // Tx
+                engineSet->m_deviceSinkEngine->getInputMessageQueue()->push(new DSPConfigureThreadPriority(i));
+            } else if (engineSet->m_deviceMIMOEngine) { // MIMO
+                engineSet->m_deviceMIMOEngine->getInputMessageQueue()->push(new DSPConfigureThreadPriority(i));
+            }
+        }
+
+        // engine status is updated asynchronously. Worker threads get the new settings when they are restarted.
+        WebAPIAdapterBase::webapiFormatThreadPriority(
+            &response,
+            settings,
+            dspEngine->getThreadPriorityStatus(deviceSetIndex, ThreadPriority::RoleEngine),
+            dspEngine->getThreadPriorityStatus(deviceSetIndex, ThreadPriority::RoleWorker)
+        );
+        return 202;
+    }
+    else
+    {
+        *error.getMessage() = QString("There is no device set with index %1").arg(deviceSetIndex);
+        return 404;
+    }
+}
+
 int WebAPIAdapterSrv::devicesetDeviceRunGet(
         int deviceSetIndex,
         SWGSDRangel::SWGDeviceState& response,
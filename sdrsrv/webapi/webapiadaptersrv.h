@@ -247,6 +247,18 @@ public:
             SWGSDRangel::SWGDeviceSettings& response,
             SWGSDRangel::SWGErrorResponse& error);
 
+    virtual int devicesetDeviceThreadPriorityGet(
+            int deviceSetIndex,
+            SWGSDRangel::SWGThreadPrioritySettings& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
+    virtual int devicesetDeviceThreadPriorityPutPatch(
+            int deviceSetIndex,
+            bool force,
+            const QStringList& threadPriorityKeys,
+            SWGSDRangel::SWGThreadPrioritySettings& response,
+            SWGSDRangel::SWGErrorResponse& error);
+
     virtual int devicesetDeviceRunGet(
             int deviceSetIndex,
             SWGSDRangel::SWGDeviceState& response,
@@ -42,6 +42,8 @@ SWGBFMDemodReport::SWGBFMDemodReport() {
     m_pilot_power_db_isSet = false;
     rds_report = nullptr;
     m_rds_report_isSet = false;
+    rds_scan_stations = nullptr;
+    m_rds_scan_stations_isSet = false;
 }
 
 SWGBFMDemodReport::~SWGBFMDemodReport() {
@@ -64,6 +66,8 @@ SWGBFMDemodReport::init() {
     m_pilot_power_db_isSet = false;
     rds_report = new SWGRDSReport();
     m_rds_report_isSet = false;
+    rds_scan_stations = new QList<SWGRDSScanStation*>();
+    m_rds_scan_stations_isSet = false;
 }
 
 void
@@ -77,6 +81,13 @@ SWGBFMDemodReport::cleanup() {
     if(rds_report != nullptr) { 
         delete rds_report;
     }
+    if(rds_scan_stations != nullptr) { 
+        auto arr = rds_scan_stations;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete rds_scan_stations;
+    }
 }
 
 SWGBFMDemodReport*
@@ -104,6 +115,8 @@ SWGBFMDemodReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&rds_report, pJson["rdsReport"], "SWGRDSReport", "SWGRDSReport");
     
+    
+    ::SWGSDRangel::setValue(&rds_scan_stations, pJson["rdsScanStations"], "QList", "SWGRDSScanStation");
 }
 
 QString
@@ -141,6 +154,9 @@ SWGBFMDemodReport::asJsonObject() {
     if((rds_report != nullptr) && (rds_report->isSet())){
         toJsonValue(QString("rdsReport"), rds_report, obj, QString("SWGRDSReport"));
     }
+    if(rds_scan_stations && rds_scan_stations->size() > 0){
+        toJsonArray((QList<void*>*)rds_scan_stations, obj, "rdsScanStations", "SWGRDSScanStation");
+    }
 
     return obj;
 }
@@ -215,6 +231,16 @@ SWGBFMDemodReport::setRdsReport(SWGRDSReport* rds_report) {
     this->m_rds_report_isSet = true;
 }
 
+QList<SWGRDSScanStation*>*
+SWGBFMDemodReport::getRdsScanStations() {
+    return rds_scan_stations;
+}
+void
+SWGBFMDemodReport::setRdsScanStations(QList<SWGRDSScanStation*>* rds_scan_stations) {
+    this->rds_scan_stations = rds_scan_stations;
+    this->m_rds_scan_stations_isSet = true;
+}
+
 
 bool
 SWGBFMDemodReport::isSet(){
@@ -241,6 +267,9 @@ SWGBFMDemodReport::isSet(){
         if(rds_report && rds_report->isSet()){
             isObjectUpdated = true; break;
         }
+        if(rds_scan_stations && (rds_scan_stations->size() > 0)){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
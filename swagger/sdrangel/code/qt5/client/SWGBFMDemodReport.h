@@ -23,6 +23,8 @@
 
 
 #include "SWGRDSReport.h"
+#include "SWGRDSScanStation.h"
+#include <QList>
 
 #include "SWGObject.h"
 #include "export.h"
@@ -63,6 +65,9 @@ public:
     SWGRDSReport* getRdsReport();
     void setRdsReport(SWGRDSReport* rds_report);
 
+    QList<SWGRDSScanStation*>* getRdsScanStations();
+    void setRdsScanStations(QList<SWGRDSScanStation*>* rds_scan_stations);
+
 
     virtual bool isSet() override;
 
@@ -88,6 +93,9 @@ private:
     SWGRDSReport* rds_report;
     bool m_rds_report_isSet;
 
+    QList<SWGRDSScanStation*>* rds_scan_stations;
+    bool m_rds_scan_stations_isSet;
+
 };
 
 }
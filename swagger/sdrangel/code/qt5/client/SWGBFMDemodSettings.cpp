@@ -46,6 +46,16 @@ SWGBFMDemodSettings::SWGBFMDemodSettings() {
     m_show_pilot_isSet = false;
     rds_active = 0;
     m_rds_active_isSet = false;
+    rds_only = 0;
+    m_rds_only_isSet = false;
+    rds_scanner = 0;
+    m_rds_scanner_isSet = false;
+    rds_scan_threshold = 0.0f;
+    m_rds_scan_threshold_isSet = false;
+    rds_scan_max_stations = 0;
+    m_rds_scan_max_stations_isSet = false;
+    rds_scan_threads = 0;
+    m_rds_scan_threads_isSet = false;
     rgb_color = 0;
     m_rgb_color_isSet = false;
     title = nullptr;
@@ -90,6 +100,16 @@ SWGBFMDemodSettings::init() {
     m_show_pilot_isSet = false;
     rds_active = 0;
     m_rds_active_isSet = false;
+    rds_only = 0;
+    m_rds_only_isSet = false;
+    rds_scanner = 0;
+    m_rds_scanner_isSet = false;
+    rds_scan_threshold = 0.0f;
+    m_rds_scan_threshold_isSet = false;
+    rds_scan_max_stations = 0;
+    m_rds_scan_max_stations_isSet = false;
+    rds_scan_threads = 0;
+    m_rds_scan_threads_isSet = false;
     rgb_color = 0;
     m_rgb_color_isSet = false;
     title = new QString("");
@@ -167,6 +187,16 @@ SWGBFMDemodSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&rds_active, pJson["rdsActive"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&rds_only, pJson["rdsOnly"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rds_scanner, pJson["rdsScanner"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rds_scan_threshold, pJson["rdsScanThreshold"], "float", "");
+    
+    ::SWGSDRangel::setValue(&rds_scan_max_stations, pJson["rdsScanMaxStations"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rds_scan_threads, pJson["rdsScanThreads"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&rgb_color, pJson["rgbColor"], "qint32", "");
     
     ::SWGSDRangel::setValue(&title, pJson["title"], "QString", "QString");
@@ -228,6 +258,21 @@ SWGBFMDemodSettings::asJsonObject() {
     if(m_rds_active_isSet){
         obj->insert("rdsActive", QJsonValue(rds_active));
     }
+    if(m_rds_only_isSet){
+        obj->insert("rdsOnly", QJsonValue(rds_only));
+    }
+    if(m_rds_scanner_isSet){
+        obj->insert("rdsScanner", QJsonValue(rds_scanner));
+    }
+    if(m_rds_scan_threshold_isSet){
+        obj->insert("rdsScanThreshold", QJsonValue(rds_scan_threshold));
+    }
+    if(m_rds_scan_max_stations_isSet){
+        obj->insert("rdsScanMaxStations", QJsonValue(rds_scan_max_stations));
+    }
+    if(m_rds_scan_threads_isSet){
+        obj->insert("rdsScanThreads", QJsonValue(rds_scan_threads));
+    }
     if(m_rgb_color_isSet){
         obj->insert("rgbColor", QJsonValue(rgb_color));
     }
@@ -349,6 +394,56 @@ SWGBFMDemodSettings::setRdsActive(qint32 rds_active) {
     this->m_rds_active_isSet = true;
 }
 
+qint32
+SWGBFMDemodSettings::getRdsOnly() {
+    return rds_only;
+}
+void
+SWGBFMDemodSettings::setRdsOnly(qint32 rds_only) {
+    this->rds_only = rds_only;
+    this->m_rds_only_isSet = true;
+}
+
+qint32
+SWGBFMDemodSettings::getRdsScanner() {
+    return rds_scanner;
+}
+void
+SWGBFMDemodSettings::setRdsScanner(qint32 rds_scanner) {
+    this->rds_scanner = rds_scanner;
+    this->m_rds_scanner_isSet = true;
+}
+
+float
+SWGBFMDemodSettings::getRdsScanThreshold() {
+    return rds_scan_threshold;
+}
+void
+SWGBFMDemodSettings::setRdsScanThreshold(float rds_scan_threshold) {
+    this->rds_scan_threshold = rds_scan_threshold;
+    this->m_rds_scan_threshold_isSet = true;
+}
+
+qint32
+SWGBFMDemodSettings::getRdsScanMaxStations() {
+    return rds_scan_max_stations;
+}
+void
+SWGBFMDemodSettings::setRdsScanMaxStations(qint32 rds_scan_max_stations) {
+    this->rds_scan_max_stations = rds_scan_max_stations;
+    this->m_rds_scan_max_stations_isSet = true;
+}
+
+qint32
+SWGBFMDemodSettings::getRdsScanThreads() {
+    return rds_scan_threads;
+}
+void
+SWGBFMDemodSettings::setRdsScanThreads(qint32 rds_scan_threads) {
+    this->rds_scan_threads = rds_scan_threads;
+    this->m_rds_scan_threads_isSet = true;
+}
+
 qint32
 SWGBFMDemodSettings::getRgbColor() {
     return rgb_color;
@@ -471,6 +566,21 @@ SWGBFMDemodSettings::isSet(){
         if(m_rds_active_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_rds_only_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rds_scanner_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rds_scan_threshold_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rds_scan_max_stations_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rds_scan_threads_isSet){
+            isObjectUpdated = true; break;
+        }
         if(m_rgb_color_isSet){
             isObjectUpdated = true; break;
         }
@@ -69,6 +69,21 @@ public:
     qint32 getRdsActive();
     void setRdsActive(qint32 rds_active);
 
+    qint32 getRdsOnly();
+    void setRdsOnly(qint32 rds_only);
+
+    qint32 getRdsScanner();
+    void setRdsScanner(qint32 rds_scanner);
+
+    float getRdsScanThreshold();
+    void setRdsScanThreshold(float rds_scan_threshold);
+
+    qint32 getRdsScanMaxStations();
+    void setRdsScanMaxStations(qint32 rds_scan_max_stations);
+
+    qint32 getRdsScanThreads();
+    void setRdsScanThreads(qint32 rds_scan_threads);
+
     qint32 getRgbColor();
     void setRgbColor(qint32 rgb_color);
 
@@ -127,6 +142,21 @@ private:
     qint32 rds_active;
     bool m_rds_active_isSet;
 
+    qint32 rds_only;
+    bool m_rds_only_isSet;
+
+    qint32 rds_scanner;
+    bool m_rds_scanner_isSet;
+
+    float rds_scan_threshold;
+    bool m_rds_scan_threshold_isSet;
+
+    qint32 rds_scan_max_stations;
+    bool m_rds_scan_max_stations_isSet;
+
+    qint32 rds_scan_threads;
+    bool m_rds_scan_threads_isSet;
+
     qint32 rgb_color;
     bool m_rgb_color_isSet;
 
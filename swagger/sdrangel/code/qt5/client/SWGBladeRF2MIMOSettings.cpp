@@ -60,6 +60,8 @@ SWGBladeRF2MIMOSettings::SWGBladeRF2MIMOSettings() {
     m_rx_transverter_delta_frequency_isSet = false;
     iq_order = 0;
     m_iq_order_isSet = false;
+    spectrum_stream_index = 0;
+    m_spectrum_stream_index_isSet = false;
     tx_center_frequency = 0L;
     m_tx_center_frequency_isSet = false;
     log2_interp = 0;
@@ -128,6 +130,8 @@ SWGBladeRF2MIMOSettings::init() {
     m_rx_transverter_delta_frequency_isSet = false;
     iq_order = 0;
     m_iq_order_isSet = false;
+    spectrum_stream_index = 0;
+    m_spectrum_stream_index_isSet = false;
     tx_center_frequency = 0L;
     m_tx_center_frequency_isSet = false;
     log2_interp = 0;
@@ -239,6 +243,8 @@ SWGBladeRF2MIMOSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&iq_order, pJson["iqOrder"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&spectrum_stream_index, pJson["spectrumStreamIndex"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&tx_center_frequency, pJson["txCenterFrequency"], "qint64", "");
     
     ::SWGSDRangel::setValue(&log2_interp, pJson["log2Interp"], "qint32", "");
@@ -331,6 +337,9 @@ SWGBladeRF2MIMOSettings::asJsonObject() {
     if(m_iq_order_isSet){
         obj->insert("iqOrder", QJsonValue(iq_order));
     }
+    if(m_spectrum_stream_index_isSet){
+        obj->insert("spectrumStreamIndex", QJsonValue(spectrum_stream_index));
+    }
     if(m_tx_center_frequency_isSet){
         obj->insert("txCenterFrequency", QJsonValue(tx_center_frequency));
     }
@@ -537,6 +546,16 @@ SWGBladeRF2MIMOSettings::setIqOrder(qint32 iq_order) {
     this->m_iq_order_isSet = true;
 }
 
+qint32
+SWGBladeRF2MIMOSettings::getSpectrumStreamIndex() {
+    return spectrum_stream_index;
+}
+void
+SWGBladeRF2MIMOSettings::setSpectrumStreamIndex(qint32 spectrum_stream_index) {
+    this->spectrum_stream_index = spectrum_stream_index;
+    this->m_spectrum_stream_index_isSet = true;
+}
+
 qint64
 SWGBladeRF2MIMOSettings::getTxCenterFrequency() {
     return tx_center_frequency;
@@ -730,6 +749,9 @@ SWGBladeRF2MIMOSettings::isSet(){
         if(m_iq_order_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_spectrum_stream_index_isSet){
+            isObjectUpdated = true; break;
+        }
         if(m_tx_center_frequency_isSet){
             isObjectUpdated = true; break;
         }
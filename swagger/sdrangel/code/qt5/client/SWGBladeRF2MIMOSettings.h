@@ -90,6 +90,9 @@ public:
     qint32 getIqOrder();
     void setIqOrder(qint32 iq_order);
 
+    qint32 getSpectrumStreamIndex();
+    void setSpectrumStreamIndex(qint32 spectrum_stream_index);
+
     qint64 getTxCenterFrequency();
     void setTxCenterFrequency(qint64 tx_center_frequency);
 
@@ -184,6 +187,9 @@ private:
     qint32 iq_order;
     bool m_iq_order_isSet;
 
+    qint32 spectrum_stream_index;
+    bool m_spectrum_stream_index_isSet;
+
     qint64 tx_center_frequency;
     bool m_tx_center_frequency_isSet;
 
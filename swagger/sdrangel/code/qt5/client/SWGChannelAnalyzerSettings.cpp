@@ -54,6 +54,8 @@ SWGChannelAnalyzerSettings::SWGChannelAnalyzerSettings() {
     m_pll_psk_order_isSet = false;
     input_type = 0;
     m_input_type_isSet = false;
+    corr_log2_decim = 0;
+    m_corr_log2_decim_isSet = false;
     rgb_color = 0;
     m_rgb_color_isSet = false;
     title = nullptr;
@@ -96,6 +98,8 @@ SWGChannelAnalyzerSettings::init() {
     m_pll_psk_order_isSet = false;
     input_type = 0;
     m_input_type_isSet = false;
+    corr_log2_decim = 0;
+    m_corr_log2_decim_isSet = false;
     rgb_color = 0;
     m_rgb_color_isSet = false;
     title = new QString("");
@@ -170,6 +174,8 @@ SWGChannelAnalyzerSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&input_type, pJson["inputType"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&corr_log2_decim, pJson["corrLog2Decim"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&rgb_color, pJson["rgbColor"], "qint32", "");
     
     ::SWGSDRangel::setValue(&title, pJson["title"], "QString", "QString");
@@ -233,6 +239,9 @@ SWGChannelAnalyzerSettings::asJsonObject() {
     if(m_input_type_isSet){
         obj->insert("inputType", QJsonValue(input_type));
     }
+    if(m_corr_log2_decim_isSet){
+        obj->insert("corrLog2Decim", QJsonValue(corr_log2_decim));
+    }
     if(m_rgb_color_isSet){
         obj->insert("rgbColor", QJsonValue(rgb_color));
     }
@@ -379,6 +388,16 @@ SWGChannelAnalyzerSettings::setInputType(qint32 input_type) {
     this->m_input_type_isSet = true;
 }
 
+qint32
+SWGChannelAnalyzerSettings::getCorrLog2Decim() {
+    return corr_log2_decim;
+}
+void
+SWGChannelAnalyzerSettings::setCorrLog2Decim(qint32 corr_log2_decim) {
+    this->corr_log2_decim = corr_log2_decim;
+    this->m_corr_log2_decim_isSet = true;
+}
+
 qint32
 SWGChannelAnalyzerSettings::getRgbColor() {
     return rgb_color;
@@ -463,6 +482,9 @@ SWGChannelAnalyzerSettings::isSet(){
         if(m_input_type_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_corr_log2_decim_isSet){
+            isObjectUpdated = true; break;
+        }
         if(m_rgb_color_isSet){
             isObjectUpdated = true; break;
         }
@@ -83,6 +83,9 @@ public:
     qint32 getInputType();
     void setInputType(qint32 input_type);
 
+    qint32 getCorrLog2Decim();
+    void setCorrLog2Decim(qint32 corr_log2_decim);
+
     qint32 getRgbColor();
     void setRgbColor(qint32 rgb_color);
 
@@ -138,6 +141,9 @@ private:
     qint32 input_type;
     bool m_input_type_isSet;
 
+    qint32 corr_log2_decim;
+    bool m_corr_log2_decim_isSet;
+
     qint32 rgb_color;
     bool m_rgb_color_isSet;
 
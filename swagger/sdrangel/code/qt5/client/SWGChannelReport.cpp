@@ -40,6 +40,8 @@ SWGChannelReport::SWGChannelReport() {
     m_atv_mod_report_isSet = false;
     bfm_demod_report = nullptr;
     m_bfm_demod_report_isSet = false;
+    channel_analyzer_report = nullptr;
+    m_channel_analyzer_report_isSet = false;
     dsd_demod_report = nullptr;
     m_dsd_demod_report_isSet = false;
     file_sink_report = nullptr;
@@ -52,6 +54,8 @@ SWGChannelReport::SWGChannelReport() {
     m_free_dv_mod_report_isSet = false;
     freq_tracker_report = nullptr;
     m_freq_tracker_report_isSet = false;
+    interferometer_report = nullptr;
+    m_interferometer_report_isSet = false;
     nfm_demod_report = nullptr;
     m_nfm_demod_report_isSet = false;
     nfm_mod_report = nullptr;
@@ -90,6 +94,8 @@ SWGChannelReport::init() {
     m_atv_mod_report_isSet = false;
     bfm_demod_report = new SWGBFMDemodReport();
     m_bfm_demod_report_isSet = false;
+    channel_analyzer_report = new SWGChannelAnalyzerReport();
+    m_channel_analyzer_report_isSet = false;
     dsd_demod_report = new SWGDSDDemodReport();
     m_dsd_demod_report_isSet = false;
     file_sink_report = new SWGFileSinkReport();
@@ -102,6 +108,8 @@ SWGChannelReport::init() {
     m_free_dv_mod_report_isSet = false;
     freq_tracker_report = new SWGFreqTrackerReport();
     m_freq_tracker_report_isSet = false;
+    interferometer_report = new SWGInterferometerReport();
+    m_interferometer_report_isSet = false;
     nfm_demod_report = new SWGNFMDemodReport();
     m_nfm_demod_report_isSet = false;
     nfm_mod_report = new SWGNFMModReport();
@@ -185,6 +193,12 @@ SWGChannelReport::cleanup() {
     if(wfm_mod_report != nullptr) { 
         delete wfm_mod_report;
     }
+    if(channel_analyzer_report != nullptr) { 
+        delete channel_analyzer_report;
+    }
+    if(interferometer_report != nullptr) { 
+        delete interferometer_report;
+    }
 }
 
 SWGChannelReport*
@@ -210,6 +224,8 @@ SWGChannelReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&bfm_demod_report, pJson["BFMDemodReport"], "SWGBFMDemodReport", "SWGBFMDemodReport");
     
+    ::SWGSDRangel::setValue(&channel_analyzer_report, pJson["ChannelAnalyzerReport"], "SWGChannelAnalyzerReport", "SWGChannelAnalyzerReport");
+    
     ::SWGSDRangel::setValue(&dsd_demod_report, pJson["DSDDemodReport"], "SWGDSDDemodReport", "SWGDSDDemodReport");
     
     ::SWGSDRangel::setValue(&file_sink_report, pJson["FileSinkReport"], "SWGFileSinkReport", "SWGFileSinkReport");
@@ -222,6 +238,8 @@ SWGChannelReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&freq_tracker_report, pJson["FreqTrackerReport"], "SWGFreqTrackerReport", "SWGFreqTrackerReport");
     
+    ::SWGSDRangel::setValue(&interferometer_report, pJson["InterferometerReport"], "SWGInterferometerReport", "SWGInterferometerReport");
+    
     ::SWGSDRangel::setValue(&nfm_demod_report, pJson["NFMDemodReport"], "SWGNFMDemodReport", "SWGNFMDemodReport");
     
     ::SWGSDRangel::setValue(&nfm_mod_report, pJson["NFMModReport"], "SWGNFMModReport", "SWGNFMModReport");
@@ -274,6 +292,9 @@ SWGChannelReport::asJsonObject() {
     if((bfm_demod_report != nullptr) && (bfm_demod_report->isSet())){
         toJsonValue(QString("BFMDemodReport"), bfm_demod_report, obj, QString("SWGBFMDemodReport"));
     }
+    if((channel_analyzer_report != nullptr) && (channel_analyzer_report->isSet())){
+        toJsonValue(QString("ChannelAnalyzerReport"), channel_analyzer_report, obj, QString("SWGChannelAnalyzerReport"));
+    }
     if((dsd_demod_report != nullptr) && (dsd_demod_report->isSet())){
         toJsonValue(QString("DSDDemodReport"), dsd_demod_report, obj, QString("SWGDSDDemodReport"));
     }
@@ -292,6 +313,9 @@ SWGChannelReport::asJsonObject() {
     if((freq_tracker_report != nullptr) && (freq_tracker_report->isSet())){
         toJsonValue(QString("FreqTrackerReport"), freq_tracker_report, obj, QString("SWGFreqTrackerReport"));
     }
+    if((interferometer_report != nullptr) && (interferometer_report->isSet())){
+        toJsonValue(QString("InterferometerReport"), interferometer_report, obj, QString("SWGInterferometerReport"));
+    }
     if((nfm_demod_report != nullptr) && (nfm_demod_report->isSet())){
         toJsonValue(QString("NFMDemodReport"), nfm_demod_report, obj, QString("SWGNFMDemodReport"));
     }
@@ -383,6 +407,16 @@ SWGChannelReport::setBfmDemodReport(SWGBFMDemodReport* bfm_demod_report) {
     this->m_bfm_demod_report_isSet = true;
 }
 
+SWGChannelAnalyzerReport*
+SWGChannelReport::getChannelAnalyzerReport() {
+    return channel_analyzer_report;
+}
+void
+SWGChannelReport::setChannelAnalyzerReport(SWGChannelAnalyzerReport* channel_analyzer_report) {
+    this->channel_analyzer_report = channel_analyzer_report;
+    this->m_channel_analyzer_report_isSet = true;
+}
+
 SWGDSDDemodReport*
 SWGChannelReport::getDsdDemodReport() {
     return dsd_demod_report;
@@ -443,6 +477,16 @@ SWGChannelReport::setFreqTrackerReport(SWGFreqTrackerReport* freq_tracker_report
     this->m_freq_tracker_report_isSet = true;
 }
 
+SWGInterferometerReport*
+SWGChannelReport::getInterferometerReport() {
+    return interferometer_report;
+}
+void
+SWGChannelReport::setInterferometerReport(SWGInterferometerReport* interferometer_report) {
+    this->interferometer_report = interferometer_report;
+    this->m_interferometer_report_isSet = true;
+}
+
 SWGNFMDemodReport*
 SWGChannelReport::getNfmDemodReport() {
     return nfm_demod_report;
@@ -556,6 +600,9 @@ SWGChannelReport::isSet(){
         if(bfm_demod_report && bfm_demod_report->isSet()){
             isObjectUpdated = true; break;
         }
+        if(channel_analyzer_report && channel_analyzer_report->isSet()){
+            isObjectUpdated = true; break;
+        }
         if(dsd_demod_report && dsd_demod_report->isSet()){
             isObjectUpdated = true; break;
         }
@@ -574,6 +621,9 @@ SWGChannelReport::isSet(){
         if(freq_tracker_report && freq_tracker_report->isSet()){
             isObjectUpdated = true; break;
         }
+        if(interferometer_report && interferometer_report->isSet()){
+            isObjectUpdated = true; break;
+        }
         if(nfm_demod_report && nfm_demod_report->isSet()){
             isObjectUpdated = true; break;
         }
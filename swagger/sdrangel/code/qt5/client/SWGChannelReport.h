@@ -26,12 +26,14 @@
 #include "SWGAMModReport.h"
 #include "SWGATVModReport.h"
 #include "SWGBFMDemodReport.h"
+#include "SWGChannelAnalyzerReport.h"
 #include "SWGDSDDemodReport.h"
 #include "SWGFileSinkReport.h"
 #include "SWGFileSourceReport.h"
 #include "SWGFreeDVDemodReport.h"
 #include "SWGFreeDVModReport.h"
 #include "SWGFreqTrackerReport.h"
+#include "SWGInterferometerReport.h"
 #include "SWGNFMDemodReport.h"
 #include "SWGNFMModReport.h"
 #include "SWGRemoteSourceReport.h"
@@ -79,6 +81,9 @@ public:
     SWGBFMDemodReport* getBfmDemodReport();
     void setBfmDemodReport(SWGBFMDemodReport* bfm_demod_report);
 
+    SWGChannelAnalyzerReport* getChannelAnalyzerReport();
+    void setChannelAnalyzerReport(SWGChannelAnalyzerReport* channel_analyzer_report);
+
     SWGDSDDemodReport* getDsdDemodReport();
     void setDsdDemodReport(SWGDSDDemodReport* dsd_demod_report);
 
@@ -97,6 +102,9 @@ public:
     SWGFreqTrackerReport* getFreqTrackerReport();
     void setFreqTrackerReport(SWGFreqTrackerReport* freq_tracker_report);
 
+    SWGInterferometerReport* getInterferometerReport();
+    void setInterferometerReport(SWGInterferometerReport* interferometer_report);
+
     SWGNFMDemodReport* getNfmDemodReport();
     void setNfmDemodReport(SWGNFMDemodReport* nfm_demod_report);
 
@@ -146,6 +154,9 @@ private:
     SWGBFMDemodReport* bfm_demod_report;
     bool m_bfm_demod_report_isSet;
 
+    SWGChannelAnalyzerReport* channel_analyzer_report;
+    bool m_channel_analyzer_report_isSet;
+
     SWGDSDDemodReport* dsd_demod_report;
     bool m_dsd_demod_report_isSet;
 
@@ -164,6 +175,9 @@ private:
     SWGFreqTrackerReport* freq_tracker_report;
     bool m_freq_tracker_report_isSet;
 
+    SWGInterferometerReport* interferometer_report;
+    bool m_interferometer_report_isSet;
+
     SWGNFMDemodReport* nfm_demod_report;
     bool m_nfm_demod_report_isSet;
 
@@ -0,0 +1,204 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGChannelReportItem.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGChannelReportItem::SWGChannelReportItem(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGChannelReportItem::SWGChannelReportItem() {
+    device_set_index = 0;
+    m_device_set_index_isSet = false;
+    channel_index = 0;
+    m_channel_index_isSet = false;
+    status = 0;
+    m_status_isSet = false;
+    message = nullptr;
+    m_message_isSet = false;
+    report = nullptr;
+    m_report_isSet = false;
+}
+
+SWGChannelReportItem::~SWGChannelReportItem() {
+    this->cleanup();
+}
+
+void
+SWGChannelReportItem::init() {
+    device_set_index = 0;
+    m_device_set_index_isSet = false;
+    channel_index = 0;
+    m_channel_index_isSet = false;
+    status = 0;
+    m_status_isSet = false;
+    message = new QString("");
+    m_message_isSet = false;
+    report = new SWGChannelReport();
+    m_report_isSet = false;
+}
+
+void
+SWGChannelReportItem::cleanup() {
+
+
+
+    if(message != nullptr) { 
+        delete message;
+    }
+    if(report != nullptr) { 
+        delete report;
+    }
+}
+
+SWGChannelReportItem*
+SWGChannelReportItem::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGChannelReportItem::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&device_set_index, pJson["deviceSetIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&channel_index, pJson["channelIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&status, pJson["status"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&message, pJson["message"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&report, pJson["report"], "SWGChannelReport", "SWGChannelReport");
+    
+}
+
+QString
+SWGChannelReportItem::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGChannelReportItem::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_device_set_index_isSet){
+        obj->insert("deviceSetIndex", QJsonValue(device_set_index));
+    }
+    if(m_channel_index_isSet){
+        obj->insert("channelIndex", QJsonValue(channel_index));
+    }
+    if(m_status_isSet){
+        obj->insert("status", QJsonValue(status));
+    }
+    if(message != nullptr && *message != QString("")){
+        toJsonValue(QString("message"), message, obj, QString("QString"));
+    }
+    if((report != nullptr) && (report->isSet())){
+        toJsonValue(QString("report"), report, obj, QString("SWGChannelReport"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGChannelReportItem::getDeviceSetIndex() {
+    return device_set_index;
+}
+void
+SWGChannelReportItem::setDeviceSetIndex(qint32 device_set_index) {
+    this->device_set_index = device_set_index;
+    this->m_device_set_index_isSet = true;
+}
+
+qint32
+SWGChannelReportItem::getChannelIndex() {
+    return channel_index;
+}
+void
+SWGChannelReportItem::setChannelIndex(qint32 channel_index) {
+    this->channel_index = channel_index;
+    this->m_channel_index_isSet = true;
+}
+
+qint32
+SWGChannelReportItem::getStatus() {
+    return status;
+}
+void
+SWGChannelReportItem::setStatus(qint32 status) {
+    this->status = status;
+    this->m_status_isSet = true;
+}
+
+QString*
+SWGChannelReportItem::getMessage() {
+    return message;
+}
+void
+SWGChannelReportItem::setMessage(QString* message) {
+    this->message = message;
+    this->m_message_isSet = true;
+}
+
+SWGChannelReport*
+SWGChannelReportItem::getReport() {
+    return report;
+}
+void
+SWGChannelReportItem::setReport(SWGChannelReport* report) {
+    this->report = report;
+    this->m_report_isSet = true;
+}
+
+
+bool
+SWGChannelReportItem::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_device_set_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_channel_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_status_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(message && *message != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(report && report->isSet()){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
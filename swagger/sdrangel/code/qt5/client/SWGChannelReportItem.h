@@ -0,0 +1,84 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGChannelReportItem.h
+ *
+ * Report of a channel identified by its device set and channel indexes
+ */
+
+#ifndef SWGChannelReportItem_H_
+#define SWGChannelReportItem_H_
+
+#include <QJsonObject>
+
+
+#include "SWGChannelReport.h"
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGChannelReportItem: public SWGObject {
+public:
+    SWGChannelReportItem();
+    SWGChannelReportItem(QString* json);
+    virtual ~SWGChannelReportItem();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGChannelReportItem* fromJson(QString &jsonString) override;
+
+    qint32 getDeviceSetIndex();
+    void setDeviceSetIndex(qint32 device_set_index);
+
+    qint32 getChannelIndex();
+    void setChannelIndex(qint32 channel_index);
+
+    qint32 getStatus();
+    void setStatus(qint32 status);
+
+    QString* getMessage();
+    void setMessage(QString* message);
+
+    SWGChannelReport* getReport();
+    void setReport(SWGChannelReport* report);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 device_set_index;
+    bool m_device_set_index_isSet;
+
+    qint32 channel_index;
+    bool m_channel_index_isSet;
+
+    qint32 status;
+    bool m_status_isSet;
+
+    QString* message;
+    bool m_message_isSet;
+
+    SWGChannelReport* report;
+    bool m_report_isSet;
+
+};
+
+}
+
+#endif /* SWGChannelReportItem_H_ */
@@ -62,6 +62,8 @@ SWGChannelSettings::SWGChannelSettings() {
     m_free_dv_mod_settings_isSet = false;
     freq_tracker_settings = nullptr;
     m_freq_tracker_settings_isSet = false;
+    interferometer_settings = nullptr;
+    m_interferometer_settings_isSet = false;
     nfm_demod_settings = nullptr;
     m_nfm_demod_settings_isSet = false;
     nfm_mod_settings = nullptr;
@@ -128,6 +130,8 @@ SWGChannelSettings::init() {
     m_free_dv_mod_settings_isSet = false;
     freq_tracker_settings = new SWGFreqTrackerSettings();
     m_freq_tracker_settings_isSet = false;
+    interferometer_settings = new SWGInterferometerSettings();
+    m_interferometer_settings_isSet = false;
     nfm_demod_settings = new SWGNFMDemodSettings();
     m_nfm_demod_settings_isSet = false;
     nfm_mod_settings = new SWGNFMModSettings();
@@ -237,6 +241,9 @@ SWGChannelSettings::cleanup() {
     if(wfm_mod_settings != nullptr) { 
         delete wfm_mod_settings;
     }
+    if(interferometer_settings != nullptr) { 
+        delete interferometer_settings;
+    }
 }
 
 SWGChannelSettings*
@@ -284,6 +291,8 @@ SWGChannelSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&freq_tracker_settings, pJson["FreqTrackerSettings"], "SWGFreqTrackerSettings", "SWGFreqTrackerSettings");
     
+    ::SWGSDRangel::setValue(&interferometer_settings, pJson["InterferometerSettings"], "SWGInterferometerSettings", "SWGInterferometerSettings");
+    
     ::SWGSDRangel::setValue(&nfm_demod_settings, pJson["NFMDemodSettings"], "SWGNFMDemodSettings", "SWGNFMDemodSettings");
     
     ::SWGSDRangel::setValue(&nfm_mod_settings, pJson["NFMModSettings"], "SWGNFMModSettings", "SWGNFMModSettings");
@@ -375,6 +384,9 @@ SWGChannelSettings::asJsonObject() {
     if((freq_tracker_settings != nullptr) && (freq_tracker_settings->isSet())){
         toJsonValue(QString("FreqTrackerSettings"), freq_tracker_settings, obj, QString("SWGFreqTrackerSettings"));
     }
+    if((interferometer_settings != nullptr) && (interferometer_settings->isSet())){
+        toJsonValue(QString("InterferometerSettings"), interferometer_settings, obj, QString("SWGInterferometerSettings"));
+    }
     if((nfm_demod_settings != nullptr) && (nfm_demod_settings->isSet())){
         toJsonValue(QString("NFMDemodSettings"), nfm_demod_settings, obj, QString("SWGNFMDemodSettings"));
     }
@@ -585,6 +597,16 @@ SWGChannelSettings::setFreqTrackerSettings(SWGFreqTrackerSettings* freq_tracker_
     this->m_freq_tracker_settings_isSet = true;
 }
 
+SWGInterferometerSettings*
+SWGChannelSettings::getInterferometerSettings() {
+    return interferometer_settings;
+}
+void
+SWGChannelSettings::setInterferometerSettings(SWGInterferometerSettings* interferometer_settings) {
+    this->interferometer_settings = interferometer_settings;
+    this->m_interferometer_settings_isSet = true;
+}
+
 SWGNFMDemodSettings*
 SWGChannelSettings::getNfmDemodSettings() {
     return nfm_demod_settings;
@@ -761,6 +783,9 @@ SWGChannelSettings::isSet(){
         if(freq_tracker_settings && freq_tracker_settings->isSet()){
             isObjectUpdated = true; break;
         }
+        if(interferometer_settings && interferometer_settings->isSet()){
+            isObjectUpdated = true; break;
+        }
         if(nfm_demod_settings && nfm_demod_settings->isSet()){
             isObjectUpdated = true; break;
         }
@@ -64,6 +64,8 @@ SWGDeviceSettings::SWGDeviceSettings() {
     m_lime_sdr_input_settings_isSet = false;
     lime_sdr_output_settings = nullptr;
     m_lime_sdr_output_settings_isSet = false;
+    lime_sdr_mimo_settings = nullptr;
+    m_lime_sdr_mimo_settings_isSet = false;
     local_input_settings = nullptr;
     m_local_input_settings_isSet = false;
     local_output_settings = nullptr;
@@ -74,6 +76,8 @@ SWGDeviceSettings::SWGDeviceSettings() {
     m_pluto_sdr_input_settings_isSet = false;
     pluto_sdr_output_settings = nullptr;
     m_pluto_sdr_output_settings_isSet = false;
+    pluto_sdr_mimo_settings = nullptr;
+    m_pluto_sdr_mimo_settings_isSet = false;
     rtl_sdr_settings = nullptr;
     m_rtl_sdr_settings_isSet = false;
     remote_output_settings = nullptr;
@@ -88,10 +92,14 @@ SWGDeviceSettings::SWGDeviceSettings() {
     m_soapy_sdr_output_settings_isSet = false;
     test_source_settings = nullptr;
     m_test_source_settings_isSet = false;
+    test_mi_settings = nullptr;
+    m_test_mi_settings_isSet = false;
     xtrx_input_settings = nullptr;
     m_xtrx_input_settings_isSet = false;
     xtrx_output_settings = nullptr;
     m_xtrx_output_settings_isSet = false;
+    xtrx_mimo_settings = nullptr;
+    m_xtrx_mimo_settings_isSet = false;
 }
 
 SWGDeviceSettings::~SWGDeviceSettings() {
@@ -136,6 +144,8 @@ SWGDeviceSettings::init() {
     m_lime_sdr_input_settings_isSet = false;
     lime_sdr_output_settings = new SWGLimeSdrOutputSettings();
     m_lime_sdr_output_settings_isSet = false;
+    lime_sdr_mimo_settings = new SWGLimeSdrMIMOSettings();
+    m_lime_sdr_mimo_settings_isSet = false;
     local_input_settings = new SWGLocalInputSettings();
     m_local_input_settings_isSet = false;
     local_output_settings = new SWGLocalOutputSettings();
@@ -146,6 +156,8 @@ SWGDeviceSettings::init() {
     m_pluto_sdr_input_settings_isSet = false;
     pluto_sdr_output_settings = new SWGPlutoSdrOutputSettings();
     m_pluto_sdr_output_settings_isSet = false;
+    pluto_sdr_mimo_settings = new SWGPlutoSdrMIMOSettings();
+    m_pluto_sdr_mimo_settings_isSet = false;
     rtl_sdr_settings = new SWGRtlSdrSettings();
     m_rtl_sdr_settings_isSet = false;
     remote_output_settings = new SWGRemoteOutputSettings();
@@ -160,10 +172,14 @@ SWGDeviceSettings::init() {
     m_soapy_sdr_output_settings_isSet = false;
     test_source_settings = new SWGTestSourceSettings();
     m_test_source_settings_isSet = false;
+    test_mi_settings = new SWGTestMISettings();
+    m_test_mi_settings_isSet = false;
     xtrx_input_settings = new SWGXtrxInputSettings();
     m_xtrx_input_settings_isSet = false;
     xtrx_output_settings = new SWGXtrxOutputSettings();
     m_xtrx_output_settings_isSet = false;
+    xtrx_mimo_settings = new SWGXtrxMIMOSettings();
+    m_xtrx_mimo_settings_isSet = false;
 }
 
 void
@@ -260,6 +276,18 @@ SWGDeviceSettings::cleanup() {
     if(xtrx_output_settings != nullptr) { 
         delete xtrx_output_settings;
     }
+    if(test_mi_settings != nullptr) { 
+        delete test_mi_settings;
+    }
+    if(xtrx_mimo_settings != nullptr) { 
+        delete xtrx_mimo_settings;
+    }
+    if(lime_sdr_mimo_settings != nullptr) { 
+        delete lime_sdr_mimo_settings;
+    }
+    if(pluto_sdr_mimo_settings != nullptr) { 
+        delete pluto_sdr_mimo_settings;
+    }
 }
 
 SWGDeviceSettings*
@@ -309,6 +337,8 @@ SWGDeviceSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&lime_sdr_output_settings, pJson["limeSdrOutputSettings"], "SWGLimeSdrOutputSettings", "SWGLimeSdrOutputSettings");
     
+    ::SWGSDRangel::setValue(&lime_sdr_mimo_settings, pJson["limeSdrMIMOSettings"], "SWGLimeSdrMIMOSettings", "SWGLimeSdrMIMOSettings");
+    
     ::SWGSDRangel::setValue(&local_input_settings, pJson["localInputSettings"], "SWGLocalInputSettings", "SWGLocalInputSettings");
     
     ::SWGSDRangel::setValue(&local_output_settings, pJson["localOutputSettings"], "SWGLocalOutputSettings", "SWGLocalOutputSettings");
@@ -319,6 +349,8 @@ SWGDeviceSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&pluto_sdr_output_settings, pJson["plutoSdrOutputSettings"], "SWGPlutoSdrOutputSettings", "SWGPlutoSdrOutputSettings");
     
+    ::SWGSDRangel::setValue(&pluto_sdr_mimo_settings, pJson["plutoSdrMIMOSettings"], "SWGPlutoSdrMIMOSettings", "SWGPlutoSdrMIMOSettings");
+    
     ::SWGSDRangel::setValue(&rtl_sdr_settings, pJson["rtlSdrSettings"], "SWGRtlSdrSettings", "SWGRtlSdrSettings");
     
     ::SWGSDRangel::setValue(&remote_output_settings, pJson["remoteOutputSettings"], "SWGRemoteOutputSettings", "SWGRemoteOutputSettings");
@@ -333,10 +365,14 @@ SWGDeviceSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&test_source_settings, pJson["testSourceSettings"], "SWGTestSourceSettings", "SWGTestSourceSettings");
     
+    ::SWGSDRangel::setValue(&test_mi_settings, pJson["testMISettings"], "SWGTestMISettings", "SWGTestMISettings");
+    
     ::SWGSDRangel::setValue(&xtrx_input_settings, pJson["xtrxInputSettings"], "SWGXtrxInputSettings", "SWGXtrxInputSettings");
     
     ::SWGSDRangel::setValue(&xtrx_output_settings, pJson["xtrxOutputSettings"], "SWGXtrxOutputSettings", "SWGXtrxOutputSettings");
     
+    ::SWGSDRangel::setValue(&xtrx_mimo_settings, pJson["xtrxMIMOSettings"], "SWGXtrxMIMOSettings", "SWGXtrxMIMOSettings");
+    
 }
 
 QString
@@ -407,6 +443,9 @@ SWGDeviceSettings::asJsonObject() {
     if((lime_sdr_output_settings != nullptr) && (lime_sdr_output_settings->isSet())){
         toJsonValue(QString("limeSdrOutputSettings"), lime_sdr_output_settings, obj, QString("SWGLimeSdrOutputSettings"));
     }
+    if((lime_sdr_mimo_settings != nullptr) && (lime_sdr_mimo_settings->isSet())){
+        toJsonValue(QString("limeSdrMIMOSettings"), lime_sdr_mimo_settings, obj, QString("SWGLimeSdrMIMOSettings"));
+    }
     if((local_input_settings != nullptr) && (local_input_settings->isSet())){
         toJsonValue(QString("localInputSettings"), local_input_settings, obj, QString("SWGLocalInputSettings"));
     }
@@ -422,6 +461,9 @@ SWGDeviceSettings::asJsonObject() {
     if((pluto_sdr_output_settings != nullptr) && (pluto_sdr_output_settings->isSet())){
         toJsonValue(QString("plutoSdrOutputSettings"), pluto_sdr_output_settings, obj, QString("SWGPlutoSdrOutputSettings"));
     }
+    if((pluto_sdr_mimo_settings != nullptr) && (pluto_sdr_mimo_settings->isSet())){
+        toJsonValue(QString("plutoSdrMIMOSettings"), pluto_sdr_mimo_settings, obj, QString("SWGPlutoSdrMIMOSettings"));
+    }
     if((rtl_sdr_settings != nullptr) && (rtl_sdr_settings->isSet())){
         toJsonValue(QString("rtlSdrSettings"), rtl_sdr_settings, obj, QString("SWGRtlSdrSettings"));
     }
@@ -443,12 +485,18 @@ SWGDeviceSettings::asJsonObject() {
     if((test_source_settings != nullptr) && (test_source_settings->isSet())){
         toJsonValue(QString("testSourceSettings"), test_source_settings, obj, QString("SWGTestSourceSettings"));
     }
+    if((test_mi_settings != nullptr) && (test_mi_settings->isSet())){
+        toJsonValue(QString("testMISettings"), test_mi_settings, obj, QString("SWGTestMISettings"));
+    }
     if((xtrx_input_settings != nullptr) && (xtrx_input_settings->isSet())){
         toJsonValue(QString("xtrxInputSettings"), xtrx_input_settings, obj, QString("SWGXtrxInputSettings"));
     }
     if((xtrx_output_settings != nullptr) && (xtrx_output_settings->isSet())){
         toJsonValue(QString("xtrxOutputSettings"), xtrx_output_settings, obj, QString("SWGXtrxOutputSettings"));
     }
+    if((xtrx_mimo_settings != nullptr) && (xtrx_mimo_settings->isSet())){
+        toJsonValue(QString("xtrxMIMOSettings"), xtrx_mimo_settings, obj, QString("SWGXtrxMIMOSettings"));
+    }
 
     return obj;
 }
@@ -633,6 +681,16 @@ SWGDeviceSettings::setLimeSdrOutputSettings(SWGLimeSdrOutputSettings* lime_sdr_o
     this->m_lime_sdr_output_settings_isSet = true;
 }
 
+SWGLimeSdrMIMOSettings*
+SWGDeviceSettings::getLimeSdrMimoSettings() {
+    return lime_sdr_mimo_settings;
+}
+void
+SWGDeviceSettings::setLimeSdrMimoSettings(SWGLimeSdrMIMOSettings* lime_sdr_mimo_settings) {
+    this->lime_sdr_mimo_settings = lime_sdr_mimo_settings;
+    this->m_lime_sdr_mimo_settings_isSet = true;
+}
+
 SWGLocalInputSettings*
 SWGDeviceSettings::getLocalInputSettings() {
     return local_input_settings;
@@ -683,6 +741,16 @@ SWGDeviceSettings::setPlutoSdrOutputSettings(SWGPlutoSdrOutputSettings* pluto_sd
     this->m_pluto_sdr_output_settings_isSet = true;
 }
 
+SWGPlutoSdrMIMOSettings*
+SWGDeviceSettings::getPlutoSdrMimoSettings() {
+    return pluto_sdr_mimo_settings;
+}
+void
+SWGDeviceSettings::setPlutoSdrMimoSettings(SWGPlutoSdrMIMOSettings* pluto_sdr_mimo_settings) {
+    this->pluto_sdr_mimo_settings = pluto_sdr_mimo_settings;
+    this->m_pluto_sdr_mimo_settings_isSet = true;
+}
+
 SWGRtlSdrSettings*
 SWGDeviceSettings::getRtlSdrSettings() {
     return rtl_sdr_settings;
@@ -753,6 +821,16 @@ SWGDeviceSettings::setTestSourceSettings(SWGTestSourceSettings* test_source_sett
     this->m_test_source_settings_isSet = true;
 }
 
+SWGTestMISettings*
+SWGDeviceSettings::getTestMiSettings() {
+    return test_mi_settings;
+}
+void
+SWGDeviceSettings::setTestMiSettings(SWGTestMISettings* test_mi_settings) {
+    this->test_mi_settings = test_mi_settings;
+    this->m_test_mi_settings_isSet = true;
+}
+
 SWGXtrxInputSettings*
 SWGDeviceSettings::getXtrxInputSettings() {
     return xtrx_input_settings;
@@ -773,6 +851,16 @@ SWGDeviceSettings::setXtrxOutputSettings(SWGXtrxOutputSettings* xtrx_output_sett
     this->m_xtrx_output_settings_isSet = true;
 }
 
+SWGXtrxMIMOSettings*
+SWGDeviceSettings::getXtrxMimoSettings() {
+    return xtrx_mimo_settings;
+}
+void
+SWGDeviceSettings::setXtrxMimoSettings(SWGXtrxMIMOSettings* xtrx_mimo_settings) {
+    this->xtrx_mimo_settings = xtrx_mimo_settings;
+    this->m_xtrx_mimo_settings_isSet = true;
+}
+
 
 bool
 SWGDeviceSettings::isSet(){
@@ -832,6 +920,9 @@ SWGDeviceSettings::isSet(){
         if(lime_sdr_output_settings && lime_sdr_output_settings->isSet()){
             isObjectUpdated = true; break;
         }
+        if(lime_sdr_mimo_settings && lime_sdr_mimo_settings->isSet()){
+            isObjectUpdated = true; break;
+        }
         if(local_input_settings && local_input_settings->isSet()){
             isObjectUpdated = true; break;
         }
@@ -847,6 +938,9 @@ SWGDeviceSettings::isSet(){
         if(pluto_sdr_output_settings && pluto_sdr_output_settings->isSet()){
             isObjectUpdated = true; break;
         }
+        if(pluto_sdr_mimo_settings && pluto_sdr_mimo_settings->isSet()){
+            isObjectUpdated = true; break;
+        }
         if(rtl_sdr_settings && rtl_sdr_settings->isSet()){
             isObjectUpdated = true; break;
         }
@@ -868,12 +962,18 @@ SWGDeviceSettings::isSet(){
         if(test_source_settings && test_source_settings->isSet()){
             isObjectUpdated = true; break;
         }
+        if(test_mi_settings && test_mi_settings->isSet()){
+            isObjectUpdated = true; break;
+        }
         if(xtrx_input_settings && xtrx_input_settings->isSet()){
             isObjectUpdated = true; break;
         }
         if(xtrx_output_settings && xtrx_output_settings->isSet()){
             isObjectUpdated = true; break;
         }
+        if(xtrx_mimo_settings && xtrx_mimo_settings->isSet()){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
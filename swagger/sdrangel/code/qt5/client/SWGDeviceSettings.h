@@ -52,6 +52,10 @@
 #include "SWGXtrxInputSettings.h"
 #include "SWGXtrxOutputSettings.h"
 #include <QString>
+#include "SWGTestMISettings.h"
+#include "SWGXtrxMIMOSettings.h"
+#include "SWGLimeSdrMIMOSettings.h"
+#include "SWGPlutoSdrMIMOSettings.h"
 
 #include "SWGObject.h"
 #include "export.h"
@@ -125,6 +129,9 @@ public:
     SWGLimeSdrOutputSettings* getLimeSdrOutputSettings();
     void setLimeSdrOutputSettings(SWGLimeSdrOutputSettings* lime_sdr_output_settings);
 
+    SWGLimeSdrMIMOSettings* getLimeSdrMimoSettings();
+    void setLimeSdrMimoSettings(SWGLimeSdrMIMOSettings* lime_sdr_mimo_settings);
+
     SWGLocalInputSettings* getLocalInputSettings();
     void setLocalInputSettings(SWGLocalInputSettings* local_input_settings);
 
@@ -140,6 +147,9 @@ public:
     SWGPlutoSdrOutputSettings* getPlutoSdrOutputSettings();
     void setPlutoSdrOutputSettings(SWGPlutoSdrOutputSettings* pluto_sdr_output_settings);
 
+    SWGPlutoSdrMIMOSettings* getPlutoSdrMimoSettings();
+    void setPlutoSdrMimoSettings(SWGPlutoSdrMIMOSettings* pluto_sdr_mimo_settings);
+
     SWGRtlSdrSettings* getRtlSdrSettings();
     void setRtlSdrSettings(SWGRtlSdrSettings* rtl_sdr_settings);
 
@@ -161,12 +171,18 @@ public:
     SWGTestSourceSettings* getTestSourceSettings();
     void setTestSourceSettings(SWGTestSourceSettings* test_source_settings);
 
+    SWGTestMISettings* getTestMiSettings();
+    void setTestMiSettings(SWGTestMISettings* test_mi_settings);
+
     SWGXtrxInputSettings* getXtrxInputSettings();
     void setXtrxInputSettings(SWGXtrxInputSettings* xtrx_input_settings);
 
     SWGXtrxOutputSettings* getXtrxOutputSettings();
     void setXtrxOutputSettings(SWGXtrxOutputSettings* xtrx_output_settings);
 
+    SWGXtrxMIMOSettings* getXtrxMimoSettings();
+    void setXtrxMimoSettings(SWGXtrxMIMOSettings* xtrx_mimo_settings);
+
 
     virtual bool isSet() override;
 
@@ -225,6 +241,9 @@ private:
     SWGLimeSdrOutputSettings* lime_sdr_output_settings;
     bool m_lime_sdr_output_settings_isSet;
 
+    SWGLimeSdrMIMOSettings* lime_sdr_mimo_settings;
+    bool m_lime_sdr_mimo_settings_isSet;
+
     SWGLocalInputSettings* local_input_settings;
     bool m_local_input_settings_isSet;
 
@@ -240,6 +259,9 @@ private:
     SWGPlutoSdrOutputSettings* pluto_sdr_output_settings;
     bool m_pluto_sdr_output_settings_isSet;
 
+    SWGPlutoSdrMIMOSettings* pluto_sdr_mimo_settings;
+    bool m_pluto_sdr_mimo_settings_isSet;
+
     SWGRtlSdrSettings* rtl_sdr_settings;
     bool m_rtl_sdr_settings_isSet;
 
@@ -261,12 +283,18 @@ private:
     SWGTestSourceSettings* test_source_settings;
     bool m_test_source_settings_isSet;
 
+    SWGTestMISettings* test_mi_settings;
+    bool m_test_mi_settings_isSet;
+
     SWGXtrxInputSettings* xtrx_input_settings;
     bool m_xtrx_input_settings_isSet;
 
     SWGXtrxOutputSettings* xtrx_output_settings;
     bool m_xtrx_output_settings_isSet;
 
+    SWGXtrxMIMOSettings* xtrx_mimo_settings;
+    bool m_xtrx_mimo_settings_isSet;
+
 };
 
 }
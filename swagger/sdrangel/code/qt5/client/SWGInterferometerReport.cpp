@@ -0,0 +1,137 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGInterferometerReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGInterferometerReport::SWGInterferometerReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGInterferometerReport::SWGInterferometerReport() {
+    channel_sample_rate = 0;
+    m_channel_sample_rate_isSet = false;
+    streams = nullptr;
+    m_streams_isSet = false;
+}
+
+SWGInterferometerReport::~SWGInterferometerReport() {
+    this->cleanup();
+}
+
+void
+SWGInterferometerReport::init() {
+    channel_sample_rate = 0;
+    m_channel_sample_rate_isSet = false;
+    streams = new QList<SWGInterferometerStreamReport*>();
+    m_streams_isSet = false;
+}
+
+void
+SWGInterferometerReport::cleanup() {
+
+    if(streams != nullptr) { 
+        auto arr = streams;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete streams;
+    }
+}
+
+SWGInterferometerReport*
+SWGInterferometerReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGInterferometerReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&channel_sample_rate, pJson["channelSampleRate"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&streams, pJson["streams"], "QList", "SWGInterferometerStreamReport");
+}
+
+QString
+SWGInterferometerReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGInterferometerReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_channel_sample_rate_isSet){
+        obj->insert("channelSampleRate", QJsonValue(channel_sample_rate));
+    }
+    if(streams && streams->size() > 0){
+        toJsonArray((QList<void*>*)streams, obj, "streams", "SWGInterferometerStreamReport");
+    }
+
+    return obj;
+}
+
+qint32
+SWGInterferometerReport::getChannelSampleRate() {
+    return channel_sample_rate;
+}
+void
+SWGInterferometerReport::setChannelSampleRate(qint32 channel_sample_rate) {
+    this->channel_sample_rate = channel_sample_rate;
+    this->m_channel_sample_rate_isSet = true;
+}
+
+QList<SWGInterferometerStreamReport*>*
+SWGInterferometerReport::getStreams() {
+    return streams;
+}
+void
+SWGInterferometerReport::setStreams(QList<SWGInterferometerStreamReport*>* streams) {
+    this->streams = streams;
+    this->m_streams_isSet = true;
+}
+
+
+bool
+SWGInterferometerReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_channel_sample_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(streams && (streams->size() > 0)){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,463 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGInterferometerSettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGInterferometerSettings::SWGInterferometerSettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGInterferometerSettings::SWGInterferometerSettings() {
+    local_device_index = 0;
+    m_local_device_index_isSet = false;
+    rgb_color = 0;
+    m_rgb_color_isSet = false;
+    title = nullptr;
+    m_title_isSet = false;
+    play = 0;
+    m_play_isSet = false;
+    output_type = 0;
+    m_output_type_isSet = false;
+    product_stream_index = 0;
+    m_product_stream_index_isSet = false;
+    steering_angle = 0.0f;
+    m_steering_angle_isSet = false;
+    element_spacing = 0.0f;
+    m_element_spacing_isSet = false;
+    correlation_log2_size = 0;
+    m_correlation_log2_size_isSet = false;
+    auto_align = 0;
+    m_auto_align_isSet = false;
+    streams = nullptr;
+    m_streams_isSet = false;
+    use_reverse_api = 0;
+    m_use_reverse_api_isSet = false;
+    reverse_api_address = nullptr;
+    m_reverse_api_address_isSet = false;
+    reverse_api_port = 0;
+    m_reverse_api_port_isSet = false;
+    reverse_api_device_index = 0;
+    m_reverse_api_device_index_isSet = false;
+    reverse_api_channel_index = 0;
+    m_reverse_api_channel_index_isSet = false;
+}
+
+SWGInterferometerSettings::~SWGInterferometerSettings() {
+    this->cleanup();
+}
+
+void
+SWGInterferometerSettings::init() {
+    local_device_index = 0;
+    m_local_device_index_isSet = false;
+    rgb_color = 0;
+    m_rgb_color_isSet = false;
+    title = new QString("");
+    m_title_isSet = false;
+    play = 0;
+    m_play_isSet = false;
+    output_type = 0;
+    m_output_type_isSet = false;
+    product_stream_index = 0;
+    m_product_stream_index_isSet = false;
+    steering_angle = 0.0f;
+    m_steering_angle_isSet = false;
+    element_spacing = 0.0f;
+    m_element_spacing_isSet = false;
+    correlation_log2_size = 0;
+    m_correlation_log2_size_isSet = false;
+    auto_align = 0;
+    m_auto_align_isSet = false;
+    streams = new QList<SWGInterferometerStreamSettings*>();
+    m_streams_isSet = false;
+    use_reverse_api = 0;
+    m_use_reverse_api_isSet = false;
+    reverse_api_address = new QString("");
+    m_reverse_api_address_isSet = false;
+    reverse_api_port = 0;
+    m_reverse_api_port_isSet = false;
+    reverse_api_device_index = 0;
+    m_reverse_api_device_index_isSet = false;
+    reverse_api_channel_index = 0;
+    m_reverse_api_channel_index_isSet = false;
+}
+
+void
+SWGInterferometerSettings::cleanup() {
+
+
+    if(title != nullptr) { 
+        delete title;
+    }
+
+
+
+
+
+
+
+    if(streams != nullptr) { 
+        auto arr = streams;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete streams;
+    }
+
+    if(reverse_api_address != nullptr) { 
+        delete reverse_api_address;
+    }
+
+
+
+}
+
+SWGInterferometerSettings*
+SWGInterferometerSettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGInterferometerSettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&local_device_index, pJson["localDeviceIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rgb_color, pJson["rgbColor"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&title, pJson["title"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&play, pJson["play"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&output_type, pJson["outputType"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&product_stream_index, pJson["productStreamIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&steering_angle, pJson["steeringAngle"], "float", "");
+    
+    ::SWGSDRangel::setValue(&element_spacing, pJson["elementSpacing"], "float", "");
+    
+    ::SWGSDRangel::setValue(&correlation_log2_size, pJson["correlationLog2Size"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&auto_align, pJson["autoAlign"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&streams, pJson["streams"], "QList", "SWGInterferometerStreamSettings");
+    ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&reverse_api_port, pJson["reverseAPIPort"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&reverse_api_device_index, pJson["reverseAPIDeviceIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&reverse_api_channel_index, pJson["reverseAPIChannelIndex"], "qint32", "");
+    
+}
+
+QString
+SWGInterferometerSettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGInterferometerSettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_local_device_index_isSet){
+        obj->insert("localDeviceIndex", QJsonValue(local_device_index));
+    }
+    if(m_rgb_color_isSet){
+        obj->insert("rgbColor", QJsonValue(rgb_color));
+    }
+    if(title != nullptr && *title != QString("")){
+        toJsonValue(QString("title"), title, obj, QString("QString"));
+    }
+    if(m_play_isSet){
+        obj->insert("play", QJsonValue(play));
+    }
+    if(m_output_type_isSet){
+        obj->insert("outputType", QJsonValue(output_type));
+    }
+    if(m_product_stream_index_isSet){
+        obj->insert("productStreamIndex", QJsonValue(product_stream_index));
+    }
+    if(m_steering_angle_isSet){
+        obj->insert("steeringAngle", QJsonValue(steering_angle));
+    }
+    if(m_element_spacing_isSet){
+        obj->insert("elementSpacing", QJsonValue(element_spacing));
+    }
+    if(m_correlation_log2_size_isSet){
+        obj->insert("correlationLog2Size", QJsonValue(correlation_log2_size));
+    }
+    if(m_auto_align_isSet){
+        obj->insert("autoAlign", QJsonValue(auto_align));
+    }
+    if(streams && streams->size() > 0){
+        toJsonArray((QList<void*>*)streams, obj, "streams", "SWGInterferometerStreamSettings");
+    }
+    if(m_use_reverse_api_isSet){
+        obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
+    }
+    if(reverse_api_address != nullptr && *reverse_api_address != QString("")){
+        toJsonValue(QString("reverseAPIAddress"), reverse_api_address, obj, QString("QString"));
+    }
+    if(m_reverse_api_port_isSet){
+        obj->insert("reverseAPIPort", QJsonValue(reverse_api_port));
+    }
+    if(m_reverse_api_device_index_isSet){
+        obj->insert("reverseAPIDeviceIndex", QJsonValue(reverse_api_device_index));
+    }
+    if(m_reverse_api_channel_index_isSet){
+        obj->insert("reverseAPIChannelIndex", QJsonValue(reverse_api_channel_index));
+    }
+
+    return obj;
+}
+
+qint32
+SWGInterferometerSettings::getLocalDeviceIndex() {
+    return local_device_index;
+}
+void
+SWGInterferometerSettings::setLocalDeviceIndex(qint32 local_device_index) {
+    this->local_device_index = local_device_index;
+    this->m_local_device_index_isSet = true;
+}
+
+qint32
+SWGInterferometerSettings::getRgbColor() {
+    return rgb_color;
+}
+void
+SWGInterferometerSettings::setRgbColor(qint32 rgb_color) {
+    this->rgb_color = rgb_color;
+    this->m_rgb_color_isSet = true;
+}
+
+QString*
+SWGInterferometerSettings::getTitle() {
+    return title;
+}
+void
+SWGInterferometerSettings::setTitle(QString* title) {
+    this->title = title;
+    this->m_title_isSet = true;
+}
+
+qint32
+SWGInterferometerSettings::getPlay() {
+    return play;
+}
+void
+SWGInterferometerSettings::setPlay(qint32 play) {
+    this->play = play;
+    this->m_play_isSet = true;
+}
+
+qint32
+SWGInterferometerSettings::getOutputType() {
+    return output_type;
+}
+void
+SWGInterferometerSettings::setOutputType(qint32 output_type) {
+    this->output_type = output_type;
+    this->m_output_type_isSet = true;
+}
+
+qint32
+SWGInterferometerSettings::getProductStreamIndex() {
+    return product_stream_index;
+}
+void
+SWGInterferometerSettings::setProductStreamIndex(qint32 product_stream_index) {
+    this->product_stream_index = product_stream_index;
+    this->m_product_stream_index_isSet = true;
+}
+
+float
+SWGInterferometerSettings::getSteeringAngle() {
+    return steering_angle;
+}
+void
+SWGInterferometerSettings::setSteeringAngle(float steering_angle) {
+    this->steering_angle = steering_angle;
+    this->m_steering_angle_isSet = true;
+}
+
+float
+SWGInterferometerSettings::getElementSpacing() {
+    return element_spacing;
+}
+void
+SWGInterferometerSettings::setElementSpacing(float element_spacing) {
+    this->element_spacing = element_spacing;
+    this->m_element_spacing_isSet = true;
+}
+
+qint32
+SWGInterferometerSettings::getCorrelationLog2Size() {
+    return correlation_log2_size;
+}
+void
+SWGInterferometerSettings::setCorrelationLog2Size(qint32 correlation_log2_size) {
+    this->correlation_log2_size = correlation_log2_size;
+    this->m_correlation_log2_size_isSet = true;
+}
+
+qint32
+SWGInterferometerSettings::getAutoAlign() {
+    return auto_align;
+}
+void
+SWGInterferometerSettings::setAutoAlign(qint32 auto_align) {
+    this->auto_align = auto_align;
+    this->m_auto_align_isSet = true;
+}
+
+QList<SWGInterferometerStreamSettings*>*
+SWGInterferometerSettings::getStreams() {
+    return streams;
+}
+void
+SWGInterferometerSettings::setStreams(QList<SWGInterferometerStreamSettings*>* streams) {
+    this->streams = streams;
+    this->m_streams_isSet = true;
+}
+
+qint32
+SWGInterferometerSettings::getUseReverseApi() {
+    return use_reverse_api;
+}
+void
+SWGInterferometerSettings::setUseReverseApi(qint32 use_reverse_api) {
+    this->use_reverse_api = use_reverse_api;
+    this->m_use_reverse_api_isSet = true;
+}
+
+QString*
+SWGInterferometerSettings::getReverseApiAddress() {
+    return reverse_api_address;
+}
+void
+SWGInterferometerSettings::setReverseApiAddress(QString* reverse_api_address) {
+    this->reverse_api_address = reverse_api_address;
+    this->m_reverse_api_address_isSet = true;
+}
+
+qint32
+SWGInterferometerSettings::getReverseApiPort() {
+    return reverse_api_port;
+}
+void
+SWGInterferometerSettings::setReverseApiPort(qint32 reverse_api_port) {
+    this->reverse_api_port = reverse_api_port;
+    this->m_reverse_api_port_isSet = true;
+}
+
+qint32
+SWGInterferometerSettings::getReverseApiDeviceIndex() {
+    return reverse_api_device_index;
+}
+void
+SWGInterferometerSettings::setReverseApiDeviceIndex(qint32 reverse_api_device_index) {
+    this->reverse_api_device_index = reverse_api_device_index;
+    this->m_reverse_api_device_index_isSet = true;
+}
+
+qint32
+SWGInterferometerSettings::getReverseApiChannelIndex() {
+    return reverse_api_channel_index;
+}
+void
+SWGInterferometerSettings::setReverseApiChannelIndex(qint32 reverse_api_channel_index) {
+    this->reverse_api_channel_index = reverse_api_channel_index;
+    this->m_reverse_api_channel_index_isSet = true;
+}
+
+
+bool
+SWGInterferometerSettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_local_device_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rgb_color_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(title && *title != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_play_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_output_type_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_product_stream_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_steering_angle_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_element_spacing_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_correlation_log2_size_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_auto_align_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(streams && (streams->size() > 0)){
+            isObjectUpdated = true; break;
+        }
+        if(m_use_reverse_api_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(reverse_api_address && *reverse_api_address != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_reverse_api_port_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_reverse_api_device_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_reverse_api_channel_index_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,151 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGInterferometerSettings.h
+ *
+ * Interferometer (MIMO channel combining the streams of a phase coherent device)
+ */
+
+#ifndef SWGInterferometerSettings_H_
+#define SWGInterferometerSettings_H_
+
+#include <QJsonObject>
+
+
+#include "SWGInterferometerStreamSettings.h"
+#include <QList>
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGInterferometerSettings: public SWGObject {
+public:
+    SWGInterferometerSettings();
+    SWGInterferometerSettings(QString* json);
+    virtual ~SWGInterferometerSettings();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGInterferometerSettings* fromJson(QString &jsonString) override;
+
+    qint32 getLocalDeviceIndex();
+    void setLocalDeviceIndex(qint32 local_device_index);
+
+    qint32 getRgbColor();
+    void setRgbColor(qint32 rgb_color);
+
+    QString* getTitle();
+    void setTitle(QString* title);
+
+    qint32 getPlay();
+    void setPlay(qint32 play);
+
+    qint32 getOutputType();
+    void setOutputType(qint32 output_type);
+
+    qint32 getProductStreamIndex();
+    void setProductStreamIndex(qint32 product_stream_index);
+
+    float getSteeringAngle();
+    void setSteeringAngle(float steering_angle);
+
+    float getElementSpacing();
+    void setElementSpacing(float element_spacing);
+
+    qint32 getCorrelationLog2Size();
+    void setCorrelationLog2Size(qint32 correlation_log2_size);
+
+    qint32 getAutoAlign();
+    void setAutoAlign(qint32 auto_align);
+
+    QList<SWGInterferometerStreamSettings*>* getStreams();
+    void setStreams(QList<SWGInterferometerStreamSettings*>* streams);
+
+    qint32 getUseReverseApi();
+    void setUseReverseApi(qint32 use_reverse_api);
+
+    QString* getReverseApiAddress();
+    void setReverseApiAddress(QString* reverse_api_address);
+
+    qint32 getReverseApiPort();
+    void setReverseApiPort(qint32 reverse_api_port);
+
+    qint32 getReverseApiDeviceIndex();
+    void setReverseApiDeviceIndex(qint32 reverse_api_device_index);
+
+    qint32 getReverseApiChannelIndex();
+    void setReverseApiChannelIndex(qint32 reverse_api_channel_index);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 local_device_index;
+    bool m_local_device_index_isSet;
+
+    qint32 rgb_color;
+    bool m_rgb_color_isSet;
+
+    QString* title;
+    bool m_title_isSet;
+
+    qint32 play;
+    bool m_play_isSet;
+
+    qint32 output_type;
+    bool m_output_type_isSet;
+
+    qint32 product_stream_index;
+    bool m_product_stream_index_isSet;
+
+    float steering_angle;
+    bool m_steering_angle_isSet;
+
+    float element_spacing;
+    bool m_element_spacing_isSet;
+
+    qint32 correlation_log2_size;
+    bool m_correlation_log2_size_isSet;
+
+    qint32 auto_align;
+    bool m_auto_align_isSet;
+
+    QList<SWGInterferometerStreamSettings*>* streams;
+    bool m_streams_isSet;
+
+    qint32 use_reverse_api;
+    bool m_use_reverse_api_isSet;
+
+    QString* reverse_api_address;
+    bool m_reverse_api_address_isSet;
+
+    qint32 reverse_api_port;
+    bool m_reverse_api_port_isSet;
+
+    qint32 reverse_api_device_index;
+    bool m_reverse_api_device_index_isSet;
+
+    qint32 reverse_api_channel_index;
+    bool m_reverse_api_channel_index_isSet;
+
+};
+
+}
+
+#endif /* SWGInterferometerSettings_H_ */
@@ -0,0 +1,177 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGInterferometerStreamReport.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGInterferometerStreamReport::SWGInterferometerStreamReport(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGInterferometerStreamReport::SWGInterferometerStreamReport() {
+    stream_index = 0;
+    m_stream_index_isSet = false;
+    delay = 0;
+    m_delay_isSet = false;
+    phase = 0.0f;
+    m_phase_isSet = false;
+    coherence = 0.0f;
+    m_coherence_isSet = false;
+}
+
+SWGInterferometerStreamReport::~SWGInterferometerStreamReport() {
+    this->cleanup();
+}
+
+void
+SWGInterferometerStreamReport::init() {
+    stream_index = 0;
+    m_stream_index_isSet = false;
+    delay = 0;
+    m_delay_isSet = false;
+    phase = 0.0f;
+    m_phase_isSet = false;
+    coherence = 0.0f;
+    m_coherence_isSet = false;
+}
+
+void
+SWGInterferometerStreamReport::cleanup() {
+
+
+
+
+}
+
+SWGInterferometerStreamReport*
+SWGInterferometerStreamReport::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGInterferometerStreamReport::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&stream_index, pJson["streamIndex"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&delay, pJson["delay"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&phase, pJson["phase"], "float", "");
+    
+    ::SWGSDRangel::setValue(&coherence, pJson["coherence"], "float", "");
+    
+}
+
+QString
+SWGInterferometerStreamReport::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGInterferometerStreamReport::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_stream_index_isSet){
+        obj->insert("streamIndex", QJsonValue(stream_index));
+    }
+    if(m_delay_isSet){
+        obj->insert("delay", QJsonValue(delay));
+    }
+    if(m_phase_isSet){
+        obj->insert("phase", QJsonValue(phase));
+    }
+    if(m_coherence_isSet){
+        obj->insert("coherence", QJsonValue(coherence));
+    }
+
+    return obj;
+}
+
+qint32
+SWGInterferometerStreamReport::getStreamIndex() {
+    return stream_index;
+}
+void
+SWGInterferometerStreamReport::setStreamIndex(qint32 stream_index) {
+    this->stream_index = stream_index;
+    this->m_stream_index_isSet = true;
+}
+
+qint32
+SWGInterferometerStreamReport::getDelay() {
+    return delay;
+}
+void
+SWGInterferometerStreamReport::setDelay(qint32 delay) {
+    this->delay = delay;
+    this->m_delay_isSet = true;
+}
+
+float
+SWGInterferometerStreamReport::getPhase() {
+    return phase;
+}
+void
+SWGInterferometerStreamReport::setPhase(float phase) {
+    this->phase = phase;
+    this->m_phase_isSet = true;
+}
+
+float
+SWGInterferometerStreamReport::getCoherence() {
+    return coherence;
+}
+void
+SWGInterferometerStreamReport::setCoherence(float coherence) {
+    this->coherence = coherence;
+    this->m_coherence_isSet = true;
+}
+
+
+bool
+SWGInterferometerStreamReport::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_stream_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_delay_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_phase_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_coherence_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
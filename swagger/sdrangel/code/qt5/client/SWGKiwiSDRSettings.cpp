@@ -38,6 +38,8 @@ SWGKiwiSDRSettings::SWGKiwiSDRSettings() {
     m_center_frequency_isSet = false;
     server_address = nullptr;
     m_server_address_isSet = false;
+    nb_receivers = 0;
+    m_nb_receivers_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = nullptr;
@@ -64,6 +66,8 @@ SWGKiwiSDRSettings::init() {
     m_center_frequency_isSet = false;
     server_address = new QString("");
     m_server_address_isSet = false;
+    nb_receivers = 0;
+    m_nb_receivers_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = new QString("");
@@ -112,6 +116,8 @@ SWGKiwiSDRSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&server_address, pJson["serverAddress"], "QString", "QString");
     
+    ::SWGSDRangel::setValue(&nb_receivers, pJson["nbReceivers"], "qint32", "");
+    
     ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
     
     ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
@@ -151,6 +157,9 @@ SWGKiwiSDRSettings::asJsonObject() {
     if(server_address != nullptr && *server_address != QString("")){
         toJsonValue(QString("serverAddress"), server_address, obj, QString("QString"));
     }
+    if(m_nb_receivers_isSet){
+        obj->insert("nbReceivers", QJsonValue(nb_receivers));
+    }
     if(m_use_reverse_api_isSet){
         obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
     }
@@ -217,6 +226,16 @@ SWGKiwiSDRSettings::setServerAddress(QString* server_address) {
     this->m_server_address_isSet = true;
 }
 
+qint32
+SWGKiwiSDRSettings::getNbReceivers() {
+    return nb_receivers;
+}
+void
+SWGKiwiSDRSettings::setNbReceivers(qint32 nb_receivers) {
+    this->nb_receivers = nb_receivers;
+    this->m_nb_receivers_isSet = true;
+}
+
 qint32
 SWGKiwiSDRSettings::getUseReverseApi() {
     return use_reverse_api;
@@ -277,6 +296,9 @@ SWGKiwiSDRSettings::isSet(){
         if(server_address && *server_address != QString("")){
             isObjectUpdated = true; break;
         }
+        if(m_nb_receivers_isSet){
+            isObjectUpdated = true; break;
+        }
         if(m_use_reverse_api_isSet){
             isObjectUpdated = true; break;
         }
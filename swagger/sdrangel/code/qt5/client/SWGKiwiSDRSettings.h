@@ -57,6 +57,9 @@ public:
     QString* getServerAddress();
     void setServerAddress(QString* server_address);
 
+    qint32 getNbReceivers();
+    void setNbReceivers(qint32 nb_receivers);
+
     qint32 getUseReverseApi();
     void setUseReverseApi(qint32 use_reverse_api);
 
@@ -88,6 +91,9 @@ private:
     QString* server_address;
     bool m_server_address_isSet;
 
+    qint32 nb_receivers;
+    bool m_nb_receivers_isSet;
+
     qint32 use_reverse_api;
     bool m_use_reverse_api_isSet;
 
@@ -0,0 +1,476 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGLimeSdrMIMOSettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGLimeSdrMIMOSettings::SWGLimeSdrMIMOSettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGLimeSdrMIMOSettings::SWGLimeSdrMIMOSettings() {
+    dev_sample_rate = 0;
+    m_dev_sample_rate_isSet = false;
+    log2_hard_decim = 0;
+    m_log2_hard_decim_isSet = false;
+    rx_center_frequency = 0L;
+    m_rx_center_frequency_isSet = false;
+    log2_soft_decim = 0;
+    m_log2_soft_decim_isSet = false;
+    fc_pos_rx = 0;
+    m_fc_pos_rx_isSet = false;
+    lpf_bw = 0;
+    m_lpf_bw_isSet = false;
+    antenna_path = 0;
+    m_antenna_path_isSet = false;
+    rx0_gain = 0;
+    m_rx0_gain_isSet = false;
+    rx1_gain = 0;
+    m_rx1_gain_isSet = false;
+    ext_clock = 0;
+    m_ext_clock_isSet = false;
+    ext_clock_freq = 0;
+    m_ext_clock_freq_isSet = false;
+    dc_block = 0;
+    m_dc_block_isSet = false;
+    iq_correction = 0;
+    m_iq_correction_isSet = false;
+    rx_transverter_mode = 0;
+    m_rx_transverter_mode_isSet = false;
+    rx_transverter_delta_frequency = 0L;
+    m_rx_transverter_delta_frequency_isSet = false;
+    iq_order = 0;
+    m_iq_order_isSet = false;
+    spectrum_stream_index = 0;
+    m_spectrum_stream_index_isSet = false;
+}
+
+SWGLimeSdrMIMOSettings::~SWGLimeSdrMIMOSettings() {
+    this->cleanup();
+}
+
+void
+SWGLimeSdrMIMOSettings::init() {
+    dev_sample_rate = 0;
+    m_dev_sample_rate_isSet = false;
+    log2_hard_decim = 0;
+    m_log2_hard_decim_isSet = false;
+    rx_center_frequency = 0L;
+    m_rx_center_frequency_isSet = false;
+    log2_soft_decim = 0;
+    m_log2_soft_decim_isSet = false;
+    fc_pos_rx = 0;
+    m_fc_pos_rx_isSet = false;
+    lpf_bw = 0;
+    m_lpf_bw_isSet = false;
+    antenna_path = 0;
+    m_antenna_path_isSet = false;
+    rx0_gain = 0;
+    m_rx0_gain_isSet = false;
+    rx1_gain = 0;
+    m_rx1_gain_isSet = false;
+    ext_clock = 0;
+    m_ext_clock_isSet = false;
+    ext_clock_freq = 0;
+    m_ext_clock_freq_isSet = false;
+    dc_block = 0;
+    m_dc_block_isSet = false;
+    iq_correction = 0;
+    m_iq_correction_isSet = false;
+    rx_transverter_mode = 0;
+    m_rx_transverter_mode_isSet = false;
+    rx_transverter_delta_frequency = 0L;
+    m_rx_transverter_delta_frequency_isSet = false;
+    iq_order = 0;
+    m_iq_order_isSet = false;
+    spectrum_stream_index = 0;
+    m_spectrum_stream_index_isSet = false;
+}
+
+void
+SWGLimeSdrMIMOSettings::cleanup() {
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+}
+
+SWGLimeSdrMIMOSettings*
+SWGLimeSdrMIMOSettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGLimeSdrMIMOSettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&dev_sample_rate, pJson["devSampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&log2_hard_decim, pJson["log2HardDecim"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx_center_frequency, pJson["rxCenterFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&log2_soft_decim, pJson["log2SoftDecim"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fc_pos_rx, pJson["fcPosRx"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&lpf_bw, pJson["lpfBW"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&antenna_path, pJson["antennaPath"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx0_gain, pJson["rx0Gain"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx1_gain, pJson["rx1Gain"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&ext_clock, pJson["extClock"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&ext_clock_freq, pJson["extClockFreq"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&dc_block, pJson["dcBlock"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&iq_correction, pJson["iqCorrection"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx_transverter_mode, pJson["rxTransverterMode"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx_transverter_delta_frequency, pJson["rxTransverterDeltaFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&iq_order, pJson["iqOrder"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&spectrum_stream_index, pJson["spectrumStreamIndex"], "qint32", "");
+    
+}
+
+QString
+SWGLimeSdrMIMOSettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGLimeSdrMIMOSettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_dev_sample_rate_isSet){
+        obj->insert("devSampleRate", QJsonValue(dev_sample_rate));
+    }
+    if(m_log2_hard_decim_isSet){
+        obj->insert("log2HardDecim", QJsonValue(log2_hard_decim));
+    }
+    if(m_rx_center_frequency_isSet){
+        obj->insert("rxCenterFrequency", QJsonValue(rx_center_frequency));
+    }
+    if(m_log2_soft_decim_isSet){
+        obj->insert("log2SoftDecim", QJsonValue(log2_soft_decim));
+    }
+    if(m_fc_pos_rx_isSet){
+        obj->insert("fcPosRx", QJsonValue(fc_pos_rx));
+    }
+    if(m_lpf_bw_isSet){
+        obj->insert("lpfBW", QJsonValue(lpf_bw));
+    }
+    if(m_antenna_path_isSet){
+        obj->insert("antennaPath", QJsonValue(antenna_path));
+    }
+    if(m_rx0_gain_isSet){
+        obj->insert("rx0Gain", QJsonValue(rx0_gain));
+    }
+    if(m_rx1_gain_isSet){
+        obj->insert("rx1Gain", QJsonValue(rx1_gain));
+    }
+    if(m_ext_clock_isSet){
+        obj->insert("extClock", QJsonValue(ext_clock));
+    }
+    if(m_ext_clock_freq_isSet){
+        obj->insert("extClockFreq", QJsonValue(ext_clock_freq));
+    }
+    if(m_dc_block_isSet){
+        obj->insert("dcBlock", QJsonValue(dc_block));
+    }
+    if(m_iq_correction_isSet){
+        obj->insert("iqCorrection", QJsonValue(iq_correction));
+    }
+    if(m_rx_transverter_mode_isSet){
+        obj->insert("rxTransverterMode", QJsonValue(rx_transverter_mode));
+    }
+    if(m_rx_transverter_delta_frequency_isSet){
+        obj->insert("rxTransverterDeltaFrequency", QJsonValue(rx_transverter_delta_frequency));
+    }
+    if(m_iq_order_isSet){
+        obj->insert("iqOrder", QJsonValue(iq_order));
+    }
+    if(m_spectrum_stream_index_isSet){
+        obj->insert("spectrumStreamIndex", QJsonValue(spectrum_stream_index));
+    }
+
+    return obj;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getDevSampleRate() {
+    return dev_sample_rate;
+}
+void
+SWGLimeSdrMIMOSettings::setDevSampleRate(qint32 dev_sample_rate) {
+    this->dev_sample_rate = dev_sample_rate;
+    this->m_dev_sample_rate_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getLog2HardDecim() {
+    return log2_hard_decim;
+}
+void
+SWGLimeSdrMIMOSettings::setLog2HardDecim(qint32 log2_hard_decim) {
+    this->log2_hard_decim = log2_hard_decim;
+    this->m_log2_hard_decim_isSet = true;
+}
+
+qint64
+SWGLimeSdrMIMOSettings::getRxCenterFrequency() {
+    return rx_center_frequency;
+}
+void
+SWGLimeSdrMIMOSettings::setRxCenterFrequency(qint64 rx_center_frequency) {
+    this->rx_center_frequency = rx_center_frequency;
+    this->m_rx_center_frequency_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getLog2SoftDecim() {
+    return log2_soft_decim;
+}
+void
+SWGLimeSdrMIMOSettings::setLog2SoftDecim(qint32 log2_soft_decim) {
+    this->log2_soft_decim = log2_soft_decim;
+    this->m_log2_soft_decim_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getFcPosRx() {
+    return fc_pos_rx;
+}
+void
+SWGLimeSdrMIMOSettings::setFcPosRx(qint32 fc_pos_rx) {
+    this->fc_pos_rx = fc_pos_rx;
+    this->m_fc_pos_rx_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getLpfBw() {
+    return lpf_bw;
+}
+void
+SWGLimeSdrMIMOSettings::setLpfBw(qint32 lpf_bw) {
+    this->lpf_bw = lpf_bw;
+    this->m_lpf_bw_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getAntennaPath() {
+    return antenna_path;
+}
+void
+SWGLimeSdrMIMOSettings::setAntennaPath(qint32 antenna_path) {
+    this->antenna_path = antenna_path;
+    this->m_antenna_path_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getRx0Gain() {
+    return rx0_gain;
+}
+void
+SWGLimeSdrMIMOSettings::setRx0Gain(qint32 rx0_gain) {
+    this->rx0_gain = rx0_gain;
+    this->m_rx0_gain_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getRx1Gain() {
+    return rx1_gain;
+}
+void
+SWGLimeSdrMIMOSettings::setRx1Gain(qint32 rx1_gain) {
+    this->rx1_gain = rx1_gain;
+    this->m_rx1_gain_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getExtClock() {
+    return ext_clock;
+}
+void
+SWGLimeSdrMIMOSettings::setExtClock(qint32 ext_clock) {
+    this->ext_clock = ext_clock;
+    this->m_ext_clock_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getExtClockFreq() {
+    return ext_clock_freq;
+}
+void
+SWGLimeSdrMIMOSettings::setExtClockFreq(qint32 ext_clock_freq) {
+    this->ext_clock_freq = ext_clock_freq;
+    this->m_ext_clock_freq_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getDcBlock() {
+    return dc_block;
+}
+void
+SWGLimeSdrMIMOSettings::setDcBlock(qint32 dc_block) {
+    this->dc_block = dc_block;
+    this->m_dc_block_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getIqCorrection() {
+    return iq_correction;
+}
+void
+SWGLimeSdrMIMOSettings::setIqCorrection(qint32 iq_correction) {
+    this->iq_correction = iq_correction;
+    this->m_iq_correction_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getRxTransverterMode() {
+    return rx_transverter_mode;
+}
+void
+SWGLimeSdrMIMOSettings::setRxTransverterMode(qint32 rx_transverter_mode) {
+    this->rx_transverter_mode = rx_transverter_mode;
+    this->m_rx_transverter_mode_isSet = true;
+}
+
+qint64
+SWGLimeSdrMIMOSettings::getRxTransverterDeltaFrequency() {
+    return rx_transverter_delta_frequency;
+}
+void
+SWGLimeSdrMIMOSettings::setRxTransverterDeltaFrequency(qint64 rx_transverter_delta_frequency) {
+    this->rx_transverter_delta_frequency = rx_transverter_delta_frequency;
+    this->m_rx_transverter_delta_frequency_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getIqOrder() {
+    return iq_order;
+}
+void
+SWGLimeSdrMIMOSettings::setIqOrder(qint32 iq_order) {
+    this->iq_order = iq_order;
+    this->m_iq_order_isSet = true;
+}
+
+qint32
+SWGLimeSdrMIMOSettings::getSpectrumStreamIndex() {
+    return spectrum_stream_index;
+}
+void
+SWGLimeSdrMIMOSettings::setSpectrumStreamIndex(qint32 spectrum_stream_index) {
+    this->spectrum_stream_index = spectrum_stream_index;
+    this->m_spectrum_stream_index_isSet = true;
+}
+
+
+bool
+SWGLimeSdrMIMOSettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_dev_sample_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_log2_hard_decim_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx_center_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_log2_soft_decim_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fc_pos_rx_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_lpf_bw_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_antenna_path_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx0_gain_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx1_gain_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_ext_clock_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_ext_clock_freq_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_dc_block_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_iq_correction_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx_transverter_mode_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx_transverter_delta_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_iq_order_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_spectrum_stream_index_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
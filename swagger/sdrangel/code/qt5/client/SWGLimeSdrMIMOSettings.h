@@ -0,0 +1,154 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGLimeSdrMIMOSettings.h
+ *
+ * LimeSDR
+ */
+
+#ifndef SWGLimeSdrMIMOSettings_H_
+#define SWGLimeSdrMIMOSettings_H_
+
+#include <QJsonObject>
+
+
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGLimeSdrMIMOSettings: public SWGObject {
+public:
+    SWGLimeSdrMIMOSettings();
+    SWGLimeSdrMIMOSettings(QString* json);
+    virtual ~SWGLimeSdrMIMOSettings();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGLimeSdrMIMOSettings* fromJson(QString &jsonString) override;
+
+    qint32 getDevSampleRate();
+    void setDevSampleRate(qint32 dev_sample_rate);
+
+    qint32 getLog2HardDecim();
+    void setLog2HardDecim(qint32 log2_hard_decim);
+
+    qint64 getRxCenterFrequency();
+    void setRxCenterFrequency(qint64 rx_center_frequency);
+
+    qint32 getLog2SoftDecim();
+    void setLog2SoftDecim(qint32 log2_soft_decim);
+
+    qint32 getFcPosRx();
+    void setFcPosRx(qint32 fc_pos_rx);
+
+    qint32 getLpfBw();
+    void setLpfBw(qint32 lpf_bw);
+
+    qint32 getAntennaPath();
+    void setAntennaPath(qint32 antenna_path);
+
+    qint32 getRx0Gain();
+    void setRx0Gain(qint32 rx0_gain);
+
+    qint32 getRx1Gain();
+    void setRx1Gain(qint32 rx1_gain);
+
+    qint32 getExtClock();
+    void setExtClock(qint32 ext_clock);
+
+    qint32 getExtClockFreq();
+    void setExtClockFreq(qint32 ext_clock_freq);
+
+    qint32 getDcBlock();
+    void setDcBlock(qint32 dc_block);
+
+    qint32 getIqCorrection();
+    void setIqCorrection(qint32 iq_correction);
+
+    qint32 getRxTransverterMode();
+    void setRxTransverterMode(qint32 rx_transverter_mode);
+
+    qint64 getRxTransverterDeltaFrequency();
+    void setRxTransverterDeltaFrequency(qint64 rx_transverter_delta_frequency);
+
+    qint32 getIqOrder();
+    void setIqOrder(qint32 iq_order);
+
+    qint32 getSpectrumStreamIndex();
+    void setSpectrumStreamIndex(qint32 spectrum_stream_index);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 dev_sample_rate;
+    bool m_dev_sample_rate_isSet;
+
+    qint32 log2_hard_decim;
+    bool m_log2_hard_decim_isSet;
+
+    qint64 rx_center_frequency;
+    bool m_rx_center_frequency_isSet;
+
+    qint32 log2_soft_decim;
+    bool m_log2_soft_decim_isSet;
+
+    qint32 fc_pos_rx;
+    bool m_fc_pos_rx_isSet;
+
+    qint32 lpf_bw;
+    bool m_lpf_bw_isSet;
+
+    qint32 antenna_path;
+    bool m_antenna_path_isSet;
+
+    qint32 rx0_gain;
+    bool m_rx0_gain_isSet;
+
+    qint32 rx1_gain;
+    bool m_rx1_gain_isSet;
+
+    qint32 ext_clock;
+    bool m_ext_clock_isSet;
+
+    qint32 ext_clock_freq;
+    bool m_ext_clock_freq_isSet;
+
+    qint32 dc_block;
+    bool m_dc_block_isSet;
+
+    qint32 iq_correction;
+    bool m_iq_correction_isSet;
+
+    qint32 rx_transverter_mode;
+    bool m_rx_transverter_mode_isSet;
+
+    qint64 rx_transverter_delta_frequency;
+    bool m_rx_transverter_delta_frequency_isSet;
+
+    qint32 iq_order;
+    bool m_iq_order_isSet;
+
+    qint32 spectrum_stream_index;
+    bool m_spectrum_stream_index_isSet;
+
+};
+
+}
+
+#endif /* SWGLimeSdrMIMOSettings_H_ */
@@ -32,6 +32,12 @@ SWGLocalInputReport::SWGLocalInputReport() {
     m_center_frequency_isSet = false;
     sample_rate = 0;
     m_sample_rate_isSet = false;
+    fifo_size = 0;
+    m_fifo_size_isSet = false;
+    fifo_fill = 0;
+    m_fifo_fill_isSet = false;
+    dropped_samples = 0L;
+    m_dropped_samples_isSet = false;
 }
 
 SWGLocalInputReport::~SWGLocalInputReport() {
@@ -44,6 +50,12 @@ SWGLocalInputReport::init() {
     m_center_frequency_isSet = false;
     sample_rate = 0;
     m_sample_rate_isSet = false;
+    fifo_size = 0;
+    m_fifo_size_isSet = false;
+    fifo_fill = 0;
+    m_fifo_fill_isSet = false;
+    dropped_samples = 0L;
+    m_dropped_samples_isSet = false;
 }
 
 void
@@ -67,6 +79,12 @@ SWGLocalInputReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&sample_rate, pJson["sampleRate"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&fifo_size, pJson["fifoSize"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fifo_fill, pJson["fifoFill"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&dropped_samples, pJson["droppedSamples"], "qint64", "");
+    
 }
 
 QString
@@ -89,6 +107,15 @@ SWGLocalInputReport::asJsonObject() {
     if(m_sample_rate_isSet){
         obj->insert("sampleRate", QJsonValue(sample_rate));
     }
+    if(m_fifo_size_isSet){
+        obj->insert("fifoSize", QJsonValue(fifo_size));
+    }
+    if(m_fifo_fill_isSet){
+        obj->insert("fifoFill", QJsonValue(fifo_fill));
+    }
+    if(m_dropped_samples_isSet){
+        obj->insert("droppedSamples", QJsonValue(dropped_samples));
+    }
 
     return obj;
 }
@@ -113,6 +140,36 @@ SWGLocalInputReport::setSampleRate(qint32 sample_rate) {
     this->m_sample_rate_isSet = true;
 }
 
+qint32
+SWGLocalInputReport::getFifoSize() {
+    return fifo_size;
+}
+void
+SWGLocalInputReport::setFifoSize(qint32 fifo_size) {
+    this->fifo_size = fifo_size;
+    this->m_fifo_size_isSet = true;
+}
+
+qint32
+SWGLocalInputReport::getFifoFill() {
+    return fifo_fill;
+}
+void
+SWGLocalInputReport::setFifoFill(qint32 fifo_fill) {
+    this->fifo_fill = fifo_fill;
+    this->m_fifo_fill_isSet = true;
+}
+
+qint64
+SWGLocalInputReport::getDroppedSamples() {
+    return dropped_samples;
+}
+void
+SWGLocalInputReport::setDroppedSamples(qint64 dropped_samples) {
+    this->dropped_samples = dropped_samples;
+    this->m_dropped_samples_isSet = true;
+}
+
 
 bool
 SWGLocalInputReport::isSet(){
@@ -124,6 +181,15 @@ SWGLocalInputReport::isSet(){
         if(m_sample_rate_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_fifo_size_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fifo_fill_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_dropped_samples_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -47,6 +47,15 @@ public:
     qint32 getSampleRate();
     void setSampleRate(qint32 sample_rate);
 
+    qint32 getFifoSize();
+    void setFifoSize(qint32 fifo_size);
+
+    qint32 getFifoFill();
+    void setFifoFill(qint32 fifo_fill);
+
+    qint64 getDroppedSamples();
+    void setDroppedSamples(qint64 dropped_samples);
+
 
     virtual bool isSet() override;
 
@@ -57,6 +66,15 @@ private:
     qint32 sample_rate;
     bool m_sample_rate_isSet;
 
+    qint32 fifo_size;
+    bool m_fifo_size_isSet;
+
+    qint32 fifo_fill;
+    bool m_fifo_fill_isSet;
+
+    qint64 dropped_samples;
+    bool m_dropped_samples_isSet;
+
 };
 
 }
@@ -40,6 +40,8 @@ SWGLocalInputSettings::SWGLocalInputSettings() {
     m_reverse_api_port_isSet = false;
     reverse_api_device_index = 0;
     m_reverse_api_device_index_isSet = false;
+    fifo_size_ms = 0;
+    m_fifo_size_ms_isSet = false;
 }
 
 SWGLocalInputSettings::~SWGLocalInputSettings() {
@@ -60,6 +62,8 @@ SWGLocalInputSettings::init() {
     m_reverse_api_port_isSet = false;
     reverse_api_device_index = 0;
     m_reverse_api_device_index_isSet = false;
+    fifo_size_ms = 0;
+    m_fifo_size_ms_isSet = false;
 }
 
 void
@@ -97,6 +101,8 @@ SWGLocalInputSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&reverse_api_device_index, pJson["reverseAPIDeviceIndex"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&fifo_size_ms, pJson["fifoSizeMs"], "qint32", "");
+    
 }
 
 QString
@@ -131,6 +137,9 @@ SWGLocalInputSettings::asJsonObject() {
     if(m_reverse_api_device_index_isSet){
         obj->insert("reverseAPIDeviceIndex", QJsonValue(reverse_api_device_index));
     }
+    if(m_fifo_size_ms_isSet){
+        obj->insert("fifoSizeMs", QJsonValue(fifo_size_ms));
+    }
 
     return obj;
 }
@@ -195,6 +204,16 @@ SWGLocalInputSettings::setReverseApiDeviceIndex(qint32 reverse_api_device_index)
     this->m_reverse_api_device_index_isSet = true;
 }
 
+qint32
+SWGLocalInputSettings::getFifoSizeMs() {
+    return fifo_size_ms;
+}
+void
+SWGLocalInputSettings::setFifoSizeMs(qint32 fifo_size_ms) {
+    this->fifo_size_ms = fifo_size_ms;
+    this->m_fifo_size_ms_isSet = true;
+}
+
 
 bool
 SWGLocalInputSettings::isSet(){
@@ -218,6 +237,9 @@ SWGLocalInputSettings::isSet(){
         if(m_reverse_api_device_index_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_fifo_size_ms_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -60,6 +60,9 @@ public:
     qint32 getReverseApiDeviceIndex();
     void setReverseApiDeviceIndex(qint32 reverse_api_device_index);
 
+    qint32 getFifoSizeMs();
+    void setFifoSizeMs(qint32 fifo_size_ms);
+
 
     virtual bool isSet() override;
 
@@ -82,6 +85,9 @@ private:
     qint32 reverse_api_device_index;
     bool m_reverse_api_device_index_isSet;
 
+    qint32 fifo_size_ms;
+    bool m_fifo_size_ms_isSet;
+
 };
 
 }
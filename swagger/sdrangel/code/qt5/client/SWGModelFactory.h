@@ -45,11 +45,14 @@
 #include "SWGCWKeyerSettings.h"
 #include "SWGChannel.h"
 #include "SWGChannelActions.h"
+#include "SWGChannelAnalyzerReport.h"
 #include "SWGChannelAnalyzerSettings.h"
 #include "SWGChannelConfig.h"
 #include "SWGChannelListItem.h"
 #include "SWGChannelReport.h"
+#include "SWGChannelReportItem.h"
 #include "SWGChannelSettings.h"
+#include "SWGChannelSettingsItem.h"
 #include "SWGChannelsDetail.h"
 #include "SWGCommand.h"
 #include "SWGComplex.h"
@@ -91,10 +94,16 @@
 #include "SWGGain.h"
 #include "SWGHackRFInputSettings.h"
 #include "SWGHackRFOutputSettings.h"
+#include "SWGInstanceChannelReports.h"
+#include "SWGInstanceChannelSettings.h"
 #include "SWGInstanceChannelsResponse.h"
 #include "SWGInstanceConfigResponse.h"
 #include "SWGInstanceDevicesResponse.h"
 #include "SWGInstanceSummaryResponse.h"
+#include "SWGInterferometerReport.h"
+#include "SWGInterferometerSettings.h"
+#include "SWGInterferometerStreamReport.h"
+#include "SWGInterferometerStreamSettings.h"
 #include "SWGKiwiSDRReport.h"
 #include "SWGKiwiSDRSettings.h"
 #include "SWGLimeRFEDevice.h"
@@ -103,6 +112,7 @@
 #include "SWGLimeRFESettings.h"
 #include "SWGLimeSdrInputReport.h"
 #include "SWGLimeSdrInputSettings.h"
+#include "SWGLimeSdrMIMOSettings.h"
 #include "SWGLimeSdrOutputReport.h"
 #include "SWGLimeSdrOutputSettings.h"
 #include "SWGLocalInputReport.h"
@@ -122,6 +132,7 @@
 #include "SWGPerseusSettings.h"
 #include "SWGPlutoSdrInputReport.h"
 #include "SWGPlutoSdrInputSettings.h"
+#include "SWGPlutoSdrMIMOSettings.h"
 #include "SWGPlutoSdrOutputReport.h"
 #include "SWGPlutoSdrOutputSettings.h"
 #include "SWGPreferences.h"
@@ -135,6 +146,7 @@
 #include "SWGPresets.h"
 #include "SWGRDSReport.h"
 #include "SWGRDSReport_altFrequencies.h"
+#include "SWGRDSScanStation.h"
 #include "SWGRange.h"
 #include "SWGRangeFloat.h"
 #include "SWGRemoteInputReport.h"
@@ -160,7 +172,11 @@
 #include "SWGSoapySDROutputSettings.h"
 #include "SWGSoapySDRReport.h"
 #include "SWGSuccessResponse.h"
+#include "SWGTestMISettings.h"
+#include "SWGTestMIStreamSettings.h"
 #include "SWGTestSourceSettings.h"
+#include "SWGThreadPrioritySettings.h"
+#include "SWGThreadPriorityStatus.h"
 #include "SWGTraceData.h"
 #include "SWGTriggerData.h"
 #include "SWGUDPSinkReport.h"
@@ -173,6 +189,7 @@
 #include "SWGWFMModSettings.h"
 #include "SWGXtrxInputReport.h"
 #include "SWGXtrxInputSettings.h"
+#include "SWGXtrxMIMOSettings.h"
 #include "SWGXtrxOutputReport.h"
 #include "SWGXtrxOutputSettings.h"
 
@@ -272,6 +289,9 @@ namespace SWGSDRangel {
     if(QString("SWGChannelActions").compare(type) == 0) {
       return new SWGChannelActions();
     }
+    if(QString("SWGChannelAnalyzerReport").compare(type) == 0) {
+      return new SWGChannelAnalyzerReport();
+    }
     if(QString("SWGChannelAnalyzerSettings").compare(type) == 0) {
       return new SWGChannelAnalyzerSettings();
     }
@@ -284,9 +304,15 @@ namespace SWGSDRangel {
     if(QString("SWGChannelReport").compare(type) == 0) {
       return new SWGChannelReport();
     }
+    if(QString("SWGChannelReportItem").compare(type) == 0) {
+      return new SWGChannelReportItem();
+    }
     if(QString("SWGChannelSettings").compare(type) == 0) {
       return new SWGChannelSettings();
     }
+    if(QString("SWGChannelSettingsItem").compare(type) == 0) {
+      return new SWGChannelSettingsItem();
+    }
     if(QString("SWGChannelsDetail").compare(type) == 0) {
       return new SWGChannelsDetail();
     }
@@ -410,6 +436,12 @@ namespace SWGSDRangel {
     if(QString("SWGHackRFOutputSettings").compare(type) == 0) {
       return new SWGHackRFOutputSettings();
     }
+    if(QString("SWGInstanceChannelReports").compare(type) == 0) {
+      return new SWGInstanceChannelReports();
+    }
+    if(QString("SWGInstanceChannelSettings").compare(type) == 0) {
+      return new SWGInstanceChannelSettings();
+    }
     if(QString("SWGInstanceChannelsResponse").compare(type) == 0) {
       return new SWGInstanceChannelsResponse();
     }
@@ -422,6 +454,18 @@ namespace SWGSDRangel {
     if(QString("SWGInstanceSummaryResponse").compare(type) == 0) {
       return new SWGInstanceSummaryResponse();
     }
+    if(QString("SWGInterferometerReport").compare(type) == 0) {
+      return new SWGInterferometerReport();
+    }
+    if(QString("SWGInterferometerSettings").compare(type) == 0) {
+      return new SWGInterferometerSettings();
+    }
+    if(QString("SWGInterferometerStreamReport").compare(type) == 0) {
+      return new SWGInterferometerStreamReport();
+    }
+    if(QString("SWGInterferometerStreamSettings").compare(type) == 0) {
+      return new SWGInterferometerStreamSettings();
+    }
     if(QString("SWGKiwiSDRReport").compare(type) == 0) {
       return new SWGKiwiSDRReport();
     }
@@ -446,6 +490,9 @@ namespace SWGSDRangel {
     if(QString("SWGLimeSdrInputSettings").compare(type) == 0) {
       return new SWGLimeSdrInputSettings();
     }
+    if(QString("SWGLimeSdrMIMOSettings").compare(type) == 0) {
+      return new SWGLimeSdrMIMOSettings();
+    }
     if(QString("SWGLimeSdrOutputReport").compare(type) == 0) {
       return new SWGLimeSdrOutputReport();
     }
@@ -503,6 +550,9 @@ namespace SWGSDRangel {
     if(QString("SWGPlutoSdrInputSettings").compare(type) == 0) {
       return new SWGPlutoSdrInputSettings();
     }
+    if(QString("SWGPlutoSdrMIMOSettings").compare(type) == 0) {
+      return new SWGPlutoSdrMIMOSettings();
+    }
     if(QString("SWGPlutoSdrOutputReport").compare(type) == 0) {
       return new SWGPlutoSdrOutputReport();
     }
@@ -542,6 +592,9 @@ namespace SWGSDRangel {
     if(QString("SWGRDSReport_altFrequencies").compare(type) == 0) {
       return new SWGRDSReport_altFrequencies();
     }
+    if(QString("SWGRDSScanStation").compare(type) == 0) {
+      return new SWGRDSScanStation();
+    }
     if(QString("SWGRange").compare(type) == 0) {
       return new SWGRange();
     }
@@ -617,9 +670,21 @@ namespace SWGSDRangel {
     if(QString("SWGSuccessResponse").compare(type) == 0) {
       return new SWGSuccessResponse();
     }
+    if(QString("SWGTestMISettings").compare(type) == 0) {
+      return new SWGTestMISettings();
+    }
+    if(QString("SWGTestMIStreamSettings").compare(type) == 0) {
+      return new SWGTestMIStreamSettings();
+    }
     if(QString("SWGTestSourceSettings").compare(type) == 0) {
       return new SWGTestSourceSettings();
     }
+    if(QString("SWGThreadPrioritySettings").compare(type) == 0) {
+      return new SWGThreadPrioritySettings();
+    }
+    if(QString("SWGThreadPriorityStatus").compare(type) == 0) {
+      return new SWGThreadPriorityStatus();
+    }
     if(QString("SWGTraceData").compare(type) == 0) {
       return new SWGTraceData();
     }
@@ -656,6 +721,9 @@ namespace SWGSDRangel {
     if(QString("SWGXtrxInputSettings").compare(type) == 0) {
       return new SWGXtrxInputSettings();
     }
+    if(QString("SWGXtrxMIMOSettings").compare(type) == 0) {
+      return new SWGXtrxMIMOSettings();
+    }
     if(QString("SWGXtrxOutputReport").compare(type) == 0) {
       return new SWGXtrxOutputReport();
     }
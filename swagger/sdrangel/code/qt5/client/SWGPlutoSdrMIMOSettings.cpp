@@ -0,0 +1,614 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGPlutoSdrMIMOSettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGPlutoSdrMIMOSettings::SWGPlutoSdrMIMOSettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGPlutoSdrMIMOSettings::SWGPlutoSdrMIMOSettings() {
+    dev_sample_rate = 0L;
+    m_dev_sample_rate_isSet = false;
+    l_oppm_tenths = 0;
+    m_l_oppm_tenths_isSet = false;
+    lpf_fir_enable = 0;
+    m_lpf_fir_enable_isSet = false;
+    lpf_firbw = 0;
+    m_lpf_firbw_isSet = false;
+    lpf_fi_rlog2_decim = 0;
+    m_lpf_fi_rlog2_decim_isSet = false;
+    lpf_fir_gain = 0;
+    m_lpf_fir_gain_isSet = false;
+    rx_center_frequency = 0L;
+    m_rx_center_frequency_isSet = false;
+    log2_soft_decim = 0;
+    m_log2_soft_decim_isSet = false;
+    fc_pos_rx = 0;
+    m_fc_pos_rx_isSet = false;
+    dc_block = 0;
+    m_dc_block_isSet = false;
+    iq_correction = 0;
+    m_iq_correction_isSet = false;
+    hw_bbdc_block = 0;
+    m_hw_bbdc_block_isSet = false;
+    hw_rfdc_block = 0;
+    m_hw_rfdc_block_isSet = false;
+    hw_iq_correction = 0;
+    m_hw_iq_correction_isSet = false;
+    lpf_bw = 0;
+    m_lpf_bw_isSet = false;
+    antenna_path = 0;
+    m_antenna_path_isSet = false;
+    gain_mode = 0;
+    m_gain_mode_isSet = false;
+    rx0_gain = 0;
+    m_rx0_gain_isSet = false;
+    rx1_gain = 0;
+    m_rx1_gain_isSet = false;
+    rx_transverter_mode = 0;
+    m_rx_transverter_mode_isSet = false;
+    rx_transverter_delta_frequency = 0L;
+    m_rx_transverter_delta_frequency_isSet = false;
+    iq_order = 0;
+    m_iq_order_isSet = false;
+    spectrum_stream_index = 0;
+    m_spectrum_stream_index_isSet = false;
+}
+
+SWGPlutoSdrMIMOSettings::~SWGPlutoSdrMIMOSettings() {
+    this->cleanup();
+}
+
+void
+SWGPlutoSdrMIMOSettings::init() {
+    dev_sample_rate = 0L;
+    m_dev_sample_rate_isSet = false;
+    l_oppm_tenths = 0;
+    m_l_oppm_tenths_isSet = false;
+    lpf_fir_enable = 0;
+    m_lpf_fir_enable_isSet = false;
+    lpf_firbw = 0;
+    m_lpf_firbw_isSet = false;
+    lpf_fi_rlog2_decim = 0;
+    m_lpf_fi_rlog2_decim_isSet = false;
+    lpf_fir_gain = 0;
+    m_lpf_fir_gain_isSet = false;
+    rx_center_frequency = 0L;
+    m_rx_center_frequency_isSet = false;
+    log2_soft_decim = 0;
+    m_log2_soft_decim_isSet = false;
+    fc_pos_rx = 0;
+    m_fc_pos_rx_isSet = false;
+    dc_block = 0;
+    m_dc_block_isSet = false;
+    iq_correction = 0;
+    m_iq_correction_isSet = false;
+    hw_bbdc_block = 0;
+    m_hw_bbdc_block_isSet = false;
+    hw_rfdc_block = 0;
+    m_hw_rfdc_block_isSet = false;
+    hw_iq_correction = 0;
+    m_hw_iq_correction_isSet = false;
+    lpf_bw = 0;
+    m_lpf_bw_isSet = false;
+    antenna_path = 0;
+    m_antenna_path_isSet = false;
+    gain_mode = 0;
+    m_gain_mode_isSet = false;
+    rx0_gain = 0;
+    m_rx0_gain_isSet = false;
+    rx1_gain = 0;
+    m_rx1_gain_isSet = false;
+    rx_transverter_mode = 0;
+    m_rx_transverter_mode_isSet = false;
+    rx_transverter_delta_frequency = 0L;
+    m_rx_transverter_delta_frequency_isSet = false;
+    iq_order = 0;
+    m_iq_order_isSet = false;
+    spectrum_stream_index = 0;
+    m_spectrum_stream_index_isSet = false;
+}
+
+void
+SWGPlutoSdrMIMOSettings::cleanup() {
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+}
+
+SWGPlutoSdrMIMOSettings*
+SWGPlutoSdrMIMOSettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGPlutoSdrMIMOSettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&dev_sample_rate, pJson["devSampleRate"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&l_oppm_tenths, pJson["LOppmTenths"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&lpf_fir_enable, pJson["lpfFIREnable"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&lpf_firbw, pJson["lpfFIRBW"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&lpf_fi_rlog2_decim, pJson["lpfFIRlog2Decim"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&lpf_fir_gain, pJson["lpfFIRGain"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx_center_frequency, pJson["rxCenterFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&log2_soft_decim, pJson["log2SoftDecim"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fc_pos_rx, pJson["fcPosRx"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&dc_block, pJson["dcBlock"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&iq_correction, pJson["iqCorrection"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&hw_bbdc_block, pJson["hwBBDCBlock"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&hw_rfdc_block, pJson["hwRFDCBlock"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&hw_iq_correction, pJson["hwIQCorrection"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&lpf_bw, pJson["lpfBW"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&antenna_path, pJson["antennaPath"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&gain_mode, pJson["gainMode"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx0_gain, pJson["rx0Gain"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx1_gain, pJson["rx1Gain"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx_transverter_mode, pJson["rxTransverterMode"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx_transverter_delta_frequency, pJson["rxTransverterDeltaFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&iq_order, pJson["iqOrder"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&spectrum_stream_index, pJson["spectrumStreamIndex"], "qint32", "");
+    
+}
+
+QString
+SWGPlutoSdrMIMOSettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGPlutoSdrMIMOSettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_dev_sample_rate_isSet){
+        obj->insert("devSampleRate", QJsonValue(dev_sample_rate));
+    }
+    if(m_l_oppm_tenths_isSet){
+        obj->insert("LOppmTenths", QJsonValue(l_oppm_tenths));
+    }
+    if(m_lpf_fir_enable_isSet){
+        obj->insert("lpfFIREnable", QJsonValue(lpf_fir_enable));
+    }
+    if(m_lpf_firbw_isSet){
+        obj->insert("lpfFIRBW", QJsonValue(lpf_firbw));
+    }
+    if(m_lpf_fi_rlog2_decim_isSet){
+        obj->insert("lpfFIRlog2Decim", QJsonValue(lpf_fi_rlog2_decim));
+    }
+    if(m_lpf_fir_gain_isSet){
+        obj->insert("lpfFIRGain", QJsonValue(lpf_fir_gain));
+    }
+    if(m_rx_center_frequency_isSet){
+        obj->insert("rxCenterFrequency", QJsonValue(rx_center_frequency));
+    }
+    if(m_log2_soft_decim_isSet){
+        obj->insert("log2SoftDecim", QJsonValue(log2_soft_decim));
+    }
+    if(m_fc_pos_rx_isSet){
+        obj->insert("fcPosRx", QJsonValue(fc_pos_rx));
+    }
+    if(m_dc_block_isSet){
+        obj->insert("dcBlock", QJsonValue(dc_block));
+    }
+    if(m_iq_correction_isSet){
+        obj->insert("iqCorrection", QJsonValue(iq_correction));
+    }
+    if(m_hw_bbdc_block_isSet){
+        obj->insert("hwBBDCBlock", QJsonValue(hw_bbdc_block));
+    }
+    if(m_hw_rfdc_block_isSet){
+        obj->insert("hwRFDCBlock", QJsonValue(hw_rfdc_block));
+    }
+    if(m_hw_iq_correction_isSet){
+        obj->insert("hwIQCorrection", QJsonValue(hw_iq_correction));
+    }
+    if(m_lpf_bw_isSet){
+        obj->insert("lpfBW", QJsonValue(lpf_bw));
+    }
+    if(m_antenna_path_isSet){
+        obj->insert("antennaPath", QJsonValue(antenna_path));
+    }
+    if(m_gain_mode_isSet){
+        obj->insert("gainMode", QJsonValue(gain_mode));
+    }
+    if(m_rx0_gain_isSet){
+        obj->insert("rx0Gain", QJsonValue(rx0_gain));
+    }
+    if(m_rx1_gain_isSet){
+        obj->insert("rx1Gain", QJsonValue(rx1_gain));
+    }
+    if(m_rx_transverter_mode_isSet){
+        obj->insert("rxTransverterMode", QJsonValue(rx_transverter_mode));
+    }
+    if(m_rx_transverter_delta_frequency_isSet){
+        obj->insert("rxTransverterDeltaFrequency", QJsonValue(rx_transverter_delta_frequency));
+    }
+    if(m_iq_order_isSet){
+        obj->insert("iqOrder", QJsonValue(iq_order));
+    }
+    if(m_spectrum_stream_index_isSet){
+        obj->insert("spectrumStreamIndex", QJsonValue(spectrum_stream_index));
+    }
+
+    return obj;
+}
+
+qint64
+SWGPlutoSdrMIMOSettings::getDevSampleRate() {
+    return dev_sample_rate;
+}
+void
+SWGPlutoSdrMIMOSettings::setDevSampleRate(qint64 dev_sample_rate) {
+    this->dev_sample_rate = dev_sample_rate;
+    this->m_dev_sample_rate_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getLOppmTenths() {
+    return l_oppm_tenths;
+}
+void
+SWGPlutoSdrMIMOSettings::setLOppmTenths(qint32 l_oppm_tenths) {
+    this->l_oppm_tenths = l_oppm_tenths;
+    this->m_l_oppm_tenths_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getLpfFirEnable() {
+    return lpf_fir_enable;
+}
+void
+SWGPlutoSdrMIMOSettings::setLpfFirEnable(qint32 lpf_fir_enable) {
+    this->lpf_fir_enable = lpf_fir_enable;
+    this->m_lpf_fir_enable_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getLpfFirbw() {
+    return lpf_firbw;
+}
+void
+SWGPlutoSdrMIMOSettings::setLpfFirbw(qint32 lpf_firbw) {
+    this->lpf_firbw = lpf_firbw;
+    this->m_lpf_firbw_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getLpfFiRlog2Decim() {
+    return lpf_fi_rlog2_decim;
+}
+void
+SWGPlutoSdrMIMOSettings::setLpfFiRlog2Decim(qint32 lpf_fi_rlog2_decim) {
+    this->lpf_fi_rlog2_decim = lpf_fi_rlog2_decim;
+    this->m_lpf_fi_rlog2_decim_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getLpfFirGain() {
+    return lpf_fir_gain;
+}
+void
+SWGPlutoSdrMIMOSettings::setLpfFirGain(qint32 lpf_fir_gain) {
+    this->lpf_fir_gain = lpf_fir_gain;
+    this->m_lpf_fir_gain_isSet = true;
+}
+
+qint64
+SWGPlutoSdrMIMOSettings::getRxCenterFrequency() {
+    return rx_center_frequency;
+}
+void
+SWGPlutoSdrMIMOSettings::setRxCenterFrequency(qint64 rx_center_frequency) {
+    this->rx_center_frequency = rx_center_frequency;
+    this->m_rx_center_frequency_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getLog2SoftDecim() {
+    return log2_soft_decim;
+}
+void
+SWGPlutoSdrMIMOSettings::setLog2SoftDecim(qint32 log2_soft_decim) {
+    this->log2_soft_decim = log2_soft_decim;
+    this->m_log2_soft_decim_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getFcPosRx() {
+    return fc_pos_rx;
+}
+void
+SWGPlutoSdrMIMOSettings::setFcPosRx(qint32 fc_pos_rx) {
+    this->fc_pos_rx = fc_pos_rx;
+    this->m_fc_pos_rx_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getDcBlock() {
+    return dc_block;
+}
+void
+SWGPlutoSdrMIMOSettings::setDcBlock(qint32 dc_block) {
+    this->dc_block = dc_block;
+    this->m_dc_block_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getIqCorrection() {
+    return iq_correction;
+}
+void
+SWGPlutoSdrMIMOSettings::setIqCorrection(qint32 iq_correction) {
+    this->iq_correction = iq_correction;
+    this->m_iq_correction_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getHwBbdcBlock() {
+    return hw_bbdc_block;
+}
+void
+SWGPlutoSdrMIMOSettings::setHwBbdcBlock(qint32 hw_bbdc_block) {
+    this->hw_bbdc_block = hw_bbdc_block;
+    this->m_hw_bbdc_block_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getHwRfdcBlock() {
+    return hw_rfdc_block;
+}
+void
+SWGPlutoSdrMIMOSettings::setHwRfdcBlock(qint32 hw_rfdc_block) {
+    this->hw_rfdc_block = hw_rfdc_block;
+    this->m_hw_rfdc_block_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getHwIqCorrection() {
+    return hw_iq_correction;
+}
+void
+SWGPlutoSdrMIMOSettings::setHwIqCorrection(qint32 hw_iq_correction) {
+    this->hw_iq_correction = hw_iq_correction;
+    this->m_hw_iq_correction_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getLpfBw() {
+    return lpf_bw;
+}
+void
+SWGPlutoSdrMIMOSettings::setLpfBw(qint32 lpf_bw) {
+    this->lpf_bw = lpf_bw;
+    this->m_lpf_bw_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getAntennaPath() {
+    return antenna_path;
+}
+void
+SWGPlutoSdrMIMOSettings::setAntennaPath(qint32 antenna_path) {
+    this->antenna_path = antenna_path;
+    this->m_antenna_path_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getGainMode() {
+    return gain_mode;
+}
+void
+SWGPlutoSdrMIMOSettings::setGainMode(qint32 gain_mode) {
+    this->gain_mode = gain_mode;
+    this->m_gain_mode_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getRx0Gain() {
+    return rx0_gain;
+}
+void
+SWGPlutoSdrMIMOSettings::setRx0Gain(qint32 rx0_gain) {
+    this->rx0_gain = rx0_gain;
+    this->m_rx0_gain_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getRx1Gain() {
+    return rx1_gain;
+}
+void
+SWGPlutoSdrMIMOSettings::setRx1Gain(qint32 rx1_gain) {
+    this->rx1_gain = rx1_gain;
+    this->m_rx1_gain_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getRxTransverterMode() {
+    return rx_transverter_mode;
+}
+void
+SWGPlutoSdrMIMOSettings::setRxTransverterMode(qint32 rx_transverter_mode) {
+    this->rx_transverter_mode = rx_transverter_mode;
+    this->m_rx_transverter_mode_isSet = true;
+}
+
+qint64
+SWGPlutoSdrMIMOSettings::getRxTransverterDeltaFrequency() {
+    return rx_transverter_delta_frequency;
+}
+void
+SWGPlutoSdrMIMOSettings::setRxTransverterDeltaFrequency(qint64 rx_transverter_delta_frequency) {
+    this->rx_transverter_delta_frequency = rx_transverter_delta_frequency;
+    this->m_rx_transverter_delta_frequency_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getIqOrder() {
+    return iq_order;
+}
+void
+SWGPlutoSdrMIMOSettings::setIqOrder(qint32 iq_order) {
+    this->iq_order = iq_order;
+    this->m_iq_order_isSet = true;
+}
+
+qint32
+SWGPlutoSdrMIMOSettings::getSpectrumStreamIndex() {
+    return spectrum_stream_index;
+}
+void
+SWGPlutoSdrMIMOSettings::setSpectrumStreamIndex(qint32 spectrum_stream_index) {
+    this->spectrum_stream_index = spectrum_stream_index;
+    this->m_spectrum_stream_index_isSet = true;
+}
+
+
+bool
+SWGPlutoSdrMIMOSettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_dev_sample_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_l_oppm_tenths_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_lpf_fir_enable_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_lpf_firbw_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_lpf_fi_rlog2_decim_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_lpf_fir_gain_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx_center_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_log2_soft_decim_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fc_pos_rx_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_dc_block_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_iq_correction_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_hw_bbdc_block_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_hw_rfdc_block_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_hw_iq_correction_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_lpf_bw_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_antenna_path_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_gain_mode_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx0_gain_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx1_gain_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx_transverter_mode_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx_transverter_delta_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_iq_order_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_spectrum_stream_index_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
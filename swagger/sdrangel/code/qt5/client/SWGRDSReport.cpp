@@ -54,6 +54,12 @@ SWGRDSReport::SWGRDSReport() {
     m_time_isSet = false;
     alt_frequencies = nullptr;
     m_alt_frequencies_isSet = false;
+    tmc_event = nullptr;
+    m_tmc_event_isSet = false;
+    tmc_location = nullptr;
+    m_tmc_location_isSet = false;
+    tmc_extent = nullptr;
+    m_tmc_extent_isSet = false;
 }
 
 SWGRDSReport::~SWGRDSReport() {
@@ -88,6 +94,12 @@ SWGRDSReport::init() {
     m_time_isSet = false;
     alt_frequencies = new QList<SWGRDSReport_altFrequencies*>();
     m_alt_frequencies_isSet = false;
+    tmc_event = new QString("");
+    m_tmc_event_isSet = false;
+    tmc_location = new QString("");
+    m_tmc_location_isSet = false;
+    tmc_extent = new QString("");
+    m_tmc_extent_isSet = false;
 }
 
 void
@@ -127,6 +139,15 @@ SWGRDSReport::cleanup() {
         }
         delete alt_frequencies;
     }
+    if(tmc_event != nullptr) { 
+        delete tmc_event;
+    }
+    if(tmc_location != nullptr) { 
+        delete tmc_location;
+    }
+    if(tmc_extent != nullptr) { 
+        delete tmc_extent;
+    }
 }
 
 SWGRDSReport*
@@ -166,6 +187,13 @@ SWGRDSReport::fromJsonObject(QJsonObject &pJson) {
     
     
     ::SWGSDRangel::setValue(&alt_frequencies, pJson["altFrequencies"], "QList", "SWGRDSReport_altFrequencies");
+    
+    ::SWGSDRangel::setValue(&tmc_event, pJson["tmcEvent"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&tmc_location, pJson["tmcLocation"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&tmc_extent, pJson["tmcExtent"], "QString", "QString");
+    
 }
 
 QString
@@ -221,6 +249,15 @@ SWGRDSReport::asJsonObject() {
     if(alt_frequencies && alt_frequencies->size() > 0){
         toJsonArray((QList<void*>*)alt_frequencies, obj, "altFrequencies", "SWGRDSReport_altFrequencies");
     }
+    if(tmc_event != nullptr && *tmc_event != QString("")){
+        toJsonValue(QString("tmcEvent"), tmc_event, obj, QString("QString"));
+    }
+    if(tmc_location != nullptr && *tmc_location != QString("")){
+        toJsonValue(QString("tmcLocation"), tmc_location, obj, QString("QString"));
+    }
+    if(tmc_extent != nullptr && *tmc_extent != QString("")){
+        toJsonValue(QString("tmcExtent"), tmc_extent, obj, QString("QString"));
+    }
 
     return obj;
 }
@@ -355,6 +392,36 @@ SWGRDSReport::setAltFrequencies(QList<SWGRDSReport_altFrequencies*>* alt_frequen
     this->m_alt_frequencies_isSet = true;
 }
 
+QString*
+SWGRDSReport::getTmcEvent() {
+    return tmc_event;
+}
+void
+SWGRDSReport::setTmcEvent(QString* tmc_event) {
+    this->tmc_event = tmc_event;
+    this->m_tmc_event_isSet = true;
+}
+
+QString*
+SWGRDSReport::getTmcLocation() {
+    return tmc_location;
+}
+void
+SWGRDSReport::setTmcLocation(QString* tmc_location) {
+    this->tmc_location = tmc_location;
+    this->m_tmc_location_isSet = true;
+}
+
+QString*
+SWGRDSReport::getTmcExtent() {
+    return tmc_extent;
+}
+void
+SWGRDSReport::setTmcExtent(QString* tmc_extent) {
+    this->tmc_extent = tmc_extent;
+    this->m_tmc_extent_isSet = true;
+}
+
 
 bool
 SWGRDSReport::isSet(){
@@ -399,6 +466,15 @@ SWGRDSReport::isSet(){
         if(alt_frequencies && (alt_frequencies->size() > 0)){
             isObjectUpdated = true; break;
         }
+        if(tmc_event && *tmc_event != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(tmc_location && *tmc_location != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(tmc_extent && *tmc_extent != QString("")){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
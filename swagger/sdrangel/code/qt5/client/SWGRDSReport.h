@@ -83,6 +83,15 @@ public:
     QList<SWGRDSReport_altFrequencies*>* getAltFrequencies();
     void setAltFrequencies(QList<SWGRDSReport_altFrequencies*>* alt_frequencies);
 
+    QString* getTmcEvent();
+    void setTmcEvent(QString* tmc_event);
+
+    QString* getTmcLocation();
+    void setTmcLocation(QString* tmc_location);
+
+    QString* getTmcExtent();
+    void setTmcExtent(QString* tmc_extent);
+
 
     virtual bool isSet() override;
 
@@ -126,6 +135,15 @@ private:
     QList<SWGRDSReport_altFrequencies*>* alt_frequencies;
     bool m_alt_frequencies_isSet;
 
+    QString* tmc_event;
+    bool m_tmc_event_isSet;
+
+    QString* tmc_location;
+    bool m_tmc_location_isSet;
+
+    QString* tmc_extent;
+    bool m_tmc_extent_isSet;
+
 };
 
 }
@@ -0,0 +1,179 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGRDSScanStation.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGRDSScanStation::SWGRDSScanStation(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGRDSScanStation::SWGRDSScanStation() {
+    frequency = 0L;
+    m_frequency_isSet = false;
+    power_db = 0.0f;
+    m_power_db_isSet = false;
+    synced = 0;
+    m_synced_isSet = false;
+    rds_report = nullptr;
+    m_rds_report_isSet = false;
+}
+
+SWGRDSScanStation::~SWGRDSScanStation() {
+    this->cleanup();
+}
+
+void
+SWGRDSScanStation::init() {
+    frequency = 0L;
+    m_frequency_isSet = false;
+    power_db = 0.0f;
+    m_power_db_isSet = false;
+    synced = 0;
+    m_synced_isSet = false;
+    rds_report = new SWGRDSReport();
+    m_rds_report_isSet = false;
+}
+
+void
+SWGRDSScanStation::cleanup() {
+
+
+
+    if(rds_report != nullptr) { 
+        delete rds_report;
+    }
+}
+
+SWGRDSScanStation*
+SWGRDSScanStation::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGRDSScanStation::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&frequency, pJson["frequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&power_db, pJson["powerDB"], "float", "");
+    
+    ::SWGSDRangel::setValue(&synced, pJson["synced"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rds_report, pJson["rdsReport"], "SWGRDSReport", "SWGRDSReport");
+    
+}
+
+QString
+SWGRDSScanStation::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGRDSScanStation::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_frequency_isSet){
+        obj->insert("frequency", QJsonValue(frequency));
+    }
+    if(m_power_db_isSet){
+        obj->insert("powerDB", QJsonValue(power_db));
+    }
+    if(m_synced_isSet){
+        obj->insert("synced", QJsonValue(synced));
+    }
+    if((rds_report != nullptr) && (rds_report->isSet())){
+        toJsonValue(QString("rdsReport"), rds_report, obj, QString("SWGRDSReport"));
+    }
+
+    return obj;
+}
+
+qint64
+SWGRDSScanStation::getFrequency() {
+    return frequency;
+}
+void
+SWGRDSScanStation::setFrequency(qint64 frequency) {
+    this->frequency = frequency;
+    this->m_frequency_isSet = true;
+}
+
+float
+SWGRDSScanStation::getPowerDb() {
+    return power_db;
+}
+void
+SWGRDSScanStation::setPowerDb(float power_db) {
+    this->power_db = power_db;
+    this->m_power_db_isSet = true;
+}
+
+qint32
+SWGRDSScanStation::getSynced() {
+    return synced;
+}
+void
+SWGRDSScanStation::setSynced(qint32 synced) {
+    this->synced = synced;
+    this->m_synced_isSet = true;
+}
+
+SWGRDSReport*
+SWGRDSScanStation::getRdsReport() {
+    return rds_report;
+}
+void
+SWGRDSScanStation::setRdsReport(SWGRDSReport* rds_report) {
+    this->rds_report = rds_report;
+    this->m_rds_report_isSet = true;
+}
+
+
+bool
+SWGRDSScanStation::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_power_db_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_synced_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(rds_report && rds_report->isSet()){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
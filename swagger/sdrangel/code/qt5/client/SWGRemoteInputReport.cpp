@@ -40,6 +40,8 @@ SWGRemoteInputReport::SWGRemoteInputReport() {
     m_min_nb_blocks_isSet = false;
     max_nb_recovery = 0;
     m_max_nb_recovery_isSet = false;
+    shared_memory_dropped_frames = 0L;
+    m_shared_memory_dropped_frames_isSet = false;
 }
 
 SWGRemoteInputReport::~SWGRemoteInputReport() {
@@ -60,6 +62,8 @@ SWGRemoteInputReport::init() {
     m_min_nb_blocks_isSet = false;
     max_nb_recovery = 0;
     m_max_nb_recovery_isSet = false;
+    shared_memory_dropped_frames = 0L;
+    m_shared_memory_dropped_frames_isSet = false;
 }
 
 void
@@ -97,6 +101,8 @@ SWGRemoteInputReport::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&max_nb_recovery, pJson["maxNbRecovery"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&shared_memory_dropped_frames, pJson["sharedMemoryDroppedFrames"], "qint64", "");
+    
 }
 
 QString
@@ -131,6 +137,9 @@ SWGRemoteInputReport::asJsonObject() {
     if(m_max_nb_recovery_isSet){
         obj->insert("maxNbRecovery", QJsonValue(max_nb_recovery));
     }
+    if(m_shared_memory_dropped_frames_isSet){
+        obj->insert("sharedMemoryDroppedFrames", QJsonValue(shared_memory_dropped_frames));
+    }
 
     return obj;
 }
@@ -195,6 +204,16 @@ SWGRemoteInputReport::setMaxNbRecovery(qint32 max_nb_recovery) {
     this->m_max_nb_recovery_isSet = true;
 }
 
+qint64
+SWGRemoteInputReport::getSharedMemoryDroppedFrames() {
+    return shared_memory_dropped_frames;
+}
+void
+SWGRemoteInputReport::setSharedMemoryDroppedFrames(qint64 shared_memory_dropped_frames) {
+    this->shared_memory_dropped_frames = shared_memory_dropped_frames;
+    this->m_shared_memory_dropped_frames_isSet = true;
+}
+
 
 bool
 SWGRemoteInputReport::isSet(){
@@ -218,6 +237,9 @@ SWGRemoteInputReport::isSet(){
         if(m_max_nb_recovery_isSet){
             isObjectUpdated = true; break;
         }
+        if(m_shared_memory_dropped_frames_isSet){
+            isObjectUpdated = true; break;
+        }
     }while(false);
     return isObjectUpdated;
 }
@@ -60,6 +60,9 @@ public:
     qint32 getMaxNbRecovery();
     void setMaxNbRecovery(qint32 max_nb_recovery);
 
+    qint64 getSharedMemoryDroppedFrames();
+    void setSharedMemoryDroppedFrames(qint64 shared_memory_dropped_frames);
+
 
     virtual bool isSet() override;
 
@@ -82,6 +85,9 @@ private:
     qint32 max_nb_recovery;
     bool m_max_nb_recovery_isSet;
 
+    qint64 shared_memory_dropped_frames;
+    bool m_shared_memory_dropped_frames_isSet;
+
 };
 
 }
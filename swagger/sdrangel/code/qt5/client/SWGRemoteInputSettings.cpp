@@ -36,6 +36,8 @@ SWGRemoteInputSettings::SWGRemoteInputSettings() {
     m_data_address_isSet = false;
     data_port = 0;
     m_data_port_isSet = false;
+    shared_memory_name = nullptr;
+    m_shared_memory_name_isSet = false;
     multicast_address = nullptr;
     m_multicast_address_isSet = false;
     multicast_join = 0;
@@ -68,6 +70,8 @@ SWGRemoteInputSettings::init() {
     m_data_address_isSet = false;
     data_port = 0;
     m_data_port_isSet = false;
+    shared_memory_name = new QString("");
+    m_shared_memory_name_isSet = false;
     multicast_address = new QString("");
     m_multicast_address_isSet = false;
     multicast_join = 0;
@@ -108,6 +112,9 @@ SWGRemoteInputSettings::cleanup() {
     }
 
 
+    if(shared_memory_name != nullptr) { 
+        delete shared_memory_name;
+    }
 }
 
 SWGRemoteInputSettings*
@@ -129,6 +136,8 @@ SWGRemoteInputSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&data_port, pJson["dataPort"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&shared_memory_name, pJson["sharedMemoryName"], "QString", "QString");
+    
     ::SWGSDRangel::setValue(&multicast_address, pJson["multicastAddress"], "QString", "QString");
     
     ::SWGSDRangel::setValue(&multicast_join, pJson["multicastJoin"], "qint32", "");
@@ -173,6 +182,9 @@ SWGRemoteInputSettings::asJsonObject() {
     if(m_data_port_isSet){
         obj->insert("dataPort", QJsonValue(data_port));
     }
+    if(shared_memory_name != nullptr && *shared_memory_name != QString("")){
+        toJsonValue(QString("sharedMemoryName"), shared_memory_name, obj, QString("QString"));
+    }
     if(multicast_address != nullptr && *multicast_address != QString("")){
         toJsonValue(QString("multicastAddress"), multicast_address, obj, QString("QString"));
     }
@@ -241,6 +253,16 @@ SWGRemoteInputSettings::setDataPort(qint32 data_port) {
     this->m_data_port_isSet = true;
 }
 
+QString*
+SWGRemoteInputSettings::getSharedMemoryName() {
+    return shared_memory_name;
+}
+void
+SWGRemoteInputSettings::setSharedMemoryName(QString* shared_memory_name) {
+    this->shared_memory_name = shared_memory_name;
+    this->m_shared_memory_name_isSet = true;
+}
+
 QString*
 SWGRemoteInputSettings::getMulticastAddress() {
     return multicast_address;
@@ -338,6 +360,9 @@ SWGRemoteInputSettings::isSet(){
         if(m_data_port_isSet){
             isObjectUpdated = true; break;
         }
+        if(shared_memory_name && *shared_memory_name != QString("")){
+            isObjectUpdated = true; break;
+        }
         if(multicast_address && *multicast_address != QString("")){
             isObjectUpdated = true; break;
         }
@@ -54,6 +54,9 @@ public:
     qint32 getDataPort();
     void setDataPort(qint32 data_port);
 
+    QString* getSharedMemoryName();
+    void setSharedMemoryName(QString* shared_memory_name);
+
     QString* getMulticastAddress();
     void setMulticastAddress(QString* multicast_address);
 
@@ -94,6 +97,9 @@ private:
     qint32 data_port;
     bool m_data_port_isSet;
 
+    QString* shared_memory_name;
+    bool m_shared_memory_name_isSet;
+
     QString* multicast_address;
     bool m_multicast_address_isSet;
 
@@ -34,6 +34,8 @@ SWGRemoteSinkSettings::SWGRemoteSinkSettings() {
     m_data_address_isSet = false;
     data_port = 0;
     m_data_port_isSet = false;
+    shared_memory_name = nullptr;
+    m_shared_memory_name_isSet = false;
     tx_delay = 0;
     m_tx_delay_isSet = false;
     rgb_color = 0;
@@ -70,6 +72,8 @@ SWGRemoteSinkSettings::init() {
     m_data_address_isSet = false;
     data_port = 0;
     m_data_port_isSet = false;
+    shared_memory_name = new QString("");
+    m_shared_memory_name_isSet = false;
     tx_delay = 0;
     m_tx_delay_isSet = false;
     rgb_color = 0;
@@ -116,6 +120,9 @@ SWGRemoteSinkSettings::cleanup() {
 
 
 
+    if(shared_memory_name != nullptr) { 
+        delete shared_memory_name;
+    }
 }
 
 SWGRemoteSinkSettings*
@@ -135,6 +142,8 @@ SWGRemoteSinkSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&data_port, pJson["dataPort"], "qint32", "");
     
+    ::SWGSDRangel::setValue(&shared_memory_name, pJson["sharedMemoryName"], "QString", "QString");
+    
     ::SWGSDRangel::setValue(&tx_delay, pJson["txDelay"], "qint32", "");
     
     ::SWGSDRangel::setValue(&rgb_color, pJson["rgbColor"], "qint32", "");
@@ -182,6 +191,9 @@ SWGRemoteSinkSettings::asJsonObject() {
     if(m_data_port_isSet){
         obj->insert("dataPort", QJsonValue(data_port));
     }
+    if(shared_memory_name != nullptr && *shared_memory_name != QString("")){
+        toJsonValue(QString("sharedMemoryName"), shared_memory_name, obj, QString("QString"));
+    }
     if(m_tx_delay_isSet){
         obj->insert("txDelay", QJsonValue(tx_delay));
     }
@@ -249,6 +261,16 @@ SWGRemoteSinkSettings::setDataPort(qint32 data_port) {
     this->m_data_port_isSet = true;
 }
 
+QString*
+SWGRemoteSinkSettings::getSharedMemoryName() {
+    return shared_memory_name;
+}
+void
+SWGRemoteSinkSettings::setSharedMemoryName(QString* shared_memory_name) {
+    this->shared_memory_name = shared_memory_name;
+    this->m_shared_memory_name_isSet = true;
+}
+
 qint32
 SWGRemoteSinkSettings::getTxDelay() {
     return tx_delay;
@@ -373,6 +395,9 @@ SWGRemoteSinkSettings::isSet(){
         if(m_data_port_isSet){
             isObjectUpdated = true; break;
         }
+        if(shared_memory_name && *shared_memory_name != QString("")){
+            isObjectUpdated = true; break;
+        }
         if(m_tx_delay_isSet){
             isObjectUpdated = true; break;
         }
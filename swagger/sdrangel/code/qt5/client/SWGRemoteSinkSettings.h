@@ -51,6 +51,9 @@ public:
     qint32 getDataPort();
     void setDataPort(qint32 data_port);
 
+    QString* getSharedMemoryName();
+    void setSharedMemoryName(QString* shared_memory_name);
+
     qint32 getTxDelay();
     void setTxDelay(qint32 tx_delay);
 
@@ -97,6 +100,9 @@ private:
     qint32 data_port;
     bool m_data_port_isSet;
 
+    QString* shared_memory_name;
+    bool m_shared_memory_name_isSet;
+
     qint32 tx_delay;
     bool m_tx_delay_isSet;
 
@@ -0,0 +1,390 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGTestMISettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGTestMISettings::SWGTestMISettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGTestMISettings::SWGTestMISettings() {
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    frequency_shift = 0;
+    m_frequency_shift_isSet = false;
+    modulation = 0;
+    m_modulation_isSet = false;
+    modulation_tone = 0;
+    m_modulation_tone_isSet = false;
+    am_modulation = 0;
+    m_am_modulation_isSet = false;
+    fm_deviation = 0;
+    m_fm_deviation_isSet = false;
+    signal_level = 0.0f;
+    m_signal_level_isSet = false;
+    noise_level = 0.0f;
+    m_noise_level_isSet = false;
+    arrival_angle = 0.0f;
+    m_arrival_angle_isSet = false;
+    element_spacing = 0.0f;
+    m_element_spacing_isSet = false;
+    spectrum_stream_index = 0;
+    m_spectrum_stream_index_isSet = false;
+    streams = nullptr;
+    m_streams_isSet = false;
+}
+
+SWGTestMISettings::~SWGTestMISettings() {
+    this->cleanup();
+}
+
+void
+SWGTestMISettings::init() {
+    center_frequency = 0L;
+    m_center_frequency_isSet = false;
+    sample_rate = 0;
+    m_sample_rate_isSet = false;
+    frequency_shift = 0;
+    m_frequency_shift_isSet = false;
+    modulation = 0;
+    m_modulation_isSet = false;
+    modulation_tone = 0;
+    m_modulation_tone_isSet = false;
+    am_modulation = 0;
+    m_am_modulation_isSet = false;
+    fm_deviation = 0;
+    m_fm_deviation_isSet = false;
+    signal_level = 0.0f;
+    m_signal_level_isSet = false;
+    noise_level = 0.0f;
+    m_noise_level_isSet = false;
+    arrival_angle = 0.0f;
+    m_arrival_angle_isSet = false;
+    element_spacing = 0.0f;
+    m_element_spacing_isSet = false;
+    spectrum_stream_index = 0;
+    m_spectrum_stream_index_isSet = false;
+    streams = new QList<SWGTestMIStreamSettings*>();
+    m_streams_isSet = false;
+}
+
+void
+SWGTestMISettings::cleanup() {
+
+
+
+
+
+
+
+
+
+
+
+
+    if(streams != nullptr) { 
+        auto arr = streams;
+        for(auto o: *arr) { 
+            delete o;
+        }
+        delete streams;
+    }
+}
+
+SWGTestMISettings*
+SWGTestMISettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGTestMISettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&center_frequency, pJson["centerFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&sample_rate, pJson["sampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&frequency_shift, pJson["frequencyShift"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&modulation, pJson["modulation"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&modulation_tone, pJson["modulationTone"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&am_modulation, pJson["amModulation"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fm_deviation, pJson["fmDeviation"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&signal_level, pJson["signalLevel"], "float", "");
+    
+    ::SWGSDRangel::setValue(&noise_level, pJson["noiseLevel"], "float", "");
+    
+    ::SWGSDRangel::setValue(&arrival_angle, pJson["arrivalAngle"], "float", "");
+    
+    ::SWGSDRangel::setValue(&element_spacing, pJson["elementSpacing"], "float", "");
+    
+    ::SWGSDRangel::setValue(&spectrum_stream_index, pJson["spectrumStreamIndex"], "qint32", "");
+    
+    
+    ::SWGSDRangel::setValue(&streams, pJson["streams"], "QList", "SWGTestMIStreamSettings");
+}
+
+QString
+SWGTestMISettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGTestMISettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_center_frequency_isSet){
+        obj->insert("centerFrequency", QJsonValue(center_frequency));
+    }
+    if(m_sample_rate_isSet){
+        obj->insert("sampleRate", QJsonValue(sample_rate));
+    }
+    if(m_frequency_shift_isSet){
+        obj->insert("frequencyShift", QJsonValue(frequency_shift));
+    }
+    if(m_modulation_isSet){
+        obj->insert("modulation", QJsonValue(modulation));
+    }
+    if(m_modulation_tone_isSet){
+        obj->insert("modulationTone", QJsonValue(modulation_tone));
+    }
+    if(m_am_modulation_isSet){
+        obj->insert("amModulation", QJsonValue(am_modulation));
+    }
+    if(m_fm_deviation_isSet){
+        obj->insert("fmDeviation", QJsonValue(fm_deviation));
+    }
+    if(m_signal_level_isSet){
+        obj->insert("signalLevel", QJsonValue(signal_level));
+    }
+    if(m_noise_level_isSet){
+        obj->insert("noiseLevel", QJsonValue(noise_level));
+    }
+    if(m_arrival_angle_isSet){
+        obj->insert("arrivalAngle", QJsonValue(arrival_angle));
+    }
+    if(m_element_spacing_isSet){
+        obj->insert("elementSpacing", QJsonValue(element_spacing));
+    }
+    if(m_spectrum_stream_index_isSet){
+        obj->insert("spectrumStreamIndex", QJsonValue(spectrum_stream_index));
+    }
+    if(streams && streams->size() > 0){
+        toJsonArray((QList<void*>*)streams, obj, "streams", "SWGTestMIStreamSettings");
+    }
+
+    return obj;
+}
+
+qint64
+SWGTestMISettings::getCenterFrequency() {
+    return center_frequency;
+}
+void
+SWGTestMISettings::setCenterFrequency(qint64 center_frequency) {
+    this->center_frequency = center_frequency;
+    this->m_center_frequency_isSet = true;
+}
+
+qint32
+SWGTestMISettings::getSampleRate() {
+    return sample_rate;
+}
+void
+SWGTestMISettings::setSampleRate(qint32 sample_rate) {
+    this->sample_rate = sample_rate;
+    this->m_sample_rate_isSet = true;
+}
+
+qint32
+SWGTestMISettings::getFrequencyShift() {
+    return frequency_shift;
+}
+void
+SWGTestMISettings::setFrequencyShift(qint32 frequency_shift) {
+    this->frequency_shift = frequency_shift;
+    this->m_frequency_shift_isSet = true;
+}
+
+qint32
+SWGTestMISettings::getModulation() {
+    return modulation;
+}
+void
+SWGTestMISettings::setModulation(qint32 modulation) {
+    this->modulation = modulation;
+    this->m_modulation_isSet = true;
+}
+
+qint32
+SWGTestMISettings::getModulationTone() {
+    return modulation_tone;
+}
+void
+SWGTestMISettings::setModulationTone(qint32 modulation_tone) {
+    this->modulation_tone = modulation_tone;
+    this->m_modulation_tone_isSet = true;
+}
+
+qint32
+SWGTestMISettings::getAmModulation() {
+    return am_modulation;
+}
+void
+SWGTestMISettings::setAmModulation(qint32 am_modulation) {
+    this->am_modulation = am_modulation;
+    this->m_am_modulation_isSet = true;
+}
+
+qint32
+SWGTestMISettings::getFmDeviation() {
+    return fm_deviation;
+}
+void
+SWGTestMISettings::setFmDeviation(qint32 fm_deviation) {
+    this->fm_deviation = fm_deviation;
+    this->m_fm_deviation_isSet = true;
+}
+
+float
+SWGTestMISettings::getSignalLevel() {
+    return signal_level;
+}
+void
+SWGTestMISettings::setSignalLevel(float signal_level) {
+    this->signal_level = signal_level;
+    this->m_signal_level_isSet = true;
+}
+
+float
+SWGTestMISettings::getNoiseLevel() {
+    return noise_level;
+}
+void
+SWGTestMISettings::setNoiseLevel(float noise_level) {
+    this->noise_level = noise_level;
+    this->m_noise_level_isSet = true;
+}
+
+float
+SWGTestMISettings::getArrivalAngle() {
+    return arrival_angle;
+}
+void
+SWGTestMISettings::setArrivalAngle(float arrival_angle) {
+    this->arrival_angle = arrival_angle;
+    this->m_arrival_angle_isSet = true;
+}
+
+float
+SWGTestMISettings::getElementSpacing() {
+    return element_spacing;
+}
+void
+SWGTestMISettings::setElementSpacing(float element_spacing) {
+    this->element_spacing = element_spacing;
+    this->m_element_spacing_isSet = true;
+}
+
+qint32
+SWGTestMISettings::getSpectrumStreamIndex() {
+    return spectrum_stream_index;
+}
+void
+SWGTestMISettings::setSpectrumStreamIndex(qint32 spectrum_stream_index) {
+    this->spectrum_stream_index = spectrum_stream_index;
+    this->m_spectrum_stream_index_isSet = true;
+}
+
+QList<SWGTestMIStreamSettings*>*
+SWGTestMISettings::getStreams() {
+    return streams;
+}
+void
+SWGTestMISettings::setStreams(QList<SWGTestMIStreamSettings*>* streams) {
+    this->streams = streams;
+    this->m_streams_isSet = true;
+}
+
+
+bool
+SWGTestMISettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_center_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_sample_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_frequency_shift_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_modulation_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_modulation_tone_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_am_modulation_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fm_deviation_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_signal_level_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_noise_level_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_arrival_angle_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_element_spacing_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_spectrum_stream_index_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(streams && (streams->size() > 0)){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,132 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGTestMISettings.h
+ *
+ * TestMI
+ */
+
+#ifndef SWGTestMISettings_H_
+#define SWGTestMISettings_H_
+
+#include <QJsonObject>
+
+
+#include "SWGTestMIStreamSettings.h"
+#include <QList>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGTestMISettings: public SWGObject {
+public:
+    SWGTestMISettings();
+    SWGTestMISettings(QString* json);
+    virtual ~SWGTestMISettings();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGTestMISettings* fromJson(QString &jsonString) override;
+
+    qint64 getCenterFrequency();
+    void setCenterFrequency(qint64 center_frequency);
+
+    qint32 getSampleRate();
+    void setSampleRate(qint32 sample_rate);
+
+    qint32 getFrequencyShift();
+    void setFrequencyShift(qint32 frequency_shift);
+
+    qint32 getModulation();
+    void setModulation(qint32 modulation);
+
+    qint32 getModulationTone();
+    void setModulationTone(qint32 modulation_tone);
+
+    qint32 getAmModulation();
+    void setAmModulation(qint32 am_modulation);
+
+    qint32 getFmDeviation();
+    void setFmDeviation(qint32 fm_deviation);
+
+    float getSignalLevel();
+    void setSignalLevel(float signal_level);
+
+    float getNoiseLevel();
+    void setNoiseLevel(float noise_level);
+
+    float getArrivalAngle();
+    void setArrivalAngle(float arrival_angle);
+
+    float getElementSpacing();
+    void setElementSpacing(float element_spacing);
+
+    qint32 getSpectrumStreamIndex();
+    void setSpectrumStreamIndex(qint32 spectrum_stream_index);
+
+    QList<SWGTestMIStreamSettings*>* getStreams();
+    void setStreams(QList<SWGTestMIStreamSettings*>* streams);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint64 center_frequency;
+    bool m_center_frequency_isSet;
+
+    qint32 sample_rate;
+    bool m_sample_rate_isSet;
+
+    qint32 frequency_shift;
+    bool m_frequency_shift_isSet;
+
+    qint32 modulation;
+    bool m_modulation_isSet;
+
+    qint32 modulation_tone;
+    bool m_modulation_tone_isSet;
+
+    qint32 am_modulation;
+    bool m_am_modulation_isSet;
+
+    qint32 fm_deviation;
+    bool m_fm_deviation_isSet;
+
+    float signal_level;
+    bool m_signal_level_isSet;
+
+    float noise_level;
+    bool m_noise_level_isSet;
+
+    float arrival_angle;
+    bool m_arrival_angle_isSet;
+
+    float element_spacing;
+    bool m_element_spacing_isSet;
+
+    qint32 spectrum_stream_index;
+    bool m_spectrum_stream_index_isSet;
+
+    QList<SWGTestMIStreamSettings*>* streams;
+    bool m_streams_isSet;
+
+};
+
+}
+
+#endif /* SWGTestMISettings_H_ */
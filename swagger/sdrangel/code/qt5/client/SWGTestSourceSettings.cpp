@@ -60,6 +60,8 @@ SWGTestSourceSettings::SWGTestSourceSettings() {
     m_q_factor_isSet = false;
     phase_imbalance = 0.0f;
     m_phase_imbalance_isSet = false;
+    scenario = nullptr;
+    m_scenario_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = nullptr;
@@ -108,6 +110,8 @@ SWGTestSourceSettings::init() {
     m_q_factor_isSet = false;
     phase_imbalance = 0.0f;
     m_phase_imbalance_isSet = false;
+    scenario = new QString("");
+    m_scenario_isSet = false;
     use_reverse_api = 0;
     m_use_reverse_api_isSet = false;
     reverse_api_address = new QString("");
@@ -142,6 +146,9 @@ SWGTestSourceSettings::cleanup() {
     }
 
 
+    if(scenario != nullptr) { 
+        delete scenario;
+    }
 }
 
 SWGTestSourceSettings*
@@ -187,6 +194,8 @@ SWGTestSourceSettings::fromJsonObject(QJsonObject &pJson) {
     
     ::SWGSDRangel::setValue(&phase_imbalance, pJson["phaseImbalance"], "float", "");
     
+    ::SWGSDRangel::setValue(&scenario, pJson["scenario"], "QString", "QString");
+    
     ::SWGSDRangel::setValue(&use_reverse_api, pJson["useReverseAPI"], "qint32", "");
     
     ::SWGSDRangel::setValue(&reverse_api_address, pJson["reverseAPIAddress"], "QString", "QString");
@@ -259,6 +268,9 @@ SWGTestSourceSettings::asJsonObject() {
     if(m_phase_imbalance_isSet){
         obj->insert("phaseImbalance", QJsonValue(phase_imbalance));
     }
+    if(scenario != nullptr && *scenario != QString("")){
+        toJsonValue(QString("scenario"), scenario, obj, QString("QString"));
+    }
     if(m_use_reverse_api_isSet){
         obj->insert("useReverseAPI", QJsonValue(use_reverse_api));
     }
@@ -435,6 +447,16 @@ SWGTestSourceSettings::setPhaseImbalance(float phase_imbalance) {
     this->m_phase_imbalance_isSet = true;
 }
 
+QString*
+SWGTestSourceSettings::getScenario() {
+    return scenario;
+}
+void
+SWGTestSourceSettings::setScenario(QString* scenario) {
+    this->scenario = scenario;
+    this->m_scenario_isSet = true;
+}
+
 qint32
 SWGTestSourceSettings::getUseReverseApi() {
     return use_reverse_api;
@@ -528,6 +550,9 @@ SWGTestSourceSettings::isSet(){
         if(m_phase_imbalance_isSet){
             isObjectUpdated = true; break;
         }
+        if(scenario && *scenario != QString("")){
+            isObjectUpdated = true; break;
+        }
         if(m_use_reverse_api_isSet){
             isObjectUpdated = true; break;
         }
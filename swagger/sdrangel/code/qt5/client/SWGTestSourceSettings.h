@@ -90,6 +90,9 @@ public:
     float getPhaseImbalance();
     void setPhaseImbalance(float phase_imbalance);
 
+    QString* getScenario();
+    void setScenario(QString* scenario);
+
     qint32 getUseReverseApi();
     void setUseReverseApi(qint32 use_reverse_api);
 
@@ -154,6 +157,9 @@ private:
     float phase_imbalance;
     bool m_phase_imbalance_isSet;
 
+    QString* scenario;
+    bool m_scenario_isSet;
+
     qint32 use_reverse_api;
     bool m_use_reverse_api_isSet;
 
@@ -0,0 +1,231 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGThreadPrioritySettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGThreadPrioritySettings::SWGThreadPrioritySettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGThreadPrioritySettings::SWGThreadPrioritySettings() {
+    policy = nullptr;
+    m_policy_isSet = false;
+    priority = 0;
+    m_priority_isSet = false;
+    cpu_affinity = nullptr;
+    m_cpu_affinity_isSet = false;
+    isolate = 0;
+    m_isolate_isSet = false;
+    engine_thread = nullptr;
+    m_engine_thread_isSet = false;
+    worker_thread = nullptr;
+    m_worker_thread_isSet = false;
+}
+
+SWGThreadPrioritySettings::~SWGThreadPrioritySettings() {
+    this->cleanup();
+}
+
+void
+SWGThreadPrioritySettings::init() {
+    policy = new QString("");
+    m_policy_isSet = false;
+    priority = 0;
+    m_priority_isSet = false;
+    cpu_affinity = new QString("");
+    m_cpu_affinity_isSet = false;
+    isolate = 0;
+    m_isolate_isSet = false;
+    engine_thread = new SWGThreadPriorityStatus();
+    m_engine_thread_isSet = false;
+    worker_thread = new SWGThreadPriorityStatus();
+    m_worker_thread_isSet = false;
+}
+
+void
+SWGThreadPrioritySettings::cleanup() {
+    if(policy != nullptr) { 
+        delete policy;
+    }
+
+    if(cpu_affinity != nullptr) { 
+        delete cpu_affinity;
+    }
+
+    if(engine_thread != nullptr) { 
+        delete engine_thread;
+    }
+    if(worker_thread != nullptr) { 
+        delete worker_thread;
+    }
+}
+
+SWGThreadPrioritySettings*
+SWGThreadPrioritySettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGThreadPrioritySettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&policy, pJson["policy"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&priority, pJson["priority"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&cpu_affinity, pJson["cpuAffinity"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&isolate, pJson["isolate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&engine_thread, pJson["engineThread"], "SWGThreadPriorityStatus", "SWGThreadPriorityStatus");
+    
+    ::SWGSDRangel::setValue(&worker_thread, pJson["workerThread"], "SWGThreadPriorityStatus", "SWGThreadPriorityStatus");
+    
+}
+
+QString
+SWGThreadPrioritySettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGThreadPrioritySettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(policy != nullptr && *policy != QString("")){
+        toJsonValue(QString("policy"), policy, obj, QString("QString"));
+    }
+    if(m_priority_isSet){
+        obj->insert("priority", QJsonValue(priority));
+    }
+    if(cpu_affinity != nullptr && *cpu_affinity != QString("")){
+        toJsonValue(QString("cpuAffinity"), cpu_affinity, obj, QString("QString"));
+    }
+    if(m_isolate_isSet){
+        obj->insert("isolate", QJsonValue(isolate));
+    }
+    if((engine_thread != nullptr) && (engine_thread->isSet())){
+        toJsonValue(QString("engineThread"), engine_thread, obj, QString("SWGThreadPriorityStatus"));
+    }
+    if((worker_thread != nullptr) && (worker_thread->isSet())){
+        toJsonValue(QString("workerThread"), worker_thread, obj, QString("SWGThreadPriorityStatus"));
+    }
+
+    return obj;
+}
+
+QString*
+SWGThreadPrioritySettings::getPolicy() {
+    return policy;
+}
+void
+SWGThreadPrioritySettings::setPolicy(QString* policy) {
+    this->policy = policy;
+    this->m_policy_isSet = true;
+}
+
+qint32
+SWGThreadPrioritySettings::getPriority() {
+    return priority;
+}
+void
+SWGThreadPrioritySettings::setPriority(qint32 priority) {
+    this->priority = priority;
+    this->m_priority_isSet = true;
+}
+
+QString*
+SWGThreadPrioritySettings::getCpuAffinity() {
+    return cpu_affinity;
+}
+void
+SWGThreadPrioritySettings::setCpuAffinity(QString* cpu_affinity) {
+    this->cpu_affinity = cpu_affinity;
+    this->m_cpu_affinity_isSet = true;
+}
+
+qint32
+SWGThreadPrioritySettings::getIsolate() {
+    return isolate;
+}
+void
+SWGThreadPrioritySettings::setIsolate(qint32 isolate) {
+    this->isolate = isolate;
+    this->m_isolate_isSet = true;
+}
+
+SWGThreadPriorityStatus*
+SWGThreadPrioritySettings::getEngineThread() {
+    return engine_thread;
+}
+void
+SWGThreadPrioritySettings::setEngineThread(SWGThreadPriorityStatus* engine_thread) {
+    this->engine_thread = engine_thread;
+    this->m_engine_thread_isSet = true;
+}
+
+SWGThreadPriorityStatus*
+SWGThreadPrioritySettings::getWorkerThread() {
+    return worker_thread;
+}
+void
+SWGThreadPrioritySettings::setWorkerThread(SWGThreadPriorityStatus* worker_thread) {
+    this->worker_thread = worker_thread;
+    this->m_worker_thread_isSet = true;
+}
+
+
+bool
+SWGThreadPrioritySettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(policy && *policy != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_priority_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(cpu_affinity && *cpu_affinity != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_isolate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(engine_thread && engine_thread->isSet()){
+            isObjectUpdated = true; break;
+        }
+        if(worker_thread && worker_thread->isSet()){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
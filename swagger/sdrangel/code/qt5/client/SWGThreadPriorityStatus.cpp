@@ -0,0 +1,206 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGThreadPriorityStatus.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGThreadPriorityStatus::SWGThreadPriorityStatus(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGThreadPriorityStatus::SWGThreadPriorityStatus() {
+    applied = 0;
+    m_applied_isSet = false;
+    policy = nullptr;
+    m_policy_isSet = false;
+    priority = 0;
+    m_priority_isSet = false;
+    cpu_affinity = nullptr;
+    m_cpu_affinity_isSet = false;
+    message = nullptr;
+    m_message_isSet = false;
+}
+
+SWGThreadPriorityStatus::~SWGThreadPriorityStatus() {
+    this->cleanup();
+}
+
+void
+SWGThreadPriorityStatus::init() {
+    applied = 0;
+    m_applied_isSet = false;
+    policy = new QString("");
+    m_policy_isSet = false;
+    priority = 0;
+    m_priority_isSet = false;
+    cpu_affinity = new QString("");
+    m_cpu_affinity_isSet = false;
+    message = new QString("");
+    m_message_isSet = false;
+}
+
+void
+SWGThreadPriorityStatus::cleanup() {
+
+    if(policy != nullptr) { 
+        delete policy;
+    }
+
+    if(cpu_affinity != nullptr) { 
+        delete cpu_affinity;
+    }
+    if(message != nullptr) { 
+        delete message;
+    }
+}
+
+SWGThreadPriorityStatus*
+SWGThreadPriorityStatus::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGThreadPriorityStatus::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&applied, pJson["applied"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&policy, pJson["policy"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&priority, pJson["priority"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&cpu_affinity, pJson["cpuAffinity"], "QString", "QString");
+    
+    ::SWGSDRangel::setValue(&message, pJson["message"], "QString", "QString");
+    
+}
+
+QString
+SWGThreadPriorityStatus::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGThreadPriorityStatus::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_applied_isSet){
+        obj->insert("applied", QJsonValue(applied));
+    }
+    if(policy != nullptr && *policy != QString("")){
+        toJsonValue(QString("policy"), policy, obj, QString("QString"));
+    }
+    if(m_priority_isSet){
+        obj->insert("priority", QJsonValue(priority));
+    }
+    if(cpu_affinity != nullptr && *cpu_affinity != QString("")){
+        toJsonValue(QString("cpuAffinity"), cpu_affinity, obj, QString("QString"));
+    }
+    if(message != nullptr && *message != QString("")){
+        toJsonValue(QString("message"), message, obj, QString("QString"));
+    }
+
+    return obj;
+}
+
+qint32
+SWGThreadPriorityStatus::getApplied() {
+    return applied;
+}
+void
+SWGThreadPriorityStatus::setApplied(qint32 applied) {
+    this->applied = applied;
+    this->m_applied_isSet = true;
+}
+
+QString*
+SWGThreadPriorityStatus::getPolicy() {
+    return policy;
+}
+void
+SWGThreadPriorityStatus::setPolicy(QString* policy) {
+    this->policy = policy;
+    this->m_policy_isSet = true;
+}
+
+qint32
+SWGThreadPriorityStatus::getPriority() {
+    return priority;
+}
+void
+SWGThreadPriorityStatus::setPriority(qint32 priority) {
+    this->priority = priority;
+    this->m_priority_isSet = true;
+}
+
+QString*
+SWGThreadPriorityStatus::getCpuAffinity() {
+    return cpu_affinity;
+}
+void
+SWGThreadPriorityStatus::setCpuAffinity(QString* cpu_affinity) {
+    this->cpu_affinity = cpu_affinity;
+    this->m_cpu_affinity_isSet = true;
+}
+
+QString*
+SWGThreadPriorityStatus::getMessage() {
+    return message;
+}
+void
+SWGThreadPriorityStatus::setMessage(QString* message) {
+    this->message = message;
+    this->m_message_isSet = true;
+}
+
+
+bool
+SWGThreadPriorityStatus::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_applied_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(policy && *policy != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(m_priority_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(cpu_affinity && *cpu_affinity != QString("")){
+            isObjectUpdated = true; break;
+        }
+        if(message && *message != QString("")){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+
@@ -0,0 +1,83 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+/*
+ * SWGThreadPriorityStatus.h
+ *
+ * Scheduling policy and CPU affinity in effect for a thread
+ */
+
+#ifndef SWGThreadPriorityStatus_H_
+#define SWGThreadPriorityStatus_H_
+
+#include <QJsonObject>
+
+
+#include <QString>
+
+#include "SWGObject.h"
+#include "export.h"
+
+namespace SWGSDRangel {
+
+class SWG_API SWGThreadPriorityStatus: public SWGObject {
+public:
+    SWGThreadPriorityStatus();
+    SWGThreadPriorityStatus(QString* json);
+    virtual ~SWGThreadPriorityStatus();
+    void init();
+    void cleanup();
+
+    virtual QString asJson () override;
+    virtual QJsonObject* asJsonObject() override;
+    virtual void fromJsonObject(QJsonObject &json) override;
+    virtual SWGThreadPriorityStatus* fromJson(QString &jsonString) override;
+
+    qint32 getApplied();
+    void setApplied(qint32 applied);
+
+    QString* getPolicy();
+    void setPolicy(QString* policy);
+
+    qint32 getPriority();
+    void setPriority(qint32 priority);
+
+    QString* getCpuAffinity();
+    void setCpuAffinity(QString* cpu_affinity);
+
+    QString* getMessage();
+    void setMessage(QString* message);
+
+
+    virtual bool isSet() override;
+
+private:
+    qint32 applied;
+    bool m_applied_isSet;
+
+    QString* policy;
+    bool m_policy_isSet;
+
+    qint32 priority;
+    bool m_priority_isSet;
+
+    QString* cpu_affinity;
+    bool m_cpu_affinity_isSet;
+
+    QString* message;
+    bool m_message_isSet;
+
+};
+
+}
+
+#endif /* SWGThreadPriorityStatus_H_ */
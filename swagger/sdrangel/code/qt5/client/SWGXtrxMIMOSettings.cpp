@@ -0,0 +1,453 @@
+/**
+ * SDRangel
+ * This is the web REST/JSON API of SDRangel SDR software. SDRangel is an Open Source Qt5/OpenGL 3.0+ (4.3+ in Windows) GUI and server Software Defined Radio and signal analyzer in software. It supports Airspy, BladeRF, HackRF, LimeSDR, PlutoSDR, RTL-SDR, SDRplay RSP1 and FunCube    ---   Limitations and specifcities:    * In SDRangel GUI the first Rx device set cannot be deleted. Conversely the server starts with no device sets and its number of device sets can be reduced to zero by as many calls as necessary to /sdrangel/deviceset with DELETE method.   * Preset import and export from/to file is a server only feature.   * Device set focus is a GUI only feature.   * The following channels are not implemented (status 501 is returned): ATV and DATV demodulators, Channel Analyzer NG, LoRa demodulator   * The device settings and report structures contains only the sub-structure corresponding to the device type. The DeviceSettings and DeviceReport structures documented here shows all of them but only one will be or should be present at a time   * The channel settings and report structures contains only the sub-structure corresponding to the channel type. The ChannelSettings and ChannelReport structures documented here shows all of them but only one will be or should be present at a time    --- 
+ *
+ * OpenAPI spec version: 4.15.0
+ * Contact: f4exb06@gmail.com
+ *
+ * NOTE: This class is auto generated by the swagger code generator program.
+ * https://github.com/swagger-api/swagger-codegen.git
+ * Do not edit the class manually.
+ */
+
+
+#include "SWGXtrxMIMOSettings.h"
+
+#include "SWGHelpers.h"
+
+#include <QJsonDocument>
+#include <QJsonArray>
+#include <QObject>
+#include <QDebug>
+
+namespace SWGSDRangel {
+
+SWGXtrxMIMOSettings::SWGXtrxMIMOSettings(QString* json) {
+    init();
+    this->fromJson(*json);
+}
+
+SWGXtrxMIMOSettings::SWGXtrxMIMOSettings() {
+    dev_sample_rate = 0;
+    m_dev_sample_rate_isSet = false;
+    log2_hard_decim = 0;
+    m_log2_hard_decim_isSet = false;
+    rx_center_frequency = 0L;
+    m_rx_center_frequency_isSet = false;
+    log2_soft_decim = 0;
+    m_log2_soft_decim_isSet = false;
+    fc_pos_rx = 0;
+    m_fc_pos_rx_isSet = false;
+    lpf_bw = 0;
+    m_lpf_bw_isSet = false;
+    antenna_path = 0;
+    m_antenna_path_isSet = false;
+    rx0_gain = 0;
+    m_rx0_gain_isSet = false;
+    rx1_gain = 0;
+    m_rx1_gain_isSet = false;
+    ext_clock = 0;
+    m_ext_clock_isSet = false;
+    ext_clock_freq = 0;
+    m_ext_clock_freq_isSet = false;
+    pwrmode = 0;
+    m_pwrmode_isSet = false;
+    dc_block = 0;
+    m_dc_block_isSet = false;
+    iq_correction = 0;
+    m_iq_correction_isSet = false;
+    iq_order = 0;
+    m_iq_order_isSet = false;
+    spectrum_stream_index = 0;
+    m_spectrum_stream_index_isSet = false;
+}
+
+SWGXtrxMIMOSettings::~SWGXtrxMIMOSettings() {
+    this->cleanup();
+}
+
+void
+SWGXtrxMIMOSettings::init() {
+    dev_sample_rate = 0;
+    m_dev_sample_rate_isSet = false;
+    log2_hard_decim = 0;
+    m_log2_hard_decim_isSet = false;
+    rx_center_frequency = 0L;
+    m_rx_center_frequency_isSet = false;
+    log2_soft_decim = 0;
+    m_log2_soft_decim_isSet = false;
+    fc_pos_rx = 0;
+    m_fc_pos_rx_isSet = false;
+    lpf_bw = 0;
+    m_lpf_bw_isSet = false;
+    antenna_path = 0;
+    m_antenna_path_isSet = false;
+    rx0_gain = 0;
+    m_rx0_gain_isSet = false;
+    rx1_gain = 0;
+    m_rx1_gain_isSet = false;
+    ext_clock = 0;
+    m_ext_clock_isSet = false;
+    ext_clock_freq = 0;
+    m_ext_clock_freq_isSet = false;
+    pwrmode = 0;
+    m_pwrmode_isSet = false;
+    dc_block = 0;
+    m_dc_block_isSet = false;
+    iq_correction = 0;
+    m_iq_correction_isSet = false;
+    iq_order = 0;
+    m_iq_order_isSet = false;
+    spectrum_stream_index = 0;
+    m_spectrum_stream_index_isSet = false;
+}
+
+void
+SWGXtrxMIMOSettings::cleanup() {
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+
+}
+
+SWGXtrxMIMOSettings*
+SWGXtrxMIMOSettings::fromJson(QString &json) {
+    QByteArray array (json.toStdString().c_str());
+    QJsonDocument doc = QJsonDocument::fromJson(array);
+    QJsonObject jsonObject = doc.object();
+    this->fromJsonObject(jsonObject);
+    return this;
+}
+
+void
+SWGXtrxMIMOSettings::fromJsonObject(QJsonObject &pJson) {
+    ::SWGSDRangel::setValue(&dev_sample_rate, pJson["devSampleRate"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&log2_hard_decim, pJson["log2HardDecim"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx_center_frequency, pJson["rxCenterFrequency"], "qint64", "");
+    
+    ::SWGSDRangel::setValue(&log2_soft_decim, pJson["log2SoftDecim"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&fc_pos_rx, pJson["fcPosRx"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&lpf_bw, pJson["lpfBW"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&antenna_path, pJson["antennaPath"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx0_gain, pJson["rx0Gain"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&rx1_gain, pJson["rx1Gain"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&ext_clock, pJson["extClock"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&ext_clock_freq, pJson["extClockFreq"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&pwrmode, pJson["pwrmode"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&dc_block, pJson["dcBlock"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&iq_correction, pJson["iqCorrection"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&iq_order, pJson["iqOrder"], "qint32", "");
+    
+    ::SWGSDRangel::setValue(&spectrum_stream_index, pJson["spectrumStreamIndex"], "qint32", "");
+    
+}
+
+QString
+SWGXtrxMIMOSettings::asJson ()
+{
+    QJsonObject* obj = this->asJsonObject();
+
+    QJsonDocument doc(*obj);
+    QByteArray bytes = doc.toJson();
+    delete obj;
+    return QString(bytes);
+}
+
+QJsonObject*
+SWGXtrxMIMOSettings::asJsonObject() {
+    QJsonObject* obj = new QJsonObject();
+    if(m_dev_sample_rate_isSet){
+        obj->insert("devSampleRate", QJsonValue(dev_sample_rate));
+    }
+    if(m_log2_hard_decim_isSet){
+        obj->insert("log2HardDecim", QJsonValue(log2_hard_decim));
+    }
+    if(m_rx_center_frequency_isSet){
+        obj->insert("rxCenterFrequency", QJsonValue(rx_center_frequency));
+    }
+    if(m_log2_soft_decim_isSet){
+        obj->insert("log2SoftDecim", QJsonValue(log2_soft_decim));
+    }
+    if(m_fc_pos_rx_isSet){
+        obj->insert("fcPosRx", QJsonValue(fc_pos_rx));
+    }
+    if(m_lpf_bw_isSet){
+        obj->insert("lpfBW", QJsonValue(lpf_bw));
+    }
+    if(m_antenna_path_isSet){
+        obj->insert("antennaPath", QJsonValue(antenna_path));
+    }
+    if(m_rx0_gain_isSet){
+        obj->insert("rx0Gain", QJsonValue(rx0_gain));
+    }
+    if(m_rx1_gain_isSet){
+        obj->insert("rx1Gain", QJsonValue(rx1_gain));
+    }
+    if(m_ext_clock_isSet){
+        obj->insert("extClock", QJsonValue(ext_clock));
+    }
+    if(m_ext_clock_freq_isSet){
+        obj->insert("extClockFreq", QJsonValue(ext_clock_freq));
+    }
+    if(m_pwrmode_isSet){
+        obj->insert("pwrmode", QJsonValue(pwrmode));
+    }
+    if(m_dc_block_isSet){
+        obj->insert("dcBlock", QJsonValue(dc_block));
+    }
+    if(m_iq_correction_isSet){
+        obj->insert("iqCorrection", QJsonValue(iq_correction));
+    }
+    if(m_iq_order_isSet){
+        obj->insert("iqOrder", QJsonValue(iq_order));
+    }
+    if(m_spectrum_stream_index_isSet){
+        obj->insert("spectrumStreamIndex", QJsonValue(spectrum_stream_index));
+    }
+
+    return obj;
+}
+
+qint32
+SWGXtrxMIMOSettings::getDevSampleRate() {
+    return dev_sample_rate;
+}
+void
+SWGXtrxMIMOSettings::setDevSampleRate(qint32 dev_sample_rate) {
+    this->dev_sample_rate = dev_sample_rate;
+    this->m_dev_sample_rate_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getLog2HardDecim() {
+    return log2_hard_decim;
+}
+void
+SWGXtrxMIMOSettings::setLog2HardDecim(qint32 log2_hard_decim) {
+    this->log2_hard_decim = log2_hard_decim;
+    this->m_log2_hard_decim_isSet = true;
+}
+
+qint64
+SWGXtrxMIMOSettings::getRxCenterFrequency() {
+    return rx_center_frequency;
+}
+void
+SWGXtrxMIMOSettings::setRxCenterFrequency(qint64 rx_center_frequency) {
+    this->rx_center_frequency = rx_center_frequency;
+    this->m_rx_center_frequency_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getLog2SoftDecim() {
+    return log2_soft_decim;
+}
+void
+SWGXtrxMIMOSettings::setLog2SoftDecim(qint32 log2_soft_decim) {
+    this->log2_soft_decim = log2_soft_decim;
+    this->m_log2_soft_decim_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getFcPosRx() {
+    return fc_pos_rx;
+}
+void
+SWGXtrxMIMOSettings::setFcPosRx(qint32 fc_pos_rx) {
+    this->fc_pos_rx = fc_pos_rx;
+    this->m_fc_pos_rx_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getLpfBw() {
+    return lpf_bw;
+}
+void
+SWGXtrxMIMOSettings::setLpfBw(qint32 lpf_bw) {
+    this->lpf_bw = lpf_bw;
+    this->m_lpf_bw_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getAntennaPath() {
+    return antenna_path;
+}
+void
+SWGXtrxMIMOSettings::setAntennaPath(qint32 antenna_path) {
+    this->antenna_path = antenna_path;
+    this->m_antenna_path_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getRx0Gain() {
+    return rx0_gain;
+}
+void
+SWGXtrxMIMOSettings::setRx0Gain(qint32 rx0_gain) {
+    this->rx0_gain = rx0_gain;
+    this->m_rx0_gain_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getRx1Gain() {
+    return rx1_gain;
+}
+void
+SWGXtrxMIMOSettings::setRx1Gain(qint32 rx1_gain) {
+    this->rx1_gain = rx1_gain;
+    this->m_rx1_gain_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getExtClock() {
+    return ext_clock;
+}
+void
+SWGXtrxMIMOSettings::setExtClock(qint32 ext_clock) {
+    this->ext_clock = ext_clock;
+    this->m_ext_clock_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getExtClockFreq() {
+    return ext_clock_freq;
+}
+void
+SWGXtrxMIMOSettings::setExtClockFreq(qint32 ext_clock_freq) {
+    this->ext_clock_freq = ext_clock_freq;
+    this->m_ext_clock_freq_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getPwrmode() {
+    return pwrmode;
+}
+void
+SWGXtrxMIMOSettings::setPwrmode(qint32 pwrmode) {
+    this->pwrmode = pwrmode;
+    this->m_pwrmode_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getDcBlock() {
+    return dc_block;
+}
+void
+SWGXtrxMIMOSettings::setDcBlock(qint32 dc_block) {
+    this->dc_block = dc_block;
+    this->m_dc_block_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getIqCorrection() {
+    return iq_correction;
+}
+void
+SWGXtrxMIMOSettings::setIqCorrection(qint32 iq_correction) {
+    this->iq_correction = iq_correction;
+    this->m_iq_correction_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getIqOrder() {
+    return iq_order;
+}
+void
+SWGXtrxMIMOSettings::setIqOrder(qint32 iq_order) {
+    this->iq_order = iq_order;
+    this->m_iq_order_isSet = true;
+}
+
+qint32
+SWGXtrxMIMOSettings::getSpectrumStreamIndex() {
+    return spectrum_stream_index;
+}
+void
+SWGXtrxMIMOSettings::setSpectrumStreamIndex(qint32 spectrum_stream_index) {
+    this->spectrum_stream_index = spectrum_stream_index;
+    this->m_spectrum_stream_index_isSet = true;
+}
+
+
+bool
+SWGXtrxMIMOSettings::isSet(){
+    bool isObjectUpdated = false;
+    do{
+        if(m_dev_sample_rate_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_log2_hard_decim_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx_center_frequency_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_log2_soft_decim_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_fc_pos_rx_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_lpf_bw_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_antenna_path_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx0_gain_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_rx1_gain_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_ext_clock_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_ext_clock_freq_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_pwrmode_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_dc_block_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_iq_correction_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_iq_order_isSet){
+            isObjectUpdated = true; break;
+        }
+        if(m_spectrum_stream_index_isSet){
+            isObjectUpdated = true; break;
+        }
+    }while(false);
+    return isObjectUpdated;
+}
+}
+